@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+
+# See https://www.unicode.org/reports/tr15/#Primary_Composite and
+# https://www.unicode.org/reports/tr44/#Comp_Ex
+
+import sys
+
+print(" // NOTE: File generated by generate-composition-info.py - do not edit")
+print("")
+print("#include <algorithm>")
+print("#include <cstdint>")
+print("#include \"libutfdecode.hpp\"")
+print("")
+
+combining_classes = {}
+canonical_decompositions = {}
+for line in open("UnicodeData.txt"):
+    parts = line.split(';')
+    code_point = int(parts[0], 16)
+    combining_classes[code_point] = int(parts[3])
+    decomposition_info = parts[5]
+    if decomposition_info and not decomposition_info.startswith('<'):
+        canonical_decompositions[code_point] = [int(value, 16) for value in decomposition_info.split(" ")]
+
+excluded = set()
+for line in open("CompositionExclusions.txt"):
+    line = line.split('#')[0].strip()
+    if line:
+        excluded.add(int(line, 16))
+
+# Group the primary composites by their second code point, since there are
+# only a few different second code points and most pairs can be rejected by
+# just looking at the second one:
+pairs_by_second = {}
+for code_point, decomposition in canonical_decompositions.items():
+    # Singletons never compose:
+    if len(decomposition) != 2: continue
+    if code_point in excluded: continue
+    # Neither do non-starter decompositions:
+    if combining_classes.get(code_point, 0) != 0: continue
+    if combining_classes.get(decomposition[0], 0) != 0: continue
+    (first, second) = decomposition
+    pairs_by_second.setdefault(second, []).append((first, code_point))
+
+print("struct composition_second_t {")
+print("  uint32_t second;")
+print("  uint16_t pairs_start;")
+print("  uint16_t pairs_count;")
+print("};")
+print("")
+print("struct composition_pair_t {")
+print("  uint32_t first;")
+print("  uint32_t composite;")
+print("};")
+print("")
+
+print("static constexpr composition_second_t composition_seconds[] = {")
+pairs_start = 0
+for second in sorted(pairs_by_second):
+    pairs_count = len(pairs_by_second[second])
+    print("  { " + hex(second) + ", " + str(pairs_start) + ", " + str(pairs_count) + " },")
+    pairs_start += pairs_count
+print("};")
+print("")
+
+print("static constexpr composition_pair_t composition_pairs[] = {")
+for second in sorted(pairs_by_second):
+    for (first, composite) in sorted(pairs_by_second[second]):
+        print("  { " + hex(first) + ", " + hex(composite) + " },")
+print("};")
+print("")
+
+print("""uint32_t unicode_compose(uint32_t first, uint32_t second) {
+  if (second < composition_seconds[0].second) {
+    return 0;
+  }
+  auto seconds_end = std::end(composition_seconds);
+  auto second_entry = std::lower_bound(std::begin(composition_seconds), seconds_end, second,
+      [](composition_second_t const& entry, uint32_t value) { return entry.second < value; });
+  if (second_entry == seconds_end || second_entry->second != second) {
+    return 0;
+  }
+
+  auto pairs_begin = composition_pairs + second_entry->pairs_start;
+  auto pairs_end = pairs_begin + second_entry->pairs_count;
+  auto pair_entry = std::lower_bound(pairs_begin, pairs_end, first,
+      [](composition_pair_t const& entry, uint32_t value) { return entry.first < value; });
+  if (pair_entry == pairs_end || pair_entry->first != first) {
+    return 0;
+  }
+  return pair_entry->composite;
+}""")
+print("")
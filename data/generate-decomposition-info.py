@@ -8,44 +8,122 @@ print(" // NOTE: File generated by generate-decomposition-info.py - do not edit"
 print("")
 print("#include <vector>")
 print("#include <cstdint>")
-print("#include \"utfdecode.hpp\"")
+print("#include \"libutfdecode.hpp\"")
 print("")
-print("const uint32_t unicode_decompose_lookup[] = {")
-first = True
-canonical_dict = {}
-compatible_dict = {}
-lookup_index = 0
+combining_classes = {}
+decompositions = {}
 for line in open("UnicodeData.txt"):
     parts = line.split(';')
+    code_point = int(parts[0], 16)
+    combining_classes[code_point] = int(parts[3])
     decomposition_info = parts[5]
     if not decomposition_info: continue
     decomposition_parts = decomposition_info.split(" ")
-    if '<' in decomposition_parts[0]:
+    compatible = '<' in decomposition_parts[0]
+    if compatible:
         decomposition_parts = decomposition_parts[1:]
-        compatible_dict[parts[0]] = (lookup_index, len(decomposition_parts))
-    else:
-        canonical_dict[parts[0]] = (lookup_index, len(decomposition_parts))
-    lookup_index += len(decomposition_parts)
-    for value in decomposition_parts:
-        prefix = ", "
-        if first:
-            prefix = ""
-            first = False
-        print(prefix + "0x" + value)
+    decompositions[code_point] = (compatible, [int(value, 16) for value in decomposition_parts])
+
+# Decompositions in UnicodeData.txt may themselves contain decomposable code
+# points, so expand them fully here instead of recursing at runtime.
+def full_decomposition(code_point, compatible):
+    if 0xAC00 <= code_point <= 0xD7A3:
+        # Hangul syllables, see section 3.12 of the Unicode standard:
+        s_index = code_point - 0xAC00
+        result = [0x1100 + s_index // 588, 0x1161 + (s_index % 588) // 28]
+        if s_index % 28 != 0:
+            result.append(0x11A7 + s_index % 28)
+        return result
+    if code_point not in decompositions:
+        return [code_point]
+    (is_compatibility_mapping, parts) = decompositions[code_point]
+    if is_compatibility_mapping and not compatible:
+        return [code_point]
+    result = []
+    for part in parts:
+        result += full_decomposition(part, compatible)
+    return result
+
+# Each element is a code point with its canonical combining class in the top
+# 8 bits, so that no property lookups are needed when normalizing.
+lookup = []
+def add_to_lookup(decomposition):
+    offset = len(lookup)
+    lookup.extend(combining_classes.get(part, 0) << 24 | part for part in decomposition)
+    return offset
+
+# Two-stage index from code point to its decompositions in
+# unicode_decompose_lookup, packed as:
+#   offset << 11 | separate << 10 | compatible_length << 5 | canonical_length
+# The canonical decomposition is at offset. The compatibility decomposition
+# follows it if separate is set, and is the same one otherwise. A value of 0
+# means that there is no decomposition. The high bits of a code point select
+# a block of values, and identical blocks are only stored once.
+MAX_CODE_POINT = 0x10FFFF
+packed_values = [0] * (MAX_CODE_POINT + 1)
+for code_point, (is_compatibility_mapping, parts) in decompositions.items():
+    canonical = [] if is_compatibility_mapping else full_decomposition(code_point, False)
+    compatible = full_decomposition(code_point, True)
+    offset = add_to_lookup(canonical)
+    separate = canonical != compatible
+    if separate:
+        add_to_lookup(compatible)
+    assert len(canonical) < 32 and len(compatible) < 32
+    packed_values[code_point] = offset << 11 | separate << 10 | len(compatible) << 5 | len(canonical)
+
+print("const uint32_t unicode_decompose_lookup[] = {")
+for i in range(0, len(lookup), 8):
+    print("  " + ", ".join("0x%08X" % value for value in lookup[i:i + 8]) + ",")
 print("};")
 print("")
-print("uint32_t const* unicode_decompose(uint32_t codePoint, bool compatible, uint8_t* len) {")
-print("  switch (codePoint) {")
-for code_point, (lookup_index, lookup_len) in canonical_dict.items():
-    print("    case 0x" + code_point + ": *len = " + str(lookup_len) + "; return &unicode_decompose_lookup[" + str(lookup_index) + "];")
-print("  }")
+
+best = None
+for shift in range(4, 11):
+    block_size = 1 << shift
+    blocks = []
+    block_to_number = {}
+    stage1 = []
+    for block_start in range(0, MAX_CODE_POINT + 1, block_size):
+        block = tuple(packed_values[block_start:block_start + block_size])
+        if block not in block_to_number:
+            block_to_number[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_to_number[block])
+    table_size = 2 * len(stage1) + 4 * block_size * len(blocks)
+    if best is None or table_size < best[0]:
+        best = (table_size, shift, stage1, blocks)
+(table_size, shift, stage1, blocks) = best
+
+print("static constexpr unsigned int DECOMPOSITION_BLOCK_SHIFT = " + str(shift) + ";")
+print("static constexpr uint32_t DECOMPOSITION_BLOCK_MASK = (1 << DECOMPOSITION_BLOCK_SHIFT) - 1;")
 print("")
-print("  if (compatible) switch(codePoint) {")
-for code_point, (lookup_index, lookup_len) in compatible_dict.items():
-    print("    case 0x" + code_point + ": *len = " + str(lookup_len) + "; return &unicode_decompose_lookup[" + str(lookup_index) + "];")
-print("  }")
-print("  *len = 0;")
-print("  return nullptr;")
-print("}")
+print("static constexpr uint16_t decomposition_block_numbers[] = {")
+for i in range(0, len(stage1), 16):
+    print("  " + ", ".join(str(v) for v in stage1[i:i + 16]) + ",")
+print("};")
+print("")
+values = [value for block in blocks for value in block]
+print("static constexpr uint32_t decomposition_block_values[] = {")
+for i in range(0, len(values), 8):
+    print("  " + ", ".join(hex(v) for v in values[i:i + 8]) + ",")
+print("};")
+print("")
+print("""uint32_t const* unicode_decompose(uint32_t codePoint, bool compatible, uint8_t* len) {
+  uint32_t packed = 0;
+  if (codePoint <= """ + hex(MAX_CODE_POINT) + """) {
+    uint32_t block = decomposition_block_numbers[codePoint >> DECOMPOSITION_BLOCK_SHIFT];
+    packed = decomposition_block_values[(block << DECOMPOSITION_BLOCK_SHIFT) | (codePoint & DECOMPOSITION_BLOCK_MASK)];
+  }
+  uint32_t const* decomposition = &unicode_decompose_lookup[packed >> 11];
+  uint8_t canonical_len = packed & 0x1F;
+  if (!compatible) {
+    *len = canonical_len;
+  } else {
+    *len = (packed >> 5) & 0x1F;
+    if (packed & (1 << 10)) {
+      decomposition += canonical_len;
+    }
+  }
+  return *len == 0 ? nullptr : decomposition;
+}""")
 print("")
-
@@ -2,5 +2,6 @@
 set -e -u
 
 ./generate-decomposition-info.py > ../utfdecode_decompose.cpp
+./generate-composition-info.py > ../utfdecode_compose.cpp
 ./massage_blocks.py > ../utfdecode_blocks.cpp
 ./massage_unicode_data.py > ../utfdecode_code_point.cpp
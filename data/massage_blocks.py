@@ -9,10 +9,15 @@ print("")
 print("struct unicode_block_t {")
 print("    uint32_t start;")
 print("    uint32_t end;")
-print("    char const* name;")
+print("    uint16_t name_offset;")
 print("};")
 print("")
-print("static unicode_block_t unicode_blocks[] = {")
+print("static constexpr unicode_block_t unicode_blocks[] = {")
+
+# Names are stored as offsets into one string pool so that the table needs no
+# relocations:
+block_names = []
+block_names_size = 0
 
 for line in open("Blocks.txt"):
     if line.startswith('#') or not ';' in line:
@@ -22,15 +27,22 @@ for line in open("Blocks.txt"):
     #numeric_value = int(parts[0], 16)
     block_name = parts[1].strip()
 
-    print(f'    {{ 0x{start_value}, 0x{end_value}, "{block_name}" }},')
+    print(f'    {{ 0x{start_value}, 0x{end_value}, {block_names_size} }},')
+    block_names.append(block_name)
+    block_names_size += len(block_name) + 1
 
 print("};")
+print("")
+print("static constexpr char unicode_block_names[] =")
+for block_name in block_names:
+    print(f'    "{block_name}\\0"')
+print(";")
+print("")
 print("""char const* get_block_name(uint32_t codepoint) {
         for (unsigned int i = 0; i < sizeof(unicode_blocks) / sizeof(unicode_block_t); i++) {
                 unicode_block_t const& b = unicode_blocks[i];
-                if (b.start <= codepoint && b.end >= codepoint) return b.name;
+                if (b.start <= codepoint && b.end >= codepoint) return unicode_block_names + b.name_offset;
         }
         return nullptr;
 }""")
 print("")
-
@@ -5,13 +5,25 @@ import sys
 print(" // NOTE: File generated by massage_unicode_data.py - do not edit")
 print("")
 print("#include <cstdint>")
-print("#include <iomanip>")
-print("#include <map>")
+print("#include <cstdio>")
 print("#include <string>")
-print("#include <sstream>")
-print("#include \"utfdecode.hpp\"")
+print("#include \"libutfdecode.hpp\"")
 print("")
-print("static code_point code_points_array[] = {")
+print("static constexpr code_point code_points_array[] = {")
+
+# Names are stored as offsets into one string pool rather than as pointers,
+# so that the tables need no relocations and can stay in read-only memory.
+names = []
+names_size = 0
+def add_name(name):
+    global names_size
+    offset = names_size
+    names.append(name)
+    names_size += len(name) + 1
+    return str(offset)
+
+# Index 0 is what code points not in UnicodeData.txt map to:
+print(' { 0, ' + add_name('<unassigned>') + ', general_category_value_t::Unassigned, 0, false, 0, 0, 0, 0 },')
 
 category_abbreviation_map = {
     'Lu': 'Uppercase_Letter',
@@ -54,12 +66,70 @@ category_abbreviation_map = {
     'C': 'Other'
 }
 
-array_index = 0
-code_point_to_array_index = {}
-first_numeric_value = -1
+MAX_CODE_POINT = 0x10FFFF
+UNASSIGNED_INDEX = 0
+
+# The NF*_Quick_Check properties, derived from the decompositions and
+# composition exclusions as described in
+# https://www.unicode.org/reports/tr15/#Detecting_Normalization_Forms
+QUICK_CHECK_NFD_NO = 1 << 0
+QUICK_CHECK_NFKD_NO = 1 << 1
+QUICK_CHECK_NFC_NO = 1 << 2
+QUICK_CHECK_NFC_MAYBE = 1 << 3
+QUICK_CHECK_NFKC_NO = 1 << 4
+QUICK_CHECK_NFKC_MAYBE = 1 << 5
+
+combining_classes = {}
+decompositions = {}
+for line in open("UnicodeData.txt"):
+    parts = line.split(';')
+    combining_classes[int(parts[0], 16)] = int(parts[3])
+    if parts[5]:
+        decompositions[int(parts[0], 16)] = parts[5].split(" ")
+
+composition_excluded = set()
+for line in open("CompositionExclusions.txt"):
+    line = line.split('#')[0].strip()
+    if line:
+        composition_excluded.add(int(line, 16))
+
+quick_check = {}
+def add_quick_check(code_point, flags):
+    quick_check[code_point] = quick_check.get(code_point, 0) | flags
+
+def has_compatibility_decomposition(code_point):
+    decomposition = decompositions.get(code_point)
+    if not decomposition:
+        return False
+    if decomposition[0].startswith('<'):
+        return True
+    return any(has_compatibility_decomposition(int(value, 16)) for value in decomposition)
+
+for code_point, decomposition in decompositions.items():
+    if has_compatibility_decomposition(code_point):
+        add_quick_check(code_point, QUICK_CHECK_NFKD_NO | QUICK_CHECK_NFKC_NO)
+    if decomposition[0].startswith('<'):
+        continue
+    add_quick_check(code_point, QUICK_CHECK_NFD_NO | QUICK_CHECK_NFKD_NO)
+    parts = [int(value, 16) for value in decomposition]
+    if (len(parts) == 1 or code_point in composition_excluded
+            or combining_classes[code_point] != 0 or combining_classes.get(parts[0], 0) != 0):
+        # Full composition exclusions never occur in composed text:
+        add_quick_check(code_point, QUICK_CHECK_NFC_NO | QUICK_CHECK_NFKC_NO)
+    else:
+        # While the second code point of a primary composite may compose
+        # with what is before it:
+        add_quick_check(parts[1], QUICK_CHECK_NFC_MAYBE | QUICK_CHECK_NFKC_MAYBE)
 
-check_string = ""
-check_string_metadata = ""
+# Hangul syllables decompose, and vowel and trailing jamos may compose:
+for code_point in range(0xAC00, 0xD7A4):
+    add_quick_check(code_point, QUICK_CHECK_NFD_NO | QUICK_CHECK_NFKD_NO)
+for code_point in list(range(0x1161, 0x1176)) + list(range(0x11A8, 0x11C3)):
+    add_quick_check(code_point, QUICK_CHECK_NFC_MAYBE | QUICK_CHECK_NFKC_MAYBE)
+
+array_index = 1
+code_point_to_array_index = [UNASSIGNED_INDEX] * (MAX_CODE_POINT + 1)
+first_numeric_value = -1
 
 for line in open("UnicodeData.txt"):
     parts = line.split(';')
@@ -83,21 +153,8 @@ for line in open("UnicodeData.txt"):
         name = name[1:-7].upper() # "<xxx, Last>" -> "XXX"
         last_numeric_value = numeric_value
 
-        if check_string: check_string += " else "
-        else: check_string = "    "
-        check_string += "if (code_point >= " + hex(first_numeric_value) + " && code_point <= " + hex(last_numeric_value) + ") {\n"
-        check_string += "      std::stringstream stream;\n"
-        check_string += '      stream << "' + name + ' "'
-        check_string += " << std::setfill('0') << std::setw(4)"
-        check_string += ' << std::uppercase << std::hex << code_point;\n'
-        check_string += '      return stream.str();\n'
-        check_string += '    }'
-
-        if check_string_metadata: check_string_metadata += " else "
-        else: check_string_metadata = "    "
-        check_string_metadata += "if (code_point >= " + hex(first_numeric_value) + " && code_point <= " + hex(last_numeric_value) + ") {\n"
-        check_string_metadata += "      return &code_points_array[" + str(array_index) + "];\n"
-        check_string_metadata += "    }"
+        for c in range(first_numeric_value, last_numeric_value):
+            code_point_to_array_index[c] = array_index
 
     # http://www.unicode.org/reports/tr44/#General_Category_Values
     if name == '<control>' and parts[10]:
@@ -112,10 +169,11 @@ for line in open("UnicodeData.txt"):
     simple_titlecase_mapping = simple_uppercase_mapping if parts[14] == '\n' else int(parts[14], 16)
 
     print(' { ' + str(numeric_value) +
-            ', "' + name + '"' +
+            ', ' + add_name(name) +
             ', general_category_value_t::' + category_abbreviation_map[general_category] +
             ', ' + canonical_combining_class +
             ', ' + bidi_mirrored +
+            ', ' + str(quick_check.get(numeric_value, 0)) +
             ', ' + str(simple_uppercase_mapping) +
             ', ' + str(simple_lowercase_mapping) +
             ', ' + str(simple_titlecase_mapping) +
@@ -126,31 +184,68 @@ for line in open("UnicodeData.txt"):
 
 print("};")
 print("")
-print("std::map<uint32_t, code_point> unicode_code_points;")
-print("void unicode_code_points_initialize() {")
-print("    for (unsigned int i = 0; i < sizeof(code_points_array) / sizeof(code_points_array[0]); i++) {")
-print("        unicode_code_points[code_points_array[i].numeric_value] = code_points_array[i];")
-print("    }")
-print("}");
-print("")
-print("code_point const* lookup_code_point(uint32_t code_point) {")
-print("  auto entry = unicode_code_points.find(code_point);")
-print("  if (entry == unicode_code_points.end()) {")
-print(check_string_metadata)
-print("    fprintf(stderr, \"invalid code point %u\\n\", code_point);")
-print("    exit(1);")
-print("  }")
-print("  return &entry->second;")
-print("}")
+
+print("static constexpr char code_point_names[] =")
+for name in names:
+    print('  "' + name + '\\0"')
+print(";")
 print("")
-print("std::string lookup_code_point_name(uint32_t code_point) {")
-print("  auto entry = unicode_code_points.find(code_point);")
-print("  if (entry == unicode_code_points.end()) {")
-print(check_string)
-print("    fprintf(stderr, \"Invalid code point %u\\n\", code_point);")
-print("    exit(1);")
-print("  }")
-print("  return std::string(entry->second.name);")
-print("}")
+
+# Two-stage table: the high bits of a code point select a block of indices
+# into code_points_array, and identical blocks are only stored once. Pick the
+# block size giving the smallest tables.
+best = None
+for shift in range(4, 11):
+    block_size = 1 << shift
+    blocks = []
+    block_to_number = {}
+    stage1 = []
+    for block_start in range(0, MAX_CODE_POINT + 1, block_size):
+        block = tuple(code_point_to_array_index[block_start:block_start + block_size])
+        if block not in block_to_number:
+            block_to_number[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_to_number[block])
+    table_size = 2 * len(stage1) + 2 * block_size * len(blocks)
+    if best is None or table_size < best[0]:
+        best = (table_size, shift, stage1, blocks)
+(table_size, shift, stage1, blocks) = best
+
+def print_table(name, values, per_line=16):
+    print("static constexpr uint16_t " + name + "[] = {")
+    for i in range(0, len(values), per_line):
+        print("  " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    print("};")
+    print("")
+
+print("static constexpr unsigned int CODE_POINT_BLOCK_SHIFT = " + str(shift) + ";")
+print("static constexpr uint32_t CODE_POINT_BLOCK_MASK = (1 << CODE_POINT_BLOCK_SHIFT) - 1;")
 print("")
+print_table("code_point_block_numbers", stage1)
+print_table("code_point_block_indices", [index for block in blocks for index in block])
+
+print("""static uint16_t code_point_index(uint32_t code_point) {
+  if (code_point > """ + hex(MAX_CODE_POINT) + """) {
+    return """ + str(UNASSIGNED_INDEX) + """;
+  }
+  uint32_t block = code_point_block_numbers[code_point >> CODE_POINT_BLOCK_SHIFT];
+  return code_point_block_indices[(block << CODE_POINT_BLOCK_SHIFT) | (code_point & CODE_POINT_BLOCK_MASK)];
+}
 
+code_point const* lookup_code_point(uint32_t code_point) {
+  return &code_points_array[code_point_index(code_point)];
+}
+
+std::string lookup_code_point_name(uint32_t code_point) {
+  uint16_t index = code_point_index(code_point);
+  auto const& entry = code_points_array[index];
+  char const* name = code_point_names + entry.name_offset;
+  if (index != """ + str(UNASSIGNED_INDEX) + """ && entry.numeric_value != code_point) {
+    // Part of a range such as "<CJK Ideograph, First>" to "<CJK Ideograph, Last>":
+    char suffix[16];
+    snprintf(suffix, sizeof(suffix), " %04X", code_point);
+    return std::string(name) + suffix;
+  }
+  return std::string(name);
+}
+""")
@@ -0,0 +1,88 @@
+#ifndef LIBUTFDECODE_H_INCLUDED
+#define LIBUTFDECODE_H_INCLUDED
+
+/* A C interface to the transcoders of libutfdecode. The library is written
+   in C++, so C programs must also link with the C++ standard library, as in
+   "cc program.c -lutfdecode -lstdc++". */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+  UTFDECODE_UTF8,
+  UTFDECODE_UTF16BE,
+  UTFDECODE_UTF16LE,
+  UTFDECODE_UTF32BE,
+  UTFDECODE_UTF32LE
+} utfdecode_encoding;
+
+/* What to do with malformed input. */
+typedef enum {
+  UTFDECODE_ABORT,
+  UTFDECODE_REPLACE,
+  UTFDECODE_IGNORE
+} utfdecode_error_handling;
+
+typedef enum {
+  /* All of the input was transcoded. */
+  UTFDECODE_OK,
+  /* Stopped at malformed input with UTFDECODE_ABORT, or the encodings are
+     not valid. */
+  UTFDECODE_INVALID,
+  /* The input ends within a sequence, which is not read. */
+  UTFDECODE_INCOMPLETE,
+  /* The next code point does not fit in the output. */
+  UTFDECODE_OUTPUT_FULL
+} utfdecode_status;
+
+typedef struct {
+  utfdecode_status status;
+  /* Bytes of input read. */
+  size_t read;
+  /* The number of malformed sequences replaced or skipped. */
+  size_t errors;
+} utfdecode_error;
+
+/* Transcodes up to len bytes from src into the cap bytes at dst, returning
+   the number of bytes written. Where and why it stopped is stored in err,
+   unless it is NULL. */
+size_t utfdecode_transcode(utfdecode_encoding from, utfdecode_encoding to,
+                           utfdecode_error_handling on_error,
+                           const uint8_t *src, size_t len, uint8_t *dst,
+                           size_t cap, utfdecode_error *err);
+
+/* The same as utfdecode_transcode() with UTFDECODE_REPLACE. */
+size_t utfdecode_utf8_to_utf16le(const uint8_t *src, size_t len,
+                                 uint8_t *dst, size_t cap,
+                                 utfdecode_error *err);
+size_t utfdecode_utf8_to_utf16be(const uint8_t *src, size_t len,
+                                 uint8_t *dst, size_t cap,
+                                 utfdecode_error *err);
+size_t utfdecode_utf8_to_utf32le(const uint8_t *src, size_t len,
+                                 uint8_t *dst, size_t cap,
+                                 utfdecode_error *err);
+size_t utfdecode_utf8_to_utf32be(const uint8_t *src, size_t len,
+                                 uint8_t *dst, size_t cap,
+                                 utfdecode_error *err);
+size_t utfdecode_utf16le_to_utf8(const uint8_t *src, size_t len,
+                                 uint8_t *dst, size_t cap,
+                                 utfdecode_error *err);
+size_t utfdecode_utf16be_to_utf8(const uint8_t *src, size_t len,
+                                 uint8_t *dst, size_t cap,
+                                 utfdecode_error *err);
+size_t utfdecode_utf32le_to_utf8(const uint8_t *src, size_t len,
+                                 uint8_t *dst, size_t cap,
+                                 utfdecode_error *err);
+size_t utfdecode_utf32be_to_utf8(const uint8_t *src, size_t len,
+                                 uint8_t *dst, size_t cap,
+                                 utfdecode_error *err);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,547 @@
+#ifndef LIBUTFDECODE_HPP_INCLUDED
+#define LIBUTFDECODE_HPP_INCLUDED
+
+// The decoders, encoders, normalization and code point properties of
+// utfdecode as a library. Decoding, encoding and normalizing never allocate
+// memory or do any I/O, so they can be used on the hot path of other
+// programs. Only lookup_code_point_name() allocates, for the string it
+// returns.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+enum class normalization_form_t {
+  NONE, // Do not use a normalization form.
+  NFD,  // Canonical Decomposition.
+  NFC,  // Canonical Decomposition, followed by Canonical Composition.
+  NFKD, // Compatibility Decomposition
+  NFKC  // Compatibility Decomposition, followed by Canonical Composition
+};
+
+enum class general_category_value_t : uint8_t {
+  Uppercase_Letter,
+  Lowercase_Letter,
+  Titlecase_Letter,
+  Cased_Letter,
+  Modifier_Letter,
+  Other_Letter,
+  Letter,
+  Nonspacing_Mark,
+  Spacing_Mark,
+  Enclosing_Mark,
+  Mark,
+  Decimal_Number,
+  Letter_Number,
+  Other_Number,
+  Number,
+  Connector_Punctuation,
+  Dash_Punctuation,
+  Open_Punctuation,
+  Close_Punctuation,
+  Initial_Punctuation,
+  Final_Punctuation,
+  Other_Punctuation,
+  Punctuation,
+  Math_Symbol,
+  Currency_Symbol,
+  Modifier_Symbol,
+  Other_Symbol,
+  Symbol,
+  Space_Separator,
+  Line_Separator,
+  Paragraph_Separator,
+  Separator,
+  Control,
+  Format,
+  Surrogate,
+  Private_Use,
+  Unassigned,
+  Other
+};
+
+struct code_point {
+  uint32_t numeric_value;
+  // Offset of the name in the generated string pool - use
+  // lookup_code_point_name() to get the name.
+  uint32_t name_offset;
+  general_category_value_t category;
+  uint8_t canonical_combining_class;
+  bool bidi_mirrored;
+  // The QUICK_CHECK_* values of the NF*_Quick_Check properties which are not
+  // Yes.
+  uint8_t quick_check;
+  uint32_t simple_uppercase_mapping;
+  uint32_t simple_lowercase_mapping;
+  uint32_t simple_titlecase_mapping;
+};
+
+constexpr uint8_t QUICK_CHECK_NFD_NO = 1 << 0;
+constexpr uint8_t QUICK_CHECK_NFKD_NO = 1 << 1;
+constexpr uint8_t QUICK_CHECK_NFC_NO = 1 << 2;
+constexpr uint8_t QUICK_CHECK_NFC_MAYBE = 1 << 3;
+constexpr uint8_t QUICK_CHECK_NFKC_NO = 1 << 4;
+constexpr uint8_t QUICK_CHECK_NFKC_MAYBE = 1 << 5;
+
+void die_with_internal_error [[noreturn]] (char const *fmt, ...);
+
+code_point const *lookup_code_point(uint32_t);
+
+std::string lookup_code_point_name(uint32_t code_point);
+
+// Code points in decompositions and in the normalization buffer are stored
+// with their canonical combining class in the top 8 bits:
+constexpr int COMBINING_CLASS_SHIFT = 24;
+constexpr uint32_t CODE_POINT_MASK = (1 << COMBINING_CLASS_SHIFT) - 1;
+
+// Returns the full canonical, or if compatible is set compatibility,
+// decomposition of a code point. Returns nullptr and sets len to 0 if the
+// code point does not decompose. Hangul syllables are decomposed
+// algorithmically and not here.
+uint32_t const *unicode_decompose(uint32_t codePoint, bool compatible,
+                                  uint8_t *len);
+
+// Returns the primary composite for a pair of code points, or 0 if they do
+// not compose. Hangul syllables are composed algorithmically and not here.
+uint32_t unicode_compose(uint32_t first, uint32_t second);
+
+// Hangul syllables are decomposed and composed algorithmically, see
+// section 3.12 "Conjoining Jamo Behavior" of the Unicode standard.
+constexpr uint32_t HANGUL_S_BASE = 0xAC00;
+constexpr uint32_t HANGUL_L_BASE = 0x1100;
+constexpr uint32_t HANGUL_V_BASE = 0x1161;
+constexpr uint32_t HANGUL_T_BASE = 0x11A7;
+constexpr uint32_t HANGUL_L_COUNT = 19;
+constexpr uint32_t HANGUL_V_COUNT = 21;
+constexpr uint32_t HANGUL_T_COUNT = 28;
+constexpr uint32_t HANGUL_N_COUNT = HANGUL_V_COUNT * HANGUL_T_COUNT;
+constexpr uint32_t HANGUL_S_COUNT = HANGUL_L_COUNT * HANGUL_N_COUNT;
+
+// The encoders of each format, used by everything that encodes. They write
+// the code point to output, which must have room for 4 bytes, and return
+// the number of bytes written.
+
+inline int codepoint_to_utf8(uint32_t codepoint, uint8_t *output) {
+  if (codepoint < 0x80) {
+    output[0] = uint8_t(codepoint);
+    return 1;
+  } else if (codepoint < 0x800) {
+    // 110xxxxx 10xxxxxx
+    output[0] = uint8_t(0xC0 | (codepoint >> 6));
+    output[1] = uint8_t(0x80 | (codepoint & 0x3F));
+    return 2;
+  } else if (codepoint < 0x10000) {
+    // 1110xxxx 10xxxxxx 10xxxxxx
+    output[0] = uint8_t(0xE0 | (codepoint >> 12));
+    output[1] = uint8_t(0x80 | ((codepoint >> 6) & 0x3F));
+    output[2] = uint8_t(0x80 | (codepoint & 0x3F));
+    return 3;
+  } else if (codepoint >= 0x200000) {
+    die_with_internal_error("codepoint_to_utf8(): invalid code point %u",
+                            codepoint);
+  }
+  // 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+  output[0] = uint8_t(0xF0 | (codepoint >> 18));
+  output[1] = uint8_t(0x80 | ((codepoint >> 12) & 0x3F));
+  output[2] = uint8_t(0x80 | ((codepoint >> 6) & 0x3F));
+  output[3] = uint8_t(0x80 | (codepoint & 0x3F));
+  return 4;
+}
+
+inline void write_utf16_unit(uint16_t unit, uint8_t *output,
+                             bool little_endian) {
+  output[little_endian ? 0 : 1] = uint8_t(unit);
+  output[little_endian ? 1 : 0] = uint8_t(unit >> 8);
+}
+
+inline int encode_utf16(uint32_t codepoint, uint8_t *output,
+                        bool little_endian) {
+  if (codepoint < 0x10000) {
+    write_utf16_unit(uint16_t(codepoint), output, little_endian);
+    return 2;
+  }
+  // Code points above the Basic Multilingual Plane are encoded as a
+  // surrogate pair: 0x10000 is subtracted, which leaves 20 bits, and the top
+  // ten bits are added to 0xD800 to give the leading surrogate and the low
+  // ten bits to 0xDC00 to give the trailing surrogate.
+  codepoint -= 0x10000;
+  write_utf16_unit(uint16_t(0xD800 + (codepoint >> 10)), output,
+                   little_endian);
+  write_utf16_unit(uint16_t(0xDC00 + (codepoint & 0x3FF)), output + 2,
+                   little_endian);
+  return 4;
+}
+
+inline int encode_utf32(uint32_t codepoint, uint8_t *output,
+                        bool little_endian) {
+  for (int i = 0; i < 4; i++) {
+    output[little_endian ? i : 3 - i] = uint8_t(codepoint >> (8 * i));
+  }
+  return 4;
+}
+
+// Transcodes the longest prefix of data which is valid UTF-16 and ends with
+// a complete code point into UTF-8, using the widest vector instructions
+// supported by the CPU. output must have room for 3 bytes per code unit.
+// Returns the length of the prefix, and sets written to the number of bytes
+// written and codepoints to the number of code points in it.
+size_t transcode_utf16_to_utf8(uint8_t const *data, size_t length,
+                               bool little_endian, uint8_t *output,
+                               size_t &written, uint64_t &codepoints);
+
+// The same for UTF-32, where output must have room for 4 bytes per code
+// unit.
+size_t transcode_utf32_to_utf8(uint8_t const *data, size_t length,
+                               bool little_endian, uint8_t *output,
+                               size_t &written, uint64_t &codepoints);
+
+// Returns the length of the longest prefix of data made of UTF-32 code units
+// which are neither above U+10FFFF nor surrogates, using the widest vector
+// instructions supported by the CPU. The prefix ends exactly at the first
+// invalid code unit, or before a code unit cut off by the end of data.
+size_t utf32_valid_prefix_length(uint8_t const *data, size_t length,
+                                 bool little_endian);
+
+// Transcode the longest prefix of data which is valid UTF-8 and ends with a
+// complete code point into UTF-16 or UTF-32 in the same way. output must
+// have room for 2 bytes per byte of input for UTF-16 and 4 for UTF-32.
+size_t transcode_utf8_to_utf16(uint8_t const *data, size_t length,
+                               bool little_endian, uint8_t *output,
+                               size_t &written, uint64_t &codepoints);
+size_t transcode_utf8_to_utf32(uint8_t const *data, size_t length,
+                               bool little_endian, uint8_t *output,
+                               size_t &written, uint64_t &codepoints);
+
+// The states of the UTF-8 decoder between bytes. The decoder is in
+// UTF8_ACCEPT between complete sequences and ends up in UTF8_REJECT on
+// invalid input, see utf8_decode_byte().
+constexpr uint8_t UTF8_ACCEPT = 0;
+constexpr uint8_t UTF8_REJECT = 12;
+
+extern const uint8_t utf8_byte_classes[256];
+extern const uint8_t utf8_transitions[108];
+
+// Feeds a byte to the UTF-8 decoder, returning its new state. The code point
+// is complete when UTF8_ACCEPT is returned. On UTF8_REJECT, a byte that was
+// not the first of a sequence is not part of the rejected one and should be
+// fed again from UTF8_ACCEPT.
+inline uint8_t utf8_decode_byte(uint8_t state, uint32_t &codepoint,
+                                uint8_t byte) {
+  uint8_t byte_class = utf8_byte_classes[byte];
+  codepoint = (state == UTF8_ACCEPT) ? ((0xff >> byte_class) & byte)
+                                     : ((codepoint << 6) | (byte & 0x3f));
+  return utf8_transitions[state + byte_class];
+}
+
+// Describes why a byte was rejected by the UTF-8 decoder in a state.
+char const *utf8_error_message(uint8_t state, uint8_t byte);
+
+// Returns the length of a prefix of data which is complete and valid UTF-8,
+// using the widest vector instructions supported by the CPU. The prefix may
+// stop short of the first error, so the rest of the data should be decoded
+// byte by byte.
+size_t utf8_valid_prefix_length(uint8_t const *data, size_t length);
+
+uint64_t utf8_count_codepoints(uint8_t const *data, size_t length);
+
+size_t ascii_prefix_length(uint8_t const *data, size_t length);
+
+inline bool utf16_is_leading_surrogate(uint32_t code_unit) {
+  return code_unit >= 0xD800 && code_unit <= 0xDBFF;
+}
+
+inline bool utf16_is_trailing_surrogate(uint32_t code_unit) {
+  return code_unit >= 0xDC00 && code_unit <= 0xDFFF;
+}
+
+inline uint32_t utf16_decode_surrogate_pair(uint32_t leading,
+                                            uint32_t trailing) {
+  return 0x10000 + ((leading - 0xD800) << 10) + (trailing - 0xDC00);
+}
+
+enum class utf_encoding_t { UTF8, UTF16BE, UTF16LE, UTF32BE, UTF32LE };
+
+// Malformed input found by utf_byte_decoder_t.
+enum class utf_error_t {
+  // A byte rejected by the UTF-8 decoder.
+  UTF8_REJECTED,
+  LEADING_SURROGATE_WITHOUT_TRAILING,
+  TRAILING_SURROGATE_WITHOUT_LEADING,
+  UTF32_OUT_OF_RANGE,
+  UTF32_SURROGATE
+};
+
+// Decodes UTF-8, UTF-16 or UTF-32 a byte at a time, so that input may be
+// split anywhere, handing what it decodes to a handler with these member
+// functions:
+//
+//   void on_codepoint(uint32_t codepoint);
+//   // A UTF-16 leading surrogate, held back until the next code unit.
+//   void on_leading_surrogate(uint16_t code_unit);
+//   // The rejected byte of UTF-8 or code unit of UTF-16 or UTF-32, with a
+//   // description of what is wrong with it. The rejected input starts
+//   // bytes_before bytes before the byte being decoded, which is 0 for
+//   // UTF-8 and the start of the code unit for UTF-16 and UTF-32.
+//   void on_error(utf_error_t error, uint32_t code_unit, size_t bytes_before,
+//                 char const *message);
+struct utf_byte_decoder_t {
+  utf_encoding_t encoding{utf_encoding_t::UTF8};
+  uint8_t utf8_state{UTF8_ACCEPT};
+  uint32_t utf8_codepoint{0};
+  // The bytes of an incomplete UTF-16 or UTF-32 code unit.
+  uint8_t unit[4];
+  uint8_t unit_size{0};
+  // A UTF-16 leading surrogate waiting for its trailing surrogate, or 0.
+  uint16_t leading_surrogate{0};
+
+  // Returns true between code points, when nothing is held back.
+  bool is_idle() const {
+    return utf8_state == UTF8_ACCEPT && unit_size == 0 &&
+           leading_surrogate == 0;
+  }
+
+  void reset() {
+    utf8_state = UTF8_ACCEPT;
+    unit_size = 0;
+    leading_surrogate = 0;
+  }
+
+  template <typename handler_t> void decode(uint8_t byte, handler_t &handler) {
+    switch (encoding) {
+    case utf_encoding_t::UTF8: {
+      uint8_t previous_state = utf8_state;
+      utf8_state = utf8_decode_byte(utf8_state, utf8_codepoint, byte);
+      if (utf8_state == UTF8_ACCEPT) {
+        handler.on_codepoint(utf8_codepoint);
+      } else if (utf8_state == UTF8_REJECT) {
+        utf8_state = UTF8_ACCEPT;
+        handler.on_error(utf_error_t::UTF8_REJECTED, byte, 0,
+                         utf8_error_message(previous_state, byte));
+        if (previous_state != UTF8_ACCEPT) {
+          // The byte is not part of the rejected sequence:
+          decode(byte, handler);
+        }
+      }
+      break;
+    }
+    case utf_encoding_t::UTF16BE:
+    case utf_encoding_t::UTF16LE:
+      unit[unit_size++] = byte;
+      if (unit_size == 2) {
+        unit_size = 0;
+        decode_utf16_unit(encoding == utf_encoding_t::UTF16LE
+                              ? uint16_t(unit[1] << 8 | unit[0])
+                              : uint16_t(unit[0] << 8 | unit[1]),
+                          handler);
+      }
+      break;
+    case utf_encoding_t::UTF32BE:
+    case utf_encoding_t::UTF32LE:
+      unit[unit_size++] = byte;
+      if (unit_size == 4) {
+        unit_size = 0;
+        uint32_t code_unit =
+            encoding == utf_encoding_t::UTF32LE
+                ? (uint32_t(unit[3]) << 24 | unit[2] << 16 | unit[1] << 8 |
+                   unit[0])
+                : (uint32_t(unit[0]) << 24 | unit[1] << 16 | unit[2] << 8 |
+                   unit[3]);
+        if (code_unit > 0x10FFFF) {
+          handler.on_error(utf_error_t::UTF32_OUT_OF_RANGE, code_unit, 3,
+                           "code point out of range");
+        } else if (code_unit >= 0xD800 && code_unit <= 0xDFFF) {
+          handler.on_error(utf_error_t::UTF32_SURROGATE, code_unit, 3,
+                           "surrogate in UTF-32");
+        } else {
+          handler.on_codepoint(code_unit);
+        }
+      }
+      break;
+    }
+  }
+
+  template <typename handler_t>
+  void decode_utf16_unit(uint16_t code_unit, handler_t &handler) {
+    if (leading_surrogate != 0) {
+      uint16_t leading = leading_surrogate;
+      leading_surrogate = 0;
+      if (utf16_is_trailing_surrogate(code_unit)) {
+        handler.on_codepoint(utf16_decode_surrogate_pair(leading, code_unit));
+        return;
+      }
+      // The leading surrogate is the code unit before this one:
+      handler.on_error(utf_error_t::LEADING_SURROGATE_WITHOUT_TRAILING,
+                       leading, 3,
+                       "leading surrogate without trailing surrogate");
+    }
+
+    if (utf16_is_leading_surrogate(code_unit)) {
+      leading_surrogate = code_unit;
+      handler.on_leading_surrogate(code_unit);
+    } else if (utf16_is_trailing_surrogate(code_unit)) {
+      handler.on_error(utf_error_t::TRAILING_SURROGATE_WITHOUT_LEADING,
+                       code_unit, 1,
+                       "trailing surrogate without leading surrogate");
+    } else {
+      handler.on_codepoint(code_unit);
+    }
+  }
+};
+
+char const *general_category_description(general_category_value_t category);
+
+bool general_category_is_combining(general_category_value_t category);
+
+char const *get_block_name(uint32_t codepoint);
+
+// Normalizes a stream of code points to one of the Unicode normalization
+// forms and, if stream_safe is set, to the Stream-Safe Text Format of
+// UAX #15. Code points are handed back as soon as nothing that follows can
+// change them.
+struct normalizer_t {
+  // A segment is limited to the 30 non-starters that the Stream-Safe Text
+  // Format allows, so it fits in a fixed buffer which also has room for the
+  // starter and the starter ending it.
+  static constexpr size_t MAX_NON_STARTERS = 30;
+  // The most code points that push() or flush() can return at once: a full
+  // segment followed by the longest decomposition.
+  static constexpr size_t MAX_OUTPUT = 2 * (MAX_NON_STARTERS + 2);
+
+  normalization_form_t form{normalization_form_t::NONE};
+  bool stream_safe{false};
+
+  // The code points of the current normalization segment - the last
+  // starter followed by the non-starters after it, with their combining
+  // classes. The segment is reordered, composed and returned when the next
+  // starter arrives.
+  uint32_t buffer[MAX_NON_STARTERS + 2];
+  size_t buffer_size{0};
+  // Set while buffer only holds a starter which is known to be normalized
+  // and has not been decomposed.
+  bool buffer_quick{false};
+  // The number of non-starters at the end of the input so far, as counted by
+  // the Stream-Safe Text Process of UAX #15.
+  size_t stream_safe_non_starters{0};
+
+  // Where push() and flush() are writing code points to.
+  uint32_t *output{nullptr};
+
+  bool is_active() const {
+    return form != normalization_form_t::NONE || stream_safe;
+  }
+
+  bool is_composing() const {
+    return form == normalization_form_t::NFC ||
+           form == normalization_form_t::NFKC;
+  }
+
+  // Normalizes the next code point, writing the code points which are
+  // now complete to normalized, which must have room for MAX_OUTPUT of them.
+  // Returns the number of code points written.
+  size_t push(uint32_t codepoint, uint32_t *normalized);
+
+  // Writes what is left of the last segment at the end of input.
+  size_t flush(uint32_t *normalized);
+
+  void make_stream_safe(uint32_t codepoint);
+
+  void normalize_codepoint(uint32_t codepoint);
+
+  void decompose_codepoint(uint32_t codepoint, uint8_t combining_class);
+
+  void append_to_buffer(uint32_t packed_codepoint);
+
+  void compose_buffer();
+
+  void flush_buffer();
+};
+
+// What to do with malformed input.
+enum class error_handling_t { ABORT, REPLACE, IGNORE };
+
+// Receives what a stream_decoder_t decodes. The data passed is only valid
+// for the duration of the call.
+struct stream_handler_t {
+  virtual ~stream_handler_t() = default;
+
+  // Decoded, and normalized if asked for, code points, when no output
+  // encoding is set.
+  virtual void on_codepoints(uint32_t const *codepoints, size_t count) {
+    (void)codepoints;
+    (void)count;
+  }
+
+  // The decoded code points in the output encoding, when one is set.
+  virtual void on_output(uint8_t const *data, size_t length) {
+    (void)data;
+    (void)length;
+  }
+
+  // Malformed input at byte_offset into the stream, which is replaced by
+  // U+FFFD if replace_errors is set and dropped otherwise.
+  virtual void on_error(uint64_t byte_offset, char const *message) {
+    (void)byte_offset;
+    (void)message;
+  }
+};
+
+// Decodes a stream of UTF-8, UTF-16 or UTF-32 which is pushed to it in
+// pieces of any size, handing the result to a handler in batches. All state
+// is kept in fixed size buffers, so decoding never allocates memory.
+struct stream_decoder_t {
+  static constexpr size_t BATCH_SIZE = 1024;
+
+  utf_encoding_t input_encoding{utf_encoding_t::UTF8};
+  // Set to get output in output_encoding through on_output() instead of
+  // code points through on_codepoints().
+  bool encode_output{false};
+  utf_encoding_t output_encoding{utf_encoding_t::UTF8};
+  bool replace_errors{true};
+  normalizer_t normalizer;
+  // Must be set before feeding any input.
+  stream_handler_t *handler{nullptr};
+
+  uint64_t bytes_into_input{0};
+  uint64_t codepoints_into_input{0};
+  uint64_t error_count{0};
+
+  utf_byte_decoder_t byte_decoder;
+
+  uint32_t codepoints[BATCH_SIZE];
+  size_t codepoint_count{0};
+  uint8_t encoded[4 * BATCH_SIZE];
+  size_t encoded_size{0};
+
+  // Decodes the next piece of input.
+  void feed(uint8_t const *data, size_t length);
+
+  // Ends the input, reporting an incomplete sequence at its end and handing
+  // over everything still held back.
+  void finish();
+
+  // Clears all state to start on a new stream with the same settings.
+  void reset();
+
+  size_t transcode_to_utf8_in_bulk(uint8_t const *data, size_t length);
+
+  size_t transcode_from_utf8_in_bulk(uint8_t const *data, size_t length);
+
+  // Called by byte_decoder:
+  void on_codepoint(uint32_t codepoint);
+
+  void on_leading_surrogate(uint16_t code_unit) { (void)code_unit; }
+
+  void on_error(utf_error_t error, uint32_t code_unit, size_t bytes_before,
+                char const *message);
+
+  void push_codepoint(uint32_t codepoint);
+
+  void emit_codepoint(uint32_t codepoint);
+
+  void error(uint64_t byte_offset, char const *message);
+
+  void flush_batch();
+};
+
+#endif
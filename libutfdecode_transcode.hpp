@@ -0,0 +1,179 @@
+#ifndef LIBUTFDECODE_TRANSCODE_HPP_INCLUDED
+#define LIBUTFDECODE_TRANSCODE_HPP_INCLUDED
+
+// Transcoders between the UTF encodings, specialized at compile time on the
+// source and target encoding and on the handling of malformed input. The
+// loop of utf_transcode() has no branches on any of these, so it can be
+// inlined into the code calling it.
+
+#include <string.h>
+
+#include "libutfdecode.hpp"
+
+enum class transcode_status_t {
+  OK,         // All of the input was transcoded.
+  INVALID,    // Stopped at malformed input with error_handling_t::ABORT.
+  INCOMPLETE, // The input ends within a sequence, which is not read.
+  OUTPUT_FULL // The next code point does not fit in the output.
+};
+
+struct transcode_result_t {
+  transcode_status_t status;
+  // Bytes of input read and of output written.
+  size_t read;
+  size_t written;
+  // The number of malformed sequences replaced or skipped.
+  size_t errors;
+};
+
+// Decodes and encodes single code points of an encoding. decode() returns
+// the length of the sequence at the start of data, 0 if data ends within it,
+// or minus the number of bytes to skip if it is malformed. encode() writes
+// up to MAX_LENGTH bytes and returns the number written.
+template <utf_encoding_t encoding> struct utf_codec_t;
+
+template <> struct utf_codec_t<utf_encoding_t::UTF8> {
+  static constexpr size_t MAX_LENGTH = 4;
+
+  static int decode(uint8_t const *data, size_t length, uint32_t &codepoint) {
+    if (data[0] < 0x80) {
+      codepoint = data[0];
+      return 1;
+    }
+    uint8_t state = UTF8_ACCEPT;
+    for (size_t i = 0; i < length; i++) {
+      state = utf8_decode_byte(state, codepoint, data[i]);
+      if (state == UTF8_ACCEPT) {
+        return int(i) + 1;
+      } else if (state == UTF8_REJECT) {
+        // A byte after the first one which ends the sequence may start the
+        // next one:
+        return i == 0 ? -1 : -int(i);
+      }
+    }
+    return 0;
+  }
+
+  static size_t encode(uint32_t codepoint, uint8_t *output) {
+    return codepoint_to_utf8(codepoint, output);
+  }
+};
+
+template <bool little_endian> struct utf16_codec_t {
+  static constexpr size_t MAX_LENGTH = 4;
+
+  static uint16_t read_unit(uint8_t const *data) {
+    return little_endian ? uint16_t(data[1] << 8 | data[0])
+                         : uint16_t(data[0] << 8 | data[1]);
+  }
+
+  static int decode(uint8_t const *data, size_t length, uint32_t &codepoint) {
+    if (length < 2) {
+      return 0;
+    }
+    uint16_t first = read_unit(data);
+    if (utf16_is_trailing_surrogate(first)) {
+      return -2;
+    } else if (!utf16_is_leading_surrogate(first)) {
+      codepoint = first;
+      return 2;
+    } else if (length < 4) {
+      return 0;
+    }
+    uint16_t second = read_unit(data + 2);
+    if (!utf16_is_trailing_surrogate(second)) {
+      return -2;
+    }
+    codepoint = utf16_decode_surrogate_pair(first, second);
+    return 4;
+  }
+
+  static size_t encode(uint32_t codepoint, uint8_t *output) {
+    return encode_utf16(codepoint, output, little_endian);
+  }
+};
+
+template <bool little_endian> struct utf32_codec_t {
+  static constexpr size_t MAX_LENGTH = 4;
+
+  static int decode(uint8_t const *data, size_t length, uint32_t &codepoint) {
+    if (length < 4) {
+      return 0;
+    }
+    codepoint = little_endian
+                    ? (uint32_t(data[3]) << 24 | data[2] << 16 |
+                       data[1] << 8 | data[0])
+                    : (uint32_t(data[0]) << 24 | data[1] << 16 |
+                       data[2] << 8 | data[3]);
+    if (codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+      return -4;
+    }
+    return 4;
+  }
+
+  static size_t encode(uint32_t codepoint, uint8_t *output) {
+    return encode_utf32(codepoint, output, little_endian);
+  }
+};
+
+template <>
+struct utf_codec_t<utf_encoding_t::UTF16BE> : utf16_codec_t<false> {};
+template <>
+struct utf_codec_t<utf_encoding_t::UTF16LE> : utf16_codec_t<true> {};
+template <>
+struct utf_codec_t<utf_encoding_t::UTF32BE> : utf32_codec_t<false> {};
+template <>
+struct utf_codec_t<utf_encoding_t::UTF32LE> : utf32_codec_t<true> {};
+
+// Transcodes input to output until either runs out or, with
+// error_handling_t::ABORT, malformed input is found. Malformed input is
+// otherwise replaced by U+FFFD or skipped. A sequence which is cut off at
+// the end of input is left unread, to be passed again with what follows.
+template <utf_encoding_t from, utf_encoding_t to, error_handling_t on_error>
+transcode_result_t utf_transcode(uint8_t const *input, size_t input_length,
+                                 uint8_t *output, size_t output_capacity) {
+  using decoder = utf_codec_t<from>;
+  using encoder = utf_codec_t<to>;
+  transcode_result_t result{transcode_status_t::OK, 0, 0, 0};
+  while (result.read < input_length) {
+    uint32_t codepoint;
+    int length = decoder::decode(input + result.read,
+                                 input_length - result.read, codepoint);
+    bool malformed = length < 0;
+    if (length == 0) {
+      result.status = transcode_status_t::INCOMPLETE;
+      break;
+    } else if (malformed) {
+      if (on_error == error_handling_t::ABORT) {
+        result.status = transcode_status_t::INVALID;
+        break;
+      } else if (on_error == error_handling_t::IGNORE) {
+        result.read += -length;
+        result.errors++;
+        continue;
+      }
+      length = -length;
+      codepoint = 0xFFFD;
+    }
+
+    uint8_t *position = output + result.written;
+    size_t room = output_capacity - result.written;
+    if (room >= encoder::MAX_LENGTH) {
+      result.written += encoder::encode(codepoint, position);
+    } else {
+      uint8_t encoded[encoder::MAX_LENGTH];
+      size_t encoded_length = encoder::encode(codepoint, encoded);
+      if (encoded_length > room) {
+        result.status = transcode_status_t::OUTPUT_FULL;
+        break;
+      }
+      memcpy(position, encoded, encoded_length);
+      result.written += encoded_length;
+    }
+    result.read += length;
+    result.errors += malformed;
+  }
+  return result;
+}
+
+#endif
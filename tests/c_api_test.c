@@ -0,0 +1,127 @@
+/* Tests of the C interface in libutfdecode.h, compiled as C and run by
+   "make check". */
+
+#include "libutfdecode.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int failures = 0;
+
+static void check(int condition, char const *what, int line) {
+  if (!condition) {
+    fprintf(stderr, "%s:%d: %s\n", __FILE__, line, what);
+    failures++;
+  }
+}
+
+#define CHECK(condition) check(condition, #condition, __LINE__)
+
+/* "a", U+00E9, U+20AC and U+1F4A9 in each encoding. */
+static const uint8_t utf8[] = {0x61, 0xC3, 0xA9, 0xE2, 0x82,
+                               0xAC, 0xF0, 0x9F, 0x92, 0xA9};
+static const uint8_t utf16be[] = {0x00, 0x61, 0x00, 0xE9, 0x20,
+                                  0xAC, 0xD8, 0x3D, 0xDC, 0xA9};
+static const uint8_t utf16le[] = {0x61, 0x00, 0xE9, 0x00, 0xAC,
+                                  0x20, 0x3D, 0xD8, 0xA9, 0xDC};
+static const uint8_t utf32be[] = {0x00, 0x00, 0x00, 0x61, 0x00, 0x00,
+                                  0x00, 0xE9, 0x00, 0x00, 0x20, 0xAC,
+                                  0x00, 0x01, 0xF4, 0xA9};
+static const uint8_t utf32le[] = {0x61, 0x00, 0x00, 0x00, 0xE9, 0x00,
+                                  0x00, 0x00, 0xAC, 0x20, 0x00, 0x00,
+                                  0xA9, 0xF4, 0x01, 0x00};
+
+static void test_all_pairs(void) {
+  const uint8_t *inputs[] = {utf8, utf16be, utf16le, utf32be, utf32le};
+  size_t lengths[] = {sizeof(utf8), sizeof(utf16be), sizeof(utf16le),
+                      sizeof(utf32be), sizeof(utf32le)};
+  int from, to;
+  for (from = UTFDECODE_UTF8; from <= UTFDECODE_UTF32LE; from++) {
+    for (to = UTFDECODE_UTF8; to <= UTFDECODE_UTF32LE; to++) {
+      uint8_t output[64];
+      utfdecode_error err;
+      size_t written = utfdecode_transcode(
+          (utfdecode_encoding)from, (utfdecode_encoding)to, UTFDECODE_ABORT,
+          inputs[from], lengths[from], output, sizeof(output), &err);
+      CHECK(err.status == UTFDECODE_OK);
+      CHECK(err.read == lengths[from]);
+      CHECK(err.errors == 0);
+      CHECK(written == lengths[to]);
+      CHECK(memcmp(output, inputs[to], lengths[to]) == 0);
+    }
+  }
+}
+
+static void test_named_functions(void) {
+  uint8_t output[64];
+  CHECK(utfdecode_utf8_to_utf16le(utf8, sizeof(utf8), output, sizeof(output),
+                                  NULL) == sizeof(utf16le));
+  CHECK(memcmp(output, utf16le, sizeof(utf16le)) == 0);
+  CHECK(utfdecode_utf32be_to_utf8(utf32be, sizeof(utf32be), output,
+                                  sizeof(output), NULL) == sizeof(utf8));
+  CHECK(memcmp(output, utf8, sizeof(utf8)) == 0);
+}
+
+static void test_malformed_input(void) {
+  static const uint8_t input[] = {'a', 0xFF, 'b'};
+  uint8_t output[16];
+  utfdecode_error err;
+  size_t written;
+
+  written = utfdecode_transcode(UTFDECODE_UTF8, UTFDECODE_UTF16BE,
+                                UTFDECODE_REPLACE, input, sizeof(input),
+                                output, sizeof(output), &err);
+  CHECK(err.status == UTFDECODE_OK);
+  CHECK(err.errors == 1);
+  CHECK(written == 6);
+  CHECK(memcmp(output, "\x00\x61\xFF\xFD\x00\x62", 6) == 0);
+
+  written = utfdecode_transcode(UTFDECODE_UTF8, UTFDECODE_UTF16BE,
+                                UTFDECODE_IGNORE, input, sizeof(input),
+                                output, sizeof(output), &err);
+  CHECK(err.status == UTFDECODE_OK);
+  CHECK(err.errors == 1);
+  CHECK(written == 4);
+
+  written = utfdecode_transcode(UTFDECODE_UTF8, UTFDECODE_UTF16BE,
+                                UTFDECODE_ABORT, input, sizeof(input),
+                                output, sizeof(output), &err);
+  CHECK(err.status == UTFDECODE_INVALID);
+  CHECK(err.read == 1);
+  CHECK(written == 2);
+}
+
+static void test_incomplete_and_full(void) {
+  uint8_t output[64];
+  utfdecode_error err;
+  size_t written;
+
+  /* The last code point is cut off: */
+  written = utfdecode_transcode(UTFDECODE_UTF8, UTFDECODE_UTF32LE,
+                                UTFDECODE_REPLACE, utf8, sizeof(utf8) - 1,
+                                output, sizeof(output), &err);
+  CHECK(err.status == UTFDECODE_INCOMPLETE);
+  CHECK(err.read == 6);
+  CHECK(written == 12);
+
+  /* Room for three code points and half of the fourth: */
+  written = utfdecode_transcode(UTFDECODE_UTF8, UTFDECODE_UTF16LE,
+                                UTFDECODE_REPLACE, utf8, sizeof(utf8),
+                                output, 8, &err);
+  CHECK(err.status == UTFDECODE_OUTPUT_FULL);
+  CHECK(err.read == 6);
+  CHECK(written == 6);
+}
+
+int main(void) {
+  test_all_pairs();
+  test_named_functions();
+  test_malformed_input();
+  test_incomplete_and_full();
+  if (failures > 0) {
+    fprintf(stderr, "%d failures\n", failures);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
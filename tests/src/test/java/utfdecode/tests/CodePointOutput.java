@@ -3,6 +3,8 @@ package utfdecode.tests;
 import org.junit.jupiter.api.Assertions;
 import org.junit.jupiter.api.Test;
 
+import java.nio.charset.StandardCharsets;
+
 class CodePointOutput {
 
     @Test void codePointOutput() {
@@ -34,4 +36,12 @@ class CodePointOutput {
         Assertions.assertEquals("\uE001 = U+E001 PRIVATE USE E001\n", nameFromUtfDecode);
     }
 
+    @Test void unassigned() {
+        // U+0378 is not assigned, which is not a decoding error:
+        var result = Utfdecode.run("\u0378".getBytes(StandardCharsets.UTF_8));
+        Assertions.assertEquals("\u0378 = U+0378 <unassigned>\n", result.getUtf8Output());
+        Assertions.assertEquals("", result.errors);
+        Assertions.assertEquals(0, result.exitCode);
+    }
+
 }
@@ -0,0 +1,122 @@
+package utfdecode.tests;
+
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+
+class FilesTest {
+
+    private static final byte[] NO_INPUT = new byte[0];
+
+    private static Path write(Path file, String content) throws IOException {
+        Files.createDirectories(file.getParent());
+        return Files.write(file, content.getBytes(StandardCharsets.UTF_8));
+    }
+
+    @Test void directoryInNameOrder() throws IOException {
+        var directory = Files.createTempDirectory("utfdecode");
+        write(directory.resolve("b"), "2");
+        write(directory.resolve("a"), "1");
+        write(directory.resolve("c/a"), "3");
+        for (var jobs : List.of("1", "4")) {
+            var result = Utfdecode.run(NO_INPUT, "-e", "utf8", "-j", jobs, directory.toString());
+            Assertions.assertEquals("123", result.getUtf8Output());
+            Assertions.assertEquals(0, result.exitCode);
+        }
+    }
+
+    @Test void operandsInGivenOrder() throws IOException {
+        var directory = Files.createTempDirectory("utfdecode");
+        var a = write(directory.resolve("a"), "1");
+        var b = write(directory.resolve("b"), "2");
+        var input = "3".getBytes(StandardCharsets.UTF_8);
+        for (var jobs : List.of("1", "4")) {
+            var result = Utfdecode.run(input, "-e", "utf8", "-j", jobs, b.toString(), "-", a.toString());
+            Assertions.assertEquals("231", result.getUtf8Output());
+            Assertions.assertEquals(0, result.exitCode);
+        }
+    }
+
+    @Test void summaryPerFileAndInTotal() throws IOException {
+        var directory = Files.createTempDirectory("utfdecode");
+        var a = write(directory.resolve("a"), "ab");
+        var b = directory.resolve("b");
+        Files.write(b, new byte[]{'c', (byte) 0xFF});
+        for (var jobs : List.of("1", "4")) {
+            var result = Utfdecode.run(NO_INPUT, "-e", "silent", "-q", "-s", "-j", jobs, a.toString(), b.toString());
+            Assertions.assertEquals(a + ": 2 code points from 2 bytes with 0 errors\n"
+                    + b + ": 2 code points from 2 bytes with 1 errors\n"
+                    + "4 code points from 4 bytes with 1 errors in 2 files\n", result.errors);
+            Assertions.assertEquals(65, result.exitCode);
+        }
+    }
+
+    @Test void errorsNameTheFile() throws IOException {
+        var directory = Files.createTempDirectory("utfdecode");
+        var a = directory.resolve("a");
+        Files.write(a, new byte[]{(byte) 0xFF});
+        var expected = "malformed 0 bytes and 0 characters in " + a + " - invalid byte\n";
+        var result = Utfdecode.run(NO_INPUT, "-e", "silent", a.toString());
+        Assertions.assertEquals(expected, result.errors);
+        result = Utfdecode.run(NO_INPUT, "-e", "silent", a.toString(), a.toString());
+        Assertions.assertEquals(expected + expected, result.errors);
+    }
+
+    @Test void missingFile() throws IOException {
+        var directory = Files.createTempDirectory("utfdecode");
+        var a = write(directory.resolve("a"), "1");
+        var missing = directory.resolve("missing");
+        var result = Utfdecode.run(NO_INPUT, "-e", "utf8", a.toString(), missing.toString());
+        Assertions.assertEquals("1", result.getUtf8Output());
+        Assertions.assertEquals(missing + " - No such file or directory\n", result.errors);
+        Assertions.assertEquals(66, result.exitCode);
+
+        result = Utfdecode.run(NO_INPUT, "-e", "utf8", missing.toString());
+        Assertions.assertEquals(66, result.exitCode);
+    }
+
+    @Test void largeFileBehindSmallOnes() throws IOException {
+        var directory = Files.createTempDirectory("utfdecode");
+        var a = write(directory.resolve("a"), "1");
+        // Large enough for its output to be written while it is decoded on another thread:
+        var large = directory.resolve("b");
+        var piece = "aö€💩\n".getBytes(StandardCharsets.UTF_8);
+        try (var out = Files.newOutputStream(large)) {
+            for (int i = 0; i < 1024 * 1024; i++) {
+                out.write(piece);
+                if (i % 1000 == 999) {
+                    out.write(0xFF);
+                }
+            }
+        }
+        var c = write(directory.resolve("c"), "3");
+        for (var malformed : List.of("replace", "abort")) {
+            var expected = Utfdecode.run(NO_INPUT, "-e", "utf16le", "-m", malformed, "-j", "1",
+                    a.toString(), large.toString(), c.toString());
+            var actual = Utfdecode.run(NO_INPUT, "-e", "utf16le", "-m", malformed, "-j", "4",
+                    a.toString(), large.toString(), c.toString());
+            Assertions.assertArrayEquals(expected.output, actual.output);
+            Assertions.assertEquals(expected.errors, actual.errors);
+            Assertions.assertEquals(65, actual.exitCode);
+        }
+    }
+
+    @Test void invalidJobs() throws IOException {
+        var directory = Files.createTempDirectory("utfdecode");
+        var a = write(directory.resolve("a"), "1");
+        for (var jobs : List.of("-1", "0", "x", "2x")) {
+            var result = Utfdecode.run(NO_INPUT, "-e", "utf8", "-j", jobs, a.toString(), a.toString());
+            Assertions.assertTrue(result.errors.startsWith("'" + jobs + "' is not a valid number of jobs\n"));
+            Assertions.assertEquals(64, result.exitCode);
+        }
+        // Too many threads are lowered to a number that works:
+        var result = Utfdecode.run(NO_INPUT, "-e", "utf8", "-j", "1000000", a.toString(), a.toString());
+        Assertions.assertEquals("11", result.getUtf8Output());
+        Assertions.assertEquals(0, result.exitCode);
+    }
+}
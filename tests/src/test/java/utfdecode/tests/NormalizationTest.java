@@ -3,6 +3,7 @@ package utfdecode.tests;
 import org.junit.jupiter.api.Assertions;
 import org.junit.jupiter.api.Test;
 
+import java.nio.charset.StandardCharsets;
 import java.text.Normalizer;
 import java.util.List;
 import java.util.Map;
@@ -42,6 +43,17 @@ class NormalizationTest {
         }
     }
 
+    @Test void orderingOfCombinersWithSameClass() {
+        // U+0301 and U+0300 both have combining class 230, U+0323 has 220:
+        for (var input : List.of("e\u0301\u0323\u0300", "e\u0300\u0323\u0301")) {
+            for (var form : Normalizer.Form.values()) {
+                var normalizedByJava = Normalizer.normalize(input, form);
+                var normalizedByUtfDecode = Utfdecode.getUtf8Output(input, form);
+                Assertions.assertEquals(normalizedByJava, normalizedByUtfDecode);
+            }
+        }
+    }
+
     @Test void singletonEquivalence() {
         for (var input : List.of("\u2126", "\u03A9")) {
             for (var form : Normalizer.Form.values()) {
@@ -103,6 +115,38 @@ class NormalizationTest {
         }
     }
 
+    @Test void compose() {
+        for (var input : List.of(
+                "a\u030a", // å
+                "e\u0302\u0301", // ế
+                "q\u0307\u0323a\u0308", // no composite for q
+                "d\u0307\u0323", // reordering makes d compose with the dot below
+                "\u0915\u093c", // excluded from composition
+                "\u0308\u0301", // non-starter decomposition
+                "\u1100\u1161\u11a8", // Hangul LVT
+                "\uac00\u11a8", // Hangul LV + T
+                "\uac00\u0300\u11a8" // T is blocked
+        )) {
+            for (var form : List.of(Normalizer.Form.NFC, Normalizer.Form.NFKC)) {
+                var normalizedByJava = Normalizer.normalize(input, form);
+                var normalizedByUtfDecode = Utfdecode.getUtf8Output(input, form);
+                Assertions.assertEquals(normalizedByJava, normalizedByUtfDecode);
+            }
+        }
+    }
+
+    @Test void streamSafe() {
+        // A U+034F COMBINING GRAPHEME JOINER is inserted after 30 non-starters in a row, before composing:
+        var input = ("a" + "\u0300".repeat(32)).getBytes(StandardCharsets.UTF_8);
+        var expected = "a" + "\u0300".repeat(30) + "\u034F" + "\u0300".repeat(2);
+        Assertions.assertEquals(expected, Utfdecode.getUtf8Output(input, "-S"));
+        Assertions.assertEquals(expected, Utfdecode.getUtf8Output(input, "-S", "-n", "nfd"));
+        Assertions.assertEquals("\u00E0" + "\u0300".repeat(29) + "\u034F" + "\u0300".repeat(2),
+                Utfdecode.getUtf8Output(input, "-S", "-n", "nfc"));
+        // Without -S the run is left as it is:
+        Assertions.assertEquals("a" + "\u0300".repeat(32), Utfdecode.getUtf8Output(input));
+    }
+
     @Test void decomposeHangul() {
         var s = "\uCE31";
         for (var form : List.of(Normalizer.Form.NFD, Normalizer.Form.NFKD)) {
@@ -0,0 +1,53 @@
+package utfdecode.tests;
+
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+
+import java.io.ByteArrayOutputStream;
+import java.nio.charset.StandardCharsets;
+
+class ParallelTest {
+
+    // Large enough to be split into several chunks of 256 KiB when decoding in parallel.
+    private static final int INPUT_SIZE = 1024 * 1024;
+
+    private static byte[] repeat(byte[] piece) {
+        var input = new ByteArrayOutputStream();
+        while (input.size() < INPUT_SIZE) {
+            input.writeBytes(piece);
+        }
+        return input.toByteArray();
+    }
+
+    private static void assertSameAsSingleThread(byte[] input, String decodeFormat) {
+        for (var malformed : new String[]{"replace", "ignore", "abort"}) {
+            var expected = Utfdecode.run(input, "-d", decodeFormat, "-e", "utf8", "-m", malformed, "-s", "-j", "1");
+            var actual = Utfdecode.run(input, "-d", decodeFormat, "-e", "utf8", "-m", malformed, "-s", "-j", "4");
+            Assertions.assertFalse(expected.errors.isEmpty());
+            Assertions.assertEquals(65, expected.exitCode);
+            Assertions.assertArrayEquals(expected.output, actual.output);
+            Assertions.assertEquals(expected.errors, actual.errors);
+            Assertions.assertEquals(expected.exitCode, actual.exitCode);
+        }
+    }
+
+    @Test void utf8() {
+        var valid = "aö€💩 ".getBytes(StandardCharsets.UTF_8);
+        // An invalid byte and a truncated sequence:
+        var invalid = new byte[]{(byte) 0xFF, (byte) 0xE2, (byte) 0x82, 'x'};
+        var piece = new ByteArrayOutputStream();
+        piece.writeBytes(valid);
+        piece.writeBytes(invalid);
+        assertSameAsSingleThread(repeat(piece.toByteArray()), "utf8");
+    }
+
+    @Test void utf16() {
+        var valid = "aö€💩 ".getBytes(StandardCharsets.UTF_16LE);
+        // A trailing surrogate without leading surrogate and the other way around:
+        var invalid = new byte[]{0x00, (byte) 0xDC, 0x00, (byte) 0xD8, 'x', 0x00};
+        var piece = new ByteArrayOutputStream();
+        piece.writeBytes(valid);
+        piece.writeBytes(invalid);
+        assertSameAsSingleThread(repeat(piece.toByteArray()), "utf16le");
+    }
+}
@@ -0,0 +1,36 @@
+package utfdecode.tests;
+
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.Map;
+
+class Utf32Tests {
+
+    private static byte[] utf32le(int... codeUnits) {
+        var buffer = ByteBuffer.allocate(4 * codeUnits.length).order(ByteOrder.LITTLE_ENDIAN);
+        for (var codeUnit : codeUnits) {
+            buffer.putInt(codeUnit);
+        }
+        return buffer.array();
+    }
+
+    @Test void invalidCodeUnits() {
+        // U+110000 is past the last code point and U+D800 is a surrogate:
+        var input = utf32le('a', 0x110000, 'b', 0xD800, 'c');
+        var expectedOutput = Map.of(
+                "replace", "a\uFFFDb\uFFFDc",
+                "ignore", "abc",
+                "abort", "a");
+        for (var entry : expectedOutput.entrySet()) {
+            var result = Utfdecode.run(input, "-d", "utf32le", "-e", "utf8", "-m", entry.getKey());
+            Assertions.assertEquals(entry.getValue(), result.getUtf8Output());
+            Assertions.assertEquals(65, result.exitCode);
+            // Errors are reported at the start of the code unit:
+            Assertions.assertTrue(result.errors.startsWith("malformed 4 bytes and 1 character in - "
+                    + "code unit 1114112 above the last code point U+10FFFF\n"), result.errors);
+        }
+    }
+}
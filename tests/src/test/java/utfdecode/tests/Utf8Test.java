@@ -1,4 +1,44 @@
 package utfdecode.tests;
 
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+
+import java.nio.charset.StandardCharsets;
+import java.util.Map;
+
 public class Utf8Test {
+
+    private static byte[] bytes(int... values) {
+        var result = new byte[values.length];
+        for (int i = 0; i < values.length; i++) result[i] = (byte) values[i];
+        return result;
+    }
+
+    @Test void validInput() {
+        for (var input : new String[]{"a", "\u0080", "€", "💩", "a\u0000b"}) {
+            var output = Utfdecode.getUtf8Output(input.getBytes(StandardCharsets.UTF_8));
+            Assertions.assertEquals(input, output);
+        }
+    }
+
+    @Test void replacementOfMaximalSubparts() {
+        for (var entry : Map.of(
+                // Stray continuation bytes:
+                "\uFFFD\uFFFDa", bytes(0x80, 0xBF, 'a'),
+                // Truncated sequence followed by ASCII, which is kept:
+                "a\uFFFDb", bytes('a', 0xE2, 0x82, 'b'),
+                // Overlong encoding of '/':
+                "\uFFFD\uFFFD", bytes(0xC0, 0xAF),
+                // Surrogate U+D800:
+                "\uFFFD\uFFFD\uFFFD", bytes(0xED, 0xA0, 0x80),
+                // Above U+10FFFF:
+                "\uFFFD\uFFFD\uFFFD\uFFFD", bytes(0xF4, 0x90, 0x80, 0x80),
+                // New leading byte in the middle of a sequence:
+                "\uFFFDé", bytes(0xE2, 0xC3, 0xA9)
+        ).entrySet()) {
+            var output = Utfdecode.getUtf8Output(entry.getValue(), "-q");
+            Assertions.assertEquals(entry.getKey(), output);
+            Assertions.assertEquals(new String(entry.getValue(), StandardCharsets.UTF_8), output);
+        }
+    }
 }
@@ -1,5 +1,6 @@
 package utfdecode.tests;
 
+import com.google.common.io.ByteStreams;
 import com.google.common.io.CharStreams;
 
 import java.io.IOException;
@@ -7,10 +8,59 @@ import java.io.InputStreamReader;
 import java.io.OutputStreamWriter;
 import java.nio.charset.Charset;
 import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
 import java.text.Normalizer;
+import java.util.ArrayList;
+import java.util.List;
 
 public class Utfdecode {
 
+    public static class Result {
+        public final byte[] output;
+        public final String errors;
+        public final int exitCode;
+
+        Result(byte[] output, String errors, int exitCode) {
+            this.output = output;
+            this.errors = errors;
+            this.exitCode = exitCode;
+        }
+
+        public String getUtf8Output() {
+            return new String(output, StandardCharsets.UTF_8);
+        }
+    }
+
+    /**
+     * Runs utfdecode with the given arguments, which are not split up, on input which may be large. Input and
+     * errors go through temporary files so that neither pipe fills up while the output is read.
+     */
+    public static Result run(byte[] input, String... arguments) {
+        try {
+            var inputFile = Files.createTempFile("utfdecode-input", null);
+            var errorFile = Files.createTempFile("utfdecode-errors", null);
+            try {
+                Files.write(inputFile, input);
+                var command = new ArrayList<String>();
+                command.add("../build/utfdecode");
+                command.addAll(List.of(arguments));
+                var process = new ProcessBuilder(command)
+                        .redirectInput(inputFile.toFile())
+                        .redirectError(errorFile.toFile())
+                        .start();
+                var output = ByteStreams.toByteArray(process.getInputStream());
+                int exitCode = process.waitFor();
+                var errors = new String(Files.readAllBytes(errorFile), StandardCharsets.UTF_8);
+                return new Result(output, errors, exitCode);
+            } finally {
+                Files.delete(inputFile);
+                Files.delete(errorFile);
+            }
+        } catch (IOException | InterruptedException e) {
+            throw new RuntimeException(e);
+        }
+    }
+
     public static String getUtf8Output(String input) {
         try {
             var process = Runtime.getRuntime().exec("../build/utfdecode");
@@ -35,6 +85,18 @@ public class Utfdecode {
         }
     }
 
+    public static String getUtf8Output(byte[] input, String... arguments) {
+        try {
+            var process = Runtime.getRuntime().exec("../build/utfdecode -e utf8 " + String.join(" ", arguments));
+            try (var out = process.getOutputStream()) {
+                out.write(input);
+            }
+            return CharStreams.toString(new InputStreamReader(process.getInputStream(), StandardCharsets.UTF_8));
+        } catch (IOException e) {
+            throw new RuntimeException(e);
+        }
+    }
+
     private static String utfdecodeCharsetName(Charset encoding) {
         if (encoding == StandardCharsets.UTF_8) {
             return "utf8";
@@ -0,0 +1,34 @@
+#!/bin/sh
+# Measure the startup cost of utfdecode by running it many times on a tiny
+# input and comparing against the cost of just executing /bin/true.
+#
+# Usage: ./startup-benchmark.sh [utfdecode-binary] [iterations]
+set -e -u
+
+UTFDECODE=${1:-../build/utfdecode}
+ITERATIONS=${2:-1000}
+
+INPUT=$(mktemp)
+trap 'rm -f "$INPUT"' EXIT
+printf 'a\xc3\xa5\n' > "$INPUT"
+
+# Prints the average time in microseconds of running the given command.
+measure() {
+	START=$(date +%s%N)
+	i=0
+	while [ $i -lt "$ITERATIONS" ]; do
+		"$@" < "$INPUT" > /dev/null
+		i=$((i + 1))
+	done
+	END=$(date +%s%N)
+	echo $(((END - START) / ITERATIONS / 1000))
+}
+
+BASELINE=$(measure /bin/true)
+echo "/bin/true: ${BASELINE} us"
+
+for ARGUMENTS in "-e silent" "-e utf8" "-d utf8 -e utf16le" "-e decoding" "-e codepoint -n NFC"; do
+	# shellcheck disable=SC2086
+	TIME=$(measure "$UTFDECODE" $ARGUMENTS)
+	echo "utfdecode $ARGUMENTS: ${TIME} us (+$((TIME - BASELINE)) us)"
+done
@@ -0,0 +1,223 @@
+// Tests of stream_decoder_t and normalizer_t, run by "make check".
+
+#include "libutfdecode.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK_EQUAL(expected, actual)                                          \
+  check_equal(expected, actual, __FILE__, __LINE__)
+
+static void check_equal(std::string const &expected, std::string const &actual,
+                        char const *file, int line) {
+  if (expected != actual) {
+    fprintf(stderr, "%s:%d: expected\n  %s\nbut got\n  %s\n", file, line,
+            expected.c_str(), actual.c_str());
+    failures++;
+  }
+}
+
+// Records what is decoded, with errors in between, as a readable string.
+struct recording_handler_t : stream_handler_t {
+  std::string events;
+  std::vector<uint8_t> output;
+
+  void on_codepoints(uint32_t const *codepoints, size_t count) override {
+    for (size_t i = 0; i < count; i++) {
+      char text[16];
+      snprintf(text, sizeof(text), "U+%04X ", codepoints[i]);
+      events += text;
+    }
+  }
+
+  void on_output(uint8_t const *data, size_t length) override {
+    output.insert(output.end(), data, data + length);
+  }
+
+  void on_error(uint64_t byte_offset, char const *message) override {
+    events += "[" + std::to_string(byte_offset) + ": " + message + "] ";
+  }
+};
+
+static std::string bytes(std::vector<uint8_t> const &data) {
+  std::string text;
+  for (uint8_t byte : data) {
+    char hex[4];
+    snprintf(hex, sizeof(hex), "%02X ", byte);
+    text += hex;
+  }
+  return text;
+}
+
+// Decodes input fed in pieces of piece_size bytes, or one piece if 0.
+static std::string decode(utf_encoding_t encoding, std::string const &input,
+                          size_t piece_size = 0, bool replace_errors = true) {
+  recording_handler_t handler;
+  stream_decoder_t decoder;
+  decoder.input_encoding = encoding;
+  decoder.replace_errors = replace_errors;
+  decoder.handler = &handler;
+  uint8_t const *data = reinterpret_cast<uint8_t const *>(input.data());
+  size_t step = piece_size == 0 ? input.size() : piece_size;
+  for (size_t i = 0; i < input.size(); i += step) {
+    decoder.feed(data + i, std::min(step, input.size() - i));
+  }
+  decoder.finish();
+  return handler.events;
+}
+
+static void test_split_sequences() {
+  std::string utf8 = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x92\xA9";
+  std::string utf16be("\x00\x61\x00\xE9\x20\xAC\xD8\x3D\xDC\xA9", 10);
+  std::string utf32le("\x61\x00\x00\x00\xA9\xF4\x01\x00", 8);
+  for (size_t piece_size = 0; piece_size <= 5; piece_size++) {
+    CHECK_EQUAL("U+0061 U+00E9 U+20AC U+1F4A9 ",
+                decode(utf_encoding_t::UTF8, utf8, piece_size));
+    CHECK_EQUAL("U+0061 U+00E9 U+20AC U+1F4A9 ",
+                decode(utf_encoding_t::UTF16BE, utf16be, piece_size));
+    CHECK_EQUAL("U+0061 U+1F4A9 ",
+                decode(utf_encoding_t::UTF32LE, utf32le, piece_size));
+  }
+}
+
+static void test_truncated_input() {
+  for (size_t piece_size = 0; piece_size <= 2; piece_size++) {
+    CHECK_EQUAL("U+0061 [3: incomplete sequence at end of input] U+FFFD ",
+                decode(utf_encoding_t::UTF8, "a\xE2\x82", piece_size));
+    CHECK_EQUAL("U+0061 [4: incomplete sequence at end of input] U+FFFD ",
+                decode(utf_encoding_t::UTF16LE, std::string("a\0\x3D\xD8", 4),
+                       piece_size));
+    CHECK_EQUAL("[3: incomplete sequence at end of input] U+FFFD ",
+                decode(utf_encoding_t::UTF32BE, std::string("\0\0a", 3),
+                       piece_size));
+  }
+}
+
+// Errors in UTF-8 are reported at the byte where the input stops making sense,
+// and errors in UTF-16 and UTF-32 at the start of the rejected code unit.
+static void test_error_offsets() {
+  for (size_t piece_size = 0; piece_size <= 3; piece_size++) {
+    CHECK_EQUAL("U+0061 [1: invalid byte] U+FFFD U+0062 "
+                "[4: expected continuation byte] U+FFFD U+0063 ",
+                decode(utf_encoding_t::UTF8, "a\xFF" "b\xC3" "c", piece_size));
+    CHECK_EQUAL("[0: unexpected continuation byte] U+FFFD "
+                "[2: surrogate in UTF-8] U+FFFD "
+                "[2: unexpected continuation byte] U+FFFD "
+                "[3: unexpected continuation byte] U+FFFD ",
+                decode(utf_encoding_t::UTF8, "\x80\xED\xA0\x80", piece_size));
+    CHECK_EQUAL("[0: trailing surrogate without leading surrogate] U+FFFD "
+                "[2: leading surrogate without trailing surrogate] U+FFFD "
+                "U+0061 ",
+                decode(utf_encoding_t::UTF16BE,
+                       std::string("\xDC\x00\xD8\x00\x00\x61", 6),
+                       piece_size));
+    CHECK_EQUAL("[0: code point out of range] U+FFFD "
+                "[4: surrogate in UTF-32] U+FFFD U+0061 ",
+                decode(utf_encoding_t::UTF32LE,
+                       std::string("\x00\x00\x11\x00\x00\xD8\x00\x00"
+                                   "a\x00\x00\x00",
+                                   12),
+                       piece_size));
+  }
+}
+
+static void test_without_replacement() {
+  CHECK_EQUAL("U+0061 [1: invalid byte] U+0062 [4: incomplete sequence at end "
+              "of input] ",
+              decode(utf_encoding_t::UTF8, "a\xFF" "b\xC3", 0, false));
+  CHECK_EQUAL("[0: trailing surrogate without leading surrogate] U+0061 ",
+              decode(utf_encoding_t::UTF16LE,
+                     std::string("\x00\xDC\x61\x00", 4), 1, false));
+}
+
+static void test_encoded_output() {
+  recording_handler_t handler;
+  stream_decoder_t decoder;
+  decoder.encode_output = true;
+  decoder.output_encoding = utf_encoding_t::UTF16LE;
+  decoder.handler = &handler;
+  // Long enough to go through the bulk transcoding too:
+  std::string input(100, 'a');
+  input += "\xF0\x9F\x92\xA9\xFF";
+  decoder.feed(reinterpret_cast<uint8_t const *>(input.data()), input.size());
+  decoder.finish();
+  std::string expected;
+  for (int i = 0; i < 100; i++) {
+    expected += "61 00 ";
+  }
+  expected += "3D D8 A9 DC FD FF ";
+  CHECK_EQUAL(expected, bytes(handler.output));
+  CHECK_EQUAL("[104: invalid byte] ", handler.events);
+}
+
+static std::string normalize(normalization_form_t form, bool stream_safe,
+                             std::vector<uint32_t> const &input) {
+  normalizer_t normalizer;
+  normalizer.form = form;
+  normalizer.stream_safe = stream_safe;
+  std::vector<uint32_t> result;
+  uint32_t normalized[normalizer_t::MAX_OUTPUT];
+  for (uint32_t codepoint : input) {
+    size_t count = normalizer.push(codepoint, normalized);
+    result.insert(result.end(), normalized, normalized + count);
+  }
+  size_t count = normalizer.flush(normalized);
+  result.insert(result.end(), normalized, normalized + count);
+
+  std::string text;
+  for (uint32_t codepoint : result) {
+    char hex[16];
+    snprintf(hex, sizeof(hex), "U+%04X ", codepoint);
+    text += hex;
+  }
+  return text;
+}
+
+static void test_normalizer() {
+  CHECK_EQUAL("U+0061 U+030A ",
+              normalize(normalization_form_t::NFD, false, {0xE5}));
+  CHECK_EQUAL("U+00E5 ",
+              normalize(normalization_form_t::NFC, false, {0x61, 0x30A}));
+  CHECK_EQUAL("U+0071 U+0323 U+0307 ",
+              normalize(normalization_form_t::NFD, false,
+                        {0x71, 0x307, 0x323}));
+  CHECK_EQUAL("U+AC01 ",
+              normalize(normalization_form_t::NFC, false,
+                        {0x1100, 0x1161, 0x11A8}));
+  CHECK_EQUAL("U+0046 U+0046 ",
+              normalize(normalization_form_t::NFKC, false, {0x46, 0xFF26}));
+
+  // A U+034F COMBINING GRAPHEME JOINER is inserted before the 31st
+  // non-starter in a row:
+  std::vector<uint32_t> marks{0x61};
+  std::string expected = "U+0061 ";
+  for (int i = 0; i < 32; i++) {
+    marks.push_back(0x300);
+    if (i == 30) {
+      expected += "U+034F ";
+    }
+    expected += "U+0300 ";
+  }
+  CHECK_EQUAL(expected, normalize(normalization_form_t::NONE, true, marks));
+  CHECK_EQUAL(expected, normalize(normalization_form_t::NFD, true, marks));
+}
+
+int main() {
+  test_split_sequences();
+  test_truncated_input();
+  test_error_offsets();
+  test_without_replacement();
+  test_encoded_output();
+  test_normalizer();
+  if (failures > 0) {
+    fprintf(stderr, "%d failures\n", failures);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -1,69 +1,51 @@
 #include "utfdecode.hpp"
 
-void die_with_internal_error [[noreturn]] (char const *fmt, ...) {
-  fprintf(stderr, "utfdecode: internal error - ");
-  va_list argp;
-  va_start(argp, fmt);
-  vfprintf(stderr, fmt, argp);
-  va_end(argp);
-  fprintf(stderr, "\n");
-  exit(EX_SOFTWARE);
+void program_options_t::copy_settings(program_options_t const &other) {
+  input_format = other.input_format;
+  output_format = other.output_format;
+  error_handling = other.error_handling;
+  error_reporting = other.error_reporting;
+  normalizer.form = other.normalizer.form;
+  timestamps = other.timestamps;
+  print_summary = other.print_summary;
+  output_is_terminal = other.output_is_terminal;
+  block_info = other.block_info;
+  wcwidth = other.wcwidth;
+  normalizer.stream_safe = other.normalizer.stream_safe;
+  byte_skip_offset = other.byte_skip_offset;
+  byte_skip_limit = other.byte_skip_limit;
+  output.line_buffered = other.output.line_buffered;
+  output.flush_interval_ms = other.output.flush_interval_ms;
 }
 
-void program_options_t::encode_codepoint(uint32_t codepoint,
-                                         bool output_non_starters) {
+void program_options_t::encode_codepoint(uint32_t codepoint) {
   this->codepoints_into_input++;
 
   if (this->is_silent_output()) {
     return;
   }
 
-  auto code_point_info = lookup_code_point(codepoint);
-
-  if (this->normalization_form != normalization_form_t::NONE) {
-    bool compatible = this->normalization_form == normalization_form_t::NFKC ||
-                      this->normalization_form == normalization_form_t::NFKD;
-
-    uint8_t len;
-    uint32_t const *decomposed = unicode_decompose(codepoint, compatible, &len);
-    if (len == 0) {
-      if (codepoint >= 0xAC00 && codepoint <= 0xD7A3) {
-        // Hangul decomposition.
-        // https://stackoverflow.com/a/53114472/300710
-        uint32_t diff = codepoint - 0xAC00;
-        uint32_t rest = diff % 28;
-        uint32_t quotient = diff / 28;
-        uint32_t v_jamo = (quotient % 21) + 0x1161;
-        uint32_t l_jamo = (quotient / 21) + 0x1100;
-        this->encode_codepoint(l_jamo, true);
-        this->encode_codepoint(v_jamo, true);
-        if (rest != 0) {
-          uint32_t t_jamo = rest + 0x11A7;
-          this->encode_codepoint(t_jamo, true);
-        }
-        return;
-      } else {
-        if (!output_non_starters) {
-          bool is_starter = code_point_info->canonical_combining_class == 0;
-          if (is_starter) {
-            std::vector<uint32_t> non_starters_copy =
-                this->normalization_non_starters;
-            this->normalization_non_starters.clear();
-
-            flush_normalization_non_starters(non_starters_copy);
-          } else {
-            this->normalization_non_starters.push_back(codepoint);
-            return;
-          }
-        }
-      }
-    } else {
-      for (uint8_t i = 0; i < len; i++) {
-        this->encode_codepoint(decomposed[i], true);
-      }
-      return;
+  if (normalizer.is_active()) {
+    uint32_t normalized[normalizer_t::MAX_OUTPUT];
+    size_t count = normalizer.push(codepoint, normalized);
+    for (size_t i = 0; i < count; i++) {
+      output_codepoint(normalized[i]);
     }
+  } else {
+    output_codepoint(codepoint);
   }
+}
+
+void program_options_t::flush_normalization_buffer() {
+  uint32_t normalized[normalizer_t::MAX_OUTPUT];
+  size_t count = normalizer.flush(normalized);
+  for (size_t i = 0; i < count; i++) {
+    output_codepoint(normalized[i]);
+  }
+}
+
+void program_options_t::output_codepoint(uint32_t codepoint) {
+  auto code_point_info = lookup_code_point(codepoint);
 
   if (this->output_format == output_format_t::DESCRIPTION_DECODING ||
       this->output_format == output_format_t::DESCRIPTION_CODEPOINT) {
@@ -74,11 +56,11 @@ void program_options_t::encode_codepoint(uint32_t codepoint,
     if (wcwidth_value != -1) {
       char const *extra_whitespace =
           general_category_is_combining(code_point_info->category) ? " " : "";
-      printf("%s%s = ", extra_whitespace, utf8_buffer);
+      output.printf("%s%s = ", extra_whitespace, utf8_buffer);
     }
 
     auto name = lookup_code_point_name(codepoint);
-    printf("U+%04X %s", codepoint, name.c_str());
+    output.printf("U+%04X %s", codepoint, name.c_str());
 
     if (this->block_info) {
       char const *plane_name = "???";
@@ -101,74 +83,84 @@ void program_options_t::encode_codepoint(uint32_t codepoint,
       }
 
       char const *block_name = get_block_name(codepoint);
-      printf(". Block %s in plane %s", block_name, plane_name);
+      output.printf(". Block %s in plane %s", block_name, plane_name);
 
       char const *category_description =
           general_category_description(code_point_info->category);
-      printf(". Category: %s", category_description);
+      output.printf(". Category: %s", category_description);
     }
     if (this->wcwidth) {
-      printf(". wcwidth=%d", wcwidth_value);
+      output.printf(". wcwidth=%d", wcwidth_value);
     }
-    printf("\n");
+    output.write("\n", 1);
   } else if (this->output_format == output_format_t::UTF8) {
-    uint8_t utf8_buffer[5];
+    uint8_t utf8_buffer[4];
     int utf8_byte_count = codepoint_to_utf8(codepoint, utf8_buffer);
-    utf8_buffer[utf8_byte_count] = 0;
-    printf("%s", utf8_buffer);
-    fflush(stdout);
+    output.write(utf8_buffer, utf8_byte_count);
   } else if (output_format == output_format_t::UTF16BE ||
              output_format == output_format_t::UTF16LE) {
-    uint8_t output[5];
+    uint8_t output_buffer[5];
     bool little_endian = output_format == output_format_t::UTF16LE;
-    int output_length = encode_utf16(codepoint, output, little_endian);
-    write(STDOUT_FILENO, output, output_length);
-    fflush(stdout);
+    int output_length = encode_utf16(codepoint, output_buffer, little_endian);
+    output.write(output_buffer, output_length);
   } else if (output_format == output_format_t::UTF32BE ||
              output_format == output_format_t::UTF32LE) {
-    uint8_t buffer[5];
+    uint8_t buffer[4];
     bool little_endian = output_format == output_format_t::UTF32LE;
-    for (int i = 0; i < 4; i++) {
-      int shift = 8 * (little_endian ? i : (3 - i));
-      buffer[i] = (codepoint >> shift) & 0xFF;
-    }
-    write(STDOUT_FILENO, buffer, 4);
-    fflush(stdout);
+    output.write(buffer, encode_utf32(codepoint, buffer, little_endian));
   }
 }
 
-void program_options_t::flush_normalization_non_starters(
-    std::vector<uint32_t> &non_starters) {
-  std::sort(non_starters.begin(), non_starters.end(),
-            [](uint32_t a, uint32_t b) {
-              auto ac = lookup_code_point(a)->canonical_combining_class;
-              auto bc = lookup_code_point(b)->canonical_combining_class;
-              return ac < bc;
-            });
-
-  for (auto cp : non_starters) {
-    encode_codepoint(cp, true);
-  }
+void program_options_t::report_error(uint64_t bytes, uint64_t codepoints,
+                                     char const *message) {
+  output.flush();
+  char const *color_prefix = output_is_terminal ? "\x1B[31m" : "";
+  char const *color_suffix = output_is_terminal ? "\x1B[m" : "";
+  std::string name = input_name.empty() ? "" : input_name + " ";
+  fprintf(stderr, "%s", color_prefix);
+  fprintf(stderr, "malformed %" PRIu64 " %s and %" PRIu64 " %s in %s- %s",
+          bytes, (bytes == 1 ? "byte" : "bytes"), codepoints,
+          codepoints == 1 ? "character" : "characters", name.c_str(),
+          message);
+  fprintf(stderr, "%s\n", color_suffix);
+  fflush(stderr);
 }
 
 void program_options_t::note_error(int byte, char const *error_msg, ...) {
-  error_count++;
-  if (error_reporting == error_reporting_t::REPORT_STDERR) {
-    fflush(stdout);
-    char const *color_prefix = output_is_terminal ? "\x1B[31m" : "";
-    char const *color_suffix = output_is_terminal ? "\x1B[m" : "";
-    fprintf(stderr, "%s", color_prefix);
-    fprintf(stderr, "malformed %" PRIu64 " %s and %" PRIu64 " %s in - ",
-            bytes_into_input, (bytes_into_input == 1 ? "byte" : "bytes"),
-            codepoints_into_input,
-            codepoints_into_input == 1 ? "character" : "characters");
-    va_list argp;
-    va_start(argp, error_msg);
-    vfprintf(stderr, error_msg, argp);
-    va_end(argp);
+  (void)byte;
+  va_list argp;
+  va_start(argp, error_msg);
+  vnote_error(bytes_into_input, error_msg, argp);
+  va_end(argp);
+}
 
-    fprintf(stderr, "%s\n", color_suffix);
-    fflush(stderr);
+void program_options_t::note_error_at(uint64_t byte_offset,
+                                      char const *error_msg, ...) {
+  va_list argp;
+  va_start(argp, error_msg);
+  vnote_error(byte_offset, error_msg, argp);
+  va_end(argp);
+}
+
+void program_options_t::vnote_error(uint64_t byte_offset,
+                                    char const *error_msg, va_list argp) {
+  error_count++;
+  bool report = error_reporting == error_reporting_t::REPORT_STDERR;
+  // When decoding in parallel, an error is also needed to know where to stop
+  // the output when aborting:
+  bool defer = defer_errors &&
+               (report || error_handling == error_handling_t::ABORT);
+  if (report || defer) {
+    char message[256] = "";
+    if (report) {
+      vsnprintf(message, sizeof(message), error_msg, argp);
+    }
+    if (defer) {
+      deferred_errors.push_back({byte_offset, codepoints_into_input,
+                                 output.memory.size() + output.used, message});
+    } else {
+      report_error(byte_offset, codepoints_into_input, message);
+    }
   }
 
   switch (error_handling) {
@@ -180,12 +172,18 @@ void program_options_t::note_error(int byte, char const *error_msg, ...) {
     }
     break;
   case error_handling_t::ABORT:
+    if (defer_errors) {
+      // Let whoever collects the deferred errors abort after reporting them:
+      break;
+    }
+    output.flush();
     exit(EX_DATAERR);
     break;
   }
 }
 
 void program_options_t::cleanup_and_exit(int exit_status) {
+  output.flush();
   if (input_is_terminal)
     tcsetattr(0, TCSANOW, &vt_orig);
   exit(exit_status);
@@ -195,64 +193,11 @@ void program_options_t::print_byte_result(int byte, char const *msg, ...) {
   if (print_byte_input()) {
     va_list argp;
     va_start(argp, msg);
-    vfprintf(stdout, msg, argp);
+    output.vprintf(msg, argp);
     va_end(argp);
   }
 }
 
-void program_options_t::process_utf16_byte(uint8_t byte, uint8_t *state_buffer,
-                                           uint8_t &state_pos) {
-  state_buffer[state_pos++] = byte;
-  if (state_pos == 2) {
-    uint16_t codeuint =
-        (input_format == input_format_t::UTF16LE)
-            ? state_buffer[0] + (uint16_t(state_buffer[1]) << 8)
-            : state_buffer[1] + (uint16_t(state_buffer[0]) << 8);
-    if (codeuint >= 0xD800 && codeuint <= 0xDBFF) {
-      print_byte_result(byte, "leading surrogate %d\n", codeuint);
-    } else if (codeuint >= 0xDC00 && codeuint <= 0xDFFF) {
-      note_error(byte, "trailing surrogate %d without leading surrogate before",
-                 codeuint);
-      state_pos = 0;
-    } else {
-      encode_codepoint(codeuint);
-      state_pos = 0;
-    }
-  } else if (state_pos == 4) {
-    uint16_t leading_surrogate =
-        (input_format == input_format_t::UTF16LE)
-            ? state_buffer[0] + (uint16_t(state_buffer[1]) << 8)
-            : state_buffer[1] + (uint16_t(state_buffer[0]) << 8);
-    uint16_t trailing_surrogate =
-        (input_format == input_format_t::UTF16LE)
-            ? state_buffer[2] + (uint16_t(state_buffer[3]) << 8)
-            : state_buffer[3] + (uint16_t(state_buffer[2]) << 8);
-    uint32_t codepoint = 0x010000 +
-                         (uint32_t(leading_surrogate - 0xD800) << 10) +
-                         (trailing_surrogate - 0xDC00);
-    print_byte_result(byte, "trailing surrogate %d", trailing_surrogate);
-    encode_codepoint(codepoint);
-    state_pos = 0;
-  }
-}
-
-void program_options_t::process_utf32_byte(uint8_t byte, uint8_t *state_buffer,
-                                           uint8_t &state_pos) {
-  state_buffer[state_pos++] = byte;
-  if (state_pos == 4) {
-    uint32_t codepoint = 0;
-    for (int i = 0; i < 4; i++) {
-      int shift = 8 * ((input_format == input_format_t::UTF32LE) ? i : (3 - i));
-      codepoint += (state_buffer[i] << shift) & (0xFF << shift);
-    }
-    print_byte_result(byte, "byte 4 of a UTF-32 code unit: ");
-    encode_codepoint(codepoint);
-    state_pos = 0;
-  } else {
-    print_byte_result(byte, "byte %d of a UTF-32 code unit\n", state_pos);
-  }
-}
-
 void program_options_t::process_textual_codepoint_byte(
     uint8_t byte, uint8_t *state_buffer, uint8_t &state_buffer_pos) {
   if (byte == '\n' || byte == ' ' || byte == '\r' || byte == '\t') {
@@ -280,10 +225,410 @@ void program_options_t::process_textual_codepoint_byte(
   }
 }
 
+namespace {
+
+// Hands what the byte decoder of the library decodes to the program, with
+// the code units of UTF-16 and UTF-32 described on the way when asked to.
+struct byte_decoder_handler_t {
+  program_options_t &options;
+  uint8_t byte;
+
+  bool is_utf16() const {
+    return options.input_format == input_format_t::UTF16BE ||
+           options.input_format == input_format_t::UTF16LE;
+  }
+
+  bool is_utf32() const {
+    return options.input_format == input_format_t::UTF32BE ||
+           options.input_format == input_format_t::UTF32LE;
+  }
+
+  void on_codepoint(uint32_t codepoint) {
+    if (is_utf16() && codepoint >= 0x10000) {
+      options.print_byte_result(byte, "trailing surrogate %u",
+                                0xDC00 + (codepoint & 0x3FF));
+    } else if (is_utf32()) {
+      options.print_byte_result(byte, "byte 4 of a UTF-32 code unit: ");
+    }
+    options.encode_codepoint(codepoint);
+  }
+
+  void on_leading_surrogate(uint16_t code_unit) {
+    options.print_byte_result(byte, "leading surrogate %u\n", code_unit);
+  }
+
+  void on_error(utf_error_t error, uint32_t code_unit, size_t bytes_before,
+                char const *message) {
+    uint64_t byte_offset = options.bytes_into_input - bytes_before;
+    switch (error) {
+    case utf_error_t::UTF8_REJECTED:
+      options.note_error(byte, "%s", message);
+      break;
+    case utf_error_t::LEADING_SURROGATE_WITHOUT_TRAILING:
+      options.note_error_at(byte_offset,
+                            "leading surrogate %u without trailing surrogate "
+                            "after",
+                            code_unit);
+      break;
+    case utf_error_t::TRAILING_SURROGATE_WITHOUT_LEADING:
+      if (!options.resync_pending) {
+        options.note_error_at(
+            byte_offset,
+            "trailing surrogate %u without leading surrogate before",
+            code_unit);
+      }
+      break;
+    case utf_error_t::UTF32_OUT_OF_RANGE:
+      options.print_byte_result(byte, "byte 4 of a UTF-32 code unit\n");
+      options.note_error_at(byte_offset,
+                            "code unit %u above the last code point U+10FFFF",
+                            code_unit);
+      break;
+    case utf_error_t::UTF32_SURROGATE:
+      options.print_byte_result(byte, "byte 4 of a UTF-32 code unit\n");
+      options.note_error_at(byte_offset, "surrogate %u in UTF-32", code_unit);
+      break;
+    }
+  }
+};
+
+} // namespace
+
+void program_options_t::process_utf_byte(uint8_t byte,
+                                         utf_byte_decoder_t &decoder) {
+  if (resync_pending && input_format == input_format_t::UTF8) {
+    if ((byte & /*0b11000000=*/0xc0) == /*0b10000000=*/0x80) {
+      // Started in the middle of a sequence - skip to the start of the next.
+      return;
+    }
+    resync_pending = false;
+  }
+
+  if ((input_format == input_format_t::UTF32BE ||
+       input_format == input_format_t::UTF32LE) &&
+      decoder.unit_size < 3) {
+    print_byte_result(byte, "byte %d of a UTF-32 code unit\n",
+                      decoder.unit_size + 1);
+  }
+  byte_decoder_handler_t handler{*this, byte};
+  decoder.decode(byte, handler);
+  if (decoder.unit_size == 0) {
+    // A code unit is complete, so decoding is back in step:
+    resync_pending = false;
+  }
+}
+
+uint64_t program_options_t::skip_valid_utf8(uint8_t const *data,
+                                            uint64_t length) {
+  uint64_t valid_length = utf8_valid_prefix_length(data, length);
+  codepoints_into_input += utf8_count_codepoints(data, valid_length);
+  bytes_into_input += valid_length;
+  return valid_length;
+}
+
+uint64_t program_options_t::skip_valid_utf32(uint8_t const *data,
+                                             uint64_t length) {
+  uint64_t valid_length = utf32_valid_prefix_length(
+      data, length, input_format == input_format_t::UTF32LE);
+  codepoints_into_input += valid_length / 4;
+  bytes_into_input += valid_length;
+  return valid_length;
+}
+
+uint64_t program_options_t::copy_ascii_utf8(uint8_t const *data,
+                                            uint64_t length) {
+  uint64_t ascii_length = ascii_prefix_length(data, length);
+  if (ascii_length > 0) {
+    normalizer.stream_safe_non_starters = 0;
+  }
+  output.write(data, ascii_length);
+  codepoints_into_input += ascii_length;
+  bytes_into_input += ascii_length;
+  return ascii_length;
+}
+
+uint64_t program_options_t::pass_through_utf8(uint8_t const *data,
+                                              uint64_t length) {
+  uint64_t valid_length = utf8_valid_prefix_length(data, length);
+  output.write_from_input(data, valid_length, input.fd,
+                          input.mapped_offset(data));
+  codepoints_into_input += utf8_count_codepoints(data, valid_length);
+  bytes_into_input += valid_length;
+  return valid_length;
+}
+
+uint64_t program_options_t::transcode_utf16_32_utf8(uint8_t const *data,
+                                                    uint64_t length) {
+  // Transcode in pieces whose output fits in the output buffer:
+  constexpr uint64_t PIECE_SIZE = 64 * 1024;
+  bool from_utf16 = input_format == input_format_t::UTF16LE ||
+                    input_format == input_format_t::UTF16BE;
+  bool little_endian = input_format == input_format_t::UTF16LE ||
+                       input_format == input_format_t::UTF32LE;
+  auto transcode =
+      from_utf16 ? transcode_utf16_to_utf8 : transcode_utf32_to_utf8;
+  uint64_t position = 0;
+  while (position < length) {
+    uint64_t piece = std::min(length - position, PIECE_SIZE);
+    size_t written;
+    uint64_t codepoints;
+    uint64_t transcoded = transcode(
+        data + position, piece, little_endian,
+        output.reserve(from_utf16 ? piece / 2 * 3 : piece), written,
+        codepoints);
+    output.commit(written);
+    codepoints_into_input += codepoints;
+    position += transcoded;
+    if (transcoded == 0) {
+      break;
+    }
+  }
+  bytes_into_input += position;
+  return position;
+}
+
+uint64_t program_options_t::transcode_utf8_utf16_32(uint8_t const *data,
+                                                    uint64_t length) {
+  // Transcode in pieces whose output fits in the output buffer:
+  constexpr uint64_t PIECE_SIZE = 64 * 1024;
+  bool to_utf16 = output_format == output_format_t::UTF16LE ||
+                  output_format == output_format_t::UTF16BE;
+  bool little_endian = output_format == output_format_t::UTF16LE ||
+                       output_format == output_format_t::UTF32LE;
+  auto transcode = to_utf16 ? transcode_utf8_to_utf16 : transcode_utf8_to_utf32;
+  uint64_t position = 0;
+  while (position < length) {
+    uint64_t piece = std::min(length - position, PIECE_SIZE);
+    size_t written;
+    uint64_t codepoints;
+    uint64_t transcoded = transcode(
+        data + position, piece, little_endian,
+        output.reserve(piece * (to_utf16 ? 2 : 4)), written, codepoints);
+    output.commit(written);
+    codepoints_into_input += codepoints;
+    position += transcoded;
+    if (transcoded == 0) {
+      break;
+    }
+  }
+  bytes_into_input += position;
+  return position;
+}
+
+// Hangul syllables and conjoining jamos are all encoded as three byte UTF-8
+// sequences. Returns false for anything else, including invalid input, which
+// is left to the regular decoding.
+static bool decode_three_byte_utf8(uint8_t const *data, uint64_t length,
+                                   uint32_t &codepoint) {
+  if (length < 3 || (data[0] & 0xF0) != 0xE0 || (data[1] & 0xC0) != 0x80 ||
+      (data[2] & 0xC0) != 0x80) {
+    return false;
+  }
+  codepoint = uint32_t(data[0] & 0x0F) << 12 | uint32_t(data[1] & 0x3F) << 6 |
+              (data[2] & 0x3F);
+  return true;
+}
+
+uint64_t program_options_t::normalize_hangul_utf8(uint8_t const *data,
+                                                  uint64_t length) {
+  bool composing = normalizer.is_composing();
+  // Room for the jamos of 256 syllables:
+  uint8_t output_buffer[256 * 3 * 3];
+  uint8_t *output_position = output_buffer;
+  uint64_t position = 0;
+  uint32_t last_syllable = 0;
+
+  uint32_t codepoint;
+  while (decode_three_byte_utf8(data + position, length - position,
+                                codepoint)) {
+    uint32_t s_index = codepoint - HANGUL_S_BASE;
+    uint64_t item_length = 3;
+    if (s_index >= HANGUL_S_COUNT) {
+      // Only leading and vowel jamos which compose into a syllable are
+      // handled here, everything else goes through the regular path:
+      uint32_t l_index = codepoint - HANGUL_L_BASE;
+      uint32_t vowel;
+      if (!composing || l_index >= HANGUL_L_COUNT ||
+          !decode_three_byte_utf8(data + position + 3, length - position - 3,
+                                  vowel) ||
+          vowel - HANGUL_V_BASE >= HANGUL_V_COUNT) {
+        break;
+      }
+      s_index = (l_index * HANGUL_V_COUNT + (vowel - HANGUL_V_BASE)) *
+                HANGUL_T_COUNT;
+      item_length = 6;
+      codepoints_into_input++;
+    }
+
+    uint32_t trailing;
+    if (composing && s_index % HANGUL_T_COUNT == 0 &&
+        decode_three_byte_utf8(data + position + item_length,
+                               length - position - item_length, trailing) &&
+        trailing - HANGUL_T_BASE - 1 < HANGUL_T_COUNT - 1) {
+      s_index += trailing - HANGUL_T_BASE;
+      item_length += 3;
+      codepoints_into_input++;
+    }
+
+    if (position == 0) {
+      // Syllables and leading jamos are starters which nothing before them
+      // composes with, so the pending segment is complete:
+      flush_normalization_buffer();
+      normalizer.stream_safe_non_starters = 0;
+    }
+
+    if (composing) {
+      // A following trailing jamo may still compose with the last syllable,
+      // so only write the ones before it:
+      if (last_syllable != 0) {
+        output_position += codepoint_to_utf8(last_syllable, output_position);
+      }
+      last_syllable = HANGUL_S_BASE + s_index;
+    } else {
+      output_position += codepoint_to_utf8(
+          HANGUL_L_BASE + s_index / HANGUL_N_COUNT, output_position);
+      output_position += codepoint_to_utf8(
+          HANGUL_V_BASE + (s_index % HANGUL_N_COUNT) / HANGUL_T_COUNT,
+          output_position);
+      if (s_index % HANGUL_T_COUNT != 0) {
+        output_position += codepoint_to_utf8(
+            HANGUL_T_BASE + s_index % HANGUL_T_COUNT, output_position);
+      }
+    }
+    if (output_position - output_buffer > int(sizeof(output_buffer)) - 9) {
+      output.write(output_buffer, output_position - output_buffer);
+      output_position = output_buffer;
+    }
+
+    position += item_length;
+    codepoints_into_input++;
+  }
+
+  if (position == 0) {
+    return 0;
+  }
+  output.write(output_buffer, output_position - output_buffer);
+  if (last_syllable != 0) {
+    // Nothing else is held back by the normalizer, so this only keeps the
+    // syllable for a following code point to compose with:
+    uint32_t normalized[normalizer_t::MAX_OUTPUT];
+    normalizer.push(last_syllable, normalized);
+  }
+  bytes_into_input += position;
+  return position;
+}
+
+static utf_encoding_t utf_encoding_of(input_format_t format) {
+  switch (format) {
+  case input_format_t::UTF16BE:
+    return utf_encoding_t::UTF16BE;
+  case input_format_t::UTF16LE:
+    return utf_encoding_t::UTF16LE;
+  case input_format_t::UTF32BE:
+    return utf_encoding_t::UTF32BE;
+  case input_format_t::UTF32LE:
+    return utf_encoding_t::UTF32LE;
+  default:
+    return utf_encoding_t::UTF8;
+  }
+}
+
+bool program_options_t::decode_block(uint8_t const *data, uint64_t length,
+                                     decoder_state_t &state) {
+  state.utf.encoding = utf_encoding_of(input_format);
+  bool validate_in_bulk = input_format == input_format_t::UTF8 &&
+                          is_silent_output() && !input_is_terminal;
+  bool validate_utf32_in_bulk = (input_format == input_format_t::UTF32LE ||
+                                 input_format == input_format_t::UTF32BE) &&
+                                is_silent_output() && !input_is_terminal;
+  bool pass_through_in_bulk =
+      input_format == input_format_t::UTF8 &&
+      output_format == output_format_t::UTF8 && !normalizer.is_active() &&
+      !input_is_terminal;
+  bool copy_ascii_in_bulk =
+      input_format == input_format_t::UTF8 &&
+      output_format == output_format_t::UTF8 &&
+      normalizer.form == normalization_form_t::NONE && !input_is_terminal;
+  bool transcode_to_utf8_in_bulk =
+      (input_format == input_format_t::UTF16LE ||
+       input_format == input_format_t::UTF16BE ||
+       input_format == input_format_t::UTF32LE ||
+       input_format == input_format_t::UTF32BE) &&
+      output_format == output_format_t::UTF8 && !normalizer.is_active() &&
+      !input_is_terminal;
+  bool transcode_utf8_in_bulk =
+      input_format == input_format_t::UTF8 &&
+      (output_format == output_format_t::UTF16LE ||
+       output_format == output_format_t::UTF16BE ||
+       output_format == output_format_t::UTF32LE ||
+       output_format == output_format_t::UTF32BE) &&
+      !normalizer.is_active() && !input_is_terminal;
+  bool normalize_hangul_in_bulk =
+      input_format == input_format_t::UTF8 &&
+      output_format == output_format_t::UTF8 &&
+      normalizer.form != normalization_form_t::NONE && !input_is_terminal;
+
+  uint64_t decode_bytewise_until = 0;
+  for (uint64_t i = 0; i < length; i++) {
+    if (i >= decode_bytewise_until && state.utf.is_idle() && !resync_pending) {
+      if (validate_in_bulk) {
+        // Only validating - skip over valid input, which is the common
+        // case, without decoding it and let the byte by byte decoding below
+        // report any errors.
+        i += skip_valid_utf8(data + i, length - i);
+        decode_bytewise_until = i + 64;
+      } else if (validate_utf32_in_bulk) {
+        i += skip_valid_utf32(data + i, length - i);
+        decode_bytewise_until = i + 64;
+      } else if (pass_through_in_bulk) {
+        // Valid input is its own output, so only the errors in it need to
+        // be decoded:
+        i += pass_through_utf8(data + i, length - i);
+        decode_bytewise_until = i + 64;
+      } else if (copy_ascii_in_bulk) {
+        i += copy_ascii_utf8(data + i, length - i);
+      } else if (transcode_to_utf8_in_bulk) {
+        i += transcode_utf16_32_utf8(data + i, length - i);
+        // Decode an invalid code unit, an unpaired surrogate or a code point
+        // cut off by the end of the block byte by byte:
+        decode_bytewise_until = i + 64;
+      } else if (transcode_utf8_in_bulk) {
+        i += transcode_utf8_utf16_32(data + i, length - i);
+        decode_bytewise_until = i + 64;
+      } else if (normalize_hangul_in_bulk && data[i] >= 0xE1 &&
+                 data[i] <= 0xED) {
+        // Decompose or compose runs of Hangul syllables arithmetically,
+        // without going through the code point by code point path:
+        uint64_t normalized = normalize_hangul_utf8(data + i, length - i);
+        i += normalized;
+        if (normalized == 0) {
+          // Not Hangul - avoid retrying on every following code point:
+          decode_bytewise_until = i + 16;
+        }
+      }
+      if (i == length) {
+        break;
+      }
+    }
+
+    uint8_t c = data[i];
+    if (input_is_terminal && (c == 3 || c == 4)) {
+      /* Let the user exit on ctrl+c or ctrl+d, or on end of file. */
+      return true;
+    }
+    if (input_format == input_format_t::TEXTUAL_CODEPOINT) {
+      process_textual_codepoint_byte(c, state.state_buffer,
+                                     state.state_buffer_position);
+    } else {
+      process_utf_byte(c, state.utf);
+    }
+    bytes_into_input++;
+  }
+  return false;
+}
+
 void program_options_t::read_and_echo() {
-  uint8_t remaining_bytes = 0;
-  uint8_t state_buffer_position = 0;
-  uint8_t state_buffer[16];
+  decoder_state_t state;
 
   int64_t initial_timestamp = -1;
   if (timestamps) {
@@ -292,25 +637,31 @@ void program_options_t::read_and_echo() {
     initial_timestamp = tv.tv_sec * 1000 + tv.tv_usec / 1000;
   }
 
+  input.open(input_fd, input_is_terminal);
+  bytes_into_input += input.skip(byte_skip_offset);
+  resync_pending = byte_skip_offset != 0;
+
+  input_block_t block;
   while (true) {
-    unsigned char read_buffer[256];
-    int read_now = read(0, read_buffer, sizeof(read_buffer) - 1);
-    if (read_now == 0) {
-      return;
-    } else if (read_now < 0) {
-      perror("read()");
-      return;
+    int64_t ms_until_flush = output.ms_until_flush();
+    if (ms_until_flush > 0 && !input.wait_for_input(ms_until_flush)) {
+      // No input arrived in time - flush what is buffered while waiting:
+      output.flush();
+    }
+    if (!input.read_block(block)) {
+      break;
     }
 
-    unsigned char *start_of_buffer = read_buffer;
+    uint8_t const *start_of_buffer = block.data;
+    uint64_t read_now = block.size;
     if (read_now + bytes_into_input < byte_skip_offset) {
       bytes_into_input += read_now;
       continue;
     } else if (bytes_into_input < byte_skip_offset) {
-      int skipping_now = byte_skip_offset - bytes_into_input;
+      uint64_t skipping_now = byte_skip_offset - bytes_into_input;
       bytes_into_input += skipping_now;
       read_now -= skipping_now;
-      start_of_buffer = &read_buffer[skipping_now];
+      start_of_buffer += skipping_now;
     }
 
     if (timestamps) {
@@ -318,43 +669,32 @@ void program_options_t::read_and_echo() {
       gettimeofday(&tv, NULL);
       long long int elapsed =
           (tv.tv_sec * 1000 + tv.tv_usec / 1000) - initial_timestamp;
-      printf("%lld ms\n", elapsed);
+      output.printf("%lld ms\n", elapsed);
     }
 
     bool end_of_input = false;
-    for (int i = 0; i < read_now; i++) {
-      uint8_t c = start_of_buffer[i];
-      if (input_is_terminal && (c == 3 || c == 4)) {
-        /* Let the user exit on ctrl+c or ctrl+d, or on end of file. */
-        end_of_input = true;
-        break;
-      }
-      switch (input_format) {
-      case input_format_t::UTF8:
-        process_utf8_byte(c, state_buffer, state_buffer_position,
-                          remaining_bytes);
-        break;
-      case input_format_t::UTF16BE:
-      case input_format_t::UTF16LE:
-        process_utf16_byte(c, state_buffer, state_buffer_position);
-        break;
-      case input_format_t::UTF32BE:
-      case input_format_t::UTF32LE:
-        process_utf32_byte(c, state_buffer, state_buffer_position);
-        break;
-      case input_format_t::TEXTUAL_CODEPOINT:
-        process_textual_codepoint_byte(c, state_buffer, state_buffer_position);
-        break;
-      }
-      bytes_into_input++;
-      if (byte_skip_limit != 0 &&
-          ((byte_skip_limit + byte_skip_offset) <= bytes_into_input)) {
+    if (byte_skip_limit != 0) {
+      uint64_t remaining_limit =
+          byte_skip_limit + byte_skip_offset - bytes_into_input;
+      if (remaining_limit <= read_now) {
+        read_now = remaining_limit;
         end_of_input = true;
-        break;
       }
     }
-    fflush(stdout);
+
+    if (jobs > 1) {
+      // Decode large blocks, such as a mapped file, with several threads:
+      uint64_t decoded = decode_in_parallel(start_of_buffer, read_now, state);
+      start_of_buffer += decoded;
+      read_now -= decoded;
+    }
+    if (decode_block(start_of_buffer, read_now, state)) {
+      end_of_input = true;
+    }
+    output.flush_if_due();
     if (end_of_input)
-      return;
+      break;
   }
+  input.release_block(block);
+  input.close();
 }
@@ -4,88 +4,37 @@
 #define __STDC_FORMAT_MACROS
 #define _XOPEN_SOURCE
 
+#include <errno.h>
 #include <fcntl.h>
 #include <getopt.h>
 #include <inttypes.h>
 #include <locale.h>
+#include <poll.h>
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/time.h>
+#include <sys/uio.h>
 #include <sysexits.h>
 #include <termios.h>
 #include <unistd.h>
 #include <wchar.h>
 
 #include <algorithm>
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "config.h"
 
-#include "musl/wcwidth_musl.h"
-
-enum class normalization_form_t {
-  NONE, // Do not use a normalization form.
-  NFD,  // Canonical Decomposition.
-  NFC,  // Canonical Decomposition, followed by Canonical Composition.
-  NFKD, // Compatibility Decomposition
-  NFKC  // Compatibility Decomposition, followed by Canonical Composition
-};
-
-enum class general_category_value_t {
-  Uppercase_Letter,
-  Lowercase_Letter,
-  Titlecase_Letter,
-  Cased_Letter,
-  Modifier_Letter,
-  Other_Letter,
-  Letter,
-  Nonspacing_Mark,
-  Spacing_Mark,
-  Enclosing_Mark,
-  Mark,
-  Decimal_Number,
-  Letter_Number,
-  Other_Number,
-  Number,
-  Connector_Punctuation,
-  Dash_Punctuation,
-  Open_Punctuation,
-  Close_Punctuation,
-  Initial_Punctuation,
-  Final_Punctuation,
-  Other_Punctuation,
-  Punctuation,
-  Math_Symbol,
-  Currency_Symbol,
-  Modifier_Symbol,
-  Other_Symbol,
-  Symbol,
-  Space_Separator,
-  Line_Separator,
-  Paragraph_Separator,
-  Separator,
-  Control,
-  Format,
-  Surrogate,
-  Private_Use,
-  Unassigned,
-  Other
-};
+#include "libutfdecode.hpp"
 
-struct code_point {
-  uint32_t numeric_value;
-  char const* name;
-  general_category_value_t category;
-  uint8_t canonical_combining_class;
-  bool bidi_mirrored;
-  uint32_t simple_uppercase_mapping;
-  uint32_t simple_lowercase_mapping;
-  uint32_t simple_titlecase_mapping;
-};
+#include "musl/wcwidth_musl.h"
 
 enum class input_format_t {
   UTF8,
@@ -107,53 +56,182 @@ enum class output_format_t {
   SILENT
 };
 
-enum class error_handling_t { ABORT, REPLACE, IGNORE };
-
 enum class error_reporting_t { REPORT_STDERR, SILENT };
 
-void die_with_internal_error [[noreturn]] (char const *fmt, ...);
+// Keeps a few input buffers around so that they can be reused between reads
+// instead of being allocated for each block of input.
+struct buffer_pool_t {
+  static constexpr size_t MAX_FREE_BUFFERS = 4;
 
-void unicode_code_points_initialize();
+  std::vector<std::vector<uint8_t>> free_buffers;
 
-code_point const *lookup_code_point(uint32_t);
+  std::vector<uint8_t> acquire(size_t size);
 
-std::string lookup_code_point_name(uint32_t code_point);
+  void release(std::vector<uint8_t> buffer);
+};
 
-uint32_t const *unicode_decompose(uint32_t codePoint, bool compatible,
-                                  uint8_t *len);
+struct input_block_t {
+  std::vector<uint8_t> buffer;
+  uint8_t const *data{nullptr};
+  size_t size{0};
+};
 
-int codepoint_to_utf8(uint32_t codePoint, uint8_t *utf8InputBuffer);
+// Reads input in large blocks, growing the block size as long as the input
+// keeps filling them up. Interactive terminals are read with small reads so
+// that key presses are decoded as they are typed. Regular files are memory
+// mapped and handed out as a single block without any copying.
+struct input_reader_t {
+  static constexpr size_t TERMINAL_BLOCK_SIZE = 255;
+  static constexpr size_t MIN_BLOCK_SIZE = 64 * 1024;
+  static constexpr size_t MAX_BLOCK_SIZE = 4 * 1024 * 1024;
 
-int encode_utf16(uint32_t codePoint, uint8_t *buffer, bool little_endian);
+  int fd{STDIN_FILENO};
+  bool interactive{false};
+  bool regular_file{false};
+  size_t block_size{MIN_BLOCK_SIZE};
+  uint64_t file_position{0};
+  buffer_pool_t pool;
+
+  uint8_t *mapped_data{nullptr};
+  size_t mapped_size{0};
+  size_t mapped_position{0};
+
+  void open(int input_fd, bool is_terminal);
+
+  // Unmaps the input and frees the buffers kept for reuse.
+  void close();
+
+  // Waits up to timeout_ms milliseconds, or forever if negative, for input
+  // to become available. Returns false on timeout.
+  bool wait_for_input(int timeout_ms);
+
+  // Skips up to count bytes of input without reading them if the input is
+  // mapped or seekable, returning the number of bytes skipped.
+  uint64_t skip(uint64_t count);
+
+  // Reads the next block of input. Returns false at end of input or on error.
+  bool read_block(input_block_t &block);
+
+  void release_block(input_block_t &block);
+
+  // Returns the offset in the file of data in a block of mapped input, or
+  // -1 if it was read into a buffer.
+  int64_t mapped_offset(uint8_t const *data) const;
+};
 
-char const *general_category_description(general_category_value_t category);
+// Collects output in a large buffer, which is written when full and at
+// explicit flush points: after each line when writing to a terminal, and
+// after each block of input once flush_interval_ms has passed since the
+// last flush.
+struct output_sink_t {
+  static constexpr size_t BUFFER_SIZE = 1024 * 1024;
+  // Input shorter than this is copied through the buffer instead.
+  static constexpr size_t MIN_ZERO_COPY_LENGTH = 64 * 1024;
+
+  int fd{STDOUT_FILENO};
+  bool line_buffered{false};
+  int64_t flush_interval_ms{0};
+  int64_t last_flush_ms{0};
+  // Allocated on first use and left uninitialized, so that it costs nothing
+  // until it is written to:
+  std::unique_ptr<uint8_t[]> buffer;
+  size_t used{0};
+  // Set to collect the output in memory instead of writing it to fd.
+  bool in_memory{false};
+  std::vector<uint8_t> memory;
+  // Called when another BUFFER_SIZE bytes have been collected in memory, to
+  // write them out or to wait for room for more.
+  std::function<void()> on_memory_full;
+  size_t memory_checked{0};
+  // Cleared once moving data from the input file straight to fd fails.
+  bool zero_copy{true};
+
+  void write_out(struct iovec *iov, int iov_count);
+
+  void write(void const *data, size_t length);
+
+  // Writes input which is at input_offset in input_fd, or is not backed by
+  // a file if input_offset is negative. Large pieces of a file are moved
+  // to the output by the kernel, without copying them through the buffer.
+  void write_from_input(uint8_t const *data, size_t length, int input_fd,
+                        int64_t input_offset);
+
+  // Returns room for length bytes, at most BUFFER_SIZE, at the end of the
+  // buffer, to be written to directly and then added with commit().
+  uint8_t *reserve(size_t length);
+
+  void commit(size_t length);
+
+  void vprintf(char const *fmt, va_list argp);
+
+  void printf(char const *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+  void flush();
+
+  // Returns the number of milliseconds until buffered output is due to be
+  // flushed, or -1 if nothing is buffered.
+  int64_t ms_until_flush() const;
+
+  void flush_if_due();
+};
 
-bool general_category_is_combining(general_category_value_t category);
+// A decoding error noted while decoding a chunk of input in parallel, to be
+// reported in input order once all chunks have been decoded.
+struct deferred_error_t {
+  uint64_t bytes_into_input;
+  // Counted from the start of the chunk:
+  uint64_t codepoints_into_input;
+  size_t output_position;
+  std::string message;
+};
 
-char const *get_block_name(uint32_t codepoint);
+// The state of the decoder between blocks of input.
+struct decoder_state_t {
+  utf_byte_decoder_t utf;
+  // The characters of a textual code point being read.
+  uint8_t state_buffer_position{0};
+  uint8_t state_buffer[16];
+};
 
 struct program_options_t {
   input_format_t input_format{input_format_t::UTF8};
   output_format_t output_format{output_format_t::DESCRIPTION_DECODING};
   error_handling_t error_handling{error_handling_t::REPLACE};
   error_reporting_t error_reporting{error_reporting_t::REPORT_STDERR};
-  normalization_form_t normalization_form{normalization_form_t::NONE};
   bool timestamps{false};
   bool print_summary{false};
   bool output_is_terminal{false};
   bool input_is_terminal{false};
   bool block_info{false};
   bool wcwidth{false};
+  // The number of threads to decode input with.
+  unsigned jobs{1};
 
   struct termios vt_orig;
 
+  int input_fd{STDIN_FILENO};
+  // The name of the input file to report errors in, or empty for stdin.
+  std::string input_name;
+
   uint64_t byte_skip_offset{0};
   uint64_t byte_skip_limit{0};
   uint64_t bytes_into_input{0};
   uint64_t codepoints_into_input{0};
   uint64_t error_count{0};
 
-  std::vector<uint32_t> normalization_non_starters;
+  // Set while decoding a chunk of input, or a file, in parallel with others,
+  // to collect errors in deferred_errors instead of reporting them directly.
+  bool defer_errors{false};
+  std::vector<deferred_error_t> deferred_errors;
+
+  // Set when starting at an offset, which may be in the middle of a
+  // sequence, to silently skip ahead to the start of the next one.
+  bool resync_pending{false};
+
+  normalizer_t normalizer;
+
+  input_reader_t input;
+  output_sink_t output;
 
   bool print_byte_input() const {
     return output_format == output_format_t::DESCRIPTION_DECODING &&
@@ -168,27 +246,74 @@ struct program_options_t {
     return error_handling == error_handling_t::REPLACE;
   }
 
-  void encode_codepoint(uint32_t codepoint, bool output_non_starters = false);
+  // Copies the options given on the command line, except for -j, which
+  // depends on whether the input is split up further.
+  void copy_settings(program_options_t const &other);
+
+  void encode_codepoint(uint32_t codepoint);
+
+  void output_codepoint(uint32_t codepoint);
+
+  void flush_normalization_buffer();
 
-  void flush_normalization_non_starters(std::vector<uint32_t> &non_starters);
+  uint64_t normalize_hangul_utf8(uint8_t const *data, uint64_t length);
+
+  void report_error(uint64_t bytes, uint64_t codepoints, char const *message);
 
   void note_error(int byte, char const *error_msg, ...);
 
+  // Notes an error in input which started at byte_offset, such as a code
+  // unit of which the last byte was just read.
+  void note_error_at(uint64_t byte_offset, char const *error_msg, ...);
+
+  void vnote_error(uint64_t byte_offset, char const *error_msg, va_list argp);
+
   void cleanup_and_exit(int exit_status);
 
   void print_byte_result(int byte, char const *msg, ...);
 
-  void process_utf8_byte(uint8_t byte, uint8_t *utf8_buffer, uint8_t &utf8_pos,
-                       uint8_t &remaining_utf8_continuation_bytes);
+  // Decodes a byte of UTF-8, UTF-16 or UTF-32 input.
+  void process_utf_byte(uint8_t byte, utf_byte_decoder_t &decoder);
+
+  uint64_t skip_valid_utf8(uint8_t const *data, uint64_t length);
+
+  uint64_t skip_valid_utf32(uint8_t const *data, uint64_t length);
 
-  void process_utf16_byte(uint8_t byte, uint8_t *state_buffer, uint8_t &state_pos);
+  uint64_t copy_ascii_utf8(uint8_t const *data, uint64_t length);
 
-  void process_utf32_byte(uint8_t byte, uint8_t *state_buffer, uint8_t &state_pos);
+  uint64_t pass_through_utf8(uint8_t const *data, uint64_t length);
+
+  uint64_t transcode_utf16_32_utf8(uint8_t const *data, uint64_t length);
+
+  uint64_t transcode_utf8_utf16_32(uint8_t const *data, uint64_t length);
 
   void process_textual_codepoint_byte(uint8_t byte, uint8_t *state_buffer,
                                     uint8_t &state_buffer_pos);
 
+  // Decodes a block of input, returning true if the user ended terminal
+  // input.
+  bool decode_block(uint8_t const *data, uint64_t length,
+                    decoder_state_t &state);
+
+  // Decodes a prefix of a large block of input by splitting it into chunks
+  // which are decoded on several threads, returning the length of the
+  // prefix. Only used when the result is the same as decoding sequentially.
+  uint64_t decode_in_parallel(uint8_t const *data, uint64_t length,
+                              decoder_state_t &state);
+
+  // Writes the output which a decoder has collected in memory, with its
+  // deferred errors reported in between, or deferred in turn if this decoder
+  // defers errors, and frees it. Returns true if an error aborts decoding,
+  // in which case only the output before it is written and the caller is to
+  // exit once no other thread is decoding.
+  bool write_deferred_output(program_options_t &decoder,
+                             uint64_t codepoints_before);
+
   void read_and_echo();
+
+  // Decodes files and directories, recursively, printing a summary for each
+  // file when asked to. Returns the exit status.
+  int decode_files(char **paths, int path_count);
 };
 
 #endif
@@ -5,315 +5,619 @@
 struct unicode_block_t {
     uint32_t start;
     uint32_t end;
-    char const* name;
+    uint16_t name_offset;
 };
 
-static unicode_block_t unicode_blocks[] = {
-    { 0x0000, 0x007F, "Basic Latin" },
-    { 0x0080, 0x00FF, "Latin-1 Supplement" },
-    { 0x0100, 0x017F, "Latin Extended-A" },
-    { 0x0180, 0x024F, "Latin Extended-B" },
-    { 0x0250, 0x02AF, "IPA Extensions" },
-    { 0x02B0, 0x02FF, "Spacing Modifier Letters" },
-    { 0x0300, 0x036F, "Combining Diacritical Marks" },
-    { 0x0370, 0x03FF, "Greek and Coptic" },
-    { 0x0400, 0x04FF, "Cyrillic" },
-    { 0x0500, 0x052F, "Cyrillic Supplement" },
-    { 0x0530, 0x058F, "Armenian" },
-    { 0x0590, 0x05FF, "Hebrew" },
-    { 0x0600, 0x06FF, "Arabic" },
-    { 0x0700, 0x074F, "Syriac" },
-    { 0x0750, 0x077F, "Arabic Supplement" },
-    { 0x0780, 0x07BF, "Thaana" },
-    { 0x07C0, 0x07FF, "NKo" },
-    { 0x0800, 0x083F, "Samaritan" },
-    { 0x0840, 0x085F, "Mandaic" },
-    { 0x0860, 0x086F, "Syriac Supplement" },
-    { 0x08A0, 0x08FF, "Arabic Extended-A" },
-    { 0x0900, 0x097F, "Devanagari" },
-    { 0x0980, 0x09FF, "Bengali" },
-    { 0x0A00, 0x0A7F, "Gurmukhi" },
-    { 0x0A80, 0x0AFF, "Gujarati" },
-    { 0x0B00, 0x0B7F, "Oriya" },
-    { 0x0B80, 0x0BFF, "Tamil" },
-    { 0x0C00, 0x0C7F, "Telugu" },
-    { 0x0C80, 0x0CFF, "Kannada" },
-    { 0x0D00, 0x0D7F, "Malayalam" },
-    { 0x0D80, 0x0DFF, "Sinhala" },
-    { 0x0E00, 0x0E7F, "Thai" },
-    { 0x0E80, 0x0EFF, "Lao" },
-    { 0x0F00, 0x0FFF, "Tibetan" },
-    { 0x1000, 0x109F, "Myanmar" },
-    { 0x10A0, 0x10FF, "Georgian" },
-    { 0x1100, 0x11FF, "Hangul Jamo" },
-    { 0x1200, 0x137F, "Ethiopic" },
-    { 0x1380, 0x139F, "Ethiopic Supplement" },
-    { 0x13A0, 0x13FF, "Cherokee" },
-    { 0x1400, 0x167F, "Unified Canadian Aboriginal Syllabics" },
-    { 0x1680, 0x169F, "Ogham" },
-    { 0x16A0, 0x16FF, "Runic" },
-    { 0x1700, 0x171F, "Tagalog" },
-    { 0x1720, 0x173F, "Hanunoo" },
-    { 0x1740, 0x175F, "Buhid" },
-    { 0x1760, 0x177F, "Tagbanwa" },
-    { 0x1780, 0x17FF, "Khmer" },
-    { 0x1800, 0x18AF, "Mongolian" },
-    { 0x18B0, 0x18FF, "Unified Canadian Aboriginal Syllabics Extended" },
-    { 0x1900, 0x194F, "Limbu" },
-    { 0x1950, 0x197F, "Tai Le" },
-    { 0x1980, 0x19DF, "New Tai Lue" },
-    { 0x19E0, 0x19FF, "Khmer Symbols" },
-    { 0x1A00, 0x1A1F, "Buginese" },
-    { 0x1A20, 0x1AAF, "Tai Tham" },
-    { 0x1AB0, 0x1AFF, "Combining Diacritical Marks Extended" },
-    { 0x1B00, 0x1B7F, "Balinese" },
-    { 0x1B80, 0x1BBF, "Sundanese" },
-    { 0x1BC0, 0x1BFF, "Batak" },
-    { 0x1C00, 0x1C4F, "Lepcha" },
-    { 0x1C50, 0x1C7F, "Ol Chiki" },
-    { 0x1C80, 0x1C8F, "Cyrillic Extended-C" },
-    { 0x1C90, 0x1CBF, "Georgian Extended" },
-    { 0x1CC0, 0x1CCF, "Sundanese Supplement" },
-    { 0x1CD0, 0x1CFF, "Vedic Extensions" },
-    { 0x1D00, 0x1D7F, "Phonetic Extensions" },
-    { 0x1D80, 0x1DBF, "Phonetic Extensions Supplement" },
-    { 0x1DC0, 0x1DFF, "Combining Diacritical Marks Supplement" },
-    { 0x1E00, 0x1EFF, "Latin Extended Additional" },
-    { 0x1F00, 0x1FFF, "Greek Extended" },
-    { 0x2000, 0x206F, "General Punctuation" },
-    { 0x2070, 0x209F, "Superscripts and Subscripts" },
-    { 0x20A0, 0x20CF, "Currency Symbols" },
-    { 0x20D0, 0x20FF, "Combining Diacritical Marks for Symbols" },
-    { 0x2100, 0x214F, "Letterlike Symbols" },
-    { 0x2150, 0x218F, "Number Forms" },
-    { 0x2190, 0x21FF, "Arrows" },
-    { 0x2200, 0x22FF, "Mathematical Operators" },
-    { 0x2300, 0x23FF, "Miscellaneous Technical" },
-    { 0x2400, 0x243F, "Control Pictures" },
-    { 0x2440, 0x245F, "Optical Character Recognition" },
-    { 0x2460, 0x24FF, "Enclosed Alphanumerics" },
-    { 0x2500, 0x257F, "Box Drawing" },
-    { 0x2580, 0x259F, "Block Elements" },
-    { 0x25A0, 0x25FF, "Geometric Shapes" },
-    { 0x2600, 0x26FF, "Miscellaneous Symbols" },
-    { 0x2700, 0x27BF, "Dingbats" },
-    { 0x27C0, 0x27EF, "Miscellaneous Mathematical Symbols-A" },
-    { 0x27F0, 0x27FF, "Supplemental Arrows-A" },
-    { 0x2800, 0x28FF, "Braille Patterns" },
-    { 0x2900, 0x297F, "Supplemental Arrows-B" },
-    { 0x2980, 0x29FF, "Miscellaneous Mathematical Symbols-B" },
-    { 0x2A00, 0x2AFF, "Supplemental Mathematical Operators" },
-    { 0x2B00, 0x2BFF, "Miscellaneous Symbols and Arrows" },
-    { 0x2C00, 0x2C5F, "Glagolitic" },
-    { 0x2C60, 0x2C7F, "Latin Extended-C" },
-    { 0x2C80, 0x2CFF, "Coptic" },
-    { 0x2D00, 0x2D2F, "Georgian Supplement" },
-    { 0x2D30, 0x2D7F, "Tifinagh" },
-    { 0x2D80, 0x2DDF, "Ethiopic Extended" },
-    { 0x2DE0, 0x2DFF, "Cyrillic Extended-A" },
-    { 0x2E00, 0x2E7F, "Supplemental Punctuation" },
-    { 0x2E80, 0x2EFF, "CJK Radicals Supplement" },
-    { 0x2F00, 0x2FDF, "Kangxi Radicals" },
-    { 0x2FF0, 0x2FFF, "Ideographic Description Characters" },
-    { 0x3000, 0x303F, "CJK Symbols and Punctuation" },
-    { 0x3040, 0x309F, "Hiragana" },
-    { 0x30A0, 0x30FF, "Katakana" },
-    { 0x3100, 0x312F, "Bopomofo" },
-    { 0x3130, 0x318F, "Hangul Compatibility Jamo" },
-    { 0x3190, 0x319F, "Kanbun" },
-    { 0x31A0, 0x31BF, "Bopomofo Extended" },
-    { 0x31C0, 0x31EF, "CJK Strokes" },
-    { 0x31F0, 0x31FF, "Katakana Phonetic Extensions" },
-    { 0x3200, 0x32FF, "Enclosed CJK Letters and Months" },
-    { 0x3300, 0x33FF, "CJK Compatibility" },
-    { 0x3400, 0x4DBF, "CJK Unified Ideographs Extension A" },
-    { 0x4DC0, 0x4DFF, "Yijing Hexagram Symbols" },
-    { 0x4E00, 0x9FFF, "CJK Unified Ideographs" },
-    { 0xA000, 0xA48F, "Yi Syllables" },
-    { 0xA490, 0xA4CF, "Yi Radicals" },
-    { 0xA4D0, 0xA4FF, "Lisu" },
-    { 0xA500, 0xA63F, "Vai" },
-    { 0xA640, 0xA69F, "Cyrillic Extended-B" },
-    { 0xA6A0, 0xA6FF, "Bamum" },
-    { 0xA700, 0xA71F, "Modifier Tone Letters" },
-    { 0xA720, 0xA7FF, "Latin Extended-D" },
-    { 0xA800, 0xA82F, "Syloti Nagri" },
-    { 0xA830, 0xA83F, "Common Indic Number Forms" },
-    { 0xA840, 0xA87F, "Phags-pa" },
-    { 0xA880, 0xA8DF, "Saurashtra" },
-    { 0xA8E0, 0xA8FF, "Devanagari Extended" },
-    { 0xA900, 0xA92F, "Kayah Li" },
-    { 0xA930, 0xA95F, "Rejang" },
-    { 0xA960, 0xA97F, "Hangul Jamo Extended-A" },
-    { 0xA980, 0xA9DF, "Javanese" },
-    { 0xA9E0, 0xA9FF, "Myanmar Extended-B" },
-    { 0xAA00, 0xAA5F, "Cham" },
-    { 0xAA60, 0xAA7F, "Myanmar Extended-A" },
-    { 0xAA80, 0xAADF, "Tai Viet" },
-    { 0xAAE0, 0xAAFF, "Meetei Mayek Extensions" },
-    { 0xAB00, 0xAB2F, "Ethiopic Extended-A" },
-    { 0xAB30, 0xAB6F, "Latin Extended-E" },
-    { 0xAB70, 0xABBF, "Cherokee Supplement" },
-    { 0xABC0, 0xABFF, "Meetei Mayek" },
-    { 0xAC00, 0xD7AF, "Hangul Syllables" },
-    { 0xD7B0, 0xD7FF, "Hangul Jamo Extended-B" },
-    { 0xD800, 0xDB7F, "High Surrogates" },
-    { 0xDB80, 0xDBFF, "High Private Use Surrogates" },
-    { 0xDC00, 0xDFFF, "Low Surrogates" },
-    { 0xE000, 0xF8FF, "Private Use Area" },
-    { 0xF900, 0xFAFF, "CJK Compatibility Ideographs" },
-    { 0xFB00, 0xFB4F, "Alphabetic Presentation Forms" },
-    { 0xFB50, 0xFDFF, "Arabic Presentation Forms-A" },
-    { 0xFE00, 0xFE0F, "Variation Selectors" },
-    { 0xFE10, 0xFE1F, "Vertical Forms" },
-    { 0xFE20, 0xFE2F, "Combining Half Marks" },
-    { 0xFE30, 0xFE4F, "CJK Compatibility Forms" },
-    { 0xFE50, 0xFE6F, "Small Form Variants" },
-    { 0xFE70, 0xFEFF, "Arabic Presentation Forms-B" },
-    { 0xFF00, 0xFFEF, "Halfwidth and Fullwidth Forms" },
-    { 0xFFF0, 0xFFFF, "Specials" },
-    { 0x10000, 0x1007F, "Linear B Syllabary" },
-    { 0x10080, 0x100FF, "Linear B Ideograms" },
-    { 0x10100, 0x1013F, "Aegean Numbers" },
-    { 0x10140, 0x1018F, "Ancient Greek Numbers" },
-    { 0x10190, 0x101CF, "Ancient Symbols" },
-    { 0x101D0, 0x101FF, "Phaistos Disc" },
-    { 0x10280, 0x1029F, "Lycian" },
-    { 0x102A0, 0x102DF, "Carian" },
-    { 0x102E0, 0x102FF, "Coptic Epact Numbers" },
-    { 0x10300, 0x1032F, "Old Italic" },
-    { 0x10330, 0x1034F, "Gothic" },
-    { 0x10350, 0x1037F, "Old Permic" },
-    { 0x10380, 0x1039F, "Ugaritic" },
-    { 0x103A0, 0x103DF, "Old Persian" },
-    { 0x10400, 0x1044F, "Deseret" },
-    { 0x10450, 0x1047F, "Shavian" },
-    { 0x10480, 0x104AF, "Osmanya" },
-    { 0x104B0, 0x104FF, "Osage" },
-    { 0x10500, 0x1052F, "Elbasan" },
-    { 0x10530, 0x1056F, "Caucasian Albanian" },
-    { 0x10600, 0x1077F, "Linear A" },
-    { 0x10800, 0x1083F, "Cypriot Syllabary" },
-    { 0x10840, 0x1085F, "Imperial Aramaic" },
-    { 0x10860, 0x1087F, "Palmyrene" },
-    { 0x10880, 0x108AF, "Nabataean" },
-    { 0x108E0, 0x108FF, "Hatran" },
-    { 0x10900, 0x1091F, "Phoenician" },
-    { 0x10920, 0x1093F, "Lydian" },
-    { 0x10980, 0x1099F, "Meroitic Hieroglyphs" },
-    { 0x109A0, 0x109FF, "Meroitic Cursive" },
-    { 0x10A00, 0x10A5F, "Kharoshthi" },
-    { 0x10A60, 0x10A7F, "Old South Arabian" },
-    { 0x10A80, 0x10A9F, "Old North Arabian" },
-    { 0x10AC0, 0x10AFF, "Manichaean" },
-    { 0x10B00, 0x10B3F, "Avestan" },
-    { 0x10B40, 0x10B5F, "Inscriptional Parthian" },
-    { 0x10B60, 0x10B7F, "Inscriptional Pahlavi" },
-    { 0x10B80, 0x10BAF, "Psalter Pahlavi" },
-    { 0x10C00, 0x10C4F, "Old Turkic" },
-    { 0x10C80, 0x10CFF, "Old Hungarian" },
-    { 0x10D00, 0x10D3F, "Hanifi Rohingya" },
-    { 0x10E60, 0x10E7F, "Rumi Numeral Symbols" },
-    { 0x10F00, 0x10F2F, "Old Sogdian" },
-    { 0x10F30, 0x10F6F, "Sogdian" },
-    { 0x10FE0, 0x10FFF, "Elymaic" },
-    { 0x11000, 0x1107F, "Brahmi" },
-    { 0x11080, 0x110CF, "Kaithi" },
-    { 0x110D0, 0x110FF, "Sora Sompeng" },
-    { 0x11100, 0x1114F, "Chakma" },
-    { 0x11150, 0x1117F, "Mahajani" },
-    { 0x11180, 0x111DF, "Sharada" },
-    { 0x111E0, 0x111FF, "Sinhala Archaic Numbers" },
-    { 0x11200, 0x1124F, "Khojki" },
-    { 0x11280, 0x112AF, "Multani" },
-    { 0x112B0, 0x112FF, "Khudawadi" },
-    { 0x11300, 0x1137F, "Grantha" },
-    { 0x11400, 0x1147F, "Newa" },
-    { 0x11480, 0x114DF, "Tirhuta" },
-    { 0x11580, 0x115FF, "Siddham" },
-    { 0x11600, 0x1165F, "Modi" },
-    { 0x11660, 0x1167F, "Mongolian Supplement" },
-    { 0x11680, 0x116CF, "Takri" },
-    { 0x11700, 0x1173F, "Ahom" },
-    { 0x11800, 0x1184F, "Dogra" },
-    { 0x118A0, 0x118FF, "Warang Citi" },
-    { 0x119A0, 0x119FF, "Nandinagari" },
-    { 0x11A00, 0x11A4F, "Zanabazar Square" },
-    { 0x11A50, 0x11AAF, "Soyombo" },
-    { 0x11AC0, 0x11AFF, "Pau Cin Hau" },
-    { 0x11C00, 0x11C6F, "Bhaiksuki" },
-    { 0x11C70, 0x11CBF, "Marchen" },
-    { 0x11D00, 0x11D5F, "Masaram Gondi" },
-    { 0x11D60, 0x11DAF, "Gunjala Gondi" },
-    { 0x11EE0, 0x11EFF, "Makasar" },
-    { 0x11FC0, 0x11FFF, "Tamil Supplement" },
-    { 0x12000, 0x123FF, "Cuneiform" },
-    { 0x12400, 0x1247F, "Cuneiform Numbers and Punctuation" },
-    { 0x12480, 0x1254F, "Early Dynastic Cuneiform" },
-    { 0x13000, 0x1342F, "Egyptian Hieroglyphs" },
-    { 0x13430, 0x1343F, "Egyptian Hieroglyph Format Controls" },
-    { 0x14400, 0x1467F, "Anatolian Hieroglyphs" },
-    { 0x16800, 0x16A3F, "Bamum Supplement" },
-    { 0x16A40, 0x16A6F, "Mro" },
-    { 0x16AD0, 0x16AFF, "Bassa Vah" },
-    { 0x16B00, 0x16B8F, "Pahawh Hmong" },
-    { 0x16E40, 0x16E9F, "Medefaidrin" },
-    { 0x16F00, 0x16F9F, "Miao" },
-    { 0x16FE0, 0x16FFF, "Ideographic Symbols and Punctuation" },
-    { 0x17000, 0x187FF, "Tangut" },
-    { 0x18800, 0x18AFF, "Tangut Components" },
-    { 0x1B000, 0x1B0FF, "Kana Supplement" },
-    { 0x1B100, 0x1B12F, "Kana Extended-A" },
-    { 0x1B130, 0x1B16F, "Small Kana Extension" },
-    { 0x1B170, 0x1B2FF, "Nushu" },
-    { 0x1BC00, 0x1BC9F, "Duployan" },
-    { 0x1BCA0, 0x1BCAF, "Shorthand Format Controls" },
-    { 0x1D000, 0x1D0FF, "Byzantine Musical Symbols" },
-    { 0x1D100, 0x1D1FF, "Musical Symbols" },
-    { 0x1D200, 0x1D24F, "Ancient Greek Musical Notation" },
-    { 0x1D2E0, 0x1D2FF, "Mayan Numerals" },
-    { 0x1D300, 0x1D35F, "Tai Xuan Jing Symbols" },
-    { 0x1D360, 0x1D37F, "Counting Rod Numerals" },
-    { 0x1D400, 0x1D7FF, "Mathematical Alphanumeric Symbols" },
-    { 0x1D800, 0x1DAAF, "Sutton SignWriting" },
-    { 0x1E000, 0x1E02F, "Glagolitic Supplement" },
-    { 0x1E100, 0x1E14F, "Nyiakeng Puachue Hmong" },
-    { 0x1E2C0, 0x1E2FF, "Wancho" },
-    { 0x1E800, 0x1E8DF, "Mende Kikakui" },
-    { 0x1E900, 0x1E95F, "Adlam" },
-    { 0x1EC70, 0x1ECBF, "Indic Siyaq Numbers" },
-    { 0x1ED00, 0x1ED4F, "Ottoman Siyaq Numbers" },
-    { 0x1EE00, 0x1EEFF, "Arabic Mathematical Alphabetic Symbols" },
-    { 0x1F000, 0x1F02F, "Mahjong Tiles" },
-    { 0x1F030, 0x1F09F, "Domino Tiles" },
-    { 0x1F0A0, 0x1F0FF, "Playing Cards" },
-    { 0x1F100, 0x1F1FF, "Enclosed Alphanumeric Supplement" },
-    { 0x1F200, 0x1F2FF, "Enclosed Ideographic Supplement" },
-    { 0x1F300, 0x1F5FF, "Miscellaneous Symbols and Pictographs" },
-    { 0x1F600, 0x1F64F, "Emoticons" },
-    { 0x1F650, 0x1F67F, "Ornamental Dingbats" },
-    { 0x1F680, 0x1F6FF, "Transport and Map Symbols" },
-    { 0x1F700, 0x1F77F, "Alchemical Symbols" },
-    { 0x1F780, 0x1F7FF, "Geometric Shapes Extended" },
-    { 0x1F800, 0x1F8FF, "Supplemental Arrows-C" },
-    { 0x1F900, 0x1F9FF, "Supplemental Symbols and Pictographs" },
-    { 0x1FA00, 0x1FA6F, "Chess Symbols" },
-    { 0x1FA70, 0x1FAFF, "Symbols and Pictographs Extended-A" },
-    { 0x20000, 0x2A6DF, "CJK Unified Ideographs Extension B" },
-    { 0x2A700, 0x2B73F, "CJK Unified Ideographs Extension C" },
-    { 0x2B740, 0x2B81F, "CJK Unified Ideographs Extension D" },
-    { 0x2B820, 0x2CEAF, "CJK Unified Ideographs Extension E" },
-    { 0x2CEB0, 0x2EBEF, "CJK Unified Ideographs Extension F" },
-    { 0x2F800, 0x2FA1F, "CJK Compatibility Ideographs Supplement" },
-    { 0xE0000, 0xE007F, "Tags" },
-    { 0xE0100, 0xE01EF, "Variation Selectors Supplement" },
-    { 0xF0000, 0xFFFFF, "Supplementary Private Use Area-A" },
-    { 0x100000, 0x10FFFF, "Supplementary Private Use Area-B" },
+static constexpr unicode_block_t unicode_blocks[] = {
+    { 0x0000, 0x007F, 0 },
+    { 0x0080, 0x00FF, 12 },
+    { 0x0100, 0x017F, 31 },
+    { 0x0180, 0x024F, 48 },
+    { 0x0250, 0x02AF, 65 },
+    { 0x02B0, 0x02FF, 80 },
+    { 0x0300, 0x036F, 105 },
+    { 0x0370, 0x03FF, 133 },
+    { 0x0400, 0x04FF, 150 },
+    { 0x0500, 0x052F, 159 },
+    { 0x0530, 0x058F, 179 },
+    { 0x0590, 0x05FF, 188 },
+    { 0x0600, 0x06FF, 195 },
+    { 0x0700, 0x074F, 202 },
+    { 0x0750, 0x077F, 209 },
+    { 0x0780, 0x07BF, 227 },
+    { 0x07C0, 0x07FF, 234 },
+    { 0x0800, 0x083F, 238 },
+    { 0x0840, 0x085F, 248 },
+    { 0x0860, 0x086F, 256 },
+    { 0x08A0, 0x08FF, 274 },
+    { 0x0900, 0x097F, 292 },
+    { 0x0980, 0x09FF, 303 },
+    { 0x0A00, 0x0A7F, 311 },
+    { 0x0A80, 0x0AFF, 320 },
+    { 0x0B00, 0x0B7F, 329 },
+    { 0x0B80, 0x0BFF, 335 },
+    { 0x0C00, 0x0C7F, 341 },
+    { 0x0C80, 0x0CFF, 348 },
+    { 0x0D00, 0x0D7F, 356 },
+    { 0x0D80, 0x0DFF, 366 },
+    { 0x0E00, 0x0E7F, 374 },
+    { 0x0E80, 0x0EFF, 379 },
+    { 0x0F00, 0x0FFF, 383 },
+    { 0x1000, 0x109F, 391 },
+    { 0x10A0, 0x10FF, 399 },
+    { 0x1100, 0x11FF, 408 },
+    { 0x1200, 0x137F, 420 },
+    { 0x1380, 0x139F, 429 },
+    { 0x13A0, 0x13FF, 449 },
+    { 0x1400, 0x167F, 458 },
+    { 0x1680, 0x169F, 496 },
+    { 0x16A0, 0x16FF, 502 },
+    { 0x1700, 0x171F, 508 },
+    { 0x1720, 0x173F, 516 },
+    { 0x1740, 0x175F, 524 },
+    { 0x1760, 0x177F, 530 },
+    { 0x1780, 0x17FF, 539 },
+    { 0x1800, 0x18AF, 545 },
+    { 0x18B0, 0x18FF, 555 },
+    { 0x1900, 0x194F, 602 },
+    { 0x1950, 0x197F, 608 },
+    { 0x1980, 0x19DF, 615 },
+    { 0x19E0, 0x19FF, 627 },
+    { 0x1A00, 0x1A1F, 641 },
+    { 0x1A20, 0x1AAF, 650 },
+    { 0x1AB0, 0x1AFF, 659 },
+    { 0x1B00, 0x1B7F, 696 },
+    { 0x1B80, 0x1BBF, 705 },
+    { 0x1BC0, 0x1BFF, 715 },
+    { 0x1C00, 0x1C4F, 721 },
+    { 0x1C50, 0x1C7F, 728 },
+    { 0x1C80, 0x1C8F, 737 },
+    { 0x1C90, 0x1CBF, 757 },
+    { 0x1CC0, 0x1CCF, 775 },
+    { 0x1CD0, 0x1CFF, 796 },
+    { 0x1D00, 0x1D7F, 813 },
+    { 0x1D80, 0x1DBF, 833 },
+    { 0x1DC0, 0x1DFF, 864 },
+    { 0x1E00, 0x1EFF, 903 },
+    { 0x1F00, 0x1FFF, 929 },
+    { 0x2000, 0x206F, 944 },
+    { 0x2070, 0x209F, 964 },
+    { 0x20A0, 0x20CF, 992 },
+    { 0x20D0, 0x20FF, 1009 },
+    { 0x2100, 0x214F, 1049 },
+    { 0x2150, 0x218F, 1068 },
+    { 0x2190, 0x21FF, 1081 },
+    { 0x2200, 0x22FF, 1088 },
+    { 0x2300, 0x23FF, 1111 },
+    { 0x2400, 0x243F, 1135 },
+    { 0x2440, 0x245F, 1152 },
+    { 0x2460, 0x24FF, 1182 },
+    { 0x2500, 0x257F, 1205 },
+    { 0x2580, 0x259F, 1217 },
+    { 0x25A0, 0x25FF, 1232 },
+    { 0x2600, 0x26FF, 1249 },
+    { 0x2700, 0x27BF, 1271 },
+    { 0x27C0, 0x27EF, 1280 },
+    { 0x27F0, 0x27FF, 1317 },
+    { 0x2800, 0x28FF, 1339 },
+    { 0x2900, 0x297F, 1356 },
+    { 0x2980, 0x29FF, 1378 },
+    { 0x2A00, 0x2AFF, 1415 },
+    { 0x2B00, 0x2BFF, 1451 },
+    { 0x2C00, 0x2C5F, 1484 },
+    { 0x2C60, 0x2C7F, 1495 },
+    { 0x2C80, 0x2CFF, 1512 },
+    { 0x2D00, 0x2D2F, 1519 },
+    { 0x2D30, 0x2D7F, 1539 },
+    { 0x2D80, 0x2DDF, 1548 },
+    { 0x2DE0, 0x2DFF, 1566 },
+    { 0x2E00, 0x2E7F, 1586 },
+    { 0x2E80, 0x2EFF, 1611 },
+    { 0x2F00, 0x2FDF, 1635 },
+    { 0x2FF0, 0x2FFF, 1651 },
+    { 0x3000, 0x303F, 1686 },
+    { 0x3040, 0x309F, 1714 },
+    { 0x30A0, 0x30FF, 1723 },
+    { 0x3100, 0x312F, 1732 },
+    { 0x3130, 0x318F, 1741 },
+    { 0x3190, 0x319F, 1767 },
+    { 0x31A0, 0x31BF, 1774 },
+    { 0x31C0, 0x31EF, 1792 },
+    { 0x31F0, 0x31FF, 1804 },
+    { 0x3200, 0x32FF, 1833 },
+    { 0x3300, 0x33FF, 1865 },
+    { 0x3400, 0x4DBF, 1883 },
+    { 0x4DC0, 0x4DFF, 1918 },
+    { 0x4E00, 0x9FFF, 1942 },
+    { 0xA000, 0xA48F, 1965 },
+    { 0xA490, 0xA4CF, 1978 },
+    { 0xA4D0, 0xA4FF, 1990 },
+    { 0xA500, 0xA63F, 1995 },
+    { 0xA640, 0xA69F, 1999 },
+    { 0xA6A0, 0xA6FF, 2019 },
+    { 0xA700, 0xA71F, 2025 },
+    { 0xA720, 0xA7FF, 2047 },
+    { 0xA800, 0xA82F, 2064 },
+    { 0xA830, 0xA83F, 2077 },
+    { 0xA840, 0xA87F, 2103 },
+    { 0xA880, 0xA8DF, 2112 },
+    { 0xA8E0, 0xA8FF, 2123 },
+    { 0xA900, 0xA92F, 2143 },
+    { 0xA930, 0xA95F, 2152 },
+    { 0xA960, 0xA97F, 2159 },
+    { 0xA980, 0xA9DF, 2182 },
+    { 0xA9E0, 0xA9FF, 2191 },
+    { 0xAA00, 0xAA5F, 2210 },
+    { 0xAA60, 0xAA7F, 2215 },
+    { 0xAA80, 0xAADF, 2234 },
+    { 0xAAE0, 0xAAFF, 2243 },
+    { 0xAB00, 0xAB2F, 2267 },
+    { 0xAB30, 0xAB6F, 2287 },
+    { 0xAB70, 0xABBF, 2304 },
+    { 0xABC0, 0xABFF, 2324 },
+    { 0xAC00, 0xD7AF, 2337 },
+    { 0xD7B0, 0xD7FF, 2354 },
+    { 0xD800, 0xDB7F, 2377 },
+    { 0xDB80, 0xDBFF, 2393 },
+    { 0xDC00, 0xDFFF, 2421 },
+    { 0xE000, 0xF8FF, 2436 },
+    { 0xF900, 0xFAFF, 2453 },
+    { 0xFB00, 0xFB4F, 2482 },
+    { 0xFB50, 0xFDFF, 2512 },
+    { 0xFE00, 0xFE0F, 2540 },
+    { 0xFE10, 0xFE1F, 2560 },
+    { 0xFE20, 0xFE2F, 2575 },
+    { 0xFE30, 0xFE4F, 2596 },
+    { 0xFE50, 0xFE6F, 2620 },
+    { 0xFE70, 0xFEFF, 2640 },
+    { 0xFF00, 0xFFEF, 2668 },
+    { 0xFFF0, 0xFFFF, 2698 },
+    { 0x10000, 0x1007F, 2707 },
+    { 0x10080, 0x100FF, 2726 },
+    { 0x10100, 0x1013F, 2745 },
+    { 0x10140, 0x1018F, 2760 },
+    { 0x10190, 0x101CF, 2782 },
+    { 0x101D0, 0x101FF, 2798 },
+    { 0x10280, 0x1029F, 2812 },
+    { 0x102A0, 0x102DF, 2819 },
+    { 0x102E0, 0x102FF, 2826 },
+    { 0x10300, 0x1032F, 2847 },
+    { 0x10330, 0x1034F, 2858 },
+    { 0x10350, 0x1037F, 2865 },
+    { 0x10380, 0x1039F, 2876 },
+    { 0x103A0, 0x103DF, 2885 },
+    { 0x10400, 0x1044F, 2897 },
+    { 0x10450, 0x1047F, 2905 },
+    { 0x10480, 0x104AF, 2913 },
+    { 0x104B0, 0x104FF, 2921 },
+    { 0x10500, 0x1052F, 2927 },
+    { 0x10530, 0x1056F, 2935 },
+    { 0x10600, 0x1077F, 2954 },
+    { 0x10800, 0x1083F, 2963 },
+    { 0x10840, 0x1085F, 2981 },
+    { 0x10860, 0x1087F, 2998 },
+    { 0x10880, 0x108AF, 3008 },
+    { 0x108E0, 0x108FF, 3018 },
+    { 0x10900, 0x1091F, 3025 },
+    { 0x10920, 0x1093F, 3036 },
+    { 0x10980, 0x1099F, 3043 },
+    { 0x109A0, 0x109FF, 3064 },
+    { 0x10A00, 0x10A5F, 3081 },
+    { 0x10A60, 0x10A7F, 3092 },
+    { 0x10A80, 0x10A9F, 3110 },
+    { 0x10AC0, 0x10AFF, 3128 },
+    { 0x10B00, 0x10B3F, 3139 },
+    { 0x10B40, 0x10B5F, 3147 },
+    { 0x10B60, 0x10B7F, 3170 },
+    { 0x10B80, 0x10BAF, 3192 },
+    { 0x10C00, 0x10C4F, 3208 },
+    { 0x10C80, 0x10CFF, 3219 },
+    { 0x10D00, 0x10D3F, 3233 },
+    { 0x10E60, 0x10E7F, 3249 },
+    { 0x10F00, 0x10F2F, 3270 },
+    { 0x10F30, 0x10F6F, 3282 },
+    { 0x10FE0, 0x10FFF, 3290 },
+    { 0x11000, 0x1107F, 3298 },
+    { 0x11080, 0x110CF, 3305 },
+    { 0x110D0, 0x110FF, 3312 },
+    { 0x11100, 0x1114F, 3325 },
+    { 0x11150, 0x1117F, 3332 },
+    { 0x11180, 0x111DF, 3341 },
+    { 0x111E0, 0x111FF, 3349 },
+    { 0x11200, 0x1124F, 3373 },
+    { 0x11280, 0x112AF, 3380 },
+    { 0x112B0, 0x112FF, 3388 },
+    { 0x11300, 0x1137F, 3398 },
+    { 0x11400, 0x1147F, 3406 },
+    { 0x11480, 0x114DF, 3411 },
+    { 0x11580, 0x115FF, 3419 },
+    { 0x11600, 0x1165F, 3427 },
+    { 0x11660, 0x1167F, 3432 },
+    { 0x11680, 0x116CF, 3453 },
+    { 0x11700, 0x1173F, 3459 },
+    { 0x11800, 0x1184F, 3464 },
+    { 0x118A0, 0x118FF, 3470 },
+    { 0x119A0, 0x119FF, 3482 },
+    { 0x11A00, 0x11A4F, 3494 },
+    { 0x11A50, 0x11AAF, 3511 },
+    { 0x11AC0, 0x11AFF, 3519 },
+    { 0x11C00, 0x11C6F, 3531 },
+    { 0x11C70, 0x11CBF, 3541 },
+    { 0x11D00, 0x11D5F, 3549 },
+    { 0x11D60, 0x11DAF, 3563 },
+    { 0x11EE0, 0x11EFF, 3577 },
+    { 0x11FC0, 0x11FFF, 3585 },
+    { 0x12000, 0x123FF, 3602 },
+    { 0x12400, 0x1247F, 3612 },
+    { 0x12480, 0x1254F, 3646 },
+    { 0x13000, 0x1342F, 3671 },
+    { 0x13430, 0x1343F, 3692 },
+    { 0x14400, 0x1467F, 3728 },
+    { 0x16800, 0x16A3F, 3750 },
+    { 0x16A40, 0x16A6F, 3767 },
+    { 0x16AD0, 0x16AFF, 3771 },
+    { 0x16B00, 0x16B8F, 3781 },
+    { 0x16E40, 0x16E9F, 3794 },
+    { 0x16F00, 0x16F9F, 3806 },
+    { 0x16FE0, 0x16FFF, 3811 },
+    { 0x17000, 0x187FF, 3847 },
+    { 0x18800, 0x18AFF, 3854 },
+    { 0x1B000, 0x1B0FF, 3872 },
+    { 0x1B100, 0x1B12F, 3888 },
+    { 0x1B130, 0x1B16F, 3904 },
+    { 0x1B170, 0x1B2FF, 3925 },
+    { 0x1BC00, 0x1BC9F, 3931 },
+    { 0x1BCA0, 0x1BCAF, 3940 },
+    { 0x1D000, 0x1D0FF, 3966 },
+    { 0x1D100, 0x1D1FF, 3992 },
+    { 0x1D200, 0x1D24F, 4008 },
+    { 0x1D2E0, 0x1D2FF, 4039 },
+    { 0x1D300, 0x1D35F, 4054 },
+    { 0x1D360, 0x1D37F, 4076 },
+    { 0x1D400, 0x1D7FF, 4098 },
+    { 0x1D800, 0x1DAAF, 4132 },
+    { 0x1E000, 0x1E02F, 4151 },
+    { 0x1E100, 0x1E14F, 4173 },
+    { 0x1E2C0, 0x1E2FF, 4196 },
+    { 0x1E800, 0x1E8DF, 4203 },
+    { 0x1E900, 0x1E95F, 4217 },
+    { 0x1EC70, 0x1ECBF, 4223 },
+    { 0x1ED00, 0x1ED4F, 4243 },
+    { 0x1EE00, 0x1EEFF, 4265 },
+    { 0x1F000, 0x1F02F, 4304 },
+    { 0x1F030, 0x1F09F, 4318 },
+    { 0x1F0A0, 0x1F0FF, 4331 },
+    { 0x1F100, 0x1F1FF, 4345 },
+    { 0x1F200, 0x1F2FF, 4378 },
+    { 0x1F300, 0x1F5FF, 4410 },
+    { 0x1F600, 0x1F64F, 4448 },
+    { 0x1F650, 0x1F67F, 4458 },
+    { 0x1F680, 0x1F6FF, 4478 },
+    { 0x1F700, 0x1F77F, 4504 },
+    { 0x1F780, 0x1F7FF, 4523 },
+    { 0x1F800, 0x1F8FF, 4549 },
+    { 0x1F900, 0x1F9FF, 4571 },
+    { 0x1FA00, 0x1FA6F, 4608 },
+    { 0x1FA70, 0x1FAFF, 4622 },
+    { 0x20000, 0x2A6DF, 4657 },
+    { 0x2A700, 0x2B73F, 4692 },
+    { 0x2B740, 0x2B81F, 4727 },
+    { 0x2B820, 0x2CEAF, 4762 },
+    { 0x2CEB0, 0x2EBEF, 4797 },
+    { 0x2F800, 0x2FA1F, 4832 },
+    { 0xE0000, 0xE007F, 4872 },
+    { 0xE0100, 0xE01EF, 4877 },
+    { 0xF0000, 0xFFFFF, 4908 },
+    { 0x100000, 0x10FFFF, 4941 },
 };
+
+static constexpr char unicode_block_names[] =
+    "Basic Latin\0"
+    "Latin-1 Supplement\0"
+    "Latin Extended-A\0"
+    "Latin Extended-B\0"
+    "IPA Extensions\0"
+    "Spacing Modifier Letters\0"
+    "Combining Diacritical Marks\0"
+    "Greek and Coptic\0"
+    "Cyrillic\0"
+    "Cyrillic Supplement\0"
+    "Armenian\0"
+    "Hebrew\0"
+    "Arabic\0"
+    "Syriac\0"
+    "Arabic Supplement\0"
+    "Thaana\0"
+    "NKo\0"
+    "Samaritan\0"
+    "Mandaic\0"
+    "Syriac Supplement\0"
+    "Arabic Extended-A\0"
+    "Devanagari\0"
+    "Bengali\0"
+    "Gurmukhi\0"
+    "Gujarati\0"
+    "Oriya\0"
+    "Tamil\0"
+    "Telugu\0"
+    "Kannada\0"
+    "Malayalam\0"
+    "Sinhala\0"
+    "Thai\0"
+    "Lao\0"
+    "Tibetan\0"
+    "Myanmar\0"
+    "Georgian\0"
+    "Hangul Jamo\0"
+    "Ethiopic\0"
+    "Ethiopic Supplement\0"
+    "Cherokee\0"
+    "Unified Canadian Aboriginal Syllabics\0"
+    "Ogham\0"
+    "Runic\0"
+    "Tagalog\0"
+    "Hanunoo\0"
+    "Buhid\0"
+    "Tagbanwa\0"
+    "Khmer\0"
+    "Mongolian\0"
+    "Unified Canadian Aboriginal Syllabics Extended\0"
+    "Limbu\0"
+    "Tai Le\0"
+    "New Tai Lue\0"
+    "Khmer Symbols\0"
+    "Buginese\0"
+    "Tai Tham\0"
+    "Combining Diacritical Marks Extended\0"
+    "Balinese\0"
+    "Sundanese\0"
+    "Batak\0"
+    "Lepcha\0"
+    "Ol Chiki\0"
+    "Cyrillic Extended-C\0"
+    "Georgian Extended\0"
+    "Sundanese Supplement\0"
+    "Vedic Extensions\0"
+    "Phonetic Extensions\0"
+    "Phonetic Extensions Supplement\0"
+    "Combining Diacritical Marks Supplement\0"
+    "Latin Extended Additional\0"
+    "Greek Extended\0"
+    "General Punctuation\0"
+    "Superscripts and Subscripts\0"
+    "Currency Symbols\0"
+    "Combining Diacritical Marks for Symbols\0"
+    "Letterlike Symbols\0"
+    "Number Forms\0"
+    "Arrows\0"
+    "Mathematical Operators\0"
+    "Miscellaneous Technical\0"
+    "Control Pictures\0"
+    "Optical Character Recognition\0"
+    "Enclosed Alphanumerics\0"
+    "Box Drawing\0"
+    "Block Elements\0"
+    "Geometric Shapes\0"
+    "Miscellaneous Symbols\0"
+    "Dingbats\0"
+    "Miscellaneous Mathematical Symbols-A\0"
+    "Supplemental Arrows-A\0"
+    "Braille Patterns\0"
+    "Supplemental Arrows-B\0"
+    "Miscellaneous Mathematical Symbols-B\0"
+    "Supplemental Mathematical Operators\0"
+    "Miscellaneous Symbols and Arrows\0"
+    "Glagolitic\0"
+    "Latin Extended-C\0"
+    "Coptic\0"
+    "Georgian Supplement\0"
+    "Tifinagh\0"
+    "Ethiopic Extended\0"
+    "Cyrillic Extended-A\0"
+    "Supplemental Punctuation\0"
+    "CJK Radicals Supplement\0"
+    "Kangxi Radicals\0"
+    "Ideographic Description Characters\0"
+    "CJK Symbols and Punctuation\0"
+    "Hiragana\0"
+    "Katakana\0"
+    "Bopomofo\0"
+    "Hangul Compatibility Jamo\0"
+    "Kanbun\0"
+    "Bopomofo Extended\0"
+    "CJK Strokes\0"
+    "Katakana Phonetic Extensions\0"
+    "Enclosed CJK Letters and Months\0"
+    "CJK Compatibility\0"
+    "CJK Unified Ideographs Extension A\0"
+    "Yijing Hexagram Symbols\0"
+    "CJK Unified Ideographs\0"
+    "Yi Syllables\0"
+    "Yi Radicals\0"
+    "Lisu\0"
+    "Vai\0"
+    "Cyrillic Extended-B\0"
+    "Bamum\0"
+    "Modifier Tone Letters\0"
+    "Latin Extended-D\0"
+    "Syloti Nagri\0"
+    "Common Indic Number Forms\0"
+    "Phags-pa\0"
+    "Saurashtra\0"
+    "Devanagari Extended\0"
+    "Kayah Li\0"
+    "Rejang\0"
+    "Hangul Jamo Extended-A\0"
+    "Javanese\0"
+    "Myanmar Extended-B\0"
+    "Cham\0"
+    "Myanmar Extended-A\0"
+    "Tai Viet\0"
+    "Meetei Mayek Extensions\0"
+    "Ethiopic Extended-A\0"
+    "Latin Extended-E\0"
+    "Cherokee Supplement\0"
+    "Meetei Mayek\0"
+    "Hangul Syllables\0"
+    "Hangul Jamo Extended-B\0"
+    "High Surrogates\0"
+    "High Private Use Surrogates\0"
+    "Low Surrogates\0"
+    "Private Use Area\0"
+    "CJK Compatibility Ideographs\0"
+    "Alphabetic Presentation Forms\0"
+    "Arabic Presentation Forms-A\0"
+    "Variation Selectors\0"
+    "Vertical Forms\0"
+    "Combining Half Marks\0"
+    "CJK Compatibility Forms\0"
+    "Small Form Variants\0"
+    "Arabic Presentation Forms-B\0"
+    "Halfwidth and Fullwidth Forms\0"
+    "Specials\0"
+    "Linear B Syllabary\0"
+    "Linear B Ideograms\0"
+    "Aegean Numbers\0"
+    "Ancient Greek Numbers\0"
+    "Ancient Symbols\0"
+    "Phaistos Disc\0"
+    "Lycian\0"
+    "Carian\0"
+    "Coptic Epact Numbers\0"
+    "Old Italic\0"
+    "Gothic\0"
+    "Old Permic\0"
+    "Ugaritic\0"
+    "Old Persian\0"
+    "Deseret\0"
+    "Shavian\0"
+    "Osmanya\0"
+    "Osage\0"
+    "Elbasan\0"
+    "Caucasian Albanian\0"
+    "Linear A\0"
+    "Cypriot Syllabary\0"
+    "Imperial Aramaic\0"
+    "Palmyrene\0"
+    "Nabataean\0"
+    "Hatran\0"
+    "Phoenician\0"
+    "Lydian\0"
+    "Meroitic Hieroglyphs\0"
+    "Meroitic Cursive\0"
+    "Kharoshthi\0"
+    "Old South Arabian\0"
+    "Old North Arabian\0"
+    "Manichaean\0"
+    "Avestan\0"
+    "Inscriptional Parthian\0"
+    "Inscriptional Pahlavi\0"
+    "Psalter Pahlavi\0"
+    "Old Turkic\0"
+    "Old Hungarian\0"
+    "Hanifi Rohingya\0"
+    "Rumi Numeral Symbols\0"
+    "Old Sogdian\0"
+    "Sogdian\0"
+    "Elymaic\0"
+    "Brahmi\0"
+    "Kaithi\0"
+    "Sora Sompeng\0"
+    "Chakma\0"
+    "Mahajani\0"
+    "Sharada\0"
+    "Sinhala Archaic Numbers\0"
+    "Khojki\0"
+    "Multani\0"
+    "Khudawadi\0"
+    "Grantha\0"
+    "Newa\0"
+    "Tirhuta\0"
+    "Siddham\0"
+    "Modi\0"
+    "Mongolian Supplement\0"
+    "Takri\0"
+    "Ahom\0"
+    "Dogra\0"
+    "Warang Citi\0"
+    "Nandinagari\0"
+    "Zanabazar Square\0"
+    "Soyombo\0"
+    "Pau Cin Hau\0"
+    "Bhaiksuki\0"
+    "Marchen\0"
+    "Masaram Gondi\0"
+    "Gunjala Gondi\0"
+    "Makasar\0"
+    "Tamil Supplement\0"
+    "Cuneiform\0"
+    "Cuneiform Numbers and Punctuation\0"
+    "Early Dynastic Cuneiform\0"
+    "Egyptian Hieroglyphs\0"
+    "Egyptian Hieroglyph Format Controls\0"
+    "Anatolian Hieroglyphs\0"
+    "Bamum Supplement\0"
+    "Mro\0"
+    "Bassa Vah\0"
+    "Pahawh Hmong\0"
+    "Medefaidrin\0"
+    "Miao\0"
+    "Ideographic Symbols and Punctuation\0"
+    "Tangut\0"
+    "Tangut Components\0"
+    "Kana Supplement\0"
+    "Kana Extended-A\0"
+    "Small Kana Extension\0"
+    "Nushu\0"
+    "Duployan\0"
+    "Shorthand Format Controls\0"
+    "Byzantine Musical Symbols\0"
+    "Musical Symbols\0"
+    "Ancient Greek Musical Notation\0"
+    "Mayan Numerals\0"
+    "Tai Xuan Jing Symbols\0"
+    "Counting Rod Numerals\0"
+    "Mathematical Alphanumeric Symbols\0"
+    "Sutton SignWriting\0"
+    "Glagolitic Supplement\0"
+    "Nyiakeng Puachue Hmong\0"
+    "Wancho\0"
+    "Mende Kikakui\0"
+    "Adlam\0"
+    "Indic Siyaq Numbers\0"
+    "Ottoman Siyaq Numbers\0"
+    "Arabic Mathematical Alphabetic Symbols\0"
+    "Mahjong Tiles\0"
+    "Domino Tiles\0"
+    "Playing Cards\0"
+    "Enclosed Alphanumeric Supplement\0"
+    "Enclosed Ideographic Supplement\0"
+    "Miscellaneous Symbols and Pictographs\0"
+    "Emoticons\0"
+    "Ornamental Dingbats\0"
+    "Transport and Map Symbols\0"
+    "Alchemical Symbols\0"
+    "Geometric Shapes Extended\0"
+    "Supplemental Arrows-C\0"
+    "Supplemental Symbols and Pictographs\0"
+    "Chess Symbols\0"
+    "Symbols and Pictographs Extended-A\0"
+    "CJK Unified Ideographs Extension B\0"
+    "CJK Unified Ideographs Extension C\0"
+    "CJK Unified Ideographs Extension D\0"
+    "CJK Unified Ideographs Extension E\0"
+    "CJK Unified Ideographs Extension F\0"
+    "CJK Compatibility Ideographs Supplement\0"
+    "Tags\0"
+    "Variation Selectors Supplement\0"
+    "Supplementary Private Use Area-A\0"
+    "Supplementary Private Use Area-B\0"
+;
+
 char const* get_block_name(uint32_t codepoint) {
         for (unsigned int i = 0; i < sizeof(unicode_blocks) / sizeof(unicode_block_t); i++) {
                 unicode_block_t const& b = unicode_blocks[i];
-                if (b.start <= codepoint && b.end >= codepoint) return b.name;
+                if (b.start <= codepoint && b.end >= codepoint) return unicode_block_names + b.name_offset;
         }
         return nullptr;
 }
@@ -0,0 +1,223 @@
+#include "libutfdecode.h"
+#include "libutfdecode_transcode.hpp"
+
+#include <algorithm>
+
+static_assert(int(utf_encoding_t::UTF8) == UTFDECODE_UTF8 &&
+                  int(utf_encoding_t::UTF16BE) == UTFDECODE_UTF16BE &&
+                  int(utf_encoding_t::UTF16LE) == UTFDECODE_UTF16LE &&
+                  int(utf_encoding_t::UTF32BE) == UTFDECODE_UTF32BE &&
+                  int(utf_encoding_t::UTF32LE) == UTFDECODE_UTF32LE,
+              "utfdecode_encoding does not match utf_encoding_t");
+static_assert(int(error_handling_t::ABORT) == UTFDECODE_ABORT &&
+                  int(error_handling_t::REPLACE) == UTFDECODE_REPLACE &&
+                  int(error_handling_t::IGNORE) == UTFDECODE_IGNORE,
+              "utfdecode_error_handling does not match error_handling_t");
+static_assert(int(transcode_status_t::OK) == UTFDECODE_OK &&
+                  int(transcode_status_t::INVALID) == UTFDECODE_INVALID &&
+                  int(transcode_status_t::INCOMPLETE) ==
+                      UTFDECODE_INCOMPLETE &&
+                  int(transcode_status_t::OUTPUT_FULL) ==
+                      UTFDECODE_OUTPUT_FULL,
+              "utfdecode_status does not match transcode_status_t");
+
+// The vectorized transcoders, which stop at malformed input, and the most
+// input whose output fits in output_capacity bytes.
+template <utf_encoding_t from, utf_encoding_t to> struct bulk_transcoder_t {
+  static constexpr bool AVAILABLE = false;
+  static size_t input_length(size_t output_capacity) {
+    return output_capacity;
+  }
+  static size_t transcode(uint8_t const *, size_t, uint8_t *, size_t &,
+                          uint64_t &) {
+    return 0;
+  }
+};
+
+template <size_t unit_size, bool little_endian>
+struct units_utf8_bulk_transcoder_t {
+  static constexpr bool AVAILABLE = true;
+  static size_t input_length(size_t output_capacity) {
+    return unit_size == 2 ? output_capacity / 3 * 2 : output_capacity;
+  }
+  static size_t transcode(uint8_t const *input, size_t input_length,
+                          uint8_t *output, size_t &written,
+                          uint64_t &codepoints) {
+    return (unit_size == 2 ? transcode_utf16_to_utf8
+                           : transcode_utf32_to_utf8)(
+        input, input_length, little_endian, output, written, codepoints);
+  }
+};
+
+template <size_t unit_size, bool little_endian>
+struct utf8_units_bulk_transcoder_t {
+  static constexpr bool AVAILABLE = true;
+  static size_t input_length(size_t output_capacity) {
+    return output_capacity / unit_size;
+  }
+  static size_t transcode(uint8_t const *input, size_t input_length,
+                          uint8_t *output, size_t &written,
+                          uint64_t &codepoints) {
+    return (unit_size == 2 ? transcode_utf8_to_utf16
+                           : transcode_utf8_to_utf32)(
+        input, input_length, little_endian, output, written, codepoints);
+  }
+};
+
+template <>
+struct bulk_transcoder_t<utf_encoding_t::UTF16BE, utf_encoding_t::UTF8>
+    : units_utf8_bulk_transcoder_t<2, false> {};
+template <>
+struct bulk_transcoder_t<utf_encoding_t::UTF16LE, utf_encoding_t::UTF8>
+    : units_utf8_bulk_transcoder_t<2, true> {};
+template <>
+struct bulk_transcoder_t<utf_encoding_t::UTF32BE, utf_encoding_t::UTF8>
+    : units_utf8_bulk_transcoder_t<4, false> {};
+template <>
+struct bulk_transcoder_t<utf_encoding_t::UTF32LE, utf_encoding_t::UTF8>
+    : units_utf8_bulk_transcoder_t<4, true> {};
+template <>
+struct bulk_transcoder_t<utf_encoding_t::UTF8, utf_encoding_t::UTF16BE>
+    : utf8_units_bulk_transcoder_t<2, false> {};
+template <>
+struct bulk_transcoder_t<utf_encoding_t::UTF8, utf_encoding_t::UTF16LE>
+    : utf8_units_bulk_transcoder_t<2, true> {};
+template <>
+struct bulk_transcoder_t<utf_encoding_t::UTF8, utf_encoding_t::UTF32BE>
+    : utf8_units_bulk_transcoder_t<4, false> {};
+template <>
+struct bulk_transcoder_t<utf_encoding_t::UTF8, utf_encoding_t::UTF32LE>
+    : utf8_units_bulk_transcoder_t<4, true> {};
+
+// Transcodes with the vectorized transcoder, if there is one, for as long as
+// the input is valid, and gets past what stopped it with utf_transcode().
+template <utf_encoding_t from, utf_encoding_t to, error_handling_t on_error>
+static transcode_result_t transcode(uint8_t const *input, size_t input_length,
+                                    uint8_t *output, size_t output_capacity) {
+  using bulk = bulk_transcoder_t<from, to>;
+  if (!bulk::AVAILABLE) {
+    return utf_transcode<from, to, on_error>(input, input_length, output,
+                                             output_capacity);
+  }
+
+  transcode_result_t result{transcode_status_t::OK, 0, 0, 0};
+  while (result.read < input_length) {
+    size_t bulk_length =
+        std::min(input_length - result.read,
+                 bulk::input_length(output_capacity - result.written));
+    size_t written;
+    uint64_t codepoints;
+    result.read += bulk::transcode(input + result.read, bulk_length,
+                                   output + result.written, written,
+                                   codepoints);
+    result.written += written;
+
+    size_t window = std::min<size_t>(input_length - result.read, 64);
+    bool window_at_end = window == input_length - result.read;
+    transcode_result_t rest = utf_transcode<from, to, on_error>(
+        input + result.read, window, output + result.written,
+        output_capacity - result.written);
+    result.read += rest.read;
+    result.written += rest.written;
+    result.errors += rest.errors;
+    if (rest.status != transcode_status_t::OK &&
+        (rest.status != transcode_status_t::INCOMPLETE || window_at_end)) {
+      result.status = rest.status;
+      break;
+    }
+  }
+  return result;
+}
+
+using transcoder_t = transcode_result_t (*)(uint8_t const *, size_t,
+                                            uint8_t *, size_t);
+
+// Picks the transcoder for the arguments, so that the formats are only
+// branched on once per call.
+template <utf_encoding_t from, utf_encoding_t to>
+static transcoder_t select_transcoder(utfdecode_error_handling on_error) {
+  switch (on_error) {
+  case UTFDECODE_ABORT:
+    return transcode<from, to, error_handling_t::ABORT>;
+  case UTFDECODE_REPLACE:
+    return transcode<from, to, error_handling_t::REPLACE>;
+  case UTFDECODE_IGNORE:
+    return transcode<from, to, error_handling_t::IGNORE>;
+  }
+  return nullptr;
+}
+
+template <utf_encoding_t from>
+static transcoder_t select_transcoder(utfdecode_encoding to,
+                                      utfdecode_error_handling on_error) {
+  switch (to) {
+  case UTFDECODE_UTF8:
+    return select_transcoder<from, utf_encoding_t::UTF8>(on_error);
+  case UTFDECODE_UTF16BE:
+    return select_transcoder<from, utf_encoding_t::UTF16BE>(on_error);
+  case UTFDECODE_UTF16LE:
+    return select_transcoder<from, utf_encoding_t::UTF16LE>(on_error);
+  case UTFDECODE_UTF32BE:
+    return select_transcoder<from, utf_encoding_t::UTF32BE>(on_error);
+  case UTFDECODE_UTF32LE:
+    return select_transcoder<from, utf_encoding_t::UTF32LE>(on_error);
+  }
+  return nullptr;
+}
+
+static transcoder_t select_transcoder(utfdecode_encoding from,
+                                      utfdecode_encoding to,
+                                      utfdecode_error_handling on_error) {
+  switch (from) {
+  case UTFDECODE_UTF8:
+    return select_transcoder<utf_encoding_t::UTF8>(to, on_error);
+  case UTFDECODE_UTF16BE:
+    return select_transcoder<utf_encoding_t::UTF16BE>(to, on_error);
+  case UTFDECODE_UTF16LE:
+    return select_transcoder<utf_encoding_t::UTF16LE>(to, on_error);
+  case UTFDECODE_UTF32BE:
+    return select_transcoder<utf_encoding_t::UTF32BE>(to, on_error);
+  case UTFDECODE_UTF32LE:
+    return select_transcoder<utf_encoding_t::UTF32LE>(to, on_error);
+  }
+  return nullptr;
+}
+
+static size_t store_result(transcode_result_t const &result,
+                           utfdecode_error *err) {
+  if (err != nullptr) {
+    err->status = utfdecode_status(result.status);
+    err->read = result.read;
+    err->errors = result.errors;
+  }
+  return result.written;
+}
+
+size_t utfdecode_transcode(utfdecode_encoding from, utfdecode_encoding to,
+                           utfdecode_error_handling on_error,
+                           const uint8_t *src, size_t len, uint8_t *dst,
+                           size_t cap, utfdecode_error *err) {
+  transcoder_t transcoder = select_transcoder(from, to, on_error);
+  if (transcoder == nullptr) {
+    return store_result({transcode_status_t::INVALID, 0, 0, 0}, err);
+  }
+  return store_result(transcoder(src, len, dst, cap), err);
+}
+
+#define UTFDECODE_TRANSCODER(name, from, to)                                   \
+  size_t name(const uint8_t *src, size_t len, uint8_t *dst, size_t cap,        \
+              utfdecode_error *err) {                                          \
+    return store_result(                                                       \
+        transcode<utf_encoding_t::from, utf_encoding_t::to,                    \
+                  error_handling_t::REPLACE>(src, len, dst, cap),              \
+        err);                                                                  \
+  }
+
+UTFDECODE_TRANSCODER(utfdecode_utf8_to_utf16le, UTF8, UTF16LE)
+UTFDECODE_TRANSCODER(utfdecode_utf8_to_utf16be, UTF8, UTF16BE)
+UTFDECODE_TRANSCODER(utfdecode_utf8_to_utf32le, UTF8, UTF32LE)
+UTFDECODE_TRANSCODER(utfdecode_utf8_to_utf32be, UTF8, UTF32BE)
+UTFDECODE_TRANSCODER(utfdecode_utf16le_to_utf8, UTF16LE, UTF8)
+UTFDECODE_TRANSCODER(utfdecode_utf16be_to_utf8, UTF16BE, UTF8)
+UTFDECODE_TRANSCODER(utfdecode_utf32le_to_utf8, UTF32LE, UTF8)
+UTFDECODE_TRANSCODER(utfdecode_utf32be_to_utf8, UTF32BE, UTF8)
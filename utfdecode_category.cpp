@@ -1,7 +1,7 @@
 #ifndef GENERAL_CATEGORY_VALUES_HPP_INCLUDED
 #define GENERAL_CATEGORY_VALUES_HPP_INCLUDED
 
-#include "utfdecode.hpp"
+#include "libutfdecode.hpp"
 
 char const *general_category_description(general_category_value_t category) {
   switch (category) {
@@ -2,14271 +2,3338 @@
 
 #include <vector>
 #include <cstdint>
-#include "utfdecode.hpp"
+#include "libutfdecode.hpp"
 
 const uint32_t unicode_decompose_lookup[] = {
-0x0020
-, 0x0020
-, 0x0308
-, 0x0061
-, 0x0020
-, 0x0304
-, 0x0032
-, 0x0033
-, 0x0020
-, 0x0301
-, 0x03BC
-, 0x0020
-, 0x0327
-, 0x0031
-, 0x006F
-, 0x0031
-, 0x2044
-, 0x0034
-, 0x0031
-, 0x2044
-, 0x0032
-, 0x0033
-, 0x2044
-, 0x0034
-, 0x0041
-, 0x0300
-, 0x0041
-, 0x0301
-, 0x0041
-, 0x0302
-, 0x0041
-, 0x0303
-, 0x0041
-, 0x0308
-, 0x0041
-, 0x030A
-, 0x0043
-, 0x0327
-, 0x0045
-, 0x0300
-, 0x0045
-, 0x0301
-, 0x0045
-, 0x0302
-, 0x0045
-, 0x0308
-, 0x0049
-, 0x0300
-, 0x0049
-, 0x0301
-, 0x0049
-, 0x0302
-, 0x0049
-, 0x0308
-, 0x004E
-, 0x0303
-, 0x004F
-, 0x0300
-, 0x004F
-, 0x0301
-, 0x004F
-, 0x0302
-, 0x004F
-, 0x0303
-, 0x004F
-, 0x0308
-, 0x0055
-, 0x0300
-, 0x0055
-, 0x0301
-, 0x0055
-, 0x0302
-, 0x0055
-, 0x0308
-, 0x0059
-, 0x0301
-, 0x0061
-, 0x0300
-, 0x0061
-, 0x0301
-, 0x0061
-, 0x0302
-, 0x0061
-, 0x0303
-, 0x0061
-, 0x0308
-, 0x0061
-, 0x030A
-, 0x0063
-, 0x0327
-, 0x0065
-, 0x0300
-, 0x0065
-, 0x0301
-, 0x0065
-, 0x0302
-, 0x0065
-, 0x0308
-, 0x0069
-, 0x0300
-, 0x0069
-, 0x0301
-, 0x0069
-, 0x0302
-, 0x0069
-, 0x0308
-, 0x006E
-, 0x0303
-, 0x006F
-, 0x0300
-, 0x006F
-, 0x0301
-, 0x006F
-, 0x0302
-, 0x006F
-, 0x0303
-, 0x006F
-, 0x0308
-, 0x0075
-, 0x0300
-, 0x0075
-, 0x0301
-, 0x0075
-, 0x0302
-, 0x0075
-, 0x0308
-, 0x0079
-, 0x0301
-, 0x0079
-, 0x0308
-, 0x0041
-, 0x0304
-, 0x0061
-, 0x0304
-, 0x0041
-, 0x0306
-, 0x0061
-, 0x0306
-, 0x0041
-, 0x0328
-, 0x0061
-, 0x0328
-, 0x0043
-, 0x0301
-, 0x0063
-, 0x0301
-, 0x0043
-, 0x0302
-, 0x0063
-, 0x0302
-, 0x0043
-, 0x0307
-, 0x0063
-, 0x0307
-, 0x0043
-, 0x030C
-, 0x0063
-, 0x030C
-, 0x0044
-, 0x030C
-, 0x0064
-, 0x030C
-, 0x0045
-, 0x0304
-, 0x0065
-, 0x0304
-, 0x0045
-, 0x0306
-, 0x0065
-, 0x0306
-, 0x0045
-, 0x0307
-, 0x0065
-, 0x0307
-, 0x0045
-, 0x0328
-, 0x0065
-, 0x0328
-, 0x0045
-, 0x030C
-, 0x0065
-, 0x030C
-, 0x0047
-, 0x0302
-, 0x0067
-, 0x0302
-, 0x0047
-, 0x0306
-, 0x0067
-, 0x0306
-, 0x0047
-, 0x0307
-, 0x0067
-, 0x0307
-, 0x0047
-, 0x0327
-, 0x0067
-, 0x0327
-, 0x0048
-, 0x0302
-, 0x0068
-, 0x0302
-, 0x0049
-, 0x0303
-, 0x0069
-, 0x0303
-, 0x0049
-, 0x0304
-, 0x0069
-, 0x0304
-, 0x0049
-, 0x0306
-, 0x0069
-, 0x0306
-, 0x0049
-, 0x0328
-, 0x0069
-, 0x0328
-, 0x0049
-, 0x0307
-, 0x0049
-, 0x004A
-, 0x0069
-, 0x006A
-, 0x004A
-, 0x0302
-, 0x006A
-, 0x0302
-, 0x004B
-, 0x0327
-, 0x006B
-, 0x0327
-, 0x004C
-, 0x0301
-, 0x006C
-, 0x0301
-, 0x004C
-, 0x0327
-, 0x006C
-, 0x0327
-, 0x004C
-, 0x030C
-, 0x006C
-, 0x030C
-, 0x004C
-, 0x00B7
-, 0x006C
-, 0x00B7
-, 0x004E
-, 0x0301
-, 0x006E
-, 0x0301
-, 0x004E
-, 0x0327
-, 0x006E
-, 0x0327
-, 0x004E
-, 0x030C
-, 0x006E
-, 0x030C
-, 0x02BC
-, 0x006E
-, 0x004F
-, 0x0304
-, 0x006F
-, 0x0304
-, 0x004F
-, 0x0306
-, 0x006F
-, 0x0306
-, 0x004F
-, 0x030B
-, 0x006F
-, 0x030B
-, 0x0052
-, 0x0301
-, 0x0072
-, 0x0301
-, 0x0052
-, 0x0327
-, 0x0072
-, 0x0327
-, 0x0052
-, 0x030C
-, 0x0072
-, 0x030C
-, 0x0053
-, 0x0301
-, 0x0073
-, 0x0301
-, 0x0053
-, 0x0302
-, 0x0073
-, 0x0302
-, 0x0053
-, 0x0327
-, 0x0073
-, 0x0327
-, 0x0053
-, 0x030C
-, 0x0073
-, 0x030C
-, 0x0054
-, 0x0327
-, 0x0074
-, 0x0327
-, 0x0054
-, 0x030C
-, 0x0074
-, 0x030C
-, 0x0055
-, 0x0303
-, 0x0075
-, 0x0303
-, 0x0055
-, 0x0304
-, 0x0075
-, 0x0304
-, 0x0055
-, 0x0306
-, 0x0075
-, 0x0306
-, 0x0055
-, 0x030A
-, 0x0075
-, 0x030A
-, 0x0055
-, 0x030B
-, 0x0075
-, 0x030B
-, 0x0055
-, 0x0328
-, 0x0075
-, 0x0328
-, 0x0057
-, 0x0302
-, 0x0077
-, 0x0302
-, 0x0059
-, 0x0302
-, 0x0079
-, 0x0302
-, 0x0059
-, 0x0308
-, 0x005A
-, 0x0301
-, 0x007A
-, 0x0301
-, 0x005A
-, 0x0307
-, 0x007A
-, 0x0307
-, 0x005A
-, 0x030C
-, 0x007A
-, 0x030C
-, 0x0073
-, 0x004F
-, 0x031B
-, 0x006F
-, 0x031B
-, 0x0055
-, 0x031B
-, 0x0075
-, 0x031B
-, 0x0044
-, 0x017D
-, 0x0044
-, 0x017E
-, 0x0064
-, 0x017E
-, 0x004C
-, 0x004A
-, 0x004C
-, 0x006A
-, 0x006C
-, 0x006A
-, 0x004E
-, 0x004A
-, 0x004E
-, 0x006A
-, 0x006E
-, 0x006A
-, 0x0041
-, 0x030C
-, 0x0061
-, 0x030C
-, 0x0049
-, 0x030C
-, 0x0069
-, 0x030C
-, 0x004F
-, 0x030C
-, 0x006F
-, 0x030C
-, 0x0055
-, 0x030C
-, 0x0075
-, 0x030C
-, 0x00DC
-, 0x0304
-, 0x00FC
-, 0x0304
-, 0x00DC
-, 0x0301
-, 0x00FC
-, 0x0301
-, 0x00DC
-, 0x030C
-, 0x00FC
-, 0x030C
-, 0x00DC
-, 0x0300
-, 0x00FC
-, 0x0300
-, 0x00C4
-, 0x0304
-, 0x00E4
-, 0x0304
-, 0x0226
-, 0x0304
-, 0x0227
-, 0x0304
-, 0x00C6
-, 0x0304
-, 0x00E6
-, 0x0304
-, 0x0047
-, 0x030C
-, 0x0067
-, 0x030C
-, 0x004B
-, 0x030C
-, 0x006B
-, 0x030C
-, 0x004F
-, 0x0328
-, 0x006F
-, 0x0328
-, 0x01EA
-, 0x0304
-, 0x01EB
-, 0x0304
-, 0x01B7
-, 0x030C
-, 0x0292
-, 0x030C
-, 0x006A
-, 0x030C
-, 0x0044
-, 0x005A
-, 0x0044
-, 0x007A
-, 0x0064
-, 0x007A
-, 0x0047
-, 0x0301
-, 0x0067
-, 0x0301
-, 0x004E
-, 0x0300
-, 0x006E
-, 0x0300
-, 0x00C5
-, 0x0301
-, 0x00E5
-, 0x0301
-, 0x00C6
-, 0x0301
-, 0x00E6
-, 0x0301
-, 0x00D8
-, 0x0301
-, 0x00F8
-, 0x0301
-, 0x0041
-, 0x030F
-, 0x0061
-, 0x030F
-, 0x0041
-, 0x0311
-, 0x0061
-, 0x0311
-, 0x0045
-, 0x030F
-, 0x0065
-, 0x030F
-, 0x0045
-, 0x0311
-, 0x0065
-, 0x0311
-, 0x0049
-, 0x030F
-, 0x0069
-, 0x030F
-, 0x0049
-, 0x0311
-, 0x0069
-, 0x0311
-, 0x004F
-, 0x030F
-, 0x006F
-, 0x030F
-, 0x004F
-, 0x0311
-, 0x006F
-, 0x0311
-, 0x0052
-, 0x030F
-, 0x0072
-, 0x030F
-, 0x0052
-, 0x0311
-, 0x0072
-, 0x0311
-, 0x0055
-, 0x030F
-, 0x0075
-, 0x030F
-, 0x0055
-, 0x0311
-, 0x0075
-, 0x0311
-, 0x0053
-, 0x0326
-, 0x0073
-, 0x0326
-, 0x0054
-, 0x0326
-, 0x0074
-, 0x0326
-, 0x0048
-, 0x030C
-, 0x0068
-, 0x030C
-, 0x0041
-, 0x0307
-, 0x0061
-, 0x0307
-, 0x0045
-, 0x0327
-, 0x0065
-, 0x0327
-, 0x00D6
-, 0x0304
-, 0x00F6
-, 0x0304
-, 0x00D5
-, 0x0304
-, 0x00F5
-, 0x0304
-, 0x004F
-, 0x0307
-, 0x006F
-, 0x0307
-, 0x022E
-, 0x0304
-, 0x022F
-, 0x0304
-, 0x0059
-, 0x0304
-, 0x0079
-, 0x0304
-, 0x0068
-, 0x0266
-, 0x006A
-, 0x0072
-, 0x0279
-, 0x027B
-, 0x0281
-, 0x0077
-, 0x0079
-, 0x0020
-, 0x0306
-, 0x0020
-, 0x0307
-, 0x0020
-, 0x030A
-, 0x0020
-, 0x0328
-, 0x0020
-, 0x0303
-, 0x0020
-, 0x030B
-, 0x0263
-, 0x006C
-, 0x0073
-, 0x0078
-, 0x0295
-, 0x0300
-, 0x0301
-, 0x0313
-, 0x0308
-, 0x0301
-, 0x02B9
-, 0x0020
-, 0x0345
-, 0x003B
-, 0x0020
-, 0x0301
-, 0x00A8
-, 0x0301
-, 0x0391
-, 0x0301
-, 0x00B7
-, 0x0395
-, 0x0301
-, 0x0397
-, 0x0301
-, 0x0399
-, 0x0301
-, 0x039F
-, 0x0301
-, 0x03A5
-, 0x0301
-, 0x03A9
-, 0x0301
-, 0x03CA
-, 0x0301
-, 0x0399
-, 0x0308
-, 0x03A5
-, 0x0308
-, 0x03B1
-, 0x0301
-, 0x03B5
-, 0x0301
-, 0x03B7
-, 0x0301
-, 0x03B9
-, 0x0301
-, 0x03CB
-, 0x0301
-, 0x03B9
-, 0x0308
-, 0x03C5
-, 0x0308
-, 0x03BF
-, 0x0301
-, 0x03C5
-, 0x0301
-, 0x03C9
-, 0x0301
-, 0x03B2
-, 0x03B8
-, 0x03A5
-, 0x03D2
-, 0x0301
-, 0x03D2
-, 0x0308
-, 0x03C6
-, 0x03C0
-, 0x03BA
-, 0x03C1
-, 0x03C2
-, 0x0398
-, 0x03B5
-, 0x03A3
-, 0x0415
-, 0x0300
-, 0x0415
-, 0x0308
-, 0x0413
-, 0x0301
-, 0x0406
-, 0x0308
-, 0x041A
-, 0x0301
-, 0x0418
-, 0x0300
-, 0x0423
-, 0x0306
-, 0x0418
-, 0x0306
-, 0x0438
-, 0x0306
-, 0x0435
-, 0x0300
-, 0x0435
-, 0x0308
-, 0x0433
-, 0x0301
-, 0x0456
-, 0x0308
-, 0x043A
-, 0x0301
-, 0x0438
-, 0x0300
-, 0x0443
-, 0x0306
-, 0x0474
-, 0x030F
-, 0x0475
-, 0x030F
-, 0x0416
-, 0x0306
-, 0x0436
-, 0x0306
-, 0x0410
-, 0x0306
-, 0x0430
-, 0x0306
-, 0x0410
-, 0x0308
-, 0x0430
-, 0x0308
-, 0x0415
-, 0x0306
-, 0x0435
-, 0x0306
-, 0x04D8
-, 0x0308
-, 0x04D9
-, 0x0308
-, 0x0416
-, 0x0308
-, 0x0436
-, 0x0308
-, 0x0417
-, 0x0308
-, 0x0437
-, 0x0308
-, 0x0418
-, 0x0304
-, 0x0438
-, 0x0304
-, 0x0418
-, 0x0308
-, 0x0438
-, 0x0308
-, 0x041E
-, 0x0308
-, 0x043E
-, 0x0308
-, 0x04E8
-, 0x0308
-, 0x04E9
-, 0x0308
-, 0x042D
-, 0x0308
-, 0x044D
-, 0x0308
-, 0x0423
-, 0x0304
-, 0x0443
-, 0x0304
-, 0x0423
-, 0x0308
-, 0x0443
-, 0x0308
-, 0x0423
-, 0x030B
-, 0x0443
-, 0x030B
-, 0x0427
-, 0x0308
-, 0x0447
-, 0x0308
-, 0x042B
-, 0x0308
-, 0x044B
-, 0x0308
-, 0x0565
-, 0x0582
-, 0x0627
-, 0x0653
-, 0x0627
-, 0x0654
-, 0x0648
-, 0x0654
-, 0x0627
-, 0x0655
-, 0x064A
-, 0x0654
-, 0x0627
-, 0x0674
-, 0x0648
-, 0x0674
-, 0x06C7
-, 0x0674
-, 0x064A
-, 0x0674
-, 0x06D5
-, 0x0654
-, 0x06C1
-, 0x0654
-, 0x06D2
-, 0x0654
-, 0x0928
-, 0x093C
-, 0x0930
-, 0x093C
-, 0x0933
-, 0x093C
-, 0x0915
-, 0x093C
-, 0x0916
-, 0x093C
-, 0x0917
-, 0x093C
-, 0x091C
-, 0x093C
-, 0x0921
-, 0x093C
-, 0x0922
-, 0x093C
-, 0x092B
-, 0x093C
-, 0x092F
-, 0x093C
-, 0x09C7
-, 0x09BE
-, 0x09C7
-, 0x09D7
-, 0x09A1
-, 0x09BC
-, 0x09A2
-, 0x09BC
-, 0x09AF
-, 0x09BC
-, 0x0A32
-, 0x0A3C
-, 0x0A38
-, 0x0A3C
-, 0x0A16
-, 0x0A3C
-, 0x0A17
-, 0x0A3C
-, 0x0A1C
-, 0x0A3C
-, 0x0A2B
-, 0x0A3C
-, 0x0B47
-, 0x0B56
-, 0x0B47
-, 0x0B3E
-, 0x0B47
-, 0x0B57
-, 0x0B21
-, 0x0B3C
-, 0x0B22
-, 0x0B3C
-, 0x0B92
-, 0x0BD7
-, 0x0BC6
-, 0x0BBE
-, 0x0BC7
-, 0x0BBE
-, 0x0BC6
-, 0x0BD7
-, 0x0C46
-, 0x0C56
-, 0x0CBF
-, 0x0CD5
-, 0x0CC6
-, 0x0CD5
-, 0x0CC6
-, 0x0CD6
-, 0x0CC6
-, 0x0CC2
-, 0x0CCA
-, 0x0CD5
-, 0x0D46
-, 0x0D3E
-, 0x0D47
-, 0x0D3E
-, 0x0D46
-, 0x0D57
-, 0x0DD9
-, 0x0DCA
-, 0x0DD9
-, 0x0DCF
-, 0x0DDC
-, 0x0DCA
-, 0x0DD9
-, 0x0DDF
-, 0x0E4D
-, 0x0E32
-, 0x0ECD
-, 0x0EB2
-, 0x0EAB
-, 0x0E99
-, 0x0EAB
-, 0x0EA1
-, 0x0F0B
-, 0x0F42
-, 0x0FB7
-, 0x0F4C
-, 0x0FB7
-, 0x0F51
-, 0x0FB7
-, 0x0F56
-, 0x0FB7
-, 0x0F5B
-, 0x0FB7
-, 0x0F40
-, 0x0FB5
-, 0x0F71
-, 0x0F72
-, 0x0F71
-, 0x0F74
-, 0x0FB2
-, 0x0F80
-, 0x0FB2
-, 0x0F81
-, 0x0FB3
-, 0x0F80
-, 0x0FB3
-, 0x0F81
-, 0x0F71
-, 0x0F80
-, 0x0F92
-, 0x0FB7
-, 0x0F9C
-, 0x0FB7
-, 0x0FA1
-, 0x0FB7
-, 0x0FA6
-, 0x0FB7
-, 0x0FAB
-, 0x0FB7
-, 0x0F90
-, 0x0FB5
-, 0x1025
-, 0x102E
-, 0x10DC
-, 0x1B05
-, 0x1B35
-, 0x1B07
-, 0x1B35
-, 0x1B09
-, 0x1B35
-, 0x1B0B
-, 0x1B35
-, 0x1B0D
-, 0x1B35
-, 0x1B11
-, 0x1B35
-, 0x1B3A
-, 0x1B35
-, 0x1B3C
-, 0x1B35
-, 0x1B3E
-, 0x1B35
-, 0x1B3F
-, 0x1B35
-, 0x1B42
-, 0x1B35
-, 0x0041
-, 0x00C6
-, 0x0042
-, 0x0044
-, 0x0045
-, 0x018E
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0222
-, 0x0050
-, 0x0052
-, 0x0054
-, 0x0055
-, 0x0057
-, 0x0061
-, 0x0250
-, 0x0251
-, 0x1D02
-, 0x0062
-, 0x0064
-, 0x0065
-, 0x0259
-, 0x025B
-, 0x025C
-, 0x0067
-, 0x006B
-, 0x006D
-, 0x014B
-, 0x006F
-, 0x0254
-, 0x1D16
-, 0x1D17
-, 0x0070
-, 0x0074
-, 0x0075
-, 0x1D1D
-, 0x026F
-, 0x0076
-, 0x1D25
-, 0x03B2
-, 0x03B3
-, 0x03B4
-, 0x03C6
-, 0x03C7
-, 0x0069
-, 0x0072
-, 0x0075
-, 0x0076
-, 0x03B2
-, 0x03B3
-, 0x03C1
-, 0x03C6
-, 0x03C7
-, 0x043D
-, 0x0252
-, 0x0063
-, 0x0255
-, 0x00F0
-, 0x025C
-, 0x0066
-, 0x025F
-, 0x0261
-, 0x0265
-, 0x0268
-, 0x0269
-, 0x026A
-, 0x1D7B
-, 0x029D
-, 0x026D
-, 0x1D85
-, 0x029F
-, 0x0271
-, 0x0270
-, 0x0272
-, 0x0273
-, 0x0274
-, 0x0275
-, 0x0278
-, 0x0282
-, 0x0283
-, 0x01AB
-, 0x0289
-, 0x028A
-, 0x1D1C
-, 0x028B
-, 0x028C
-, 0x007A
-, 0x0290
-, 0x0291
-, 0x0292
-, 0x03B8
-, 0x0041
-, 0x0325
-, 0x0061
-, 0x0325
-, 0x0042
-, 0x0307
-, 0x0062
-, 0x0307
-, 0x0042
-, 0x0323
-, 0x0062
-, 0x0323
-, 0x0042
-, 0x0331
-, 0x0062
-, 0x0331
-, 0x00C7
-, 0x0301
-, 0x00E7
-, 0x0301
-, 0x0044
-, 0x0307
-, 0x0064
-, 0x0307
-, 0x0044
-, 0x0323
-, 0x0064
-, 0x0323
-, 0x0044
-, 0x0331
-, 0x0064
-, 0x0331
-, 0x0044
-, 0x0327
-, 0x0064
-, 0x0327
-, 0x0044
-, 0x032D
-, 0x0064
-, 0x032D
-, 0x0112
-, 0x0300
-, 0x0113
-, 0x0300
-, 0x0112
-, 0x0301
-, 0x0113
-, 0x0301
-, 0x0045
-, 0x032D
-, 0x0065
-, 0x032D
-, 0x0045
-, 0x0330
-, 0x0065
-, 0x0330
-, 0x0228
-, 0x0306
-, 0x0229
-, 0x0306
-, 0x0046
-, 0x0307
-, 0x0066
-, 0x0307
-, 0x0047
-, 0x0304
-, 0x0067
-, 0x0304
-, 0x0048
-, 0x0307
-, 0x0068
-, 0x0307
-, 0x0048
-, 0x0323
-, 0x0068
-, 0x0323
-, 0x0048
-, 0x0308
-, 0x0068
-, 0x0308
-, 0x0048
-, 0x0327
-, 0x0068
-, 0x0327
-, 0x0048
-, 0x032E
-, 0x0068
-, 0x032E
-, 0x0049
-, 0x0330
-, 0x0069
-, 0x0330
-, 0x00CF
-, 0x0301
-, 0x00EF
-, 0x0301
-, 0x004B
-, 0x0301
-, 0x006B
-, 0x0301
-, 0x004B
-, 0x0323
-, 0x006B
-, 0x0323
-, 0x004B
-, 0x0331
-, 0x006B
-, 0x0331
-, 0x004C
-, 0x0323
-, 0x006C
-, 0x0323
-, 0x1E36
-, 0x0304
-, 0x1E37
-, 0x0304
-, 0x004C
-, 0x0331
-, 0x006C
-, 0x0331
-, 0x004C
-, 0x032D
-, 0x006C
-, 0x032D
-, 0x004D
-, 0x0301
-, 0x006D
-, 0x0301
-, 0x004D
-, 0x0307
-, 0x006D
-, 0x0307
-, 0x004D
-, 0x0323
-, 0x006D
-, 0x0323
-, 0x004E
-, 0x0307
-, 0x006E
-, 0x0307
-, 0x004E
-, 0x0323
-, 0x006E
-, 0x0323
-, 0x004E
-, 0x0331
-, 0x006E
-, 0x0331
-, 0x004E
-, 0x032D
-, 0x006E
-, 0x032D
-, 0x00D5
-, 0x0301
-, 0x00F5
-, 0x0301
-, 0x00D5
-, 0x0308
-, 0x00F5
-, 0x0308
-, 0x014C
-, 0x0300
-, 0x014D
-, 0x0300
-, 0x014C
-, 0x0301
-, 0x014D
-, 0x0301
-, 0x0050
-, 0x0301
-, 0x0070
-, 0x0301
-, 0x0050
-, 0x0307
-, 0x0070
-, 0x0307
-, 0x0052
-, 0x0307
-, 0x0072
-, 0x0307
-, 0x0052
-, 0x0323
-, 0x0072
-, 0x0323
-, 0x1E5A
-, 0x0304
-, 0x1E5B
-, 0x0304
-, 0x0052
-, 0x0331
-, 0x0072
-, 0x0331
-, 0x0053
-, 0x0307
-, 0x0073
-, 0x0307
-, 0x0053
-, 0x0323
-, 0x0073
-, 0x0323
-, 0x015A
-, 0x0307
-, 0x015B
-, 0x0307
-, 0x0160
-, 0x0307
-, 0x0161
-, 0x0307
-, 0x1E62
-, 0x0307
-, 0x1E63
-, 0x0307
-, 0x0054
-, 0x0307
-, 0x0074
-, 0x0307
-, 0x0054
-, 0x0323
-, 0x0074
-, 0x0323
-, 0x0054
-, 0x0331
-, 0x0074
-, 0x0331
-, 0x0054
-, 0x032D
-, 0x0074
-, 0x032D
-, 0x0055
-, 0x0324
-, 0x0075
-, 0x0324
-, 0x0055
-, 0x0330
-, 0x0075
-, 0x0330
-, 0x0055
-, 0x032D
-, 0x0075
-, 0x032D
-, 0x0168
-, 0x0301
-, 0x0169
-, 0x0301
-, 0x016A
-, 0x0308
-, 0x016B
-, 0x0308
-, 0x0056
-, 0x0303
-, 0x0076
-, 0x0303
-, 0x0056
-, 0x0323
-, 0x0076
-, 0x0323
-, 0x0057
-, 0x0300
-, 0x0077
-, 0x0300
-, 0x0057
-, 0x0301
-, 0x0077
-, 0x0301
-, 0x0057
-, 0x0308
-, 0x0077
-, 0x0308
-, 0x0057
-, 0x0307
-, 0x0077
-, 0x0307
-, 0x0057
-, 0x0323
-, 0x0077
-, 0x0323
-, 0x0058
-, 0x0307
-, 0x0078
-, 0x0307
-, 0x0058
-, 0x0308
-, 0x0078
-, 0x0308
-, 0x0059
-, 0x0307
-, 0x0079
-, 0x0307
-, 0x005A
-, 0x0302
-, 0x007A
-, 0x0302
-, 0x005A
-, 0x0323
-, 0x007A
-, 0x0323
-, 0x005A
-, 0x0331
-, 0x007A
-, 0x0331
-, 0x0068
-, 0x0331
-, 0x0074
-, 0x0308
-, 0x0077
-, 0x030A
-, 0x0079
-, 0x030A
-, 0x0061
-, 0x02BE
-, 0x017F
-, 0x0307
-, 0x0041
-, 0x0323
-, 0x0061
-, 0x0323
-, 0x0041
-, 0x0309
-, 0x0061
-, 0x0309
-, 0x00C2
-, 0x0301
-, 0x00E2
-, 0x0301
-, 0x00C2
-, 0x0300
-, 0x00E2
-, 0x0300
-, 0x00C2
-, 0x0309
-, 0x00E2
-, 0x0309
-, 0x00C2
-, 0x0303
-, 0x00E2
-, 0x0303
-, 0x1EA0
-, 0x0302
-, 0x1EA1
-, 0x0302
-, 0x0102
-, 0x0301
-, 0x0103
-, 0x0301
-, 0x0102
-, 0x0300
-, 0x0103
-, 0x0300
-, 0x0102
-, 0x0309
-, 0x0103
-, 0x0309
-, 0x0102
-, 0x0303
-, 0x0103
-, 0x0303
-, 0x1EA0
-, 0x0306
-, 0x1EA1
-, 0x0306
-, 0x0045
-, 0x0323
-, 0x0065
-, 0x0323
-, 0x0045
-, 0x0309
-, 0x0065
-, 0x0309
-, 0x0045
-, 0x0303
-, 0x0065
-, 0x0303
-, 0x00CA
-, 0x0301
-, 0x00EA
-, 0x0301
-, 0x00CA
-, 0x0300
-, 0x00EA
-, 0x0300
-, 0x00CA
-, 0x0309
-, 0x00EA
-, 0x0309
-, 0x00CA
-, 0x0303
-, 0x00EA
-, 0x0303
-, 0x1EB8
-, 0x0302
-, 0x1EB9
-, 0x0302
-, 0x0049
-, 0x0309
-, 0x0069
-, 0x0309
-, 0x0049
-, 0x0323
-, 0x0069
-, 0x0323
-, 0x004F
-, 0x0323
-, 0x006F
-, 0x0323
-, 0x004F
-, 0x0309
-, 0x006F
-, 0x0309
-, 0x00D4
-, 0x0301
-, 0x00F4
-, 0x0301
-, 0x00D4
-, 0x0300
-, 0x00F4
-, 0x0300
-, 0x00D4
-, 0x0309
-, 0x00F4
-, 0x0309
-, 0x00D4
-, 0x0303
-, 0x00F4
-, 0x0303
-, 0x1ECC
-, 0x0302
-, 0x1ECD
-, 0x0302
-, 0x01A0
-, 0x0301
-, 0x01A1
-, 0x0301
-, 0x01A0
-, 0x0300
-, 0x01A1
-, 0x0300
-, 0x01A0
-, 0x0309
-, 0x01A1
-, 0x0309
-, 0x01A0
-, 0x0303
-, 0x01A1
-, 0x0303
-, 0x01A0
-, 0x0323
-, 0x01A1
-, 0x0323
-, 0x0055
-, 0x0323
-, 0x0075
-, 0x0323
-, 0x0055
-, 0x0309
-, 0x0075
-, 0x0309
-, 0x01AF
-, 0x0301
-, 0x01B0
-, 0x0301
-, 0x01AF
-, 0x0300
-, 0x01B0
-, 0x0300
-, 0x01AF
-, 0x0309
-, 0x01B0
-, 0x0309
-, 0x01AF
-, 0x0303
-, 0x01B0
-, 0x0303
-, 0x01AF
-, 0x0323
-, 0x01B0
-, 0x0323
-, 0x0059
-, 0x0300
-, 0x0079
-, 0x0300
-, 0x0059
-, 0x0323
-, 0x0079
-, 0x0323
-, 0x0059
-, 0x0309
-, 0x0079
-, 0x0309
-, 0x0059
-, 0x0303
-, 0x0079
-, 0x0303
-, 0x03B1
-, 0x0313
-, 0x03B1
-, 0x0314
-, 0x1F00
-, 0x0300
-, 0x1F01
-, 0x0300
-, 0x1F00
-, 0x0301
-, 0x1F01
-, 0x0301
-, 0x1F00
-, 0x0342
-, 0x1F01
-, 0x0342
-, 0x0391
-, 0x0313
-, 0x0391
-, 0x0314
-, 0x1F08
-, 0x0300
-, 0x1F09
-, 0x0300
-, 0x1F08
-, 0x0301
-, 0x1F09
-, 0x0301
-, 0x1F08
-, 0x0342
-, 0x1F09
-, 0x0342
-, 0x03B5
-, 0x0313
-, 0x03B5
-, 0x0314
-, 0x1F10
-, 0x0300
-, 0x1F11
-, 0x0300
-, 0x1F10
-, 0x0301
-, 0x1F11
-, 0x0301
-, 0x0395
-, 0x0313
-, 0x0395
-, 0x0314
-, 0x1F18
-, 0x0300
-, 0x1F19
-, 0x0300
-, 0x1F18
-, 0x0301
-, 0x1F19
-, 0x0301
-, 0x03B7
-, 0x0313
-, 0x03B7
-, 0x0314
-, 0x1F20
-, 0x0300
-, 0x1F21
-, 0x0300
-, 0x1F20
-, 0x0301
-, 0x1F21
-, 0x0301
-, 0x1F20
-, 0x0342
-, 0x1F21
-, 0x0342
-, 0x0397
-, 0x0313
-, 0x0397
-, 0x0314
-, 0x1F28
-, 0x0300
-, 0x1F29
-, 0x0300
-, 0x1F28
-, 0x0301
-, 0x1F29
-, 0x0301
-, 0x1F28
-, 0x0342
-, 0x1F29
-, 0x0342
-, 0x03B9
-, 0x0313
-, 0x03B9
-, 0x0314
-, 0x1F30
-, 0x0300
-, 0x1F31
-, 0x0300
-, 0x1F30
-, 0x0301
-, 0x1F31
-, 0x0301
-, 0x1F30
-, 0x0342
-, 0x1F31
-, 0x0342
-, 0x0399
-, 0x0313
-, 0x0399
-, 0x0314
-, 0x1F38
-, 0x0300
-, 0x1F39
-, 0x0300
-, 0x1F38
-, 0x0301
-, 0x1F39
-, 0x0301
-, 0x1F38
-, 0x0342
-, 0x1F39
-, 0x0342
-, 0x03BF
-, 0x0313
-, 0x03BF
-, 0x0314
-, 0x1F40
-, 0x0300
-, 0x1F41
-, 0x0300
-, 0x1F40
-, 0x0301
-, 0x1F41
-, 0x0301
-, 0x039F
-, 0x0313
-, 0x039F
-, 0x0314
-, 0x1F48
-, 0x0300
-, 0x1F49
-, 0x0300
-, 0x1F48
-, 0x0301
-, 0x1F49
-, 0x0301
-, 0x03C5
-, 0x0313
-, 0x03C5
-, 0x0314
-, 0x1F50
-, 0x0300
-, 0x1F51
-, 0x0300
-, 0x1F50
-, 0x0301
-, 0x1F51
-, 0x0301
-, 0x1F50
-, 0x0342
-, 0x1F51
-, 0x0342
-, 0x03A5
-, 0x0314
-, 0x1F59
-, 0x0300
-, 0x1F59
-, 0x0301
-, 0x1F59
-, 0x0342
-, 0x03C9
-, 0x0313
-, 0x03C9
-, 0x0314
-, 0x1F60
-, 0x0300
-, 0x1F61
-, 0x0300
-, 0x1F60
-, 0x0301
-, 0x1F61
-, 0x0301
-, 0x1F60
-, 0x0342
-, 0x1F61
-, 0x0342
-, 0x03A9
-, 0x0313
-, 0x03A9
-, 0x0314
-, 0x1F68
-, 0x0300
-, 0x1F69
-, 0x0300
-, 0x1F68
-, 0x0301
-, 0x1F69
-, 0x0301
-, 0x1F68
-, 0x0342
-, 0x1F69
-, 0x0342
-, 0x03B1
-, 0x0300
-, 0x03AC
-, 0x03B5
-, 0x0300
-, 0x03AD
-, 0x03B7
-, 0x0300
-, 0x03AE
-, 0x03B9
-, 0x0300
-, 0x03AF
-, 0x03BF
-, 0x0300
-, 0x03CC
-, 0x03C5
-, 0x0300
-, 0x03CD
-, 0x03C9
-, 0x0300
-, 0x03CE
-, 0x1F00
-, 0x0345
-, 0x1F01
-, 0x0345
-, 0x1F02
-, 0x0345
-, 0x1F03
-, 0x0345
-, 0x1F04
-, 0x0345
-, 0x1F05
-, 0x0345
-, 0x1F06
-, 0x0345
-, 0x1F07
-, 0x0345
-, 0x1F08
-, 0x0345
-, 0x1F09
-, 0x0345
-, 0x1F0A
-, 0x0345
-, 0x1F0B
-, 0x0345
-, 0x1F0C
-, 0x0345
-, 0x1F0D
-, 0x0345
-, 0x1F0E
-, 0x0345
-, 0x1F0F
-, 0x0345
-, 0x1F20
-, 0x0345
-, 0x1F21
-, 0x0345
-, 0x1F22
-, 0x0345
-, 0x1F23
-, 0x0345
-, 0x1F24
-, 0x0345
-, 0x1F25
-, 0x0345
-, 0x1F26
-, 0x0345
-, 0x1F27
-, 0x0345
-, 0x1F28
-, 0x0345
-, 0x1F29
-, 0x0345
-, 0x1F2A
-, 0x0345
-, 0x1F2B
-, 0x0345
-, 0x1F2C
-, 0x0345
-, 0x1F2D
-, 0x0345
-, 0x1F2E
-, 0x0345
-, 0x1F2F
-, 0x0345
-, 0x1F60
-, 0x0345
-, 0x1F61
-, 0x0345
-, 0x1F62
-, 0x0345
-, 0x1F63
-, 0x0345
-, 0x1F64
-, 0x0345
-, 0x1F65
-, 0x0345
-, 0x1F66
-, 0x0345
-, 0x1F67
-, 0x0345
-, 0x1F68
-, 0x0345
-, 0x1F69
-, 0x0345
-, 0x1F6A
-, 0x0345
-, 0x1F6B
-, 0x0345
-, 0x1F6C
-, 0x0345
-, 0x1F6D
-, 0x0345
-, 0x1F6E
-, 0x0345
-, 0x1F6F
-, 0x0345
-, 0x03B1
-, 0x0306
-, 0x03B1
-, 0x0304
-, 0x1F70
-, 0x0345
-, 0x03B1
-, 0x0345
-, 0x03AC
-, 0x0345
-, 0x03B1
-, 0x0342
-, 0x1FB6
-, 0x0345
-, 0x0391
-, 0x0306
-, 0x0391
-, 0x0304
-, 0x0391
-, 0x0300
-, 0x0386
-, 0x0391
-, 0x0345
-, 0x0020
-, 0x0313
-, 0x03B9
-, 0x0020
-, 0x0313
-, 0x0020
-, 0x0342
-, 0x00A8
-, 0x0342
-, 0x1F74
-, 0x0345
-, 0x03B7
-, 0x0345
-, 0x03AE
-, 0x0345
-, 0x03B7
-, 0x0342
-, 0x1FC6
-, 0x0345
-, 0x0395
-, 0x0300
-, 0x0388
-, 0x0397
-, 0x0300
-, 0x0389
-, 0x0397
-, 0x0345
-, 0x1FBF
-, 0x0300
-, 0x1FBF
-, 0x0301
-, 0x1FBF
-, 0x0342
-, 0x03B9
-, 0x0306
-, 0x03B9
-, 0x0304
-, 0x03CA
-, 0x0300
-, 0x0390
-, 0x03B9
-, 0x0342
-, 0x03CA
-, 0x0342
-, 0x0399
-, 0x0306
-, 0x0399
-, 0x0304
-, 0x0399
-, 0x0300
-, 0x038A
-, 0x1FFE
-, 0x0300
-, 0x1FFE
-, 0x0301
-, 0x1FFE
-, 0x0342
-, 0x03C5
-, 0x0306
-, 0x03C5
-, 0x0304
-, 0x03CB
-, 0x0300
-, 0x03B0
-, 0x03C1
-, 0x0313
-, 0x03C1
-, 0x0314
-, 0x03C5
-, 0x0342
-, 0x03CB
-, 0x0342
-, 0x03A5
-, 0x0306
-, 0x03A5
-, 0x0304
-, 0x03A5
-, 0x0300
-, 0x038E
-, 0x03A1
-, 0x0314
-, 0x00A8
-, 0x0300
-, 0x0385
-, 0x0060
-, 0x1F7C
-, 0x0345
-, 0x03C9
-, 0x0345
-, 0x03CE
-, 0x0345
-, 0x03C9
-, 0x0342
-, 0x1FF6
-, 0x0345
-, 0x039F
-, 0x0300
-, 0x038C
-, 0x03A9
-, 0x0300
-, 0x038F
-, 0x03A9
-, 0x0345
-, 0x00B4
-, 0x0020
-, 0x0314
-, 0x2002
-, 0x2003
-, 0x0020
-, 0x0020
-, 0x0020
-, 0x0020
-, 0x0020
-, 0x0020
-, 0x0020
-, 0x0020
-, 0x0020
-, 0x2010
-, 0x0020
-, 0x0333
-, 0x002E
-, 0x002E
-, 0x002E
-, 0x002E
-, 0x002E
-, 0x002E
-, 0x0020
-, 0x2032
-, 0x2032
-, 0x2032
-, 0x2032
-, 0x2032
-, 0x2035
-, 0x2035
-, 0x2035
-, 0x2035
-, 0x2035
-, 0x0021
-, 0x0021
-, 0x0020
-, 0x0305
-, 0x003F
-, 0x003F
-, 0x003F
-, 0x0021
-, 0x0021
-, 0x003F
-, 0x2032
-, 0x2032
-, 0x2032
-, 0x2032
-, 0x0020
-, 0x0030
-, 0x0069
-, 0x0034
-, 0x0035
-, 0x0036
-, 0x0037
-, 0x0038
-, 0x0039
-, 0x002B
-, 0x2212
-, 0x003D
-, 0x0028
-, 0x0029
-, 0x006E
-, 0x0030
-, 0x0031
-, 0x0032
-, 0x0033
-, 0x0034
-, 0x0035
-, 0x0036
-, 0x0037
-, 0x0038
-, 0x0039
-, 0x002B
-, 0x2212
-, 0x003D
-, 0x0028
-, 0x0029
-, 0x0061
-, 0x0065
-, 0x006F
-, 0x0078
-, 0x0259
-, 0x0068
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x0070
-, 0x0073
-, 0x0074
-, 0x0052
-, 0x0073
-, 0x0061
-, 0x002F
-, 0x0063
-, 0x0061
-, 0x002F
-, 0x0073
-, 0x0043
-, 0x00B0
-, 0x0043
-, 0x0063
-, 0x002F
-, 0x006F
-, 0x0063
-, 0x002F
-, 0x0075
-, 0x0190
-, 0x00B0
-, 0x0046
-, 0x0067
-, 0x0048
-, 0x0048
-, 0x0048
-, 0x0068
-, 0x0127
-, 0x0049
-, 0x0049
-, 0x004C
-, 0x006C
-, 0x004E
-, 0x004E
-, 0x006F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0052
-, 0x0052
-, 0x0053
-, 0x004D
-, 0x0054
-, 0x0045
-, 0x004C
-, 0x0054
-, 0x004D
-, 0x005A
-, 0x03A9
-, 0x005A
-, 0x004B
-, 0x00C5
-, 0x0042
-, 0x0043
-, 0x0065
-, 0x0045
-, 0x0046
-, 0x004D
-, 0x006F
-, 0x05D0
-, 0x05D1
-, 0x05D2
-, 0x05D3
-, 0x0069
-, 0x0046
-, 0x0041
-, 0x0058
-, 0x03C0
-, 0x03B3
-, 0x0393
-, 0x03A0
-, 0x2211
-, 0x0044
-, 0x0064
-, 0x0065
-, 0x0069
-, 0x006A
-, 0x0031
-, 0x2044
-, 0x0037
-, 0x0031
-, 0x2044
-, 0x0039
-, 0x0031
-, 0x2044
-, 0x0031
-, 0x0030
-, 0x0031
-, 0x2044
-, 0x0033
-, 0x0032
-, 0x2044
-, 0x0033
-, 0x0031
-, 0x2044
-, 0x0035
-, 0x0032
-, 0x2044
-, 0x0035
-, 0x0033
-, 0x2044
-, 0x0035
-, 0x0034
-, 0x2044
-, 0x0035
-, 0x0031
-, 0x2044
-, 0x0036
-, 0x0035
-, 0x2044
-, 0x0036
-, 0x0031
-, 0x2044
-, 0x0038
-, 0x0033
-, 0x2044
-, 0x0038
-, 0x0035
-, 0x2044
-, 0x0038
-, 0x0037
-, 0x2044
-, 0x0038
-, 0x0031
-, 0x2044
-, 0x0049
-, 0x0049
-, 0x0049
-, 0x0049
-, 0x0049
-, 0x0049
-, 0x0049
-, 0x0056
-, 0x0056
-, 0x0056
-, 0x0049
-, 0x0056
-, 0x0049
-, 0x0049
-, 0x0056
-, 0x0049
-, 0x0049
-, 0x0049
-, 0x0049
-, 0x0058
-, 0x0058
-, 0x0058
-, 0x0049
-, 0x0058
-, 0x0049
-, 0x0049
-, 0x004C
-, 0x0043
-, 0x0044
-, 0x004D
-, 0x0069
-, 0x0069
-, 0x0069
-, 0x0069
-, 0x0069
-, 0x0069
-, 0x0069
-, 0x0076
-, 0x0076
-, 0x0076
-, 0x0069
-, 0x0076
-, 0x0069
-, 0x0069
-, 0x0076
-, 0x0069
-, 0x0069
-, 0x0069
-, 0x0069
-, 0x0078
-, 0x0078
-, 0x0078
-, 0x0069
-, 0x0078
-, 0x0069
-, 0x0069
-, 0x006C
-, 0x0063
-, 0x0064
-, 0x006D
-, 0x0030
-, 0x2044
-, 0x0033
-, 0x2190
-, 0x0338
-, 0x2192
-, 0x0338
-, 0x2194
-, 0x0338
-, 0x21D0
-, 0x0338
-, 0x21D4
-, 0x0338
-, 0x21D2
-, 0x0338
-, 0x2203
-, 0x0338
-, 0x2208
-, 0x0338
-, 0x220B
-, 0x0338
-, 0x2223
-, 0x0338
-, 0x2225
-, 0x0338
-, 0x222B
-, 0x222B
-, 0x222B
-, 0x222B
-, 0x222B
-, 0x222E
-, 0x222E
-, 0x222E
-, 0x222E
-, 0x222E
-, 0x223C
-, 0x0338
-, 0x2243
-, 0x0338
-, 0x2245
-, 0x0338
-, 0x2248
-, 0x0338
-, 0x003D
-, 0x0338
-, 0x2261
-, 0x0338
-, 0x224D
-, 0x0338
-, 0x003C
-, 0x0338
-, 0x003E
-, 0x0338
-, 0x2264
-, 0x0338
-, 0x2265
-, 0x0338
-, 0x2272
-, 0x0338
-, 0x2273
-, 0x0338
-, 0x2276
-, 0x0338
-, 0x2277
-, 0x0338
-, 0x227A
-, 0x0338
-, 0x227B
-, 0x0338
-, 0x2282
-, 0x0338
-, 0x2283
-, 0x0338
-, 0x2286
-, 0x0338
-, 0x2287
-, 0x0338
-, 0x22A2
-, 0x0338
-, 0x22A8
-, 0x0338
-, 0x22A9
-, 0x0338
-, 0x22AB
-, 0x0338
-, 0x227C
-, 0x0338
-, 0x227D
-, 0x0338
-, 0x2291
-, 0x0338
-, 0x2292
-, 0x0338
-, 0x22B2
-, 0x0338
-, 0x22B3
-, 0x0338
-, 0x22B4
-, 0x0338
-, 0x22B5
-, 0x0338
-, 0x3008
-, 0x3009
-, 0x0031
-, 0x0032
-, 0x0033
-, 0x0034
-, 0x0035
-, 0x0036
-, 0x0037
-, 0x0038
-, 0x0039
-, 0x0031
-, 0x0030
-, 0x0031
-, 0x0031
-, 0x0031
-, 0x0032
-, 0x0031
-, 0x0033
-, 0x0031
-, 0x0034
-, 0x0031
-, 0x0035
-, 0x0031
-, 0x0036
-, 0x0031
-, 0x0037
-, 0x0031
-, 0x0038
-, 0x0031
-, 0x0039
-, 0x0032
-, 0x0030
-, 0x0028
-, 0x0031
-, 0x0029
-, 0x0028
-, 0x0032
-, 0x0029
-, 0x0028
-, 0x0033
-, 0x0029
-, 0x0028
-, 0x0034
-, 0x0029
-, 0x0028
-, 0x0035
-, 0x0029
-, 0x0028
-, 0x0036
-, 0x0029
-, 0x0028
-, 0x0037
-, 0x0029
-, 0x0028
-, 0x0038
-, 0x0029
-, 0x0028
-, 0x0039
-, 0x0029
-, 0x0028
-, 0x0031
-, 0x0030
-, 0x0029
-, 0x0028
-, 0x0031
-, 0x0031
-, 0x0029
-, 0x0028
-, 0x0031
-, 0x0032
-, 0x0029
-, 0x0028
-, 0x0031
-, 0x0033
-, 0x0029
-, 0x0028
-, 0x0031
-, 0x0034
-, 0x0029
-, 0x0028
-, 0x0031
-, 0x0035
-, 0x0029
-, 0x0028
-, 0x0031
-, 0x0036
-, 0x0029
-, 0x0028
-, 0x0031
-, 0x0037
-, 0x0029
-, 0x0028
-, 0x0031
-, 0x0038
-, 0x0029
-, 0x0028
-, 0x0031
-, 0x0039
-, 0x0029
-, 0x0028
-, 0x0032
-, 0x0030
-, 0x0029
-, 0x0031
-, 0x002E
-, 0x0032
-, 0x002E
-, 0x0033
-, 0x002E
-, 0x0034
-, 0x002E
-, 0x0035
-, 0x002E
-, 0x0036
-, 0x002E
-, 0x0037
-, 0x002E
-, 0x0038
-, 0x002E
-, 0x0039
-, 0x002E
-, 0x0031
-, 0x0030
-, 0x002E
-, 0x0031
-, 0x0031
-, 0x002E
-, 0x0031
-, 0x0032
-, 0x002E
-, 0x0031
-, 0x0033
-, 0x002E
-, 0x0031
-, 0x0034
-, 0x002E
-, 0x0031
-, 0x0035
-, 0x002E
-, 0x0031
-, 0x0036
-, 0x002E
-, 0x0031
-, 0x0037
-, 0x002E
-, 0x0031
-, 0x0038
-, 0x002E
-, 0x0031
-, 0x0039
-, 0x002E
-, 0x0032
-, 0x0030
-, 0x002E
-, 0x0028
-, 0x0061
-, 0x0029
-, 0x0028
-, 0x0062
-, 0x0029
-, 0x0028
-, 0x0063
-, 0x0029
-, 0x0028
-, 0x0064
-, 0x0029
-, 0x0028
-, 0x0065
-, 0x0029
-, 0x0028
-, 0x0066
-, 0x0029
-, 0x0028
-, 0x0067
-, 0x0029
-, 0x0028
-, 0x0068
-, 0x0029
-, 0x0028
-, 0x0069
-, 0x0029
-, 0x0028
-, 0x006A
-, 0x0029
-, 0x0028
-, 0x006B
-, 0x0029
-, 0x0028
-, 0x006C
-, 0x0029
-, 0x0028
-, 0x006D
-, 0x0029
-, 0x0028
-, 0x006E
-, 0x0029
-, 0x0028
-, 0x006F
-, 0x0029
-, 0x0028
-, 0x0070
-, 0x0029
-, 0x0028
-, 0x0071
-, 0x0029
-, 0x0028
-, 0x0072
-, 0x0029
-, 0x0028
-, 0x0073
-, 0x0029
-, 0x0028
-, 0x0074
-, 0x0029
-, 0x0028
-, 0x0075
-, 0x0029
-, 0x0028
-, 0x0076
-, 0x0029
-, 0x0028
-, 0x0077
-, 0x0029
-, 0x0028
-, 0x0078
-, 0x0029
-, 0x0028
-, 0x0079
-, 0x0029
-, 0x0028
-, 0x007A
-, 0x0029
-, 0x0041
-, 0x0042
-, 0x0043
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0030
-, 0x222B
-, 0x222B
-, 0x222B
-, 0x222B
-, 0x003A
-, 0x003A
-, 0x003D
-, 0x003D
-, 0x003D
-, 0x003D
-, 0x003D
-, 0x003D
-, 0x2ADD
-, 0x0338
-, 0x006A
-, 0x0056
-, 0x2D61
-, 0x6BCD
-, 0x9F9F
-, 0x4E00
-, 0x4E28
-, 0x4E36
-, 0x4E3F
-, 0x4E59
-, 0x4E85
-, 0x4E8C
-, 0x4EA0
-, 0x4EBA
-, 0x513F
-, 0x5165
-, 0x516B
-, 0x5182
-, 0x5196
-, 0x51AB
-, 0x51E0
-, 0x51F5
-, 0x5200
-, 0x529B
-, 0x52F9
-, 0x5315
-, 0x531A
-, 0x5338
-, 0x5341
-, 0x535C
-, 0x5369
-, 0x5382
-, 0x53B6
-, 0x53C8
-, 0x53E3
-, 0x56D7
-, 0x571F
-, 0x58EB
-, 0x5902
-, 0x590A
-, 0x5915
-, 0x5927
-, 0x5973
-, 0x5B50
-, 0x5B80
-, 0x5BF8
-, 0x5C0F
-, 0x5C22
-, 0x5C38
-, 0x5C6E
-, 0x5C71
-, 0x5DDB
-, 0x5DE5
-, 0x5DF1
-, 0x5DFE
-, 0x5E72
-, 0x5E7A
-, 0x5E7F
-, 0x5EF4
-, 0x5EFE
-, 0x5F0B
-, 0x5F13
-, 0x5F50
-, 0x5F61
-, 0x5F73
-, 0x5FC3
-, 0x6208
-, 0x6236
-, 0x624B
-, 0x652F
-, 0x6534
-, 0x6587
-, 0x6597
-, 0x65A4
-, 0x65B9
-, 0x65E0
-, 0x65E5
-, 0x66F0
-, 0x6708
-, 0x6728
-, 0x6B20
-, 0x6B62
-, 0x6B79
-, 0x6BB3
-, 0x6BCB
-, 0x6BD4
-, 0x6BDB
-, 0x6C0F
-, 0x6C14
-, 0x6C34
-, 0x706B
-, 0x722A
-, 0x7236
-, 0x723B
-, 0x723F
-, 0x7247
-, 0x7259
-, 0x725B
-, 0x72AC
-, 0x7384
-, 0x7389
-, 0x74DC
-, 0x74E6
-, 0x7518
-, 0x751F
-, 0x7528
-, 0x7530
-, 0x758B
-, 0x7592
-, 0x7676
-, 0x767D
-, 0x76AE
-, 0x76BF
-, 0x76EE
-, 0x77DB
-, 0x77E2
-, 0x77F3
-, 0x793A
-, 0x79B8
-, 0x79BE
-, 0x7A74
-, 0x7ACB
-, 0x7AF9
-, 0x7C73
-, 0x7CF8
-, 0x7F36
-, 0x7F51
-, 0x7F8A
-, 0x7FBD
-, 0x8001
-, 0x800C
-, 0x8012
-, 0x8033
-, 0x807F
-, 0x8089
-, 0x81E3
-, 0x81EA
-, 0x81F3
-, 0x81FC
-, 0x820C
-, 0x821B
-, 0x821F
-, 0x826E
-, 0x8272
-, 0x8278
-, 0x864D
-, 0x866B
-, 0x8840
-, 0x884C
-, 0x8863
-, 0x897E
-, 0x898B
-, 0x89D2
-, 0x8A00
-, 0x8C37
-, 0x8C46
-, 0x8C55
-, 0x8C78
-, 0x8C9D
-, 0x8D64
-, 0x8D70
-, 0x8DB3
-, 0x8EAB
-, 0x8ECA
-, 0x8F9B
-, 0x8FB0
-, 0x8FB5
-, 0x9091
-, 0x9149
-, 0x91C6
-, 0x91CC
-, 0x91D1
-, 0x9577
-, 0x9580
-, 0x961C
-, 0x96B6
-, 0x96B9
-, 0x96E8
-, 0x9751
-, 0x975E
-, 0x9762
-, 0x9769
-, 0x97CB
-, 0x97ED
-, 0x97F3
-, 0x9801
-, 0x98A8
-, 0x98DB
-, 0x98DF
-, 0x9996
-, 0x9999
-, 0x99AC
-, 0x9AA8
-, 0x9AD8
-, 0x9ADF
-, 0x9B25
-, 0x9B2F
-, 0x9B32
-, 0x9B3C
-, 0x9B5A
-, 0x9CE5
-, 0x9E75
-, 0x9E7F
-, 0x9EA5
-, 0x9EBB
-, 0x9EC3
-, 0x9ECD
-, 0x9ED1
-, 0x9EF9
-, 0x9EFD
-, 0x9F0E
-, 0x9F13
-, 0x9F20
-, 0x9F3B
-, 0x9F4A
-, 0x9F52
-, 0x9F8D
-, 0x9F9C
-, 0x9FA0
-, 0x0020
-, 0x3012
-, 0x5341
-, 0x5344
-, 0x5345
-, 0x304B
-, 0x3099
-, 0x304D
-, 0x3099
-, 0x304F
-, 0x3099
-, 0x3051
-, 0x3099
-, 0x3053
-, 0x3099
-, 0x3055
-, 0x3099
-, 0x3057
-, 0x3099
-, 0x3059
-, 0x3099
-, 0x305B
-, 0x3099
-, 0x305D
-, 0x3099
-, 0x305F
-, 0x3099
-, 0x3061
-, 0x3099
-, 0x3064
-, 0x3099
-, 0x3066
-, 0x3099
-, 0x3068
-, 0x3099
-, 0x306F
-, 0x3099
-, 0x306F
-, 0x309A
-, 0x3072
-, 0x3099
-, 0x3072
-, 0x309A
-, 0x3075
-, 0x3099
-, 0x3075
-, 0x309A
-, 0x3078
-, 0x3099
-, 0x3078
-, 0x309A
-, 0x307B
-, 0x3099
-, 0x307B
-, 0x309A
-, 0x3046
-, 0x3099
-, 0x0020
-, 0x3099
-, 0x0020
-, 0x309A
-, 0x309D
-, 0x3099
-, 0x3088
-, 0x308A
-, 0x30AB
-, 0x3099
-, 0x30AD
-, 0x3099
-, 0x30AF
-, 0x3099
-, 0x30B1
-, 0x3099
-, 0x30B3
-, 0x3099
-, 0x30B5
-, 0x3099
-, 0x30B7
-, 0x3099
-, 0x30B9
-, 0x3099
-, 0x30BB
-, 0x3099
-, 0x30BD
-, 0x3099
-, 0x30BF
-, 0x3099
-, 0x30C1
-, 0x3099
-, 0x30C4
-, 0x3099
-, 0x30C6
-, 0x3099
-, 0x30C8
-, 0x3099
-, 0x30CF
-, 0x3099
-, 0x30CF
-, 0x309A
-, 0x30D2
-, 0x3099
-, 0x30D2
-, 0x309A
-, 0x30D5
-, 0x3099
-, 0x30D5
-, 0x309A
-, 0x30D8
-, 0x3099
-, 0x30D8
-, 0x309A
-, 0x30DB
-, 0x3099
-, 0x30DB
-, 0x309A
-, 0x30A6
-, 0x3099
-, 0x30EF
-, 0x3099
-, 0x30F0
-, 0x3099
-, 0x30F1
-, 0x3099
-, 0x30F2
-, 0x3099
-, 0x30FD
-, 0x3099
-, 0x30B3
-, 0x30C8
-, 0x1100
-, 0x1101
-, 0x11AA
-, 0x1102
-, 0x11AC
-, 0x11AD
-, 0x1103
-, 0x1104
-, 0x1105
-, 0x11B0
-, 0x11B1
-, 0x11B2
-, 0x11B3
-, 0x11B4
-, 0x11B5
-, 0x111A
-, 0x1106
-, 0x1107
-, 0x1108
-, 0x1121
-, 0x1109
-, 0x110A
-, 0x110B
-, 0x110C
-, 0x110D
-, 0x110E
-, 0x110F
-, 0x1110
-, 0x1111
-, 0x1112
-, 0x1161
-, 0x1162
-, 0x1163
-, 0x1164
-, 0x1165
-, 0x1166
-, 0x1167
-, 0x1168
-, 0x1169
-, 0x116A
-, 0x116B
-, 0x116C
-, 0x116D
-, 0x116E
-, 0x116F
-, 0x1170
-, 0x1171
-, 0x1172
-, 0x1173
-, 0x1174
-, 0x1175
-, 0x1160
-, 0x1114
-, 0x1115
-, 0x11C7
-, 0x11C8
-, 0x11CC
-, 0x11CE
-, 0x11D3
-, 0x11D7
-, 0x11D9
-, 0x111C
-, 0x11DD
-, 0x11DF
-, 0x111D
-, 0x111E
-, 0x1120
-, 0x1122
-, 0x1123
-, 0x1127
-, 0x1129
-, 0x112B
-, 0x112C
-, 0x112D
-, 0x112E
-, 0x112F
-, 0x1132
-, 0x1136
-, 0x1140
-, 0x1147
-, 0x114C
-, 0x11F1
-, 0x11F2
-, 0x1157
-, 0x1158
-, 0x1159
-, 0x1184
-, 0x1185
-, 0x1188
-, 0x1191
-, 0x1192
-, 0x1194
-, 0x119E
-, 0x11A1
-, 0x4E00
-, 0x4E8C
-, 0x4E09
-, 0x56DB
-, 0x4E0A
-, 0x4E2D
-, 0x4E0B
-, 0x7532
-, 0x4E59
-, 0x4E19
-, 0x4E01
-, 0x5929
-, 0x5730
-, 0x4EBA
-, 0x0028
-, 0x1100
-, 0x0029
-, 0x0028
-, 0x1102
-, 0x0029
-, 0x0028
-, 0x1103
-, 0x0029
-, 0x0028
-, 0x1105
-, 0x0029
-, 0x0028
-, 0x1106
-, 0x0029
-, 0x0028
-, 0x1107
-, 0x0029
-, 0x0028
-, 0x1109
-, 0x0029
-, 0x0028
-, 0x110B
-, 0x0029
-, 0x0028
-, 0x110C
-, 0x0029
-, 0x0028
-, 0x110E
-, 0x0029
-, 0x0028
-, 0x110F
-, 0x0029
-, 0x0028
-, 0x1110
-, 0x0029
-, 0x0028
-, 0x1111
-, 0x0029
-, 0x0028
-, 0x1112
-, 0x0029
-, 0x0028
-, 0x1100
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x1102
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x1103
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x1105
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x1106
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x1107
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x1109
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x110B
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x110C
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x110E
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x110F
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x1110
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x1111
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x1112
-, 0x1161
-, 0x0029
-, 0x0028
-, 0x110C
-, 0x116E
-, 0x0029
-, 0x0028
-, 0x110B
-, 0x1169
-, 0x110C
-, 0x1165
-, 0x11AB
-, 0x0029
-, 0x0028
-, 0x110B
-, 0x1169
-, 0x1112
-, 0x116E
-, 0x0029
-, 0x0028
-, 0x4E00
-, 0x0029
-, 0x0028
-, 0x4E8C
-, 0x0029
-, 0x0028
-, 0x4E09
-, 0x0029
-, 0x0028
-, 0x56DB
-, 0x0029
-, 0x0028
-, 0x4E94
-, 0x0029
-, 0x0028
-, 0x516D
-, 0x0029
-, 0x0028
-, 0x4E03
-, 0x0029
-, 0x0028
-, 0x516B
-, 0x0029
-, 0x0028
-, 0x4E5D
-, 0x0029
-, 0x0028
-, 0x5341
-, 0x0029
-, 0x0028
-, 0x6708
-, 0x0029
-, 0x0028
-, 0x706B
-, 0x0029
-, 0x0028
-, 0x6C34
-, 0x0029
-, 0x0028
-, 0x6728
-, 0x0029
-, 0x0028
-, 0x91D1
-, 0x0029
-, 0x0028
-, 0x571F
-, 0x0029
-, 0x0028
-, 0x65E5
-, 0x0029
-, 0x0028
-, 0x682A
-, 0x0029
-, 0x0028
-, 0x6709
-, 0x0029
-, 0x0028
-, 0x793E
-, 0x0029
-, 0x0028
-, 0x540D
-, 0x0029
-, 0x0028
-, 0x7279
-, 0x0029
-, 0x0028
-, 0x8CA1
-, 0x0029
-, 0x0028
-, 0x795D
-, 0x0029
-, 0x0028
-, 0x52B4
-, 0x0029
-, 0x0028
-, 0x4EE3
-, 0x0029
-, 0x0028
-, 0x547C
-, 0x0029
-, 0x0028
-, 0x5B66
-, 0x0029
-, 0x0028
-, 0x76E3
-, 0x0029
-, 0x0028
-, 0x4F01
-, 0x0029
-, 0x0028
-, 0x8CC7
-, 0x0029
-, 0x0028
-, 0x5354
-, 0x0029
-, 0x0028
-, 0x796D
-, 0x0029
-, 0x0028
-, 0x4F11
-, 0x0029
-, 0x0028
-, 0x81EA
-, 0x0029
-, 0x0028
-, 0x81F3
-, 0x0029
-, 0x554F
-, 0x5E7C
-, 0x6587
-, 0x7B8F
-, 0x0050
-, 0x0054
-, 0x0045
-, 0x0032
-, 0x0031
-, 0x0032
-, 0x0032
-, 0x0032
-, 0x0033
-, 0x0032
-, 0x0034
-, 0x0032
-, 0x0035
-, 0x0032
-, 0x0036
-, 0x0032
-, 0x0037
-, 0x0032
-, 0x0038
-, 0x0032
-, 0x0039
-, 0x0033
-, 0x0030
-, 0x0033
-, 0x0031
-, 0x0033
-, 0x0032
-, 0x0033
-, 0x0033
-, 0x0033
-, 0x0034
-, 0x0033
-, 0x0035
-, 0x1100
-, 0x1102
-, 0x1103
-, 0x1105
-, 0x1106
-, 0x1107
-, 0x1109
-, 0x110B
-, 0x110C
-, 0x110E
-, 0x110F
-, 0x1110
-, 0x1111
-, 0x1112
-, 0x1100
-, 0x1161
-, 0x1102
-, 0x1161
-, 0x1103
-, 0x1161
-, 0x1105
-, 0x1161
-, 0x1106
-, 0x1161
-, 0x1107
-, 0x1161
-, 0x1109
-, 0x1161
-, 0x110B
-, 0x1161
-, 0x110C
-, 0x1161
-, 0x110E
-, 0x1161
-, 0x110F
-, 0x1161
-, 0x1110
-, 0x1161
-, 0x1111
-, 0x1161
-, 0x1112
-, 0x1161
-, 0x110E
-, 0x1161
-, 0x11B7
-, 0x1100
-, 0x1169
-, 0x110C
-, 0x116E
-, 0x110B
-, 0x1174
-, 0x110B
-, 0x116E
-, 0x4E00
-, 0x4E8C
-, 0x4E09
-, 0x56DB
-, 0x4E94
-, 0x516D
-, 0x4E03
-, 0x516B
-, 0x4E5D
-, 0x5341
-, 0x6708
-, 0x706B
-, 0x6C34
-, 0x6728
-, 0x91D1
-, 0x571F
-, 0x65E5
-, 0x682A
-, 0x6709
-, 0x793E
-, 0x540D
-, 0x7279
-, 0x8CA1
-, 0x795D
-, 0x52B4
-, 0x79D8
-, 0x7537
-, 0x5973
-, 0x9069
-, 0x512A
-, 0x5370
-, 0x6CE8
-, 0x9805
-, 0x4F11
-, 0x5199
-, 0x6B63
-, 0x4E0A
-, 0x4E2D
-, 0x4E0B
-, 0x5DE6
-, 0x53F3
-, 0x533B
-, 0x5B97
-, 0x5B66
-, 0x76E3
-, 0x4F01
-, 0x8CC7
-, 0x5354
-, 0x591C
-, 0x0033
-, 0x0036
-, 0x0033
-, 0x0037
-, 0x0033
-, 0x0038
-, 0x0033
-, 0x0039
-, 0x0034
-, 0x0030
-, 0x0034
-, 0x0031
-, 0x0034
-, 0x0032
-, 0x0034
-, 0x0033
-, 0x0034
-, 0x0034
-, 0x0034
-, 0x0035
-, 0x0034
-, 0x0036
-, 0x0034
-, 0x0037
-, 0x0034
-, 0x0038
-, 0x0034
-, 0x0039
-, 0x0035
-, 0x0030
-, 0x0031
-, 0x6708
-, 0x0032
-, 0x6708
-, 0x0033
-, 0x6708
-, 0x0034
-, 0x6708
-, 0x0035
-, 0x6708
-, 0x0036
-, 0x6708
-, 0x0037
-, 0x6708
-, 0x0038
-, 0x6708
-, 0x0039
-, 0x6708
-, 0x0031
-, 0x0030
-, 0x6708
-, 0x0031
-, 0x0031
-, 0x6708
-, 0x0031
-, 0x0032
-, 0x6708
-, 0x0048
-, 0x0067
-, 0x0065
-, 0x0072
-, 0x0067
-, 0x0065
-, 0x0056
-, 0x004C
-, 0x0054
-, 0x0044
-, 0x30A2
-, 0x30A4
-, 0x30A6
-, 0x30A8
-, 0x30AA
-, 0x30AB
-, 0x30AD
-, 0x30AF
-, 0x30B1
-, 0x30B3
-, 0x30B5
-, 0x30B7
-, 0x30B9
-, 0x30BB
-, 0x30BD
-, 0x30BF
-, 0x30C1
-, 0x30C4
-, 0x30C6
-, 0x30C8
-, 0x30CA
-, 0x30CB
-, 0x30CC
-, 0x30CD
-, 0x30CE
-, 0x30CF
-, 0x30D2
-, 0x30D5
-, 0x30D8
-, 0x30DB
-, 0x30DE
-, 0x30DF
-, 0x30E0
-, 0x30E1
-, 0x30E2
-, 0x30E4
-, 0x30E6
-, 0x30E8
-, 0x30E9
-, 0x30EA
-, 0x30EB
-, 0x30EC
-, 0x30ED
-, 0x30EF
-, 0x30F0
-, 0x30F1
-, 0x30F2
-, 0x4EE4
-, 0x548C
-, 0x30A2
-, 0x30D1
-, 0x30FC
-, 0x30C8
-, 0x30A2
-, 0x30EB
-, 0x30D5
-, 0x30A1
-, 0x30A2
-, 0x30F3
-, 0x30DA
-, 0x30A2
-, 0x30A2
-, 0x30FC
-, 0x30EB
-, 0x30A4
-, 0x30CB
-, 0x30F3
-, 0x30B0
-, 0x30A4
-, 0x30F3
-, 0x30C1
-, 0x30A6
-, 0x30A9
-, 0x30F3
-, 0x30A8
-, 0x30B9
-, 0x30AF
-, 0x30FC
-, 0x30C9
-, 0x30A8
-, 0x30FC
-, 0x30AB
-, 0x30FC
-, 0x30AA
-, 0x30F3
-, 0x30B9
-, 0x30AA
-, 0x30FC
-, 0x30E0
-, 0x30AB
-, 0x30A4
-, 0x30EA
-, 0x30AB
-, 0x30E9
-, 0x30C3
-, 0x30C8
-, 0x30AB
-, 0x30ED
-, 0x30EA
-, 0x30FC
-, 0x30AC
-, 0x30ED
-, 0x30F3
-, 0x30AC
-, 0x30F3
-, 0x30DE
-, 0x30AE
-, 0x30AC
-, 0x30AE
-, 0x30CB
-, 0x30FC
-, 0x30AD
-, 0x30E5
-, 0x30EA
-, 0x30FC
-, 0x30AE
-, 0x30EB
-, 0x30C0
-, 0x30FC
-, 0x30AD
-, 0x30ED
-, 0x30AD
-, 0x30ED
-, 0x30B0
-, 0x30E9
-, 0x30E0
-, 0x30AD
-, 0x30ED
-, 0x30E1
-, 0x30FC
-, 0x30C8
-, 0x30EB
-, 0x30AD
-, 0x30ED
-, 0x30EF
-, 0x30C3
-, 0x30C8
-, 0x30B0
-, 0x30E9
-, 0x30E0
-, 0x30B0
-, 0x30E9
-, 0x30E0
-, 0x30C8
-, 0x30F3
-, 0x30AF
-, 0x30EB
-, 0x30BC
-, 0x30A4
-, 0x30ED
-, 0x30AF
-, 0x30ED
-, 0x30FC
-, 0x30CD
-, 0x30B1
-, 0x30FC
-, 0x30B9
-, 0x30B3
-, 0x30EB
-, 0x30CA
-, 0x30B3
-, 0x30FC
-, 0x30DD
-, 0x30B5
-, 0x30A4
-, 0x30AF
-, 0x30EB
-, 0x30B5
-, 0x30F3
-, 0x30C1
-, 0x30FC
-, 0x30E0
-, 0x30B7
-, 0x30EA
-, 0x30F3
-, 0x30B0
-, 0x30BB
-, 0x30F3
-, 0x30C1
-, 0x30BB
-, 0x30F3
-, 0x30C8
-, 0x30C0
-, 0x30FC
-, 0x30B9
-, 0x30C7
-, 0x30B7
-, 0x30C9
-, 0x30EB
-, 0x30C8
-, 0x30F3
-, 0x30CA
-, 0x30CE
-, 0x30CE
-, 0x30C3
-, 0x30C8
-, 0x30CF
-, 0x30A4
-, 0x30C4
-, 0x30D1
-, 0x30FC
-, 0x30BB
-, 0x30F3
-, 0x30C8
-, 0x30D1
-, 0x30FC
-, 0x30C4
-, 0x30D0
-, 0x30FC
-, 0x30EC
-, 0x30EB
-, 0x30D4
-, 0x30A2
-, 0x30B9
-, 0x30C8
-, 0x30EB
-, 0x30D4
-, 0x30AF
-, 0x30EB
-, 0x30D4
-, 0x30B3
-, 0x30D3
-, 0x30EB
-, 0x30D5
-, 0x30A1
-, 0x30E9
-, 0x30C3
-, 0x30C9
-, 0x30D5
-, 0x30A3
-, 0x30FC
-, 0x30C8
-, 0x30D6
-, 0x30C3
-, 0x30B7
-, 0x30A7
-, 0x30EB
-, 0x30D5
-, 0x30E9
-, 0x30F3
-, 0x30D8
-, 0x30AF
-, 0x30BF
-, 0x30FC
-, 0x30EB
-, 0x30DA
-, 0x30BD
-, 0x30DA
-, 0x30CB
-, 0x30D2
-, 0x30D8
-, 0x30EB
-, 0x30C4
-, 0x30DA
-, 0x30F3
-, 0x30B9
-, 0x30DA
-, 0x30FC
-, 0x30B8
-, 0x30D9
-, 0x30FC
-, 0x30BF
-, 0x30DD
-, 0x30A4
-, 0x30F3
-, 0x30C8
-, 0x30DC
-, 0x30EB
-, 0x30C8
-, 0x30DB
-, 0x30F3
-, 0x30DD
-, 0x30F3
-, 0x30C9
-, 0x30DB
-, 0x30FC
-, 0x30EB
-, 0x30DB
-, 0x30FC
-, 0x30F3
-, 0x30DE
-, 0x30A4
-, 0x30AF
-, 0x30ED
-, 0x30DE
-, 0x30A4
-, 0x30EB
-, 0x30DE
-, 0x30C3
-, 0x30CF
-, 0x30DE
-, 0x30EB
-, 0x30AF
-, 0x30DE
-, 0x30F3
-, 0x30B7
-, 0x30E7
-, 0x30F3
-, 0x30DF
-, 0x30AF
-, 0x30ED
-, 0x30F3
-, 0x30DF
-, 0x30EA
-, 0x30DF
-, 0x30EA
-, 0x30D0
-, 0x30FC
-, 0x30EB
-, 0x30E1
-, 0x30AC
-, 0x30E1
-, 0x30AC
-, 0x30C8
-, 0x30F3
-, 0x30E1
-, 0x30FC
-, 0x30C8
-, 0x30EB
-, 0x30E4
-, 0x30FC
-, 0x30C9
-, 0x30E4
-, 0x30FC
-, 0x30EB
-, 0x30E6
-, 0x30A2
-, 0x30F3
-, 0x30EA
-, 0x30C3
-, 0x30C8
-, 0x30EB
-, 0x30EA
-, 0x30E9
-, 0x30EB
-, 0x30D4
-, 0x30FC
-, 0x30EB
-, 0x30FC
-, 0x30D6
-, 0x30EB
-, 0x30EC
-, 0x30E0
-, 0x30EC
-, 0x30F3
-, 0x30C8
-, 0x30B2
-, 0x30F3
-, 0x30EF
-, 0x30C3
-, 0x30C8
-, 0x0030
-, 0x70B9
-, 0x0031
-, 0x70B9
-, 0x0032
-, 0x70B9
-, 0x0033
-, 0x70B9
-, 0x0034
-, 0x70B9
-, 0x0035
-, 0x70B9
-, 0x0036
-, 0x70B9
-, 0x0037
-, 0x70B9
-, 0x0038
-, 0x70B9
-, 0x0039
-, 0x70B9
-, 0x0031
-, 0x0030
-, 0x70B9
-, 0x0031
-, 0x0031
-, 0x70B9
-, 0x0031
-, 0x0032
-, 0x70B9
-, 0x0031
-, 0x0033
-, 0x70B9
-, 0x0031
-, 0x0034
-, 0x70B9
-, 0x0031
-, 0x0035
-, 0x70B9
-, 0x0031
-, 0x0036
-, 0x70B9
-, 0x0031
-, 0x0037
-, 0x70B9
-, 0x0031
-, 0x0038
-, 0x70B9
-, 0x0031
-, 0x0039
-, 0x70B9
-, 0x0032
-, 0x0030
-, 0x70B9
-, 0x0032
-, 0x0031
-, 0x70B9
-, 0x0032
-, 0x0032
-, 0x70B9
-, 0x0032
-, 0x0033
-, 0x70B9
-, 0x0032
-, 0x0034
-, 0x70B9
-, 0x0068
-, 0x0050
-, 0x0061
-, 0x0064
-, 0x0061
-, 0x0041
-, 0x0055
-, 0x0062
-, 0x0061
-, 0x0072
-, 0x006F
-, 0x0056
-, 0x0070
-, 0x0063
-, 0x0064
-, 0x006D
-, 0x0064
-, 0x006D
-, 0x00B2
-, 0x0064
-, 0x006D
-, 0x00B3
-, 0x0049
-, 0x0055
-, 0x5E73
-, 0x6210
-, 0x662D
-, 0x548C
-, 0x5927
-, 0x6B63
-, 0x660E
-, 0x6CBB
-, 0x682A
-, 0x5F0F
-, 0x4F1A
-, 0x793E
-, 0x0070
-, 0x0041
-, 0x006E
-, 0x0041
-, 0x03BC
-, 0x0041
-, 0x006D
-, 0x0041
-, 0x006B
-, 0x0041
-, 0x004B
-, 0x0042
-, 0x004D
-, 0x0042
-, 0x0047
-, 0x0042
-, 0x0063
-, 0x0061
-, 0x006C
-, 0x006B
-, 0x0063
-, 0x0061
-, 0x006C
-, 0x0070
-, 0x0046
-, 0x006E
-, 0x0046
-, 0x03BC
-, 0x0046
-, 0x03BC
-, 0x0067
-, 0x006D
-, 0x0067
-, 0x006B
-, 0x0067
-, 0x0048
-, 0x007A
-, 0x006B
-, 0x0048
-, 0x007A
-, 0x004D
-, 0x0048
-, 0x007A
-, 0x0047
-, 0x0048
-, 0x007A
-, 0x0054
-, 0x0048
-, 0x007A
-, 0x03BC
-, 0x2113
-, 0x006D
-, 0x2113
-, 0x0064
-, 0x2113
-, 0x006B
-, 0x2113
-, 0x0066
-, 0x006D
-, 0x006E
-, 0x006D
-, 0x03BC
-, 0x006D
-, 0x006D
-, 0x006D
-, 0x0063
-, 0x006D
-, 0x006B
-, 0x006D
-, 0x006D
-, 0x006D
-, 0x00B2
-, 0x0063
-, 0x006D
-, 0x00B2
-, 0x006D
-, 0x00B2
-, 0x006B
-, 0x006D
-, 0x00B2
-, 0x006D
-, 0x006D
-, 0x00B3
-, 0x0063
-, 0x006D
-, 0x00B3
-, 0x006D
-, 0x00B3
-, 0x006B
-, 0x006D
-, 0x00B3
-, 0x006D
-, 0x2215
-, 0x0073
-, 0x006D
-, 0x2215
-, 0x0073
-, 0x00B2
-, 0x0050
-, 0x0061
-, 0x006B
-, 0x0050
-, 0x0061
-, 0x004D
-, 0x0050
-, 0x0061
-, 0x0047
-, 0x0050
-, 0x0061
-, 0x0072
-, 0x0061
-, 0x0064
-, 0x0072
-, 0x0061
-, 0x0064
-, 0x2215
-, 0x0073
-, 0x0072
-, 0x0061
-, 0x0064
-, 0x2215
-, 0x0073
-, 0x00B2
-, 0x0070
-, 0x0073
-, 0x006E
-, 0x0073
-, 0x03BC
-, 0x0073
-, 0x006D
-, 0x0073
-, 0x0070
-, 0x0056
-, 0x006E
-, 0x0056
-, 0x03BC
-, 0x0056
-, 0x006D
-, 0x0056
-, 0x006B
-, 0x0056
-, 0x004D
-, 0x0056
-, 0x0070
-, 0x0057
-, 0x006E
-, 0x0057
-, 0x03BC
-, 0x0057
-, 0x006D
-, 0x0057
-, 0x006B
-, 0x0057
-, 0x004D
-, 0x0057
-, 0x006B
-, 0x03A9
-, 0x004D
-, 0x03A9
-, 0x0061
-, 0x002E
-, 0x006D
-, 0x002E
-, 0x0042
-, 0x0071
-, 0x0063
-, 0x0063
-, 0x0063
-, 0x0064
-, 0x0043
-, 0x2215
-, 0x006B
-, 0x0067
-, 0x0043
-, 0x006F
-, 0x002E
-, 0x0064
-, 0x0042
-, 0x0047
-, 0x0079
-, 0x0068
-, 0x0061
-, 0x0048
-, 0x0050
-, 0x0069
-, 0x006E
-, 0x004B
-, 0x004B
-, 0x004B
-, 0x004D
-, 0x006B
-, 0x0074
-, 0x006C
-, 0x006D
-, 0x006C
-, 0x006E
-, 0x006C
-, 0x006F
-, 0x0067
-, 0x006C
-, 0x0078
-, 0x006D
-, 0x0062
-, 0x006D
-, 0x0069
-, 0x006C
-, 0x006D
-, 0x006F
-, 0x006C
-, 0x0050
-, 0x0048
-, 0x0070
-, 0x002E
-, 0x006D
-, 0x002E
-, 0x0050
-, 0x0050
-, 0x004D
-, 0x0050
-, 0x0052
-, 0x0073
-, 0x0072
-, 0x0053
-, 0x0076
-, 0x0057
-, 0x0062
-, 0x0056
-, 0x2215
-, 0x006D
-, 0x0041
-, 0x2215
-, 0x006D
-, 0x0031
-, 0x65E5
-, 0x0032
-, 0x65E5
-, 0x0033
-, 0x65E5
-, 0x0034
-, 0x65E5
-, 0x0035
-, 0x65E5
-, 0x0036
-, 0x65E5
-, 0x0037
-, 0x65E5
-, 0x0038
-, 0x65E5
-, 0x0039
-, 0x65E5
-, 0x0031
-, 0x0030
-, 0x65E5
-, 0x0031
-, 0x0031
-, 0x65E5
-, 0x0031
-, 0x0032
-, 0x65E5
-, 0x0031
-, 0x0033
-, 0x65E5
-, 0x0031
-, 0x0034
-, 0x65E5
-, 0x0031
-, 0x0035
-, 0x65E5
-, 0x0031
-, 0x0036
-, 0x65E5
-, 0x0031
-, 0x0037
-, 0x65E5
-, 0x0031
-, 0x0038
-, 0x65E5
-, 0x0031
-, 0x0039
-, 0x65E5
-, 0x0032
-, 0x0030
-, 0x65E5
-, 0x0032
-, 0x0031
-, 0x65E5
-, 0x0032
-, 0x0032
-, 0x65E5
-, 0x0032
-, 0x0033
-, 0x65E5
-, 0x0032
-, 0x0034
-, 0x65E5
-, 0x0032
-, 0x0035
-, 0x65E5
-, 0x0032
-, 0x0036
-, 0x65E5
-, 0x0032
-, 0x0037
-, 0x65E5
-, 0x0032
-, 0x0038
-, 0x65E5
-, 0x0032
-, 0x0039
-, 0x65E5
-, 0x0033
-, 0x0030
-, 0x65E5
-, 0x0033
-, 0x0031
-, 0x65E5
-, 0x0067
-, 0x0061
-, 0x006C
-, 0x044A
-, 0x044C
-, 0xA76F
-, 0x0126
-, 0x0153
-, 0xA727
-, 0xAB37
-, 0x026B
-, 0xAB52
-, 0x8C48
-, 0x66F4
-, 0x8ECA
-, 0x8CC8
-, 0x6ED1
-, 0x4E32
-, 0x53E5
-, 0x9F9C
-, 0x9F9C
-, 0x5951
-, 0x91D1
-, 0x5587
-, 0x5948
-, 0x61F6
-, 0x7669
-, 0x7F85
-, 0x863F
-, 0x87BA
-, 0x88F8
-, 0x908F
-, 0x6A02
-, 0x6D1B
-, 0x70D9
-, 0x73DE
-, 0x843D
-, 0x916A
-, 0x99F1
-, 0x4E82
-, 0x5375
-, 0x6B04
-, 0x721B
-, 0x862D
-, 0x9E1E
-, 0x5D50
-, 0x6FEB
-, 0x85CD
-, 0x8964
-, 0x62C9
-, 0x81D8
-, 0x881F
-, 0x5ECA
-, 0x6717
-, 0x6D6A
-, 0x72FC
-, 0x90CE
-, 0x4F86
-, 0x51B7
-, 0x52DE
-, 0x64C4
-, 0x6AD3
-, 0x7210
-, 0x76E7
-, 0x8001
-, 0x8606
-, 0x865C
-, 0x8DEF
-, 0x9732
-, 0x9B6F
-, 0x9DFA
-, 0x788C
-, 0x797F
-, 0x7DA0
-, 0x83C9
-, 0x9304
-, 0x9E7F
-, 0x8AD6
-, 0x58DF
-, 0x5F04
-, 0x7C60
-, 0x807E
-, 0x7262
-, 0x78CA
-, 0x8CC2
-, 0x96F7
-, 0x58D8
-, 0x5C62
-, 0x6A13
-, 0x6DDA
-, 0x6F0F
-, 0x7D2F
-, 0x7E37
-, 0x964B
-, 0x52D2
-, 0x808B
-, 0x51DC
-, 0x51CC
-, 0x7A1C
-, 0x7DBE
-, 0x83F1
-, 0x9675
-, 0x8B80
-, 0x62CF
-, 0x6A02
-, 0x8AFE
-, 0x4E39
-, 0x5BE7
-, 0x6012
-, 0x7387
-, 0x7570
-, 0x5317
-, 0x78FB
-, 0x4FBF
-, 0x5FA9
-, 0x4E0D
-, 0x6CCC
-, 0x6578
-, 0x7D22
-, 0x53C3
-, 0x585E
-, 0x7701
-, 0x8449
-, 0x8AAA
-, 0x6BBA
-, 0x8FB0
-, 0x6C88
-, 0x62FE
-, 0x82E5
-, 0x63A0
-, 0x7565
-, 0x4EAE
-, 0x5169
-, 0x51C9
-, 0x6881
-, 0x7CE7
-, 0x826F
-, 0x8AD2
-, 0x91CF
-, 0x52F5
-, 0x5442
-, 0x5973
-, 0x5EEC
-, 0x65C5
-, 0x6FFE
-, 0x792A
-, 0x95AD
-, 0x9A6A
-, 0x9E97
-, 0x9ECE
-, 0x529B
-, 0x66C6
-, 0x6B77
-, 0x8F62
-, 0x5E74
-, 0x6190
-, 0x6200
-, 0x649A
-, 0x6F23
-, 0x7149
-, 0x7489
-, 0x79CA
-, 0x7DF4
-, 0x806F
-, 0x8F26
-, 0x84EE
-, 0x9023
-, 0x934A
-, 0x5217
-, 0x52A3
-, 0x54BD
-, 0x70C8
-, 0x88C2
-, 0x8AAA
-, 0x5EC9
-, 0x5FF5
-, 0x637B
-, 0x6BAE
-, 0x7C3E
-, 0x7375
-, 0x4EE4
-, 0x56F9
-, 0x5BE7
-, 0x5DBA
-, 0x601C
-, 0x73B2
-, 0x7469
-, 0x7F9A
-, 0x8046
-, 0x9234
-, 0x96F6
-, 0x9748
-, 0x9818
-, 0x4F8B
-, 0x79AE
-, 0x91B4
-, 0x96B8
-, 0x60E1
-, 0x4E86
-, 0x50DA
-, 0x5BEE
-, 0x5C3F
-, 0x6599
-, 0x6A02
-, 0x71CE
-, 0x7642
-, 0x84FC
-, 0x907C
-, 0x9F8D
-, 0x6688
-, 0x962E
-, 0x5289
-, 0x677B
-, 0x67F3
-, 0x6D41
-, 0x6E9C
-, 0x7409
-, 0x7559
-, 0x786B
-, 0x7D10
-, 0x985E
-, 0x516D
-, 0x622E
-, 0x9678
-, 0x502B
-, 0x5D19
-, 0x6DEA
-, 0x8F2A
-, 0x5F8B
-, 0x6144
-, 0x6817
-, 0x7387
-, 0x9686
-, 0x5229
-, 0x540F
-, 0x5C65
-, 0x6613
-, 0x674E
-, 0x68A8
-, 0x6CE5
-, 0x7406
-, 0x75E2
-, 0x7F79
-, 0x88CF
-, 0x88E1
-, 0x91CC
-, 0x96E2
-, 0x533F
-, 0x6EBA
-, 0x541D
-, 0x71D0
-, 0x7498
-, 0x85FA
-, 0x96A3
-, 0x9C57
-, 0x9E9F
-, 0x6797
-, 0x6DCB
-, 0x81E8
-, 0x7ACB
-, 0x7B20
-, 0x7C92
-, 0x72C0
-, 0x7099
-, 0x8B58
-, 0x4EC0
-, 0x8336
-, 0x523A
-, 0x5207
-, 0x5EA6
-, 0x62D3
-, 0x7CD6
-, 0x5B85
-, 0x6D1E
-, 0x66B4
-, 0x8F3B
-, 0x884C
-, 0x964D
-, 0x898B
-, 0x5ED3
-, 0x5140
-, 0x55C0
-, 0x585A
-, 0x6674
-, 0x51DE
-, 0x732A
-, 0x76CA
-, 0x793C
-, 0x795E
-, 0x7965
-, 0x798F
-, 0x9756
-, 0x7CBE
-, 0x7FBD
-, 0x8612
-, 0x8AF8
-, 0x9038
-, 0x90FD
-, 0x98EF
-, 0x98FC
-, 0x9928
-, 0x9DB4
-, 0x90DE
-, 0x96B7
-, 0x4FAE
-, 0x50E7
-, 0x514D
-, 0x52C9
-, 0x52E4
-, 0x5351
-, 0x559D
-, 0x5606
-, 0x5668
-, 0x5840
-, 0x58A8
-, 0x5C64
-, 0x5C6E
-, 0x6094
-, 0x6168
-, 0x618E
-, 0x61F2
-, 0x654F
-, 0x65E2
-, 0x6691
-, 0x6885
-, 0x6D77
-, 0x6E1A
-, 0x6F22
-, 0x716E
-, 0x722B
-, 0x7422
-, 0x7891
-, 0x793E
-, 0x7949
-, 0x7948
-, 0x7950
-, 0x7956
-, 0x795D
-, 0x798D
-, 0x798E
-, 0x7A40
-, 0x7A81
-, 0x7BC0
-, 0x7DF4
-, 0x7E09
-, 0x7E41
-, 0x7F72
-, 0x8005
-, 0x81ED
-, 0x8279
-, 0x8279
-, 0x8457
-, 0x8910
-, 0x8996
-, 0x8B01
-, 0x8B39
-, 0x8CD3
-, 0x8D08
-, 0x8FB6
-, 0x9038
-, 0x96E3
-, 0x97FF
-, 0x983B
-, 0x6075
-, 0x242EE
-, 0x8218
-, 0x4E26
-, 0x51B5
-, 0x5168
-, 0x4F80
-, 0x5145
-, 0x5180
-, 0x52C7
-, 0x52FA
-, 0x559D
-, 0x5555
-, 0x5599
-, 0x55E2
-, 0x585A
-, 0x58B3
-, 0x5944
-, 0x5954
-, 0x5A62
-, 0x5B28
-, 0x5ED2
-, 0x5ED9
-, 0x5F69
-, 0x5FAD
-, 0x60D8
-, 0x614E
-, 0x6108
-, 0x618E
-, 0x6160
-, 0x61F2
-, 0x6234
-, 0x63C4
-, 0x641C
-, 0x6452
-, 0x6556
-, 0x6674
-, 0x6717
-, 0x671B
-, 0x6756
-, 0x6B79
-, 0x6BBA
-, 0x6D41
-, 0x6EDB
-, 0x6ECB
-, 0x6F22
-, 0x701E
-, 0x716E
-, 0x77A7
-, 0x7235
-, 0x72AF
-, 0x732A
-, 0x7471
-, 0x7506
-, 0x753B
-, 0x761D
-, 0x761F
-, 0x76CA
-, 0x76DB
-, 0x76F4
-, 0x774A
-, 0x7740
-, 0x78CC
-, 0x7AB1
-, 0x7BC0
-, 0x7C7B
-, 0x7D5B
-, 0x7DF4
-, 0x7F3E
-, 0x8005
-, 0x8352
-, 0x83EF
-, 0x8779
-, 0x8941
-, 0x8986
-, 0x8996
-, 0x8ABF
-, 0x8AF8
-, 0x8ACB
-, 0x8B01
-, 0x8AFE
-, 0x8AED
-, 0x8B39
-, 0x8B8A
-, 0x8D08
-, 0x8F38
-, 0x9072
-, 0x9199
-, 0x9276
-, 0x967C
-, 0x96E3
-, 0x9756
-, 0x97DB
-, 0x97FF
-, 0x980B
-, 0x983B
-, 0x9B12
-, 0x9F9C
-, 0x2284A
-, 0x22844
-, 0x233D5
-, 0x3B9D
-, 0x4018
-, 0x4039
-, 0x25249
-, 0x25CD0
-, 0x27ED3
-, 0x9F43
-, 0x9F8E
-, 0x0066
-, 0x0066
-, 0x0066
-, 0x0069
-, 0x0066
-, 0x006C
-, 0x0066
-, 0x0066
-, 0x0069
-, 0x0066
-, 0x0066
-, 0x006C
-, 0x017F
-, 0x0074
-, 0x0073
-, 0x0074
-, 0x0574
-, 0x0576
-, 0x0574
-, 0x0565
-, 0x0574
-, 0x056B
-, 0x057E
-, 0x0576
-, 0x0574
-, 0x056D
-, 0x05D9
-, 0x05B4
-, 0x05F2
-, 0x05B7
-, 0x05E2
-, 0x05D0
-, 0x05D3
-, 0x05D4
-, 0x05DB
-, 0x05DC
-, 0x05DD
-, 0x05E8
-, 0x05EA
-, 0x002B
-, 0x05E9
-, 0x05C1
-, 0x05E9
-, 0x05C2
-, 0xFB49
-, 0x05C1
-, 0xFB49
-, 0x05C2
-, 0x05D0
-, 0x05B7
-, 0x05D0
-, 0x05B8
-, 0x05D0
-, 0x05BC
-, 0x05D1
-, 0x05BC
-, 0x05D2
-, 0x05BC
-, 0x05D3
-, 0x05BC
-, 0x05D4
-, 0x05BC
-, 0x05D5
-, 0x05BC
-, 0x05D6
-, 0x05BC
-, 0x05D8
-, 0x05BC
-, 0x05D9
-, 0x05BC
-, 0x05DA
-, 0x05BC
-, 0x05DB
-, 0x05BC
-, 0x05DC
-, 0x05BC
-, 0x05DE
-, 0x05BC
-, 0x05E0
-, 0x05BC
-, 0x05E1
-, 0x05BC
-, 0x05E3
-, 0x05BC
-, 0x05E4
-, 0x05BC
-, 0x05E6
-, 0x05BC
-, 0x05E7
-, 0x05BC
-, 0x05E8
-, 0x05BC
-, 0x05E9
-, 0x05BC
-, 0x05EA
-, 0x05BC
-, 0x05D5
-, 0x05B9
-, 0x05D1
-, 0x05BF
-, 0x05DB
-, 0x05BF
-, 0x05E4
-, 0x05BF
-, 0x05D0
-, 0x05DC
-, 0x0671
-, 0x0671
-, 0x067B
-, 0x067B
-, 0x067B
-, 0x067B
-, 0x067E
-, 0x067E
-, 0x067E
-, 0x067E
-, 0x0680
-, 0x0680
-, 0x0680
-, 0x0680
-, 0x067A
-, 0x067A
-, 0x067A
-, 0x067A
-, 0x067F
-, 0x067F
-, 0x067F
-, 0x067F
-, 0x0679
-, 0x0679
-, 0x0679
-, 0x0679
-, 0x06A4
-, 0x06A4
-, 0x06A4
-, 0x06A4
-, 0x06A6
-, 0x06A6
-, 0x06A6
-, 0x06A6
-, 0x0684
-, 0x0684
-, 0x0684
-, 0x0684
-, 0x0683
-, 0x0683
-, 0x0683
-, 0x0683
-, 0x0686
-, 0x0686
-, 0x0686
-, 0x0686
-, 0x0687
-, 0x0687
-, 0x0687
-, 0x0687
-, 0x068D
-, 0x068D
-, 0x068C
-, 0x068C
-, 0x068E
-, 0x068E
-, 0x0688
-, 0x0688
-, 0x0698
-, 0x0698
-, 0x0691
-, 0x0691
-, 0x06A9
-, 0x06A9
-, 0x06A9
-, 0x06A9
-, 0x06AF
-, 0x06AF
-, 0x06AF
-, 0x06AF
-, 0x06B3
-, 0x06B3
-, 0x06B3
-, 0x06B3
-, 0x06B1
-, 0x06B1
-, 0x06B1
-, 0x06B1
-, 0x06BA
-, 0x06BA
-, 0x06BB
-, 0x06BB
-, 0x06BB
-, 0x06BB
-, 0x06C0
-, 0x06C0
-, 0x06C1
-, 0x06C1
-, 0x06C1
-, 0x06C1
-, 0x06BE
-, 0x06BE
-, 0x06BE
-, 0x06BE
-, 0x06D2
-, 0x06D2
-, 0x06D3
-, 0x06D3
-, 0x06AD
-, 0x06AD
-, 0x06AD
-, 0x06AD
-, 0x06C7
-, 0x06C7
-, 0x06C6
-, 0x06C6
-, 0x06C8
-, 0x06C8
-, 0x0677
-, 0x06CB
-, 0x06CB
-, 0x06C5
-, 0x06C5
-, 0x06C9
-, 0x06C9
-, 0x06D0
-, 0x06D0
-, 0x06D0
-, 0x06D0
-, 0x0649
-, 0x0649
-, 0x0626
-, 0x0627
-, 0x0626
-, 0x0627
-, 0x0626
-, 0x06D5
-, 0x0626
-, 0x06D5
-, 0x0626
-, 0x0648
-, 0x0626
-, 0x0648
-, 0x0626
-, 0x06C7
-, 0x0626
-, 0x06C7
-, 0x0626
-, 0x06C6
-, 0x0626
-, 0x06C6
-, 0x0626
-, 0x06C8
-, 0x0626
-, 0x06C8
-, 0x0626
-, 0x06D0
-, 0x0626
-, 0x06D0
-, 0x0626
-, 0x06D0
-, 0x0626
-, 0x0649
-, 0x0626
-, 0x0649
-, 0x0626
-, 0x0649
-, 0x06CC
-, 0x06CC
-, 0x06CC
-, 0x06CC
-, 0x0626
-, 0x062C
-, 0x0626
-, 0x062D
-, 0x0626
-, 0x0645
-, 0x0626
-, 0x0649
-, 0x0626
-, 0x064A
-, 0x0628
-, 0x062C
-, 0x0628
-, 0x062D
-, 0x0628
-, 0x062E
-, 0x0628
-, 0x0645
-, 0x0628
-, 0x0649
-, 0x0628
-, 0x064A
-, 0x062A
-, 0x062C
-, 0x062A
-, 0x062D
-, 0x062A
-, 0x062E
-, 0x062A
-, 0x0645
-, 0x062A
-, 0x0649
-, 0x062A
-, 0x064A
-, 0x062B
-, 0x062C
-, 0x062B
-, 0x0645
-, 0x062B
-, 0x0649
-, 0x062B
-, 0x064A
-, 0x062C
-, 0x062D
-, 0x062C
-, 0x0645
-, 0x062D
-, 0x062C
-, 0x062D
-, 0x0645
-, 0x062E
-, 0x062C
-, 0x062E
-, 0x062D
-, 0x062E
-, 0x0645
-, 0x0633
-, 0x062C
-, 0x0633
-, 0x062D
-, 0x0633
-, 0x062E
-, 0x0633
-, 0x0645
-, 0x0635
-, 0x062D
-, 0x0635
-, 0x0645
-, 0x0636
-, 0x062C
-, 0x0636
-, 0x062D
-, 0x0636
-, 0x062E
-, 0x0636
-, 0x0645
-, 0x0637
-, 0x062D
-, 0x0637
-, 0x0645
-, 0x0638
-, 0x0645
-, 0x0639
-, 0x062C
-, 0x0639
-, 0x0645
-, 0x063A
-, 0x062C
-, 0x063A
-, 0x0645
-, 0x0641
-, 0x062C
-, 0x0641
-, 0x062D
-, 0x0641
-, 0x062E
-, 0x0641
-, 0x0645
-, 0x0641
-, 0x0649
-, 0x0641
-, 0x064A
-, 0x0642
-, 0x062D
-, 0x0642
-, 0x0645
-, 0x0642
-, 0x0649
-, 0x0642
-, 0x064A
-, 0x0643
-, 0x0627
-, 0x0643
-, 0x062C
-, 0x0643
-, 0x062D
-, 0x0643
-, 0x062E
-, 0x0643
-, 0x0644
-, 0x0643
-, 0x0645
-, 0x0643
-, 0x0649
-, 0x0643
-, 0x064A
-, 0x0644
-, 0x062C
-, 0x0644
-, 0x062D
-, 0x0644
-, 0x062E
-, 0x0644
-, 0x0645
-, 0x0644
-, 0x0649
-, 0x0644
-, 0x064A
-, 0x0645
-, 0x062C
-, 0x0645
-, 0x062D
-, 0x0645
-, 0x062E
-, 0x0645
-, 0x0645
-, 0x0645
-, 0x0649
-, 0x0645
-, 0x064A
-, 0x0646
-, 0x062C
-, 0x0646
-, 0x062D
-, 0x0646
-, 0x062E
-, 0x0646
-, 0x0645
-, 0x0646
-, 0x0649
-, 0x0646
-, 0x064A
-, 0x0647
-, 0x062C
-, 0x0647
-, 0x0645
-, 0x0647
-, 0x0649
-, 0x0647
-, 0x064A
-, 0x064A
-, 0x062C
-, 0x064A
-, 0x062D
-, 0x064A
-, 0x062E
-, 0x064A
-, 0x0645
-, 0x064A
-, 0x0649
-, 0x064A
-, 0x064A
-, 0x0630
-, 0x0670
-, 0x0631
-, 0x0670
-, 0x0649
-, 0x0670
-, 0x0020
-, 0x064C
-, 0x0651
-, 0x0020
-, 0x064D
-, 0x0651
-, 0x0020
-, 0x064E
-, 0x0651
-, 0x0020
-, 0x064F
-, 0x0651
-, 0x0020
-, 0x0650
-, 0x0651
-, 0x0020
-, 0x0651
-, 0x0670
-, 0x0626
-, 0x0631
-, 0x0626
-, 0x0632
-, 0x0626
-, 0x0645
-, 0x0626
-, 0x0646
-, 0x0626
-, 0x0649
-, 0x0626
-, 0x064A
-, 0x0628
-, 0x0631
-, 0x0628
-, 0x0632
-, 0x0628
-, 0x0645
-, 0x0628
-, 0x0646
-, 0x0628
-, 0x0649
-, 0x0628
-, 0x064A
-, 0x062A
-, 0x0631
-, 0x062A
-, 0x0632
-, 0x062A
-, 0x0645
-, 0x062A
-, 0x0646
-, 0x062A
-, 0x0649
-, 0x062A
-, 0x064A
-, 0x062B
-, 0x0631
-, 0x062B
-, 0x0632
-, 0x062B
-, 0x0645
-, 0x062B
-, 0x0646
-, 0x062B
-, 0x0649
-, 0x062B
-, 0x064A
-, 0x0641
-, 0x0649
-, 0x0641
-, 0x064A
-, 0x0642
-, 0x0649
-, 0x0642
-, 0x064A
-, 0x0643
-, 0x0627
-, 0x0643
-, 0x0644
-, 0x0643
-, 0x0645
-, 0x0643
-, 0x0649
-, 0x0643
-, 0x064A
-, 0x0644
-, 0x0645
-, 0x0644
-, 0x0649
-, 0x0644
-, 0x064A
-, 0x0645
-, 0x0627
-, 0x0645
-, 0x0645
-, 0x0646
-, 0x0631
-, 0x0646
-, 0x0632
-, 0x0646
-, 0x0645
-, 0x0646
-, 0x0646
-, 0x0646
-, 0x0649
-, 0x0646
-, 0x064A
-, 0x0649
-, 0x0670
-, 0x064A
-, 0x0631
-, 0x064A
-, 0x0632
-, 0x064A
-, 0x0645
-, 0x064A
-, 0x0646
-, 0x064A
-, 0x0649
-, 0x064A
-, 0x064A
-, 0x0626
-, 0x062C
-, 0x0626
-, 0x062D
-, 0x0626
-, 0x062E
-, 0x0626
-, 0x0645
-, 0x0626
-, 0x0647
-, 0x0628
-, 0x062C
-, 0x0628
-, 0x062D
-, 0x0628
-, 0x062E
-, 0x0628
-, 0x0645
-, 0x0628
-, 0x0647
-, 0x062A
-, 0x062C
-, 0x062A
-, 0x062D
-, 0x062A
-, 0x062E
-, 0x062A
-, 0x0645
-, 0x062A
-, 0x0647
-, 0x062B
-, 0x0645
-, 0x062C
-, 0x062D
-, 0x062C
-, 0x0645
-, 0x062D
-, 0x062C
-, 0x062D
-, 0x0645
-, 0x062E
-, 0x062C
-, 0x062E
-, 0x0645
-, 0x0633
-, 0x062C
-, 0x0633
-, 0x062D
-, 0x0633
-, 0x062E
-, 0x0633
-, 0x0645
-, 0x0635
-, 0x062D
-, 0x0635
-, 0x062E
-, 0x0635
-, 0x0645
-, 0x0636
-, 0x062C
-, 0x0636
-, 0x062D
-, 0x0636
-, 0x062E
-, 0x0636
-, 0x0645
-, 0x0637
-, 0x062D
-, 0x0638
-, 0x0645
-, 0x0639
-, 0x062C
-, 0x0639
-, 0x0645
-, 0x063A
-, 0x062C
-, 0x063A
-, 0x0645
-, 0x0641
-, 0x062C
-, 0x0641
-, 0x062D
-, 0x0641
-, 0x062E
-, 0x0641
-, 0x0645
-, 0x0642
-, 0x062D
-, 0x0642
-, 0x0645
-, 0x0643
-, 0x062C
-, 0x0643
-, 0x062D
-, 0x0643
-, 0x062E
-, 0x0643
-, 0x0644
-, 0x0643
-, 0x0645
-, 0x0644
-, 0x062C
-, 0x0644
-, 0x062D
-, 0x0644
-, 0x062E
-, 0x0644
-, 0x0645
-, 0x0644
-, 0x0647
-, 0x0645
-, 0x062C
-, 0x0645
-, 0x062D
-, 0x0645
-, 0x062E
-, 0x0645
-, 0x0645
-, 0x0646
-, 0x062C
-, 0x0646
-, 0x062D
-, 0x0646
-, 0x062E
-, 0x0646
-, 0x0645
-, 0x0646
-, 0x0647
-, 0x0647
-, 0x062C
-, 0x0647
-, 0x0645
-, 0x0647
-, 0x0670
-, 0x064A
-, 0x062C
-, 0x064A
-, 0x062D
-, 0x064A
-, 0x062E
-, 0x064A
-, 0x0645
-, 0x064A
-, 0x0647
-, 0x0626
-, 0x0645
-, 0x0626
-, 0x0647
-, 0x0628
-, 0x0645
-, 0x0628
-, 0x0647
-, 0x062A
-, 0x0645
-, 0x062A
-, 0x0647
-, 0x062B
-, 0x0645
-, 0x062B
-, 0x0647
-, 0x0633
-, 0x0645
-, 0x0633
-, 0x0647
-, 0x0634
-, 0x0645
-, 0x0634
-, 0x0647
-, 0x0643
-, 0x0644
-, 0x0643
-, 0x0645
-, 0x0644
-, 0x0645
-, 0x0646
-, 0x0645
-, 0x0646
-, 0x0647
-, 0x064A
-, 0x0645
-, 0x064A
-, 0x0647
-, 0x0640
-, 0x064E
-, 0x0651
-, 0x0640
-, 0x064F
-, 0x0651
-, 0x0640
-, 0x0650
-, 0x0651
-, 0x0637
-, 0x0649
-, 0x0637
-, 0x064A
-, 0x0639
-, 0x0649
-, 0x0639
-, 0x064A
-, 0x063A
-, 0x0649
-, 0x063A
-, 0x064A
-, 0x0633
-, 0x0649
-, 0x0633
-, 0x064A
-, 0x0634
-, 0x0649
-, 0x0634
-, 0x064A
-, 0x062D
-, 0x0649
-, 0x062D
-, 0x064A
-, 0x062C
-, 0x0649
-, 0x062C
-, 0x064A
-, 0x062E
-, 0x0649
-, 0x062E
-, 0x064A
-, 0x0635
-, 0x0649
-, 0x0635
-, 0x064A
-, 0x0636
-, 0x0649
-, 0x0636
-, 0x064A
-, 0x0634
-, 0x062C
-, 0x0634
-, 0x062D
-, 0x0634
-, 0x062E
-, 0x0634
-, 0x0645
-, 0x0634
-, 0x0631
-, 0x0633
-, 0x0631
-, 0x0635
-, 0x0631
-, 0x0636
-, 0x0631
-, 0x0637
-, 0x0649
-, 0x0637
-, 0x064A
-, 0x0639
-, 0x0649
-, 0x0639
-, 0x064A
-, 0x063A
-, 0x0649
-, 0x063A
-, 0x064A
-, 0x0633
-, 0x0649
-, 0x0633
-, 0x064A
-, 0x0634
-, 0x0649
-, 0x0634
-, 0x064A
-, 0x062D
-, 0x0649
-, 0x062D
-, 0x064A
-, 0x062C
-, 0x0649
-, 0x062C
-, 0x064A
-, 0x062E
-, 0x0649
-, 0x062E
-, 0x064A
-, 0x0635
-, 0x0649
-, 0x0635
-, 0x064A
-, 0x0636
-, 0x0649
-, 0x0636
-, 0x064A
-, 0x0634
-, 0x062C
-, 0x0634
-, 0x062D
-, 0x0634
-, 0x062E
-, 0x0634
-, 0x0645
-, 0x0634
-, 0x0631
-, 0x0633
-, 0x0631
-, 0x0635
-, 0x0631
-, 0x0636
-, 0x0631
-, 0x0634
-, 0x062C
-, 0x0634
-, 0x062D
-, 0x0634
-, 0x062E
-, 0x0634
-, 0x0645
-, 0x0633
-, 0x0647
-, 0x0634
-, 0x0647
-, 0x0637
-, 0x0645
-, 0x0633
-, 0x062C
-, 0x0633
-, 0x062D
-, 0x0633
-, 0x062E
-, 0x0634
-, 0x062C
-, 0x0634
-, 0x062D
-, 0x0634
-, 0x062E
-, 0x0637
-, 0x0645
-, 0x0638
-, 0x0645
-, 0x0627
-, 0x064B
-, 0x0627
-, 0x064B
-, 0x062A
-, 0x062C
-, 0x0645
-, 0x062A
-, 0x062D
-, 0x062C
-, 0x062A
-, 0x062D
-, 0x062C
-, 0x062A
-, 0x062D
-, 0x0645
-, 0x062A
-, 0x062E
-, 0x0645
-, 0x062A
-, 0x0645
-, 0x062C
-, 0x062A
-, 0x0645
-, 0x062D
-, 0x062A
-, 0x0645
-, 0x062E
-, 0x062C
-, 0x0645
-, 0x062D
-, 0x062C
-, 0x0645
-, 0x062D
-, 0x062D
-, 0x0645
-, 0x064A
-, 0x062D
-, 0x0645
-, 0x0649
-, 0x0633
-, 0x062D
-, 0x062C
-, 0x0633
-, 0x062C
-, 0x062D
-, 0x0633
-, 0x062C
-, 0x0649
-, 0x0633
-, 0x0645
-, 0x062D
-, 0x0633
-, 0x0645
-, 0x062D
-, 0x0633
-, 0x0645
-, 0x062C
-, 0x0633
-, 0x0645
-, 0x0645
-, 0x0633
-, 0x0645
-, 0x0645
-, 0x0635
-, 0x062D
-, 0x062D
-, 0x0635
-, 0x062D
-, 0x062D
-, 0x0635
-, 0x0645
-, 0x0645
-, 0x0634
-, 0x062D
-, 0x0645
-, 0x0634
-, 0x062D
-, 0x0645
-, 0x0634
-, 0x062C
-, 0x064A
-, 0x0634
-, 0x0645
-, 0x062E
-, 0x0634
-, 0x0645
-, 0x062E
-, 0x0634
-, 0x0645
-, 0x0645
-, 0x0634
-, 0x0645
-, 0x0645
-, 0x0636
-, 0x062D
-, 0x0649
-, 0x0636
-, 0x062E
-, 0x0645
-, 0x0636
-, 0x062E
-, 0x0645
-, 0x0637
-, 0x0645
-, 0x062D
-, 0x0637
-, 0x0645
-, 0x062D
-, 0x0637
-, 0x0645
-, 0x0645
-, 0x0637
-, 0x0645
-, 0x064A
-, 0x0639
-, 0x062C
-, 0x0645
-, 0x0639
-, 0x0645
-, 0x0645
-, 0x0639
-, 0x0645
-, 0x0645
-, 0x0639
-, 0x0645
-, 0x0649
-, 0x063A
-, 0x0645
-, 0x0645
-, 0x063A
-, 0x0645
-, 0x064A
-, 0x063A
-, 0x0645
-, 0x0649
-, 0x0641
-, 0x062E
-, 0x0645
-, 0x0641
-, 0x062E
-, 0x0645
-, 0x0642
-, 0x0645
-, 0x062D
-, 0x0642
-, 0x0645
-, 0x0645
-, 0x0644
-, 0x062D
-, 0x0645
-, 0x0644
-, 0x062D
-, 0x064A
-, 0x0644
-, 0x062D
-, 0x0649
-, 0x0644
-, 0x062C
-, 0x062C
-, 0x0644
-, 0x062C
-, 0x062C
-, 0x0644
-, 0x062E
-, 0x0645
-, 0x0644
-, 0x062E
-, 0x0645
-, 0x0644
-, 0x0645
-, 0x062D
-, 0x0644
-, 0x0645
-, 0x062D
-, 0x0645
-, 0x062D
-, 0x062C
-, 0x0645
-, 0x062D
-, 0x0645
-, 0x0645
-, 0x062D
-, 0x064A
-, 0x0645
-, 0x062C
-, 0x062D
-, 0x0645
-, 0x062C
-, 0x0645
-, 0x0645
-, 0x062E
-, 0x062C
-, 0x0645
-, 0x062E
-, 0x0645
-, 0x0645
-, 0x062C
-, 0x062E
-, 0x0647
-, 0x0645
-, 0x062C
-, 0x0647
-, 0x0645
-, 0x0645
-, 0x0646
-, 0x062D
-, 0x0645
-, 0x0646
-, 0x062D
-, 0x0649
-, 0x0646
-, 0x062C
-, 0x0645
-, 0x0646
-, 0x062C
-, 0x0645
-, 0x0646
-, 0x062C
-, 0x0649
-, 0x0646
-, 0x0645
-, 0x064A
-, 0x0646
-, 0x0645
-, 0x0649
-, 0x064A
-, 0x0645
-, 0x0645
-, 0x064A
-, 0x0645
-, 0x0645
-, 0x0628
-, 0x062E
-, 0x064A
-, 0x062A
-, 0x062C
-, 0x064A
-, 0x062A
-, 0x062C
-, 0x0649
-, 0x062A
-, 0x062E
-, 0x064A
-, 0x062A
-, 0x062E
-, 0x0649
-, 0x062A
-, 0x0645
-, 0x064A
-, 0x062A
-, 0x0645
-, 0x0649
-, 0x062C
-, 0x0645
-, 0x064A
-, 0x062C
-, 0x062D
-, 0x0649
-, 0x062C
-, 0x0645
-, 0x0649
-, 0x0633
-, 0x062E
-, 0x0649
-, 0x0635
-, 0x062D
-, 0x064A
-, 0x0634
-, 0x062D
-, 0x064A
-, 0x0636
-, 0x062D
-, 0x064A
-, 0x0644
-, 0x062C
-, 0x064A
-, 0x0644
-, 0x0645
-, 0x064A
-, 0x064A
-, 0x062D
-, 0x064A
-, 0x064A
-, 0x062C
-, 0x064A
-, 0x064A
-, 0x0645
-, 0x064A
-, 0x0645
-, 0x0645
-, 0x064A
-, 0x0642
-, 0x0645
-, 0x064A
-, 0x0646
-, 0x062D
-, 0x064A
-, 0x0642
-, 0x0645
-, 0x062D
-, 0x0644
-, 0x062D
-, 0x0645
-, 0x0639
-, 0x0645
-, 0x064A
-, 0x0643
-, 0x0645
-, 0x064A
-, 0x0646
-, 0x062C
-, 0x062D
-, 0x0645
-, 0x062E
-, 0x064A
-, 0x0644
-, 0x062C
-, 0x0645
-, 0x0643
-, 0x0645
-, 0x0645
-, 0x0644
-, 0x062C
-, 0x0645
-, 0x0646
-, 0x062C
-, 0x062D
-, 0x062C
-, 0x062D
-, 0x064A
-, 0x062D
-, 0x062C
-, 0x064A
-, 0x0645
-, 0x062C
-, 0x064A
-, 0x0641
-, 0x0645
-, 0x064A
-, 0x0628
-, 0x062D
-, 0x064A
-, 0x0643
-, 0x0645
-, 0x0645
-, 0x0639
-, 0x062C
-, 0x0645
-, 0x0635
-, 0x0645
-, 0x0645
-, 0x0633
-, 0x062E
-, 0x064A
-, 0x0646
-, 0x062C
-, 0x064A
-, 0x0635
-, 0x0644
-, 0x06D2
-, 0x0642
-, 0x0644
-, 0x06D2
-, 0x0627
-, 0x0644
-, 0x0644
-, 0x0647
-, 0x0627
-, 0x0643
-, 0x0628
-, 0x0631
-, 0x0645
-, 0x062D
-, 0x0645
-, 0x062F
-, 0x0635
-, 0x0644
-, 0x0639
-, 0x0645
-, 0x0631
-, 0x0633
-, 0x0648
-, 0x0644
-, 0x0639
-, 0x0644
-, 0x064A
-, 0x0647
-, 0x0648
-, 0x0633
-, 0x0644
-, 0x0645
-, 0x0635
-, 0x0644
-, 0x0649
-, 0x0635
-, 0x0644
-, 0x0649
-, 0x0020
-, 0x0627
-, 0x0644
-, 0x0644
-, 0x0647
-, 0x0020
-, 0x0639
-, 0x0644
-, 0x064A
-, 0x0647
-, 0x0020
-, 0x0648
-, 0x0633
-, 0x0644
-, 0x0645
-, 0x062C
-, 0x0644
-, 0x0020
-, 0x062C
-, 0x0644
-, 0x0627
-, 0x0644
-, 0x0647
-, 0x0631
-, 0x06CC
-, 0x0627
-, 0x0644
-, 0x002C
-, 0x3001
-, 0x3002
-, 0x003A
-, 0x003B
-, 0x0021
-, 0x003F
-, 0x3016
-, 0x3017
-, 0x2026
-, 0x2025
-, 0x2014
-, 0x2013
-, 0x005F
-, 0x005F
-, 0x0028
-, 0x0029
-, 0x007B
-, 0x007D
-, 0x3014
-, 0x3015
-, 0x3010
-, 0x3011
-, 0x300A
-, 0x300B
-, 0x3008
-, 0x3009
-, 0x300C
-, 0x300D
-, 0x300E
-, 0x300F
-, 0x005B
-, 0x005D
-, 0x203E
-, 0x203E
-, 0x203E
-, 0x203E
-, 0x005F
-, 0x005F
-, 0x005F
-, 0x002C
-, 0x3001
-, 0x002E
-, 0x003B
-, 0x003A
-, 0x003F
-, 0x0021
-, 0x2014
-, 0x0028
-, 0x0029
-, 0x007B
-, 0x007D
-, 0x3014
-, 0x3015
-, 0x0023
-, 0x0026
-, 0x002A
-, 0x002B
-, 0x002D
-, 0x003C
-, 0x003E
-, 0x003D
-, 0x005C
-, 0x0024
-, 0x0025
-, 0x0040
-, 0x0020
-, 0x064B
-, 0x0640
-, 0x064B
-, 0x0020
-, 0x064C
-, 0x0020
-, 0x064D
-, 0x0020
-, 0x064E
-, 0x0640
-, 0x064E
-, 0x0020
-, 0x064F
-, 0x0640
-, 0x064F
-, 0x0020
-, 0x0650
-, 0x0640
-, 0x0650
-, 0x0020
-, 0x0651
-, 0x0640
-, 0x0651
-, 0x0020
-, 0x0652
-, 0x0640
-, 0x0652
-, 0x0621
-, 0x0622
-, 0x0622
-, 0x0623
-, 0x0623
-, 0x0624
-, 0x0624
-, 0x0625
-, 0x0625
-, 0x0626
-, 0x0626
-, 0x0626
-, 0x0626
-, 0x0627
-, 0x0627
-, 0x0628
-, 0x0628
-, 0x0628
-, 0x0628
-, 0x0629
-, 0x0629
-, 0x062A
-, 0x062A
-, 0x062A
-, 0x062A
-, 0x062B
-, 0x062B
-, 0x062B
-, 0x062B
-, 0x062C
-, 0x062C
-, 0x062C
-, 0x062C
-, 0x062D
-, 0x062D
-, 0x062D
-, 0x062D
-, 0x062E
-, 0x062E
-, 0x062E
-, 0x062E
-, 0x062F
-, 0x062F
-, 0x0630
-, 0x0630
-, 0x0631
-, 0x0631
-, 0x0632
-, 0x0632
-, 0x0633
-, 0x0633
-, 0x0633
-, 0x0633
-, 0x0634
-, 0x0634
-, 0x0634
-, 0x0634
-, 0x0635
-, 0x0635
-, 0x0635
-, 0x0635
-, 0x0636
-, 0x0636
-, 0x0636
-, 0x0636
-, 0x0637
-, 0x0637
-, 0x0637
-, 0x0637
-, 0x0638
-, 0x0638
-, 0x0638
-, 0x0638
-, 0x0639
-, 0x0639
-, 0x0639
-, 0x0639
-, 0x063A
-, 0x063A
-, 0x063A
-, 0x063A
-, 0x0641
-, 0x0641
-, 0x0641
-, 0x0641
-, 0x0642
-, 0x0642
-, 0x0642
-, 0x0642
-, 0x0643
-, 0x0643
-, 0x0643
-, 0x0643
-, 0x0644
-, 0x0644
-, 0x0644
-, 0x0644
-, 0x0645
-, 0x0645
-, 0x0645
-, 0x0645
-, 0x0646
-, 0x0646
-, 0x0646
-, 0x0646
-, 0x0647
-, 0x0647
-, 0x0647
-, 0x0647
-, 0x0648
-, 0x0648
-, 0x0649
-, 0x0649
-, 0x064A
-, 0x064A
-, 0x064A
-, 0x064A
-, 0x0644
-, 0x0622
-, 0x0644
-, 0x0622
-, 0x0644
-, 0x0623
-, 0x0644
-, 0x0623
-, 0x0644
-, 0x0625
-, 0x0644
-, 0x0625
-, 0x0644
-, 0x0627
-, 0x0644
-, 0x0627
-, 0x0021
-, 0x0022
-, 0x0023
-, 0x0024
-, 0x0025
-, 0x0026
-, 0x0027
-, 0x0028
-, 0x0029
-, 0x002A
-, 0x002B
-, 0x002C
-, 0x002D
-, 0x002E
-, 0x002F
-, 0x0030
-, 0x0031
-, 0x0032
-, 0x0033
-, 0x0034
-, 0x0035
-, 0x0036
-, 0x0037
-, 0x0038
-, 0x0039
-, 0x003A
-, 0x003B
-, 0x003C
-, 0x003D
-, 0x003E
-, 0x003F
-, 0x0040
-, 0x0041
-, 0x0042
-, 0x0043
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x005B
-, 0x005C
-, 0x005D
-, 0x005E
-, 0x005F
-, 0x0060
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x007B
-, 0x007C
-, 0x007D
-, 0x007E
-, 0x2985
-, 0x2986
-, 0x3002
-, 0x300C
-, 0x300D
-, 0x3001
-, 0x30FB
-, 0x30F2
-, 0x30A1
-, 0x30A3
-, 0x30A5
-, 0x30A7
-, 0x30A9
-, 0x30E3
-, 0x30E5
-, 0x30E7
-, 0x30C3
-, 0x30FC
-, 0x30A2
-, 0x30A4
-, 0x30A6
-, 0x30A8
-, 0x30AA
-, 0x30AB
-, 0x30AD
-, 0x30AF
-, 0x30B1
-, 0x30B3
-, 0x30B5
-, 0x30B7
-, 0x30B9
-, 0x30BB
-, 0x30BD
-, 0x30BF
-, 0x30C1
-, 0x30C4
-, 0x30C6
-, 0x30C8
-, 0x30CA
-, 0x30CB
-, 0x30CC
-, 0x30CD
-, 0x30CE
-, 0x30CF
-, 0x30D2
-, 0x30D5
-, 0x30D8
-, 0x30DB
-, 0x30DE
-, 0x30DF
-, 0x30E0
-, 0x30E1
-, 0x30E2
-, 0x30E4
-, 0x30E6
-, 0x30E8
-, 0x30E9
-, 0x30EA
-, 0x30EB
-, 0x30EC
-, 0x30ED
-, 0x30EF
-, 0x30F3
-, 0x3099
-, 0x309A
-, 0x3164
-, 0x3131
-, 0x3132
-, 0x3133
-, 0x3134
-, 0x3135
-, 0x3136
-, 0x3137
-, 0x3138
-, 0x3139
-, 0x313A
-, 0x313B
-, 0x313C
-, 0x313D
-, 0x313E
-, 0x313F
-, 0x3140
-, 0x3141
-, 0x3142
-, 0x3143
-, 0x3144
-, 0x3145
-, 0x3146
-, 0x3147
-, 0x3148
-, 0x3149
-, 0x314A
-, 0x314B
-, 0x314C
-, 0x314D
-, 0x314E
-, 0x314F
-, 0x3150
-, 0x3151
-, 0x3152
-, 0x3153
-, 0x3154
-, 0x3155
-, 0x3156
-, 0x3157
-, 0x3158
-, 0x3159
-, 0x315A
-, 0x315B
-, 0x315C
-, 0x315D
-, 0x315E
-, 0x315F
-, 0x3160
-, 0x3161
-, 0x3162
-, 0x3163
-, 0x00A2
-, 0x00A3
-, 0x00AC
-, 0x00AF
-, 0x00A6
-, 0x00A5
-, 0x20A9
-, 0x2502
-, 0x2190
-, 0x2191
-, 0x2192
-, 0x2193
-, 0x25A0
-, 0x25CB
-, 0x11099
-, 0x110BA
-, 0x1109B
-, 0x110BA
-, 0x110A5
-, 0x110BA
-, 0x11131
-, 0x11127
-, 0x11132
-, 0x11127
-, 0x11347
-, 0x1133E
-, 0x11347
-, 0x11357
-, 0x114B9
-, 0x114BA
-, 0x114B9
-, 0x114B0
-, 0x114B9
-, 0x114BD
-, 0x115B8
-, 0x115AF
-, 0x115B9
-, 0x115AF
-, 0x1D157
-, 0x1D165
-, 0x1D158
-, 0x1D165
-, 0x1D15F
-, 0x1D16E
-, 0x1D15F
-, 0x1D16F
-, 0x1D15F
-, 0x1D170
-, 0x1D15F
-, 0x1D171
-, 0x1D15F
-, 0x1D172
-, 0x1D1B9
-, 0x1D165
-, 0x1D1BA
-, 0x1D165
-, 0x1D1BB
-, 0x1D16E
-, 0x1D1BC
-, 0x1D16E
-, 0x1D1BB
-, 0x1D16F
-, 0x1D1BC
-, 0x1D16F
-, 0x0041
-, 0x0042
-, 0x0043
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0041
-, 0x0042
-, 0x0043
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0041
-, 0x0042
-, 0x0043
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0041
-, 0x0043
-, 0x0044
-, 0x0047
-, 0x004A
-, 0x004B
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0066
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0041
-, 0x0042
-, 0x0043
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0041
-, 0x0042
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0041
-, 0x0042
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004F
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0041
-, 0x0042
-, 0x0043
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0041
-, 0x0042
-, 0x0043
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0041
-, 0x0042
-, 0x0043
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0041
-, 0x0042
-, 0x0043
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0041
-, 0x0042
-, 0x0043
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0041
-, 0x0042
-, 0x0043
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x0061
-, 0x0062
-, 0x0063
-, 0x0064
-, 0x0065
-, 0x0066
-, 0x0067
-, 0x0068
-, 0x0069
-, 0x006A
-, 0x006B
-, 0x006C
-, 0x006D
-, 0x006E
-, 0x006F
-, 0x0070
-, 0x0071
-, 0x0072
-, 0x0073
-, 0x0074
-, 0x0075
-, 0x0076
-, 0x0077
-, 0x0078
-, 0x0079
-, 0x007A
-, 0x0131
-, 0x0237
-, 0x0391
-, 0x0392
-, 0x0393
-, 0x0394
-, 0x0395
-, 0x0396
-, 0x0397
-, 0x0398
-, 0x0399
-, 0x039A
-, 0x039B
-, 0x039C
-, 0x039D
-, 0x039E
-, 0x039F
-, 0x03A0
-, 0x03A1
-, 0x03F4
-, 0x03A3
-, 0x03A4
-, 0x03A5
-, 0x03A6
-, 0x03A7
-, 0x03A8
-, 0x03A9
-, 0x2207
-, 0x03B1
-, 0x03B2
-, 0x03B3
-, 0x03B4
-, 0x03B5
-, 0x03B6
-, 0x03B7
-, 0x03B8
-, 0x03B9
-, 0x03BA
-, 0x03BB
-, 0x03BC
-, 0x03BD
-, 0x03BE
-, 0x03BF
-, 0x03C0
-, 0x03C1
-, 0x03C2
-, 0x03C3
-, 0x03C4
-, 0x03C5
-, 0x03C6
-, 0x03C7
-, 0x03C8
-, 0x03C9
-, 0x2202
-, 0x03F5
-, 0x03D1
-, 0x03F0
-, 0x03D5
-, 0x03F1
-, 0x03D6
-, 0x0391
-, 0x0392
-, 0x0393
-, 0x0394
-, 0x0395
-, 0x0396
-, 0x0397
-, 0x0398
-, 0x0399
-, 0x039A
-, 0x039B
-, 0x039C
-, 0x039D
-, 0x039E
-, 0x039F
-, 0x03A0
-, 0x03A1
-, 0x03F4
-, 0x03A3
-, 0x03A4
-, 0x03A5
-, 0x03A6
-, 0x03A7
-, 0x03A8
-, 0x03A9
-, 0x2207
-, 0x03B1
-, 0x03B2
-, 0x03B3
-, 0x03B4
-, 0x03B5
-, 0x03B6
-, 0x03B7
-, 0x03B8
-, 0x03B9
-, 0x03BA
-, 0x03BB
-, 0x03BC
-, 0x03BD
-, 0x03BE
-, 0x03BF
-, 0x03C0
-, 0x03C1
-, 0x03C2
-, 0x03C3
-, 0x03C4
-, 0x03C5
-, 0x03C6
-, 0x03C7
-, 0x03C8
-, 0x03C9
-, 0x2202
-, 0x03F5
-, 0x03D1
-, 0x03F0
-, 0x03D5
-, 0x03F1
-, 0x03D6
-, 0x0391
-, 0x0392
-, 0x0393
-, 0x0394
-, 0x0395
-, 0x0396
-, 0x0397
-, 0x0398
-, 0x0399
-, 0x039A
-, 0x039B
-, 0x039C
-, 0x039D
-, 0x039E
-, 0x039F
-, 0x03A0
-, 0x03A1
-, 0x03F4
-, 0x03A3
-, 0x03A4
-, 0x03A5
-, 0x03A6
-, 0x03A7
-, 0x03A8
-, 0x03A9
-, 0x2207
-, 0x03B1
-, 0x03B2
-, 0x03B3
-, 0x03B4
-, 0x03B5
-, 0x03B6
-, 0x03B7
-, 0x03B8
-, 0x03B9
-, 0x03BA
-, 0x03BB
-, 0x03BC
-, 0x03BD
-, 0x03BE
-, 0x03BF
-, 0x03C0
-, 0x03C1
-, 0x03C2
-, 0x03C3
-, 0x03C4
-, 0x03C5
-, 0x03C6
-, 0x03C7
-, 0x03C8
-, 0x03C9
-, 0x2202
-, 0x03F5
-, 0x03D1
-, 0x03F0
-, 0x03D5
-, 0x03F1
-, 0x03D6
-, 0x0391
-, 0x0392
-, 0x0393
-, 0x0394
-, 0x0395
-, 0x0396
-, 0x0397
-, 0x0398
-, 0x0399
-, 0x039A
-, 0x039B
-, 0x039C
-, 0x039D
-, 0x039E
-, 0x039F
-, 0x03A0
-, 0x03A1
-, 0x03F4
-, 0x03A3
-, 0x03A4
-, 0x03A5
-, 0x03A6
-, 0x03A7
-, 0x03A8
-, 0x03A9
-, 0x2207
-, 0x03B1
-, 0x03B2
-, 0x03B3
-, 0x03B4
-, 0x03B5
-, 0x03B6
-, 0x03B7
-, 0x03B8
-, 0x03B9
-, 0x03BA
-, 0x03BB
-, 0x03BC
-, 0x03BD
-, 0x03BE
-, 0x03BF
-, 0x03C0
-, 0x03C1
-, 0x03C2
-, 0x03C3
-, 0x03C4
-, 0x03C5
-, 0x03C6
-, 0x03C7
-, 0x03C8
-, 0x03C9
-, 0x2202
-, 0x03F5
-, 0x03D1
-, 0x03F0
-, 0x03D5
-, 0x03F1
-, 0x03D6
-, 0x0391
-, 0x0392
-, 0x0393
-, 0x0394
-, 0x0395
-, 0x0396
-, 0x0397
-, 0x0398
-, 0x0399
-, 0x039A
-, 0x039B
-, 0x039C
-, 0x039D
-, 0x039E
-, 0x039F
-, 0x03A0
-, 0x03A1
-, 0x03F4
-, 0x03A3
-, 0x03A4
-, 0x03A5
-, 0x03A6
-, 0x03A7
-, 0x03A8
-, 0x03A9
-, 0x2207
-, 0x03B1
-, 0x03B2
-, 0x03B3
-, 0x03B4
-, 0x03B5
-, 0x03B6
-, 0x03B7
-, 0x03B8
-, 0x03B9
-, 0x03BA
-, 0x03BB
-, 0x03BC
-, 0x03BD
-, 0x03BE
-, 0x03BF
-, 0x03C0
-, 0x03C1
-, 0x03C2
-, 0x03C3
-, 0x03C4
-, 0x03C5
-, 0x03C6
-, 0x03C7
-, 0x03C8
-, 0x03C9
-, 0x2202
-, 0x03F5
-, 0x03D1
-, 0x03F0
-, 0x03D5
-, 0x03F1
-, 0x03D6
-, 0x03DC
-, 0x03DD
-, 0x0030
-, 0x0031
-, 0x0032
-, 0x0033
-, 0x0034
-, 0x0035
-, 0x0036
-, 0x0037
-, 0x0038
-, 0x0039
-, 0x0030
-, 0x0031
-, 0x0032
-, 0x0033
-, 0x0034
-, 0x0035
-, 0x0036
-, 0x0037
-, 0x0038
-, 0x0039
-, 0x0030
-, 0x0031
-, 0x0032
-, 0x0033
-, 0x0034
-, 0x0035
-, 0x0036
-, 0x0037
-, 0x0038
-, 0x0039
-, 0x0030
-, 0x0031
-, 0x0032
-, 0x0033
-, 0x0034
-, 0x0035
-, 0x0036
-, 0x0037
-, 0x0038
-, 0x0039
-, 0x0030
-, 0x0031
-, 0x0032
-, 0x0033
-, 0x0034
-, 0x0035
-, 0x0036
-, 0x0037
-, 0x0038
-, 0x0039
-, 0x0627
-, 0x0628
-, 0x062C
-, 0x062F
-, 0x0648
-, 0x0632
-, 0x062D
-, 0x0637
-, 0x064A
-, 0x0643
-, 0x0644
-, 0x0645
-, 0x0646
-, 0x0633
-, 0x0639
-, 0x0641
-, 0x0635
-, 0x0642
-, 0x0631
-, 0x0634
-, 0x062A
-, 0x062B
-, 0x062E
-, 0x0630
-, 0x0636
-, 0x0638
-, 0x063A
-, 0x066E
-, 0x06BA
-, 0x06A1
-, 0x066F
-, 0x0628
-, 0x062C
-, 0x0647
-, 0x062D
-, 0x064A
-, 0x0643
-, 0x0644
-, 0x0645
-, 0x0646
-, 0x0633
-, 0x0639
-, 0x0641
-, 0x0635
-, 0x0642
-, 0x0634
-, 0x062A
-, 0x062B
-, 0x062E
-, 0x0636
-, 0x063A
-, 0x062C
-, 0x062D
-, 0x064A
-, 0x0644
-, 0x0646
-, 0x0633
-, 0x0639
-, 0x0635
-, 0x0642
-, 0x0634
-, 0x062E
-, 0x0636
-, 0x063A
-, 0x06BA
-, 0x066F
-, 0x0628
-, 0x062C
-, 0x0647
-, 0x062D
-, 0x0637
-, 0x064A
-, 0x0643
-, 0x0645
-, 0x0646
-, 0x0633
-, 0x0639
-, 0x0641
-, 0x0635
-, 0x0642
-, 0x0634
-, 0x062A
-, 0x062B
-, 0x062E
-, 0x0636
-, 0x0638
-, 0x063A
-, 0x066E
-, 0x06A1
-, 0x0627
-, 0x0628
-, 0x062C
-, 0x062F
-, 0x0647
-, 0x0648
-, 0x0632
-, 0x062D
-, 0x0637
-, 0x064A
-, 0x0644
-, 0x0645
-, 0x0646
-, 0x0633
-, 0x0639
-, 0x0641
-, 0x0635
-, 0x0642
-, 0x0631
-, 0x0634
-, 0x062A
-, 0x062B
-, 0x062E
-, 0x0630
-, 0x0636
-, 0x0638
-, 0x063A
-, 0x0628
-, 0x062C
-, 0x062F
-, 0x0648
-, 0x0632
-, 0x062D
-, 0x0637
-, 0x064A
-, 0x0644
-, 0x0645
-, 0x0646
-, 0x0633
-, 0x0639
-, 0x0641
-, 0x0635
-, 0x0642
-, 0x0631
-, 0x0634
-, 0x062A
-, 0x062B
-, 0x062E
-, 0x0630
-, 0x0636
-, 0x0638
-, 0x063A
-, 0x0030
-, 0x002E
-, 0x0030
-, 0x002C
-, 0x0031
-, 0x002C
-, 0x0032
-, 0x002C
-, 0x0033
-, 0x002C
-, 0x0034
-, 0x002C
-, 0x0035
-, 0x002C
-, 0x0036
-, 0x002C
-, 0x0037
-, 0x002C
-, 0x0038
-, 0x002C
-, 0x0039
-, 0x002C
-, 0x0028
-, 0x0041
-, 0x0029
-, 0x0028
-, 0x0042
-, 0x0029
-, 0x0028
-, 0x0043
-, 0x0029
-, 0x0028
-, 0x0044
-, 0x0029
-, 0x0028
-, 0x0045
-, 0x0029
-, 0x0028
-, 0x0046
-, 0x0029
-, 0x0028
-, 0x0047
-, 0x0029
-, 0x0028
-, 0x0048
-, 0x0029
-, 0x0028
-, 0x0049
-, 0x0029
-, 0x0028
-, 0x004A
-, 0x0029
-, 0x0028
-, 0x004B
-, 0x0029
-, 0x0028
-, 0x004C
-, 0x0029
-, 0x0028
-, 0x004D
-, 0x0029
-, 0x0028
-, 0x004E
-, 0x0029
-, 0x0028
-, 0x004F
-, 0x0029
-, 0x0028
-, 0x0050
-, 0x0029
-, 0x0028
-, 0x0051
-, 0x0029
-, 0x0028
-, 0x0052
-, 0x0029
-, 0x0028
-, 0x0053
-, 0x0029
-, 0x0028
-, 0x0054
-, 0x0029
-, 0x0028
-, 0x0055
-, 0x0029
-, 0x0028
-, 0x0056
-, 0x0029
-, 0x0028
-, 0x0057
-, 0x0029
-, 0x0028
-, 0x0058
-, 0x0029
-, 0x0028
-, 0x0059
-, 0x0029
-, 0x0028
-, 0x005A
-, 0x0029
-, 0x3014
-, 0x0053
-, 0x3015
-, 0x0043
-, 0x0052
-, 0x0043
-, 0x0044
-, 0x0057
-, 0x005A
-, 0x0041
-, 0x0042
-, 0x0043
-, 0x0044
-, 0x0045
-, 0x0046
-, 0x0047
-, 0x0048
-, 0x0049
-, 0x004A
-, 0x004B
-, 0x004C
-, 0x004D
-, 0x004E
-, 0x004F
-, 0x0050
-, 0x0051
-, 0x0052
-, 0x0053
-, 0x0054
-, 0x0055
-, 0x0056
-, 0x0057
-, 0x0058
-, 0x0059
-, 0x005A
-, 0x0048
-, 0x0056
-, 0x004D
-, 0x0056
-, 0x0053
-, 0x0044
-, 0x0053
-, 0x0053
-, 0x0050
-, 0x0050
-, 0x0056
-, 0x0057
-, 0x0043
-, 0x004D
-, 0x0043
-, 0x004D
-, 0x0044
-, 0x004D
-, 0x0052
-, 0x0044
-, 0x004A
-, 0x307B
-, 0x304B
-, 0x30B3
-, 0x30B3
-, 0x30B5
-, 0x624B
-, 0x5B57
-, 0x53CC
-, 0x30C7
-, 0x4E8C
-, 0x591A
-, 0x89E3
-, 0x5929
-, 0x4EA4
-, 0x6620
-, 0x7121
-, 0x6599
-, 0x524D
-, 0x5F8C
-, 0x518D
-, 0x65B0
-, 0x521D
-, 0x7D42
-, 0x751F
-, 0x8CA9
-, 0x58F0
-, 0x5439
-, 0x6F14
-, 0x6295
-, 0x6355
-, 0x4E00
-, 0x4E09
-, 0x904A
-, 0x5DE6
-, 0x4E2D
-, 0x53F3
-, 0x6307
-, 0x8D70
-, 0x6253
-, 0x7981
-, 0x7A7A
-, 0x5408
-, 0x6E80
-, 0x6709
-, 0x6708
-, 0x7533
-, 0x5272
-, 0x55B6
-, 0x914D
-, 0x3014
-, 0x672C
-, 0x3015
-, 0x3014
-, 0x4E09
-, 0x3015
-, 0x3014
-, 0x4E8C
-, 0x3015
-, 0x3014
-, 0x5B89
-, 0x3015
-, 0x3014
-, 0x70B9
-, 0x3015
-, 0x3014
-, 0x6253
-, 0x3015
-, 0x3014
-, 0x76D7
-, 0x3015
-, 0x3014
-, 0x52DD
-, 0x3015
-, 0x3014
-, 0x6557
-, 0x3015
-, 0x5F97
-, 0x53EF
-, 0x4E3D
-, 0x4E38
-, 0x4E41
-, 0x20122
-, 0x4F60
-, 0x4FAE
-, 0x4FBB
-, 0x5002
-, 0x507A
-, 0x5099
-, 0x50E7
-, 0x50CF
-, 0x349E
-, 0x2063A
-, 0x514D
-, 0x5154
-, 0x5164
-, 0x5177
-, 0x2051C
-, 0x34B9
-, 0x5167
-, 0x518D
-, 0x2054B
-, 0x5197
-, 0x51A4
-, 0x4ECC
-, 0x51AC
-, 0x51B5
-, 0x291DF
-, 0x51F5
-, 0x5203
-, 0x34DF
-, 0x523B
-, 0x5246
-, 0x5272
-, 0x5277
-, 0x3515
-, 0x52C7
-, 0x52C9
-, 0x52E4
-, 0x52FA
-, 0x5305
-, 0x5306
-, 0x5317
-, 0x5349
-, 0x5351
-, 0x535A
-, 0x5373
-, 0x537D
-, 0x537F
-, 0x537F
-, 0x537F
-, 0x20A2C
-, 0x7070
-, 0x53CA
-, 0x53DF
-, 0x20B63
-, 0x53EB
-, 0x53F1
-, 0x5406
-, 0x549E
-, 0x5438
-, 0x5448
-, 0x5468
-, 0x54A2
-, 0x54F6
-, 0x5510
-, 0x5553
-, 0x5563
-, 0x5584
-, 0x5584
-, 0x5599
-, 0x55AB
-, 0x55B3
-, 0x55C2
-, 0x5716
-, 0x5606
-, 0x5717
-, 0x5651
-, 0x5674
-, 0x5207
-, 0x58EE
-, 0x57CE
-, 0x57F4
-, 0x580D
-, 0x578B
-, 0x5832
-, 0x5831
-, 0x58AC
-, 0x214E4
-, 0x58F2
-, 0x58F7
-, 0x5906
-, 0x591A
-, 0x5922
-, 0x5962
-, 0x216A8
-, 0x216EA
-, 0x59EC
-, 0x5A1B
-, 0x5A27
-, 0x59D8
-, 0x5A66
-, 0x36EE
-, 0x36FC
-, 0x5B08
-, 0x5B3E
-, 0x5B3E
-, 0x219C8
-, 0x5BC3
-, 0x5BD8
-, 0x5BE7
-, 0x5BF3
-, 0x21B18
-, 0x5BFF
-, 0x5C06
-, 0x5F53
-, 0x5C22
-, 0x3781
-, 0x5C60
-, 0x5C6E
-, 0x5CC0
-, 0x5C8D
-, 0x21DE4
-, 0x5D43
-, 0x21DE6
-, 0x5D6E
-, 0x5D6B
-, 0x5D7C
-, 0x5DE1
-, 0x5DE2
-, 0x382F
-, 0x5DFD
-, 0x5E28
-, 0x5E3D
-, 0x5E69
-, 0x3862
-, 0x22183
-, 0x387C
-, 0x5EB0
-, 0x5EB3
-, 0x5EB6
-, 0x5ECA
-, 0x2A392
-, 0x5EFE
-, 0x22331
-, 0x22331
-, 0x8201
-, 0x5F22
-, 0x5F22
-, 0x38C7
-, 0x232B8
-, 0x261DA
-, 0x5F62
-, 0x5F6B
-, 0x38E3
-, 0x5F9A
-, 0x5FCD
-, 0x5FD7
-, 0x5FF9
-, 0x6081
-, 0x393A
-, 0x391C
-, 0x6094
-, 0x226D4
-, 0x60C7
-, 0x6148
-, 0x614C
-, 0x614E
-, 0x614C
-, 0x617A
-, 0x618E
-, 0x61B2
-, 0x61A4
-, 0x61AF
-, 0x61DE
-, 0x61F2
-, 0x61F6
-, 0x6210
-, 0x621B
-, 0x625D
-, 0x62B1
-, 0x62D4
-, 0x6350
-, 0x22B0C
-, 0x633D
-, 0x62FC
-, 0x6368
-, 0x6383
-, 0x63E4
-, 0x22BF1
-, 0x6422
-, 0x63C5
-, 0x63A9
-, 0x3A2E
-, 0x6469
-, 0x647E
-, 0x649D
-, 0x6477
-, 0x3A6C
-, 0x654F
-, 0x656C
-, 0x2300A
-, 0x65E3
-, 0x66F8
-, 0x6649
-, 0x3B19
-, 0x6691
-, 0x3B08
-, 0x3AE4
-, 0x5192
-, 0x5195
-, 0x6700
-, 0x669C
-, 0x80AD
-, 0x43D9
-, 0x6717
-, 0x671B
-, 0x6721
-, 0x675E
-, 0x6753
-, 0x233C3
-, 0x3B49
-, 0x67FA
-, 0x6785
-, 0x6852
-, 0x6885
-, 0x2346D
-, 0x688E
-, 0x681F
-, 0x6914
-, 0x3B9D
-, 0x6942
-, 0x69A3
-, 0x69EA
-, 0x6AA8
-, 0x236A3
-, 0x6ADB
-, 0x3C18
-, 0x6B21
-, 0x238A7
-, 0x6B54
-, 0x3C4E
-, 0x6B72
-, 0x6B9F
-, 0x6BBA
-, 0x6BBB
-, 0x23A8D
-, 0x21D0B
-, 0x23AFA
-, 0x6C4E
-, 0x23CBC
-, 0x6CBF
-, 0x6CCD
-, 0x6C67
-, 0x6D16
-, 0x6D3E
-, 0x6D77
-, 0x6D41
-, 0x6D69
-, 0x6D78
-, 0x6D85
-, 0x23D1E
-, 0x6D34
-, 0x6E2F
-, 0x6E6E
-, 0x3D33
-, 0x6ECB
-, 0x6EC7
-, 0x23ED1
-, 0x6DF9
-, 0x6F6E
-, 0x23F5E
-, 0x23F8E
-, 0x6FC6
-, 0x7039
-, 0x701E
-, 0x701B
-, 0x3D96
-, 0x704A
-, 0x707D
-, 0x7077
-, 0x70AD
-, 0x20525
-, 0x7145
-, 0x24263
-, 0x719C
-, 0x243AB
-, 0x7228
-, 0x7235
-, 0x7250
-, 0x24608
-, 0x7280
-, 0x7295
-, 0x24735
-, 0x24814
-, 0x737A
-, 0x738B
-, 0x3EAC
-, 0x73A5
-, 0x3EB8
-, 0x3EB8
-, 0x7447
-, 0x745C
-, 0x7471
-, 0x7485
-, 0x74CA
-, 0x3F1B
-, 0x7524
-, 0x24C36
-, 0x753E
-, 0x24C92
-, 0x7570
-, 0x2219F
-, 0x7610
-, 0x24FA1
-, 0x24FB8
-, 0x25044
-, 0x3FFC
-, 0x4008
-, 0x76F4
-, 0x250F3
-, 0x250F2
-, 0x25119
-, 0x25133
-, 0x771E
-, 0x771F
-, 0x771F
-, 0x774A
-, 0x4039
-, 0x778B
-, 0x4046
-, 0x4096
-, 0x2541D
-, 0x784E
-, 0x788C
-, 0x78CC
-, 0x40E3
-, 0x25626
-, 0x7956
-, 0x2569A
-, 0x256C5
-, 0x798F
-, 0x79EB
-, 0x412F
-, 0x7A40
-, 0x7A4A
-, 0x7A4F
-, 0x2597C
-, 0x25AA7
-, 0x25AA7
-, 0x7AEE
-, 0x4202
-, 0x25BAB
-, 0x7BC6
-, 0x7BC9
-, 0x4227
-, 0x25C80
-, 0x7CD2
-, 0x42A0
-, 0x7CE8
-, 0x7CE3
-, 0x7D00
-, 0x25F86
-, 0x7D63
-, 0x4301
-, 0x7DC7
-, 0x7E02
-, 0x7E45
-, 0x4334
-, 0x26228
-, 0x26247
-, 0x4359
-, 0x262D9
-, 0x7F7A
-, 0x2633E
-, 0x7F95
-, 0x7FFA
-, 0x8005
-, 0x264DA
-, 0x26523
-, 0x8060
-, 0x265A8
-, 0x8070
-, 0x2335F
-, 0x43D5
-, 0x80B2
-, 0x8103
-, 0x440B
-, 0x813E
-, 0x5AB5
-, 0x267A7
-, 0x267B5
-, 0x23393
-, 0x2339C
-, 0x8201
-, 0x8204
-, 0x8F9E
-, 0x446B
-, 0x8291
-, 0x828B
-, 0x829D
-, 0x52B3
-, 0x82B1
-, 0x82B3
-, 0x82BD
-, 0x82E6
-, 0x26B3C
-, 0x82E5
-, 0x831D
-, 0x8363
-, 0x83AD
-, 0x8323
-, 0x83BD
-, 0x83E7
-, 0x8457
-, 0x8353
-, 0x83CA
-, 0x83CC
-, 0x83DC
-, 0x26C36
-, 0x26D6B
-, 0x26CD5
-, 0x452B
-, 0x84F1
-, 0x84F3
-, 0x8516
-, 0x273CA
-, 0x8564
-, 0x26F2C
-, 0x455D
-, 0x4561
-, 0x26FB1
-, 0x270D2
-, 0x456B
-, 0x8650
-, 0x865C
-, 0x8667
-, 0x8669
-, 0x86A9
-, 0x8688
-, 0x870E
-, 0x86E2
-, 0x8779
-, 0x8728
-, 0x876B
-, 0x8786
-, 0x45D7
-, 0x87E1
-, 0x8801
-, 0x45F9
-, 0x8860
-, 0x8863
-, 0x27667
-, 0x88D7
-, 0x88DE
-, 0x4635
-, 0x88FA
-, 0x34BB
-, 0x278AE
-, 0x27966
-, 0x46BE
-, 0x46C7
-, 0x8AA0
-, 0x8AED
-, 0x8B8A
-, 0x8C55
-, 0x27CA8
-, 0x8CAB
-, 0x8CC1
-, 0x8D1B
-, 0x8D77
-, 0x27F2F
-, 0x20804
-, 0x8DCB
-, 0x8DBC
-, 0x8DF0
-, 0x208DE
-, 0x8ED4
-, 0x8F38
-, 0x285D2
-, 0x285ED
-, 0x9094
-, 0x90F1
-, 0x9111
-, 0x2872E
-, 0x911B
-, 0x9238
-, 0x92D7
-, 0x92D8
-, 0x927C
-, 0x93F9
-, 0x9415
-, 0x28BFA
-, 0x958B
-, 0x4995
-, 0x95B7
-, 0x28D77
-, 0x49E6
-, 0x96C3
-, 0x5DB2
-, 0x9723
-, 0x29145
-, 0x2921A
-, 0x4A6E
-, 0x4A76
-, 0x97E0
-, 0x2940A
-, 0x4AB2
-, 0x29496
-, 0x980B
-, 0x980B
-, 0x9829
-, 0x295B6
-, 0x98E2
-, 0x4B33
-, 0x9929
-, 0x99A7
-, 0x99C2
-, 0x99FE
-, 0x4BCE
-, 0x29B30
-, 0x9B12
-, 0x9C40
-, 0x9CFD
-, 0x4CCE
-, 0x4CED
-, 0x9D67
-, 0x2A0CE
-, 0x4CF8
-, 0x2A105
-, 0x2A20E
-, 0x2A291
-, 0x9EBB
-, 0x4D56
-, 0x9EF9
-, 0x9EFE
-, 0x9F05
-, 0x9F0F
-, 0x9F16
-, 0x9F3B
-, 0x2A600
+  0x00000020, 0x00000020, 0xE6000308, 0x00000061, 0x00000020, 0xE6000304, 0x00000032, 0x00000033,
+  0x00000020, 0xE6000301, 0x000003BC, 0x00000020, 0xCA000327, 0x00000031, 0x0000006F, 0x00000031,
+  0x00002044, 0x00000034, 0x00000031, 0x00002044, 0x00000032, 0x00000033, 0x00002044, 0x00000034,
+  0x00000041, 0xE6000300, 0x00000041, 0xE6000301, 0x00000041, 0xE6000302, 0x00000041, 0xE6000303,
+  0x00000041, 0xE6000308, 0x00000041, 0xE600030A, 0x00000043, 0xCA000327, 0x00000045, 0xE6000300,
+  0x00000045, 0xE6000301, 0x00000045, 0xE6000302, 0x00000045, 0xE6000308, 0x00000049, 0xE6000300,
+  0x00000049, 0xE6000301, 0x00000049, 0xE6000302, 0x00000049, 0xE6000308, 0x0000004E, 0xE6000303,
+  0x0000004F, 0xE6000300, 0x0000004F, 0xE6000301, 0x0000004F, 0xE6000302, 0x0000004F, 0xE6000303,
+  0x0000004F, 0xE6000308, 0x00000055, 0xE6000300, 0x00000055, 0xE6000301, 0x00000055, 0xE6000302,
+  0x00000055, 0xE6000308, 0x00000059, 0xE6000301, 0x00000061, 0xE6000300, 0x00000061, 0xE6000301,
+  0x00000061, 0xE6000302, 0x00000061, 0xE6000303, 0x00000061, 0xE6000308, 0x00000061, 0xE600030A,
+  0x00000063, 0xCA000327, 0x00000065, 0xE6000300, 0x00000065, 0xE6000301, 0x00000065, 0xE6000302,
+  0x00000065, 0xE6000308, 0x00000069, 0xE6000300, 0x00000069, 0xE6000301, 0x00000069, 0xE6000302,
+  0x00000069, 0xE6000308, 0x0000006E, 0xE6000303, 0x0000006F, 0xE6000300, 0x0000006F, 0xE6000301,
+  0x0000006F, 0xE6000302, 0x0000006F, 0xE6000303, 0x0000006F, 0xE6000308, 0x00000075, 0xE6000300,
+  0x00000075, 0xE6000301, 0x00000075, 0xE6000302, 0x00000075, 0xE6000308, 0x00000079, 0xE6000301,
+  0x00000079, 0xE6000308, 0x00000041, 0xE6000304, 0x00000061, 0xE6000304, 0x00000041, 0xE6000306,
+  0x00000061, 0xE6000306, 0x00000041, 0xCA000328, 0x00000061, 0xCA000328, 0x00000043, 0xE6000301,
+  0x00000063, 0xE6000301, 0x00000043, 0xE6000302, 0x00000063, 0xE6000302, 0x00000043, 0xE6000307,
+  0x00000063, 0xE6000307, 0x00000043, 0xE600030C, 0x00000063, 0xE600030C, 0x00000044, 0xE600030C,
+  0x00000064, 0xE600030C, 0x00000045, 0xE6000304, 0x00000065, 0xE6000304, 0x00000045, 0xE6000306,
+  0x00000065, 0xE6000306, 0x00000045, 0xE6000307, 0x00000065, 0xE6000307, 0x00000045, 0xCA000328,
+  0x00000065, 0xCA000328, 0x00000045, 0xE600030C, 0x00000065, 0xE600030C, 0x00000047, 0xE6000302,
+  0x00000067, 0xE6000302, 0x00000047, 0xE6000306, 0x00000067, 0xE6000306, 0x00000047, 0xE6000307,
+  0x00000067, 0xE6000307, 0x00000047, 0xCA000327, 0x00000067, 0xCA000327, 0x00000048, 0xE6000302,
+  0x00000068, 0xE6000302, 0x00000049, 0xE6000303, 0x00000069, 0xE6000303, 0x00000049, 0xE6000304,
+  0x00000069, 0xE6000304, 0x00000049, 0xE6000306, 0x00000069, 0xE6000306, 0x00000049, 0xCA000328,
+  0x00000069, 0xCA000328, 0x00000049, 0xE6000307, 0x00000049, 0x0000004A, 0x00000069, 0x0000006A,
+  0x0000004A, 0xE6000302, 0x0000006A, 0xE6000302, 0x0000004B, 0xCA000327, 0x0000006B, 0xCA000327,
+  0x0000004C, 0xE6000301, 0x0000006C, 0xE6000301, 0x0000004C, 0xCA000327, 0x0000006C, 0xCA000327,
+  0x0000004C, 0xE600030C, 0x0000006C, 0xE600030C, 0x0000004C, 0x000000B7, 0x0000006C, 0x000000B7,
+  0x0000004E, 0xE6000301, 0x0000006E, 0xE6000301, 0x0000004E, 0xCA000327, 0x0000006E, 0xCA000327,
+  0x0000004E, 0xE600030C, 0x0000006E, 0xE600030C, 0x000002BC, 0x0000006E, 0x0000004F, 0xE6000304,
+  0x0000006F, 0xE6000304, 0x0000004F, 0xE6000306, 0x0000006F, 0xE6000306, 0x0000004F, 0xE600030B,
+  0x0000006F, 0xE600030B, 0x00000052, 0xE6000301, 0x00000072, 0xE6000301, 0x00000052, 0xCA000327,
+  0x00000072, 0xCA000327, 0x00000052, 0xE600030C, 0x00000072, 0xE600030C, 0x00000053, 0xE6000301,
+  0x00000073, 0xE6000301, 0x00000053, 0xE6000302, 0x00000073, 0xE6000302, 0x00000053, 0xCA000327,
+  0x00000073, 0xCA000327, 0x00000053, 0xE600030C, 0x00000073, 0xE600030C, 0x00000054, 0xCA000327,
+  0x00000074, 0xCA000327, 0x00000054, 0xE600030C, 0x00000074, 0xE600030C, 0x00000055, 0xE6000303,
+  0x00000075, 0xE6000303, 0x00000055, 0xE6000304, 0x00000075, 0xE6000304, 0x00000055, 0xE6000306,
+  0x00000075, 0xE6000306, 0x00000055, 0xE600030A, 0x00000075, 0xE600030A, 0x00000055, 0xE600030B,
+  0x00000075, 0xE600030B, 0x00000055, 0xCA000328, 0x00000075, 0xCA000328, 0x00000057, 0xE6000302,
+  0x00000077, 0xE6000302, 0x00000059, 0xE6000302, 0x00000079, 0xE6000302, 0x00000059, 0xE6000308,
+  0x0000005A, 0xE6000301, 0x0000007A, 0xE6000301, 0x0000005A, 0xE6000307, 0x0000007A, 0xE6000307,
+  0x0000005A, 0xE600030C, 0x0000007A, 0xE600030C, 0x00000073, 0x0000004F, 0xD800031B, 0x0000006F,
+  0xD800031B, 0x00000055, 0xD800031B, 0x00000075, 0xD800031B, 0x00000044, 0x0000005A, 0xE600030C,
+  0x00000044, 0x0000007A, 0xE600030C, 0x00000064, 0x0000007A, 0xE600030C, 0x0000004C, 0x0000004A,
+  0x0000004C, 0x0000006A, 0x0000006C, 0x0000006A, 0x0000004E, 0x0000004A, 0x0000004E, 0x0000006A,
+  0x0000006E, 0x0000006A, 0x00000041, 0xE600030C, 0x00000061, 0xE600030C, 0x00000049, 0xE600030C,
+  0x00000069, 0xE600030C, 0x0000004F, 0xE600030C, 0x0000006F, 0xE600030C, 0x00000055, 0xE600030C,
+  0x00000075, 0xE600030C, 0x00000055, 0xE6000308, 0xE6000304, 0x00000075, 0xE6000308, 0xE6000304,
+  0x00000055, 0xE6000308, 0xE6000301, 0x00000075, 0xE6000308, 0xE6000301, 0x00000055, 0xE6000308,
+  0xE600030C, 0x00000075, 0xE6000308, 0xE600030C, 0x00000055, 0xE6000308, 0xE6000300, 0x00000075,
+  0xE6000308, 0xE6000300, 0x00000041, 0xE6000308, 0xE6000304, 0x00000061, 0xE6000308, 0xE6000304,
+  0x00000041, 0xE6000307, 0xE6000304, 0x00000061, 0xE6000307, 0xE6000304, 0x000000C6, 0xE6000304,
+  0x000000E6, 0xE6000304, 0x00000047, 0xE600030C, 0x00000067, 0xE600030C, 0x0000004B, 0xE600030C,
+  0x0000006B, 0xE600030C, 0x0000004F, 0xCA000328, 0x0000006F, 0xCA000328, 0x0000004F, 0xCA000328,
+  0xE6000304, 0x0000006F, 0xCA000328, 0xE6000304, 0x000001B7, 0xE600030C, 0x00000292, 0xE600030C,
+  0x0000006A, 0xE600030C, 0x00000044, 0x0000005A, 0x00000044, 0x0000007A, 0x00000064, 0x0000007A,
+  0x00000047, 0xE6000301, 0x00000067, 0xE6000301, 0x0000004E, 0xE6000300, 0x0000006E, 0xE6000300,
+  0x00000041, 0xE600030A, 0xE6000301, 0x00000061, 0xE600030A, 0xE6000301, 0x000000C6, 0xE6000301,
+  0x000000E6, 0xE6000301, 0x000000D8, 0xE6000301, 0x000000F8, 0xE6000301, 0x00000041, 0xE600030F,
+  0x00000061, 0xE600030F, 0x00000041, 0xE6000311, 0x00000061, 0xE6000311, 0x00000045, 0xE600030F,
+  0x00000065, 0xE600030F, 0x00000045, 0xE6000311, 0x00000065, 0xE6000311, 0x00000049, 0xE600030F,
+  0x00000069, 0xE600030F, 0x00000049, 0xE6000311, 0x00000069, 0xE6000311, 0x0000004F, 0xE600030F,
+  0x0000006F, 0xE600030F, 0x0000004F, 0xE6000311, 0x0000006F, 0xE6000311, 0x00000052, 0xE600030F,
+  0x00000072, 0xE600030F, 0x00000052, 0xE6000311, 0x00000072, 0xE6000311, 0x00000055, 0xE600030F,
+  0x00000075, 0xE600030F, 0x00000055, 0xE6000311, 0x00000075, 0xE6000311, 0x00000053, 0xDC000326,
+  0x00000073, 0xDC000326, 0x00000054, 0xDC000326, 0x00000074, 0xDC000326, 0x00000048, 0xE600030C,
+  0x00000068, 0xE600030C, 0x00000041, 0xE6000307, 0x00000061, 0xE6000307, 0x00000045, 0xCA000327,
+  0x00000065, 0xCA000327, 0x0000004F, 0xE6000308, 0xE6000304, 0x0000006F, 0xE6000308, 0xE6000304,
+  0x0000004F, 0xE6000303, 0xE6000304, 0x0000006F, 0xE6000303, 0xE6000304, 0x0000004F, 0xE6000307,
+  0x0000006F, 0xE6000307, 0x0000004F, 0xE6000307, 0xE6000304, 0x0000006F, 0xE6000307, 0xE6000304,
+  0x00000059, 0xE6000304, 0x00000079, 0xE6000304, 0x00000068, 0x00000266, 0x0000006A, 0x00000072,
+  0x00000279, 0x0000027B, 0x00000281, 0x00000077, 0x00000079, 0x00000020, 0xE6000306, 0x00000020,
+  0xE6000307, 0x00000020, 0xE600030A, 0x00000020, 0xCA000328, 0x00000020, 0xE6000303, 0x00000020,
+  0xE600030B, 0x00000263, 0x0000006C, 0x00000073, 0x00000078, 0x00000295, 0xE6000300, 0xE6000301,
+  0xE6000313, 0xE6000308, 0xE6000301, 0x000002B9, 0x00000020, 0xF0000345, 0x0000003B, 0x00000020,
+  0xE6000301, 0x000000A8, 0xE6000301, 0x00000020, 0xE6000308, 0xE6000301, 0x00000391, 0xE6000301,
+  0x000000B7, 0x00000395, 0xE6000301, 0x00000397, 0xE6000301, 0x00000399, 0xE6000301, 0x0000039F,
+  0xE6000301, 0x000003A5, 0xE6000301, 0x000003A9, 0xE6000301, 0x000003B9, 0xE6000308, 0xE6000301,
+  0x00000399, 0xE6000308, 0x000003A5, 0xE6000308, 0x000003B1, 0xE6000301, 0x000003B5, 0xE6000301,
+  0x000003B7, 0xE6000301, 0x000003B9, 0xE6000301, 0x000003C5, 0xE6000308, 0xE6000301, 0x000003B9,
+  0xE6000308, 0x000003C5, 0xE6000308, 0x000003BF, 0xE6000301, 0x000003C5, 0xE6000301, 0x000003C9,
+  0xE6000301, 0x000003B2, 0x000003B8, 0x000003A5, 0x000003D2, 0xE6000301, 0x000003A5, 0xE6000301,
+  0x000003D2, 0xE6000308, 0x000003A5, 0xE6000308, 0x000003C6, 0x000003C0, 0x000003BA, 0x000003C1,
+  0x000003C2, 0x00000398, 0x000003B5, 0x000003A3, 0x00000415, 0xE6000300, 0x00000415, 0xE6000308,
+  0x00000413, 0xE6000301, 0x00000406, 0xE6000308, 0x0000041A, 0xE6000301, 0x00000418, 0xE6000300,
+  0x00000423, 0xE6000306, 0x00000418, 0xE6000306, 0x00000438, 0xE6000306, 0x00000435, 0xE6000300,
+  0x00000435, 0xE6000308, 0x00000433, 0xE6000301, 0x00000456, 0xE6000308, 0x0000043A, 0xE6000301,
+  0x00000438, 0xE6000300, 0x00000443, 0xE6000306, 0x00000474, 0xE600030F, 0x00000475, 0xE600030F,
+  0x00000416, 0xE6000306, 0x00000436, 0xE6000306, 0x00000410, 0xE6000306, 0x00000430, 0xE6000306,
+  0x00000410, 0xE6000308, 0x00000430, 0xE6000308, 0x00000415, 0xE6000306, 0x00000435, 0xE6000306,
+  0x000004D8, 0xE6000308, 0x000004D9, 0xE6000308, 0x00000416, 0xE6000308, 0x00000436, 0xE6000308,
+  0x00000417, 0xE6000308, 0x00000437, 0xE6000308, 0x00000418, 0xE6000304, 0x00000438, 0xE6000304,
+  0x00000418, 0xE6000308, 0x00000438, 0xE6000308, 0x0000041E, 0xE6000308, 0x0000043E, 0xE6000308,
+  0x000004E8, 0xE6000308, 0x000004E9, 0xE6000308, 0x0000042D, 0xE6000308, 0x0000044D, 0xE6000308,
+  0x00000423, 0xE6000304, 0x00000443, 0xE6000304, 0x00000423, 0xE6000308, 0x00000443, 0xE6000308,
+  0x00000423, 0xE600030B, 0x00000443, 0xE600030B, 0x00000427, 0xE6000308, 0x00000447, 0xE6000308,
+  0x0000042B, 0xE6000308, 0x0000044B, 0xE6000308, 0x00000565, 0x00000582, 0x00000627, 0xE6000653,
+  0x00000627, 0xE6000654, 0x00000648, 0xE6000654, 0x00000627, 0xDC000655, 0x0000064A, 0xE6000654,
+  0x00000627, 0x00000674, 0x00000648, 0x00000674, 0x000006C7, 0x00000674, 0x0000064A, 0x00000674,
+  0x000006D5, 0xE6000654, 0x000006C1, 0xE6000654, 0x000006D2, 0xE6000654, 0x00000928, 0x0700093C,
+  0x00000930, 0x0700093C, 0x00000933, 0x0700093C, 0x00000915, 0x0700093C, 0x00000916, 0x0700093C,
+  0x00000917, 0x0700093C, 0x0000091C, 0x0700093C, 0x00000921, 0x0700093C, 0x00000922, 0x0700093C,
+  0x0000092B, 0x0700093C, 0x0000092F, 0x0700093C, 0x000009C7, 0x000009BE, 0x000009C7, 0x000009D7,
+  0x000009A1, 0x070009BC, 0x000009A2, 0x070009BC, 0x000009AF, 0x070009BC, 0x00000A32, 0x07000A3C,
+  0x00000A38, 0x07000A3C, 0x00000A16, 0x07000A3C, 0x00000A17, 0x07000A3C, 0x00000A1C, 0x07000A3C,
+  0x00000A2B, 0x07000A3C, 0x00000B47, 0x00000B56, 0x00000B47, 0x00000B3E, 0x00000B47, 0x00000B57,
+  0x00000B21, 0x07000B3C, 0x00000B22, 0x07000B3C, 0x00000B92, 0x00000BD7, 0x00000BC6, 0x00000BBE,
+  0x00000BC7, 0x00000BBE, 0x00000BC6, 0x00000BD7, 0x00000C46, 0x5B000C56, 0x00000CBF, 0x00000CD5,
+  0x00000CC6, 0x00000CD5, 0x00000CC6, 0x00000CD6, 0x00000CC6, 0x00000CC2, 0x00000CC6, 0x00000CC2,
+  0x00000CD5, 0x00000D46, 0x00000D3E, 0x00000D47, 0x00000D3E, 0x00000D46, 0x00000D57, 0x00000DD9,
+  0x09000DCA, 0x00000DD9, 0x00000DCF, 0x00000DD9, 0x00000DCF, 0x09000DCA, 0x00000DD9, 0x00000DDF,
+  0x00000E4D, 0x00000E32, 0x00000ECD, 0x00000EB2, 0x00000EAB, 0x00000E99, 0x00000EAB, 0x00000EA1,
+  0x00000F0B, 0x00000F42, 0x00000FB7, 0x00000F4C, 0x00000FB7, 0x00000F51, 0x00000FB7, 0x00000F56,
+  0x00000FB7, 0x00000F5B, 0x00000FB7, 0x00000F40, 0x00000FB5, 0x81000F71, 0x82000F72, 0x81000F71,
+  0x84000F74, 0x00000FB2, 0x82000F80, 0x00000FB2, 0x81000F71, 0x82000F80, 0x00000FB3, 0x82000F80,
+  0x00000FB3, 0x81000F71, 0x82000F80, 0x81000F71, 0x82000F80, 0x00000F92, 0x00000FB7, 0x00000F9C,
+  0x00000FB7, 0x00000FA1, 0x00000FB7, 0x00000FA6, 0x00000FB7, 0x00000FAB, 0x00000FB7, 0x00000F90,
+  0x00000FB5, 0x00001025, 0x0000102E, 0x000010DC, 0x00001B05, 0x00001B35, 0x00001B07, 0x00001B35,
+  0x00001B09, 0x00001B35, 0x00001B0B, 0x00001B35, 0x00001B0D, 0x00001B35, 0x00001B11, 0x00001B35,
+  0x00001B3A, 0x00001B35, 0x00001B3C, 0x00001B35, 0x00001B3E, 0x00001B35, 0x00001B3F, 0x00001B35,
+  0x00001B42, 0x00001B35, 0x00000041, 0x000000C6, 0x00000042, 0x00000044, 0x00000045, 0x0000018E,
+  0x00000047, 0x00000048, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E,
+  0x0000004F, 0x00000222, 0x00000050, 0x00000052, 0x00000054, 0x00000055, 0x00000057, 0x00000061,
+  0x00000250, 0x00000251, 0x00001D02, 0x00000062, 0x00000064, 0x00000065, 0x00000259, 0x0000025B,
+  0x0000025C, 0x00000067, 0x0000006B, 0x0000006D, 0x0000014B, 0x0000006F, 0x00000254, 0x00001D16,
+  0x00001D17, 0x00000070, 0x00000074, 0x00000075, 0x00001D1D, 0x0000026F, 0x00000076, 0x00001D25,
+  0x000003B2, 0x000003B3, 0x000003B4, 0x000003C6, 0x000003C7, 0x00000069, 0x00000072, 0x00000075,
+  0x00000076, 0x000003B2, 0x000003B3, 0x000003C1, 0x000003C6, 0x000003C7, 0x0000043D, 0x00000252,
+  0x00000063, 0x00000255, 0x000000F0, 0x0000025C, 0x00000066, 0x0000025F, 0x00000261, 0x00000265,
+  0x00000268, 0x00000269, 0x0000026A, 0x00001D7B, 0x0000029D, 0x0000026D, 0x00001D85, 0x0000029F,
+  0x00000271, 0x00000270, 0x00000272, 0x00000273, 0x00000274, 0x00000275, 0x00000278, 0x00000282,
+  0x00000283, 0x000001AB, 0x00000289, 0x0000028A, 0x00001D1C, 0x0000028B, 0x0000028C, 0x0000007A,
+  0x00000290, 0x00000291, 0x00000292, 0x000003B8, 0x00000041, 0xDC000325, 0x00000061, 0xDC000325,
+  0x00000042, 0xE6000307, 0x00000062, 0xE6000307, 0x00000042, 0xDC000323, 0x00000062, 0xDC000323,
+  0x00000042, 0xDC000331, 0x00000062, 0xDC000331, 0x00000043, 0xCA000327, 0xE6000301, 0x00000063,
+  0xCA000327, 0xE6000301, 0x00000044, 0xE6000307, 0x00000064, 0xE6000307, 0x00000044, 0xDC000323,
+  0x00000064, 0xDC000323, 0x00000044, 0xDC000331, 0x00000064, 0xDC000331, 0x00000044, 0xCA000327,
+  0x00000064, 0xCA000327, 0x00000044, 0xDC00032D, 0x00000064, 0xDC00032D, 0x00000045, 0xE6000304,
+  0xE6000300, 0x00000065, 0xE6000304, 0xE6000300, 0x00000045, 0xE6000304, 0xE6000301, 0x00000065,
+  0xE6000304, 0xE6000301, 0x00000045, 0xDC00032D, 0x00000065, 0xDC00032D, 0x00000045, 0xDC000330,
+  0x00000065, 0xDC000330, 0x00000045, 0xCA000327, 0xE6000306, 0x00000065, 0xCA000327, 0xE6000306,
+  0x00000046, 0xE6000307, 0x00000066, 0xE6000307, 0x00000047, 0xE6000304, 0x00000067, 0xE6000304,
+  0x00000048, 0xE6000307, 0x00000068, 0xE6000307, 0x00000048, 0xDC000323, 0x00000068, 0xDC000323,
+  0x00000048, 0xE6000308, 0x00000068, 0xE6000308, 0x00000048, 0xCA000327, 0x00000068, 0xCA000327,
+  0x00000048, 0xDC00032E, 0x00000068, 0xDC00032E, 0x00000049, 0xDC000330, 0x00000069, 0xDC000330,
+  0x00000049, 0xE6000308, 0xE6000301, 0x00000069, 0xE6000308, 0xE6000301, 0x0000004B, 0xE6000301,
+  0x0000006B, 0xE6000301, 0x0000004B, 0xDC000323, 0x0000006B, 0xDC000323, 0x0000004B, 0xDC000331,
+  0x0000006B, 0xDC000331, 0x0000004C, 0xDC000323, 0x0000006C, 0xDC000323, 0x0000004C, 0xDC000323,
+  0xE6000304, 0x0000006C, 0xDC000323, 0xE6000304, 0x0000004C, 0xDC000331, 0x0000006C, 0xDC000331,
+  0x0000004C, 0xDC00032D, 0x0000006C, 0xDC00032D, 0x0000004D, 0xE6000301, 0x0000006D, 0xE6000301,
+  0x0000004D, 0xE6000307, 0x0000006D, 0xE6000307, 0x0000004D, 0xDC000323, 0x0000006D, 0xDC000323,
+  0x0000004E, 0xE6000307, 0x0000006E, 0xE6000307, 0x0000004E, 0xDC000323, 0x0000006E, 0xDC000323,
+  0x0000004E, 0xDC000331, 0x0000006E, 0xDC000331, 0x0000004E, 0xDC00032D, 0x0000006E, 0xDC00032D,
+  0x0000004F, 0xE6000303, 0xE6000301, 0x0000006F, 0xE6000303, 0xE6000301, 0x0000004F, 0xE6000303,
+  0xE6000308, 0x0000006F, 0xE6000303, 0xE6000308, 0x0000004F, 0xE6000304, 0xE6000300, 0x0000006F,
+  0xE6000304, 0xE6000300, 0x0000004F, 0xE6000304, 0xE6000301, 0x0000006F, 0xE6000304, 0xE6000301,
+  0x00000050, 0xE6000301, 0x00000070, 0xE6000301, 0x00000050, 0xE6000307, 0x00000070, 0xE6000307,
+  0x00000052, 0xE6000307, 0x00000072, 0xE6000307, 0x00000052, 0xDC000323, 0x00000072, 0xDC000323,
+  0x00000052, 0xDC000323, 0xE6000304, 0x00000072, 0xDC000323, 0xE6000304, 0x00000052, 0xDC000331,
+  0x00000072, 0xDC000331, 0x00000053, 0xE6000307, 0x00000073, 0xE6000307, 0x00000053, 0xDC000323,
+  0x00000073, 0xDC000323, 0x00000053, 0xE6000301, 0xE6000307, 0x00000073, 0xE6000301, 0xE6000307,
+  0x00000053, 0xE600030C, 0xE6000307, 0x00000073, 0xE600030C, 0xE6000307, 0x00000053, 0xDC000323,
+  0xE6000307, 0x00000073, 0xDC000323, 0xE6000307, 0x00000054, 0xE6000307, 0x00000074, 0xE6000307,
+  0x00000054, 0xDC000323, 0x00000074, 0xDC000323, 0x00000054, 0xDC000331, 0x00000074, 0xDC000331,
+  0x00000054, 0xDC00032D, 0x00000074, 0xDC00032D, 0x00000055, 0xDC000324, 0x00000075, 0xDC000324,
+  0x00000055, 0xDC000330, 0x00000075, 0xDC000330, 0x00000055, 0xDC00032D, 0x00000075, 0xDC00032D,
+  0x00000055, 0xE6000303, 0xE6000301, 0x00000075, 0xE6000303, 0xE6000301, 0x00000055, 0xE6000304,
+  0xE6000308, 0x00000075, 0xE6000304, 0xE6000308, 0x00000056, 0xE6000303, 0x00000076, 0xE6000303,
+  0x00000056, 0xDC000323, 0x00000076, 0xDC000323, 0x00000057, 0xE6000300, 0x00000077, 0xE6000300,
+  0x00000057, 0xE6000301, 0x00000077, 0xE6000301, 0x00000057, 0xE6000308, 0x00000077, 0xE6000308,
+  0x00000057, 0xE6000307, 0x00000077, 0xE6000307, 0x00000057, 0xDC000323, 0x00000077, 0xDC000323,
+  0x00000058, 0xE6000307, 0x00000078, 0xE6000307, 0x00000058, 0xE6000308, 0x00000078, 0xE6000308,
+  0x00000059, 0xE6000307, 0x00000079, 0xE6000307, 0x0000005A, 0xE6000302, 0x0000007A, 0xE6000302,
+  0x0000005A, 0xDC000323, 0x0000007A, 0xDC000323, 0x0000005A, 0xDC000331, 0x0000007A, 0xDC000331,
+  0x00000068, 0xDC000331, 0x00000074, 0xE6000308, 0x00000077, 0xE600030A, 0x00000079, 0xE600030A,
+  0x00000061, 0x000002BE, 0x0000017F, 0xE6000307, 0x00000073, 0xE6000307, 0x00000041, 0xDC000323,
+  0x00000061, 0xDC000323, 0x00000041, 0xE6000309, 0x00000061, 0xE6000309, 0x00000041, 0xE6000302,
+  0xE6000301, 0x00000061, 0xE6000302, 0xE6000301, 0x00000041, 0xE6000302, 0xE6000300, 0x00000061,
+  0xE6000302, 0xE6000300, 0x00000041, 0xE6000302, 0xE6000309, 0x00000061, 0xE6000302, 0xE6000309,
+  0x00000041, 0xE6000302, 0xE6000303, 0x00000061, 0xE6000302, 0xE6000303, 0x00000041, 0xDC000323,
+  0xE6000302, 0x00000061, 0xDC000323, 0xE6000302, 0x00000041, 0xE6000306, 0xE6000301, 0x00000061,
+  0xE6000306, 0xE6000301, 0x00000041, 0xE6000306, 0xE6000300, 0x00000061, 0xE6000306, 0xE6000300,
+  0x00000041, 0xE6000306, 0xE6000309, 0x00000061, 0xE6000306, 0xE6000309, 0x00000041, 0xE6000306,
+  0xE6000303, 0x00000061, 0xE6000306, 0xE6000303, 0x00000041, 0xDC000323, 0xE6000306, 0x00000061,
+  0xDC000323, 0xE6000306, 0x00000045, 0xDC000323, 0x00000065, 0xDC000323, 0x00000045, 0xE6000309,
+  0x00000065, 0xE6000309, 0x00000045, 0xE6000303, 0x00000065, 0xE6000303, 0x00000045, 0xE6000302,
+  0xE6000301, 0x00000065, 0xE6000302, 0xE6000301, 0x00000045, 0xE6000302, 0xE6000300, 0x00000065,
+  0xE6000302, 0xE6000300, 0x00000045, 0xE6000302, 0xE6000309, 0x00000065, 0xE6000302, 0xE6000309,
+  0x00000045, 0xE6000302, 0xE6000303, 0x00000065, 0xE6000302, 0xE6000303, 0x00000045, 0xDC000323,
+  0xE6000302, 0x00000065, 0xDC000323, 0xE6000302, 0x00000049, 0xE6000309, 0x00000069, 0xE6000309,
+  0x00000049, 0xDC000323, 0x00000069, 0xDC000323, 0x0000004F, 0xDC000323, 0x0000006F, 0xDC000323,
+  0x0000004F, 0xE6000309, 0x0000006F, 0xE6000309, 0x0000004F, 0xE6000302, 0xE6000301, 0x0000006F,
+  0xE6000302, 0xE6000301, 0x0000004F, 0xE6000302, 0xE6000300, 0x0000006F, 0xE6000302, 0xE6000300,
+  0x0000004F, 0xE6000302, 0xE6000309, 0x0000006F, 0xE6000302, 0xE6000309, 0x0000004F, 0xE6000302,
+  0xE6000303, 0x0000006F, 0xE6000302, 0xE6000303, 0x0000004F, 0xDC000323, 0xE6000302, 0x0000006F,
+  0xDC000323, 0xE6000302, 0x0000004F, 0xD800031B, 0xE6000301, 0x0000006F, 0xD800031B, 0xE6000301,
+  0x0000004F, 0xD800031B, 0xE6000300, 0x0000006F, 0xD800031B, 0xE6000300, 0x0000004F, 0xD800031B,
+  0xE6000309, 0x0000006F, 0xD800031B, 0xE6000309, 0x0000004F, 0xD800031B, 0xE6000303, 0x0000006F,
+  0xD800031B, 0xE6000303, 0x0000004F, 0xD800031B, 0xDC000323, 0x0000006F, 0xD800031B, 0xDC000323,
+  0x00000055, 0xDC000323, 0x00000075, 0xDC000323, 0x00000055, 0xE6000309, 0x00000075, 0xE6000309,
+  0x00000055, 0xD800031B, 0xE6000301, 0x00000075, 0xD800031B, 0xE6000301, 0x00000055, 0xD800031B,
+  0xE6000300, 0x00000075, 0xD800031B, 0xE6000300, 0x00000055, 0xD800031B, 0xE6000309, 0x00000075,
+  0xD800031B, 0xE6000309, 0x00000055, 0xD800031B, 0xE6000303, 0x00000075, 0xD800031B, 0xE6000303,
+  0x00000055, 0xD800031B, 0xDC000323, 0x00000075, 0xD800031B, 0xDC000323, 0x00000059, 0xE6000300,
+  0x00000079, 0xE6000300, 0x00000059, 0xDC000323, 0x00000079, 0xDC000323, 0x00000059, 0xE6000309,
+  0x00000079, 0xE6000309, 0x00000059, 0xE6000303, 0x00000079, 0xE6000303, 0x000003B1, 0xE6000313,
+  0x000003B1, 0xE6000314, 0x000003B1, 0xE6000313, 0xE6000300, 0x000003B1, 0xE6000314, 0xE6000300,
+  0x000003B1, 0xE6000313, 0xE6000301, 0x000003B1, 0xE6000314, 0xE6000301, 0x000003B1, 0xE6000313,
+  0xE6000342, 0x000003B1, 0xE6000314, 0xE6000342, 0x00000391, 0xE6000313, 0x00000391, 0xE6000314,
+  0x00000391, 0xE6000313, 0xE6000300, 0x00000391, 0xE6000314, 0xE6000300, 0x00000391, 0xE6000313,
+  0xE6000301, 0x00000391, 0xE6000314, 0xE6000301, 0x00000391, 0xE6000313, 0xE6000342, 0x00000391,
+  0xE6000314, 0xE6000342, 0x000003B5, 0xE6000313, 0x000003B5, 0xE6000314, 0x000003B5, 0xE6000313,
+  0xE6000300, 0x000003B5, 0xE6000314, 0xE6000300, 0x000003B5, 0xE6000313, 0xE6000301, 0x000003B5,
+  0xE6000314, 0xE6000301, 0x00000395, 0xE6000313, 0x00000395, 0xE6000314, 0x00000395, 0xE6000313,
+  0xE6000300, 0x00000395, 0xE6000314, 0xE6000300, 0x00000395, 0xE6000313, 0xE6000301, 0x00000395,
+  0xE6000314, 0xE6000301, 0x000003B7, 0xE6000313, 0x000003B7, 0xE6000314, 0x000003B7, 0xE6000313,
+  0xE6000300, 0x000003B7, 0xE6000314, 0xE6000300, 0x000003B7, 0xE6000313, 0xE6000301, 0x000003B7,
+  0xE6000314, 0xE6000301, 0x000003B7, 0xE6000313, 0xE6000342, 0x000003B7, 0xE6000314, 0xE6000342,
+  0x00000397, 0xE6000313, 0x00000397, 0xE6000314, 0x00000397, 0xE6000313, 0xE6000300, 0x00000397,
+  0xE6000314, 0xE6000300, 0x00000397, 0xE6000313, 0xE6000301, 0x00000397, 0xE6000314, 0xE6000301,
+  0x00000397, 0xE6000313, 0xE6000342, 0x00000397, 0xE6000314, 0xE6000342, 0x000003B9, 0xE6000313,
+  0x000003B9, 0xE6000314, 0x000003B9, 0xE6000313, 0xE6000300, 0x000003B9, 0xE6000314, 0xE6000300,
+  0x000003B9, 0xE6000313, 0xE6000301, 0x000003B9, 0xE6000314, 0xE6000301, 0x000003B9, 0xE6000313,
+  0xE6000342, 0x000003B9, 0xE6000314, 0xE6000342, 0x00000399, 0xE6000313, 0x00000399, 0xE6000314,
+  0x00000399, 0xE6000313, 0xE6000300, 0x00000399, 0xE6000314, 0xE6000300, 0x00000399, 0xE6000313,
+  0xE6000301, 0x00000399, 0xE6000314, 0xE6000301, 0x00000399, 0xE6000313, 0xE6000342, 0x00000399,
+  0xE6000314, 0xE6000342, 0x000003BF, 0xE6000313, 0x000003BF, 0xE6000314, 0x000003BF, 0xE6000313,
+  0xE6000300, 0x000003BF, 0xE6000314, 0xE6000300, 0x000003BF, 0xE6000313, 0xE6000301, 0x000003BF,
+  0xE6000314, 0xE6000301, 0x0000039F, 0xE6000313, 0x0000039F, 0xE6000314, 0x0000039F, 0xE6000313,
+  0xE6000300, 0x0000039F, 0xE6000314, 0xE6000300, 0x0000039F, 0xE6000313, 0xE6000301, 0x0000039F,
+  0xE6000314, 0xE6000301, 0x000003C5, 0xE6000313, 0x000003C5, 0xE6000314, 0x000003C5, 0xE6000313,
+  0xE6000300, 0x000003C5, 0xE6000314, 0xE6000300, 0x000003C5, 0xE6000313, 0xE6000301, 0x000003C5,
+  0xE6000314, 0xE6000301, 0x000003C5, 0xE6000313, 0xE6000342, 0x000003C5, 0xE6000314, 0xE6000342,
+  0x000003A5, 0xE6000314, 0x000003A5, 0xE6000314, 0xE6000300, 0x000003A5, 0xE6000314, 0xE6000301,
+  0x000003A5, 0xE6000314, 0xE6000342, 0x000003C9, 0xE6000313, 0x000003C9, 0xE6000314, 0x000003C9,
+  0xE6000313, 0xE6000300, 0x000003C9, 0xE6000314, 0xE6000300, 0x000003C9, 0xE6000313, 0xE6000301,
+  0x000003C9, 0xE6000314, 0xE6000301, 0x000003C9, 0xE6000313, 0xE6000342, 0x000003C9, 0xE6000314,
+  0xE6000342, 0x000003A9, 0xE6000313, 0x000003A9, 0xE6000314, 0x000003A9, 0xE6000313, 0xE6000300,
+  0x000003A9, 0xE6000314, 0xE6000300, 0x000003A9, 0xE6000313, 0xE6000301, 0x000003A9, 0xE6000314,
+  0xE6000301, 0x000003A9, 0xE6000313, 0xE6000342, 0x000003A9, 0xE6000314, 0xE6000342, 0x000003B1,
+  0xE6000300, 0x000003B1, 0xE6000301, 0x000003B5, 0xE6000300, 0x000003B5, 0xE6000301, 0x000003B7,
+  0xE6000300, 0x000003B7, 0xE6000301, 0x000003B9, 0xE6000300, 0x000003B9, 0xE6000301, 0x000003BF,
+  0xE6000300, 0x000003BF, 0xE6000301, 0x000003C5, 0xE6000300, 0x000003C5, 0xE6000301, 0x000003C9,
+  0xE6000300, 0x000003C9, 0xE6000301, 0x000003B1, 0xE6000313, 0xF0000345, 0x000003B1, 0xE6000314,
+  0xF0000345, 0x000003B1, 0xE6000313, 0xE6000300, 0xF0000345, 0x000003B1, 0xE6000314, 0xE6000300,
+  0xF0000345, 0x000003B1, 0xE6000313, 0xE6000301, 0xF0000345, 0x000003B1, 0xE6000314, 0xE6000301,
+  0xF0000345, 0x000003B1, 0xE6000313, 0xE6000342, 0xF0000345, 0x000003B1, 0xE6000314, 0xE6000342,
+  0xF0000345, 0x00000391, 0xE6000313, 0xF0000345, 0x00000391, 0xE6000314, 0xF0000345, 0x00000391,
+  0xE6000313, 0xE6000300, 0xF0000345, 0x00000391, 0xE6000314, 0xE6000300, 0xF0000345, 0x00000391,
+  0xE6000313, 0xE6000301, 0xF0000345, 0x00000391, 0xE6000314, 0xE6000301, 0xF0000345, 0x00000391,
+  0xE6000313, 0xE6000342, 0xF0000345, 0x00000391, 0xE6000314, 0xE6000342, 0xF0000345, 0x000003B7,
+  0xE6000313, 0xF0000345, 0x000003B7, 0xE6000314, 0xF0000345, 0x000003B7, 0xE6000313, 0xE6000300,
+  0xF0000345, 0x000003B7, 0xE6000314, 0xE6000300, 0xF0000345, 0x000003B7, 0xE6000313, 0xE6000301,
+  0xF0000345, 0x000003B7, 0xE6000314, 0xE6000301, 0xF0000345, 0x000003B7, 0xE6000313, 0xE6000342,
+  0xF0000345, 0x000003B7, 0xE6000314, 0xE6000342, 0xF0000345, 0x00000397, 0xE6000313, 0xF0000345,
+  0x00000397, 0xE6000314, 0xF0000345, 0x00000397, 0xE6000313, 0xE6000300, 0xF0000345, 0x00000397,
+  0xE6000314, 0xE6000300, 0xF0000345, 0x00000397, 0xE6000313, 0xE6000301, 0xF0000345, 0x00000397,
+  0xE6000314, 0xE6000301, 0xF0000345, 0x00000397, 0xE6000313, 0xE6000342, 0xF0000345, 0x00000397,
+  0xE6000314, 0xE6000342, 0xF0000345, 0x000003C9, 0xE6000313, 0xF0000345, 0x000003C9, 0xE6000314,
+  0xF0000345, 0x000003C9, 0xE6000313, 0xE6000300, 0xF0000345, 0x000003C9, 0xE6000314, 0xE6000300,
+  0xF0000345, 0x000003C9, 0xE6000313, 0xE6000301, 0xF0000345, 0x000003C9, 0xE6000314, 0xE6000301,
+  0xF0000345, 0x000003C9, 0xE6000313, 0xE6000342, 0xF0000345, 0x000003C9, 0xE6000314, 0xE6000342,
+  0xF0000345, 0x000003A9, 0xE6000313, 0xF0000345, 0x000003A9, 0xE6000314, 0xF0000345, 0x000003A9,
+  0xE6000313, 0xE6000300, 0xF0000345, 0x000003A9, 0xE6000314, 0xE6000300, 0xF0000345, 0x000003A9,
+  0xE6000313, 0xE6000301, 0xF0000345, 0x000003A9, 0xE6000314, 0xE6000301, 0xF0000345, 0x000003A9,
+  0xE6000313, 0xE6000342, 0xF0000345, 0x000003A9, 0xE6000314, 0xE6000342, 0xF0000345, 0x000003B1,
+  0xE6000306, 0x000003B1, 0xE6000304, 0x000003B1, 0xE6000300, 0xF0000345, 0x000003B1, 0xF0000345,
+  0x000003B1, 0xE6000301, 0xF0000345, 0x000003B1, 0xE6000342, 0x000003B1, 0xE6000342, 0xF0000345,
+  0x00000391, 0xE6000306, 0x00000391, 0xE6000304, 0x00000391, 0xE6000300, 0x00000391, 0xE6000301,
+  0x00000391, 0xF0000345, 0x00000020, 0xE6000313, 0x000003B9, 0x00000020, 0xE6000313, 0x00000020,
+  0xE6000342, 0x000000A8, 0xE6000342, 0x00000020, 0xE6000308, 0xE6000342, 0x000003B7, 0xE6000300,
+  0xF0000345, 0x000003B7, 0xF0000345, 0x000003B7, 0xE6000301, 0xF0000345, 0x000003B7, 0xE6000342,
+  0x000003B7, 0xE6000342, 0xF0000345, 0x00000395, 0xE6000300, 0x00000395, 0xE6000301, 0x00000397,
+  0xE6000300, 0x00000397, 0xE6000301, 0x00000397, 0xF0000345, 0x00001FBF, 0xE6000300, 0x00000020,
+  0xE6000313, 0xE6000300, 0x00001FBF, 0xE6000301, 0x00000020, 0xE6000313, 0xE6000301, 0x00001FBF,
+  0xE6000342, 0x00000020, 0xE6000313, 0xE6000342, 0x000003B9, 0xE6000306, 0x000003B9, 0xE6000304,
+  0x000003B9, 0xE6000308, 0xE6000300, 0x000003B9, 0xE6000308, 0xE6000301, 0x000003B9, 0xE6000342,
+  0x000003B9, 0xE6000308, 0xE6000342, 0x00000399, 0xE6000306, 0x00000399, 0xE6000304, 0x00000399,
+  0xE6000300, 0x00000399, 0xE6000301, 0x00001FFE, 0xE6000300, 0x00000020, 0xE6000314, 0xE6000300,
+  0x00001FFE, 0xE6000301, 0x00000020, 0xE6000314, 0xE6000301, 0x00001FFE, 0xE6000342, 0x00000020,
+  0xE6000314, 0xE6000342, 0x000003C5, 0xE6000306, 0x000003C5, 0xE6000304, 0x000003C5, 0xE6000308,
+  0xE6000300, 0x000003C5, 0xE6000308, 0xE6000301, 0x000003C1, 0xE6000313, 0x000003C1, 0xE6000314,
+  0x000003C5, 0xE6000342, 0x000003C5, 0xE6000308, 0xE6000342, 0x000003A5, 0xE6000306, 0x000003A5,
+  0xE6000304, 0x000003A5, 0xE6000300, 0x000003A5, 0xE6000301, 0x000003A1, 0xE6000314, 0x000000A8,
+  0xE6000300, 0x00000020, 0xE6000308, 0xE6000300, 0x000000A8, 0xE6000301, 0x00000020, 0xE6000308,
+  0xE6000301, 0x00000060, 0x000003C9, 0xE6000300, 0xF0000345, 0x000003C9, 0xF0000345, 0x000003C9,
+  0xE6000301, 0xF0000345, 0x000003C9, 0xE6000342, 0x000003C9, 0xE6000342, 0xF0000345, 0x0000039F,
+  0xE6000300, 0x0000039F, 0xE6000301, 0x000003A9, 0xE6000300, 0x000003A9, 0xE6000301, 0x000003A9,
+  0xF0000345, 0x000000B4, 0x00000020, 0xE6000301, 0x00000020, 0xE6000314, 0x00002002, 0x00000020,
+  0x00002003, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020, 0x00000020,
+  0x00000020, 0x00000020, 0x00000020, 0x00002010, 0x00000020, 0xDC000333, 0x0000002E, 0x0000002E,
+  0x0000002E, 0x0000002E, 0x0000002E, 0x0000002E, 0x00000020, 0x00002032, 0x00002032, 0x00002032,
+  0x00002032, 0x00002032, 0x00002035, 0x00002035, 0x00002035, 0x00002035, 0x00002035, 0x00000021,
+  0x00000021, 0x00000020, 0xE6000305, 0x0000003F, 0x0000003F, 0x0000003F, 0x00000021, 0x00000021,
+  0x0000003F, 0x00002032, 0x00002032, 0x00002032, 0x00002032, 0x00000020, 0x00000030, 0x00000069,
+  0x00000034, 0x00000035, 0x00000036, 0x00000037, 0x00000038, 0x00000039, 0x0000002B, 0x00002212,
+  0x0000003D, 0x00000028, 0x00000029, 0x0000006E, 0x00000030, 0x00000031, 0x00000032, 0x00000033,
+  0x00000034, 0x00000035, 0x00000036, 0x00000037, 0x00000038, 0x00000039, 0x0000002B, 0x00002212,
+  0x0000003D, 0x00000028, 0x00000029, 0x00000061, 0x00000065, 0x0000006F, 0x00000078, 0x00000259,
+  0x00000068, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x00000070, 0x00000073, 0x00000074,
+  0x00000052, 0x00000073, 0x00000061, 0x0000002F, 0x00000063, 0x00000061, 0x0000002F, 0x00000073,
+  0x00000043, 0x000000B0, 0x00000043, 0x00000063, 0x0000002F, 0x0000006F, 0x00000063, 0x0000002F,
+  0x00000075, 0x00000190, 0x000000B0, 0x00000046, 0x00000067, 0x00000048, 0x00000048, 0x00000048,
+  0x00000068, 0x00000127, 0x00000049, 0x00000049, 0x0000004C, 0x0000006C, 0x0000004E, 0x0000004E,
+  0x0000006F, 0x00000050, 0x00000051, 0x00000052, 0x00000052, 0x00000052, 0x00000053, 0x0000004D,
+  0x00000054, 0x00000045, 0x0000004C, 0x00000054, 0x0000004D, 0x0000005A, 0x000003A9, 0x0000005A,
+  0x0000004B, 0x00000041, 0xE600030A, 0x00000042, 0x00000043, 0x00000065, 0x00000045, 0x00000046,
+  0x0000004D, 0x0000006F, 0x000005D0, 0x000005D1, 0x000005D2, 0x000005D3, 0x00000069, 0x00000046,
+  0x00000041, 0x00000058, 0x000003C0, 0x000003B3, 0x00000393, 0x000003A0, 0x00002211, 0x00000044,
+  0x00000064, 0x00000065, 0x00000069, 0x0000006A, 0x00000031, 0x00002044, 0x00000037, 0x00000031,
+  0x00002044, 0x00000039, 0x00000031, 0x00002044, 0x00000031, 0x00000030, 0x00000031, 0x00002044,
+  0x00000033, 0x00000032, 0x00002044, 0x00000033, 0x00000031, 0x00002044, 0x00000035, 0x00000032,
+  0x00002044, 0x00000035, 0x00000033, 0x00002044, 0x00000035, 0x00000034, 0x00002044, 0x00000035,
+  0x00000031, 0x00002044, 0x00000036, 0x00000035, 0x00002044, 0x00000036, 0x00000031, 0x00002044,
+  0x00000038, 0x00000033, 0x00002044, 0x00000038, 0x00000035, 0x00002044, 0x00000038, 0x00000037,
+  0x00002044, 0x00000038, 0x00000031, 0x00002044, 0x00000049, 0x00000049, 0x00000049, 0x00000049,
+  0x00000049, 0x00000049, 0x00000049, 0x00000056, 0x00000056, 0x00000056, 0x00000049, 0x00000056,
+  0x00000049, 0x00000049, 0x00000056, 0x00000049, 0x00000049, 0x00000049, 0x00000049, 0x00000058,
+  0x00000058, 0x00000058, 0x00000049, 0x00000058, 0x00000049, 0x00000049, 0x0000004C, 0x00000043,
+  0x00000044, 0x0000004D, 0x00000069, 0x00000069, 0x00000069, 0x00000069, 0x00000069, 0x00000069,
+  0x00000069, 0x00000076, 0x00000076, 0x00000076, 0x00000069, 0x00000076, 0x00000069, 0x00000069,
+  0x00000076, 0x00000069, 0x00000069, 0x00000069, 0x00000069, 0x00000078, 0x00000078, 0x00000078,
+  0x00000069, 0x00000078, 0x00000069, 0x00000069, 0x0000006C, 0x00000063, 0x00000064, 0x0000006D,
+  0x00000030, 0x00002044, 0x00000033, 0x00002190, 0x01000338, 0x00002192, 0x01000338, 0x00002194,
+  0x01000338, 0x000021D0, 0x01000338, 0x000021D4, 0x01000338, 0x000021D2, 0x01000338, 0x00002203,
+  0x01000338, 0x00002208, 0x01000338, 0x0000220B, 0x01000338, 0x00002223, 0x01000338, 0x00002225,
+  0x01000338, 0x0000222B, 0x0000222B, 0x0000222B, 0x0000222B, 0x0000222B, 0x0000222E, 0x0000222E,
+  0x0000222E, 0x0000222E, 0x0000222E, 0x0000223C, 0x01000338, 0x00002243, 0x01000338, 0x00002245,
+  0x01000338, 0x00002248, 0x01000338, 0x0000003D, 0x01000338, 0x00002261, 0x01000338, 0x0000224D,
+  0x01000338, 0x0000003C, 0x01000338, 0x0000003E, 0x01000338, 0x00002264, 0x01000338, 0x00002265,
+  0x01000338, 0x00002272, 0x01000338, 0x00002273, 0x01000338, 0x00002276, 0x01000338, 0x00002277,
+  0x01000338, 0x0000227A, 0x01000338, 0x0000227B, 0x01000338, 0x00002282, 0x01000338, 0x00002283,
+  0x01000338, 0x00002286, 0x01000338, 0x00002287, 0x01000338, 0x000022A2, 0x01000338, 0x000022A8,
+  0x01000338, 0x000022A9, 0x01000338, 0x000022AB, 0x01000338, 0x0000227C, 0x01000338, 0x0000227D,
+  0x01000338, 0x00002291, 0x01000338, 0x00002292, 0x01000338, 0x000022B2, 0x01000338, 0x000022B3,
+  0x01000338, 0x000022B4, 0x01000338, 0x000022B5, 0x01000338, 0x00003008, 0x00003009, 0x00000031,
+  0x00000032, 0x00000033, 0x00000034, 0x00000035, 0x00000036, 0x00000037, 0x00000038, 0x00000039,
+  0x00000031, 0x00000030, 0x00000031, 0x00000031, 0x00000031, 0x00000032, 0x00000031, 0x00000033,
+  0x00000031, 0x00000034, 0x00000031, 0x00000035, 0x00000031, 0x00000036, 0x00000031, 0x00000037,
+  0x00000031, 0x00000038, 0x00000031, 0x00000039, 0x00000032, 0x00000030, 0x00000028, 0x00000031,
+  0x00000029, 0x00000028, 0x00000032, 0x00000029, 0x00000028, 0x00000033, 0x00000029, 0x00000028,
+  0x00000034, 0x00000029, 0x00000028, 0x00000035, 0x00000029, 0x00000028, 0x00000036, 0x00000029,
+  0x00000028, 0x00000037, 0x00000029, 0x00000028, 0x00000038, 0x00000029, 0x00000028, 0x00000039,
+  0x00000029, 0x00000028, 0x00000031, 0x00000030, 0x00000029, 0x00000028, 0x00000031, 0x00000031,
+  0x00000029, 0x00000028, 0x00000031, 0x00000032, 0x00000029, 0x00000028, 0x00000031, 0x00000033,
+  0x00000029, 0x00000028, 0x00000031, 0x00000034, 0x00000029, 0x00000028, 0x00000031, 0x00000035,
+  0x00000029, 0x00000028, 0x00000031, 0x00000036, 0x00000029, 0x00000028, 0x00000031, 0x00000037,
+  0x00000029, 0x00000028, 0x00000031, 0x00000038, 0x00000029, 0x00000028, 0x00000031, 0x00000039,
+  0x00000029, 0x00000028, 0x00000032, 0x00000030, 0x00000029, 0x00000031, 0x0000002E, 0x00000032,
+  0x0000002E, 0x00000033, 0x0000002E, 0x00000034, 0x0000002E, 0x00000035, 0x0000002E, 0x00000036,
+  0x0000002E, 0x00000037, 0x0000002E, 0x00000038, 0x0000002E, 0x00000039, 0x0000002E, 0x00000031,
+  0x00000030, 0x0000002E, 0x00000031, 0x00000031, 0x0000002E, 0x00000031, 0x00000032, 0x0000002E,
+  0x00000031, 0x00000033, 0x0000002E, 0x00000031, 0x00000034, 0x0000002E, 0x00000031, 0x00000035,
+  0x0000002E, 0x00000031, 0x00000036, 0x0000002E, 0x00000031, 0x00000037, 0x0000002E, 0x00000031,
+  0x00000038, 0x0000002E, 0x00000031, 0x00000039, 0x0000002E, 0x00000032, 0x00000030, 0x0000002E,
+  0x00000028, 0x00000061, 0x00000029, 0x00000028, 0x00000062, 0x00000029, 0x00000028, 0x00000063,
+  0x00000029, 0x00000028, 0x00000064, 0x00000029, 0x00000028, 0x00000065, 0x00000029, 0x00000028,
+  0x00000066, 0x00000029, 0x00000028, 0x00000067, 0x00000029, 0x00000028, 0x00000068, 0x00000029,
+  0x00000028, 0x00000069, 0x00000029, 0x00000028, 0x0000006A, 0x00000029, 0x00000028, 0x0000006B,
+  0x00000029, 0x00000028, 0x0000006C, 0x00000029, 0x00000028, 0x0000006D, 0x00000029, 0x00000028,
+  0x0000006E, 0x00000029, 0x00000028, 0x0000006F, 0x00000029, 0x00000028, 0x00000070, 0x00000029,
+  0x00000028, 0x00000071, 0x00000029, 0x00000028, 0x00000072, 0x00000029, 0x00000028, 0x00000073,
+  0x00000029, 0x00000028, 0x00000074, 0x00000029, 0x00000028, 0x00000075, 0x00000029, 0x00000028,
+  0x00000076, 0x00000029, 0x00000028, 0x00000077, 0x00000029, 0x00000028, 0x00000078, 0x00000029,
+  0x00000028, 0x00000079, 0x00000029, 0x00000028, 0x0000007A, 0x00000029, 0x00000041, 0x00000042,
+  0x00000043, 0x00000044, 0x00000045, 0x00000046, 0x00000047, 0x00000048, 0x00000049, 0x0000004A,
+  0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F, 0x00000050, 0x00000051, 0x00000052,
+  0x00000053, 0x00000054, 0x00000055, 0x00000056, 0x00000057, 0x00000058, 0x00000059, 0x0000005A,
+  0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00000066, 0x00000067, 0x00000068,
+  0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x0000006F, 0x00000070,
+  0x00000071, 0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00000077, 0x00000078,
+  0x00000079, 0x0000007A, 0x00000030, 0x0000222B, 0x0000222B, 0x0000222B, 0x0000222B, 0x0000003A,
+  0x0000003A, 0x0000003D, 0x0000003D, 0x0000003D, 0x0000003D, 0x0000003D, 0x0000003D, 0x00002ADD,
+  0x01000338, 0x0000006A, 0x00000056, 0x00002D61, 0x00006BCD, 0x00009F9F, 0x00004E00, 0x00004E28,
+  0x00004E36, 0x00004E3F, 0x00004E59, 0x00004E85, 0x00004E8C, 0x00004EA0, 0x00004EBA, 0x0000513F,
+  0x00005165, 0x0000516B, 0x00005182, 0x00005196, 0x000051AB, 0x000051E0, 0x000051F5, 0x00005200,
+  0x0000529B, 0x000052F9, 0x00005315, 0x0000531A, 0x00005338, 0x00005341, 0x0000535C, 0x00005369,
+  0x00005382, 0x000053B6, 0x000053C8, 0x000053E3, 0x000056D7, 0x0000571F, 0x000058EB, 0x00005902,
+  0x0000590A, 0x00005915, 0x00005927, 0x00005973, 0x00005B50, 0x00005B80, 0x00005BF8, 0x00005C0F,
+  0x00005C22, 0x00005C38, 0x00005C6E, 0x00005C71, 0x00005DDB, 0x00005DE5, 0x00005DF1, 0x00005DFE,
+  0x00005E72, 0x00005E7A, 0x00005E7F, 0x00005EF4, 0x00005EFE, 0x00005F0B, 0x00005F13, 0x00005F50,
+  0x00005F61, 0x00005F73, 0x00005FC3, 0x00006208, 0x00006236, 0x0000624B, 0x0000652F, 0x00006534,
+  0x00006587, 0x00006597, 0x000065A4, 0x000065B9, 0x000065E0, 0x000065E5, 0x000066F0, 0x00006708,
+  0x00006728, 0x00006B20, 0x00006B62, 0x00006B79, 0x00006BB3, 0x00006BCB, 0x00006BD4, 0x00006BDB,
+  0x00006C0F, 0x00006C14, 0x00006C34, 0x0000706B, 0x0000722A, 0x00007236, 0x0000723B, 0x0000723F,
+  0x00007247, 0x00007259, 0x0000725B, 0x000072AC, 0x00007384, 0x00007389, 0x000074DC, 0x000074E6,
+  0x00007518, 0x0000751F, 0x00007528, 0x00007530, 0x0000758B, 0x00007592, 0x00007676, 0x0000767D,
+  0x000076AE, 0x000076BF, 0x000076EE, 0x000077DB, 0x000077E2, 0x000077F3, 0x0000793A, 0x000079B8,
+  0x000079BE, 0x00007A74, 0x00007ACB, 0x00007AF9, 0x00007C73, 0x00007CF8, 0x00007F36, 0x00007F51,
+  0x00007F8A, 0x00007FBD, 0x00008001, 0x0000800C, 0x00008012, 0x00008033, 0x0000807F, 0x00008089,
+  0x000081E3, 0x000081EA, 0x000081F3, 0x000081FC, 0x0000820C, 0x0000821B, 0x0000821F, 0x0000826E,
+  0x00008272, 0x00008278, 0x0000864D, 0x0000866B, 0x00008840, 0x0000884C, 0x00008863, 0x0000897E,
+  0x0000898B, 0x000089D2, 0x00008A00, 0x00008C37, 0x00008C46, 0x00008C55, 0x00008C78, 0x00008C9D,
+  0x00008D64, 0x00008D70, 0x00008DB3, 0x00008EAB, 0x00008ECA, 0x00008F9B, 0x00008FB0, 0x00008FB5,
+  0x00009091, 0x00009149, 0x000091C6, 0x000091CC, 0x000091D1, 0x00009577, 0x00009580, 0x0000961C,
+  0x000096B6, 0x000096B9, 0x000096E8, 0x00009751, 0x0000975E, 0x00009762, 0x00009769, 0x000097CB,
+  0x000097ED, 0x000097F3, 0x00009801, 0x000098A8, 0x000098DB, 0x000098DF, 0x00009996, 0x00009999,
+  0x000099AC, 0x00009AA8, 0x00009AD8, 0x00009ADF, 0x00009B25, 0x00009B2F, 0x00009B32, 0x00009B3C,
+  0x00009B5A, 0x00009CE5, 0x00009E75, 0x00009E7F, 0x00009EA5, 0x00009EBB, 0x00009EC3, 0x00009ECD,
+  0x00009ED1, 0x00009EF9, 0x00009EFD, 0x00009F0E, 0x00009F13, 0x00009F20, 0x00009F3B, 0x00009F4A,
+  0x00009F52, 0x00009F8D, 0x00009F9C, 0x00009FA0, 0x00000020, 0x00003012, 0x00005341, 0x00005344,
+  0x00005345, 0x0000304B, 0x08003099, 0x0000304D, 0x08003099, 0x0000304F, 0x08003099, 0x00003051,
+  0x08003099, 0x00003053, 0x08003099, 0x00003055, 0x08003099, 0x00003057, 0x08003099, 0x00003059,
+  0x08003099, 0x0000305B, 0x08003099, 0x0000305D, 0x08003099, 0x0000305F, 0x08003099, 0x00003061,
+  0x08003099, 0x00003064, 0x08003099, 0x00003066, 0x08003099, 0x00003068, 0x08003099, 0x0000306F,
+  0x08003099, 0x0000306F, 0x0800309A, 0x00003072, 0x08003099, 0x00003072, 0x0800309A, 0x00003075,
+  0x08003099, 0x00003075, 0x0800309A, 0x00003078, 0x08003099, 0x00003078, 0x0800309A, 0x0000307B,
+  0x08003099, 0x0000307B, 0x0800309A, 0x00003046, 0x08003099, 0x00000020, 0x08003099, 0x00000020,
+  0x0800309A, 0x0000309D, 0x08003099, 0x00003088, 0x0000308A, 0x000030AB, 0x08003099, 0x000030AD,
+  0x08003099, 0x000030AF, 0x08003099, 0x000030B1, 0x08003099, 0x000030B3, 0x08003099, 0x000030B5,
+  0x08003099, 0x000030B7, 0x08003099, 0x000030B9, 0x08003099, 0x000030BB, 0x08003099, 0x000030BD,
+  0x08003099, 0x000030BF, 0x08003099, 0x000030C1, 0x08003099, 0x000030C4, 0x08003099, 0x000030C6,
+  0x08003099, 0x000030C8, 0x08003099, 0x000030CF, 0x08003099, 0x000030CF, 0x0800309A, 0x000030D2,
+  0x08003099, 0x000030D2, 0x0800309A, 0x000030D5, 0x08003099, 0x000030D5, 0x0800309A, 0x000030D8,
+  0x08003099, 0x000030D8, 0x0800309A, 0x000030DB, 0x08003099, 0x000030DB, 0x0800309A, 0x000030A6,
+  0x08003099, 0x000030EF, 0x08003099, 0x000030F0, 0x08003099, 0x000030F1, 0x08003099, 0x000030F2,
+  0x08003099, 0x000030FD, 0x08003099, 0x000030B3, 0x000030C8, 0x00001100, 0x00001101, 0x000011AA,
+  0x00001102, 0x000011AC, 0x000011AD, 0x00001103, 0x00001104, 0x00001105, 0x000011B0, 0x000011B1,
+  0x000011B2, 0x000011B3, 0x000011B4, 0x000011B5, 0x0000111A, 0x00001106, 0x00001107, 0x00001108,
+  0x00001121, 0x00001109, 0x0000110A, 0x0000110B, 0x0000110C, 0x0000110D, 0x0000110E, 0x0000110F,
+  0x00001110, 0x00001111, 0x00001112, 0x00001161, 0x00001162, 0x00001163, 0x00001164, 0x00001165,
+  0x00001166, 0x00001167, 0x00001168, 0x00001169, 0x0000116A, 0x0000116B, 0x0000116C, 0x0000116D,
+  0x0000116E, 0x0000116F, 0x00001170, 0x00001171, 0x00001172, 0x00001173, 0x00001174, 0x00001175,
+  0x00001160, 0x00001114, 0x00001115, 0x000011C7, 0x000011C8, 0x000011CC, 0x000011CE, 0x000011D3,
+  0x000011D7, 0x000011D9, 0x0000111C, 0x000011DD, 0x000011DF, 0x0000111D, 0x0000111E, 0x00001120,
+  0x00001122, 0x00001123, 0x00001127, 0x00001129, 0x0000112B, 0x0000112C, 0x0000112D, 0x0000112E,
+  0x0000112F, 0x00001132, 0x00001136, 0x00001140, 0x00001147, 0x0000114C, 0x000011F1, 0x000011F2,
+  0x00001157, 0x00001158, 0x00001159, 0x00001184, 0x00001185, 0x00001188, 0x00001191, 0x00001192,
+  0x00001194, 0x0000119E, 0x000011A1, 0x00004E00, 0x00004E8C, 0x00004E09, 0x000056DB, 0x00004E0A,
+  0x00004E2D, 0x00004E0B, 0x00007532, 0x00004E59, 0x00004E19, 0x00004E01, 0x00005929, 0x00005730,
+  0x00004EBA, 0x00000028, 0x00001100, 0x00000029, 0x00000028, 0x00001102, 0x00000029, 0x00000028,
+  0x00001103, 0x00000029, 0x00000028, 0x00001105, 0x00000029, 0x00000028, 0x00001106, 0x00000029,
+  0x00000028, 0x00001107, 0x00000029, 0x00000028, 0x00001109, 0x00000029, 0x00000028, 0x0000110B,
+  0x00000029, 0x00000028, 0x0000110C, 0x00000029, 0x00000028, 0x0000110E, 0x00000029, 0x00000028,
+  0x0000110F, 0x00000029, 0x00000028, 0x00001110, 0x00000029, 0x00000028, 0x00001111, 0x00000029,
+  0x00000028, 0x00001112, 0x00000029, 0x00000028, 0x00001100, 0x00001161, 0x00000029, 0x00000028,
+  0x00001102, 0x00001161, 0x00000029, 0x00000028, 0x00001103, 0x00001161, 0x00000029, 0x00000028,
+  0x00001105, 0x00001161, 0x00000029, 0x00000028, 0x00001106, 0x00001161, 0x00000029, 0x00000028,
+  0x00001107, 0x00001161, 0x00000029, 0x00000028, 0x00001109, 0x00001161, 0x00000029, 0x00000028,
+  0x0000110B, 0x00001161, 0x00000029, 0x00000028, 0x0000110C, 0x00001161, 0x00000029, 0x00000028,
+  0x0000110E, 0x00001161, 0x00000029, 0x00000028, 0x0000110F, 0x00001161, 0x00000029, 0x00000028,
+  0x00001110, 0x00001161, 0x00000029, 0x00000028, 0x00001111, 0x00001161, 0x00000029, 0x00000028,
+  0x00001112, 0x00001161, 0x00000029, 0x00000028, 0x0000110C, 0x0000116E, 0x00000029, 0x00000028,
+  0x0000110B, 0x00001169, 0x0000110C, 0x00001165, 0x000011AB, 0x00000029, 0x00000028, 0x0000110B,
+  0x00001169, 0x00001112, 0x0000116E, 0x00000029, 0x00000028, 0x00004E00, 0x00000029, 0x00000028,
+  0x00004E8C, 0x00000029, 0x00000028, 0x00004E09, 0x00000029, 0x00000028, 0x000056DB, 0x00000029,
+  0x00000028, 0x00004E94, 0x00000029, 0x00000028, 0x0000516D, 0x00000029, 0x00000028, 0x00004E03,
+  0x00000029, 0x00000028, 0x0000516B, 0x00000029, 0x00000028, 0x00004E5D, 0x00000029, 0x00000028,
+  0x00005341, 0x00000029, 0x00000028, 0x00006708, 0x00000029, 0x00000028, 0x0000706B, 0x00000029,
+  0x00000028, 0x00006C34, 0x00000029, 0x00000028, 0x00006728, 0x00000029, 0x00000028, 0x000091D1,
+  0x00000029, 0x00000028, 0x0000571F, 0x00000029, 0x00000028, 0x000065E5, 0x00000029, 0x00000028,
+  0x0000682A, 0x00000029, 0x00000028, 0x00006709, 0x00000029, 0x00000028, 0x0000793E, 0x00000029,
+  0x00000028, 0x0000540D, 0x00000029, 0x00000028, 0x00007279, 0x00000029, 0x00000028, 0x00008CA1,
+  0x00000029, 0x00000028, 0x0000795D, 0x00000029, 0x00000028, 0x000052B4, 0x00000029, 0x00000028,
+  0x00004EE3, 0x00000029, 0x00000028, 0x0000547C, 0x00000029, 0x00000028, 0x00005B66, 0x00000029,
+  0x00000028, 0x000076E3, 0x00000029, 0x00000028, 0x00004F01, 0x00000029, 0x00000028, 0x00008CC7,
+  0x00000029, 0x00000028, 0x00005354, 0x00000029, 0x00000028, 0x0000796D, 0x00000029, 0x00000028,
+  0x00004F11, 0x00000029, 0x00000028, 0x000081EA, 0x00000029, 0x00000028, 0x000081F3, 0x00000029,
+  0x0000554F, 0x00005E7C, 0x00006587, 0x00007B8F, 0x00000050, 0x00000054, 0x00000045, 0x00000032,
+  0x00000031, 0x00000032, 0x00000032, 0x00000032, 0x00000033, 0x00000032, 0x00000034, 0x00000032,
+  0x00000035, 0x00000032, 0x00000036, 0x00000032, 0x00000037, 0x00000032, 0x00000038, 0x00000032,
+  0x00000039, 0x00000033, 0x00000030, 0x00000033, 0x00000031, 0x00000033, 0x00000032, 0x00000033,
+  0x00000033, 0x00000033, 0x00000034, 0x00000033, 0x00000035, 0x00001100, 0x00001102, 0x00001103,
+  0x00001105, 0x00001106, 0x00001107, 0x00001109, 0x0000110B, 0x0000110C, 0x0000110E, 0x0000110F,
+  0x00001110, 0x00001111, 0x00001112, 0x00001100, 0x00001161, 0x00001102, 0x00001161, 0x00001103,
+  0x00001161, 0x00001105, 0x00001161, 0x00001106, 0x00001161, 0x00001107, 0x00001161, 0x00001109,
+  0x00001161, 0x0000110B, 0x00001161, 0x0000110C, 0x00001161, 0x0000110E, 0x00001161, 0x0000110F,
+  0x00001161, 0x00001110, 0x00001161, 0x00001111, 0x00001161, 0x00001112, 0x00001161, 0x0000110E,
+  0x00001161, 0x000011B7, 0x00001100, 0x00001169, 0x0000110C, 0x0000116E, 0x0000110B, 0x00001174,
+  0x0000110B, 0x0000116E, 0x00004E00, 0x00004E8C, 0x00004E09, 0x000056DB, 0x00004E94, 0x0000516D,
+  0x00004E03, 0x0000516B, 0x00004E5D, 0x00005341, 0x00006708, 0x0000706B, 0x00006C34, 0x00006728,
+  0x000091D1, 0x0000571F, 0x000065E5, 0x0000682A, 0x00006709, 0x0000793E, 0x0000540D, 0x00007279,
+  0x00008CA1, 0x0000795D, 0x000052B4, 0x000079D8, 0x00007537, 0x00005973, 0x00009069, 0x0000512A,
+  0x00005370, 0x00006CE8, 0x00009805, 0x00004F11, 0x00005199, 0x00006B63, 0x00004E0A, 0x00004E2D,
+  0x00004E0B, 0x00005DE6, 0x000053F3, 0x0000533B, 0x00005B97, 0x00005B66, 0x000076E3, 0x00004F01,
+  0x00008CC7, 0x00005354, 0x0000591C, 0x00000033, 0x00000036, 0x00000033, 0x00000037, 0x00000033,
+  0x00000038, 0x00000033, 0x00000039, 0x00000034, 0x00000030, 0x00000034, 0x00000031, 0x00000034,
+  0x00000032, 0x00000034, 0x00000033, 0x00000034, 0x00000034, 0x00000034, 0x00000035, 0x00000034,
+  0x00000036, 0x00000034, 0x00000037, 0x00000034, 0x00000038, 0x00000034, 0x00000039, 0x00000035,
+  0x00000030, 0x00000031, 0x00006708, 0x00000032, 0x00006708, 0x00000033, 0x00006708, 0x00000034,
+  0x00006708, 0x00000035, 0x00006708, 0x00000036, 0x00006708, 0x00000037, 0x00006708, 0x00000038,
+  0x00006708, 0x00000039, 0x00006708, 0x00000031, 0x00000030, 0x00006708, 0x00000031, 0x00000031,
+  0x00006708, 0x00000031, 0x00000032, 0x00006708, 0x00000048, 0x00000067, 0x00000065, 0x00000072,
+  0x00000067, 0x00000065, 0x00000056, 0x0000004C, 0x00000054, 0x00000044, 0x000030A2, 0x000030A4,
+  0x000030A6, 0x000030A8, 0x000030AA, 0x000030AB, 0x000030AD, 0x000030AF, 0x000030B1, 0x000030B3,
+  0x000030B5, 0x000030B7, 0x000030B9, 0x000030BB, 0x000030BD, 0x000030BF, 0x000030C1, 0x000030C4,
+  0x000030C6, 0x000030C8, 0x000030CA, 0x000030CB, 0x000030CC, 0x000030CD, 0x000030CE, 0x000030CF,
+  0x000030D2, 0x000030D5, 0x000030D8, 0x000030DB, 0x000030DE, 0x000030DF, 0x000030E0, 0x000030E1,
+  0x000030E2, 0x000030E4, 0x000030E6, 0x000030E8, 0x000030E9, 0x000030EA, 0x000030EB, 0x000030EC,
+  0x000030ED, 0x000030EF, 0x000030F0, 0x000030F1, 0x000030F2, 0x00004EE4, 0x0000548C, 0x000030A2,
+  0x000030CF, 0x0800309A, 0x000030FC, 0x000030C8, 0x000030A2, 0x000030EB, 0x000030D5, 0x000030A1,
+  0x000030A2, 0x000030F3, 0x000030D8, 0x0800309A, 0x000030A2, 0x000030A2, 0x000030FC, 0x000030EB,
+  0x000030A4, 0x000030CB, 0x000030F3, 0x000030AF, 0x08003099, 0x000030A4, 0x000030F3, 0x000030C1,
+  0x000030A6, 0x000030A9, 0x000030F3, 0x000030A8, 0x000030B9, 0x000030AF, 0x000030FC, 0x000030C8,
+  0x08003099, 0x000030A8, 0x000030FC, 0x000030AB, 0x000030FC, 0x000030AA, 0x000030F3, 0x000030B9,
+  0x000030AA, 0x000030FC, 0x000030E0, 0x000030AB, 0x000030A4, 0x000030EA, 0x000030AB, 0x000030E9,
+  0x000030C3, 0x000030C8, 0x000030AB, 0x000030ED, 0x000030EA, 0x000030FC, 0x000030AB, 0x08003099,
+  0x000030ED, 0x000030F3, 0x000030AB, 0x08003099, 0x000030F3, 0x000030DE, 0x000030AD, 0x08003099,
+  0x000030AB, 0x08003099, 0x000030AD, 0x08003099, 0x000030CB, 0x000030FC, 0x000030AD, 0x000030E5,
+  0x000030EA, 0x000030FC, 0x000030AD, 0x08003099, 0x000030EB, 0x000030BF, 0x08003099, 0x000030FC,
+  0x000030AD, 0x000030ED, 0x000030AD, 0x000030ED, 0x000030AF, 0x08003099, 0x000030E9, 0x000030E0,
+  0x000030AD, 0x000030ED, 0x000030E1, 0x000030FC, 0x000030C8, 0x000030EB, 0x000030AD, 0x000030ED,
+  0x000030EF, 0x000030C3, 0x000030C8, 0x000030AF, 0x08003099, 0x000030E9, 0x000030E0, 0x000030AF,
+  0x08003099, 0x000030E9, 0x000030E0, 0x000030C8, 0x000030F3, 0x000030AF, 0x000030EB, 0x000030BB,
+  0x08003099, 0x000030A4, 0x000030ED, 0x000030AF, 0x000030ED, 0x000030FC, 0x000030CD, 0x000030B1,
+  0x000030FC, 0x000030B9, 0x000030B3, 0x000030EB, 0x000030CA, 0x000030B3, 0x000030FC, 0x000030DB,
+  0x0800309A, 0x000030B5, 0x000030A4, 0x000030AF, 0x000030EB, 0x000030B5, 0x000030F3, 0x000030C1,
+  0x000030FC, 0x000030E0, 0x000030B7, 0x000030EA, 0x000030F3, 0x000030AF, 0x08003099, 0x000030BB,
+  0x000030F3, 0x000030C1, 0x000030BB, 0x000030F3, 0x000030C8, 0x000030BF, 0x08003099, 0x000030FC,
+  0x000030B9, 0x000030C6, 0x08003099, 0x000030B7, 0x000030C8, 0x08003099, 0x000030EB, 0x000030C8,
+  0x000030F3, 0x000030CA, 0x000030CE, 0x000030CE, 0x000030C3, 0x000030C8, 0x000030CF, 0x000030A4,
+  0x000030C4, 0x000030CF, 0x0800309A, 0x000030FC, 0x000030BB, 0x000030F3, 0x000030C8, 0x000030CF,
+  0x0800309A, 0x000030FC, 0x000030C4, 0x000030CF, 0x08003099, 0x000030FC, 0x000030EC, 0x000030EB,
+  0x000030D2, 0x0800309A, 0x000030A2, 0x000030B9, 0x000030C8, 0x000030EB, 0x000030D2, 0x0800309A,
+  0x000030AF, 0x000030EB, 0x000030D2, 0x0800309A, 0x000030B3, 0x000030D2, 0x08003099, 0x000030EB,
+  0x000030D5, 0x000030A1, 0x000030E9, 0x000030C3, 0x000030C8, 0x08003099, 0x000030D5, 0x000030A3,
+  0x000030FC, 0x000030C8, 0x000030D5, 0x08003099, 0x000030C3, 0x000030B7, 0x000030A7, 0x000030EB,
+  0x000030D5, 0x000030E9, 0x000030F3, 0x000030D8, 0x000030AF, 0x000030BF, 0x000030FC, 0x000030EB,
+  0x000030D8, 0x0800309A, 0x000030BD, 0x000030D8, 0x0800309A, 0x000030CB, 0x000030D2, 0x000030D8,
+  0x000030EB, 0x000030C4, 0x000030D8, 0x0800309A, 0x000030F3, 0x000030B9, 0x000030D8, 0x0800309A,
+  0x000030FC, 0x000030B7, 0x08003099, 0x000030D8, 0x08003099, 0x000030FC, 0x000030BF, 0x000030DB,
+  0x0800309A, 0x000030A4, 0x000030F3, 0x000030C8, 0x000030DB, 0x08003099, 0x000030EB, 0x000030C8,
+  0x000030DB, 0x000030F3, 0x000030DB, 0x0800309A, 0x000030F3, 0x000030C8, 0x08003099, 0x000030DB,
+  0x000030FC, 0x000030EB, 0x000030DB, 0x000030FC, 0x000030F3, 0x000030DE, 0x000030A4, 0x000030AF,
+  0x000030ED, 0x000030DE, 0x000030A4, 0x000030EB, 0x000030DE, 0x000030C3, 0x000030CF, 0x000030DE,
+  0x000030EB, 0x000030AF, 0x000030DE, 0x000030F3, 0x000030B7, 0x000030E7, 0x000030F3, 0x000030DF,
+  0x000030AF, 0x000030ED, 0x000030F3, 0x000030DF, 0x000030EA, 0x000030DF, 0x000030EA, 0x000030CF,
+  0x08003099, 0x000030FC, 0x000030EB, 0x000030E1, 0x000030AB, 0x08003099, 0x000030E1, 0x000030AB,
+  0x08003099, 0x000030C8, 0x000030F3, 0x000030E1, 0x000030FC, 0x000030C8, 0x000030EB, 0x000030E4,
+  0x000030FC, 0x000030C8, 0x08003099, 0x000030E4, 0x000030FC, 0x000030EB, 0x000030E6, 0x000030A2,
+  0x000030F3, 0x000030EA, 0x000030C3, 0x000030C8, 0x000030EB, 0x000030EA, 0x000030E9, 0x000030EB,
+  0x000030D2, 0x0800309A, 0x000030FC, 0x000030EB, 0x000030FC, 0x000030D5, 0x08003099, 0x000030EB,
+  0x000030EC, 0x000030E0, 0x000030EC, 0x000030F3, 0x000030C8, 0x000030B1, 0x08003099, 0x000030F3,
+  0x000030EF, 0x000030C3, 0x000030C8, 0x00000030, 0x000070B9, 0x00000031, 0x000070B9, 0x00000032,
+  0x000070B9, 0x00000033, 0x000070B9, 0x00000034, 0x000070B9, 0x00000035, 0x000070B9, 0x00000036,
+  0x000070B9, 0x00000037, 0x000070B9, 0x00000038, 0x000070B9, 0x00000039, 0x000070B9, 0x00000031,
+  0x00000030, 0x000070B9, 0x00000031, 0x00000031, 0x000070B9, 0x00000031, 0x00000032, 0x000070B9,
+  0x00000031, 0x00000033, 0x000070B9, 0x00000031, 0x00000034, 0x000070B9, 0x00000031, 0x00000035,
+  0x000070B9, 0x00000031, 0x00000036, 0x000070B9, 0x00000031, 0x00000037, 0x000070B9, 0x00000031,
+  0x00000038, 0x000070B9, 0x00000031, 0x00000039, 0x000070B9, 0x00000032, 0x00000030, 0x000070B9,
+  0x00000032, 0x00000031, 0x000070B9, 0x00000032, 0x00000032, 0x000070B9, 0x00000032, 0x00000033,
+  0x000070B9, 0x00000032, 0x00000034, 0x000070B9, 0x00000068, 0x00000050, 0x00000061, 0x00000064,
+  0x00000061, 0x00000041, 0x00000055, 0x00000062, 0x00000061, 0x00000072, 0x0000006F, 0x00000056,
+  0x00000070, 0x00000063, 0x00000064, 0x0000006D, 0x00000064, 0x0000006D, 0x00000032, 0x00000064,
+  0x0000006D, 0x00000033, 0x00000049, 0x00000055, 0x00005E73, 0x00006210, 0x0000662D, 0x0000548C,
+  0x00005927, 0x00006B63, 0x0000660E, 0x00006CBB, 0x0000682A, 0x00005F0F, 0x00004F1A, 0x0000793E,
+  0x00000070, 0x00000041, 0x0000006E, 0x00000041, 0x000003BC, 0x00000041, 0x0000006D, 0x00000041,
+  0x0000006B, 0x00000041, 0x0000004B, 0x00000042, 0x0000004D, 0x00000042, 0x00000047, 0x00000042,
+  0x00000063, 0x00000061, 0x0000006C, 0x0000006B, 0x00000063, 0x00000061, 0x0000006C, 0x00000070,
+  0x00000046, 0x0000006E, 0x00000046, 0x000003BC, 0x00000046, 0x000003BC, 0x00000067, 0x0000006D,
+  0x00000067, 0x0000006B, 0x00000067, 0x00000048, 0x0000007A, 0x0000006B, 0x00000048, 0x0000007A,
+  0x0000004D, 0x00000048, 0x0000007A, 0x00000047, 0x00000048, 0x0000007A, 0x00000054, 0x00000048,
+  0x0000007A, 0x000003BC, 0x0000006C, 0x0000006D, 0x0000006C, 0x00000064, 0x0000006C, 0x0000006B,
+  0x0000006C, 0x00000066, 0x0000006D, 0x0000006E, 0x0000006D, 0x000003BC, 0x0000006D, 0x0000006D,
+  0x0000006D, 0x00000063, 0x0000006D, 0x0000006B, 0x0000006D, 0x0000006D, 0x0000006D, 0x00000032,
+  0x00000063, 0x0000006D, 0x00000032, 0x0000006D, 0x00000032, 0x0000006B, 0x0000006D, 0x00000032,
+  0x0000006D, 0x0000006D, 0x00000033, 0x00000063, 0x0000006D, 0x00000033, 0x0000006D, 0x00000033,
+  0x0000006B, 0x0000006D, 0x00000033, 0x0000006D, 0x00002215, 0x00000073, 0x0000006D, 0x00002215,
+  0x00000073, 0x00000032, 0x00000050, 0x00000061, 0x0000006B, 0x00000050, 0x00000061, 0x0000004D,
+  0x00000050, 0x00000061, 0x00000047, 0x00000050, 0x00000061, 0x00000072, 0x00000061, 0x00000064,
+  0x00000072, 0x00000061, 0x00000064, 0x00002215, 0x00000073, 0x00000072, 0x00000061, 0x00000064,
+  0x00002215, 0x00000073, 0x00000032, 0x00000070, 0x00000073, 0x0000006E, 0x00000073, 0x000003BC,
+  0x00000073, 0x0000006D, 0x00000073, 0x00000070, 0x00000056, 0x0000006E, 0x00000056, 0x000003BC,
+  0x00000056, 0x0000006D, 0x00000056, 0x0000006B, 0x00000056, 0x0000004D, 0x00000056, 0x00000070,
+  0x00000057, 0x0000006E, 0x00000057, 0x000003BC, 0x00000057, 0x0000006D, 0x00000057, 0x0000006B,
+  0x00000057, 0x0000004D, 0x00000057, 0x0000006B, 0x000003A9, 0x0000004D, 0x000003A9, 0x00000061,
+  0x0000002E, 0x0000006D, 0x0000002E, 0x00000042, 0x00000071, 0x00000063, 0x00000063, 0x00000063,
+  0x00000064, 0x00000043, 0x00002215, 0x0000006B, 0x00000067, 0x00000043, 0x0000006F, 0x0000002E,
+  0x00000064, 0x00000042, 0x00000047, 0x00000079, 0x00000068, 0x00000061, 0x00000048, 0x00000050,
+  0x00000069, 0x0000006E, 0x0000004B, 0x0000004B, 0x0000004B, 0x0000004D, 0x0000006B, 0x00000074,
+  0x0000006C, 0x0000006D, 0x0000006C, 0x0000006E, 0x0000006C, 0x0000006F, 0x00000067, 0x0000006C,
+  0x00000078, 0x0000006D, 0x00000062, 0x0000006D, 0x00000069, 0x0000006C, 0x0000006D, 0x0000006F,
+  0x0000006C, 0x00000050, 0x00000048, 0x00000070, 0x0000002E, 0x0000006D, 0x0000002E, 0x00000050,
+  0x00000050, 0x0000004D, 0x00000050, 0x00000052, 0x00000073, 0x00000072, 0x00000053, 0x00000076,
+  0x00000057, 0x00000062, 0x00000056, 0x00002215, 0x0000006D, 0x00000041, 0x00002215, 0x0000006D,
+  0x00000031, 0x000065E5, 0x00000032, 0x000065E5, 0x00000033, 0x000065E5, 0x00000034, 0x000065E5,
+  0x00000035, 0x000065E5, 0x00000036, 0x000065E5, 0x00000037, 0x000065E5, 0x00000038, 0x000065E5,
+  0x00000039, 0x000065E5, 0x00000031, 0x00000030, 0x000065E5, 0x00000031, 0x00000031, 0x000065E5,
+  0x00000031, 0x00000032, 0x000065E5, 0x00000031, 0x00000033, 0x000065E5, 0x00000031, 0x00000034,
+  0x000065E5, 0x00000031, 0x00000035, 0x000065E5, 0x00000031, 0x00000036, 0x000065E5, 0x00000031,
+  0x00000037, 0x000065E5, 0x00000031, 0x00000038, 0x000065E5, 0x00000031, 0x00000039, 0x000065E5,
+  0x00000032, 0x00000030, 0x000065E5, 0x00000032, 0x00000031, 0x000065E5, 0x00000032, 0x00000032,
+  0x000065E5, 0x00000032, 0x00000033, 0x000065E5, 0x00000032, 0x00000034, 0x000065E5, 0x00000032,
+  0x00000035, 0x000065E5, 0x00000032, 0x00000036, 0x000065E5, 0x00000032, 0x00000037, 0x000065E5,
+  0x00000032, 0x00000038, 0x000065E5, 0x00000032, 0x00000039, 0x000065E5, 0x00000033, 0x00000030,
+  0x000065E5, 0x00000033, 0x00000031, 0x000065E5, 0x00000067, 0x00000061, 0x0000006C, 0x0000044A,
+  0x0000044C, 0x0000A76F, 0x00000126, 0x00000153, 0x0000A727, 0x0000AB37, 0x0000026B, 0x0000AB52,
+  0x00008C48, 0x000066F4, 0x00008ECA, 0x00008CC8, 0x00006ED1, 0x00004E32, 0x000053E5, 0x00009F9C,
+  0x00009F9C, 0x00005951, 0x000091D1, 0x00005587, 0x00005948, 0x000061F6, 0x00007669, 0x00007F85,
+  0x0000863F, 0x000087BA, 0x000088F8, 0x0000908F, 0x00006A02, 0x00006D1B, 0x000070D9, 0x000073DE,
+  0x0000843D, 0x0000916A, 0x000099F1, 0x00004E82, 0x00005375, 0x00006B04, 0x0000721B, 0x0000862D,
+  0x00009E1E, 0x00005D50, 0x00006FEB, 0x000085CD, 0x00008964, 0x000062C9, 0x000081D8, 0x0000881F,
+  0x00005ECA, 0x00006717, 0x00006D6A, 0x000072FC, 0x000090CE, 0x00004F86, 0x000051B7, 0x000052DE,
+  0x000064C4, 0x00006AD3, 0x00007210, 0x000076E7, 0x00008001, 0x00008606, 0x0000865C, 0x00008DEF,
+  0x00009732, 0x00009B6F, 0x00009DFA, 0x0000788C, 0x0000797F, 0x00007DA0, 0x000083C9, 0x00009304,
+  0x00009E7F, 0x00008AD6, 0x000058DF, 0x00005F04, 0x00007C60, 0x0000807E, 0x00007262, 0x000078CA,
+  0x00008CC2, 0x000096F7, 0x000058D8, 0x00005C62, 0x00006A13, 0x00006DDA, 0x00006F0F, 0x00007D2F,
+  0x00007E37, 0x0000964B, 0x000052D2, 0x0000808B, 0x000051DC, 0x000051CC, 0x00007A1C, 0x00007DBE,
+  0x000083F1, 0x00009675, 0x00008B80, 0x000062CF, 0x00006A02, 0x00008AFE, 0x00004E39, 0x00005BE7,
+  0x00006012, 0x00007387, 0x00007570, 0x00005317, 0x000078FB, 0x00004FBF, 0x00005FA9, 0x00004E0D,
+  0x00006CCC, 0x00006578, 0x00007D22, 0x000053C3, 0x0000585E, 0x00007701, 0x00008449, 0x00008AAA,
+  0x00006BBA, 0x00008FB0, 0x00006C88, 0x000062FE, 0x000082E5, 0x000063A0, 0x00007565, 0x00004EAE,
+  0x00005169, 0x000051C9, 0x00006881, 0x00007CE7, 0x0000826F, 0x00008AD2, 0x000091CF, 0x000052F5,
+  0x00005442, 0x00005973, 0x00005EEC, 0x000065C5, 0x00006FFE, 0x0000792A, 0x000095AD, 0x00009A6A,
+  0x00009E97, 0x00009ECE, 0x0000529B, 0x000066C6, 0x00006B77, 0x00008F62, 0x00005E74, 0x00006190,
+  0x00006200, 0x0000649A, 0x00006F23, 0x00007149, 0x00007489, 0x000079CA, 0x00007DF4, 0x0000806F,
+  0x00008F26, 0x000084EE, 0x00009023, 0x0000934A, 0x00005217, 0x000052A3, 0x000054BD, 0x000070C8,
+  0x000088C2, 0x00008AAA, 0x00005EC9, 0x00005FF5, 0x0000637B, 0x00006BAE, 0x00007C3E, 0x00007375,
+  0x00004EE4, 0x000056F9, 0x00005BE7, 0x00005DBA, 0x0000601C, 0x000073B2, 0x00007469, 0x00007F9A,
+  0x00008046, 0x00009234, 0x000096F6, 0x00009748, 0x00009818, 0x00004F8B, 0x000079AE, 0x000091B4,
+  0x000096B8, 0x000060E1, 0x00004E86, 0x000050DA, 0x00005BEE, 0x00005C3F, 0x00006599, 0x00006A02,
+  0x000071CE, 0x00007642, 0x000084FC, 0x0000907C, 0x00009F8D, 0x00006688, 0x0000962E, 0x00005289,
+  0x0000677B, 0x000067F3, 0x00006D41, 0x00006E9C, 0x00007409, 0x00007559, 0x0000786B, 0x00007D10,
+  0x0000985E, 0x0000516D, 0x0000622E, 0x00009678, 0x0000502B, 0x00005D19, 0x00006DEA, 0x00008F2A,
+  0x00005F8B, 0x00006144, 0x00006817, 0x00007387, 0x00009686, 0x00005229, 0x0000540F, 0x00005C65,
+  0x00006613, 0x0000674E, 0x000068A8, 0x00006CE5, 0x00007406, 0x000075E2, 0x00007F79, 0x000088CF,
+  0x000088E1, 0x000091CC, 0x000096E2, 0x0000533F, 0x00006EBA, 0x0000541D, 0x000071D0, 0x00007498,
+  0x000085FA, 0x000096A3, 0x00009C57, 0x00009E9F, 0x00006797, 0x00006DCB, 0x000081E8, 0x00007ACB,
+  0x00007B20, 0x00007C92, 0x000072C0, 0x00007099, 0x00008B58, 0x00004EC0, 0x00008336, 0x0000523A,
+  0x00005207, 0x00005EA6, 0x000062D3, 0x00007CD6, 0x00005B85, 0x00006D1E, 0x000066B4, 0x00008F3B,
+  0x0000884C, 0x0000964D, 0x0000898B, 0x00005ED3, 0x00005140, 0x000055C0, 0x0000585A, 0x00006674,
+  0x000051DE, 0x0000732A, 0x000076CA, 0x0000793C, 0x0000795E, 0x00007965, 0x0000798F, 0x00009756,
+  0x00007CBE, 0x00007FBD, 0x00008612, 0x00008AF8, 0x00009038, 0x000090FD, 0x000098EF, 0x000098FC,
+  0x00009928, 0x00009DB4, 0x000090DE, 0x000096B7, 0x00004FAE, 0x000050E7, 0x0000514D, 0x000052C9,
+  0x000052E4, 0x00005351, 0x0000559D, 0x00005606, 0x00005668, 0x00005840, 0x000058A8, 0x00005C64,
+  0x00005C6E, 0x00006094, 0x00006168, 0x0000618E, 0x000061F2, 0x0000654F, 0x000065E2, 0x00006691,
+  0x00006885, 0x00006D77, 0x00006E1A, 0x00006F22, 0x0000716E, 0x0000722B, 0x00007422, 0x00007891,
+  0x0000793E, 0x00007949, 0x00007948, 0x00007950, 0x00007956, 0x0000795D, 0x0000798D, 0x0000798E,
+  0x00007A40, 0x00007A81, 0x00007BC0, 0x00007DF4, 0x00007E09, 0x00007E41, 0x00007F72, 0x00008005,
+  0x000081ED, 0x00008279, 0x00008279, 0x00008457, 0x00008910, 0x00008996, 0x00008B01, 0x00008B39,
+  0x00008CD3, 0x00008D08, 0x00008FB6, 0x00009038, 0x000096E3, 0x000097FF, 0x0000983B, 0x00006075,
+  0x000242EE, 0x00008218, 0x00004E26, 0x000051B5, 0x00005168, 0x00004F80, 0x00005145, 0x00005180,
+  0x000052C7, 0x000052FA, 0x0000559D, 0x00005555, 0x00005599, 0x000055E2, 0x0000585A, 0x000058B3,
+  0x00005944, 0x00005954, 0x00005A62, 0x00005B28, 0x00005ED2, 0x00005ED9, 0x00005F69, 0x00005FAD,
+  0x000060D8, 0x0000614E, 0x00006108, 0x0000618E, 0x00006160, 0x000061F2, 0x00006234, 0x000063C4,
+  0x0000641C, 0x00006452, 0x00006556, 0x00006674, 0x00006717, 0x0000671B, 0x00006756, 0x00006B79,
+  0x00006BBA, 0x00006D41, 0x00006EDB, 0x00006ECB, 0x00006F22, 0x0000701E, 0x0000716E, 0x000077A7,
+  0x00007235, 0x000072AF, 0x0000732A, 0x00007471, 0x00007506, 0x0000753B, 0x0000761D, 0x0000761F,
+  0x000076CA, 0x000076DB, 0x000076F4, 0x0000774A, 0x00007740, 0x000078CC, 0x00007AB1, 0x00007BC0,
+  0x00007C7B, 0x00007D5B, 0x00007DF4, 0x00007F3E, 0x00008005, 0x00008352, 0x000083EF, 0x00008779,
+  0x00008941, 0x00008986, 0x00008996, 0x00008ABF, 0x00008AF8, 0x00008ACB, 0x00008B01, 0x00008AFE,
+  0x00008AED, 0x00008B39, 0x00008B8A, 0x00008D08, 0x00008F38, 0x00009072, 0x00009199, 0x00009276,
+  0x0000967C, 0x000096E3, 0x00009756, 0x000097DB, 0x000097FF, 0x0000980B, 0x0000983B, 0x00009B12,
+  0x00009F9C, 0x0002284A, 0x00022844, 0x000233D5, 0x00003B9D, 0x00004018, 0x00004039, 0x00025249,
+  0x00025CD0, 0x00027ED3, 0x00009F43, 0x00009F8E, 0x00000066, 0x00000066, 0x00000066, 0x00000069,
+  0x00000066, 0x0000006C, 0x00000066, 0x00000066, 0x00000069, 0x00000066, 0x00000066, 0x0000006C,
+  0x00000073, 0x00000074, 0x00000073, 0x00000074, 0x00000574, 0x00000576, 0x00000574, 0x00000565,
+  0x00000574, 0x0000056B, 0x0000057E, 0x00000576, 0x00000574, 0x0000056D, 0x000005D9, 0x0E0005B4,
+  0x000005F2, 0x110005B7, 0x000005E2, 0x000005D0, 0x000005D3, 0x000005D4, 0x000005DB, 0x000005DC,
+  0x000005DD, 0x000005E8, 0x000005EA, 0x0000002B, 0x000005E9, 0x180005C1, 0x000005E9, 0x190005C2,
+  0x000005E9, 0x150005BC, 0x180005C1, 0x000005E9, 0x150005BC, 0x190005C2, 0x000005D0, 0x110005B7,
+  0x000005D0, 0x120005B8, 0x000005D0, 0x150005BC, 0x000005D1, 0x150005BC, 0x000005D2, 0x150005BC,
+  0x000005D3, 0x150005BC, 0x000005D4, 0x150005BC, 0x000005D5, 0x150005BC, 0x000005D6, 0x150005BC,
+  0x000005D8, 0x150005BC, 0x000005D9, 0x150005BC, 0x000005DA, 0x150005BC, 0x000005DB, 0x150005BC,
+  0x000005DC, 0x150005BC, 0x000005DE, 0x150005BC, 0x000005E0, 0x150005BC, 0x000005E1, 0x150005BC,
+  0x000005E3, 0x150005BC, 0x000005E4, 0x150005BC, 0x000005E6, 0x150005BC, 0x000005E7, 0x150005BC,
+  0x000005E8, 0x150005BC, 0x000005E9, 0x150005BC, 0x000005EA, 0x150005BC, 0x000005D5, 0x130005B9,
+  0x000005D1, 0x170005BF, 0x000005DB, 0x170005BF, 0x000005E4, 0x170005BF, 0x000005D0, 0x000005DC,
+  0x00000671, 0x00000671, 0x0000067B, 0x0000067B, 0x0000067B, 0x0000067B, 0x0000067E, 0x0000067E,
+  0x0000067E, 0x0000067E, 0x00000680, 0x00000680, 0x00000680, 0x00000680, 0x0000067A, 0x0000067A,
+  0x0000067A, 0x0000067A, 0x0000067F, 0x0000067F, 0x0000067F, 0x0000067F, 0x00000679, 0x00000679,
+  0x00000679, 0x00000679, 0x000006A4, 0x000006A4, 0x000006A4, 0x000006A4, 0x000006A6, 0x000006A6,
+  0x000006A6, 0x000006A6, 0x00000684, 0x00000684, 0x00000684, 0x00000684, 0x00000683, 0x00000683,
+  0x00000683, 0x00000683, 0x00000686, 0x00000686, 0x00000686, 0x00000686, 0x00000687, 0x00000687,
+  0x00000687, 0x00000687, 0x0000068D, 0x0000068D, 0x0000068C, 0x0000068C, 0x0000068E, 0x0000068E,
+  0x00000688, 0x00000688, 0x00000698, 0x00000698, 0x00000691, 0x00000691, 0x000006A9, 0x000006A9,
+  0x000006A9, 0x000006A9, 0x000006AF, 0x000006AF, 0x000006AF, 0x000006AF, 0x000006B3, 0x000006B3,
+  0x000006B3, 0x000006B3, 0x000006B1, 0x000006B1, 0x000006B1, 0x000006B1, 0x000006BA, 0x000006BA,
+  0x000006BB, 0x000006BB, 0x000006BB, 0x000006BB, 0x000006D5, 0xE6000654, 0x000006D5, 0xE6000654,
+  0x000006C1, 0x000006C1, 0x000006C1, 0x000006C1, 0x000006BE, 0x000006BE, 0x000006BE, 0x000006BE,
+  0x000006D2, 0x000006D2, 0x000006D2, 0xE6000654, 0x000006D2, 0xE6000654, 0x000006AD, 0x000006AD,
+  0x000006AD, 0x000006AD, 0x000006C7, 0x000006C7, 0x000006C6, 0x000006C6, 0x000006C8, 0x000006C8,
+  0x000006C7, 0x00000674, 0x000006CB, 0x000006CB, 0x000006C5, 0x000006C5, 0x000006C9, 0x000006C9,
+  0x000006D0, 0x000006D0, 0x000006D0, 0x000006D0, 0x00000649, 0x00000649, 0x0000064A, 0xE6000654,
+  0x00000627, 0x0000064A, 0xE6000654, 0x00000627, 0x0000064A, 0xE6000654, 0x000006D5, 0x0000064A,
+  0xE6000654, 0x000006D5, 0x0000064A, 0xE6000654, 0x00000648, 0x0000064A, 0xE6000654, 0x00000648,
+  0x0000064A, 0xE6000654, 0x000006C7, 0x0000064A, 0xE6000654, 0x000006C7, 0x0000064A, 0xE6000654,
+  0x000006C6, 0x0000064A, 0xE6000654, 0x000006C6, 0x0000064A, 0xE6000654, 0x000006C8, 0x0000064A,
+  0xE6000654, 0x000006C8, 0x0000064A, 0xE6000654, 0x000006D0, 0x0000064A, 0xE6000654, 0x000006D0,
+  0x0000064A, 0xE6000654, 0x000006D0, 0x0000064A, 0xE6000654, 0x00000649, 0x0000064A, 0xE6000654,
+  0x00000649, 0x0000064A, 0xE6000654, 0x00000649, 0x000006CC, 0x000006CC, 0x000006CC, 0x000006CC,
+  0x0000064A, 0xE6000654, 0x0000062C, 0x0000064A, 0xE6000654, 0x0000062D, 0x0000064A, 0xE6000654,
+  0x00000645, 0x0000064A, 0xE6000654, 0x00000649, 0x0000064A, 0xE6000654, 0x0000064A, 0x00000628,
+  0x0000062C, 0x00000628, 0x0000062D, 0x00000628, 0x0000062E, 0x00000628, 0x00000645, 0x00000628,
+  0x00000649, 0x00000628, 0x0000064A, 0x0000062A, 0x0000062C, 0x0000062A, 0x0000062D, 0x0000062A,
+  0x0000062E, 0x0000062A, 0x00000645, 0x0000062A, 0x00000649, 0x0000062A, 0x0000064A, 0x0000062B,
+  0x0000062C, 0x0000062B, 0x00000645, 0x0000062B, 0x00000649, 0x0000062B, 0x0000064A, 0x0000062C,
+  0x0000062D, 0x0000062C, 0x00000645, 0x0000062D, 0x0000062C, 0x0000062D, 0x00000645, 0x0000062E,
+  0x0000062C, 0x0000062E, 0x0000062D, 0x0000062E, 0x00000645, 0x00000633, 0x0000062C, 0x00000633,
+  0x0000062D, 0x00000633, 0x0000062E, 0x00000633, 0x00000645, 0x00000635, 0x0000062D, 0x00000635,
+  0x00000645, 0x00000636, 0x0000062C, 0x00000636, 0x0000062D, 0x00000636, 0x0000062E, 0x00000636,
+  0x00000645, 0x00000637, 0x0000062D, 0x00000637, 0x00000645, 0x00000638, 0x00000645, 0x00000639,
+  0x0000062C, 0x00000639, 0x00000645, 0x0000063A, 0x0000062C, 0x0000063A, 0x00000645, 0x00000641,
+  0x0000062C, 0x00000641, 0x0000062D, 0x00000641, 0x0000062E, 0x00000641, 0x00000645, 0x00000641,
+  0x00000649, 0x00000641, 0x0000064A, 0x00000642, 0x0000062D, 0x00000642, 0x00000645, 0x00000642,
+  0x00000649, 0x00000642, 0x0000064A, 0x00000643, 0x00000627, 0x00000643, 0x0000062C, 0x00000643,
+  0x0000062D, 0x00000643, 0x0000062E, 0x00000643, 0x00000644, 0x00000643, 0x00000645, 0x00000643,
+  0x00000649, 0x00000643, 0x0000064A, 0x00000644, 0x0000062C, 0x00000644, 0x0000062D, 0x00000644,
+  0x0000062E, 0x00000644, 0x00000645, 0x00000644, 0x00000649, 0x00000644, 0x0000064A, 0x00000645,
+  0x0000062C, 0x00000645, 0x0000062D, 0x00000645, 0x0000062E, 0x00000645, 0x00000645, 0x00000645,
+  0x00000649, 0x00000645, 0x0000064A, 0x00000646, 0x0000062C, 0x00000646, 0x0000062D, 0x00000646,
+  0x0000062E, 0x00000646, 0x00000645, 0x00000646, 0x00000649, 0x00000646, 0x0000064A, 0x00000647,
+  0x0000062C, 0x00000647, 0x00000645, 0x00000647, 0x00000649, 0x00000647, 0x0000064A, 0x0000064A,
+  0x0000062C, 0x0000064A, 0x0000062D, 0x0000064A, 0x0000062E, 0x0000064A, 0x00000645, 0x0000064A,
+  0x00000649, 0x0000064A, 0x0000064A, 0x00000630, 0x23000670, 0x00000631, 0x23000670, 0x00000649,
+  0x23000670, 0x00000020, 0x1C00064C, 0x21000651, 0x00000020, 0x1D00064D, 0x21000651, 0x00000020,
+  0x1E00064E, 0x21000651, 0x00000020, 0x1F00064F, 0x21000651, 0x00000020, 0x20000650, 0x21000651,
+  0x00000020, 0x21000651, 0x23000670, 0x0000064A, 0xE6000654, 0x00000631, 0x0000064A, 0xE6000654,
+  0x00000632, 0x0000064A, 0xE6000654, 0x00000645, 0x0000064A, 0xE6000654, 0x00000646, 0x0000064A,
+  0xE6000654, 0x00000649, 0x0000064A, 0xE6000654, 0x0000064A, 0x00000628, 0x00000631, 0x00000628,
+  0x00000632, 0x00000628, 0x00000645, 0x00000628, 0x00000646, 0x00000628, 0x00000649, 0x00000628,
+  0x0000064A, 0x0000062A, 0x00000631, 0x0000062A, 0x00000632, 0x0000062A, 0x00000645, 0x0000062A,
+  0x00000646, 0x0000062A, 0x00000649, 0x0000062A, 0x0000064A, 0x0000062B, 0x00000631, 0x0000062B,
+  0x00000632, 0x0000062B, 0x00000645, 0x0000062B, 0x00000646, 0x0000062B, 0x00000649, 0x0000062B,
+  0x0000064A, 0x00000641, 0x00000649, 0x00000641, 0x0000064A, 0x00000642, 0x00000649, 0x00000642,
+  0x0000064A, 0x00000643, 0x00000627, 0x00000643, 0x00000644, 0x00000643, 0x00000645, 0x00000643,
+  0x00000649, 0x00000643, 0x0000064A, 0x00000644, 0x00000645, 0x00000644, 0x00000649, 0x00000644,
+  0x0000064A, 0x00000645, 0x00000627, 0x00000645, 0x00000645, 0x00000646, 0x00000631, 0x00000646,
+  0x00000632, 0x00000646, 0x00000645, 0x00000646, 0x00000646, 0x00000646, 0x00000649, 0x00000646,
+  0x0000064A, 0x00000649, 0x23000670, 0x0000064A, 0x00000631, 0x0000064A, 0x00000632, 0x0000064A,
+  0x00000645, 0x0000064A, 0x00000646, 0x0000064A, 0x00000649, 0x0000064A, 0x0000064A, 0x0000064A,
+  0xE6000654, 0x0000062C, 0x0000064A, 0xE6000654, 0x0000062D, 0x0000064A, 0xE6000654, 0x0000062E,
+  0x0000064A, 0xE6000654, 0x00000645, 0x0000064A, 0xE6000654, 0x00000647, 0x00000628, 0x0000062C,
+  0x00000628, 0x0000062D, 0x00000628, 0x0000062E, 0x00000628, 0x00000645, 0x00000628, 0x00000647,
+  0x0000062A, 0x0000062C, 0x0000062A, 0x0000062D, 0x0000062A, 0x0000062E, 0x0000062A, 0x00000645,
+  0x0000062A, 0x00000647, 0x0000062B, 0x00000645, 0x0000062C, 0x0000062D, 0x0000062C, 0x00000645,
+  0x0000062D, 0x0000062C, 0x0000062D, 0x00000645, 0x0000062E, 0x0000062C, 0x0000062E, 0x00000645,
+  0x00000633, 0x0000062C, 0x00000633, 0x0000062D, 0x00000633, 0x0000062E, 0x00000633, 0x00000645,
+  0x00000635, 0x0000062D, 0x00000635, 0x0000062E, 0x00000635, 0x00000645, 0x00000636, 0x0000062C,
+  0x00000636, 0x0000062D, 0x00000636, 0x0000062E, 0x00000636, 0x00000645, 0x00000637, 0x0000062D,
+  0x00000638, 0x00000645, 0x00000639, 0x0000062C, 0x00000639, 0x00000645, 0x0000063A, 0x0000062C,
+  0x0000063A, 0x00000645, 0x00000641, 0x0000062C, 0x00000641, 0x0000062D, 0x00000641, 0x0000062E,
+  0x00000641, 0x00000645, 0x00000642, 0x0000062D, 0x00000642, 0x00000645, 0x00000643, 0x0000062C,
+  0x00000643, 0x0000062D, 0x00000643, 0x0000062E, 0x00000643, 0x00000644, 0x00000643, 0x00000645,
+  0x00000644, 0x0000062C, 0x00000644, 0x0000062D, 0x00000644, 0x0000062E, 0x00000644, 0x00000645,
+  0x00000644, 0x00000647, 0x00000645, 0x0000062C, 0x00000645, 0x0000062D, 0x00000645, 0x0000062E,
+  0x00000645, 0x00000645, 0x00000646, 0x0000062C, 0x00000646, 0x0000062D, 0x00000646, 0x0000062E,
+  0x00000646, 0x00000645, 0x00000646, 0x00000647, 0x00000647, 0x0000062C, 0x00000647, 0x00000645,
+  0x00000647, 0x23000670, 0x0000064A, 0x0000062C, 0x0000064A, 0x0000062D, 0x0000064A, 0x0000062E,
+  0x0000064A, 0x00000645, 0x0000064A, 0x00000647, 0x0000064A, 0xE6000654, 0x00000645, 0x0000064A,
+  0xE6000654, 0x00000647, 0x00000628, 0x00000645, 0x00000628, 0x00000647, 0x0000062A, 0x00000645,
+  0x0000062A, 0x00000647, 0x0000062B, 0x00000645, 0x0000062B, 0x00000647, 0x00000633, 0x00000645,
+  0x00000633, 0x00000647, 0x00000634, 0x00000645, 0x00000634, 0x00000647, 0x00000643, 0x00000644,
+  0x00000643, 0x00000645, 0x00000644, 0x00000645, 0x00000646, 0x00000645, 0x00000646, 0x00000647,
+  0x0000064A, 0x00000645, 0x0000064A, 0x00000647, 0x00000640, 0x1E00064E, 0x21000651, 0x00000640,
+  0x1F00064F, 0x21000651, 0x00000640, 0x20000650, 0x21000651, 0x00000637, 0x00000649, 0x00000637,
+  0x0000064A, 0x00000639, 0x00000649, 0x00000639, 0x0000064A, 0x0000063A, 0x00000649, 0x0000063A,
+  0x0000064A, 0x00000633, 0x00000649, 0x00000633, 0x0000064A, 0x00000634, 0x00000649, 0x00000634,
+  0x0000064A, 0x0000062D, 0x00000649, 0x0000062D, 0x0000064A, 0x0000062C, 0x00000649, 0x0000062C,
+  0x0000064A, 0x0000062E, 0x00000649, 0x0000062E, 0x0000064A, 0x00000635, 0x00000649, 0x00000635,
+  0x0000064A, 0x00000636, 0x00000649, 0x00000636, 0x0000064A, 0x00000634, 0x0000062C, 0x00000634,
+  0x0000062D, 0x00000634, 0x0000062E, 0x00000634, 0x00000645, 0x00000634, 0x00000631, 0x00000633,
+  0x00000631, 0x00000635, 0x00000631, 0x00000636, 0x00000631, 0x00000637, 0x00000649, 0x00000637,
+  0x0000064A, 0x00000639, 0x00000649, 0x00000639, 0x0000064A, 0x0000063A, 0x00000649, 0x0000063A,
+  0x0000064A, 0x00000633, 0x00000649, 0x00000633, 0x0000064A, 0x00000634, 0x00000649, 0x00000634,
+  0x0000064A, 0x0000062D, 0x00000649, 0x0000062D, 0x0000064A, 0x0000062C, 0x00000649, 0x0000062C,
+  0x0000064A, 0x0000062E, 0x00000649, 0x0000062E, 0x0000064A, 0x00000635, 0x00000649, 0x00000635,
+  0x0000064A, 0x00000636, 0x00000649, 0x00000636, 0x0000064A, 0x00000634, 0x0000062C, 0x00000634,
+  0x0000062D, 0x00000634, 0x0000062E, 0x00000634, 0x00000645, 0x00000634, 0x00000631, 0x00000633,
+  0x00000631, 0x00000635, 0x00000631, 0x00000636, 0x00000631, 0x00000634, 0x0000062C, 0x00000634,
+  0x0000062D, 0x00000634, 0x0000062E, 0x00000634, 0x00000645, 0x00000633, 0x00000647, 0x00000634,
+  0x00000647, 0x00000637, 0x00000645, 0x00000633, 0x0000062C, 0x00000633, 0x0000062D, 0x00000633,
+  0x0000062E, 0x00000634, 0x0000062C, 0x00000634, 0x0000062D, 0x00000634, 0x0000062E, 0x00000637,
+  0x00000645, 0x00000638, 0x00000645, 0x00000627, 0x1B00064B, 0x00000627, 0x1B00064B, 0x0000062A,
+  0x0000062C, 0x00000645, 0x0000062A, 0x0000062D, 0x0000062C, 0x0000062A, 0x0000062D, 0x0000062C,
+  0x0000062A, 0x0000062D, 0x00000645, 0x0000062A, 0x0000062E, 0x00000645, 0x0000062A, 0x00000645,
+  0x0000062C, 0x0000062A, 0x00000645, 0x0000062D, 0x0000062A, 0x00000645, 0x0000062E, 0x0000062C,
+  0x00000645, 0x0000062D, 0x0000062C, 0x00000645, 0x0000062D, 0x0000062D, 0x00000645, 0x0000064A,
+  0x0000062D, 0x00000645, 0x00000649, 0x00000633, 0x0000062D, 0x0000062C, 0x00000633, 0x0000062C,
+  0x0000062D, 0x00000633, 0x0000062C, 0x00000649, 0x00000633, 0x00000645, 0x0000062D, 0x00000633,
+  0x00000645, 0x0000062D, 0x00000633, 0x00000645, 0x0000062C, 0x00000633, 0x00000645, 0x00000645,
+  0x00000633, 0x00000645, 0x00000645, 0x00000635, 0x0000062D, 0x0000062D, 0x00000635, 0x0000062D,
+  0x0000062D, 0x00000635, 0x00000645, 0x00000645, 0x00000634, 0x0000062D, 0x00000645, 0x00000634,
+  0x0000062D, 0x00000645, 0x00000634, 0x0000062C, 0x0000064A, 0x00000634, 0x00000645, 0x0000062E,
+  0x00000634, 0x00000645, 0x0000062E, 0x00000634, 0x00000645, 0x00000645, 0x00000634, 0x00000645,
+  0x00000645, 0x00000636, 0x0000062D, 0x00000649, 0x00000636, 0x0000062E, 0x00000645, 0x00000636,
+  0x0000062E, 0x00000645, 0x00000637, 0x00000645, 0x0000062D, 0x00000637, 0x00000645, 0x0000062D,
+  0x00000637, 0x00000645, 0x00000645, 0x00000637, 0x00000645, 0x0000064A, 0x00000639, 0x0000062C,
+  0x00000645, 0x00000639, 0x00000645, 0x00000645, 0x00000639, 0x00000645, 0x00000645, 0x00000639,
+  0x00000645, 0x00000649, 0x0000063A, 0x00000645, 0x00000645, 0x0000063A, 0x00000645, 0x0000064A,
+  0x0000063A, 0x00000645, 0x00000649, 0x00000641, 0x0000062E, 0x00000645, 0x00000641, 0x0000062E,
+  0x00000645, 0x00000642, 0x00000645, 0x0000062D, 0x00000642, 0x00000645, 0x00000645, 0x00000644,
+  0x0000062D, 0x00000645, 0x00000644, 0x0000062D, 0x0000064A, 0x00000644, 0x0000062D, 0x00000649,
+  0x00000644, 0x0000062C, 0x0000062C, 0x00000644, 0x0000062C, 0x0000062C, 0x00000644, 0x0000062E,
+  0x00000645, 0x00000644, 0x0000062E, 0x00000645, 0x00000644, 0x00000645, 0x0000062D, 0x00000644,
+  0x00000645, 0x0000062D, 0x00000645, 0x0000062D, 0x0000062C, 0x00000645, 0x0000062D, 0x00000645,
+  0x00000645, 0x0000062D, 0x0000064A, 0x00000645, 0x0000062C, 0x0000062D, 0x00000645, 0x0000062C,
+  0x00000645, 0x00000645, 0x0000062E, 0x0000062C, 0x00000645, 0x0000062E, 0x00000645, 0x00000645,
+  0x0000062C, 0x0000062E, 0x00000647, 0x00000645, 0x0000062C, 0x00000647, 0x00000645, 0x00000645,
+  0x00000646, 0x0000062D, 0x00000645, 0x00000646, 0x0000062D, 0x00000649, 0x00000646, 0x0000062C,
+  0x00000645, 0x00000646, 0x0000062C, 0x00000645, 0x00000646, 0x0000062C, 0x00000649, 0x00000646,
+  0x00000645, 0x0000064A, 0x00000646, 0x00000645, 0x00000649, 0x0000064A, 0x00000645, 0x00000645,
+  0x0000064A, 0x00000645, 0x00000645, 0x00000628, 0x0000062E, 0x0000064A, 0x0000062A, 0x0000062C,
+  0x0000064A, 0x0000062A, 0x0000062C, 0x00000649, 0x0000062A, 0x0000062E, 0x0000064A, 0x0000062A,
+  0x0000062E, 0x00000649, 0x0000062A, 0x00000645, 0x0000064A, 0x0000062A, 0x00000645, 0x00000649,
+  0x0000062C, 0x00000645, 0x0000064A, 0x0000062C, 0x0000062D, 0x00000649, 0x0000062C, 0x00000645,
+  0x00000649, 0x00000633, 0x0000062E, 0x00000649, 0x00000635, 0x0000062D, 0x0000064A, 0x00000634,
+  0x0000062D, 0x0000064A, 0x00000636, 0x0000062D, 0x0000064A, 0x00000644, 0x0000062C, 0x0000064A,
+  0x00000644, 0x00000645, 0x0000064A, 0x0000064A, 0x0000062D, 0x0000064A, 0x0000064A, 0x0000062C,
+  0x0000064A, 0x0000064A, 0x00000645, 0x0000064A, 0x00000645, 0x00000645, 0x0000064A, 0x00000642,
+  0x00000645, 0x0000064A, 0x00000646, 0x0000062D, 0x0000064A, 0x00000642, 0x00000645, 0x0000062D,
+  0x00000644, 0x0000062D, 0x00000645, 0x00000639, 0x00000645, 0x0000064A, 0x00000643, 0x00000645,
+  0x0000064A, 0x00000646, 0x0000062C, 0x0000062D, 0x00000645, 0x0000062E, 0x0000064A, 0x00000644,
+  0x0000062C, 0x00000645, 0x00000643, 0x00000645, 0x00000645, 0x00000644, 0x0000062C, 0x00000645,
+  0x00000646, 0x0000062C, 0x0000062D, 0x0000062C, 0x0000062D, 0x0000064A, 0x0000062D, 0x0000062C,
+  0x0000064A, 0x00000645, 0x0000062C, 0x0000064A, 0x00000641, 0x00000645, 0x0000064A, 0x00000628,
+  0x0000062D, 0x0000064A, 0x00000643, 0x00000645, 0x00000645, 0x00000639, 0x0000062C, 0x00000645,
+  0x00000635, 0x00000645, 0x00000645, 0x00000633, 0x0000062E, 0x0000064A, 0x00000646, 0x0000062C,
+  0x0000064A, 0x00000635, 0x00000644, 0x000006D2, 0x00000642, 0x00000644, 0x000006D2, 0x00000627,
+  0x00000644, 0x00000644, 0x00000647, 0x00000627, 0x00000643, 0x00000628, 0x00000631, 0x00000645,
+  0x0000062D, 0x00000645, 0x0000062F, 0x00000635, 0x00000644, 0x00000639, 0x00000645, 0x00000631,
+  0x00000633, 0x00000648, 0x00000644, 0x00000639, 0x00000644, 0x0000064A, 0x00000647, 0x00000648,
+  0x00000633, 0x00000644, 0x00000645, 0x00000635, 0x00000644, 0x00000649, 0x00000635, 0x00000644,
+  0x00000649, 0x00000020, 0x00000627, 0x00000644, 0x00000644, 0x00000647, 0x00000020, 0x00000639,
+  0x00000644, 0x0000064A, 0x00000647, 0x00000020, 0x00000648, 0x00000633, 0x00000644, 0x00000645,
+  0x0000062C, 0x00000644, 0x00000020, 0x0000062C, 0x00000644, 0x00000627, 0x00000644, 0x00000647,
+  0x00000631, 0x000006CC, 0x00000627, 0x00000644, 0x0000002C, 0x00003001, 0x00003002, 0x0000003A,
+  0x0000003B, 0x00000021, 0x0000003F, 0x00003016, 0x00003017, 0x0000002E, 0x0000002E, 0x0000002E,
+  0x0000002E, 0x0000002E, 0x00002014, 0x00002013, 0x0000005F, 0x0000005F, 0x00000028, 0x00000029,
+  0x0000007B, 0x0000007D, 0x00003014, 0x00003015, 0x00003010, 0x00003011, 0x0000300A, 0x0000300B,
+  0x00003008, 0x00003009, 0x0000300C, 0x0000300D, 0x0000300E, 0x0000300F, 0x0000005B, 0x0000005D,
+  0x00000020, 0xE6000305, 0x00000020, 0xE6000305, 0x00000020, 0xE6000305, 0x00000020, 0xE6000305,
+  0x0000005F, 0x0000005F, 0x0000005F, 0x0000002C, 0x00003001, 0x0000002E, 0x0000003B, 0x0000003A,
+  0x0000003F, 0x00000021, 0x00002014, 0x00000028, 0x00000029, 0x0000007B, 0x0000007D, 0x00003014,
+  0x00003015, 0x00000023, 0x00000026, 0x0000002A, 0x0000002B, 0x0000002D, 0x0000003C, 0x0000003E,
+  0x0000003D, 0x0000005C, 0x00000024, 0x00000025, 0x00000040, 0x00000020, 0x1B00064B, 0x00000640,
+  0x1B00064B, 0x00000020, 0x1C00064C, 0x00000020, 0x1D00064D, 0x00000020, 0x1E00064E, 0x00000640,
+  0x1E00064E, 0x00000020, 0x1F00064F, 0x00000640, 0x1F00064F, 0x00000020, 0x20000650, 0x00000640,
+  0x20000650, 0x00000020, 0x21000651, 0x00000640, 0x21000651, 0x00000020, 0x22000652, 0x00000640,
+  0x22000652, 0x00000621, 0x00000627, 0xE6000653, 0x00000627, 0xE6000653, 0x00000627, 0xE6000654,
+  0x00000627, 0xE6000654, 0x00000648, 0xE6000654, 0x00000648, 0xE6000654, 0x00000627, 0xDC000655,
+  0x00000627, 0xDC000655, 0x0000064A, 0xE6000654, 0x0000064A, 0xE6000654, 0x0000064A, 0xE6000654,
+  0x0000064A, 0xE6000654, 0x00000627, 0x00000627, 0x00000628, 0x00000628, 0x00000628, 0x00000628,
+  0x00000629, 0x00000629, 0x0000062A, 0x0000062A, 0x0000062A, 0x0000062A, 0x0000062B, 0x0000062B,
+  0x0000062B, 0x0000062B, 0x0000062C, 0x0000062C, 0x0000062C, 0x0000062C, 0x0000062D, 0x0000062D,
+  0x0000062D, 0x0000062D, 0x0000062E, 0x0000062E, 0x0000062E, 0x0000062E, 0x0000062F, 0x0000062F,
+  0x00000630, 0x00000630, 0x00000631, 0x00000631, 0x00000632, 0x00000632, 0x00000633, 0x00000633,
+  0x00000633, 0x00000633, 0x00000634, 0x00000634, 0x00000634, 0x00000634, 0x00000635, 0x00000635,
+  0x00000635, 0x00000635, 0x00000636, 0x00000636, 0x00000636, 0x00000636, 0x00000637, 0x00000637,
+  0x00000637, 0x00000637, 0x00000638, 0x00000638, 0x00000638, 0x00000638, 0x00000639, 0x00000639,
+  0x00000639, 0x00000639, 0x0000063A, 0x0000063A, 0x0000063A, 0x0000063A, 0x00000641, 0x00000641,
+  0x00000641, 0x00000641, 0x00000642, 0x00000642, 0x00000642, 0x00000642, 0x00000643, 0x00000643,
+  0x00000643, 0x00000643, 0x00000644, 0x00000644, 0x00000644, 0x00000644, 0x00000645, 0x00000645,
+  0x00000645, 0x00000645, 0x00000646, 0x00000646, 0x00000646, 0x00000646, 0x00000647, 0x00000647,
+  0x00000647, 0x00000647, 0x00000648, 0x00000648, 0x00000649, 0x00000649, 0x0000064A, 0x0000064A,
+  0x0000064A, 0x0000064A, 0x00000644, 0x00000627, 0xE6000653, 0x00000644, 0x00000627, 0xE6000653,
+  0x00000644, 0x00000627, 0xE6000654, 0x00000644, 0x00000627, 0xE6000654, 0x00000644, 0x00000627,
+  0xDC000655, 0x00000644, 0x00000627, 0xDC000655, 0x00000644, 0x00000627, 0x00000644, 0x00000627,
+  0x00000021, 0x00000022, 0x00000023, 0x00000024, 0x00000025, 0x00000026, 0x00000027, 0x00000028,
+  0x00000029, 0x0000002A, 0x0000002B, 0x0000002C, 0x0000002D, 0x0000002E, 0x0000002F, 0x00000030,
+  0x00000031, 0x00000032, 0x00000033, 0x00000034, 0x00000035, 0x00000036, 0x00000037, 0x00000038,
+  0x00000039, 0x0000003A, 0x0000003B, 0x0000003C, 0x0000003D, 0x0000003E, 0x0000003F, 0x00000040,
+  0x00000041, 0x00000042, 0x00000043, 0x00000044, 0x00000045, 0x00000046, 0x00000047, 0x00000048,
+  0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F, 0x00000050,
+  0x00000051, 0x00000052, 0x00000053, 0x00000054, 0x00000055, 0x00000056, 0x00000057, 0x00000058,
+  0x00000059, 0x0000005A, 0x0000005B, 0x0000005C, 0x0000005D, 0x0000005E, 0x0000005F, 0x00000060,
+  0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00000066, 0x00000067, 0x00000068,
+  0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x0000006F, 0x00000070,
+  0x00000071, 0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00000077, 0x00000078,
+  0x00000079, 0x0000007A, 0x0000007B, 0x0000007C, 0x0000007D, 0x0000007E, 0x00002985, 0x00002986,
+  0x00003002, 0x0000300C, 0x0000300D, 0x00003001, 0x000030FB, 0x000030F2, 0x000030A1, 0x000030A3,
+  0x000030A5, 0x000030A7, 0x000030A9, 0x000030E3, 0x000030E5, 0x000030E7, 0x000030C3, 0x000030FC,
+  0x000030A2, 0x000030A4, 0x000030A6, 0x000030A8, 0x000030AA, 0x000030AB, 0x000030AD, 0x000030AF,
+  0x000030B1, 0x000030B3, 0x000030B5, 0x000030B7, 0x000030B9, 0x000030BB, 0x000030BD, 0x000030BF,
+  0x000030C1, 0x000030C4, 0x000030C6, 0x000030C8, 0x000030CA, 0x000030CB, 0x000030CC, 0x000030CD,
+  0x000030CE, 0x000030CF, 0x000030D2, 0x000030D5, 0x000030D8, 0x000030DB, 0x000030DE, 0x000030DF,
+  0x000030E0, 0x000030E1, 0x000030E2, 0x000030E4, 0x000030E6, 0x000030E8, 0x000030E9, 0x000030EA,
+  0x000030EB, 0x000030EC, 0x000030ED, 0x000030EF, 0x000030F3, 0x08003099, 0x0800309A, 0x00001160,
+  0x00001100, 0x00001101, 0x000011AA, 0x00001102, 0x000011AC, 0x000011AD, 0x00001103, 0x00001104,
+  0x00001105, 0x000011B0, 0x000011B1, 0x000011B2, 0x000011B3, 0x000011B4, 0x000011B5, 0x0000111A,
+  0x00001106, 0x00001107, 0x00001108, 0x00001121, 0x00001109, 0x0000110A, 0x0000110B, 0x0000110C,
+  0x0000110D, 0x0000110E, 0x0000110F, 0x00001110, 0x00001111, 0x00001112, 0x00001161, 0x00001162,
+  0x00001163, 0x00001164, 0x00001165, 0x00001166, 0x00001167, 0x00001168, 0x00001169, 0x0000116A,
+  0x0000116B, 0x0000116C, 0x0000116D, 0x0000116E, 0x0000116F, 0x00001170, 0x00001171, 0x00001172,
+  0x00001173, 0x00001174, 0x00001175, 0x000000A2, 0x000000A3, 0x000000AC, 0x00000020, 0xE6000304,
+  0x000000A6, 0x000000A5, 0x000020A9, 0x00002502, 0x00002190, 0x00002191, 0x00002192, 0x00002193,
+  0x000025A0, 0x000025CB, 0x00011099, 0x070110BA, 0x0001109B, 0x070110BA, 0x000110A5, 0x070110BA,
+  0x00011131, 0x00011127, 0x00011132, 0x00011127, 0x00011347, 0x0001133E, 0x00011347, 0x00011357,
+  0x000114B9, 0x000114BA, 0x000114B9, 0x000114B0, 0x000114B9, 0x000114BD, 0x000115B8, 0x000115AF,
+  0x000115B9, 0x000115AF, 0x0001D157, 0xD801D165, 0x0001D158, 0xD801D165, 0x0001D158, 0xD801D165,
+  0xD801D16E, 0x0001D158, 0xD801D165, 0xD801D16F, 0x0001D158, 0xD801D165, 0xD801D170, 0x0001D158,
+  0xD801D165, 0xD801D171, 0x0001D158, 0xD801D165, 0xD801D172, 0x0001D1B9, 0xD801D165, 0x0001D1BA,
+  0xD801D165, 0x0001D1B9, 0xD801D165, 0xD801D16E, 0x0001D1BA, 0xD801D165, 0xD801D16E, 0x0001D1B9,
+  0xD801D165, 0xD801D16F, 0x0001D1BA, 0xD801D165, 0xD801D16F, 0x00000041, 0x00000042, 0x00000043,
+  0x00000044, 0x00000045, 0x00000046, 0x00000047, 0x00000048, 0x00000049, 0x0000004A, 0x0000004B,
+  0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F, 0x00000050, 0x00000051, 0x00000052, 0x00000053,
+  0x00000054, 0x00000055, 0x00000056, 0x00000057, 0x00000058, 0x00000059, 0x0000005A, 0x00000061,
+  0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00000066, 0x00000067, 0x00000068, 0x00000069,
+  0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x0000006F, 0x00000070, 0x00000071,
+  0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00000077, 0x00000078, 0x00000079,
+  0x0000007A, 0x00000041, 0x00000042, 0x00000043, 0x00000044, 0x00000045, 0x00000046, 0x00000047,
+  0x00000048, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F,
+  0x00000050, 0x00000051, 0x00000052, 0x00000053, 0x00000054, 0x00000055, 0x00000056, 0x00000057,
+  0x00000058, 0x00000059, 0x0000005A, 0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065,
+  0x00000066, 0x00000067, 0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E,
+  0x0000006F, 0x00000070, 0x00000071, 0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076,
+  0x00000077, 0x00000078, 0x00000079, 0x0000007A, 0x00000041, 0x00000042, 0x00000043, 0x00000044,
+  0x00000045, 0x00000046, 0x00000047, 0x00000048, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C,
+  0x0000004D, 0x0000004E, 0x0000004F, 0x00000050, 0x00000051, 0x00000052, 0x00000053, 0x00000054,
+  0x00000055, 0x00000056, 0x00000057, 0x00000058, 0x00000059, 0x0000005A, 0x00000061, 0x00000062,
+  0x00000063, 0x00000064, 0x00000065, 0x00000066, 0x00000067, 0x00000068, 0x00000069, 0x0000006A,
+  0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x0000006F, 0x00000070, 0x00000071, 0x00000072,
+  0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00000077, 0x00000078, 0x00000079, 0x0000007A,
+  0x00000041, 0x00000043, 0x00000044, 0x00000047, 0x0000004A, 0x0000004B, 0x0000004E, 0x0000004F,
+  0x00000050, 0x00000051, 0x00000053, 0x00000054, 0x00000055, 0x00000056, 0x00000057, 0x00000058,
+  0x00000059, 0x0000005A, 0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000066, 0x00000068,
+  0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x00000070, 0x00000071,
+  0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00000077, 0x00000078, 0x00000079,
+  0x0000007A, 0x00000041, 0x00000042, 0x00000043, 0x00000044, 0x00000045, 0x00000046, 0x00000047,
+  0x00000048, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F,
+  0x00000050, 0x00000051, 0x00000052, 0x00000053, 0x00000054, 0x00000055, 0x00000056, 0x00000057,
+  0x00000058, 0x00000059, 0x0000005A, 0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065,
+  0x00000066, 0x00000067, 0x00000068, 0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D,
+  0x0000006E, 0x0000006F, 0x00000070, 0x00000071, 0x00000072, 0x00000073, 0x00000074, 0x00000075,
+  0x00000076, 0x00000077, 0x00000078, 0x00000079, 0x0000007A, 0x00000041, 0x00000042, 0x00000044,
+  0x00000045, 0x00000046, 0x00000047, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E,
+  0x0000004F, 0x00000050, 0x00000051, 0x00000053, 0x00000054, 0x00000055, 0x00000056, 0x00000057,
+  0x00000058, 0x00000059, 0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00000066,
+  0x00000067, 0x00000068, 0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E,
+  0x0000006F, 0x00000070, 0x00000071, 0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076,
+  0x00000077, 0x00000078, 0x00000079, 0x0000007A, 0x00000041, 0x00000042, 0x00000044, 0x00000045,
+  0x00000046, 0x00000047, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004F,
+  0x00000053, 0x00000054, 0x00000055, 0x00000056, 0x00000057, 0x00000058, 0x00000059, 0x00000061,
+  0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00000066, 0x00000067, 0x00000068, 0x00000069,
+  0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x0000006F, 0x00000070, 0x00000071,
+  0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00000077, 0x00000078, 0x00000079,
+  0x0000007A, 0x00000041, 0x00000042, 0x00000043, 0x00000044, 0x00000045, 0x00000046, 0x00000047,
+  0x00000048, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F,
+  0x00000050, 0x00000051, 0x00000052, 0x00000053, 0x00000054, 0x00000055, 0x00000056, 0x00000057,
+  0x00000058, 0x00000059, 0x0000005A, 0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065,
+  0x00000066, 0x00000067, 0x00000068, 0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D,
+  0x0000006E, 0x0000006F, 0x00000070, 0x00000071, 0x00000072, 0x00000073, 0x00000074, 0x00000075,
+  0x00000076, 0x00000077, 0x00000078, 0x00000079, 0x0000007A, 0x00000041, 0x00000042, 0x00000043,
+  0x00000044, 0x00000045, 0x00000046, 0x00000047, 0x00000048, 0x00000049, 0x0000004A, 0x0000004B,
+  0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F, 0x00000050, 0x00000051, 0x00000052, 0x00000053,
+  0x00000054, 0x00000055, 0x00000056, 0x00000057, 0x00000058, 0x00000059, 0x0000005A, 0x00000061,
+  0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00000066, 0x00000067, 0x00000068, 0x00000069,
+  0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x0000006F, 0x00000070, 0x00000071,
+  0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00000077, 0x00000078, 0x00000079,
+  0x0000007A, 0x00000041, 0x00000042, 0x00000043, 0x00000044, 0x00000045, 0x00000046, 0x00000047,
+  0x00000048, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F,
+  0x00000050, 0x00000051, 0x00000052, 0x00000053, 0x00000054, 0x00000055, 0x00000056, 0x00000057,
+  0x00000058, 0x00000059, 0x0000005A, 0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065,
+  0x00000066, 0x00000067, 0x00000068, 0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D,
+  0x0000006E, 0x0000006F, 0x00000070, 0x00000071, 0x00000072, 0x00000073, 0x00000074, 0x00000075,
+  0x00000076, 0x00000077, 0x00000078, 0x00000079, 0x0000007A, 0x00000041, 0x00000042, 0x00000043,
+  0x00000044, 0x00000045, 0x00000046, 0x00000047, 0x00000048, 0x00000049, 0x0000004A, 0x0000004B,
+  0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F, 0x00000050, 0x00000051, 0x00000052, 0x00000053,
+  0x00000054, 0x00000055, 0x00000056, 0x00000057, 0x00000058, 0x00000059, 0x0000005A, 0x00000061,
+  0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00000066, 0x00000067, 0x00000068, 0x00000069,
+  0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x0000006F, 0x00000070, 0x00000071,
+  0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00000077, 0x00000078, 0x00000079,
+  0x0000007A, 0x00000041, 0x00000042, 0x00000043, 0x00000044, 0x00000045, 0x00000046, 0x00000047,
+  0x00000048, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F,
+  0x00000050, 0x00000051, 0x00000052, 0x00000053, 0x00000054, 0x00000055, 0x00000056, 0x00000057,
+  0x00000058, 0x00000059, 0x0000005A, 0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065,
+  0x00000066, 0x00000067, 0x00000068, 0x00000069, 0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D,
+  0x0000006E, 0x0000006F, 0x00000070, 0x00000071, 0x00000072, 0x00000073, 0x00000074, 0x00000075,
+  0x00000076, 0x00000077, 0x00000078, 0x00000079, 0x0000007A, 0x00000041, 0x00000042, 0x00000043,
+  0x00000044, 0x00000045, 0x00000046, 0x00000047, 0x00000048, 0x00000049, 0x0000004A, 0x0000004B,
+  0x0000004C, 0x0000004D, 0x0000004E, 0x0000004F, 0x00000050, 0x00000051, 0x00000052, 0x00000053,
+  0x00000054, 0x00000055, 0x00000056, 0x00000057, 0x00000058, 0x00000059, 0x0000005A, 0x00000061,
+  0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00000066, 0x00000067, 0x00000068, 0x00000069,
+  0x0000006A, 0x0000006B, 0x0000006C, 0x0000006D, 0x0000006E, 0x0000006F, 0x00000070, 0x00000071,
+  0x00000072, 0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00000077, 0x00000078, 0x00000079,
+  0x0000007A, 0x00000131, 0x00000237, 0x00000391, 0x00000392, 0x00000393, 0x00000394, 0x00000395,
+  0x00000396, 0x00000397, 0x00000398, 0x00000399, 0x0000039A, 0x0000039B, 0x0000039C, 0x0000039D,
+  0x0000039E, 0x0000039F, 0x000003A0, 0x000003A1, 0x00000398, 0x000003A3, 0x000003A4, 0x000003A5,
+  0x000003A6, 0x000003A7, 0x000003A8, 0x000003A9, 0x00002207, 0x000003B1, 0x000003B2, 0x000003B3,
+  0x000003B4, 0x000003B5, 0x000003B6, 0x000003B7, 0x000003B8, 0x000003B9, 0x000003BA, 0x000003BB,
+  0x000003BC, 0x000003BD, 0x000003BE, 0x000003BF, 0x000003C0, 0x000003C1, 0x000003C2, 0x000003C3,
+  0x000003C4, 0x000003C5, 0x000003C6, 0x000003C7, 0x000003C8, 0x000003C9, 0x00002202, 0x000003B5,
+  0x000003B8, 0x000003BA, 0x000003C6, 0x000003C1, 0x000003C0, 0x00000391, 0x00000392, 0x00000393,
+  0x00000394, 0x00000395, 0x00000396, 0x00000397, 0x00000398, 0x00000399, 0x0000039A, 0x0000039B,
+  0x0000039C, 0x0000039D, 0x0000039E, 0x0000039F, 0x000003A0, 0x000003A1, 0x00000398, 0x000003A3,
+  0x000003A4, 0x000003A5, 0x000003A6, 0x000003A7, 0x000003A8, 0x000003A9, 0x00002207, 0x000003B1,
+  0x000003B2, 0x000003B3, 0x000003B4, 0x000003B5, 0x000003B6, 0x000003B7, 0x000003B8, 0x000003B9,
+  0x000003BA, 0x000003BB, 0x000003BC, 0x000003BD, 0x000003BE, 0x000003BF, 0x000003C0, 0x000003C1,
+  0x000003C2, 0x000003C3, 0x000003C4, 0x000003C5, 0x000003C6, 0x000003C7, 0x000003C8, 0x000003C9,
+  0x00002202, 0x000003B5, 0x000003B8, 0x000003BA, 0x000003C6, 0x000003C1, 0x000003C0, 0x00000391,
+  0x00000392, 0x00000393, 0x00000394, 0x00000395, 0x00000396, 0x00000397, 0x00000398, 0x00000399,
+  0x0000039A, 0x0000039B, 0x0000039C, 0x0000039D, 0x0000039E, 0x0000039F, 0x000003A0, 0x000003A1,
+  0x00000398, 0x000003A3, 0x000003A4, 0x000003A5, 0x000003A6, 0x000003A7, 0x000003A8, 0x000003A9,
+  0x00002207, 0x000003B1, 0x000003B2, 0x000003B3, 0x000003B4, 0x000003B5, 0x000003B6, 0x000003B7,
+  0x000003B8, 0x000003B9, 0x000003BA, 0x000003BB, 0x000003BC, 0x000003BD, 0x000003BE, 0x000003BF,
+  0x000003C0, 0x000003C1, 0x000003C2, 0x000003C3, 0x000003C4, 0x000003C5, 0x000003C6, 0x000003C7,
+  0x000003C8, 0x000003C9, 0x00002202, 0x000003B5, 0x000003B8, 0x000003BA, 0x000003C6, 0x000003C1,
+  0x000003C0, 0x00000391, 0x00000392, 0x00000393, 0x00000394, 0x00000395, 0x00000396, 0x00000397,
+  0x00000398, 0x00000399, 0x0000039A, 0x0000039B, 0x0000039C, 0x0000039D, 0x0000039E, 0x0000039F,
+  0x000003A0, 0x000003A1, 0x00000398, 0x000003A3, 0x000003A4, 0x000003A5, 0x000003A6, 0x000003A7,
+  0x000003A8, 0x000003A9, 0x00002207, 0x000003B1, 0x000003B2, 0x000003B3, 0x000003B4, 0x000003B5,
+  0x000003B6, 0x000003B7, 0x000003B8, 0x000003B9, 0x000003BA, 0x000003BB, 0x000003BC, 0x000003BD,
+  0x000003BE, 0x000003BF, 0x000003C0, 0x000003C1, 0x000003C2, 0x000003C3, 0x000003C4, 0x000003C5,
+  0x000003C6, 0x000003C7, 0x000003C8, 0x000003C9, 0x00002202, 0x000003B5, 0x000003B8, 0x000003BA,
+  0x000003C6, 0x000003C1, 0x000003C0, 0x00000391, 0x00000392, 0x00000393, 0x00000394, 0x00000395,
+  0x00000396, 0x00000397, 0x00000398, 0x00000399, 0x0000039A, 0x0000039B, 0x0000039C, 0x0000039D,
+  0x0000039E, 0x0000039F, 0x000003A0, 0x000003A1, 0x00000398, 0x000003A3, 0x000003A4, 0x000003A5,
+  0x000003A6, 0x000003A7, 0x000003A8, 0x000003A9, 0x00002207, 0x000003B1, 0x000003B2, 0x000003B3,
+  0x000003B4, 0x000003B5, 0x000003B6, 0x000003B7, 0x000003B8, 0x000003B9, 0x000003BA, 0x000003BB,
+  0x000003BC, 0x000003BD, 0x000003BE, 0x000003BF, 0x000003C0, 0x000003C1, 0x000003C2, 0x000003C3,
+  0x000003C4, 0x000003C5, 0x000003C6, 0x000003C7, 0x000003C8, 0x000003C9, 0x00002202, 0x000003B5,
+  0x000003B8, 0x000003BA, 0x000003C6, 0x000003C1, 0x000003C0, 0x000003DC, 0x000003DD, 0x00000030,
+  0x00000031, 0x00000032, 0x00000033, 0x00000034, 0x00000035, 0x00000036, 0x00000037, 0x00000038,
+  0x00000039, 0x00000030, 0x00000031, 0x00000032, 0x00000033, 0x00000034, 0x00000035, 0x00000036,
+  0x00000037, 0x00000038, 0x00000039, 0x00000030, 0x00000031, 0x00000032, 0x00000033, 0x00000034,
+  0x00000035, 0x00000036, 0x00000037, 0x00000038, 0x00000039, 0x00000030, 0x00000031, 0x00000032,
+  0x00000033, 0x00000034, 0x00000035, 0x00000036, 0x00000037, 0x00000038, 0x00000039, 0x00000030,
+  0x00000031, 0x00000032, 0x00000033, 0x00000034, 0x00000035, 0x00000036, 0x00000037, 0x00000038,
+  0x00000039, 0x00000627, 0x00000628, 0x0000062C, 0x0000062F, 0x00000648, 0x00000632, 0x0000062D,
+  0x00000637, 0x0000064A, 0x00000643, 0x00000644, 0x00000645, 0x00000646, 0x00000633, 0x00000639,
+  0x00000641, 0x00000635, 0x00000642, 0x00000631, 0x00000634, 0x0000062A, 0x0000062B, 0x0000062E,
+  0x00000630, 0x00000636, 0x00000638, 0x0000063A, 0x0000066E, 0x000006BA, 0x000006A1, 0x0000066F,
+  0x00000628, 0x0000062C, 0x00000647, 0x0000062D, 0x0000064A, 0x00000643, 0x00000644, 0x00000645,
+  0x00000646, 0x00000633, 0x00000639, 0x00000641, 0x00000635, 0x00000642, 0x00000634, 0x0000062A,
+  0x0000062B, 0x0000062E, 0x00000636, 0x0000063A, 0x0000062C, 0x0000062D, 0x0000064A, 0x00000644,
+  0x00000646, 0x00000633, 0x00000639, 0x00000635, 0x00000642, 0x00000634, 0x0000062E, 0x00000636,
+  0x0000063A, 0x000006BA, 0x0000066F, 0x00000628, 0x0000062C, 0x00000647, 0x0000062D, 0x00000637,
+  0x0000064A, 0x00000643, 0x00000645, 0x00000646, 0x00000633, 0x00000639, 0x00000641, 0x00000635,
+  0x00000642, 0x00000634, 0x0000062A, 0x0000062B, 0x0000062E, 0x00000636, 0x00000638, 0x0000063A,
+  0x0000066E, 0x000006A1, 0x00000627, 0x00000628, 0x0000062C, 0x0000062F, 0x00000647, 0x00000648,
+  0x00000632, 0x0000062D, 0x00000637, 0x0000064A, 0x00000644, 0x00000645, 0x00000646, 0x00000633,
+  0x00000639, 0x00000641, 0x00000635, 0x00000642, 0x00000631, 0x00000634, 0x0000062A, 0x0000062B,
+  0x0000062E, 0x00000630, 0x00000636, 0x00000638, 0x0000063A, 0x00000628, 0x0000062C, 0x0000062F,
+  0x00000648, 0x00000632, 0x0000062D, 0x00000637, 0x0000064A, 0x00000644, 0x00000645, 0x00000646,
+  0x00000633, 0x00000639, 0x00000641, 0x00000635, 0x00000642, 0x00000631, 0x00000634, 0x0000062A,
+  0x0000062B, 0x0000062E, 0x00000630, 0x00000636, 0x00000638, 0x0000063A, 0x00000030, 0x0000002E,
+  0x00000030, 0x0000002C, 0x00000031, 0x0000002C, 0x00000032, 0x0000002C, 0x00000033, 0x0000002C,
+  0x00000034, 0x0000002C, 0x00000035, 0x0000002C, 0x00000036, 0x0000002C, 0x00000037, 0x0000002C,
+  0x00000038, 0x0000002C, 0x00000039, 0x0000002C, 0x00000028, 0x00000041, 0x00000029, 0x00000028,
+  0x00000042, 0x00000029, 0x00000028, 0x00000043, 0x00000029, 0x00000028, 0x00000044, 0x00000029,
+  0x00000028, 0x00000045, 0x00000029, 0x00000028, 0x00000046, 0x00000029, 0x00000028, 0x00000047,
+  0x00000029, 0x00000028, 0x00000048, 0x00000029, 0x00000028, 0x00000049, 0x00000029, 0x00000028,
+  0x0000004A, 0x00000029, 0x00000028, 0x0000004B, 0x00000029, 0x00000028, 0x0000004C, 0x00000029,
+  0x00000028, 0x0000004D, 0x00000029, 0x00000028, 0x0000004E, 0x00000029, 0x00000028, 0x0000004F,
+  0x00000029, 0x00000028, 0x00000050, 0x00000029, 0x00000028, 0x00000051, 0x00000029, 0x00000028,
+  0x00000052, 0x00000029, 0x00000028, 0x00000053, 0x00000029, 0x00000028, 0x00000054, 0x00000029,
+  0x00000028, 0x00000055, 0x00000029, 0x00000028, 0x00000056, 0x00000029, 0x00000028, 0x00000057,
+  0x00000029, 0x00000028, 0x00000058, 0x00000029, 0x00000028, 0x00000059, 0x00000029, 0x00000028,
+  0x0000005A, 0x00000029, 0x00003014, 0x00000053, 0x00003015, 0x00000043, 0x00000052, 0x00000043,
+  0x00000044, 0x00000057, 0x0000005A, 0x00000041, 0x00000042, 0x00000043, 0x00000044, 0x00000045,
+  0x00000046, 0x00000047, 0x00000048, 0x00000049, 0x0000004A, 0x0000004B, 0x0000004C, 0x0000004D,
+  0x0000004E, 0x0000004F, 0x00000050, 0x00000051, 0x00000052, 0x00000053, 0x00000054, 0x00000055,
+  0x00000056, 0x00000057, 0x00000058, 0x00000059, 0x0000005A, 0x00000048, 0x00000056, 0x0000004D,
+  0x00000056, 0x00000053, 0x00000044, 0x00000053, 0x00000053, 0x00000050, 0x00000050, 0x00000056,
+  0x00000057, 0x00000043, 0x0000004D, 0x00000043, 0x0000004D, 0x00000044, 0x0000004D, 0x00000052,
+  0x00000044, 0x0000004A, 0x0000307B, 0x0000304B, 0x000030B3, 0x000030B3, 0x000030B5, 0x0000624B,
+  0x00005B57, 0x000053CC, 0x000030C6, 0x08003099, 0x00004E8C, 0x0000591A, 0x000089E3, 0x00005929,
+  0x00004EA4, 0x00006620, 0x00007121, 0x00006599, 0x0000524D, 0x00005F8C, 0x0000518D, 0x000065B0,
+  0x0000521D, 0x00007D42, 0x0000751F, 0x00008CA9, 0x000058F0, 0x00005439, 0x00006F14, 0x00006295,
+  0x00006355, 0x00004E00, 0x00004E09, 0x0000904A, 0x00005DE6, 0x00004E2D, 0x000053F3, 0x00006307,
+  0x00008D70, 0x00006253, 0x00007981, 0x00007A7A, 0x00005408, 0x00006E80, 0x00006709, 0x00006708,
+  0x00007533, 0x00005272, 0x000055B6, 0x0000914D, 0x00003014, 0x0000672C, 0x00003015, 0x00003014,
+  0x00004E09, 0x00003015, 0x00003014, 0x00004E8C, 0x00003015, 0x00003014, 0x00005B89, 0x00003015,
+  0x00003014, 0x000070B9, 0x00003015, 0x00003014, 0x00006253, 0x00003015, 0x00003014, 0x000076D7,
+  0x00003015, 0x00003014, 0x000052DD, 0x00003015, 0x00003014, 0x00006557, 0x00003015, 0x00005F97,
+  0x000053EF, 0x00004E3D, 0x00004E38, 0x00004E41, 0x00020122, 0x00004F60, 0x00004FAE, 0x00004FBB,
+  0x00005002, 0x0000507A, 0x00005099, 0x000050E7, 0x000050CF, 0x0000349E, 0x0002063A, 0x0000514D,
+  0x00005154, 0x00005164, 0x00005177, 0x0002051C, 0x000034B9, 0x00005167, 0x0000518D, 0x0002054B,
+  0x00005197, 0x000051A4, 0x00004ECC, 0x000051AC, 0x000051B5, 0x000291DF, 0x000051F5, 0x00005203,
+  0x000034DF, 0x0000523B, 0x00005246, 0x00005272, 0x00005277, 0x00003515, 0x000052C7, 0x000052C9,
+  0x000052E4, 0x000052FA, 0x00005305, 0x00005306, 0x00005317, 0x00005349, 0x00005351, 0x0000535A,
+  0x00005373, 0x0000537D, 0x0000537F, 0x0000537F, 0x0000537F, 0x00020A2C, 0x00007070, 0x000053CA,
+  0x000053DF, 0x00020B63, 0x000053EB, 0x000053F1, 0x00005406, 0x0000549E, 0x00005438, 0x00005448,
+  0x00005468, 0x000054A2, 0x000054F6, 0x00005510, 0x00005553, 0x00005563, 0x00005584, 0x00005584,
+  0x00005599, 0x000055AB, 0x000055B3, 0x000055C2, 0x00005716, 0x00005606, 0x00005717, 0x00005651,
+  0x00005674, 0x00005207, 0x000058EE, 0x000057CE, 0x000057F4, 0x0000580D, 0x0000578B, 0x00005832,
+  0x00005831, 0x000058AC, 0x000214E4, 0x000058F2, 0x000058F7, 0x00005906, 0x0000591A, 0x00005922,
+  0x00005962, 0x000216A8, 0x000216EA, 0x000059EC, 0x00005A1B, 0x00005A27, 0x000059D8, 0x00005A66,
+  0x000036EE, 0x000036FC, 0x00005B08, 0x00005B3E, 0x00005B3E, 0x000219C8, 0x00005BC3, 0x00005BD8,
+  0x00005BE7, 0x00005BF3, 0x00021B18, 0x00005BFF, 0x00005C06, 0x00005F53, 0x00005C22, 0x00003781,
+  0x00005C60, 0x00005C6E, 0x00005CC0, 0x00005C8D, 0x00021DE4, 0x00005D43, 0x00021DE6, 0x00005D6E,
+  0x00005D6B, 0x00005D7C, 0x00005DE1, 0x00005DE2, 0x0000382F, 0x00005DFD, 0x00005E28, 0x00005E3D,
+  0x00005E69, 0x00003862, 0x00022183, 0x0000387C, 0x00005EB0, 0x00005EB3, 0x00005EB6, 0x00005ECA,
+  0x0002A392, 0x00005EFE, 0x00022331, 0x00022331, 0x00008201, 0x00005F22, 0x00005F22, 0x000038C7,
+  0x000232B8, 0x000261DA, 0x00005F62, 0x00005F6B, 0x000038E3, 0x00005F9A, 0x00005FCD, 0x00005FD7,
+  0x00005FF9, 0x00006081, 0x0000393A, 0x0000391C, 0x00006094, 0x000226D4, 0x000060C7, 0x00006148,
+  0x0000614C, 0x0000614E, 0x0000614C, 0x0000617A, 0x0000618E, 0x000061B2, 0x000061A4, 0x000061AF,
+  0x000061DE, 0x000061F2, 0x000061F6, 0x00006210, 0x0000621B, 0x0000625D, 0x000062B1, 0x000062D4,
+  0x00006350, 0x00022B0C, 0x0000633D, 0x000062FC, 0x00006368, 0x00006383, 0x000063E4, 0x00022BF1,
+  0x00006422, 0x000063C5, 0x000063A9, 0x00003A2E, 0x00006469, 0x0000647E, 0x0000649D, 0x00006477,
+  0x00003A6C, 0x0000654F, 0x0000656C, 0x0002300A, 0x000065E3, 0x000066F8, 0x00006649, 0x00003B19,
+  0x00006691, 0x00003B08, 0x00003AE4, 0x00005192, 0x00005195, 0x00006700, 0x0000669C, 0x000080AD,
+  0x000043D9, 0x00006717, 0x0000671B, 0x00006721, 0x0000675E, 0x00006753, 0x000233C3, 0x00003B49,
+  0x000067FA, 0x00006785, 0x00006852, 0x00006885, 0x0002346D, 0x0000688E, 0x0000681F, 0x00006914,
+  0x00003B9D, 0x00006942, 0x000069A3, 0x000069EA, 0x00006AA8, 0x000236A3, 0x00006ADB, 0x00003C18,
+  0x00006B21, 0x000238A7, 0x00006B54, 0x00003C4E, 0x00006B72, 0x00006B9F, 0x00006BBA, 0x00006BBB,
+  0x00023A8D, 0x00021D0B, 0x00023AFA, 0x00006C4E, 0x00023CBC, 0x00006CBF, 0x00006CCD, 0x00006C67,
+  0x00006D16, 0x00006D3E, 0x00006D77, 0x00006D41, 0x00006D69, 0x00006D78, 0x00006D85, 0x00023D1E,
+  0x00006D34, 0x00006E2F, 0x00006E6E, 0x00003D33, 0x00006ECB, 0x00006EC7, 0x00023ED1, 0x00006DF9,
+  0x00006F6E, 0x00023F5E, 0x00023F8E, 0x00006FC6, 0x00007039, 0x0000701E, 0x0000701B, 0x00003D96,
+  0x0000704A, 0x0000707D, 0x00007077, 0x000070AD, 0x00020525, 0x00007145, 0x00024263, 0x0000719C,
+  0x000243AB, 0x00007228, 0x00007235, 0x00007250, 0x00024608, 0x00007280, 0x00007295, 0x00024735,
+  0x00024814, 0x0000737A, 0x0000738B, 0x00003EAC, 0x000073A5, 0x00003EB8, 0x00003EB8, 0x00007447,
+  0x0000745C, 0x00007471, 0x00007485, 0x000074CA, 0x00003F1B, 0x00007524, 0x00024C36, 0x0000753E,
+  0x00024C92, 0x00007570, 0x0002219F, 0x00007610, 0x00024FA1, 0x00024FB8, 0x00025044, 0x00003FFC,
+  0x00004008, 0x000076F4, 0x000250F3, 0x000250F2, 0x00025119, 0x00025133, 0x0000771E, 0x0000771F,
+  0x0000771F, 0x0000774A, 0x00004039, 0x0000778B, 0x00004046, 0x00004096, 0x0002541D, 0x0000784E,
+  0x0000788C, 0x000078CC, 0x000040E3, 0x00025626, 0x00007956, 0x0002569A, 0x000256C5, 0x0000798F,
+  0x000079EB, 0x0000412F, 0x00007A40, 0x00007A4A, 0x00007A4F, 0x0002597C, 0x00025AA7, 0x00025AA7,
+  0x00007AEE, 0x00004202, 0x00025BAB, 0x00007BC6, 0x00007BC9, 0x00004227, 0x00025C80, 0x00007CD2,
+  0x000042A0, 0x00007CE8, 0x00007CE3, 0x00007D00, 0x00025F86, 0x00007D63, 0x00004301, 0x00007DC7,
+  0x00007E02, 0x00007E45, 0x00004334, 0x00026228, 0x00026247, 0x00004359, 0x000262D9, 0x00007F7A,
+  0x0002633E, 0x00007F95, 0x00007FFA, 0x00008005, 0x000264DA, 0x00026523, 0x00008060, 0x000265A8,
+  0x00008070, 0x0002335F, 0x000043D5, 0x000080B2, 0x00008103, 0x0000440B, 0x0000813E, 0x00005AB5,
+  0x000267A7, 0x000267B5, 0x00023393, 0x0002339C, 0x00008201, 0x00008204, 0x00008F9E, 0x0000446B,
+  0x00008291, 0x0000828B, 0x0000829D, 0x000052B3, 0x000082B1, 0x000082B3, 0x000082BD, 0x000082E6,
+  0x00026B3C, 0x000082E5, 0x0000831D, 0x00008363, 0x000083AD, 0x00008323, 0x000083BD, 0x000083E7,
+  0x00008457, 0x00008353, 0x000083CA, 0x000083CC, 0x000083DC, 0x00026C36, 0x00026D6B, 0x00026CD5,
+  0x0000452B, 0x000084F1, 0x000084F3, 0x00008516, 0x000273CA, 0x00008564, 0x00026F2C, 0x0000455D,
+  0x00004561, 0x00026FB1, 0x000270D2, 0x0000456B, 0x00008650, 0x0000865C, 0x00008667, 0x00008669,
+  0x000086A9, 0x00008688, 0x0000870E, 0x000086E2, 0x00008779, 0x00008728, 0x0000876B, 0x00008786,
+  0x000045D7, 0x000087E1, 0x00008801, 0x000045F9, 0x00008860, 0x00008863, 0x00027667, 0x000088D7,
+  0x000088DE, 0x00004635, 0x000088FA, 0x000034BB, 0x000278AE, 0x00027966, 0x000046BE, 0x000046C7,
+  0x00008AA0, 0x00008AED, 0x00008B8A, 0x00008C55, 0x00027CA8, 0x00008CAB, 0x00008CC1, 0x00008D1B,
+  0x00008D77, 0x00027F2F, 0x00020804, 0x00008DCB, 0x00008DBC, 0x00008DF0, 0x000208DE, 0x00008ED4,
+  0x00008F38, 0x000285D2, 0x000285ED, 0x00009094, 0x000090F1, 0x00009111, 0x0002872E, 0x0000911B,
+  0x00009238, 0x000092D7, 0x000092D8, 0x0000927C, 0x000093F9, 0x00009415, 0x00028BFA, 0x0000958B,
+  0x00004995, 0x000095B7, 0x00028D77, 0x000049E6, 0x000096C3, 0x00005DB2, 0x00009723, 0x00029145,
+  0x0002921A, 0x00004A6E, 0x00004A76, 0x000097E0, 0x0002940A, 0x00004AB2, 0x00029496, 0x0000980B,
+  0x0000980B, 0x00009829, 0x000295B6, 0x000098E2, 0x00004B33, 0x00009929, 0x000099A7, 0x000099C2,
+  0x000099FE, 0x00004BCE, 0x00029B30, 0x00009B12, 0x00009C40, 0x00009CFD, 0x00004CCE, 0x00004CED,
+  0x00009D67, 0x0002A0CE, 0x00004CF8, 0x0002A105, 0x0002A20E, 0x0002A291, 0x00009EBB, 0x00004D56,
+  0x00009EF9, 0x00009EFE, 0x00009F05, 0x00009F0F, 0x00009F16, 0x00009F3B, 0x0002A600,
+};
+
+static constexpr unsigned int DECOMPOSITION_BLOCK_SHIFT = 7;
+static constexpr uint32_t DECOMPOSITION_BLOCK_MASK = (1 << DECOMPOSITION_BLOCK_SHIFT) - 1;
+
+static constexpr uint16_t decomposition_block_numbers[] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 12, 0, 0,
+  0, 0, 13, 14, 15, 0, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+  26, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 29, 30, 31, 32, 33, 34,
+  35, 36, 37, 38, 39, 40, 41, 0, 42, 43, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 44, 45, 0, 0, 46, 0, 47, 0, 0, 48, 49, 50,
+  51, 52, 53, 54, 55, 56, 57, 58, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 60, 61,
+  0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 77, 78, 0, 0, 0, 79, 0, 0, 80, 0, 81, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 82, 83, 0, 0, 0, 0, 84, 85, 86, 87, 88, 89, 90, 91,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 93, 0, 0,
+  0, 0, 94, 95, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  97, 98, 99, 100, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static constexpr uint32_t decomposition_block_values[] = {
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0xc40, 0x0, 0x1c20, 0x0, 0x0, 0x0, 0x0, 0x2440,
+  0x0, 0x0, 0x3420, 0x3c20, 0x4440, 0x5420, 0x0, 0x0,
+  0x5c40, 0x6c20, 0x7420, 0x0, 0x7c60, 0x9460, 0xac60, 0x0,
+  0xc042, 0xd042, 0xe042, 0xf042, 0x10042, 0x11042, 0x0, 0x12042,
+  0x13042, 0x14042, 0x15042, 0x16042, 0x17042, 0x18042, 0x19042, 0x1a042,
+  0x0, 0x1b042, 0x1c042, 0x1d042, 0x1e042, 0x1f042, 0x20042, 0x0,
+  0x0, 0x21042, 0x22042, 0x23042, 0x24042, 0x25042, 0x0, 0x0,
+  0x26042, 0x27042, 0x28042, 0x29042, 0x2a042, 0x2b042, 0x0, 0x2c042,
+  0x2d042, 0x2e042, 0x2f042, 0x30042, 0x31042, 0x32042, 0x33042, 0x34042,
+  0x0, 0x35042, 0x36042, 0x37042, 0x38042, 0x39042, 0x3a042, 0x0,
+  0x0, 0x3b042, 0x3c042, 0x3d042, 0x3e042, 0x3f042, 0x0, 0x40042,
+  0x41042, 0x42042, 0x43042, 0x44042, 0x45042, 0x46042, 0x47042, 0x48042,
+  0x49042, 0x4a042, 0x4b042, 0x4c042, 0x4d042, 0x4e042, 0x4f042, 0x50042,
+  0x0, 0x0, 0x51042, 0x52042, 0x53042, 0x54042, 0x55042, 0x56042,
+  0x57042, 0x58042, 0x59042, 0x5a042, 0x5b042, 0x5c042, 0x5d042, 0x5e042,
+  0x5f042, 0x60042, 0x61042, 0x62042, 0x63042, 0x64042, 0x0, 0x0,
+  0x65042, 0x66042, 0x67042, 0x68042, 0x69042, 0x6a042, 0x6b042, 0x6c042,
+  0x6d042, 0x0, 0x6e440, 0x6f440, 0x70042, 0x71042, 0x72042, 0x73042,
+  0x0, 0x74042, 0x75042, 0x76042, 0x77042, 0x78042, 0x79042, 0x7a440,
+  0x7b440, 0x0, 0x0, 0x7c042, 0x7d042, 0x7e042, 0x7f042, 0x80042,
+  0x81042, 0x82440, 0x0, 0x0, 0x83042, 0x84042, 0x85042, 0x86042,
+  0x87042, 0x88042, 0x0, 0x0, 0x89042, 0x8a042, 0x8b042, 0x8c042,
+  0x8d042, 0x8e042, 0x8f042, 0x90042, 0x91042, 0x92042, 0x93042, 0x94042,
+  0x95042, 0x96042, 0x97042, 0x98042, 0x99042, 0x9a042, 0x0, 0x0,
+  0x9b042, 0x9c042, 0x9d042, 0x9e042, 0x9f042, 0xa0042, 0xa1042, 0xa2042,
+  0xa3042, 0xa4042, 0xa5042, 0xa6042, 0xa7042, 0xa8042, 0xa9042, 0xaa042,
+  0xab042, 0xac042, 0xad042, 0xae042, 0xaf042, 0xb0042, 0xb1042, 0xb2420,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0xb2842, 0xb3842, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb4842,
+  0xb5842, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0xb6c60, 0xb8460, 0xb9c60, 0xbb440,
+  0xbc440, 0xbd440, 0xbe440, 0xbf440, 0xc0440, 0xc1042, 0xc2042, 0xc3042,
+  0xc4042, 0xc5042, 0xc6042, 0xc7042, 0xc8042, 0xc9063, 0xca863, 0xcc063,
+  0xcd863, 0xcf063, 0xd0863, 0xd2063, 0xd3863, 0x0, 0xd5063, 0xd6863,
+  0xd8063, 0xd9863, 0xdb042, 0xdc042, 0x0, 0x0, 0xdd042, 0xde042,
+  0xdf042, 0xe0042, 0xe1042, 0xe2042, 0xe3063, 0xe4863, 0xe6042, 0xe7042,
+  0xe8042, 0xe9440, 0xea440, 0xeb440, 0xec042, 0xed042, 0x0, 0x0,
+  0xee042, 0xef042, 0xf0063, 0xf1863, 0xf3042, 0xf4042, 0xf5042, 0xf6042,
+  0xf7042, 0xf8042, 0xf9042, 0xfa042, 0xfb042, 0xfc042, 0xfd042, 0xfe042,
+  0xff042, 0x100042, 0x101042, 0x102042, 0x103042, 0x104042, 0x105042, 0x106042,
+  0x107042, 0x108042, 0x109042, 0x10a042, 0x10b042, 0x10c042, 0x10d042, 0x10e042,
+  0x10f042, 0x110042, 0x111042, 0x112042, 0x0, 0x0, 0x113042, 0x114042,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x115042, 0x116042,
+  0x117042, 0x118042, 0x119063, 0x11a863, 0x11c063, 0x11d863, 0x11f042, 0x120042,
+  0x121063, 0x122863, 0x124042, 0x125042, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x126420, 0x126c20, 0x127420, 0x127c20, 0x128420, 0x128c20, 0x129420, 0x129c20,
+  0x12a420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x12ac40, 0x12bc40, 0x12cc40, 0x12dc40, 0x12ec40, 0x12fc40, 0x0, 0x0,
+  0x130c20, 0x131420, 0x131c20, 0x132420, 0x132c20, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x133021, 0x133821, 0x0, 0x134021, 0x134842, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x135821, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x136440, 0x0, 0x0, 0x0, 0x137021, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x137c40, 0x138c62, 0x13b042, 0x13c021,
+  0x13c842, 0x13d842, 0x13e842, 0x0, 0x13f842, 0x0, 0x140842, 0x141842,
+  0x142863, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x144042, 0x145042, 0x146042, 0x147042, 0x148042, 0x149042,
+  0x14a063, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x14b842, 0x14c842, 0x14d842, 0x14e842, 0x14f842, 0x0,
+  0x150c20, 0x151420, 0x151c20, 0x152442, 0x154442, 0x156420, 0x156c20, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x157420, 0x157c20, 0x158420, 0x0, 0x158c20, 0x159420, 0x0, 0x0,
+  0x0, 0x159c20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x15a042, 0x15b042, 0x0, 0x15c042, 0x0, 0x0, 0x0, 0x15d042,
+  0x0, 0x0, 0x0, 0x0, 0x15e042, 0x15f042, 0x160042, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x161042, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x162042, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x163042, 0x164042, 0x0, 0x165042, 0x0, 0x0, 0x0, 0x166042,
+  0x0, 0x0, 0x0, 0x0, 0x167042, 0x168042, 0x169042, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16a042, 0x16b042,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x16c042, 0x16d042, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x16e042, 0x16f042, 0x170042, 0x171042, 0x0, 0x0, 0x172042, 0x173042,
+  0x0, 0x0, 0x174042, 0x175042, 0x176042, 0x177042, 0x178042, 0x179042,
+  0x0, 0x0, 0x17a042, 0x17b042, 0x17c042, 0x17d042, 0x17e042, 0x17f042,
+  0x0, 0x0, 0x180042, 0x181042, 0x182042, 0x183042, 0x184042, 0x185042,
+  0x186042, 0x187042, 0x188042, 0x189042, 0x18a042, 0x18b042, 0x0, 0x0,
+  0x18c042, 0x18d042, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18e440,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x18f042, 0x190042, 0x191042, 0x192042, 0x193042, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x194440, 0x195440, 0x196440,
+  0x197440, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x198042, 0x0, 0x199042, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x19a042, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x19b042, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x19c042, 0x0, 0x0, 0x19d042, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x19e042, 0x19f042, 0x1a0042, 0x1a1042, 0x1a2042, 0x1a3042, 0x1a4042, 0x1a5042,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x1a6042, 0x1a7042, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x1a8042, 0x1a9042, 0x0, 0x1aa042,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x1ab042, 0x0, 0x0, 0x1ac042, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x1ad042, 0x1ae042, 0x1af042, 0x0, 0x0, 0x1b0042, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x1b1042, 0x0, 0x0, 0x1b2042, 0x1b3042, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x1b4042, 0x1b5042, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x1b6042, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x1b7042, 0x1b8042, 0x1b9042, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x1ba042, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x1bb042, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1bc042,
+  0x1bd042, 0x0, 0x1be042, 0x1bf063, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x1c0842, 0x1c1842, 0x1c2842, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x1c3842, 0x0, 0x1c4842, 0x1c5863, 0x1c7042, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x1c8440, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x1c9440, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x1ca440, 0x1cb440, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x1cc420, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x1cc842, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x1cd842, 0x0, 0x0,
+  0x0, 0x0, 0x1ce842, 0x0, 0x0, 0x0, 0x0, 0x1cf842,
+  0x0, 0x0, 0x0, 0x0, 0x1d0842, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x1d1842, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x1d2842, 0x0, 0x1d3842, 0x1d4842, 0x1d5c60,
+  0x1d7042, 0x1d8460, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x1d9842, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x1da842, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x1db842, 0x0, 0x0,
+  0x0, 0x0, 0x1dc842, 0x0, 0x0, 0x0, 0x0, 0x1dd842,
+  0x0, 0x0, 0x0, 0x0, 0x1de842, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x1df842, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e0842, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x1e1c20, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e2042, 0x0,
+  0x1e3042, 0x0, 0x1e4042, 0x0, 0x1e5042, 0x0, 0x1e6042, 0x0,
+  0x0, 0x0, 0x1e7042, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x1e8042, 0x0, 0x1e9042, 0x0, 0x0,
+  0x1ea042, 0x1eb042, 0x0, 0x1ec042, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x1ed420, 0x1edc20, 0x1ee420, 0x0,
+  0x1eec20, 0x1ef420, 0x1efc20, 0x1f0420, 0x1f0c20, 0x1f1420, 0x1f1c20, 0x1f2420,
+  0x1f2c20, 0x1f3420, 0x1f3c20, 0x0, 0x1f4420, 0x1f4c20, 0x1f5420, 0x1f5c20,
+  0x1f6420, 0x1f6c20, 0x1f7420, 0x1f7c20, 0x1f8420, 0x1f8c20, 0x1f9420, 0x1f9c20,
+  0x1fa420, 0x1fac20, 0x1fb420, 0x1fbc20, 0x1fc420, 0x1fcc20, 0x0, 0x1fd420,
+  0x1fdc20, 0x1fe420, 0x1fec20, 0x1ff420, 0x1ffc20, 0x200420, 0x200c20, 0x201420,
+  0x201c20, 0x202420, 0x202c20, 0x203420, 0x203c20, 0x204420, 0x204c20, 0x205420,
+  0x205c20, 0x206420, 0x206c20, 0x207420, 0x207c20, 0x208420, 0x208c20, 0x209420,
+  0x209c20, 0x20a420, 0x20ac20, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x20b420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x20bc20, 0x20c420, 0x20cc20, 0x20d420, 0x20dc20,
+  0x20e420, 0x20ec20, 0x20f420, 0x20fc20, 0x210420, 0x210c20, 0x211420, 0x211c20,
+  0x212420, 0x212c20, 0x213420, 0x213c20, 0x214420, 0x214c20, 0x215420, 0x215c20,
+  0x216420, 0x216c20, 0x217420, 0x217c20, 0x218420, 0x218c20, 0x219420, 0x219c20,
+  0x21a420, 0x21ac20, 0x21b420, 0x21bc20, 0x21c420, 0x21cc20, 0x21d420, 0x21dc20,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x21e042, 0x21f042, 0x220042, 0x221042, 0x222042, 0x223042, 0x224042, 0x225042,
+  0x226063, 0x227863, 0x229042, 0x22a042, 0x22b042, 0x22c042, 0x22d042, 0x22e042,
+  0x22f042, 0x230042, 0x231042, 0x232042, 0x233063, 0x234863, 0x236063, 0x237863,
+  0x239042, 0x23a042, 0x23b042, 0x23c042, 0x23d063, 0x23e863, 0x240042, 0x241042,
+  0x242042, 0x243042, 0x244042, 0x245042, 0x246042, 0x247042, 0x248042, 0x249042,
+  0x24a042, 0x24b042, 0x24c042, 0x24d042, 0x24e042, 0x24f042, 0x250063, 0x251863,
+  0x253042, 0x254042, 0x255042, 0x256042, 0x257042, 0x258042, 0x259042, 0x25a042,
+  0x25b063, 0x25c863, 0x25e042, 0x25f042, 0x260042, 0x261042, 0x262042, 0x263042,
+  0x264042, 0x265042, 0x266042, 0x267042, 0x268042, 0x269042, 0x26a042, 0x26b042,
+  0x26c042, 0x26d042, 0x26e042, 0x26f042, 0x270063, 0x271863, 0x273063, 0x274863,
+  0x276063, 0x277863, 0x279063, 0x27a863, 0x27c042, 0x27d042, 0x27e042, 0x27f042,
+  0x280042, 0x281042, 0x282042, 0x283042, 0x284063, 0x285863, 0x287042, 0x288042,
+  0x289042, 0x28a042, 0x28b042, 0x28c042, 0x28d063, 0x28e863, 0x290063, 0x291863,
+  0x293063, 0x294863, 0x296042, 0x297042, 0x298042, 0x299042, 0x29a042, 0x29b042,
+  0x29c042, 0x29d042, 0x29e042, 0x29f042, 0x2a0042, 0x2a1042, 0x2a2042, 0x2a3042,
+  0x2a4063, 0x2a5863, 0x2a7063, 0x2a8863, 0x2aa042, 0x2ab042, 0x2ac042, 0x2ad042,
+  0x2ae042, 0x2af042, 0x2b0042, 0x2b1042, 0x2b2042, 0x2b3042, 0x2b4042, 0x2b5042,
+  0x2b6042, 0x2b7042, 0x2b8042, 0x2b9042, 0x2ba042, 0x2bb042, 0x2bc042, 0x2bd042,
+  0x2be042, 0x2bf042, 0x2c0042, 0x2c1042, 0x2c2042, 0x2c3042, 0x2c4042, 0x2c5042,
+  0x2c6042, 0x2c7042, 0x2c8440, 0x2c9442, 0x0, 0x0, 0x0, 0x0,
+  0x2cb042, 0x2cc042, 0x2cd042, 0x2ce042, 0x2cf063, 0x2d0863, 0x2d2063, 0x2d3863,
+  0x2d5063, 0x2d6863, 0x2d8063, 0x2d9863, 0x2db063, 0x2dc863, 0x2de063, 0x2df863,
+  0x2e1063, 0x2e2863, 0x2e4063, 0x2e5863, 0x2e7063, 0x2e8863, 0x2ea063, 0x2eb863,
+  0x2ed042, 0x2ee042, 0x2ef042, 0x2f0042, 0x2f1042, 0x2f2042, 0x2f3063, 0x2f4863,
+  0x2f6063, 0x2f7863, 0x2f9063, 0x2fa863, 0x2fc063, 0x2fd863, 0x2ff063, 0x300863,
+  0x302042, 0x303042, 0x304042, 0x305042, 0x306042, 0x307042, 0x308042, 0x309042,
+  0x30a063, 0x30b863, 0x30d063, 0x30e863, 0x310063, 0x311863, 0x313063, 0x314863,
+  0x316063, 0x317863, 0x319063, 0x31a863, 0x31c063, 0x31d863, 0x31f063, 0x320863,
+  0x322063, 0x323863, 0x325063, 0x326863, 0x328042, 0x329042, 0x32a042, 0x32b042,
+  0x32c063, 0x32d863, 0x32f063, 0x330863, 0x332063, 0x333863, 0x335063, 0x336863,
+  0x338063, 0x339863, 0x33b042, 0x33c042, 0x33d042, 0x33e042, 0x33f042, 0x340042,
+  0x341042, 0x342042, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x343042, 0x344042, 0x345063, 0x346863, 0x348063, 0x349863, 0x34b063, 0x34c863,
+  0x34e042, 0x34f042, 0x350063, 0x351863, 0x353063, 0x354863, 0x356063, 0x357863,
+  0x359042, 0x35a042, 0x35b063, 0x35c863, 0x35e063, 0x35f863, 0x0, 0x0,
+  0x361042, 0x362042, 0x363063, 0x364863, 0x366063, 0x367863, 0x0, 0x0,
+  0x369042, 0x36a042, 0x36b063, 0x36c863, 0x36e063, 0x36f863, 0x371063, 0x372863,
+  0x374042, 0x375042, 0x376063, 0x377863, 0x379063, 0x37a863, 0x37c063, 0x37d863,
+  0x37f042, 0x380042, 0x381063, 0x382863, 0x384063, 0x385863, 0x387063, 0x388863,
+  0x38a042, 0x38b042, 0x38c063, 0x38d863, 0x38f063, 0x390863, 0x392063, 0x393863,
+  0x395042, 0x396042, 0x397063, 0x398863, 0x39a063, 0x39b863, 0x0, 0x0,
+  0x39d042, 0x39e042, 0x39f063, 0x3a0863, 0x3a2063, 0x3a3863, 0x0, 0x0,
+  0x3a5042, 0x3a6042, 0x3a7063, 0x3a8863, 0x3aa063, 0x3ab863, 0x3ad063, 0x3ae863,
+  0x0, 0x3b0042, 0x0, 0x3b1063, 0x0, 0x3b2863, 0x0, 0x3b4063,
+  0x3b5842, 0x3b6842, 0x3b7863, 0x3b9063, 0x3ba863, 0x3bc063, 0x3bd863, 0x3bf063,
+  0x3c0842, 0x3c1842, 0x3c2863, 0x3c4063, 0x3c5863, 0x3c7063, 0x3c8863, 0x3ca063,
+  0x3cb842, 0x3cc842, 0x3cd842, 0x3ce842, 0x3cf842, 0x3d0842, 0x3d1842, 0x3d2842,
+  0x3d3842, 0x3d4842, 0x3d5842, 0x3d6842, 0x3d7842, 0x3d8842, 0x0, 0x0,
+  0x3d9863, 0x3db063, 0x3dc884, 0x3de884, 0x3e0884, 0x3e2884, 0x3e4884, 0x3e6884,
+  0x3e8863, 0x3ea063, 0x3eb884, 0x3ed884, 0x3ef884, 0x3f1884, 0x3f3884, 0x3f5884,
+  0x3f7863, 0x3f9063, 0x3fa884, 0x3fc884, 0x3fe884, 0x400884, 0x402884, 0x404884,
+  0x406863, 0x408063, 0x409884, 0x40b884, 0x40d884, 0x40f884, 0x411884, 0x413884,
+  0x415863, 0x417063, 0x418884, 0x41a884, 0x41c884, 0x41e884, 0x420884, 0x422884,
+  0x424863, 0x426063, 0x427884, 0x429884, 0x42b884, 0x42d884, 0x42f884, 0x431884,
+  0x433842, 0x434842, 0x435863, 0x437042, 0x438063, 0x0, 0x439842, 0x43a863,
+  0x43c042, 0x43d042, 0x43e042, 0x43f042, 0x440042, 0x441440, 0x442021, 0x442c40,
+  0x443c40, 0x444c62, 0x447063, 0x448842, 0x449863, 0x0, 0x44b042, 0x44c063,
+  0x44d842, 0x44e842, 0x44f842, 0x450842, 0x451842, 0x452c62, 0x455462, 0x457c62,
+  0x45a042, 0x45b042, 0x45c063, 0x45d863, 0x0, 0x0, 0x45f042, 0x460063,
+  0x461842, 0x462842, 0x463842, 0x464842, 0x0, 0x465c62, 0x468462, 0x46ac62,
+  0x46d042, 0x46e042, 0x46f063, 0x470863, 0x472042, 0x473042, 0x474042, 0x475063,
+  0x476842, 0x477842, 0x478842, 0x479842, 0x47a842, 0x47bc62, 0x47e462, 0x480821,
+  0x0, 0x0, 0x481063, 0x482842, 0x483863, 0x0, 0x485042, 0x486063,
+  0x487842, 0x488842, 0x489842, 0x48a842, 0x48b842, 0x48cc41, 0x48e440, 0x0,
+  0x48f421, 0x490421, 0x491420, 0x491c20, 0x492420, 0x492c20, 0x493420, 0x493c20,
+  0x494420, 0x494c20, 0x495420, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x495c20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x496440,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x497420, 0x497c40, 0x498c60, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49a420,
+  0x0, 0x0, 0x0, 0x49ac40, 0x49bc60, 0x0, 0x49d440, 0x49e460,
+  0x0, 0x0, 0x0, 0x0, 0x49fc40, 0x0, 0x4a0c40, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a1c40,
+  0x4a2c40, 0x4a3c40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a4c80,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a6c20,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x4a7420, 0x4a7c20, 0x0, 0x0, 0x4a8420, 0x4a8c20, 0x4a9420, 0x4a9c20,
+  0x4aa420, 0x4aac20, 0x4ab420, 0x4abc20, 0x4ac420, 0x4acc20, 0x4ad420, 0x4adc20,
+  0x4ae420, 0x4aec20, 0x4af420, 0x4afc20, 0x4b0420, 0x4b0c20, 0x4b1420, 0x4b1c20,
+  0x4b2420, 0x4b2c20, 0x4b3420, 0x4b3c20, 0x4b4420, 0x4b4c20, 0x4b5420, 0x0,
+  0x4b5c20, 0x4b6420, 0x4b6c20, 0x4b7420, 0x4b7c20, 0x4b8420, 0x4b8c20, 0x4b9420,
+  0x4b9c20, 0x4ba420, 0x4bac20, 0x4bb420, 0x4bbc20, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x4bc440, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x4bd460, 0x4bec60, 0x4c0420, 0x4c0c40, 0x0, 0x4c1c60, 0x4c3460, 0x4c4c20,
+  0x0, 0x4c5440, 0x4c6420, 0x4c6c20, 0x4c7420, 0x4c7c20, 0x4c8420, 0x4c8c20,
+  0x4c9420, 0x4c9c20, 0x4ca420, 0x4cac20, 0x0, 0x4cb420, 0x4cbc40, 0x0,
+  0x0, 0x4ccc20, 0x4cd420, 0x4cdc20, 0x4ce420, 0x4cec20, 0x0, 0x0,
+  0x4cf440, 0x4d0460, 0x4d1c40, 0x0, 0x4d2c20, 0x0, 0x4d3021, 0x0,
+  0x4d3c20, 0x0, 0x4d4021, 0x4d4842, 0x4d5c20, 0x4d6420, 0x0, 0x4d6c20,
+  0x4d7420, 0x4d7c20, 0x0, 0x4d8420, 0x4d8c20, 0x4d9420, 0x4d9c20, 0x4da420,
+  0x4dac20, 0x4db420, 0x0, 0x4dbc60, 0x4dd420, 0x4ddc20, 0x4de420, 0x4dec20,
+  0x4df420, 0x0, 0x0, 0x0, 0x0, 0x4dfc20, 0x4e0420, 0x4e0c20,
+  0x4e1420, 0x4e1c20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x4e2460, 0x4e3c60, 0x4e5480, 0x4e7460, 0x4e8c60, 0x4ea460, 0x4ebc60, 0x4ed460,
+  0x4eec60, 0x4f0460, 0x4f1c60, 0x4f3460, 0x4f4c60, 0x4f6460, 0x4f7c60, 0x4f9440,
+  0x4fa420, 0x4fac40, 0x4fbc60, 0x4fd440, 0x4fe420, 0x4fec40, 0x4ffc60, 0x501480,
+  0x503440, 0x504420, 0x504c40, 0x505c60, 0x507420, 0x507c20, 0x508420, 0x508c20,
+  0x509420, 0x509c40, 0x50ac60, 0x50c440, 0x50d420, 0x50dc40, 0x50ec60, 0x510480,
+  0x512440, 0x513420, 0x513c40, 0x514c60, 0x516420, 0x516c20, 0x517420, 0x517c20,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x518460, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x519842, 0x51a842, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x51b842, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x51c842, 0x51d842, 0x51e842,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x51f842, 0x0, 0x0, 0x0,
+  0x0, 0x520842, 0x0, 0x0, 0x521842, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x522842, 0x0, 0x523842, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x524c40, 0x525c60, 0x0, 0x527440,
+  0x528460, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x529842, 0x0, 0x0, 0x52a842, 0x0, 0x0, 0x52b842,
+  0x0, 0x52c842, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x52d842, 0x0, 0x52e842, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x52f842, 0x530842, 0x531842,
+  0x532842, 0x533842, 0x0, 0x0, 0x534842, 0x535842, 0x0, 0x0,
+  0x536842, 0x537842, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x538842, 0x539842, 0x0, 0x0, 0x53a842, 0x53b842, 0x0, 0x0,
+  0x53c842, 0x53d842, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x53e842, 0x53f842, 0x540842, 0x541842,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x542842, 0x543842, 0x544842, 0x545842, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x546842, 0x547842, 0x548842, 0x549842, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x54a821, 0x54b021, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x54bc20, 0x54c420, 0x54cc20, 0x54d420, 0x54dc20, 0x54e420, 0x54ec20, 0x54f420,
+  0x54fc20, 0x550440, 0x551440, 0x552440, 0x553440, 0x554440, 0x555440, 0x556440,
+  0x557440, 0x558440, 0x559440, 0x55a440, 0x55b460, 0x55cc60, 0x55e460, 0x55fc60,
+  0x561460, 0x562c60, 0x564460, 0x565c60, 0x567460, 0x568c80, 0x56ac80, 0x56cc80,
+  0x56ec80, 0x570c80, 0x572c80, 0x574c80, 0x576c80, 0x578c80, 0x57ac80, 0x57cc80,
+  0x57ec40, 0x57fc40, 0x580c40, 0x581c40, 0x582c40, 0x583c40, 0x584c40, 0x585c40,
+  0x586c40, 0x587c60, 0x589460, 0x58ac60, 0x58c460, 0x58dc60, 0x58f460, 0x590c60,
+  0x592460, 0x593c60, 0x595460, 0x596c60, 0x598460, 0x599c60, 0x59b460, 0x59cc60,
+  0x59e460, 0x59fc60, 0x5a1460, 0x5a2c60, 0x5a4460, 0x5a5c60, 0x5a7460, 0x5a8c60,
+  0x5aa460, 0x5abc60, 0x5ad460, 0x5aec60, 0x5b0460, 0x5b1c60, 0x5b3460, 0x5b4c60,
+  0x5b6460, 0x5b7c60, 0x5b9460, 0x5bac60, 0x5bc460, 0x5bdc60, 0x5bf420, 0x5bfc20,
+  0x5c0420, 0x5c0c20, 0x5c1420, 0x5c1c20, 0x5c2420, 0x5c2c20, 0x5c3420, 0x5c3c20,
+  0x5c4420, 0x5c4c20, 0x5c5420, 0x5c5c20, 0x5c6420, 0x5c6c20, 0x5c7420, 0x5c7c20,
+  0x5c8420, 0x5c8c20, 0x5c9420, 0x5c9c20, 0x5ca420, 0x5cac20, 0x5cb420, 0x5cbc20,
+  0x5cc420, 0x5ccc20, 0x5cd420, 0x5cdc20, 0x5ce420, 0x5cec20, 0x5cf420, 0x5cfc20,
+  0x5d0420, 0x5d0c20, 0x5d1420, 0x5d1c20, 0x5d2420, 0x5d2c20, 0x5d3420, 0x5d3c20,
+  0x5d4420, 0x5d4c20, 0x5d5420, 0x5d5c20, 0x5d6420, 0x5d6c20, 0x5d7420, 0x5d7c20,
+  0x5d8420, 0x5d8c20, 0x5d9420, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x5d9c80, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x5dbc60, 0x5dd440, 0x5de460, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x5df842, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x5e0c20, 0x5e1420, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e1c20,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e2420,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x5e2c20, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x5e3420, 0x5e3c20, 0x5e4420, 0x5e4c20, 0x5e5420, 0x5e5c20, 0x5e6420, 0x5e6c20,
+  0x5e7420, 0x5e7c20, 0x5e8420, 0x5e8c20, 0x5e9420, 0x5e9c20, 0x5ea420, 0x5eac20,
+  0x5eb420, 0x5ebc20, 0x5ec420, 0x5ecc20, 0x5ed420, 0x5edc20, 0x5ee420, 0x5eec20,
+  0x5ef420, 0x5efc20, 0x5f0420, 0x5f0c20, 0x5f1420, 0x5f1c20, 0x5f2420, 0x5f2c20,
+  0x5f3420, 0x5f3c20, 0x5f4420, 0x5f4c20, 0x5f5420, 0x5f5c20, 0x5f6420, 0x5f6c20,
+  0x5f7420, 0x5f7c20, 0x5f8420, 0x5f8c20, 0x5f9420, 0x5f9c20, 0x5fa420, 0x5fac20,
+  0x5fb420, 0x5fbc20, 0x5fc420, 0x5fcc20, 0x5fd420, 0x5fdc20, 0x5fe420, 0x5fec20,
+  0x5ff420, 0x5ffc20, 0x600420, 0x600c20, 0x601420, 0x601c20, 0x602420, 0x602c20,
+  0x603420, 0x603c20, 0x604420, 0x604c20, 0x605420, 0x605c20, 0x606420, 0x606c20,
+  0x607420, 0x607c20, 0x608420, 0x608c20, 0x609420, 0x609c20, 0x60a420, 0x60ac20,
+  0x60b420, 0x60bc20, 0x60c420, 0x60cc20, 0x60d420, 0x60dc20, 0x60e420, 0x60ec20,
+  0x60f420, 0x60fc20, 0x610420, 0x610c20, 0x611420, 0x611c20, 0x612420, 0x612c20,
+  0x613420, 0x613c20, 0x614420, 0x614c20, 0x615420, 0x615c20, 0x616420, 0x616c20,
+  0x617420, 0x617c20, 0x618420, 0x618c20, 0x619420, 0x619c20, 0x61a420, 0x61ac20,
+  0x61b420, 0x61bc20, 0x61c420, 0x61cc20, 0x61d420, 0x61dc20, 0x61e420, 0x61ec20,
+  0x61f420, 0x61fc20, 0x620420, 0x620c20, 0x621420, 0x621c20, 0x622420, 0x622c20,
+  0x623420, 0x623c20, 0x624420, 0x624c20, 0x625420, 0x625c20, 0x626420, 0x626c20,
+  0x627420, 0x627c20, 0x628420, 0x628c20, 0x629420, 0x629c20, 0x62a420, 0x62ac20,
+  0x62b420, 0x62bc20, 0x62c420, 0x62cc20, 0x62d420, 0x62dc20, 0x62e420, 0x62ec20,
+  0x62f420, 0x62fc20, 0x630420, 0x630c20, 0x631420, 0x631c20, 0x632420, 0x632c20,
+  0x633420, 0x633c20, 0x634420, 0x634c20, 0x635420, 0x635c20, 0x636420, 0x636c20,
+  0x637420, 0x637c20, 0x638420, 0x638c20, 0x639420, 0x639c20, 0x63a420, 0x63ac20,
+  0x63b420, 0x63bc20, 0x63c420, 0x63cc20, 0x63d420, 0x63dc20, 0x63e420, 0x63ec20,
+  0x63f420, 0x63fc20, 0x640420, 0x640c20, 0x641420, 0x641c20, 0x642420, 0x642c20,
+  0x643420, 0x643c20, 0x644420, 0x644c20, 0x645420, 0x645c20, 0x646420, 0x646c20,
+  0x647420, 0x647c20, 0x648420, 0x648c20, 0x649420, 0x649c20, 0x64a420, 0x64ac20,
+  0x64b420, 0x64bc20, 0x64c420, 0x64cc20, 0x64d420, 0x64dc20, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x64e420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x64ec20, 0x0,
+  0x64f420, 0x64fc20, 0x650420, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x650842, 0x0, 0x651842, 0x0,
+  0x652842, 0x0, 0x653842, 0x0, 0x654842, 0x0, 0x655842, 0x0,
+  0x656842, 0x0, 0x657842, 0x0, 0x658842, 0x0, 0x659842, 0x0,
+  0x65a842, 0x0, 0x65b842, 0x0, 0x0, 0x65c842, 0x0, 0x65d842,
+  0x0, 0x65e842, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x65f842, 0x660842, 0x0, 0x661842, 0x662842, 0x0, 0x663842, 0x664842,
+  0x0, 0x665842, 0x666842, 0x0, 0x667842, 0x668842, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x669842, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x66ac40, 0x66bc40, 0x0, 0x66c842, 0x66dc40,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x66e842, 0x0, 0x66f842, 0x0,
+  0x670842, 0x0, 0x671842, 0x0, 0x672842, 0x0, 0x673842, 0x0,
+  0x674842, 0x0, 0x675842, 0x0, 0x676842, 0x0, 0x677842, 0x0,
+  0x678842, 0x0, 0x679842, 0x0, 0x0, 0x67a842, 0x0, 0x67b842,
+  0x0, 0x67c842, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x67d842, 0x67e842, 0x0, 0x67f842, 0x680842, 0x0, 0x681842, 0x682842,
+  0x0, 0x683842, 0x684842, 0x0, 0x685842, 0x686842, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x687842, 0x0, 0x0, 0x688842,
+  0x689842, 0x68a842, 0x68b842, 0x0, 0x0, 0x0, 0x68c842, 0x68dc40,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x68ec20, 0x68f420, 0x68fc20, 0x690420, 0x690c20, 0x691420, 0x691c20,
+  0x692420, 0x692c20, 0x693420, 0x693c20, 0x694420, 0x694c20, 0x695420, 0x695c20,
+  0x696420, 0x696c20, 0x697420, 0x697c20, 0x698420, 0x698c20, 0x699420, 0x699c20,
+  0x69a420, 0x69ac20, 0x69b420, 0x69bc20, 0x69c420, 0x69cc20, 0x69d420, 0x69dc20,
+  0x69e420, 0x69ec20, 0x69f420, 0x69fc20, 0x6a0420, 0x6a0c20, 0x6a1420, 0x6a1c20,
+  0x6a2420, 0x6a2c20, 0x6a3420, 0x6a3c20, 0x6a4420, 0x6a4c20, 0x6a5420, 0x6a5c20,
+  0x6a6420, 0x6a6c20, 0x6a7420, 0x6a7c20, 0x6a8420, 0x6a8c20, 0x6a9420, 0x6a9c20,
+  0x6aa420, 0x6aac20, 0x6ab420, 0x6abc20, 0x6ac420, 0x6acc20, 0x6ad420, 0x6adc20,
+  0x6ae420, 0x6aec20, 0x6af420, 0x6afc20, 0x6b0420, 0x6b0c20, 0x6b1420, 0x6b1c20,
+  0x6b2420, 0x6b2c20, 0x6b3420, 0x6b3c20, 0x6b4420, 0x6b4c20, 0x6b5420, 0x6b5c20,
+  0x6b6420, 0x6b6c20, 0x6b7420, 0x6b7c20, 0x6b8420, 0x6b8c20, 0x6b9420, 0x6b9c20,
+  0x6ba420, 0x6bac20, 0x6bb420, 0x6bbc20, 0x6bc420, 0x6bcc20, 0x6bd420, 0x0,
+  0x0, 0x0, 0x6bdc20, 0x6be420, 0x6bec20, 0x6bf420, 0x6bfc20, 0x6c0420,
+  0x6c0c20, 0x6c1420, 0x6c1c20, 0x6c2420, 0x6c2c20, 0x6c3420, 0x6c3c20, 0x6c4420,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x6c4c60, 0x6c6460, 0x6c7c60, 0x6c9460, 0x6cac60, 0x6cc460, 0x6cdc60, 0x6cf460,
+  0x6d0c60, 0x6d2460, 0x6d3c60, 0x6d5460, 0x6d6c60, 0x6d8460, 0x6d9c80, 0x6dbc80,
+  0x6ddc80, 0x6dfc80, 0x6e1c80, 0x6e3c80, 0x6e5c80, 0x6e7c80, 0x6e9c80, 0x6ebc80,
+  0x6edc80, 0x6efc80, 0x6f1c80, 0x6f3c80, 0x6f5c80, 0x6f7ce0, 0x6fb4c0, 0x0,
+  0x6fe460, 0x6ffc60, 0x701460, 0x702c60, 0x704460, 0x705c60, 0x707460, 0x708c60,
+  0x70a460, 0x70bc60, 0x70d460, 0x70ec60, 0x710460, 0x711c60, 0x713460, 0x714c60,
+  0x716460, 0x717c60, 0x719460, 0x71ac60, 0x71c460, 0x71dc60, 0x71f460, 0x720c60,
+  0x722460, 0x723c60, 0x725460, 0x726c60, 0x728460, 0x729c60, 0x72b460, 0x72cc60,
+  0x72e460, 0x72fc60, 0x731460, 0x732c60, 0x734420, 0x734c20, 0x735420, 0x735c20,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x736460, 0x737c40, 0x738c40, 0x739c40, 0x73ac40, 0x73bc40, 0x73cc40, 0x73dc40,
+  0x73ec40, 0x73fc40, 0x740c40, 0x741c40, 0x742c40, 0x743c40, 0x744c40, 0x745c40,
+  0x746c20, 0x747420, 0x747c20, 0x748420, 0x748c20, 0x749420, 0x749c20, 0x74a420,
+  0x74ac20, 0x74b420, 0x74bc20, 0x74c420, 0x74cc20, 0x74d420, 0x74dc40, 0x74ec40,
+  0x74fc40, 0x750c40, 0x751c40, 0x752c40, 0x753c40, 0x754c40, 0x755c40, 0x756c40,
+  0x757c40, 0x758c40, 0x759c40, 0x75ac40, 0x75bca0, 0x75e480, 0x760440, 0x0,
+  0x761420, 0x761c20, 0x762420, 0x762c20, 0x763420, 0x763c20, 0x764420, 0x764c20,
+  0x765420, 0x765c20, 0x766420, 0x766c20, 0x767420, 0x767c20, 0x768420, 0x768c20,
+  0x769420, 0x769c20, 0x76a420, 0x76ac20, 0x76b420, 0x76bc20, 0x76c420, 0x76cc20,
+  0x76d420, 0x76dc20, 0x76e420, 0x76ec20, 0x76f420, 0x76fc20, 0x770420, 0x770c20,
+  0x771420, 0x771c20, 0x772420, 0x772c20, 0x773420, 0x773c20, 0x774420, 0x774c20,
+  0x775420, 0x775c20, 0x776420, 0x776c20, 0x777420, 0x777c20, 0x778420, 0x778c20,
+  0x779420, 0x779c40, 0x77ac40, 0x77bc40, 0x77cc40, 0x77dc40, 0x77ec40, 0x77fc40,
+  0x780c40, 0x781c40, 0x782c40, 0x783c40, 0x784c40, 0x785c40, 0x786c40, 0x787c40,
+  0x788c40, 0x789c40, 0x78ac40, 0x78bc40, 0x78cc40, 0x78dc40, 0x78ec40, 0x78fc40,
+  0x790c40, 0x791c60, 0x793460, 0x794c60, 0x796440, 0x797460, 0x798c40, 0x799c60,
+  0x79b420, 0x79bc20, 0x79c420, 0x79cc20, 0x79d420, 0x79dc20, 0x79e420, 0x79ec20,
+  0x79f420, 0x79fc20, 0x7a0420, 0x7a0c20, 0x7a1420, 0x7a1c20, 0x7a2420, 0x7a2c20,
+  0x7a3420, 0x7a3c20, 0x7a4420, 0x7a4c20, 0x7a5420, 0x7a5c20, 0x7a6420, 0x7a6c20,
+  0x7a7420, 0x7a7c20, 0x7a8420, 0x7a8c20, 0x7a9420, 0x7a9c20, 0x7aa420, 0x7aac20,
+  0x7ab420, 0x7abc20, 0x7ac420, 0x7acc20, 0x7ad420, 0x7adc20, 0x7ae420, 0x7aec20,
+  0x7af420, 0x7afc20, 0x7b0420, 0x7b0c20, 0x7b1420, 0x7b1c20, 0x7b2420, 0x7b2c40,
+  0x7b3ca0, 0x7b6480, 0x7b84a0, 0x7bac60, 0x7bc4a0, 0x7bec60, 0x7c0460, 0x7c1cc0,
+  0x7c4c80, 0x7c6c60, 0x7c8460, 0x7c9c60, 0x7cb480, 0x7cd480, 0x7cf480, 0x7d1480,
+  0x7d3480, 0x7d5480, 0x7d7480, 0x7d94c0, 0x7dc440, 0x7dd4c0, 0x7e04c0, 0x7e34a0,
+  0x7e5c80, 0x7e7cc0, 0x7eacc0, 0x7edc80, 0x7efc60, 0x7f1460, 0x7f2c80, 0x7f4c80,
+  0x7f6ca0, 0x7f94a0, 0x7fbc60, 0x7fd460, 0x7fec80, 0x800c60, 0x802460, 0x803c40,
+  0x804c40, 0x805c60, 0x807460, 0x808cc0, 0x80bc80, 0x80dca0, 0x8104c0, 0x813480,
+  0x815460, 0x816c60, 0x8184c0, 0x81b480, 0x81d4c0, 0x820460, 0x821ca0, 0x824460,
+  0x825c80, 0x827c60, 0x829480, 0x82b4a0, 0x82dc80, 0x82fca0, 0x832480, 0x834440,
+  0x8354a0, 0x837c60, 0x839460, 0x83ac80, 0x83cc60, 0x83e460, 0x83fc60, 0x8414a0,
+  0x843c80, 0x845c40, 0x846cc0, 0x849c60, 0x84b4a0, 0x84dc80, 0x84fc80, 0x851c60,
+  0x853460, 0x854c80, 0x856c40, 0x857c80, 0x859ca0, 0x85c440, 0x85d4c0, 0x860460,
+  0x861c40, 0x862c40, 0x863c40, 0x864c40, 0x865c40, 0x866c40, 0x867c40, 0x868c40,
+  0x869c40, 0x86ac40, 0x86bc60, 0x86d460, 0x86ec60, 0x870460, 0x871c60, 0x873460,
+  0x874c60, 0x876460, 0x877c60, 0x879460, 0x87ac60, 0x87c460, 0x87dc60, 0x87f460,
+  0x880c60, 0x882460, 0x883c40, 0x884c40, 0x885c60, 0x887440, 0x888440, 0x889440,
+  0x88a460, 0x88bc60, 0x88d440, 0x88e440, 0x88f440, 0x890440, 0x891440, 0x892480,
+  0x894440, 0x895440, 0x896440, 0x897440, 0x898440, 0x899440, 0x89a440, 0x89b440,
+  0x89c460, 0x89dc80, 0x89fc40, 0x8a0c40, 0x8a1c40, 0x8a2c40, 0x8a3c40, 0x8a4c40,
+  0x8a5c40, 0x8a6c60, 0x8a8460, 0x8a9c60, 0x8ab460, 0x8acc40, 0x8adc40, 0x8aec40,
+  0x8afc40, 0x8b0c40, 0x8b1c40, 0x8b2c40, 0x8b3c40, 0x8b4c40, 0x8b5c40, 0x8b6c60,
+  0x8b8460, 0x8b9c40, 0x8bac60, 0x8bc460, 0x8bdc60, 0x8bf440, 0x8c0460, 0x8c1c60,
+  0x8c3480, 0x8c5440, 0x8c6460, 0x8c7c60, 0x8c9460, 0x8cac60, 0x8cc4a0, 0x8cecc0,
+  0x8d1c40, 0x8d2c40, 0x8d3c40, 0x8d4c40, 0x8d5c40, 0x8d6c40, 0x8d7c40, 0x8d8c40,
+  0x8d9c40, 0x8dac40, 0x8dbc40, 0x8dcc40, 0x8ddc40, 0x8dec40, 0x8dfc40, 0x8e0c40,
+  0x8e1c40, 0x8e2c40, 0x8e3c80, 0x8e5c40, 0x8e6c40, 0x8e7c40, 0x8e8c80, 0x8eac60,
+  0x8ec440, 0x8ed440, 0x8ee440, 0x8ef440, 0x8f0440, 0x8f1440, 0x8f2440, 0x8f3440,
+  0x8f4440, 0x8f5440, 0x8f6460, 0x8f7c40, 0x8f8c40, 0x8f9c60, 0x8fb460, 0x8fcc40,
+  0x8fdc80, 0x8ffc60, 0x901440, 0x902440, 0x903440, 0x904440, 0x905460, 0x906c60,
+  0x908440, 0x909440, 0x90a440, 0x90b440, 0x90c440, 0x90d440, 0x90e440, 0x90f440,
+  0x910440, 0x911460, 0x912c60, 0x914460, 0x915c60, 0x917460, 0x918c60, 0x91a460,
+  0x91bc60, 0x91d460, 0x91ec60, 0x920460, 0x921c60, 0x923460, 0x924c60, 0x926460,
+  0x927c60, 0x929460, 0x92ac60, 0x92c460, 0x92dc60, 0x92f460, 0x930c60, 0x932460,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x933c20, 0x934420, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x934c20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x935420, 0x935c20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x936420, 0x936c20, 0x937420, 0x937c20,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x938021, 0x938821, 0x939021, 0x939821, 0x93a021, 0x93a821, 0x93b021, 0x93b821,
+  0x93c021, 0x93c821, 0x93d021, 0x93d821, 0x93e021, 0x93e821, 0x93f021, 0x93f821,
+  0x940021, 0x940821, 0x941021, 0x941821, 0x942021, 0x942821, 0x943021, 0x943821,
+  0x944021, 0x944821, 0x945021, 0x945821, 0x946021, 0x946821, 0x947021, 0x947821,
+  0x948021, 0x948821, 0x949021, 0x949821, 0x94a021, 0x94a821, 0x94b021, 0x94b821,
+  0x94c021, 0x94c821, 0x94d021, 0x94d821, 0x94e021, 0x94e821, 0x94f021, 0x94f821,
+  0x950021, 0x950821, 0x951021, 0x951821, 0x952021, 0x952821, 0x953021, 0x953821,
+  0x954021, 0x954821, 0x955021, 0x955821, 0x956021, 0x956821, 0x957021, 0x957821,
+  0x958021, 0x958821, 0x959021, 0x959821, 0x95a021, 0x95a821, 0x95b021, 0x95b821,
+  0x95c021, 0x95c821, 0x95d021, 0x95d821, 0x95e021, 0x95e821, 0x95f021, 0x95f821,
+  0x960021, 0x960821, 0x961021, 0x961821, 0x962021, 0x962821, 0x963021, 0x963821,
+  0x964021, 0x964821, 0x965021, 0x965821, 0x966021, 0x966821, 0x967021, 0x967821,
+  0x968021, 0x968821, 0x969021, 0x969821, 0x96a021, 0x96a821, 0x96b021, 0x96b821,
+  0x96c021, 0x96c821, 0x96d021, 0x96d821, 0x96e021, 0x96e821, 0x96f021, 0x96f821,
+  0x970021, 0x970821, 0x971021, 0x971821, 0x972021, 0x972821, 0x973021, 0x973821,
+  0x974021, 0x974821, 0x975021, 0x975821, 0x976021, 0x976821, 0x977021, 0x977821,
+  0x978021, 0x978821, 0x979021, 0x979821, 0x97a021, 0x97a821, 0x97b021, 0x97b821,
+  0x97c021, 0x97c821, 0x97d021, 0x97d821, 0x97e021, 0x97e821, 0x97f021, 0x97f821,
+  0x980021, 0x980821, 0x981021, 0x981821, 0x982021, 0x982821, 0x983021, 0x983821,
+  0x984021, 0x984821, 0x985021, 0x985821, 0x986021, 0x986821, 0x987021, 0x987821,
+  0x988021, 0x988821, 0x989021, 0x989821, 0x98a021, 0x98a821, 0x98b021, 0x98b821,
+  0x98c021, 0x98c821, 0x98d021, 0x98d821, 0x98e021, 0x98e821, 0x98f021, 0x98f821,
+  0x990021, 0x990821, 0x991021, 0x991821, 0x992021, 0x992821, 0x993021, 0x993821,
+  0x994021, 0x994821, 0x995021, 0x995821, 0x996021, 0x996821, 0x997021, 0x997821,
+  0x998021, 0x998821, 0x999021, 0x999821, 0x99a021, 0x99a821, 0x99b021, 0x99b821,
+  0x99c021, 0x99c821, 0x99d021, 0x99d821, 0x99e021, 0x99e821, 0x99f021, 0x99f821,
+  0x9a0021, 0x9a0821, 0x9a1021, 0x9a1821, 0x9a2021, 0x9a2821, 0x9a3021, 0x9a3821,
+  0x9a4021, 0x9a4821, 0x9a5021, 0x9a5821, 0x9a6021, 0x9a6821, 0x9a7021, 0x9a7821,
+  0x9a8021, 0x9a8821, 0x9a9021, 0x9a9821, 0x9aa021, 0x9aa821, 0x9ab021, 0x9ab821,
+  0x9ac021, 0x9ac821, 0x9ad021, 0x9ad821, 0x9ae021, 0x9ae821, 0x9af021, 0x9af821,
+  0x9b0021, 0x9b0821, 0x9b1021, 0x9b1821, 0x9b2021, 0x9b2821, 0x9b3021, 0x9b3821,
+  0x9b4021, 0x9b4821, 0x9b5021, 0x9b5821, 0x9b6021, 0x9b6821, 0x9b7021, 0x9b7821,
+  0x9b8021, 0x9b8821, 0x9b9021, 0x9b9821, 0x9ba021, 0x9ba821, 0x9bb021, 0x9bb821,
+  0x9bc021, 0x9bc821, 0x9bd021, 0x9bd821, 0x9be021, 0x9be821, 0x0, 0x0,
+  0x9bf021, 0x0, 0x9bf821, 0x0, 0x0, 0x9c0021, 0x9c0821, 0x9c1021,
+  0x9c1821, 0x9c2021, 0x9c2821, 0x9c3021, 0x9c3821, 0x9c4021, 0x9c4821, 0x0,
+  0x9c5021, 0x0, 0x9c5821, 0x0, 0x0, 0x9c6021, 0x9c6821, 0x0,
+  0x0, 0x0, 0x9c7021, 0x9c7821, 0x9c8021, 0x9c8821, 0x9c9021, 0x9c9821,
+  0x9ca021, 0x9ca821, 0x9cb021, 0x9cb821, 0x9cc021, 0x9cc821, 0x9cd021, 0x9cd821,
+  0x9ce021, 0x9ce821, 0x9cf021, 0x9cf821, 0x9d0021, 0x9d0821, 0x9d1021, 0x9d1821,
+  0x9d2021, 0x9d2821, 0x9d3021, 0x9d3821, 0x9d4021, 0x9d4821, 0x9d5021, 0x9d5821,
+  0x9d6021, 0x9d6821, 0x9d7021, 0x9d7821, 0x9d8021, 0x9d8821, 0x9d9021, 0x9d9821,
+  0x9da021, 0x9da821, 0x9db021, 0x9db821, 0x9dc021, 0x9dc821, 0x9dd021, 0x9dd821,
+  0x9de021, 0x9de821, 0x9df021, 0x9df821, 0x9e0021, 0x9e0821, 0x9e1021, 0x9e1821,
+  0x9e2021, 0x9e2821, 0x9e3021, 0x9e3821, 0x9e4021, 0x9e4821, 0x9e5021, 0x9e5821,
+  0x9e6021, 0x9e6821, 0x9e7021, 0x9e7821, 0x9e8021, 0x9e8821, 0x0, 0x0,
+  0x9e9021, 0x9e9821, 0x9ea021, 0x9ea821, 0x9eb021, 0x9eb821, 0x9ec021, 0x9ec821,
+  0x9ed021, 0x9ed821, 0x9ee021, 0x9ee821, 0x9ef021, 0x9ef821, 0x9f0021, 0x9f0821,
+  0x9f1021, 0x9f1821, 0x9f2021, 0x9f2821, 0x9f3021, 0x9f3821, 0x9f4021, 0x9f4821,
+  0x9f5021, 0x9f5821, 0x9f6021, 0x9f6821, 0x9f7021, 0x9f7821, 0x9f8021, 0x9f8821,
+  0x9f9021, 0x9f9821, 0x9fa021, 0x9fa821, 0x9fb021, 0x9fb821, 0x9fc021, 0x9fc821,
+  0x9fd021, 0x9fd821, 0x9fe021, 0x9fe821, 0x9ff021, 0x9ff821, 0xa00021, 0xa00821,
+  0xa01021, 0xa01821, 0xa02021, 0xa02821, 0xa03021, 0xa03821, 0xa04021, 0xa04821,
+  0xa05021, 0xa05821, 0xa06021, 0xa06821, 0xa07021, 0xa07821, 0xa08021, 0xa08821,
+  0xa09021, 0xa09821, 0xa0a021, 0xa0a821, 0xa0b021, 0xa0b821, 0xa0c021, 0xa0c821,
+  0xa0d021, 0xa0d821, 0xa0e021, 0xa0e821, 0xa0f021, 0xa0f821, 0xa10021, 0xa10821,
+  0xa11021, 0xa11821, 0xa12021, 0xa12821, 0xa13021, 0xa13821, 0xa14021, 0xa14821,
+  0xa15021, 0xa15821, 0xa16021, 0xa16821, 0xa17021, 0xa17821, 0xa18021, 0xa18821,
+  0xa19021, 0xa19821, 0xa1a021, 0xa1a821, 0xa1b021, 0xa1b821, 0xa1c021, 0xa1c821,
+  0xa1d021, 0xa1d821, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0xa1e440, 0xa1f440, 0xa20440, 0xa21460, 0xa22c60, 0xa24440, 0xa25440, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0xa26440, 0xa27440, 0xa28440, 0xa29440, 0xa2a440,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0xa2b042, 0x0, 0xa2c042,
+  0xa2d420, 0xa2dc20, 0xa2e420, 0xa2ec20, 0xa2f420, 0xa2fc20, 0xa30420, 0xa30c20,
+  0xa31420, 0xa31c20, 0xa32042, 0xa33042, 0xa34063, 0xa35863, 0xa37042, 0xa38042,
+  0xa39042, 0xa3a042, 0xa3b042, 0xa3c042, 0xa3d042, 0xa3e042, 0xa3f042, 0x0,
+  0xa40042, 0xa41042, 0xa42042, 0xa43042, 0xa44042, 0x0, 0xa45042, 0x0,
+  0xa46042, 0xa47042, 0x0, 0xa48042, 0xa49042, 0x0, 0xa4a042, 0xa4b042,
+  0xa4c042, 0xa4d042, 0xa4e042, 0xa4f042, 0xa50042, 0xa51042, 0xa52042, 0xa53440,
+  0xa54420, 0xa54c20, 0xa55420, 0xa55c20, 0xa56420, 0xa56c20, 0xa57420, 0xa57c20,
+  0xa58420, 0xa58c20, 0xa59420, 0xa59c20, 0xa5a420, 0xa5ac20, 0xa5b420, 0xa5bc20,
+  0xa5c420, 0xa5cc20, 0xa5d420, 0xa5dc20, 0xa5e420, 0xa5ec20, 0xa5f420, 0xa5fc20,
+  0xa60420, 0xa60c20, 0xa61420, 0xa61c20, 0xa62420, 0xa62c20, 0xa63420, 0xa63c20,
+  0xa64420, 0xa64c20, 0xa65420, 0xa65c20, 0xa66420, 0xa66c20, 0xa67420, 0xa67c20,
+  0xa68420, 0xa68c20, 0xa69420, 0xa69c20, 0xa6a420, 0xa6ac20, 0xa6b420, 0xa6bc20,
+  0xa6c420, 0xa6cc20, 0xa6d420, 0xa6dc20, 0xa6e420, 0xa6ec20, 0xa6f420, 0xa6fc20,
+  0xa70420, 0xa70c20, 0xa71420, 0xa71c20, 0xa72420, 0xa72c20, 0xa73420, 0xa73c20,
+  0xa74420, 0xa74c20, 0xa75420, 0xa75c20, 0xa76420, 0xa76c20, 0xa77420, 0xa77c20,
+  0xa78420, 0xa78c20, 0xa79420, 0xa79c20, 0xa7a420, 0xa7ac20, 0xa7b420, 0xa7bc20,
+  0xa7c420, 0xa7cc20, 0xa7d420, 0xa7dc20, 0xa7e440, 0xa7f440, 0xa80420, 0xa80c20,
+  0xa81420, 0xa81c20, 0xa82420, 0xa82c20, 0xa83420, 0xa83c20, 0xa84420, 0xa84c20,
+  0xa85440, 0xa86440, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0xa87420, 0xa87c20, 0xa88420, 0xa88c20, 0xa89420,
+  0xa89c20, 0xa8a420, 0xa8ac20, 0xa8b420, 0xa8bc20, 0xa8c440, 0xa8d420, 0xa8dc20,
+  0xa8e420, 0xa8ec20, 0xa8f420, 0xa8fc20, 0xa90420, 0xa90c20, 0xa91420, 0xa91c20,
+  0xa92420, 0xa92c20, 0xa93460, 0xa94c60, 0xa96460, 0xa97c60, 0xa99460, 0xa9ac60,
+  0xa9c460, 0xa9dc60, 0xa9f460, 0xaa0c60, 0xaa2460, 0xaa3c60, 0xaa5460, 0xaa6c60,
+  0xaa8460, 0xaa9c60, 0xaab460, 0xaacc60, 0xaae420, 0xaaec20, 0xaaf420, 0xaafc20,
+  0xab0460, 0xab1c60, 0xab3460, 0xab4c60, 0xab6460, 0xab7c40, 0xab8c40, 0xab9c40,
+  0xabac40, 0xabbc40, 0xabcc40, 0xabdc40, 0xabec40, 0xabfc40, 0xac0c40, 0xac1c40,
+  0xac2c40, 0xac3c40, 0xac4c40, 0xac5c40, 0xac6c40, 0xac7c40, 0xac8c40, 0xac9c40,
+  0xacac40, 0xacbc40, 0xaccc40, 0xacdc40, 0xacec40, 0xacfc40, 0xad0c40, 0xad1c40,
+  0xad2c40, 0xad3c40, 0xad4c40, 0xad5c40, 0xad6c40, 0xad7c40, 0xad8c40, 0xad9c40,
+  0xadac40, 0xadbc40, 0xadcc40, 0xaddc40, 0xadec40, 0xadfc40, 0xae0c40, 0xae1c40,
+  0xae2c40, 0xae3c40, 0xae4c40, 0xae5c40, 0xae6c40, 0xae7c40, 0xae8c40, 0xae9c40,
+  0xaeac40, 0xaebc40, 0xaecc40, 0xaedc40, 0xaeec40, 0xaefc40, 0xaf0c40, 0xaf1c40,
+  0xaf2c40, 0xaf3c40, 0xaf4c40, 0xaf5c40, 0xaf6c40, 0xaf7c40, 0xaf8c40, 0xaf9c40,
+  0xafac40, 0xafbc40, 0xafcc40, 0xafdc40, 0xafec40, 0xaffc40, 0xb00c40, 0xb01c40,
+  0xb02c40, 0xb03c40, 0xb04c40, 0xb05c40, 0xb06c40, 0xb07c40, 0xb08c40, 0xb09c40,
+  0xb0ac40, 0xb0bc40, 0xb0cc40, 0xb0dc40, 0xb0ec40, 0xb0fc40, 0xb10c60, 0xb12460,
+  0xb13c60, 0xb15460, 0xb16c60, 0xb18460, 0xb19c60, 0xb1b460, 0xb1cc60, 0xb1e460,
+  0xb1fc60, 0xb21460, 0xb22c40, 0xb23c40, 0xb24c40, 0xb25c40, 0xb26c40, 0xb27c40,
+  0xb28c40, 0xb29c40, 0xb2ac40, 0xb2bc40, 0xb2cc40, 0xb2dc40, 0xb2ec40, 0xb2fc40,
+  0xb30c40, 0xb31c40, 0xb32c40, 0xb33c40, 0xb34c40, 0xb35c40, 0xb36c40, 0xb37c40,
+  0xb38c40, 0xb39c40, 0xb3ac40, 0xb3bc40, 0xb3cc40, 0xb3dc40, 0xb3ec40, 0xb3fc40,
+  0xb40c40, 0xb41c40, 0xb42c40, 0xb43c40, 0xb44c40, 0xb45c40, 0xb46c40, 0xb47c40,
+  0xb48c40, 0xb49c40, 0xb4ac40, 0xb4bc40, 0xb4cc40, 0xb4dc40, 0xb4ec40, 0xb4fc60,
+  0xb51460, 0xb52c60, 0xb54460, 0xb55c60, 0xb57440, 0xb58440, 0xb59440, 0xb5a440,
+  0xb5b440, 0xb5c440, 0xb5d440, 0xb5e440, 0xb5f440, 0xb60440, 0xb61440, 0xb62440,
+  0xb63440, 0xb64440, 0xb65440, 0xb66440, 0xb67440, 0xb68440, 0xb69440, 0xb6a440,
+  0xb6b440, 0xb6c440, 0xb6d440, 0xb6e440, 0xb6f440, 0xb70440, 0xb71440, 0xb72440,
+  0xb73440, 0xb74440, 0xb75440, 0xb76440, 0xb77440, 0xb78440, 0xb79440, 0xb7a440,
+  0xb7b440, 0xb7c440, 0xb7d440, 0xb7e440, 0xb7f440, 0xb80440, 0xb81440, 0xb82440,
+  0xb83440, 0xb84440, 0xb85440, 0xb86440, 0xb87440, 0xb88440, 0xb89440, 0xb8a440,
+  0xb8b440, 0xb8c440, 0xb8d440, 0xb8e440, 0xb8f440, 0xb90440, 0xb91440, 0xb92440,
+  0xb93440, 0xb94440, 0xb95440, 0xb96440, 0xb97440, 0xb98440, 0xb99440, 0xb9a460,
+  0xb9bc60, 0xb9d440, 0xb9e440, 0xb9f440, 0xba0440, 0xba1440, 0xba2440, 0xba3440,
+  0xba4440, 0xba5440, 0xba6440, 0xba7440, 0xba8440, 0xba9440, 0xbaa440, 0xbab440,
+  0xbac440, 0xbad440, 0xbae460, 0xbafc60, 0xbb1460, 0xbb2c40, 0xbb3c40, 0xbb4c40,
+  0xbb5c40, 0xbb6c40, 0xbb7c40, 0xbb8c40, 0xbb9c40, 0xbbac40, 0xbbbc40, 0xbbcc40,
+  0xbbdc40, 0xbbec40, 0xbbfc40, 0xbc0c40, 0xbc1c40, 0xbc2c40, 0xbc3c40, 0xbc4c40,
+  0xbc5c40, 0xbc6c40, 0xbc7c40, 0xbc8c40, 0xbc9c40, 0xbcac40, 0xbcbc40, 0xbccc40,
+  0xbcdc40, 0xbcec40, 0xbcfc40, 0xbd0c40, 0xbd1c40, 0xbd2c40, 0xbd3c40, 0xbd4c40,
+  0xbd5c40, 0xbd6c40, 0xbd7c40, 0xbd8c40, 0xbd9c40, 0xbdac40, 0xbdbc40, 0xbdcc40,
+  0xbddc40, 0xbdec40, 0xbdfc40, 0xbe0c40, 0xbe1c40, 0xbe2c40, 0xbe3c40, 0xbe4c40,
+  0xbe5c40, 0xbe6c40, 0xbe7c40, 0xbe8c40, 0xbe9c40, 0xbeac40, 0xbebc40, 0xbecc40,
+  0xbedc40, 0xbeec40, 0xbefc40, 0xbf0c40, 0xbf1c40, 0xbf2c40, 0xbf3c40, 0xbf4c40,
+  0xbf5c40, 0xbf6c40, 0xbf7c40, 0xbf8c40, 0xbf9c40, 0xbfac40, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0xbfbc60, 0xbfd460, 0xbfec60, 0xc00460, 0xc01c60, 0xc03460, 0xc04c60, 0xc06460,
+  0xc07c60, 0xc09460, 0xc0ac60, 0xc0c460, 0xc0dc60, 0xc0f460, 0xc10c60, 0xc12460,
+  0xc13c60, 0xc15460, 0xc16c60, 0xc18460, 0xc19c60, 0xc1b460, 0xc1cc60, 0xc1e460,
+  0xc1fc60, 0xc21460, 0xc22c60, 0xc24460, 0xc25c60, 0xc27460, 0xc28c60, 0xc2a460,
+  0xc2bc60, 0xc2d460, 0xc2ec60, 0xc30460, 0xc31c60, 0xc33460, 0xc34c60, 0xc36460,
+  0xc37c60, 0xc39460, 0xc3ac60, 0xc3c460, 0xc3dc60, 0xc3f460, 0xc40c60, 0xc42460,
+  0xc43c60, 0xc45460, 0xc46c60, 0xc48460, 0xc49c60, 0xc4b460, 0xc4cc60, 0xc4e460,
+  0xc4fc60, 0xc51460, 0xc52c60, 0xc54460, 0xc55c60, 0xc57460, 0xc58c60, 0xc5a460,
+  0x0, 0x0, 0xc5bc60, 0xc5d460, 0xc5ec60, 0xc60460, 0xc61c60, 0xc63460,
+  0xc64c60, 0xc66460, 0xc67c60, 0xc69460, 0xc6ac60, 0xc6c460, 0xc6dc60, 0xc6f460,
+  0xc70c60, 0xc72460, 0xc73c60, 0xc75460, 0xc76c60, 0xc78460, 0xc79c60, 0xc7b460,
+  0xc7cc60, 0xc7e460, 0xc7fc60, 0xc81460, 0xc82c60, 0xc84460, 0xc85c60, 0xc87460,
+  0xc88c60, 0xc8a460, 0xc8bc60, 0xc8d460, 0xc8ec60, 0xc90460, 0xc91c60, 0xc93460,
+  0xc94c60, 0xc96460, 0xc97c60, 0xc99460, 0xc9ac60, 0xc9c460, 0xc9dc60, 0xc9f460,
+  0xca0c60, 0xca2460, 0xca3c60, 0xca5460, 0xca6c60, 0xca8460, 0xca9c60, 0xcab460,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0xcacc60, 0xcae460, 0xcafc80, 0xcb1c80, 0xcb3c80, 0xcb5c80, 0xcb7c80, 0xcb9c80,
+  0xcbbc80, 0xcbdc60, 0xcbf640, 0xcc8500, 0xccc480, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0xcce420, 0xccec20, 0xccf420, 0xccfc20, 0xcd0420, 0xcd0c20, 0xcd1420, 0xcd1c20,
+  0xcd2420, 0xcd2c60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0xcd4440, 0xcd5420, 0xcd5c20, 0xcd6420, 0xcd6c20, 0xcd7420, 0xcd7c20, 0xcd8420,
+  0xcd8c20, 0xcd9420, 0xcd9c20, 0xcda420, 0xcdac20, 0xcdb420, 0xcdbc20, 0xcdc420,
+  0xcdcc20, 0xcdd420, 0xcddc20, 0xcde420, 0xcdec20, 0x0, 0x0, 0xcdf420,
+  0xcdfc20, 0xce0440, 0xce1440, 0xce2440, 0xce3440, 0xce4420, 0xce4c20, 0xce5420,
+  0xce5c20, 0xce6420, 0xce6c20, 0x0, 0xce7420, 0xce7c20, 0xce8420, 0xce8c20,
+  0xce9420, 0xce9c20, 0xcea420, 0xceac20, 0xceb420, 0xcebc20, 0xcec420, 0xcecc20,
+  0xced420, 0xcedc20, 0xcee420, 0xceec20, 0xcef420, 0xcefc20, 0xcf0420, 0x0,
+  0xcf0c20, 0xcf1420, 0xcf1c20, 0xcf2420, 0x0, 0x0, 0x0, 0x0,
+  0xcf2c40, 0xcf3c40, 0xcf4c40, 0x0, 0xcf5c40, 0x0, 0xcf6c40, 0xcf7c40,
+  0xcf8c40, 0xcf9c40, 0xcfac40, 0xcfbc40, 0xcfcc40, 0xcfdc40, 0xcfec40, 0xcffc40,
+  0xd00c20, 0xd01440, 0xd02440, 0xd03440, 0xd04440, 0xd05440, 0xd06440, 0xd07440,
+  0xd08440, 0xd09440, 0xd0a440, 0xd0b440, 0xd0c440, 0xd0d420, 0xd0dc20, 0xd0e420,
+  0xd0ec20, 0xd0f420, 0xd0fc20, 0xd10420, 0xd10c20, 0xd11420, 0xd11c20, 0xd12420,
+  0xd12c20, 0xd13420, 0xd13c20, 0xd14420, 0xd14c20, 0xd15420, 0xd15c20, 0xd16420,
+  0xd16c20, 0xd17420, 0xd17c20, 0xd18420, 0xd18c20, 0xd19420, 0xd19c20, 0xd1a420,
+  0xd1ac20, 0xd1b420, 0xd1bc20, 0xd1c420, 0xd1cc20, 0xd1d420, 0xd1dc20, 0xd1e420,
+  0xd1ec20, 0xd1f420, 0xd1fc20, 0xd20420, 0xd20c20, 0xd21420, 0xd21c20, 0xd22420,
+  0xd22c20, 0xd23420, 0xd23c20, 0xd24420, 0xd24c20, 0xd25420, 0xd25c20, 0xd26420,
+  0xd26c20, 0xd27420, 0xd27c20, 0xd28420, 0xd28c20, 0xd29420, 0xd29c20, 0xd2a420,
+  0xd2ac20, 0xd2b420, 0xd2bc20, 0xd2c420, 0xd2cc20, 0xd2d420, 0xd2dc20, 0xd2e420,
+  0xd2ec20, 0xd2f420, 0xd2fc20, 0xd30420, 0xd30c20, 0xd31420, 0xd31c20, 0xd32420,
+  0xd32c20, 0xd33420, 0xd33c20, 0xd34420, 0xd34c20, 0xd35420, 0xd35c20, 0xd36420,
+  0xd36c20, 0xd37420, 0xd37c20, 0xd38420, 0xd38c20, 0xd39420, 0xd39c20, 0xd3a420,
+  0xd3ac20, 0xd3b420, 0xd3bc20, 0xd3c420, 0xd3cc20, 0xd3d420, 0xd3dc20, 0xd3e420,
+  0xd3ec20, 0xd3f420, 0xd3fc20, 0xd40420, 0xd40c20, 0xd41460, 0xd42c60, 0xd44460,
+  0xd45c60, 0xd47460, 0xd48c60, 0xd4a440, 0xd4b440, 0x0, 0x0, 0x0,
+  0x0, 0xd4c420, 0xd4cc20, 0xd4d420, 0xd4dc20, 0xd4e420, 0xd4ec20, 0xd4f420,
+  0xd4fc20, 0xd50420, 0xd50c20, 0xd51420, 0xd51c20, 0xd52420, 0xd52c20, 0xd53420,
+  0xd53c20, 0xd54420, 0xd54c20, 0xd55420, 0xd55c20, 0xd56420, 0xd56c20, 0xd57420,
+  0xd57c20, 0xd58420, 0xd58c20, 0xd59420, 0xd59c20, 0xd5a420, 0xd5ac20, 0xd5b420,
+  0xd5bc20, 0xd5c420, 0xd5cc20, 0xd5d420, 0xd5dc20, 0xd5e420, 0xd5ec20, 0xd5f420,
+  0xd5fc20, 0xd60420, 0xd60c20, 0xd61420, 0xd61c20, 0xd62420, 0xd62c20, 0xd63420,
+  0xd63c20, 0xd64420, 0xd64c20, 0xd65420, 0xd65c20, 0xd66420, 0xd66c20, 0xd67420,
+  0xd67c20, 0xd68420, 0xd68c20, 0xd69420, 0xd69c20, 0xd6a420, 0xd6ac20, 0xd6b420,
+  0xd6bc20, 0xd6c420, 0xd6cc20, 0xd6d420, 0xd6dc20, 0xd6e420, 0xd6ec20, 0xd6f420,
+  0xd6fc20, 0xd70420, 0xd70c20, 0xd71420, 0xd71c20, 0xd72420, 0xd72c20, 0xd73420,
+  0xd73c20, 0xd74420, 0xd74c20, 0xd75420, 0xd75c20, 0xd76420, 0xd76c20, 0xd77420,
+  0xd77c20, 0xd78420, 0xd78c20, 0xd79420, 0xd79c20, 0xd7a420, 0xd7ac20, 0xd7b420,
+  0xd7bc20, 0xd7c420, 0xd7cc20, 0xd7d420, 0xd7dc20, 0xd7e420, 0xd7ec20, 0xd7f420,
+  0xd7fc20, 0xd80420, 0xd80c20, 0xd81420, 0xd81c20, 0xd82420, 0xd82c20, 0xd83420,
+  0xd83c20, 0xd84420, 0xd84c20, 0xd85420, 0xd85c20, 0xd86420, 0xd86c20, 0xd87420,
+  0xd87c20, 0xd88420, 0xd88c20, 0xd89420, 0xd89c20, 0xd8a420, 0xd8ac20, 0xd8b420,
+  0xd8bc20, 0xd8c420, 0xd8cc20, 0xd8d420, 0xd8dc20, 0xd8e420, 0xd8ec20, 0xd8f420,
+  0xd8fc20, 0xd90420, 0xd90c20, 0xd91420, 0xd91c20, 0xd92420, 0xd92c20, 0xd93420,
+  0xd93c20, 0xd94420, 0xd94c20, 0xd95420, 0xd95c20, 0xd96420, 0xd96c20, 0xd97420,
+  0xd97c20, 0xd98420, 0xd98c20, 0xd99420, 0xd99c20, 0xd9a420, 0xd9ac20, 0xd9b420,
+  0xd9bc20, 0xd9c420, 0xd9cc20, 0xd9d420, 0xd9dc20, 0xd9e420, 0xd9ec20, 0xd9f420,
+  0xd9fc20, 0xda0420, 0xda0c20, 0xda1420, 0xda1c20, 0xda2420, 0xda2c20, 0xda3420,
+  0xda3c20, 0xda4420, 0xda4c20, 0xda5420, 0xda5c20, 0xda6420, 0xda6c20, 0xda7420,
+  0xda7c20, 0xda8420, 0xda8c20, 0xda9420, 0xda9c20, 0xdaa420, 0xdaac20, 0x0,
+  0x0, 0x0, 0xdab420, 0xdabc20, 0xdac420, 0xdacc20, 0xdad420, 0xdadc20,
+  0x0, 0x0, 0xdae420, 0xdaec20, 0xdaf420, 0xdafc20, 0xdb0420, 0xdb0c20,
+  0x0, 0x0, 0xdb1420, 0xdb1c20, 0xdb2420, 0xdb2c20, 0xdb3420, 0xdb3c20,
+  0x0, 0x0, 0xdb4420, 0xdb4c20, 0xdb5420, 0x0, 0x0, 0x0,
+  0xdb5c20, 0xdb6420, 0xdb6c20, 0xdb7440, 0xdb8420, 0xdb8c20, 0xdb9420, 0x0,
+  0xdb9c20, 0xdba420, 0xdbac20, 0xdbb420, 0xdbbc20, 0xdbc420, 0xdbcc20, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0xdbd042, 0x0, 0xdbe042, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0xdbf042, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc0042, 0xdc1042,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0xdc2042, 0xdc3042, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0xdc4042, 0xdc5042, 0x0, 0xdc6042, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0xdc7042, 0xdc8042, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdc9042, 0xdca042,
+  0xdcb063, 0xdcc863, 0xdce063, 0xdcf863, 0xdd1063, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0xdd2842, 0xdd3842, 0xdd4863, 0xdd6063, 0xdd7863,
+  0xdd9063, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0xddac20, 0xddb420, 0xddbc20, 0xddc420, 0xddcc20, 0xddd420, 0xdddc20, 0xdde420,
+  0xddec20, 0xddf420, 0xddfc20, 0xde0420, 0xde0c20, 0xde1420, 0xde1c20, 0xde2420,
+  0xde2c20, 0xde3420, 0xde3c20, 0xde4420, 0xde4c20, 0xde5420, 0xde5c20, 0xde6420,
+  0xde6c20, 0xde7420, 0xde7c20, 0xde8420, 0xde8c20, 0xde9420, 0xde9c20, 0xdea420,
+  0xdeac20, 0xdeb420, 0xdebc20, 0xdec420, 0xdecc20, 0xded420, 0xdedc20, 0xdee420,
+  0xdeec20, 0xdef420, 0xdefc20, 0xdf0420, 0xdf0c20, 0xdf1420, 0xdf1c20, 0xdf2420,
+  0xdf2c20, 0xdf3420, 0xdf3c20, 0xdf4420, 0xdf4c20, 0xdf5420, 0xdf5c20, 0xdf6420,
+  0xdf6c20, 0xdf7420, 0xdf7c20, 0xdf8420, 0xdf8c20, 0xdf9420, 0xdf9c20, 0xdfa420,
+  0xdfac20, 0xdfb420, 0xdfbc20, 0xdfc420, 0xdfcc20, 0xdfd420, 0xdfdc20, 0xdfe420,
+  0xdfec20, 0xdff420, 0xdffc20, 0xe00420, 0xe00c20, 0xe01420, 0xe01c20, 0xe02420,
+  0xe02c20, 0xe03420, 0xe03c20, 0xe04420, 0xe04c20, 0x0, 0xe05420, 0xe05c20,
+  0xe06420, 0xe06c20, 0xe07420, 0xe07c20, 0xe08420, 0xe08c20, 0xe09420, 0xe09c20,
+  0xe0a420, 0xe0ac20, 0xe0b420, 0xe0bc20, 0xe0c420, 0xe0cc20, 0xe0d420, 0xe0dc20,
+  0xe0e420, 0xe0ec20, 0xe0f420, 0xe0fc20, 0xe10420, 0xe10c20, 0xe11420, 0xe11c20,
+  0xe12420, 0xe12c20, 0xe13420, 0xe13c20, 0xe14420, 0xe14c20, 0xe15420, 0xe15c20,
+  0xe16420, 0xe16c20, 0xe17420, 0xe17c20, 0xe18420, 0xe18c20, 0xe19420, 0xe19c20,
+  0xe1a420, 0xe1ac20, 0xe1b420, 0xe1bc20, 0xe1c420, 0xe1cc20, 0xe1d420, 0xe1dc20,
+  0xe1e420, 0xe1ec20, 0xe1f420, 0xe1fc20, 0xe20420, 0xe20c20, 0xe21420, 0xe21c20,
+  0xe22420, 0xe22c20, 0xe23420, 0xe23c20, 0xe24420, 0xe24c20, 0xe25420, 0xe25c20,
+  0xe26420, 0xe26c20, 0xe27420, 0xe27c20, 0xe28420, 0x0, 0xe28c20, 0xe29420,
+  0x0, 0x0, 0xe29c20, 0x0, 0x0, 0xe2a420, 0xe2ac20, 0x0,
+  0x0, 0xe2b420, 0xe2bc20, 0xe2c420, 0xe2cc20, 0x0, 0xe2d420, 0xe2dc20,
+  0xe2e420, 0xe2ec20, 0xe2f420, 0xe2fc20, 0xe30420, 0xe30c20, 0xe31420, 0xe31c20,
+  0xe32420, 0xe32c20, 0x0, 0xe33420, 0x0, 0xe33c20, 0xe34420, 0xe34c20,
+  0xe35420, 0xe35c20, 0xe36420, 0xe36c20, 0x0, 0xe37420, 0xe37c20, 0xe38420,
+  0xe38c20, 0xe39420, 0xe39c20, 0xe3a420, 0xe3ac20, 0xe3b420, 0xe3bc20, 0xe3c420,
+  0xe3cc20, 0xe3d420, 0xe3dc20, 0xe3e420, 0xe3ec20, 0xe3f420, 0xe3fc20, 0xe40420,
+  0xe40c20, 0xe41420, 0xe41c20, 0xe42420, 0xe42c20, 0xe43420, 0xe43c20, 0xe44420,
+  0xe44c20, 0xe45420, 0xe45c20, 0xe46420, 0xe46c20, 0xe47420, 0xe47c20, 0xe48420,
+  0xe48c20, 0xe49420, 0xe49c20, 0xe4a420, 0xe4ac20, 0xe4b420, 0xe4bc20, 0xe4c420,
+  0xe4cc20, 0xe4d420, 0xe4dc20, 0xe4e420, 0xe4ec20, 0xe4f420, 0xe4fc20, 0xe50420,
+  0xe50c20, 0xe51420, 0xe51c20, 0xe52420, 0xe52c20, 0xe53420, 0xe53c20, 0xe54420,
+  0xe54c20, 0xe55420, 0xe55c20, 0xe56420, 0xe56c20, 0xe57420, 0x0, 0xe57c20,
+  0xe58420, 0xe58c20, 0xe59420, 0x0, 0x0, 0xe59c20, 0xe5a420, 0xe5ac20,
+  0xe5b420, 0xe5bc20, 0xe5c420, 0xe5cc20, 0xe5d420, 0x0, 0xe5dc20, 0xe5e420,
+  0xe5ec20, 0xe5f420, 0xe5fc20, 0xe60420, 0xe60c20, 0x0, 0xe61420, 0xe61c20,
+  0xe62420, 0xe62c20, 0xe63420, 0xe63c20, 0xe64420, 0xe64c20, 0xe65420, 0xe65c20,
+  0xe66420, 0xe66c20, 0xe67420, 0xe67c20, 0xe68420, 0xe68c20, 0xe69420, 0xe69c20,
+  0xe6a420, 0xe6ac20, 0xe6b420, 0xe6bc20, 0xe6c420, 0xe6cc20, 0xe6d420, 0xe6dc20,
+  0xe6e420, 0xe6ec20, 0x0, 0xe6f420, 0xe6fc20, 0xe70420, 0xe70c20, 0x0,
+  0xe71420, 0xe71c20, 0xe72420, 0xe72c20, 0xe73420, 0x0, 0xe73c20, 0x0,
+  0x0, 0x0, 0xe74420, 0xe74c20, 0xe75420, 0xe75c20, 0xe76420, 0xe76c20,
+  0xe77420, 0x0, 0xe77c20, 0xe78420, 0xe78c20, 0xe79420, 0xe79c20, 0xe7a420,
+  0xe7ac20, 0xe7b420, 0xe7bc20, 0xe7c420, 0xe7cc20, 0xe7d420, 0xe7dc20, 0xe7e420,
+  0xe7ec20, 0xe7f420, 0xe7fc20, 0xe80420, 0xe80c20, 0xe81420, 0xe81c20, 0xe82420,
+  0xe82c20, 0xe83420, 0xe83c20, 0xe84420, 0xe84c20, 0xe85420, 0xe85c20, 0xe86420,
+  0xe86c20, 0xe87420, 0xe87c20, 0xe88420, 0xe88c20, 0xe89420, 0xe89c20, 0xe8a420,
+  0xe8ac20, 0xe8b420, 0xe8bc20, 0xe8c420, 0xe8cc20, 0xe8d420, 0xe8dc20, 0xe8e420,
+  0xe8ec20, 0xe8f420, 0xe8fc20, 0xe90420, 0xe90c20, 0xe91420, 0xe91c20, 0xe92420,
+  0xe92c20, 0xe93420, 0xe93c20, 0xe94420, 0xe94c20, 0xe95420, 0xe95c20, 0xe96420,
+  0xe96c20, 0xe97420, 0xe97c20, 0xe98420, 0xe98c20, 0xe99420, 0xe99c20, 0xe9a420,
+  0xe9ac20, 0xe9b420, 0xe9bc20, 0xe9c420, 0xe9cc20, 0xe9d420, 0xe9dc20, 0xe9e420,
+  0xe9ec20, 0xe9f420, 0xe9fc20, 0xea0420, 0xea0c20, 0xea1420, 0xea1c20, 0xea2420,
+  0xea2c20, 0xea3420, 0xea3c20, 0xea4420, 0xea4c20, 0xea5420, 0xea5c20, 0xea6420,
+  0xea6c20, 0xea7420, 0xea7c20, 0xea8420, 0xea8c20, 0xea9420, 0xea9c20, 0xeaa420,
+  0xeaac20, 0xeab420, 0xeabc20, 0xeac420, 0xeacc20, 0xead420, 0xeadc20, 0xeae420,
+  0xeaec20, 0xeaf420, 0xeafc20, 0xeb0420, 0xeb0c20, 0xeb1420, 0xeb1c20, 0xeb2420,
+  0xeb2c20, 0xeb3420, 0xeb3c20, 0xeb4420, 0xeb4c20, 0xeb5420, 0xeb5c20, 0xeb6420,
+  0xeb6c20, 0xeb7420, 0xeb7c20, 0xeb8420, 0xeb8c20, 0xeb9420, 0xeb9c20, 0xeba420,
+  0xebac20, 0xebb420, 0xebbc20, 0xebc420, 0xebcc20, 0xebd420, 0xebdc20, 0xebe420,
+  0xebec20, 0xebf420, 0xebfc20, 0xec0420, 0xec0c20, 0xec1420, 0xec1c20, 0xec2420,
+  0xec2c20, 0xec3420, 0xec3c20, 0xec4420, 0xec4c20, 0xec5420, 0xec5c20, 0xec6420,
+  0xec6c20, 0xec7420, 0xec7c20, 0xec8420, 0xec8c20, 0xec9420, 0xec9c20, 0xeca420,
+  0xecac20, 0xecb420, 0xecbc20, 0xecc420, 0xeccc20, 0xecd420, 0xecdc20, 0xece420,
+  0xecec20, 0xecf420, 0xecfc20, 0xed0420, 0xed0c20, 0xed1420, 0xed1c20, 0xed2420,
+  0xed2c20, 0xed3420, 0xed3c20, 0xed4420, 0xed4c20, 0xed5420, 0xed5c20, 0xed6420,
+  0xed6c20, 0xed7420, 0xed7c20, 0xed8420, 0xed8c20, 0xed9420, 0xed9c20, 0xeda420,
+  0xedac20, 0xedb420, 0xedbc20, 0xedc420, 0xedcc20, 0xedd420, 0xeddc20, 0xede420,
+  0xedec20, 0xedf420, 0xedfc20, 0xee0420, 0xee0c20, 0xee1420, 0xee1c20, 0xee2420,
+  0xee2c20, 0xee3420, 0xee3c20, 0xee4420, 0xee4c20, 0xee5420, 0xee5c20, 0xee6420,
+  0xee6c20, 0xee7420, 0xee7c20, 0xee8420, 0xee8c20, 0xee9420, 0xee9c20, 0xeea420,
+  0xeeac20, 0xeeb420, 0xeebc20, 0xeec420, 0xeecc20, 0xeed420, 0xeedc20, 0xeee420,
+  0xeeec20, 0xeef420, 0xeefc20, 0xef0420, 0xef0c20, 0xef1420, 0xef1c20, 0xef2420,
+  0xef2c20, 0xef3420, 0xef3c20, 0xef4420, 0xef4c20, 0xef5420, 0xef5c20, 0xef6420,
+  0xef6c20, 0xef7420, 0xef7c20, 0xef8420, 0xef8c20, 0xef9420, 0xef9c20, 0xefa420,
+  0xefac20, 0xefb420, 0xefbc20, 0xefc420, 0xefcc20, 0xefd420, 0xefdc20, 0xefe420,
+  0xefec20, 0xeff420, 0xeffc20, 0xf00420, 0xf00c20, 0xf01420, 0xf01c20, 0xf02420,
+  0xf02c20, 0xf03420, 0xf03c20, 0xf04420, 0xf04c20, 0xf05420, 0xf05c20, 0xf06420,
+  0xf06c20, 0xf07420, 0xf07c20, 0xf08420, 0xf08c20, 0xf09420, 0xf09c20, 0xf0a420,
+  0xf0ac20, 0xf0b420, 0xf0bc20, 0xf0c420, 0xf0cc20, 0xf0d420, 0xf0dc20, 0xf0e420,
+  0xf0ec20, 0xf0f420, 0xf0fc20, 0xf10420, 0xf10c20, 0xf11420, 0xf11c20, 0xf12420,
+  0xf12c20, 0xf13420, 0xf13c20, 0xf14420, 0xf14c20, 0xf15420, 0xf15c20, 0xf16420,
+  0xf16c20, 0xf17420, 0xf17c20, 0xf18420, 0xf18c20, 0xf19420, 0xf19c20, 0xf1a420,
+  0xf1ac20, 0xf1b420, 0xf1bc20, 0xf1c420, 0xf1cc20, 0xf1d420, 0xf1dc20, 0xf1e420,
+  0xf1ec20, 0xf1f420, 0xf1fc20, 0xf20420, 0xf20c20, 0xf21420, 0x0, 0x0,
+  0xf21c20, 0xf22420, 0xf22c20, 0xf23420, 0xf23c20, 0xf24420, 0xf24c20, 0xf25420,
+  0xf25c20, 0xf26420, 0xf26c20, 0xf27420, 0xf27c20, 0xf28420, 0xf28c20, 0xf29420,
+  0xf29c20, 0xf2a420, 0xf2ac20, 0xf2b420, 0xf2bc20, 0xf2c420, 0xf2cc20, 0xf2d420,
+  0xf2dc20, 0xf2e420, 0xf2ec20, 0xf2f420, 0xf2fc20, 0xf30420, 0xf30c20, 0xf31420,
+  0xf31c20, 0xf32420, 0xf32c20, 0xf33420, 0xf33c20, 0xf34420, 0xf34c20, 0xf35420,
+  0xf35c20, 0xf36420, 0xf36c20, 0xf37420, 0xf37c20, 0xf38420, 0xf38c20, 0xf39420,
+  0xf39c20, 0xf3a420, 0xf3ac20, 0xf3b420, 0xf3bc20, 0xf3c420, 0xf3cc20, 0xf3d420,
+  0xf3dc20, 0xf3e420, 0xf3ec20, 0xf3f420, 0xf3fc20, 0xf40420, 0xf40c20, 0xf41420,
+  0xf41c20, 0xf42420, 0xf42c20, 0xf43420, 0xf43c20, 0xf44420, 0xf44c20, 0xf45420,
+  0xf45c20, 0xf46420, 0xf46c20, 0xf47420, 0xf47c20, 0xf48420, 0xf48c20, 0xf49420,
+  0xf49c20, 0xf4a420, 0xf4ac20, 0xf4b420, 0xf4bc20, 0xf4c420, 0xf4cc20, 0xf4d420,
+  0xf4dc20, 0xf4e420, 0xf4ec20, 0xf4f420, 0xf4fc20, 0xf50420, 0xf50c20, 0xf51420,
+  0xf51c20, 0xf52420, 0xf52c20, 0xf53420, 0xf53c20, 0xf54420, 0xf54c20, 0xf55420,
+  0xf55c20, 0xf56420, 0xf56c20, 0xf57420, 0xf57c20, 0xf58420, 0xf58c20, 0xf59420,
+  0xf59c20, 0xf5a420, 0xf5ac20, 0xf5b420, 0xf5bc20, 0xf5c420, 0xf5cc20, 0xf5d420,
+  0xf5dc20, 0xf5e420, 0xf5ec20, 0xf5f420, 0xf5fc20, 0xf60420, 0xf60c20, 0xf61420,
+  0xf61c20, 0xf62420, 0xf62c20, 0xf63420, 0xf63c20, 0xf64420, 0xf64c20, 0xf65420,
+  0xf65c20, 0xf66420, 0xf66c20, 0xf67420, 0xf67c20, 0xf68420, 0xf68c20, 0xf69420,
+  0xf69c20, 0xf6a420, 0xf6ac20, 0xf6b420, 0xf6bc20, 0xf6c420, 0xf6cc20, 0xf6d420,
+  0xf6dc20, 0xf6e420, 0xf6ec20, 0xf6f420, 0xf6fc20, 0xf70420, 0xf70c20, 0xf71420,
+  0xf71c20, 0xf72420, 0xf72c20, 0xf73420, 0xf73c20, 0xf74420, 0xf74c20, 0xf75420,
+  0xf75c20, 0xf76420, 0xf76c20, 0xf77420, 0xf77c20, 0xf78420, 0xf78c20, 0xf79420,
+  0xf79c20, 0xf7a420, 0xf7ac20, 0xf7b420, 0xf7bc20, 0xf7c420, 0xf7cc20, 0xf7d420,
+  0xf7dc20, 0xf7e420, 0xf7ec20, 0xf7f420, 0xf7fc20, 0xf80420, 0xf80c20, 0xf81420,
+  0xf81c20, 0xf82420, 0xf82c20, 0xf83420, 0xf83c20, 0xf84420, 0xf84c20, 0xf85420,
+  0xf85c20, 0xf86420, 0xf86c20, 0xf87420, 0xf87c20, 0xf88420, 0xf88c20, 0xf89420,
+  0xf89c20, 0xf8a420, 0xf8ac20, 0xf8b420, 0xf8bc20, 0xf8c420, 0xf8cc20, 0xf8d420,
+  0xf8dc20, 0xf8e420, 0xf8ec20, 0xf8f420, 0xf8fc20, 0xf90420, 0xf90c20, 0xf91420,
+  0xf91c20, 0xf92420, 0xf92c20, 0xf93420, 0xf93c20, 0xf94420, 0xf94c20, 0xf95420,
+  0xf95c20, 0xf96420, 0xf96c20, 0xf97420, 0xf97c20, 0xf98420, 0xf98c20, 0xf99420,
+  0xf99c20, 0xf9a420, 0xf9ac20, 0xf9b420, 0xf9bc20, 0xf9c420, 0xf9cc20, 0xf9d420,
+  0xf9dc20, 0xf9e420, 0xf9ec20, 0xf9f420, 0xf9fc20, 0xfa0420, 0xfa0c20, 0xfa1420,
+  0xfa1c20, 0xfa2420, 0xfa2c20, 0xfa3420, 0xfa3c20, 0xfa4420, 0xfa4c20, 0xfa5420,
+  0xfa5c20, 0xfa6420, 0xfa6c20, 0xfa7420, 0xfa7c20, 0xfa8420, 0xfa8c20, 0xfa9420,
+  0xfa9c20, 0xfaa420, 0xfaac20, 0xfab420, 0xfabc20, 0xfac420, 0xfacc20, 0xfad420,
+  0xfadc20, 0xfae420, 0xfaec20, 0xfaf420, 0xfafc20, 0xfb0420, 0xfb0c20, 0xfb1420,
+  0xfb1c20, 0xfb2420, 0xfb2c20, 0xfb3420, 0x0, 0x0, 0xfb3c20, 0xfb4420,
+  0xfb4c20, 0xfb5420, 0xfb5c20, 0xfb6420, 0xfb6c20, 0xfb7420, 0xfb7c20, 0xfb8420,
+  0xfb8c20, 0xfb9420, 0xfb9c20, 0xfba420, 0xfbac20, 0xfbb420, 0xfbbc20, 0xfbc420,
+  0xfbcc20, 0xfbd420, 0xfbdc20, 0xfbe420, 0xfbec20, 0xfbf420, 0xfbfc20, 0xfc0420,
+  0xfc0c20, 0xfc1420, 0xfc1c20, 0xfc2420, 0xfc2c20, 0xfc3420, 0xfc3c20, 0xfc4420,
+  0xfc4c20, 0xfc5420, 0xfc5c20, 0xfc6420, 0xfc6c20, 0xfc7420, 0xfc7c20, 0xfc8420,
+  0xfc8c20, 0xfc9420, 0xfc9c20, 0xfca420, 0xfcac20, 0xfcb420, 0xfcbc20, 0xfcc420,
+  0xfccc20, 0xfcd420, 0xfcdc20, 0xfce420, 0x0, 0xfcec20, 0xfcf420, 0xfcfc20,
+  0xfd0420, 0xfd0c20, 0xfd1420, 0xfd1c20, 0xfd2420, 0xfd2c20, 0xfd3420, 0xfd3c20,
+  0xfd4420, 0xfd4c20, 0xfd5420, 0xfd5c20, 0xfd6420, 0xfd6c20, 0xfd7420, 0xfd7c20,
+  0xfd8420, 0xfd8c20, 0xfd9420, 0xfd9c20, 0xfda420, 0xfdac20, 0xfdb420, 0xfdbc20,
+  0x0, 0xfdc420, 0xfdcc20, 0x0, 0xfdd420, 0x0, 0x0, 0xfddc20,
+  0x0, 0xfde420, 0xfdec20, 0xfdf420, 0xfdfc20, 0xfe0420, 0xfe0c20, 0xfe1420,
+  0xfe1c20, 0xfe2420, 0xfe2c20, 0x0, 0xfe3420, 0xfe3c20, 0xfe4420, 0xfe4c20,
+  0x0, 0xfe5420, 0x0, 0xfe5c20, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0xfe6420, 0x0, 0x0, 0x0, 0x0, 0xfe6c20,
+  0x0, 0xfe7420, 0x0, 0xfe7c20, 0x0, 0xfe8420, 0xfe8c20, 0xfe9420,
+  0x0, 0xfe9c20, 0xfea420, 0x0, 0xfeac20, 0x0, 0x0, 0xfeb420,
+  0x0, 0xfebc20, 0x0, 0xfec420, 0x0, 0xfecc20, 0x0, 0xfed420,
+  0x0, 0xfedc20, 0xfee420, 0x0, 0xfeec20, 0x0, 0x0, 0xfef420,
+  0xfefc20, 0xff0420, 0xff0c20, 0x0, 0xff1420, 0xff1c20, 0xff2420, 0xff2c20,
+  0xff3420, 0xff3c20, 0xff4420, 0x0, 0xff4c20, 0xff5420, 0xff5c20, 0xff6420,
+  0x0, 0xff6c20, 0xff7420, 0xff7c20, 0xff8420, 0x0, 0xff8c20, 0x0,
+  0xff9420, 0xff9c20, 0xffa420, 0xffac20, 0xffb420, 0xffbc20, 0xffc420, 0xffcc20,
+  0xffd420, 0xffdc20, 0x0, 0xffe420, 0xffec20, 0xfff420, 0xfffc20, 0x1000420,
+  0x1000c20, 0x1001420, 0x1001c20, 0x1002420, 0x1002c20, 0x1003420, 0x1003c20, 0x1004420,
+  0x1004c20, 0x1005420, 0x1005c20, 0x1006420, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x1006c20, 0x1007420, 0x1007c20, 0x0, 0x1008420, 0x1008c20, 0x1009420,
+  0x1009c20, 0x100a420, 0x0, 0x100ac20, 0x100b420, 0x100bc20, 0x100c420, 0x100cc20,
+  0x100d420, 0x100dc20, 0x100e420, 0x100ec20, 0x100f420, 0x100fc20, 0x1010420, 0x1010c20,
+  0x1011420, 0x1011c20, 0x1012420, 0x1012c20, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x1013440, 0x1014440, 0x1015440, 0x1016440, 0x1017440, 0x1018440, 0x1019440, 0x101a440,
+  0x101b440, 0x101c440, 0x101d440, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x101e460, 0x101fc60, 0x1021460, 0x1022c60, 0x1024460, 0x1025c60, 0x1027460, 0x1028c60,
+  0x102a460, 0x102bc60, 0x102d460, 0x102ec60, 0x1030460, 0x1031c60, 0x1033460, 0x1034c60,
+  0x1036460, 0x1037c60, 0x1039460, 0x103ac60, 0x103c460, 0x103dc60, 0x103f460, 0x1040c60,
+  0x1042460, 0x1043c60, 0x1045460, 0x1046c20, 0x1047420, 0x1047c40, 0x1048c40, 0x0,
+  0x1049c20, 0x104a420, 0x104ac20, 0x104b420, 0x104bc20, 0x104c420, 0x104cc20, 0x104d420,
+  0x104dc20, 0x104e420, 0x104ec20, 0x104f420, 0x104fc20, 0x1050420, 0x1050c20, 0x1051420,
+  0x1051c20, 0x1052420, 0x1052c20, 0x1053420, 0x1053c20, 0x1054420, 0x1054c20, 0x1055420,
+  0x1055c20, 0x1056420, 0x1056c40, 0x1057c40, 0x1058c40, 0x1059c40, 0x105ac60, 0x105c440,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x105d440, 0x105e440, 0x105f440, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x1060440, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x1061440, 0x1062440, 0x1063420, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x1063c20, 0x1064420, 0x1064c20, 0x1065440, 0x1066420, 0x1066c20, 0x1067420, 0x1067c20,
+  0x1068420, 0x1068c20, 0x1069420, 0x1069c20, 0x106a420, 0x106ac20, 0x106b420, 0x106bc20,
+  0x106c420, 0x106cc20, 0x106d420, 0x106dc20, 0x106e420, 0x106ec20, 0x106f420, 0x106fc20,
+  0x1070420, 0x1070c20, 0x1071420, 0x1071c20, 0x1072420, 0x1072c20, 0x1073420, 0x1073c20,
+  0x1074420, 0x1074c20, 0x1075420, 0x1075c20, 0x1076420, 0x1076c20, 0x1077420, 0x1077c20,
+  0x1078420, 0x1078c20, 0x1079420, 0x1079c20, 0x0, 0x0, 0x0, 0x0,
+  0x107a460, 0x107bc60, 0x107d460, 0x107ec60, 0x1080460, 0x1081c60, 0x1083460, 0x1084c60,
+  0x1086460, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x1087c20, 0x1088420, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x1088821, 0x1089021, 0x1089821, 0x108a021, 0x108a821, 0x108b021, 0x108b821, 0x108c021,
+  0x108c821, 0x108d021, 0x108d821, 0x108e021, 0x108e821, 0x108f021, 0x108f821, 0x1090021,
+  0x1090821, 0x1091021, 0x1091821, 0x1092021, 0x1092821, 0x1093021, 0x1093821, 0x1094021,
+  0x1094821, 0x1095021, 0x1095821, 0x1096021, 0x1096821, 0x1097021, 0x1097821, 0x1098021,
+  0x1098821, 0x1099021, 0x1099821, 0x109a021, 0x109a821, 0x109b021, 0x109b821, 0x109c021,
+  0x109c821, 0x109d021, 0x109d821, 0x109e021, 0x109e821, 0x109f021, 0x109f821, 0x10a0021,
+  0x10a0821, 0x10a1021, 0x10a1821, 0x10a2021, 0x10a2821, 0x10a3021, 0x10a3821, 0x10a4021,
+  0x10a4821, 0x10a5021, 0x10a5821, 0x10a6021, 0x10a6821, 0x10a7021, 0x10a7821, 0x10a8021,
+  0x10a8821, 0x10a9021, 0x10a9821, 0x10aa021, 0x10aa821, 0x10ab021, 0x10ab821, 0x10ac021,
+  0x10ac821, 0x10ad021, 0x10ad821, 0x10ae021, 0x10ae821, 0x10af021, 0x10af821, 0x10b0021,
+  0x10b0821, 0x10b1021, 0x10b1821, 0x10b2021, 0x10b2821, 0x10b3021, 0x10b3821, 0x10b4021,
+  0x10b4821, 0x10b5021, 0x10b5821, 0x10b6021, 0x10b6821, 0x10b7021, 0x10b7821, 0x10b8021,
+  0x10b8821, 0x10b9021, 0x10b9821, 0x10ba021, 0x10ba821, 0x10bb021, 0x10bb821, 0x10bc021,
+  0x10bc821, 0x10bd021, 0x10bd821, 0x10be021, 0x10be821, 0x10bf021, 0x10bf821, 0x10c0021,
+  0x10c0821, 0x10c1021, 0x10c1821, 0x10c2021, 0x10c2821, 0x10c3021, 0x10c3821, 0x10c4021,
+  0x10c4821, 0x10c5021, 0x10c5821, 0x10c6021, 0x10c6821, 0x10c7021, 0x10c7821, 0x10c8021,
+  0x10c8821, 0x10c9021, 0x10c9821, 0x10ca021, 0x10ca821, 0x10cb021, 0x10cb821, 0x10cc021,
+  0x10cc821, 0x10cd021, 0x10cd821, 0x10ce021, 0x10ce821, 0x10cf021, 0x10cf821, 0x10d0021,
+  0x10d0821, 0x10d1021, 0x10d1821, 0x10d2021, 0x10d2821, 0x10d3021, 0x10d3821, 0x10d4021,
+  0x10d4821, 0x10d5021, 0x10d5821, 0x10d6021, 0x10d6821, 0x10d7021, 0x10d7821, 0x10d8021,
+  0x10d8821, 0x10d9021, 0x10d9821, 0x10da021, 0x10da821, 0x10db021, 0x10db821, 0x10dc021,
+  0x10dc821, 0x10dd021, 0x10dd821, 0x10de021, 0x10de821, 0x10df021, 0x10df821, 0x10e0021,
+  0x10e0821, 0x10e1021, 0x10e1821, 0x10e2021, 0x10e2821, 0x10e3021, 0x10e3821, 0x10e4021,
+  0x10e4821, 0x10e5021, 0x10e5821, 0x10e6021, 0x10e6821, 0x10e7021, 0x10e7821, 0x10e8021,
+  0x10e8821, 0x10e9021, 0x10e9821, 0x10ea021, 0x10ea821, 0x10eb021, 0x10eb821, 0x10ec021,
+  0x10ec821, 0x10ed021, 0x10ed821, 0x10ee021, 0x10ee821, 0x10ef021, 0x10ef821, 0x10f0021,
+  0x10f0821, 0x10f1021, 0x10f1821, 0x10f2021, 0x10f2821, 0x10f3021, 0x10f3821, 0x10f4021,
+  0x10f4821, 0x10f5021, 0x10f5821, 0x10f6021, 0x10f6821, 0x10f7021, 0x10f7821, 0x10f8021,
+  0x10f8821, 0x10f9021, 0x10f9821, 0x10fa021, 0x10fa821, 0x10fb021, 0x10fb821, 0x10fc021,
+  0x10fc821, 0x10fd021, 0x10fd821, 0x10fe021, 0x10fe821, 0x10ff021, 0x10ff821, 0x1100021,
+  0x1100821, 0x1101021, 0x1101821, 0x1102021, 0x1102821, 0x1103021, 0x1103821, 0x1104021,
+  0x1104821, 0x1105021, 0x1105821, 0x1106021, 0x1106821, 0x1107021, 0x1107821, 0x1108021,
+  0x1108821, 0x1109021, 0x1109821, 0x110a021, 0x110a821, 0x110b021, 0x110b821, 0x110c021,
+  0x110c821, 0x110d021, 0x110d821, 0x110e021, 0x110e821, 0x110f021, 0x110f821, 0x1110021,
+  0x1110821, 0x1111021, 0x1111821, 0x1112021, 0x1112821, 0x1113021, 0x1113821, 0x1114021,
+  0x1114821, 0x1115021, 0x1115821, 0x1116021, 0x1116821, 0x1117021, 0x1117821, 0x1118021,
+  0x1118821, 0x1119021, 0x1119821, 0x111a021, 0x111a821, 0x111b021, 0x111b821, 0x111c021,
+  0x111c821, 0x111d021, 0x111d821, 0x111e021, 0x111e821, 0x111f021, 0x111f821, 0x1120021,
+  0x1120821, 0x1121021, 0x1121821, 0x1122021, 0x1122821, 0x1123021, 0x1123821, 0x1124021,
+  0x1124821, 0x1125021, 0x1125821, 0x1126021, 0x1126821, 0x1127021, 0x1127821, 0x1128021,
+  0x1128821, 0x1129021, 0x1129821, 0x112a021, 0x112a821, 0x112b021, 0x112b821, 0x112c021,
+  0x112c821, 0x112d021, 0x112d821, 0x112e021, 0x112e821, 0x112f021, 0x112f821, 0x1130021,
+  0x1130821, 0x1131021, 0x1131821, 0x1132021, 0x1132821, 0x1133021, 0x1133821, 0x1134021,
+  0x1134821, 0x1135021, 0x1135821, 0x1136021, 0x1136821, 0x1137021, 0x1137821, 0x1138021,
+  0x1138821, 0x1139021, 0x1139821, 0x113a021, 0x113a821, 0x113b021, 0x113b821, 0x113c021,
+  0x113c821, 0x113d021, 0x113d821, 0x113e021, 0x113e821, 0x113f021, 0x113f821, 0x1140021,
+  0x1140821, 0x1141021, 0x1141821, 0x1142021, 0x1142821, 0x1143021, 0x1143821, 0x1144021,
+  0x1144821, 0x1145021, 0x1145821, 0x1146021, 0x1146821, 0x1147021, 0x1147821, 0x1148021,
+  0x1148821, 0x1149021, 0x1149821, 0x114a021, 0x114a821, 0x114b021, 0x114b821, 0x114c021,
+  0x114c821, 0x114d021, 0x114d821, 0x114e021, 0x114e821, 0x114f021, 0x114f821, 0x1150021,
+  0x1150821, 0x1151021, 0x1151821, 0x1152021, 0x1152821, 0x1153021, 0x1153821, 0x1154021,
+  0x1154821, 0x1155021, 0x1155821, 0x1156021, 0x1156821, 0x1157021, 0x1157821, 0x1158021,
+  0x1158821, 0x1159021, 0x1159821, 0x115a021, 0x115a821, 0x115b021, 0x115b821, 0x115c021,
+  0x115c821, 0x115d021, 0x115d821, 0x115e021, 0x115e821, 0x115f021, 0x115f821, 0x1160021,
+  0x1160821, 0x1161021, 0x1161821, 0x1162021, 0x1162821, 0x1163021, 0x1163821, 0x1164021,
+  0x1164821, 0x1165021, 0x1165821, 0x1166021, 0x1166821, 0x1167021, 0x1167821, 0x1168021,
+  0x1168821, 0x1169021, 0x1169821, 0x116a021, 0x116a821, 0x116b021, 0x116b821, 0x116c021,
+  0x116c821, 0x116d021, 0x116d821, 0x116e021, 0x116e821, 0x116f021, 0x116f821, 0x1170021,
+  0x1170821, 0x1171021, 0x1171821, 0x1172021, 0x1172821, 0x1173021, 0x1173821, 0x1174021,
+  0x1174821, 0x1175021, 0x1175821, 0x1176021, 0x1176821, 0x1177021, 0x1177821, 0x1178021,
+  0x1178821, 0x1179021, 0x1179821, 0x117a021, 0x117a821, 0x117b021, 0x117b821, 0x117c021,
+  0x117c821, 0x117d021, 0x117d821, 0x117e021, 0x117e821, 0x117f021, 0x117f821, 0x1180021,
+  0x1180821, 0x1181021, 0x1181821, 0x1182021, 0x1182821, 0x1183021, 0x1183821, 0x1184021,
+  0x1184821, 0x1185021, 0x1185821, 0x1186021, 0x1186821, 0x1187021, 0x1187821, 0x1188021,
+  0x1188821, 0x1189021, 0x1189821, 0x118a021, 0x118a821, 0x118b021, 0x118b821, 0x118c021,
+  0x118c821, 0x118d021, 0x118d821, 0x118e021, 0x118e821, 0x118f021, 0x118f821, 0x1190021,
+  0x1190821, 0x1191021, 0x1191821, 0x1192021, 0x1192821, 0x1193021, 0x1193821, 0x1194021,
+  0x1194821, 0x1195021, 0x1195821, 0x1196021, 0x1196821, 0x1197021, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 };
 
 uint32_t const* unicode_decompose(uint32_t codePoint, bool compatible, uint8_t* len) {
-  switch (codePoint) {
-    case 0x00C0: *len = 2; return &unicode_decompose_lookup[24];
-    case 0x00C1: *len = 2; return &unicode_decompose_lookup[26];
-    case 0x00C2: *len = 2; return &unicode_decompose_lookup[28];
-    case 0x00C3: *len = 2; return &unicode_decompose_lookup[30];
-    case 0x00C4: *len = 2; return &unicode_decompose_lookup[32];
-    case 0x00C5: *len = 2; return &unicode_decompose_lookup[34];
-    case 0x00C7: *len = 2; return &unicode_decompose_lookup[36];
-    case 0x00C8: *len = 2; return &unicode_decompose_lookup[38];
-    case 0x00C9: *len = 2; return &unicode_decompose_lookup[40];
-    case 0x00CA: *len = 2; return &unicode_decompose_lookup[42];
-    case 0x00CB: *len = 2; return &unicode_decompose_lookup[44];
-    case 0x00CC: *len = 2; return &unicode_decompose_lookup[46];
-    case 0x00CD: *len = 2; return &unicode_decompose_lookup[48];
-    case 0x00CE: *len = 2; return &unicode_decompose_lookup[50];
-    case 0x00CF: *len = 2; return &unicode_decompose_lookup[52];
-    case 0x00D1: *len = 2; return &unicode_decompose_lookup[54];
-    case 0x00D2: *len = 2; return &unicode_decompose_lookup[56];
-    case 0x00D3: *len = 2; return &unicode_decompose_lookup[58];
-    case 0x00D4: *len = 2; return &unicode_decompose_lookup[60];
-    case 0x00D5: *len = 2; return &unicode_decompose_lookup[62];
-    case 0x00D6: *len = 2; return &unicode_decompose_lookup[64];
-    case 0x00D9: *len = 2; return &unicode_decompose_lookup[66];
-    case 0x00DA: *len = 2; return &unicode_decompose_lookup[68];
-    case 0x00DB: *len = 2; return &unicode_decompose_lookup[70];
-    case 0x00DC: *len = 2; return &unicode_decompose_lookup[72];
-    case 0x00DD: *len = 2; return &unicode_decompose_lookup[74];
-    case 0x00E0: *len = 2; return &unicode_decompose_lookup[76];
-    case 0x00E1: *len = 2; return &unicode_decompose_lookup[78];
-    case 0x00E2: *len = 2; return &unicode_decompose_lookup[80];
-    case 0x00E3: *len = 2; return &unicode_decompose_lookup[82];
-    case 0x00E4: *len = 2; return &unicode_decompose_lookup[84];
-    case 0x00E5: *len = 2; return &unicode_decompose_lookup[86];
-    case 0x00E7: *len = 2; return &unicode_decompose_lookup[88];
-    case 0x00E8: *len = 2; return &unicode_decompose_lookup[90];
-    case 0x00E9: *len = 2; return &unicode_decompose_lookup[92];
-    case 0x00EA: *len = 2; return &unicode_decompose_lookup[94];
-    case 0x00EB: *len = 2; return &unicode_decompose_lookup[96];
-    case 0x00EC: *len = 2; return &unicode_decompose_lookup[98];
-    case 0x00ED: *len = 2; return &unicode_decompose_lookup[100];
-    case 0x00EE: *len = 2; return &unicode_decompose_lookup[102];
-    case 0x00EF: *len = 2; return &unicode_decompose_lookup[104];
-    case 0x00F1: *len = 2; return &unicode_decompose_lookup[106];
-    case 0x00F2: *len = 2; return &unicode_decompose_lookup[108];
-    case 0x00F3: *len = 2; return &unicode_decompose_lookup[110];
-    case 0x00F4: *len = 2; return &unicode_decompose_lookup[112];
-    case 0x00F5: *len = 2; return &unicode_decompose_lookup[114];
-    case 0x00F6: *len = 2; return &unicode_decompose_lookup[116];
-    case 0x00F9: *len = 2; return &unicode_decompose_lookup[118];
-    case 0x00FA: *len = 2; return &unicode_decompose_lookup[120];
-    case 0x00FB: *len = 2; return &unicode_decompose_lookup[122];
-    case 0x00FC: *len = 2; return &unicode_decompose_lookup[124];
-    case 0x00FD: *len = 2; return &unicode_decompose_lookup[126];
-    case 0x00FF: *len = 2; return &unicode_decompose_lookup[128];
-    case 0x0100: *len = 2; return &unicode_decompose_lookup[130];
-    case 0x0101: *len = 2; return &unicode_decompose_lookup[132];
-    case 0x0102: *len = 2; return &unicode_decompose_lookup[134];
-    case 0x0103: *len = 2; return &unicode_decompose_lookup[136];
-    case 0x0104: *len = 2; return &unicode_decompose_lookup[138];
-    case 0x0105: *len = 2; return &unicode_decompose_lookup[140];
-    case 0x0106: *len = 2; return &unicode_decompose_lookup[142];
-    case 0x0107: *len = 2; return &unicode_decompose_lookup[144];
-    case 0x0108: *len = 2; return &unicode_decompose_lookup[146];
-    case 0x0109: *len = 2; return &unicode_decompose_lookup[148];
-    case 0x010A: *len = 2; return &unicode_decompose_lookup[150];
-    case 0x010B: *len = 2; return &unicode_decompose_lookup[152];
-    case 0x010C: *len = 2; return &unicode_decompose_lookup[154];
-    case 0x010D: *len = 2; return &unicode_decompose_lookup[156];
-    case 0x010E: *len = 2; return &unicode_decompose_lookup[158];
-    case 0x010F: *len = 2; return &unicode_decompose_lookup[160];
-    case 0x0112: *len = 2; return &unicode_decompose_lookup[162];
-    case 0x0113: *len = 2; return &unicode_decompose_lookup[164];
-    case 0x0114: *len = 2; return &unicode_decompose_lookup[166];
-    case 0x0115: *len = 2; return &unicode_decompose_lookup[168];
-    case 0x0116: *len = 2; return &unicode_decompose_lookup[170];
-    case 0x0117: *len = 2; return &unicode_decompose_lookup[172];
-    case 0x0118: *len = 2; return &unicode_decompose_lookup[174];
-    case 0x0119: *len = 2; return &unicode_decompose_lookup[176];
-    case 0x011A: *len = 2; return &unicode_decompose_lookup[178];
-    case 0x011B: *len = 2; return &unicode_decompose_lookup[180];
-    case 0x011C: *len = 2; return &unicode_decompose_lookup[182];
-    case 0x011D: *len = 2; return &unicode_decompose_lookup[184];
-    case 0x011E: *len = 2; return &unicode_decompose_lookup[186];
-    case 0x011F: *len = 2; return &unicode_decompose_lookup[188];
-    case 0x0120: *len = 2; return &unicode_decompose_lookup[190];
-    case 0x0121: *len = 2; return &unicode_decompose_lookup[192];
-    case 0x0122: *len = 2; return &unicode_decompose_lookup[194];
-    case 0x0123: *len = 2; return &unicode_decompose_lookup[196];
-    case 0x0124: *len = 2; return &unicode_decompose_lookup[198];
-    case 0x0125: *len = 2; return &unicode_decompose_lookup[200];
-    case 0x0128: *len = 2; return &unicode_decompose_lookup[202];
-    case 0x0129: *len = 2; return &unicode_decompose_lookup[204];
-    case 0x012A: *len = 2; return &unicode_decompose_lookup[206];
-    case 0x012B: *len = 2; return &unicode_decompose_lookup[208];
-    case 0x012C: *len = 2; return &unicode_decompose_lookup[210];
-    case 0x012D: *len = 2; return &unicode_decompose_lookup[212];
-    case 0x012E: *len = 2; return &unicode_decompose_lookup[214];
-    case 0x012F: *len = 2; return &unicode_decompose_lookup[216];
-    case 0x0130: *len = 2; return &unicode_decompose_lookup[218];
-    case 0x0134: *len = 2; return &unicode_decompose_lookup[224];
-    case 0x0135: *len = 2; return &unicode_decompose_lookup[226];
-    case 0x0136: *len = 2; return &unicode_decompose_lookup[228];
-    case 0x0137: *len = 2; return &unicode_decompose_lookup[230];
-    case 0x0139: *len = 2; return &unicode_decompose_lookup[232];
-    case 0x013A: *len = 2; return &unicode_decompose_lookup[234];
-    case 0x013B: *len = 2; return &unicode_decompose_lookup[236];
-    case 0x013C: *len = 2; return &unicode_decompose_lookup[238];
-    case 0x013D: *len = 2; return &unicode_decompose_lookup[240];
-    case 0x013E: *len = 2; return &unicode_decompose_lookup[242];
-    case 0x0143: *len = 2; return &unicode_decompose_lookup[248];
-    case 0x0144: *len = 2; return &unicode_decompose_lookup[250];
-    case 0x0145: *len = 2; return &unicode_decompose_lookup[252];
-    case 0x0146: *len = 2; return &unicode_decompose_lookup[254];
-    case 0x0147: *len = 2; return &unicode_decompose_lookup[256];
-    case 0x0148: *len = 2; return &unicode_decompose_lookup[258];
-    case 0x014C: *len = 2; return &unicode_decompose_lookup[262];
-    case 0x014D: *len = 2; return &unicode_decompose_lookup[264];
-    case 0x014E: *len = 2; return &unicode_decompose_lookup[266];
-    case 0x014F: *len = 2; return &unicode_decompose_lookup[268];
-    case 0x0150: *len = 2; return &unicode_decompose_lookup[270];
-    case 0x0151: *len = 2; return &unicode_decompose_lookup[272];
-    case 0x0154: *len = 2; return &unicode_decompose_lookup[274];
-    case 0x0155: *len = 2; return &unicode_decompose_lookup[276];
-    case 0x0156: *len = 2; return &unicode_decompose_lookup[278];
-    case 0x0157: *len = 2; return &unicode_decompose_lookup[280];
-    case 0x0158: *len = 2; return &unicode_decompose_lookup[282];
-    case 0x0159: *len = 2; return &unicode_decompose_lookup[284];
-    case 0x015A: *len = 2; return &unicode_decompose_lookup[286];
-    case 0x015B: *len = 2; return &unicode_decompose_lookup[288];
-    case 0x015C: *len = 2; return &unicode_decompose_lookup[290];
-    case 0x015D: *len = 2; return &unicode_decompose_lookup[292];
-    case 0x015E: *len = 2; return &unicode_decompose_lookup[294];
-    case 0x015F: *len = 2; return &unicode_decompose_lookup[296];
-    case 0x0160: *len = 2; return &unicode_decompose_lookup[298];
-    case 0x0161: *len = 2; return &unicode_decompose_lookup[300];
-    case 0x0162: *len = 2; return &unicode_decompose_lookup[302];
-    case 0x0163: *len = 2; return &unicode_decompose_lookup[304];
-    case 0x0164: *len = 2; return &unicode_decompose_lookup[306];
-    case 0x0165: *len = 2; return &unicode_decompose_lookup[308];
-    case 0x0168: *len = 2; return &unicode_decompose_lookup[310];
-    case 0x0169: *len = 2; return &unicode_decompose_lookup[312];
-    case 0x016A: *len = 2; return &unicode_decompose_lookup[314];
-    case 0x016B: *len = 2; return &unicode_decompose_lookup[316];
-    case 0x016C: *len = 2; return &unicode_decompose_lookup[318];
-    case 0x016D: *len = 2; return &unicode_decompose_lookup[320];
-    case 0x016E: *len = 2; return &unicode_decompose_lookup[322];
-    case 0x016F: *len = 2; return &unicode_decompose_lookup[324];
-    case 0x0170: *len = 2; return &unicode_decompose_lookup[326];
-    case 0x0171: *len = 2; return &unicode_decompose_lookup[328];
-    case 0x0172: *len = 2; return &unicode_decompose_lookup[330];
-    case 0x0173: *len = 2; return &unicode_decompose_lookup[332];
-    case 0x0174: *len = 2; return &unicode_decompose_lookup[334];
-    case 0x0175: *len = 2; return &unicode_decompose_lookup[336];
-    case 0x0176: *len = 2; return &unicode_decompose_lookup[338];
-    case 0x0177: *len = 2; return &unicode_decompose_lookup[340];
-    case 0x0178: *len = 2; return &unicode_decompose_lookup[342];
-    case 0x0179: *len = 2; return &unicode_decompose_lookup[344];
-    case 0x017A: *len = 2; return &unicode_decompose_lookup[346];
-    case 0x017B: *len = 2; return &unicode_decompose_lookup[348];
-    case 0x017C: *len = 2; return &unicode_decompose_lookup[350];
-    case 0x017D: *len = 2; return &unicode_decompose_lookup[352];
-    case 0x017E: *len = 2; return &unicode_decompose_lookup[354];
-    case 0x01A0: *len = 2; return &unicode_decompose_lookup[357];
-    case 0x01A1: *len = 2; return &unicode_decompose_lookup[359];
-    case 0x01AF: *len = 2; return &unicode_decompose_lookup[361];
-    case 0x01B0: *len = 2; return &unicode_decompose_lookup[363];
-    case 0x01CD: *len = 2; return &unicode_decompose_lookup[383];
-    case 0x01CE: *len = 2; return &unicode_decompose_lookup[385];
-    case 0x01CF: *len = 2; return &unicode_decompose_lookup[387];
-    case 0x01D0: *len = 2; return &unicode_decompose_lookup[389];
-    case 0x01D1: *len = 2; return &unicode_decompose_lookup[391];
-    case 0x01D2: *len = 2; return &unicode_decompose_lookup[393];
-    case 0x01D3: *len = 2; return &unicode_decompose_lookup[395];
-    case 0x01D4: *len = 2; return &unicode_decompose_lookup[397];
-    case 0x01D5: *len = 2; return &unicode_decompose_lookup[399];
-    case 0x01D6: *len = 2; return &unicode_decompose_lookup[401];
-    case 0x01D7: *len = 2; return &unicode_decompose_lookup[403];
-    case 0x01D8: *len = 2; return &unicode_decompose_lookup[405];
-    case 0x01D9: *len = 2; return &unicode_decompose_lookup[407];
-    case 0x01DA: *len = 2; return &unicode_decompose_lookup[409];
-    case 0x01DB: *len = 2; return &unicode_decompose_lookup[411];
-    case 0x01DC: *len = 2; return &unicode_decompose_lookup[413];
-    case 0x01DE: *len = 2; return &unicode_decompose_lookup[415];
-    case 0x01DF: *len = 2; return &unicode_decompose_lookup[417];
-    case 0x01E0: *len = 2; return &unicode_decompose_lookup[419];
-    case 0x01E1: *len = 2; return &unicode_decompose_lookup[421];
-    case 0x01E2: *len = 2; return &unicode_decompose_lookup[423];
-    case 0x01E3: *len = 2; return &unicode_decompose_lookup[425];
-    case 0x01E6: *len = 2; return &unicode_decompose_lookup[427];
-    case 0x01E7: *len = 2; return &unicode_decompose_lookup[429];
-    case 0x01E8: *len = 2; return &unicode_decompose_lookup[431];
-    case 0x01E9: *len = 2; return &unicode_decompose_lookup[433];
-    case 0x01EA: *len = 2; return &unicode_decompose_lookup[435];
-    case 0x01EB: *len = 2; return &unicode_decompose_lookup[437];
-    case 0x01EC: *len = 2; return &unicode_decompose_lookup[439];
-    case 0x01ED: *len = 2; return &unicode_decompose_lookup[441];
-    case 0x01EE: *len = 2; return &unicode_decompose_lookup[443];
-    case 0x01EF: *len = 2; return &unicode_decompose_lookup[445];
-    case 0x01F0: *len = 2; return &unicode_decompose_lookup[447];
-    case 0x01F4: *len = 2; return &unicode_decompose_lookup[455];
-    case 0x01F5: *len = 2; return &unicode_decompose_lookup[457];
-    case 0x01F8: *len = 2; return &unicode_decompose_lookup[459];
-    case 0x01F9: *len = 2; return &unicode_decompose_lookup[461];
-    case 0x01FA: *len = 2; return &unicode_decompose_lookup[463];
-    case 0x01FB: *len = 2; return &unicode_decompose_lookup[465];
-    case 0x01FC: *len = 2; return &unicode_decompose_lookup[467];
-    case 0x01FD: *len = 2; return &unicode_decompose_lookup[469];
-    case 0x01FE: *len = 2; return &unicode_decompose_lookup[471];
-    case 0x01FF: *len = 2; return &unicode_decompose_lookup[473];
-    case 0x0200: *len = 2; return &unicode_decompose_lookup[475];
-    case 0x0201: *len = 2; return &unicode_decompose_lookup[477];
-    case 0x0202: *len = 2; return &unicode_decompose_lookup[479];
-    case 0x0203: *len = 2; return &unicode_decompose_lookup[481];
-    case 0x0204: *len = 2; return &unicode_decompose_lookup[483];
-    case 0x0205: *len = 2; return &unicode_decompose_lookup[485];
-    case 0x0206: *len = 2; return &unicode_decompose_lookup[487];
-    case 0x0207: *len = 2; return &unicode_decompose_lookup[489];
-    case 0x0208: *len = 2; return &unicode_decompose_lookup[491];
-    case 0x0209: *len = 2; return &unicode_decompose_lookup[493];
-    case 0x020A: *len = 2; return &unicode_decompose_lookup[495];
-    case 0x020B: *len = 2; return &unicode_decompose_lookup[497];
-    case 0x020C: *len = 2; return &unicode_decompose_lookup[499];
-    case 0x020D: *len = 2; return &unicode_decompose_lookup[501];
-    case 0x020E: *len = 2; return &unicode_decompose_lookup[503];
-    case 0x020F: *len = 2; return &unicode_decompose_lookup[505];
-    case 0x0210: *len = 2; return &unicode_decompose_lookup[507];
-    case 0x0211: *len = 2; return &unicode_decompose_lookup[509];
-    case 0x0212: *len = 2; return &unicode_decompose_lookup[511];
-    case 0x0213: *len = 2; return &unicode_decompose_lookup[513];
-    case 0x0214: *len = 2; return &unicode_decompose_lookup[515];
-    case 0x0215: *len = 2; return &unicode_decompose_lookup[517];
-    case 0x0216: *len = 2; return &unicode_decompose_lookup[519];
-    case 0x0217: *len = 2; return &unicode_decompose_lookup[521];
-    case 0x0218: *len = 2; return &unicode_decompose_lookup[523];
-    case 0x0219: *len = 2; return &unicode_decompose_lookup[525];
-    case 0x021A: *len = 2; return &unicode_decompose_lookup[527];
-    case 0x021B: *len = 2; return &unicode_decompose_lookup[529];
-    case 0x021E: *len = 2; return &unicode_decompose_lookup[531];
-    case 0x021F: *len = 2; return &unicode_decompose_lookup[533];
-    case 0x0226: *len = 2; return &unicode_decompose_lookup[535];
-    case 0x0227: *len = 2; return &unicode_decompose_lookup[537];
-    case 0x0228: *len = 2; return &unicode_decompose_lookup[539];
-    case 0x0229: *len = 2; return &unicode_decompose_lookup[541];
-    case 0x022A: *len = 2; return &unicode_decompose_lookup[543];
-    case 0x022B: *len = 2; return &unicode_decompose_lookup[545];
-    case 0x022C: *len = 2; return &unicode_decompose_lookup[547];
-    case 0x022D: *len = 2; return &unicode_decompose_lookup[549];
-    case 0x022E: *len = 2; return &unicode_decompose_lookup[551];
-    case 0x022F: *len = 2; return &unicode_decompose_lookup[553];
-    case 0x0230: *len = 2; return &unicode_decompose_lookup[555];
-    case 0x0231: *len = 2; return &unicode_decompose_lookup[557];
-    case 0x0232: *len = 2; return &unicode_decompose_lookup[559];
-    case 0x0233: *len = 2; return &unicode_decompose_lookup[561];
-    case 0x0340: *len = 1; return &unicode_decompose_lookup[589];
-    case 0x0341: *len = 1; return &unicode_decompose_lookup[590];
-    case 0x0343: *len = 1; return &unicode_decompose_lookup[591];
-    case 0x0344: *len = 2; return &unicode_decompose_lookup[592];
-    case 0x0374: *len = 1; return &unicode_decompose_lookup[594];
-    case 0x037E: *len = 1; return &unicode_decompose_lookup[597];
-    case 0x0385: *len = 2; return &unicode_decompose_lookup[600];
-    case 0x0386: *len = 2; return &unicode_decompose_lookup[602];
-    case 0x0387: *len = 1; return &unicode_decompose_lookup[604];
-    case 0x0388: *len = 2; return &unicode_decompose_lookup[605];
-    case 0x0389: *len = 2; return &unicode_decompose_lookup[607];
-    case 0x038A: *len = 2; return &unicode_decompose_lookup[609];
-    case 0x038C: *len = 2; return &unicode_decompose_lookup[611];
-    case 0x038E: *len = 2; return &unicode_decompose_lookup[613];
-    case 0x038F: *len = 2; return &unicode_decompose_lookup[615];
-    case 0x0390: *len = 2; return &unicode_decompose_lookup[617];
-    case 0x03AA: *len = 2; return &unicode_decompose_lookup[619];
-    case 0x03AB: *len = 2; return &unicode_decompose_lookup[621];
-    case 0x03AC: *len = 2; return &unicode_decompose_lookup[623];
-    case 0x03AD: *len = 2; return &unicode_decompose_lookup[625];
-    case 0x03AE: *len = 2; return &unicode_decompose_lookup[627];
-    case 0x03AF: *len = 2; return &unicode_decompose_lookup[629];
-    case 0x03B0: *len = 2; return &unicode_decompose_lookup[631];
-    case 0x03CA: *len = 2; return &unicode_decompose_lookup[633];
-    case 0x03CB: *len = 2; return &unicode_decompose_lookup[635];
-    case 0x03CC: *len = 2; return &unicode_decompose_lookup[637];
-    case 0x03CD: *len = 2; return &unicode_decompose_lookup[639];
-    case 0x03CE: *len = 2; return &unicode_decompose_lookup[641];
-    case 0x03D3: *len = 2; return &unicode_decompose_lookup[646];
-    case 0x03D4: *len = 2; return &unicode_decompose_lookup[648];
-    case 0x0400: *len = 2; return &unicode_decompose_lookup[658];
-    case 0x0401: *len = 2; return &unicode_decompose_lookup[660];
-    case 0x0403: *len = 2; return &unicode_decompose_lookup[662];
-    case 0x0407: *len = 2; return &unicode_decompose_lookup[664];
-    case 0x040C: *len = 2; return &unicode_decompose_lookup[666];
-    case 0x040D: *len = 2; return &unicode_decompose_lookup[668];
-    case 0x040E: *len = 2; return &unicode_decompose_lookup[670];
-    case 0x0419: *len = 2; return &unicode_decompose_lookup[672];
-    case 0x0439: *len = 2; return &unicode_decompose_lookup[674];
-    case 0x0450: *len = 2; return &unicode_decompose_lookup[676];
-    case 0x0451: *len = 2; return &unicode_decompose_lookup[678];
-    case 0x0453: *len = 2; return &unicode_decompose_lookup[680];
-    case 0x0457: *len = 2; return &unicode_decompose_lookup[682];
-    case 0x045C: *len = 2; return &unicode_decompose_lookup[684];
-    case 0x045D: *len = 2; return &unicode_decompose_lookup[686];
-    case 0x045E: *len = 2; return &unicode_decompose_lookup[688];
-    case 0x0476: *len = 2; return &unicode_decompose_lookup[690];
-    case 0x0477: *len = 2; return &unicode_decompose_lookup[692];
-    case 0x04C1: *len = 2; return &unicode_decompose_lookup[694];
-    case 0x04C2: *len = 2; return &unicode_decompose_lookup[696];
-    case 0x04D0: *len = 2; return &unicode_decompose_lookup[698];
-    case 0x04D1: *len = 2; return &unicode_decompose_lookup[700];
-    case 0x04D2: *len = 2; return &unicode_decompose_lookup[702];
-    case 0x04D3: *len = 2; return &unicode_decompose_lookup[704];
-    case 0x04D6: *len = 2; return &unicode_decompose_lookup[706];
-    case 0x04D7: *len = 2; return &unicode_decompose_lookup[708];
-    case 0x04DA: *len = 2; return &unicode_decompose_lookup[710];
-    case 0x04DB: *len = 2; return &unicode_decompose_lookup[712];
-    case 0x04DC: *len = 2; return &unicode_decompose_lookup[714];
-    case 0x04DD: *len = 2; return &unicode_decompose_lookup[716];
-    case 0x04DE: *len = 2; return &unicode_decompose_lookup[718];
-    case 0x04DF: *len = 2; return &unicode_decompose_lookup[720];
-    case 0x04E2: *len = 2; return &unicode_decompose_lookup[722];
-    case 0x04E3: *len = 2; return &unicode_decompose_lookup[724];
-    case 0x04E4: *len = 2; return &unicode_decompose_lookup[726];
-    case 0x04E5: *len = 2; return &unicode_decompose_lookup[728];
-    case 0x04E6: *len = 2; return &unicode_decompose_lookup[730];
-    case 0x04E7: *len = 2; return &unicode_decompose_lookup[732];
-    case 0x04EA: *len = 2; return &unicode_decompose_lookup[734];
-    case 0x04EB: *len = 2; return &unicode_decompose_lookup[736];
-    case 0x04EC: *len = 2; return &unicode_decompose_lookup[738];
-    case 0x04ED: *len = 2; return &unicode_decompose_lookup[740];
-    case 0x04EE: *len = 2; return &unicode_decompose_lookup[742];
-    case 0x04EF: *len = 2; return &unicode_decompose_lookup[744];
-    case 0x04F0: *len = 2; return &unicode_decompose_lookup[746];
-    case 0x04F1: *len = 2; return &unicode_decompose_lookup[748];
-    case 0x04F2: *len = 2; return &unicode_decompose_lookup[750];
-    case 0x04F3: *len = 2; return &unicode_decompose_lookup[752];
-    case 0x04F4: *len = 2; return &unicode_decompose_lookup[754];
-    case 0x04F5: *len = 2; return &unicode_decompose_lookup[756];
-    case 0x04F8: *len = 2; return &unicode_decompose_lookup[758];
-    case 0x04F9: *len = 2; return &unicode_decompose_lookup[760];
-    case 0x0622: *len = 2; return &unicode_decompose_lookup[764];
-    case 0x0623: *len = 2; return &unicode_decompose_lookup[766];
-    case 0x0624: *len = 2; return &unicode_decompose_lookup[768];
-    case 0x0625: *len = 2; return &unicode_decompose_lookup[770];
-    case 0x0626: *len = 2; return &unicode_decompose_lookup[772];
-    case 0x06C0: *len = 2; return &unicode_decompose_lookup[782];
-    case 0x06C2: *len = 2; return &unicode_decompose_lookup[784];
-    case 0x06D3: *len = 2; return &unicode_decompose_lookup[786];
-    case 0x0929: *len = 2; return &unicode_decompose_lookup[788];
-    case 0x0931: *len = 2; return &unicode_decompose_lookup[790];
-    case 0x0934: *len = 2; return &unicode_decompose_lookup[792];
-    case 0x0958: *len = 2; return &unicode_decompose_lookup[794];
-    case 0x0959: *len = 2; return &unicode_decompose_lookup[796];
-    case 0x095A: *len = 2; return &unicode_decompose_lookup[798];
-    case 0x095B: *len = 2; return &unicode_decompose_lookup[800];
-    case 0x095C: *len = 2; return &unicode_decompose_lookup[802];
-    case 0x095D: *len = 2; return &unicode_decompose_lookup[804];
-    case 0x095E: *len = 2; return &unicode_decompose_lookup[806];
-    case 0x095F: *len = 2; return &unicode_decompose_lookup[808];
-    case 0x09CB: *len = 2; return &unicode_decompose_lookup[810];
-    case 0x09CC: *len = 2; return &unicode_decompose_lookup[812];
-    case 0x09DC: *len = 2; return &unicode_decompose_lookup[814];
-    case 0x09DD: *len = 2; return &unicode_decompose_lookup[816];
-    case 0x09DF: *len = 2; return &unicode_decompose_lookup[818];
-    case 0x0A33: *len = 2; return &unicode_decompose_lookup[820];
-    case 0x0A36: *len = 2; return &unicode_decompose_lookup[822];
-    case 0x0A59: *len = 2; return &unicode_decompose_lookup[824];
-    case 0x0A5A: *len = 2; return &unicode_decompose_lookup[826];
-    case 0x0A5B: *len = 2; return &unicode_decompose_lookup[828];
-    case 0x0A5E: *len = 2; return &unicode_decompose_lookup[830];
-    case 0x0B48: *len = 2; return &unicode_decompose_lookup[832];
-    case 0x0B4B: *len = 2; return &unicode_decompose_lookup[834];
-    case 0x0B4C: *len = 2; return &unicode_decompose_lookup[836];
-    case 0x0B5C: *len = 2; return &unicode_decompose_lookup[838];
-    case 0x0B5D: *len = 2; return &unicode_decompose_lookup[840];
-    case 0x0B94: *len = 2; return &unicode_decompose_lookup[842];
-    case 0x0BCA: *len = 2; return &unicode_decompose_lookup[844];
-    case 0x0BCB: *len = 2; return &unicode_decompose_lookup[846];
-    case 0x0BCC: *len = 2; return &unicode_decompose_lookup[848];
-    case 0x0C48: *len = 2; return &unicode_decompose_lookup[850];
-    case 0x0CC0: *len = 2; return &unicode_decompose_lookup[852];
-    case 0x0CC7: *len = 2; return &unicode_decompose_lookup[854];
-    case 0x0CC8: *len = 2; return &unicode_decompose_lookup[856];
-    case 0x0CCA: *len = 2; return &unicode_decompose_lookup[858];
-    case 0x0CCB: *len = 2; return &unicode_decompose_lookup[860];
-    case 0x0D4A: *len = 2; return &unicode_decompose_lookup[862];
-    case 0x0D4B: *len = 2; return &unicode_decompose_lookup[864];
-    case 0x0D4C: *len = 2; return &unicode_decompose_lookup[866];
-    case 0x0DDA: *len = 2; return &unicode_decompose_lookup[868];
-    case 0x0DDC: *len = 2; return &unicode_decompose_lookup[870];
-    case 0x0DDD: *len = 2; return &unicode_decompose_lookup[872];
-    case 0x0DDE: *len = 2; return &unicode_decompose_lookup[874];
-    case 0x0F43: *len = 2; return &unicode_decompose_lookup[885];
-    case 0x0F4D: *len = 2; return &unicode_decompose_lookup[887];
-    case 0x0F52: *len = 2; return &unicode_decompose_lookup[889];
-    case 0x0F57: *len = 2; return &unicode_decompose_lookup[891];
-    case 0x0F5C: *len = 2; return &unicode_decompose_lookup[893];
-    case 0x0F69: *len = 2; return &unicode_decompose_lookup[895];
-    case 0x0F73: *len = 2; return &unicode_decompose_lookup[897];
-    case 0x0F75: *len = 2; return &unicode_decompose_lookup[899];
-    case 0x0F76: *len = 2; return &unicode_decompose_lookup[901];
-    case 0x0F78: *len = 2; return &unicode_decompose_lookup[905];
-    case 0x0F81: *len = 2; return &unicode_decompose_lookup[909];
-    case 0x0F93: *len = 2; return &unicode_decompose_lookup[911];
-    case 0x0F9D: *len = 2; return &unicode_decompose_lookup[913];
-    case 0x0FA2: *len = 2; return &unicode_decompose_lookup[915];
-    case 0x0FA7: *len = 2; return &unicode_decompose_lookup[917];
-    case 0x0FAC: *len = 2; return &unicode_decompose_lookup[919];
-    case 0x0FB9: *len = 2; return &unicode_decompose_lookup[921];
-    case 0x1026: *len = 2; return &unicode_decompose_lookup[923];
-    case 0x1B06: *len = 2; return &unicode_decompose_lookup[926];
-    case 0x1B08: *len = 2; return &unicode_decompose_lookup[928];
-    case 0x1B0A: *len = 2; return &unicode_decompose_lookup[930];
-    case 0x1B0C: *len = 2; return &unicode_decompose_lookup[932];
-    case 0x1B0E: *len = 2; return &unicode_decompose_lookup[934];
-    case 0x1B12: *len = 2; return &unicode_decompose_lookup[936];
-    case 0x1B3B: *len = 2; return &unicode_decompose_lookup[938];
-    case 0x1B3D: *len = 2; return &unicode_decompose_lookup[940];
-    case 0x1B40: *len = 2; return &unicode_decompose_lookup[942];
-    case 0x1B41: *len = 2; return &unicode_decompose_lookup[944];
-    case 0x1B43: *len = 2; return &unicode_decompose_lookup[946];
-    case 0x1E00: *len = 2; return &unicode_decompose_lookup[1046];
-    case 0x1E01: *len = 2; return &unicode_decompose_lookup[1048];
-    case 0x1E02: *len = 2; return &unicode_decompose_lookup[1050];
-    case 0x1E03: *len = 2; return &unicode_decompose_lookup[1052];
-    case 0x1E04: *len = 2; return &unicode_decompose_lookup[1054];
-    case 0x1E05: *len = 2; return &unicode_decompose_lookup[1056];
-    case 0x1E06: *len = 2; return &unicode_decompose_lookup[1058];
-    case 0x1E07: *len = 2; return &unicode_decompose_lookup[1060];
-    case 0x1E08: *len = 2; return &unicode_decompose_lookup[1062];
-    case 0x1E09: *len = 2; return &unicode_decompose_lookup[1064];
-    case 0x1E0A: *len = 2; return &unicode_decompose_lookup[1066];
-    case 0x1E0B: *len = 2; return &unicode_decompose_lookup[1068];
-    case 0x1E0C: *len = 2; return &unicode_decompose_lookup[1070];
-    case 0x1E0D: *len = 2; return &unicode_decompose_lookup[1072];
-    case 0x1E0E: *len = 2; return &unicode_decompose_lookup[1074];
-    case 0x1E0F: *len = 2; return &unicode_decompose_lookup[1076];
-    case 0x1E10: *len = 2; return &unicode_decompose_lookup[1078];
-    case 0x1E11: *len = 2; return &unicode_decompose_lookup[1080];
-    case 0x1E12: *len = 2; return &unicode_decompose_lookup[1082];
-    case 0x1E13: *len = 2; return &unicode_decompose_lookup[1084];
-    case 0x1E14: *len = 2; return &unicode_decompose_lookup[1086];
-    case 0x1E15: *len = 2; return &unicode_decompose_lookup[1088];
-    case 0x1E16: *len = 2; return &unicode_decompose_lookup[1090];
-    case 0x1E17: *len = 2; return &unicode_decompose_lookup[1092];
-    case 0x1E18: *len = 2; return &unicode_decompose_lookup[1094];
-    case 0x1E19: *len = 2; return &unicode_decompose_lookup[1096];
-    case 0x1E1A: *len = 2; return &unicode_decompose_lookup[1098];
-    case 0x1E1B: *len = 2; return &unicode_decompose_lookup[1100];
-    case 0x1E1C: *len = 2; return &unicode_decompose_lookup[1102];
-    case 0x1E1D: *len = 2; return &unicode_decompose_lookup[1104];
-    case 0x1E1E: *len = 2; return &unicode_decompose_lookup[1106];
-    case 0x1E1F: *len = 2; return &unicode_decompose_lookup[1108];
-    case 0x1E20: *len = 2; return &unicode_decompose_lookup[1110];
-    case 0x1E21: *len = 2; return &unicode_decompose_lookup[1112];
-    case 0x1E22: *len = 2; return &unicode_decompose_lookup[1114];
-    case 0x1E23: *len = 2; return &unicode_decompose_lookup[1116];
-    case 0x1E24: *len = 2; return &unicode_decompose_lookup[1118];
-    case 0x1E25: *len = 2; return &unicode_decompose_lookup[1120];
-    case 0x1E26: *len = 2; return &unicode_decompose_lookup[1122];
-    case 0x1E27: *len = 2; return &unicode_decompose_lookup[1124];
-    case 0x1E28: *len = 2; return &unicode_decompose_lookup[1126];
-    case 0x1E29: *len = 2; return &unicode_decompose_lookup[1128];
-    case 0x1E2A: *len = 2; return &unicode_decompose_lookup[1130];
-    case 0x1E2B: *len = 2; return &unicode_decompose_lookup[1132];
-    case 0x1E2C: *len = 2; return &unicode_decompose_lookup[1134];
-    case 0x1E2D: *len = 2; return &unicode_decompose_lookup[1136];
-    case 0x1E2E: *len = 2; return &unicode_decompose_lookup[1138];
-    case 0x1E2F: *len = 2; return &unicode_decompose_lookup[1140];
-    case 0x1E30: *len = 2; return &unicode_decompose_lookup[1142];
-    case 0x1E31: *len = 2; return &unicode_decompose_lookup[1144];
-    case 0x1E32: *len = 2; return &unicode_decompose_lookup[1146];
-    case 0x1E33: *len = 2; return &unicode_decompose_lookup[1148];
-    case 0x1E34: *len = 2; return &unicode_decompose_lookup[1150];
-    case 0x1E35: *len = 2; return &unicode_decompose_lookup[1152];
-    case 0x1E36: *len = 2; return &unicode_decompose_lookup[1154];
-    case 0x1E37: *len = 2; return &unicode_decompose_lookup[1156];
-    case 0x1E38: *len = 2; return &unicode_decompose_lookup[1158];
-    case 0x1E39: *len = 2; return &unicode_decompose_lookup[1160];
-    case 0x1E3A: *len = 2; return &unicode_decompose_lookup[1162];
-    case 0x1E3B: *len = 2; return &unicode_decompose_lookup[1164];
-    case 0x1E3C: *len = 2; return &unicode_decompose_lookup[1166];
-    case 0x1E3D: *len = 2; return &unicode_decompose_lookup[1168];
-    case 0x1E3E: *len = 2; return &unicode_decompose_lookup[1170];
-    case 0x1E3F: *len = 2; return &unicode_decompose_lookup[1172];
-    case 0x1E40: *len = 2; return &unicode_decompose_lookup[1174];
-    case 0x1E41: *len = 2; return &unicode_decompose_lookup[1176];
-    case 0x1E42: *len = 2; return &unicode_decompose_lookup[1178];
-    case 0x1E43: *len = 2; return &unicode_decompose_lookup[1180];
-    case 0x1E44: *len = 2; return &unicode_decompose_lookup[1182];
-    case 0x1E45: *len = 2; return &unicode_decompose_lookup[1184];
-    case 0x1E46: *len = 2; return &unicode_decompose_lookup[1186];
-    case 0x1E47: *len = 2; return &unicode_decompose_lookup[1188];
-    case 0x1E48: *len = 2; return &unicode_decompose_lookup[1190];
-    case 0x1E49: *len = 2; return &unicode_decompose_lookup[1192];
-    case 0x1E4A: *len = 2; return &unicode_decompose_lookup[1194];
-    case 0x1E4B: *len = 2; return &unicode_decompose_lookup[1196];
-    case 0x1E4C: *len = 2; return &unicode_decompose_lookup[1198];
-    case 0x1E4D: *len = 2; return &unicode_decompose_lookup[1200];
-    case 0x1E4E: *len = 2; return &unicode_decompose_lookup[1202];
-    case 0x1E4F: *len = 2; return &unicode_decompose_lookup[1204];
-    case 0x1E50: *len = 2; return &unicode_decompose_lookup[1206];
-    case 0x1E51: *len = 2; return &unicode_decompose_lookup[1208];
-    case 0x1E52: *len = 2; return &unicode_decompose_lookup[1210];
-    case 0x1E53: *len = 2; return &unicode_decompose_lookup[1212];
-    case 0x1E54: *len = 2; return &unicode_decompose_lookup[1214];
-    case 0x1E55: *len = 2; return &unicode_decompose_lookup[1216];
-    case 0x1E56: *len = 2; return &unicode_decompose_lookup[1218];
-    case 0x1E57: *len = 2; return &unicode_decompose_lookup[1220];
-    case 0x1E58: *len = 2; return &unicode_decompose_lookup[1222];
-    case 0x1E59: *len = 2; return &unicode_decompose_lookup[1224];
-    case 0x1E5A: *len = 2; return &unicode_decompose_lookup[1226];
-    case 0x1E5B: *len = 2; return &unicode_decompose_lookup[1228];
-    case 0x1E5C: *len = 2; return &unicode_decompose_lookup[1230];
-    case 0x1E5D: *len = 2; return &unicode_decompose_lookup[1232];
-    case 0x1E5E: *len = 2; return &unicode_decompose_lookup[1234];
-    case 0x1E5F: *len = 2; return &unicode_decompose_lookup[1236];
-    case 0x1E60: *len = 2; return &unicode_decompose_lookup[1238];
-    case 0x1E61: *len = 2; return &unicode_decompose_lookup[1240];
-    case 0x1E62: *len = 2; return &unicode_decompose_lookup[1242];
-    case 0x1E63: *len = 2; return &unicode_decompose_lookup[1244];
-    case 0x1E64: *len = 2; return &unicode_decompose_lookup[1246];
-    case 0x1E65: *len = 2; return &unicode_decompose_lookup[1248];
-    case 0x1E66: *len = 2; return &unicode_decompose_lookup[1250];
-    case 0x1E67: *len = 2; return &unicode_decompose_lookup[1252];
-    case 0x1E68: *len = 2; return &unicode_decompose_lookup[1254];
-    case 0x1E69: *len = 2; return &unicode_decompose_lookup[1256];
-    case 0x1E6A: *len = 2; return &unicode_decompose_lookup[1258];
-    case 0x1E6B: *len = 2; return &unicode_decompose_lookup[1260];
-    case 0x1E6C: *len = 2; return &unicode_decompose_lookup[1262];
-    case 0x1E6D: *len = 2; return &unicode_decompose_lookup[1264];
-    case 0x1E6E: *len = 2; return &unicode_decompose_lookup[1266];
-    case 0x1E6F: *len = 2; return &unicode_decompose_lookup[1268];
-    case 0x1E70: *len = 2; return &unicode_decompose_lookup[1270];
-    case 0x1E71: *len = 2; return &unicode_decompose_lookup[1272];
-    case 0x1E72: *len = 2; return &unicode_decompose_lookup[1274];
-    case 0x1E73: *len = 2; return &unicode_decompose_lookup[1276];
-    case 0x1E74: *len = 2; return &unicode_decompose_lookup[1278];
-    case 0x1E75: *len = 2; return &unicode_decompose_lookup[1280];
-    case 0x1E76: *len = 2; return &unicode_decompose_lookup[1282];
-    case 0x1E77: *len = 2; return &unicode_decompose_lookup[1284];
-    case 0x1E78: *len = 2; return &unicode_decompose_lookup[1286];
-    case 0x1E79: *len = 2; return &unicode_decompose_lookup[1288];
-    case 0x1E7A: *len = 2; return &unicode_decompose_lookup[1290];
-    case 0x1E7B: *len = 2; return &unicode_decompose_lookup[1292];
-    case 0x1E7C: *len = 2; return &unicode_decompose_lookup[1294];
-    case 0x1E7D: *len = 2; return &unicode_decompose_lookup[1296];
-    case 0x1E7E: *len = 2; return &unicode_decompose_lookup[1298];
-    case 0x1E7F: *len = 2; return &unicode_decompose_lookup[1300];
-    case 0x1E80: *len = 2; return &unicode_decompose_lookup[1302];
-    case 0x1E81: *len = 2; return &unicode_decompose_lookup[1304];
-    case 0x1E82: *len = 2; return &unicode_decompose_lookup[1306];
-    case 0x1E83: *len = 2; return &unicode_decompose_lookup[1308];
-    case 0x1E84: *len = 2; return &unicode_decompose_lookup[1310];
-    case 0x1E85: *len = 2; return &unicode_decompose_lookup[1312];
-    case 0x1E86: *len = 2; return &unicode_decompose_lookup[1314];
-    case 0x1E87: *len = 2; return &unicode_decompose_lookup[1316];
-    case 0x1E88: *len = 2; return &unicode_decompose_lookup[1318];
-    case 0x1E89: *len = 2; return &unicode_decompose_lookup[1320];
-    case 0x1E8A: *len = 2; return &unicode_decompose_lookup[1322];
-    case 0x1E8B: *len = 2; return &unicode_decompose_lookup[1324];
-    case 0x1E8C: *len = 2; return &unicode_decompose_lookup[1326];
-    case 0x1E8D: *len = 2; return &unicode_decompose_lookup[1328];
-    case 0x1E8E: *len = 2; return &unicode_decompose_lookup[1330];
-    case 0x1E8F: *len = 2; return &unicode_decompose_lookup[1332];
-    case 0x1E90: *len = 2; return &unicode_decompose_lookup[1334];
-    case 0x1E91: *len = 2; return &unicode_decompose_lookup[1336];
-    case 0x1E92: *len = 2; return &unicode_decompose_lookup[1338];
-    case 0x1E93: *len = 2; return &unicode_decompose_lookup[1340];
-    case 0x1E94: *len = 2; return &unicode_decompose_lookup[1342];
-    case 0x1E95: *len = 2; return &unicode_decompose_lookup[1344];
-    case 0x1E96: *len = 2; return &unicode_decompose_lookup[1346];
-    case 0x1E97: *len = 2; return &unicode_decompose_lookup[1348];
-    case 0x1E98: *len = 2; return &unicode_decompose_lookup[1350];
-    case 0x1E99: *len = 2; return &unicode_decompose_lookup[1352];
-    case 0x1E9B: *len = 2; return &unicode_decompose_lookup[1356];
-    case 0x1EA0: *len = 2; return &unicode_decompose_lookup[1358];
-    case 0x1EA1: *len = 2; return &unicode_decompose_lookup[1360];
-    case 0x1EA2: *len = 2; return &unicode_decompose_lookup[1362];
-    case 0x1EA3: *len = 2; return &unicode_decompose_lookup[1364];
-    case 0x1EA4: *len = 2; return &unicode_decompose_lookup[1366];
-    case 0x1EA5: *len = 2; return &unicode_decompose_lookup[1368];
-    case 0x1EA6: *len = 2; return &unicode_decompose_lookup[1370];
-    case 0x1EA7: *len = 2; return &unicode_decompose_lookup[1372];
-    case 0x1EA8: *len = 2; return &unicode_decompose_lookup[1374];
-    case 0x1EA9: *len = 2; return &unicode_decompose_lookup[1376];
-    case 0x1EAA: *len = 2; return &unicode_decompose_lookup[1378];
-    case 0x1EAB: *len = 2; return &unicode_decompose_lookup[1380];
-    case 0x1EAC: *len = 2; return &unicode_decompose_lookup[1382];
-    case 0x1EAD: *len = 2; return &unicode_decompose_lookup[1384];
-    case 0x1EAE: *len = 2; return &unicode_decompose_lookup[1386];
-    case 0x1EAF: *len = 2; return &unicode_decompose_lookup[1388];
-    case 0x1EB0: *len = 2; return &unicode_decompose_lookup[1390];
-    case 0x1EB1: *len = 2; return &unicode_decompose_lookup[1392];
-    case 0x1EB2: *len = 2; return &unicode_decompose_lookup[1394];
-    case 0x1EB3: *len = 2; return &unicode_decompose_lookup[1396];
-    case 0x1EB4: *len = 2; return &unicode_decompose_lookup[1398];
-    case 0x1EB5: *len = 2; return &unicode_decompose_lookup[1400];
-    case 0x1EB6: *len = 2; return &unicode_decompose_lookup[1402];
-    case 0x1EB7: *len = 2; return &unicode_decompose_lookup[1404];
-    case 0x1EB8: *len = 2; return &unicode_decompose_lookup[1406];
-    case 0x1EB9: *len = 2; return &unicode_decompose_lookup[1408];
-    case 0x1EBA: *len = 2; return &unicode_decompose_lookup[1410];
-    case 0x1EBB: *len = 2; return &unicode_decompose_lookup[1412];
-    case 0x1EBC: *len = 2; return &unicode_decompose_lookup[1414];
-    case 0x1EBD: *len = 2; return &unicode_decompose_lookup[1416];
-    case 0x1EBE: *len = 2; return &unicode_decompose_lookup[1418];
-    case 0x1EBF: *len = 2; return &unicode_decompose_lookup[1420];
-    case 0x1EC0: *len = 2; return &unicode_decompose_lookup[1422];
-    case 0x1EC1: *len = 2; return &unicode_decompose_lookup[1424];
-    case 0x1EC2: *len = 2; return &unicode_decompose_lookup[1426];
-    case 0x1EC3: *len = 2; return &unicode_decompose_lookup[1428];
-    case 0x1EC4: *len = 2; return &unicode_decompose_lookup[1430];
-    case 0x1EC5: *len = 2; return &unicode_decompose_lookup[1432];
-    case 0x1EC6: *len = 2; return &unicode_decompose_lookup[1434];
-    case 0x1EC7: *len = 2; return &unicode_decompose_lookup[1436];
-    case 0x1EC8: *len = 2; return &unicode_decompose_lookup[1438];
-    case 0x1EC9: *len = 2; return &unicode_decompose_lookup[1440];
-    case 0x1ECA: *len = 2; return &unicode_decompose_lookup[1442];
-    case 0x1ECB: *len = 2; return &unicode_decompose_lookup[1444];
-    case 0x1ECC: *len = 2; return &unicode_decompose_lookup[1446];
-    case 0x1ECD: *len = 2; return &unicode_decompose_lookup[1448];
-    case 0x1ECE: *len = 2; return &unicode_decompose_lookup[1450];
-    case 0x1ECF: *len = 2; return &unicode_decompose_lookup[1452];
-    case 0x1ED0: *len = 2; return &unicode_decompose_lookup[1454];
-    case 0x1ED1: *len = 2; return &unicode_decompose_lookup[1456];
-    case 0x1ED2: *len = 2; return &unicode_decompose_lookup[1458];
-    case 0x1ED3: *len = 2; return &unicode_decompose_lookup[1460];
-    case 0x1ED4: *len = 2; return &unicode_decompose_lookup[1462];
-    case 0x1ED5: *len = 2; return &unicode_decompose_lookup[1464];
-    case 0x1ED6: *len = 2; return &unicode_decompose_lookup[1466];
-    case 0x1ED7: *len = 2; return &unicode_decompose_lookup[1468];
-    case 0x1ED8: *len = 2; return &unicode_decompose_lookup[1470];
-    case 0x1ED9: *len = 2; return &unicode_decompose_lookup[1472];
-    case 0x1EDA: *len = 2; return &unicode_decompose_lookup[1474];
-    case 0x1EDB: *len = 2; return &unicode_decompose_lookup[1476];
-    case 0x1EDC: *len = 2; return &unicode_decompose_lookup[1478];
-    case 0x1EDD: *len = 2; return &unicode_decompose_lookup[1480];
-    case 0x1EDE: *len = 2; return &unicode_decompose_lookup[1482];
-    case 0x1EDF: *len = 2; return &unicode_decompose_lookup[1484];
-    case 0x1EE0: *len = 2; return &unicode_decompose_lookup[1486];
-    case 0x1EE1: *len = 2; return &unicode_decompose_lookup[1488];
-    case 0x1EE2: *len = 2; return &unicode_decompose_lookup[1490];
-    case 0x1EE3: *len = 2; return &unicode_decompose_lookup[1492];
-    case 0x1EE4: *len = 2; return &unicode_decompose_lookup[1494];
-    case 0x1EE5: *len = 2; return &unicode_decompose_lookup[1496];
-    case 0x1EE6: *len = 2; return &unicode_decompose_lookup[1498];
-    case 0x1EE7: *len = 2; return &unicode_decompose_lookup[1500];
-    case 0x1EE8: *len = 2; return &unicode_decompose_lookup[1502];
-    case 0x1EE9: *len = 2; return &unicode_decompose_lookup[1504];
-    case 0x1EEA: *len = 2; return &unicode_decompose_lookup[1506];
-    case 0x1EEB: *len = 2; return &unicode_decompose_lookup[1508];
-    case 0x1EEC: *len = 2; return &unicode_decompose_lookup[1510];
-    case 0x1EED: *len = 2; return &unicode_decompose_lookup[1512];
-    case 0x1EEE: *len = 2; return &unicode_decompose_lookup[1514];
-    case 0x1EEF: *len = 2; return &unicode_decompose_lookup[1516];
-    case 0x1EF0: *len = 2; return &unicode_decompose_lookup[1518];
-    case 0x1EF1: *len = 2; return &unicode_decompose_lookup[1520];
-    case 0x1EF2: *len = 2; return &unicode_decompose_lookup[1522];
-    case 0x1EF3: *len = 2; return &unicode_decompose_lookup[1524];
-    case 0x1EF4: *len = 2; return &unicode_decompose_lookup[1526];
-    case 0x1EF5: *len = 2; return &unicode_decompose_lookup[1528];
-    case 0x1EF6: *len = 2; return &unicode_decompose_lookup[1530];
-    case 0x1EF7: *len = 2; return &unicode_decompose_lookup[1532];
-    case 0x1EF8: *len = 2; return &unicode_decompose_lookup[1534];
-    case 0x1EF9: *len = 2; return &unicode_decompose_lookup[1536];
-    case 0x1F00: *len = 2; return &unicode_decompose_lookup[1538];
-    case 0x1F01: *len = 2; return &unicode_decompose_lookup[1540];
-    case 0x1F02: *len = 2; return &unicode_decompose_lookup[1542];
-    case 0x1F03: *len = 2; return &unicode_decompose_lookup[1544];
-    case 0x1F04: *len = 2; return &unicode_decompose_lookup[1546];
-    case 0x1F05: *len = 2; return &unicode_decompose_lookup[1548];
-    case 0x1F06: *len = 2; return &unicode_decompose_lookup[1550];
-    case 0x1F07: *len = 2; return &unicode_decompose_lookup[1552];
-    case 0x1F08: *len = 2; return &unicode_decompose_lookup[1554];
-    case 0x1F09: *len = 2; return &unicode_decompose_lookup[1556];
-    case 0x1F0A: *len = 2; return &unicode_decompose_lookup[1558];
-    case 0x1F0B: *len = 2; return &unicode_decompose_lookup[1560];
-    case 0x1F0C: *len = 2; return &unicode_decompose_lookup[1562];
-    case 0x1F0D: *len = 2; return &unicode_decompose_lookup[1564];
-    case 0x1F0E: *len = 2; return &unicode_decompose_lookup[1566];
-    case 0x1F0F: *len = 2; return &unicode_decompose_lookup[1568];
-    case 0x1F10: *len = 2; return &unicode_decompose_lookup[1570];
-    case 0x1F11: *len = 2; return &unicode_decompose_lookup[1572];
-    case 0x1F12: *len = 2; return &unicode_decompose_lookup[1574];
-    case 0x1F13: *len = 2; return &unicode_decompose_lookup[1576];
-    case 0x1F14: *len = 2; return &unicode_decompose_lookup[1578];
-    case 0x1F15: *len = 2; return &unicode_decompose_lookup[1580];
-    case 0x1F18: *len = 2; return &unicode_decompose_lookup[1582];
-    case 0x1F19: *len = 2; return &unicode_decompose_lookup[1584];
-    case 0x1F1A: *len = 2; return &unicode_decompose_lookup[1586];
-    case 0x1F1B: *len = 2; return &unicode_decompose_lookup[1588];
-    case 0x1F1C: *len = 2; return &unicode_decompose_lookup[1590];
-    case 0x1F1D: *len = 2; return &unicode_decompose_lookup[1592];
-    case 0x1F20: *len = 2; return &unicode_decompose_lookup[1594];
-    case 0x1F21: *len = 2; return &unicode_decompose_lookup[1596];
-    case 0x1F22: *len = 2; return &unicode_decompose_lookup[1598];
-    case 0x1F23: *len = 2; return &unicode_decompose_lookup[1600];
-    case 0x1F24: *len = 2; return &unicode_decompose_lookup[1602];
-    case 0x1F25: *len = 2; return &unicode_decompose_lookup[1604];
-    case 0x1F26: *len = 2; return &unicode_decompose_lookup[1606];
-    case 0x1F27: *len = 2; return &unicode_decompose_lookup[1608];
-    case 0x1F28: *len = 2; return &unicode_decompose_lookup[1610];
-    case 0x1F29: *len = 2; return &unicode_decompose_lookup[1612];
-    case 0x1F2A: *len = 2; return &unicode_decompose_lookup[1614];
-    case 0x1F2B: *len = 2; return &unicode_decompose_lookup[1616];
-    case 0x1F2C: *len = 2; return &unicode_decompose_lookup[1618];
-    case 0x1F2D: *len = 2; return &unicode_decompose_lookup[1620];
-    case 0x1F2E: *len = 2; return &unicode_decompose_lookup[1622];
-    case 0x1F2F: *len = 2; return &unicode_decompose_lookup[1624];
-    case 0x1F30: *len = 2; return &unicode_decompose_lookup[1626];
-    case 0x1F31: *len = 2; return &unicode_decompose_lookup[1628];
-    case 0x1F32: *len = 2; return &unicode_decompose_lookup[1630];
-    case 0x1F33: *len = 2; return &unicode_decompose_lookup[1632];
-    case 0x1F34: *len = 2; return &unicode_decompose_lookup[1634];
-    case 0x1F35: *len = 2; return &unicode_decompose_lookup[1636];
-    case 0x1F36: *len = 2; return &unicode_decompose_lookup[1638];
-    case 0x1F37: *len = 2; return &unicode_decompose_lookup[1640];
-    case 0x1F38: *len = 2; return &unicode_decompose_lookup[1642];
-    case 0x1F39: *len = 2; return &unicode_decompose_lookup[1644];
-    case 0x1F3A: *len = 2; return &unicode_decompose_lookup[1646];
-    case 0x1F3B: *len = 2; return &unicode_decompose_lookup[1648];
-    case 0x1F3C: *len = 2; return &unicode_decompose_lookup[1650];
-    case 0x1F3D: *len = 2; return &unicode_decompose_lookup[1652];
-    case 0x1F3E: *len = 2; return &unicode_decompose_lookup[1654];
-    case 0x1F3F: *len = 2; return &unicode_decompose_lookup[1656];
-    case 0x1F40: *len = 2; return &unicode_decompose_lookup[1658];
-    case 0x1F41: *len = 2; return &unicode_decompose_lookup[1660];
-    case 0x1F42: *len = 2; return &unicode_decompose_lookup[1662];
-    case 0x1F43: *len = 2; return &unicode_decompose_lookup[1664];
-    case 0x1F44: *len = 2; return &unicode_decompose_lookup[1666];
-    case 0x1F45: *len = 2; return &unicode_decompose_lookup[1668];
-    case 0x1F48: *len = 2; return &unicode_decompose_lookup[1670];
-    case 0x1F49: *len = 2; return &unicode_decompose_lookup[1672];
-    case 0x1F4A: *len = 2; return &unicode_decompose_lookup[1674];
-    case 0x1F4B: *len = 2; return &unicode_decompose_lookup[1676];
-    case 0x1F4C: *len = 2; return &unicode_decompose_lookup[1678];
-    case 0x1F4D: *len = 2; return &unicode_decompose_lookup[1680];
-    case 0x1F50: *len = 2; return &unicode_decompose_lookup[1682];
-    case 0x1F51: *len = 2; return &unicode_decompose_lookup[1684];
-    case 0x1F52: *len = 2; return &unicode_decompose_lookup[1686];
-    case 0x1F53: *len = 2; return &unicode_decompose_lookup[1688];
-    case 0x1F54: *len = 2; return &unicode_decompose_lookup[1690];
-    case 0x1F55: *len = 2; return &unicode_decompose_lookup[1692];
-    case 0x1F56: *len = 2; return &unicode_decompose_lookup[1694];
-    case 0x1F57: *len = 2; return &unicode_decompose_lookup[1696];
-    case 0x1F59: *len = 2; return &unicode_decompose_lookup[1698];
-    case 0x1F5B: *len = 2; return &unicode_decompose_lookup[1700];
-    case 0x1F5D: *len = 2; return &unicode_decompose_lookup[1702];
-    case 0x1F5F: *len = 2; return &unicode_decompose_lookup[1704];
-    case 0x1F60: *len = 2; return &unicode_decompose_lookup[1706];
-    case 0x1F61: *len = 2; return &unicode_decompose_lookup[1708];
-    case 0x1F62: *len = 2; return &unicode_decompose_lookup[1710];
-    case 0x1F63: *len = 2; return &unicode_decompose_lookup[1712];
-    case 0x1F64: *len = 2; return &unicode_decompose_lookup[1714];
-    case 0x1F65: *len = 2; return &unicode_decompose_lookup[1716];
-    case 0x1F66: *len = 2; return &unicode_decompose_lookup[1718];
-    case 0x1F67: *len = 2; return &unicode_decompose_lookup[1720];
-    case 0x1F68: *len = 2; return &unicode_decompose_lookup[1722];
-    case 0x1F69: *len = 2; return &unicode_decompose_lookup[1724];
-    case 0x1F6A: *len = 2; return &unicode_decompose_lookup[1726];
-    case 0x1F6B: *len = 2; return &unicode_decompose_lookup[1728];
-    case 0x1F6C: *len = 2; return &unicode_decompose_lookup[1730];
-    case 0x1F6D: *len = 2; return &unicode_decompose_lookup[1732];
-    case 0x1F6E: *len = 2; return &unicode_decompose_lookup[1734];
-    case 0x1F6F: *len = 2; return &unicode_decompose_lookup[1736];
-    case 0x1F70: *len = 2; return &unicode_decompose_lookup[1738];
-    case 0x1F71: *len = 1; return &unicode_decompose_lookup[1740];
-    case 0x1F72: *len = 2; return &unicode_decompose_lookup[1741];
-    case 0x1F73: *len = 1; return &unicode_decompose_lookup[1743];
-    case 0x1F74: *len = 2; return &unicode_decompose_lookup[1744];
-    case 0x1F75: *len = 1; return &unicode_decompose_lookup[1746];
-    case 0x1F76: *len = 2; return &unicode_decompose_lookup[1747];
-    case 0x1F77: *len = 1; return &unicode_decompose_lookup[1749];
-    case 0x1F78: *len = 2; return &unicode_decompose_lookup[1750];
-    case 0x1F79: *len = 1; return &unicode_decompose_lookup[1752];
-    case 0x1F7A: *len = 2; return &unicode_decompose_lookup[1753];
-    case 0x1F7B: *len = 1; return &unicode_decompose_lookup[1755];
-    case 0x1F7C: *len = 2; return &unicode_decompose_lookup[1756];
-    case 0x1F7D: *len = 1; return &unicode_decompose_lookup[1758];
-    case 0x1F80: *len = 2; return &unicode_decompose_lookup[1759];
-    case 0x1F81: *len = 2; return &unicode_decompose_lookup[1761];
-    case 0x1F82: *len = 2; return &unicode_decompose_lookup[1763];
-    case 0x1F83: *len = 2; return &unicode_decompose_lookup[1765];
-    case 0x1F84: *len = 2; return &unicode_decompose_lookup[1767];
-    case 0x1F85: *len = 2; return &unicode_decompose_lookup[1769];
-    case 0x1F86: *len = 2; return &unicode_decompose_lookup[1771];
-    case 0x1F87: *len = 2; return &unicode_decompose_lookup[1773];
-    case 0x1F88: *len = 2; return &unicode_decompose_lookup[1775];
-    case 0x1F89: *len = 2; return &unicode_decompose_lookup[1777];
-    case 0x1F8A: *len = 2; return &unicode_decompose_lookup[1779];
-    case 0x1F8B: *len = 2; return &unicode_decompose_lookup[1781];
-    case 0x1F8C: *len = 2; return &unicode_decompose_lookup[1783];
-    case 0x1F8D: *len = 2; return &unicode_decompose_lookup[1785];
-    case 0x1F8E: *len = 2; return &unicode_decompose_lookup[1787];
-    case 0x1F8F: *len = 2; return &unicode_decompose_lookup[1789];
-    case 0x1F90: *len = 2; return &unicode_decompose_lookup[1791];
-    case 0x1F91: *len = 2; return &unicode_decompose_lookup[1793];
-    case 0x1F92: *len = 2; return &unicode_decompose_lookup[1795];
-    case 0x1F93: *len = 2; return &unicode_decompose_lookup[1797];
-    case 0x1F94: *len = 2; return &unicode_decompose_lookup[1799];
-    case 0x1F95: *len = 2; return &unicode_decompose_lookup[1801];
-    case 0x1F96: *len = 2; return &unicode_decompose_lookup[1803];
-    case 0x1F97: *len = 2; return &unicode_decompose_lookup[1805];
-    case 0x1F98: *len = 2; return &unicode_decompose_lookup[1807];
-    case 0x1F99: *len = 2; return &unicode_decompose_lookup[1809];
-    case 0x1F9A: *len = 2; return &unicode_decompose_lookup[1811];
-    case 0x1F9B: *len = 2; return &unicode_decompose_lookup[1813];
-    case 0x1F9C: *len = 2; return &unicode_decompose_lookup[1815];
-    case 0x1F9D: *len = 2; return &unicode_decompose_lookup[1817];
-    case 0x1F9E: *len = 2; return &unicode_decompose_lookup[1819];
-    case 0x1F9F: *len = 2; return &unicode_decompose_lookup[1821];
-    case 0x1FA0: *len = 2; return &unicode_decompose_lookup[1823];
-    case 0x1FA1: *len = 2; return &unicode_decompose_lookup[1825];
-    case 0x1FA2: *len = 2; return &unicode_decompose_lookup[1827];
-    case 0x1FA3: *len = 2; return &unicode_decompose_lookup[1829];
-    case 0x1FA4: *len = 2; return &unicode_decompose_lookup[1831];
-    case 0x1FA5: *len = 2; return &unicode_decompose_lookup[1833];
-    case 0x1FA6: *len = 2; return &unicode_decompose_lookup[1835];
-    case 0x1FA7: *len = 2; return &unicode_decompose_lookup[1837];
-    case 0x1FA8: *len = 2; return &unicode_decompose_lookup[1839];
-    case 0x1FA9: *len = 2; return &unicode_decompose_lookup[1841];
-    case 0x1FAA: *len = 2; return &unicode_decompose_lookup[1843];
-    case 0x1FAB: *len = 2; return &unicode_decompose_lookup[1845];
-    case 0x1FAC: *len = 2; return &unicode_decompose_lookup[1847];
-    case 0x1FAD: *len = 2; return &unicode_decompose_lookup[1849];
-    case 0x1FAE: *len = 2; return &unicode_decompose_lookup[1851];
-    case 0x1FAF: *len = 2; return &unicode_decompose_lookup[1853];
-    case 0x1FB0: *len = 2; return &unicode_decompose_lookup[1855];
-    case 0x1FB1: *len = 2; return &unicode_decompose_lookup[1857];
-    case 0x1FB2: *len = 2; return &unicode_decompose_lookup[1859];
-    case 0x1FB3: *len = 2; return &unicode_decompose_lookup[1861];
-    case 0x1FB4: *len = 2; return &unicode_decompose_lookup[1863];
-    case 0x1FB6: *len = 2; return &unicode_decompose_lookup[1865];
-    case 0x1FB7: *len = 2; return &unicode_decompose_lookup[1867];
-    case 0x1FB8: *len = 2; return &unicode_decompose_lookup[1869];
-    case 0x1FB9: *len = 2; return &unicode_decompose_lookup[1871];
-    case 0x1FBA: *len = 2; return &unicode_decompose_lookup[1873];
-    case 0x1FBB: *len = 1; return &unicode_decompose_lookup[1875];
-    case 0x1FBC: *len = 2; return &unicode_decompose_lookup[1876];
-    case 0x1FBE: *len = 1; return &unicode_decompose_lookup[1880];
-    case 0x1FC1: *len = 2; return &unicode_decompose_lookup[1885];
-    case 0x1FC2: *len = 2; return &unicode_decompose_lookup[1887];
-    case 0x1FC3: *len = 2; return &unicode_decompose_lookup[1889];
-    case 0x1FC4: *len = 2; return &unicode_decompose_lookup[1891];
-    case 0x1FC6: *len = 2; return &unicode_decompose_lookup[1893];
-    case 0x1FC7: *len = 2; return &unicode_decompose_lookup[1895];
-    case 0x1FC8: *len = 2; return &unicode_decompose_lookup[1897];
-    case 0x1FC9: *len = 1; return &unicode_decompose_lookup[1899];
-    case 0x1FCA: *len = 2; return &unicode_decompose_lookup[1900];
-    case 0x1FCB: *len = 1; return &unicode_decompose_lookup[1902];
-    case 0x1FCC: *len = 2; return &unicode_decompose_lookup[1903];
-    case 0x1FCD: *len = 2; return &unicode_decompose_lookup[1905];
-    case 0x1FCE: *len = 2; return &unicode_decompose_lookup[1907];
-    case 0x1FCF: *len = 2; return &unicode_decompose_lookup[1909];
-    case 0x1FD0: *len = 2; return &unicode_decompose_lookup[1911];
-    case 0x1FD1: *len = 2; return &unicode_decompose_lookup[1913];
-    case 0x1FD2: *len = 2; return &unicode_decompose_lookup[1915];
-    case 0x1FD3: *len = 1; return &unicode_decompose_lookup[1917];
-    case 0x1FD6: *len = 2; return &unicode_decompose_lookup[1918];
-    case 0x1FD7: *len = 2; return &unicode_decompose_lookup[1920];
-    case 0x1FD8: *len = 2; return &unicode_decompose_lookup[1922];
-    case 0x1FD9: *len = 2; return &unicode_decompose_lookup[1924];
-    case 0x1FDA: *len = 2; return &unicode_decompose_lookup[1926];
-    case 0x1FDB: *len = 1; return &unicode_decompose_lookup[1928];
-    case 0x1FDD: *len = 2; return &unicode_decompose_lookup[1929];
-    case 0x1FDE: *len = 2; return &unicode_decompose_lookup[1931];
-    case 0x1FDF: *len = 2; return &unicode_decompose_lookup[1933];
-    case 0x1FE0: *len = 2; return &unicode_decompose_lookup[1935];
-    case 0x1FE1: *len = 2; return &unicode_decompose_lookup[1937];
-    case 0x1FE2: *len = 2; return &unicode_decompose_lookup[1939];
-    case 0x1FE3: *len = 1; return &unicode_decompose_lookup[1941];
-    case 0x1FE4: *len = 2; return &unicode_decompose_lookup[1942];
-    case 0x1FE5: *len = 2; return &unicode_decompose_lookup[1944];
-    case 0x1FE6: *len = 2; return &unicode_decompose_lookup[1946];
-    case 0x1FE7: *len = 2; return &unicode_decompose_lookup[1948];
-    case 0x1FE8: *len = 2; return &unicode_decompose_lookup[1950];
-    case 0x1FE9: *len = 2; return &unicode_decompose_lookup[1952];
-    case 0x1FEA: *len = 2; return &unicode_decompose_lookup[1954];
-    case 0x1FEB: *len = 1; return &unicode_decompose_lookup[1956];
-    case 0x1FEC: *len = 2; return &unicode_decompose_lookup[1957];
-    case 0x1FED: *len = 2; return &unicode_decompose_lookup[1959];
-    case 0x1FEE: *len = 1; return &unicode_decompose_lookup[1961];
-    case 0x1FEF: *len = 1; return &unicode_decompose_lookup[1962];
-    case 0x1FF2: *len = 2; return &unicode_decompose_lookup[1963];
-    case 0x1FF3: *len = 2; return &unicode_decompose_lookup[1965];
-    case 0x1FF4: *len = 2; return &unicode_decompose_lookup[1967];
-    case 0x1FF6: *len = 2; return &unicode_decompose_lookup[1969];
-    case 0x1FF7: *len = 2; return &unicode_decompose_lookup[1971];
-    case 0x1FF8: *len = 2; return &unicode_decompose_lookup[1973];
-    case 0x1FF9: *len = 1; return &unicode_decompose_lookup[1975];
-    case 0x1FFA: *len = 2; return &unicode_decompose_lookup[1976];
-    case 0x1FFB: *len = 1; return &unicode_decompose_lookup[1978];
-    case 0x1FFC: *len = 2; return &unicode_decompose_lookup[1979];
-    case 0x1FFD: *len = 1; return &unicode_decompose_lookup[1981];
-    case 0x2000: *len = 1; return &unicode_decompose_lookup[1984];
-    case 0x2001: *len = 1; return &unicode_decompose_lookup[1985];
-    case 0x2126: *len = 1; return &unicode_decompose_lookup[2118];
-    case 0x212A: *len = 1; return &unicode_decompose_lookup[2120];
-    case 0x212B: *len = 1; return &unicode_decompose_lookup[2121];
-    case 0x219A: *len = 2; return &unicode_decompose_lookup[2258];
-    case 0x219B: *len = 2; return &unicode_decompose_lookup[2260];
-    case 0x21AE: *len = 2; return &unicode_decompose_lookup[2262];
-    case 0x21CD: *len = 2; return &unicode_decompose_lookup[2264];
-    case 0x21CE: *len = 2; return &unicode_decompose_lookup[2266];
-    case 0x21CF: *len = 2; return &unicode_decompose_lookup[2268];
-    case 0x2204: *len = 2; return &unicode_decompose_lookup[2270];
-    case 0x2209: *len = 2; return &unicode_decompose_lookup[2272];
-    case 0x220C: *len = 2; return &unicode_decompose_lookup[2274];
-    case 0x2224: *len = 2; return &unicode_decompose_lookup[2276];
-    case 0x2226: *len = 2; return &unicode_decompose_lookup[2278];
-    case 0x2241: *len = 2; return &unicode_decompose_lookup[2290];
-    case 0x2244: *len = 2; return &unicode_decompose_lookup[2292];
-    case 0x2247: *len = 2; return &unicode_decompose_lookup[2294];
-    case 0x2249: *len = 2; return &unicode_decompose_lookup[2296];
-    case 0x2260: *len = 2; return &unicode_decompose_lookup[2298];
-    case 0x2262: *len = 2; return &unicode_decompose_lookup[2300];
-    case 0x226D: *len = 2; return &unicode_decompose_lookup[2302];
-    case 0x226E: *len = 2; return &unicode_decompose_lookup[2304];
-    case 0x226F: *len = 2; return &unicode_decompose_lookup[2306];
-    case 0x2270: *len = 2; return &unicode_decompose_lookup[2308];
-    case 0x2271: *len = 2; return &unicode_decompose_lookup[2310];
-    case 0x2274: *len = 2; return &unicode_decompose_lookup[2312];
-    case 0x2275: *len = 2; return &unicode_decompose_lookup[2314];
-    case 0x2278: *len = 2; return &unicode_decompose_lookup[2316];
-    case 0x2279: *len = 2; return &unicode_decompose_lookup[2318];
-    case 0x2280: *len = 2; return &unicode_decompose_lookup[2320];
-    case 0x2281: *len = 2; return &unicode_decompose_lookup[2322];
-    case 0x2284: *len = 2; return &unicode_decompose_lookup[2324];
-    case 0x2285: *len = 2; return &unicode_decompose_lookup[2326];
-    case 0x2288: *len = 2; return &unicode_decompose_lookup[2328];
-    case 0x2289: *len = 2; return &unicode_decompose_lookup[2330];
-    case 0x22AC: *len = 2; return &unicode_decompose_lookup[2332];
-    case 0x22AD: *len = 2; return &unicode_decompose_lookup[2334];
-    case 0x22AE: *len = 2; return &unicode_decompose_lookup[2336];
-    case 0x22AF: *len = 2; return &unicode_decompose_lookup[2338];
-    case 0x22E0: *len = 2; return &unicode_decompose_lookup[2340];
-    case 0x22E1: *len = 2; return &unicode_decompose_lookup[2342];
-    case 0x22E2: *len = 2; return &unicode_decompose_lookup[2344];
-    case 0x22E3: *len = 2; return &unicode_decompose_lookup[2346];
-    case 0x22EA: *len = 2; return &unicode_decompose_lookup[2348];
-    case 0x22EB: *len = 2; return &unicode_decompose_lookup[2350];
-    case 0x22EC: *len = 2; return &unicode_decompose_lookup[2352];
-    case 0x22ED: *len = 2; return &unicode_decompose_lookup[2354];
-    case 0x2329: *len = 1; return &unicode_decompose_lookup[2356];
-    case 0x232A: *len = 1; return &unicode_decompose_lookup[2357];
-    case 0x2ADC: *len = 2; return &unicode_decompose_lookup[2654];
-    case 0x304C: *len = 2; return &unicode_decompose_lookup[2880];
-    case 0x304E: *len = 2; return &unicode_decompose_lookup[2882];
-    case 0x3050: *len = 2; return &unicode_decompose_lookup[2884];
-    case 0x3052: *len = 2; return &unicode_decompose_lookup[2886];
-    case 0x3054: *len = 2; return &unicode_decompose_lookup[2888];
-    case 0x3056: *len = 2; return &unicode_decompose_lookup[2890];
-    case 0x3058: *len = 2; return &unicode_decompose_lookup[2892];
-    case 0x305A: *len = 2; return &unicode_decompose_lookup[2894];
-    case 0x305C: *len = 2; return &unicode_decompose_lookup[2896];
-    case 0x305E: *len = 2; return &unicode_decompose_lookup[2898];
-    case 0x3060: *len = 2; return &unicode_decompose_lookup[2900];
-    case 0x3062: *len = 2; return &unicode_decompose_lookup[2902];
-    case 0x3065: *len = 2; return &unicode_decompose_lookup[2904];
-    case 0x3067: *len = 2; return &unicode_decompose_lookup[2906];
-    case 0x3069: *len = 2; return &unicode_decompose_lookup[2908];
-    case 0x3070: *len = 2; return &unicode_decompose_lookup[2910];
-    case 0x3071: *len = 2; return &unicode_decompose_lookup[2912];
-    case 0x3073: *len = 2; return &unicode_decompose_lookup[2914];
-    case 0x3074: *len = 2; return &unicode_decompose_lookup[2916];
-    case 0x3076: *len = 2; return &unicode_decompose_lookup[2918];
-    case 0x3077: *len = 2; return &unicode_decompose_lookup[2920];
-    case 0x3079: *len = 2; return &unicode_decompose_lookup[2922];
-    case 0x307A: *len = 2; return &unicode_decompose_lookup[2924];
-    case 0x307C: *len = 2; return &unicode_decompose_lookup[2926];
-    case 0x307D: *len = 2; return &unicode_decompose_lookup[2928];
-    case 0x3094: *len = 2; return &unicode_decompose_lookup[2930];
-    case 0x309E: *len = 2; return &unicode_decompose_lookup[2936];
-    case 0x30AC: *len = 2; return &unicode_decompose_lookup[2940];
-    case 0x30AE: *len = 2; return &unicode_decompose_lookup[2942];
-    case 0x30B0: *len = 2; return &unicode_decompose_lookup[2944];
-    case 0x30B2: *len = 2; return &unicode_decompose_lookup[2946];
-    case 0x30B4: *len = 2; return &unicode_decompose_lookup[2948];
-    case 0x30B6: *len = 2; return &unicode_decompose_lookup[2950];
-    case 0x30B8: *len = 2; return &unicode_decompose_lookup[2952];
-    case 0x30BA: *len = 2; return &unicode_decompose_lookup[2954];
-    case 0x30BC: *len = 2; return &unicode_decompose_lookup[2956];
-    case 0x30BE: *len = 2; return &unicode_decompose_lookup[2958];
-    case 0x30C0: *len = 2; return &unicode_decompose_lookup[2960];
-    case 0x30C2: *len = 2; return &unicode_decompose_lookup[2962];
-    case 0x30C5: *len = 2; return &unicode_decompose_lookup[2964];
-    case 0x30C7: *len = 2; return &unicode_decompose_lookup[2966];
-    case 0x30C9: *len = 2; return &unicode_decompose_lookup[2968];
-    case 0x30D0: *len = 2; return &unicode_decompose_lookup[2970];
-    case 0x30D1: *len = 2; return &unicode_decompose_lookup[2972];
-    case 0x30D3: *len = 2; return &unicode_decompose_lookup[2974];
-    case 0x30D4: *len = 2; return &unicode_decompose_lookup[2976];
-    case 0x30D6: *len = 2; return &unicode_decompose_lookup[2978];
-    case 0x30D7: *len = 2; return &unicode_decompose_lookup[2980];
-    case 0x30D9: *len = 2; return &unicode_decompose_lookup[2982];
-    case 0x30DA: *len = 2; return &unicode_decompose_lookup[2984];
-    case 0x30DC: *len = 2; return &unicode_decompose_lookup[2986];
-    case 0x30DD: *len = 2; return &unicode_decompose_lookup[2988];
-    case 0x30F4: *len = 2; return &unicode_decompose_lookup[2990];
-    case 0x30F7: *len = 2; return &unicode_decompose_lookup[2992];
-    case 0x30F8: *len = 2; return &unicode_decompose_lookup[2994];
-    case 0x30F9: *len = 2; return &unicode_decompose_lookup[2996];
-    case 0x30FA: *len = 2; return &unicode_decompose_lookup[2998];
-    case 0x30FE: *len = 2; return &unicode_decompose_lookup[3000];
-    case 0xF900: *len = 1; return &unicode_decompose_lookup[4321];
-    case 0xF901: *len = 1; return &unicode_decompose_lookup[4322];
-    case 0xF902: *len = 1; return &unicode_decompose_lookup[4323];
-    case 0xF903: *len = 1; return &unicode_decompose_lookup[4324];
-    case 0xF904: *len = 1; return &unicode_decompose_lookup[4325];
-    case 0xF905: *len = 1; return &unicode_decompose_lookup[4326];
-    case 0xF906: *len = 1; return &unicode_decompose_lookup[4327];
-    case 0xF907: *len = 1; return &unicode_decompose_lookup[4328];
-    case 0xF908: *len = 1; return &unicode_decompose_lookup[4329];
-    case 0xF909: *len = 1; return &unicode_decompose_lookup[4330];
-    case 0xF90A: *len = 1; return &unicode_decompose_lookup[4331];
-    case 0xF90B: *len = 1; return &unicode_decompose_lookup[4332];
-    case 0xF90C: *len = 1; return &unicode_decompose_lookup[4333];
-    case 0xF90D: *len = 1; return &unicode_decompose_lookup[4334];
-    case 0xF90E: *len = 1; return &unicode_decompose_lookup[4335];
-    case 0xF90F: *len = 1; return &unicode_decompose_lookup[4336];
-    case 0xF910: *len = 1; return &unicode_decompose_lookup[4337];
-    case 0xF911: *len = 1; return &unicode_decompose_lookup[4338];
-    case 0xF912: *len = 1; return &unicode_decompose_lookup[4339];
-    case 0xF913: *len = 1; return &unicode_decompose_lookup[4340];
-    case 0xF914: *len = 1; return &unicode_decompose_lookup[4341];
-    case 0xF915: *len = 1; return &unicode_decompose_lookup[4342];
-    case 0xF916: *len = 1; return &unicode_decompose_lookup[4343];
-    case 0xF917: *len = 1; return &unicode_decompose_lookup[4344];
-    case 0xF918: *len = 1; return &unicode_decompose_lookup[4345];
-    case 0xF919: *len = 1; return &unicode_decompose_lookup[4346];
-    case 0xF91A: *len = 1; return &unicode_decompose_lookup[4347];
-    case 0xF91B: *len = 1; return &unicode_decompose_lookup[4348];
-    case 0xF91C: *len = 1; return &unicode_decompose_lookup[4349];
-    case 0xF91D: *len = 1; return &unicode_decompose_lookup[4350];
-    case 0xF91E: *len = 1; return &unicode_decompose_lookup[4351];
-    case 0xF91F: *len = 1; return &unicode_decompose_lookup[4352];
-    case 0xF920: *len = 1; return &unicode_decompose_lookup[4353];
-    case 0xF921: *len = 1; return &unicode_decompose_lookup[4354];
-    case 0xF922: *len = 1; return &unicode_decompose_lookup[4355];
-    case 0xF923: *len = 1; return &unicode_decompose_lookup[4356];
-    case 0xF924: *len = 1; return &unicode_decompose_lookup[4357];
-    case 0xF925: *len = 1; return &unicode_decompose_lookup[4358];
-    case 0xF926: *len = 1; return &unicode_decompose_lookup[4359];
-    case 0xF927: *len = 1; return &unicode_decompose_lookup[4360];
-    case 0xF928: *len = 1; return &unicode_decompose_lookup[4361];
-    case 0xF929: *len = 1; return &unicode_decompose_lookup[4362];
-    case 0xF92A: *len = 1; return &unicode_decompose_lookup[4363];
-    case 0xF92B: *len = 1; return &unicode_decompose_lookup[4364];
-    case 0xF92C: *len = 1; return &unicode_decompose_lookup[4365];
-    case 0xF92D: *len = 1; return &unicode_decompose_lookup[4366];
-    case 0xF92E: *len = 1; return &unicode_decompose_lookup[4367];
-    case 0xF92F: *len = 1; return &unicode_decompose_lookup[4368];
-    case 0xF930: *len = 1; return &unicode_decompose_lookup[4369];
-    case 0xF931: *len = 1; return &unicode_decompose_lookup[4370];
-    case 0xF932: *len = 1; return &unicode_decompose_lookup[4371];
-    case 0xF933: *len = 1; return &unicode_decompose_lookup[4372];
-    case 0xF934: *len = 1; return &unicode_decompose_lookup[4373];
-    case 0xF935: *len = 1; return &unicode_decompose_lookup[4374];
-    case 0xF936: *len = 1; return &unicode_decompose_lookup[4375];
-    case 0xF937: *len = 1; return &unicode_decompose_lookup[4376];
-    case 0xF938: *len = 1; return &unicode_decompose_lookup[4377];
-    case 0xF939: *len = 1; return &unicode_decompose_lookup[4378];
-    case 0xF93A: *len = 1; return &unicode_decompose_lookup[4379];
-    case 0xF93B: *len = 1; return &unicode_decompose_lookup[4380];
-    case 0xF93C: *len = 1; return &unicode_decompose_lookup[4381];
-    case 0xF93D: *len = 1; return &unicode_decompose_lookup[4382];
-    case 0xF93E: *len = 1; return &unicode_decompose_lookup[4383];
-    case 0xF93F: *len = 1; return &unicode_decompose_lookup[4384];
-    case 0xF940: *len = 1; return &unicode_decompose_lookup[4385];
-    case 0xF941: *len = 1; return &unicode_decompose_lookup[4386];
-    case 0xF942: *len = 1; return &unicode_decompose_lookup[4387];
-    case 0xF943: *len = 1; return &unicode_decompose_lookup[4388];
-    case 0xF944: *len = 1; return &unicode_decompose_lookup[4389];
-    case 0xF945: *len = 1; return &unicode_decompose_lookup[4390];
-    case 0xF946: *len = 1; return &unicode_decompose_lookup[4391];
-    case 0xF947: *len = 1; return &unicode_decompose_lookup[4392];
-    case 0xF948: *len = 1; return &unicode_decompose_lookup[4393];
-    case 0xF949: *len = 1; return &unicode_decompose_lookup[4394];
-    case 0xF94A: *len = 1; return &unicode_decompose_lookup[4395];
-    case 0xF94B: *len = 1; return &unicode_decompose_lookup[4396];
-    case 0xF94C: *len = 1; return &unicode_decompose_lookup[4397];
-    case 0xF94D: *len = 1; return &unicode_decompose_lookup[4398];
-    case 0xF94E: *len = 1; return &unicode_decompose_lookup[4399];
-    case 0xF94F: *len = 1; return &unicode_decompose_lookup[4400];
-    case 0xF950: *len = 1; return &unicode_decompose_lookup[4401];
-    case 0xF951: *len = 1; return &unicode_decompose_lookup[4402];
-    case 0xF952: *len = 1; return &unicode_decompose_lookup[4403];
-    case 0xF953: *len = 1; return &unicode_decompose_lookup[4404];
-    case 0xF954: *len = 1; return &unicode_decompose_lookup[4405];
-    case 0xF955: *len = 1; return &unicode_decompose_lookup[4406];
-    case 0xF956: *len = 1; return &unicode_decompose_lookup[4407];
-    case 0xF957: *len = 1; return &unicode_decompose_lookup[4408];
-    case 0xF958: *len = 1; return &unicode_decompose_lookup[4409];
-    case 0xF959: *len = 1; return &unicode_decompose_lookup[4410];
-    case 0xF95A: *len = 1; return &unicode_decompose_lookup[4411];
-    case 0xF95B: *len = 1; return &unicode_decompose_lookup[4412];
-    case 0xF95C: *len = 1; return &unicode_decompose_lookup[4413];
-    case 0xF95D: *len = 1; return &unicode_decompose_lookup[4414];
-    case 0xF95E: *len = 1; return &unicode_decompose_lookup[4415];
-    case 0xF95F: *len = 1; return &unicode_decompose_lookup[4416];
-    case 0xF960: *len = 1; return &unicode_decompose_lookup[4417];
-    case 0xF961: *len = 1; return &unicode_decompose_lookup[4418];
-    case 0xF962: *len = 1; return &unicode_decompose_lookup[4419];
-    case 0xF963: *len = 1; return &unicode_decompose_lookup[4420];
-    case 0xF964: *len = 1; return &unicode_decompose_lookup[4421];
-    case 0xF965: *len = 1; return &unicode_decompose_lookup[4422];
-    case 0xF966: *len = 1; return &unicode_decompose_lookup[4423];
-    case 0xF967: *len = 1; return &unicode_decompose_lookup[4424];
-    case 0xF968: *len = 1; return &unicode_decompose_lookup[4425];
-    case 0xF969: *len = 1; return &unicode_decompose_lookup[4426];
-    case 0xF96A: *len = 1; return &unicode_decompose_lookup[4427];
-    case 0xF96B: *len = 1; return &unicode_decompose_lookup[4428];
-    case 0xF96C: *len = 1; return &unicode_decompose_lookup[4429];
-    case 0xF96D: *len = 1; return &unicode_decompose_lookup[4430];
-    case 0xF96E: *len = 1; return &unicode_decompose_lookup[4431];
-    case 0xF96F: *len = 1; return &unicode_decompose_lookup[4432];
-    case 0xF970: *len = 1; return &unicode_decompose_lookup[4433];
-    case 0xF971: *len = 1; return &unicode_decompose_lookup[4434];
-    case 0xF972: *len = 1; return &unicode_decompose_lookup[4435];
-    case 0xF973: *len = 1; return &unicode_decompose_lookup[4436];
-    case 0xF974: *len = 1; return &unicode_decompose_lookup[4437];
-    case 0xF975: *len = 1; return &unicode_decompose_lookup[4438];
-    case 0xF976: *len = 1; return &unicode_decompose_lookup[4439];
-    case 0xF977: *len = 1; return &unicode_decompose_lookup[4440];
-    case 0xF978: *len = 1; return &unicode_decompose_lookup[4441];
-    case 0xF979: *len = 1; return &unicode_decompose_lookup[4442];
-    case 0xF97A: *len = 1; return &unicode_decompose_lookup[4443];
-    case 0xF97B: *len = 1; return &unicode_decompose_lookup[4444];
-    case 0xF97C: *len = 1; return &unicode_decompose_lookup[4445];
-    case 0xF97D: *len = 1; return &unicode_decompose_lookup[4446];
-    case 0xF97E: *len = 1; return &unicode_decompose_lookup[4447];
-    case 0xF97F: *len = 1; return &unicode_decompose_lookup[4448];
-    case 0xF980: *len = 1; return &unicode_decompose_lookup[4449];
-    case 0xF981: *len = 1; return &unicode_decompose_lookup[4450];
-    case 0xF982: *len = 1; return &unicode_decompose_lookup[4451];
-    case 0xF983: *len = 1; return &unicode_decompose_lookup[4452];
-    case 0xF984: *len = 1; return &unicode_decompose_lookup[4453];
-    case 0xF985: *len = 1; return &unicode_decompose_lookup[4454];
-    case 0xF986: *len = 1; return &unicode_decompose_lookup[4455];
-    case 0xF987: *len = 1; return &unicode_decompose_lookup[4456];
-    case 0xF988: *len = 1; return &unicode_decompose_lookup[4457];
-    case 0xF989: *len = 1; return &unicode_decompose_lookup[4458];
-    case 0xF98A: *len = 1; return &unicode_decompose_lookup[4459];
-    case 0xF98B: *len = 1; return &unicode_decompose_lookup[4460];
-    case 0xF98C: *len = 1; return &unicode_decompose_lookup[4461];
-    case 0xF98D: *len = 1; return &unicode_decompose_lookup[4462];
-    case 0xF98E: *len = 1; return &unicode_decompose_lookup[4463];
-    case 0xF98F: *len = 1; return &unicode_decompose_lookup[4464];
-    case 0xF990: *len = 1; return &unicode_decompose_lookup[4465];
-    case 0xF991: *len = 1; return &unicode_decompose_lookup[4466];
-    case 0xF992: *len = 1; return &unicode_decompose_lookup[4467];
-    case 0xF993: *len = 1; return &unicode_decompose_lookup[4468];
-    case 0xF994: *len = 1; return &unicode_decompose_lookup[4469];
-    case 0xF995: *len = 1; return &unicode_decompose_lookup[4470];
-    case 0xF996: *len = 1; return &unicode_decompose_lookup[4471];
-    case 0xF997: *len = 1; return &unicode_decompose_lookup[4472];
-    case 0xF998: *len = 1; return &unicode_decompose_lookup[4473];
-    case 0xF999: *len = 1; return &unicode_decompose_lookup[4474];
-    case 0xF99A: *len = 1; return &unicode_decompose_lookup[4475];
-    case 0xF99B: *len = 1; return &unicode_decompose_lookup[4476];
-    case 0xF99C: *len = 1; return &unicode_decompose_lookup[4477];
-    case 0xF99D: *len = 1; return &unicode_decompose_lookup[4478];
-    case 0xF99E: *len = 1; return &unicode_decompose_lookup[4479];
-    case 0xF99F: *len = 1; return &unicode_decompose_lookup[4480];
-    case 0xF9A0: *len = 1; return &unicode_decompose_lookup[4481];
-    case 0xF9A1: *len = 1; return &unicode_decompose_lookup[4482];
-    case 0xF9A2: *len = 1; return &unicode_decompose_lookup[4483];
-    case 0xF9A3: *len = 1; return &unicode_decompose_lookup[4484];
-    case 0xF9A4: *len = 1; return &unicode_decompose_lookup[4485];
-    case 0xF9A5: *len = 1; return &unicode_decompose_lookup[4486];
-    case 0xF9A6: *len = 1; return &unicode_decompose_lookup[4487];
-    case 0xF9A7: *len = 1; return &unicode_decompose_lookup[4488];
-    case 0xF9A8: *len = 1; return &unicode_decompose_lookup[4489];
-    case 0xF9A9: *len = 1; return &unicode_decompose_lookup[4490];
-    case 0xF9AA: *len = 1; return &unicode_decompose_lookup[4491];
-    case 0xF9AB: *len = 1; return &unicode_decompose_lookup[4492];
-    case 0xF9AC: *len = 1; return &unicode_decompose_lookup[4493];
-    case 0xF9AD: *len = 1; return &unicode_decompose_lookup[4494];
-    case 0xF9AE: *len = 1; return &unicode_decompose_lookup[4495];
-    case 0xF9AF: *len = 1; return &unicode_decompose_lookup[4496];
-    case 0xF9B0: *len = 1; return &unicode_decompose_lookup[4497];
-    case 0xF9B1: *len = 1; return &unicode_decompose_lookup[4498];
-    case 0xF9B2: *len = 1; return &unicode_decompose_lookup[4499];
-    case 0xF9B3: *len = 1; return &unicode_decompose_lookup[4500];
-    case 0xF9B4: *len = 1; return &unicode_decompose_lookup[4501];
-    case 0xF9B5: *len = 1; return &unicode_decompose_lookup[4502];
-    case 0xF9B6: *len = 1; return &unicode_decompose_lookup[4503];
-    case 0xF9B7: *len = 1; return &unicode_decompose_lookup[4504];
-    case 0xF9B8: *len = 1; return &unicode_decompose_lookup[4505];
-    case 0xF9B9: *len = 1; return &unicode_decompose_lookup[4506];
-    case 0xF9BA: *len = 1; return &unicode_decompose_lookup[4507];
-    case 0xF9BB: *len = 1; return &unicode_decompose_lookup[4508];
-    case 0xF9BC: *len = 1; return &unicode_decompose_lookup[4509];
-    case 0xF9BD: *len = 1; return &unicode_decompose_lookup[4510];
-    case 0xF9BE: *len = 1; return &unicode_decompose_lookup[4511];
-    case 0xF9BF: *len = 1; return &unicode_decompose_lookup[4512];
-    case 0xF9C0: *len = 1; return &unicode_decompose_lookup[4513];
-    case 0xF9C1: *len = 1; return &unicode_decompose_lookup[4514];
-    case 0xF9C2: *len = 1; return &unicode_decompose_lookup[4515];
-    case 0xF9C3: *len = 1; return &unicode_decompose_lookup[4516];
-    case 0xF9C4: *len = 1; return &unicode_decompose_lookup[4517];
-    case 0xF9C5: *len = 1; return &unicode_decompose_lookup[4518];
-    case 0xF9C6: *len = 1; return &unicode_decompose_lookup[4519];
-    case 0xF9C7: *len = 1; return &unicode_decompose_lookup[4520];
-    case 0xF9C8: *len = 1; return &unicode_decompose_lookup[4521];
-    case 0xF9C9: *len = 1; return &unicode_decompose_lookup[4522];
-    case 0xF9CA: *len = 1; return &unicode_decompose_lookup[4523];
-    case 0xF9CB: *len = 1; return &unicode_decompose_lookup[4524];
-    case 0xF9CC: *len = 1; return &unicode_decompose_lookup[4525];
-    case 0xF9CD: *len = 1; return &unicode_decompose_lookup[4526];
-    case 0xF9CE: *len = 1; return &unicode_decompose_lookup[4527];
-    case 0xF9CF: *len = 1; return &unicode_decompose_lookup[4528];
-    case 0xF9D0: *len = 1; return &unicode_decompose_lookup[4529];
-    case 0xF9D1: *len = 1; return &unicode_decompose_lookup[4530];
-    case 0xF9D2: *len = 1; return &unicode_decompose_lookup[4531];
-    case 0xF9D3: *len = 1; return &unicode_decompose_lookup[4532];
-    case 0xF9D4: *len = 1; return &unicode_decompose_lookup[4533];
-    case 0xF9D5: *len = 1; return &unicode_decompose_lookup[4534];
-    case 0xF9D6: *len = 1; return &unicode_decompose_lookup[4535];
-    case 0xF9D7: *len = 1; return &unicode_decompose_lookup[4536];
-    case 0xF9D8: *len = 1; return &unicode_decompose_lookup[4537];
-    case 0xF9D9: *len = 1; return &unicode_decompose_lookup[4538];
-    case 0xF9DA: *len = 1; return &unicode_decompose_lookup[4539];
-    case 0xF9DB: *len = 1; return &unicode_decompose_lookup[4540];
-    case 0xF9DC: *len = 1; return &unicode_decompose_lookup[4541];
-    case 0xF9DD: *len = 1; return &unicode_decompose_lookup[4542];
-    case 0xF9DE: *len = 1; return &unicode_decompose_lookup[4543];
-    case 0xF9DF: *len = 1; return &unicode_decompose_lookup[4544];
-    case 0xF9E0: *len = 1; return &unicode_decompose_lookup[4545];
-    case 0xF9E1: *len = 1; return &unicode_decompose_lookup[4546];
-    case 0xF9E2: *len = 1; return &unicode_decompose_lookup[4547];
-    case 0xF9E3: *len = 1; return &unicode_decompose_lookup[4548];
-    case 0xF9E4: *len = 1; return &unicode_decompose_lookup[4549];
-    case 0xF9E5: *len = 1; return &unicode_decompose_lookup[4550];
-    case 0xF9E6: *len = 1; return &unicode_decompose_lookup[4551];
-    case 0xF9E7: *len = 1; return &unicode_decompose_lookup[4552];
-    case 0xF9E8: *len = 1; return &unicode_decompose_lookup[4553];
-    case 0xF9E9: *len = 1; return &unicode_decompose_lookup[4554];
-    case 0xF9EA: *len = 1; return &unicode_decompose_lookup[4555];
-    case 0xF9EB: *len = 1; return &unicode_decompose_lookup[4556];
-    case 0xF9EC: *len = 1; return &unicode_decompose_lookup[4557];
-    case 0xF9ED: *len = 1; return &unicode_decompose_lookup[4558];
-    case 0xF9EE: *len = 1; return &unicode_decompose_lookup[4559];
-    case 0xF9EF: *len = 1; return &unicode_decompose_lookup[4560];
-    case 0xF9F0: *len = 1; return &unicode_decompose_lookup[4561];
-    case 0xF9F1: *len = 1; return &unicode_decompose_lookup[4562];
-    case 0xF9F2: *len = 1; return &unicode_decompose_lookup[4563];
-    case 0xF9F3: *len = 1; return &unicode_decompose_lookup[4564];
-    case 0xF9F4: *len = 1; return &unicode_decompose_lookup[4565];
-    case 0xF9F5: *len = 1; return &unicode_decompose_lookup[4566];
-    case 0xF9F6: *len = 1; return &unicode_decompose_lookup[4567];
-    case 0xF9F7: *len = 1; return &unicode_decompose_lookup[4568];
-    case 0xF9F8: *len = 1; return &unicode_decompose_lookup[4569];
-    case 0xF9F9: *len = 1; return &unicode_decompose_lookup[4570];
-    case 0xF9FA: *len = 1; return &unicode_decompose_lookup[4571];
-    case 0xF9FB: *len = 1; return &unicode_decompose_lookup[4572];
-    case 0xF9FC: *len = 1; return &unicode_decompose_lookup[4573];
-    case 0xF9FD: *len = 1; return &unicode_decompose_lookup[4574];
-    case 0xF9FE: *len = 1; return &unicode_decompose_lookup[4575];
-    case 0xF9FF: *len = 1; return &unicode_decompose_lookup[4576];
-    case 0xFA00: *len = 1; return &unicode_decompose_lookup[4577];
-    case 0xFA01: *len = 1; return &unicode_decompose_lookup[4578];
-    case 0xFA02: *len = 1; return &unicode_decompose_lookup[4579];
-    case 0xFA03: *len = 1; return &unicode_decompose_lookup[4580];
-    case 0xFA04: *len = 1; return &unicode_decompose_lookup[4581];
-    case 0xFA05: *len = 1; return &unicode_decompose_lookup[4582];
-    case 0xFA06: *len = 1; return &unicode_decompose_lookup[4583];
-    case 0xFA07: *len = 1; return &unicode_decompose_lookup[4584];
-    case 0xFA08: *len = 1; return &unicode_decompose_lookup[4585];
-    case 0xFA09: *len = 1; return &unicode_decompose_lookup[4586];
-    case 0xFA0A: *len = 1; return &unicode_decompose_lookup[4587];
-    case 0xFA0B: *len = 1; return &unicode_decompose_lookup[4588];
-    case 0xFA0C: *len = 1; return &unicode_decompose_lookup[4589];
-    case 0xFA0D: *len = 1; return &unicode_decompose_lookup[4590];
-    case 0xFA10: *len = 1; return &unicode_decompose_lookup[4591];
-    case 0xFA12: *len = 1; return &unicode_decompose_lookup[4592];
-    case 0xFA15: *len = 1; return &unicode_decompose_lookup[4593];
-    case 0xFA16: *len = 1; return &unicode_decompose_lookup[4594];
-    case 0xFA17: *len = 1; return &unicode_decompose_lookup[4595];
-    case 0xFA18: *len = 1; return &unicode_decompose_lookup[4596];
-    case 0xFA19: *len = 1; return &unicode_decompose_lookup[4597];
-    case 0xFA1A: *len = 1; return &unicode_decompose_lookup[4598];
-    case 0xFA1B: *len = 1; return &unicode_decompose_lookup[4599];
-    case 0xFA1C: *len = 1; return &unicode_decompose_lookup[4600];
-    case 0xFA1D: *len = 1; return &unicode_decompose_lookup[4601];
-    case 0xFA1E: *len = 1; return &unicode_decompose_lookup[4602];
-    case 0xFA20: *len = 1; return &unicode_decompose_lookup[4603];
-    case 0xFA22: *len = 1; return &unicode_decompose_lookup[4604];
-    case 0xFA25: *len = 1; return &unicode_decompose_lookup[4605];
-    case 0xFA26: *len = 1; return &unicode_decompose_lookup[4606];
-    case 0xFA2A: *len = 1; return &unicode_decompose_lookup[4607];
-    case 0xFA2B: *len = 1; return &unicode_decompose_lookup[4608];
-    case 0xFA2C: *len = 1; return &unicode_decompose_lookup[4609];
-    case 0xFA2D: *len = 1; return &unicode_decompose_lookup[4610];
-    case 0xFA2E: *len = 1; return &unicode_decompose_lookup[4611];
-    case 0xFA2F: *len = 1; return &unicode_decompose_lookup[4612];
-    case 0xFA30: *len = 1; return &unicode_decompose_lookup[4613];
-    case 0xFA31: *len = 1; return &unicode_decompose_lookup[4614];
-    case 0xFA32: *len = 1; return &unicode_decompose_lookup[4615];
-    case 0xFA33: *len = 1; return &unicode_decompose_lookup[4616];
-    case 0xFA34: *len = 1; return &unicode_decompose_lookup[4617];
-    case 0xFA35: *len = 1; return &unicode_decompose_lookup[4618];
-    case 0xFA36: *len = 1; return &unicode_decompose_lookup[4619];
-    case 0xFA37: *len = 1; return &unicode_decompose_lookup[4620];
-    case 0xFA38: *len = 1; return &unicode_decompose_lookup[4621];
-    case 0xFA39: *len = 1; return &unicode_decompose_lookup[4622];
-    case 0xFA3A: *len = 1; return &unicode_decompose_lookup[4623];
-    case 0xFA3B: *len = 1; return &unicode_decompose_lookup[4624];
-    case 0xFA3C: *len = 1; return &unicode_decompose_lookup[4625];
-    case 0xFA3D: *len = 1; return &unicode_decompose_lookup[4626];
-    case 0xFA3E: *len = 1; return &unicode_decompose_lookup[4627];
-    case 0xFA3F: *len = 1; return &unicode_decompose_lookup[4628];
-    case 0xFA40: *len = 1; return &unicode_decompose_lookup[4629];
-    case 0xFA41: *len = 1; return &unicode_decompose_lookup[4630];
-    case 0xFA42: *len = 1; return &unicode_decompose_lookup[4631];
-    case 0xFA43: *len = 1; return &unicode_decompose_lookup[4632];
-    case 0xFA44: *len = 1; return &unicode_decompose_lookup[4633];
-    case 0xFA45: *len = 1; return &unicode_decompose_lookup[4634];
-    case 0xFA46: *len = 1; return &unicode_decompose_lookup[4635];
-    case 0xFA47: *len = 1; return &unicode_decompose_lookup[4636];
-    case 0xFA48: *len = 1; return &unicode_decompose_lookup[4637];
-    case 0xFA49: *len = 1; return &unicode_decompose_lookup[4638];
-    case 0xFA4A: *len = 1; return &unicode_decompose_lookup[4639];
-    case 0xFA4B: *len = 1; return &unicode_decompose_lookup[4640];
-    case 0xFA4C: *len = 1; return &unicode_decompose_lookup[4641];
-    case 0xFA4D: *len = 1; return &unicode_decompose_lookup[4642];
-    case 0xFA4E: *len = 1; return &unicode_decompose_lookup[4643];
-    case 0xFA4F: *len = 1; return &unicode_decompose_lookup[4644];
-    case 0xFA50: *len = 1; return &unicode_decompose_lookup[4645];
-    case 0xFA51: *len = 1; return &unicode_decompose_lookup[4646];
-    case 0xFA52: *len = 1; return &unicode_decompose_lookup[4647];
-    case 0xFA53: *len = 1; return &unicode_decompose_lookup[4648];
-    case 0xFA54: *len = 1; return &unicode_decompose_lookup[4649];
-    case 0xFA55: *len = 1; return &unicode_decompose_lookup[4650];
-    case 0xFA56: *len = 1; return &unicode_decompose_lookup[4651];
-    case 0xFA57: *len = 1; return &unicode_decompose_lookup[4652];
-    case 0xFA58: *len = 1; return &unicode_decompose_lookup[4653];
-    case 0xFA59: *len = 1; return &unicode_decompose_lookup[4654];
-    case 0xFA5A: *len = 1; return &unicode_decompose_lookup[4655];
-    case 0xFA5B: *len = 1; return &unicode_decompose_lookup[4656];
-    case 0xFA5C: *len = 1; return &unicode_decompose_lookup[4657];
-    case 0xFA5D: *len = 1; return &unicode_decompose_lookup[4658];
-    case 0xFA5E: *len = 1; return &unicode_decompose_lookup[4659];
-    case 0xFA5F: *len = 1; return &unicode_decompose_lookup[4660];
-    case 0xFA60: *len = 1; return &unicode_decompose_lookup[4661];
-    case 0xFA61: *len = 1; return &unicode_decompose_lookup[4662];
-    case 0xFA62: *len = 1; return &unicode_decompose_lookup[4663];
-    case 0xFA63: *len = 1; return &unicode_decompose_lookup[4664];
-    case 0xFA64: *len = 1; return &unicode_decompose_lookup[4665];
-    case 0xFA65: *len = 1; return &unicode_decompose_lookup[4666];
-    case 0xFA66: *len = 1; return &unicode_decompose_lookup[4667];
-    case 0xFA67: *len = 1; return &unicode_decompose_lookup[4668];
-    case 0xFA68: *len = 1; return &unicode_decompose_lookup[4669];
-    case 0xFA69: *len = 1; return &unicode_decompose_lookup[4670];
-    case 0xFA6A: *len = 1; return &unicode_decompose_lookup[4671];
-    case 0xFA6B: *len = 1; return &unicode_decompose_lookup[4672];
-    case 0xFA6C: *len = 1; return &unicode_decompose_lookup[4673];
-    case 0xFA6D: *len = 1; return &unicode_decompose_lookup[4674];
-    case 0xFA70: *len = 1; return &unicode_decompose_lookup[4675];
-    case 0xFA71: *len = 1; return &unicode_decompose_lookup[4676];
-    case 0xFA72: *len = 1; return &unicode_decompose_lookup[4677];
-    case 0xFA73: *len = 1; return &unicode_decompose_lookup[4678];
-    case 0xFA74: *len = 1; return &unicode_decompose_lookup[4679];
-    case 0xFA75: *len = 1; return &unicode_decompose_lookup[4680];
-    case 0xFA76: *len = 1; return &unicode_decompose_lookup[4681];
-    case 0xFA77: *len = 1; return &unicode_decompose_lookup[4682];
-    case 0xFA78: *len = 1; return &unicode_decompose_lookup[4683];
-    case 0xFA79: *len = 1; return &unicode_decompose_lookup[4684];
-    case 0xFA7A: *len = 1; return &unicode_decompose_lookup[4685];
-    case 0xFA7B: *len = 1; return &unicode_decompose_lookup[4686];
-    case 0xFA7C: *len = 1; return &unicode_decompose_lookup[4687];
-    case 0xFA7D: *len = 1; return &unicode_decompose_lookup[4688];
-    case 0xFA7E: *len = 1; return &unicode_decompose_lookup[4689];
-    case 0xFA7F: *len = 1; return &unicode_decompose_lookup[4690];
-    case 0xFA80: *len = 1; return &unicode_decompose_lookup[4691];
-    case 0xFA81: *len = 1; return &unicode_decompose_lookup[4692];
-    case 0xFA82: *len = 1; return &unicode_decompose_lookup[4693];
-    case 0xFA83: *len = 1; return &unicode_decompose_lookup[4694];
-    case 0xFA84: *len = 1; return &unicode_decompose_lookup[4695];
-    case 0xFA85: *len = 1; return &unicode_decompose_lookup[4696];
-    case 0xFA86: *len = 1; return &unicode_decompose_lookup[4697];
-    case 0xFA87: *len = 1; return &unicode_decompose_lookup[4698];
-    case 0xFA88: *len = 1; return &unicode_decompose_lookup[4699];
-    case 0xFA89: *len = 1; return &unicode_decompose_lookup[4700];
-    case 0xFA8A: *len = 1; return &unicode_decompose_lookup[4701];
-    case 0xFA8B: *len = 1; return &unicode_decompose_lookup[4702];
-    case 0xFA8C: *len = 1; return &unicode_decompose_lookup[4703];
-    case 0xFA8D: *len = 1; return &unicode_decompose_lookup[4704];
-    case 0xFA8E: *len = 1; return &unicode_decompose_lookup[4705];
-    case 0xFA8F: *len = 1; return &unicode_decompose_lookup[4706];
-    case 0xFA90: *len = 1; return &unicode_decompose_lookup[4707];
-    case 0xFA91: *len = 1; return &unicode_decompose_lookup[4708];
-    case 0xFA92: *len = 1; return &unicode_decompose_lookup[4709];
-    case 0xFA93: *len = 1; return &unicode_decompose_lookup[4710];
-    case 0xFA94: *len = 1; return &unicode_decompose_lookup[4711];
-    case 0xFA95: *len = 1; return &unicode_decompose_lookup[4712];
-    case 0xFA96: *len = 1; return &unicode_decompose_lookup[4713];
-    case 0xFA97: *len = 1; return &unicode_decompose_lookup[4714];
-    case 0xFA98: *len = 1; return &unicode_decompose_lookup[4715];
-    case 0xFA99: *len = 1; return &unicode_decompose_lookup[4716];
-    case 0xFA9A: *len = 1; return &unicode_decompose_lookup[4717];
-    case 0xFA9B: *len = 1; return &unicode_decompose_lookup[4718];
-    case 0xFA9C: *len = 1; return &unicode_decompose_lookup[4719];
-    case 0xFA9D: *len = 1; return &unicode_decompose_lookup[4720];
-    case 0xFA9E: *len = 1; return &unicode_decompose_lookup[4721];
-    case 0xFA9F: *len = 1; return &unicode_decompose_lookup[4722];
-    case 0xFAA0: *len = 1; return &unicode_decompose_lookup[4723];
-    case 0xFAA1: *len = 1; return &unicode_decompose_lookup[4724];
-    case 0xFAA2: *len = 1; return &unicode_decompose_lookup[4725];
-    case 0xFAA3: *len = 1; return &unicode_decompose_lookup[4726];
-    case 0xFAA4: *len = 1; return &unicode_decompose_lookup[4727];
-    case 0xFAA5: *len = 1; return &unicode_decompose_lookup[4728];
-    case 0xFAA6: *len = 1; return &unicode_decompose_lookup[4729];
-    case 0xFAA7: *len = 1; return &unicode_decompose_lookup[4730];
-    case 0xFAA8: *len = 1; return &unicode_decompose_lookup[4731];
-    case 0xFAA9: *len = 1; return &unicode_decompose_lookup[4732];
-    case 0xFAAA: *len = 1; return &unicode_decompose_lookup[4733];
-    case 0xFAAB: *len = 1; return &unicode_decompose_lookup[4734];
-    case 0xFAAC: *len = 1; return &unicode_decompose_lookup[4735];
-    case 0xFAAD: *len = 1; return &unicode_decompose_lookup[4736];
-    case 0xFAAE: *len = 1; return &unicode_decompose_lookup[4737];
-    case 0xFAAF: *len = 1; return &unicode_decompose_lookup[4738];
-    case 0xFAB0: *len = 1; return &unicode_decompose_lookup[4739];
-    case 0xFAB1: *len = 1; return &unicode_decompose_lookup[4740];
-    case 0xFAB2: *len = 1; return &unicode_decompose_lookup[4741];
-    case 0xFAB3: *len = 1; return &unicode_decompose_lookup[4742];
-    case 0xFAB4: *len = 1; return &unicode_decompose_lookup[4743];
-    case 0xFAB5: *len = 1; return &unicode_decompose_lookup[4744];
-    case 0xFAB6: *len = 1; return &unicode_decompose_lookup[4745];
-    case 0xFAB7: *len = 1; return &unicode_decompose_lookup[4746];
-    case 0xFAB8: *len = 1; return &unicode_decompose_lookup[4747];
-    case 0xFAB9: *len = 1; return &unicode_decompose_lookup[4748];
-    case 0xFABA: *len = 1; return &unicode_decompose_lookup[4749];
-    case 0xFABB: *len = 1; return &unicode_decompose_lookup[4750];
-    case 0xFABC: *len = 1; return &unicode_decompose_lookup[4751];
-    case 0xFABD: *len = 1; return &unicode_decompose_lookup[4752];
-    case 0xFABE: *len = 1; return &unicode_decompose_lookup[4753];
-    case 0xFABF: *len = 1; return &unicode_decompose_lookup[4754];
-    case 0xFAC0: *len = 1; return &unicode_decompose_lookup[4755];
-    case 0xFAC1: *len = 1; return &unicode_decompose_lookup[4756];
-    case 0xFAC2: *len = 1; return &unicode_decompose_lookup[4757];
-    case 0xFAC3: *len = 1; return &unicode_decompose_lookup[4758];
-    case 0xFAC4: *len = 1; return &unicode_decompose_lookup[4759];
-    case 0xFAC5: *len = 1; return &unicode_decompose_lookup[4760];
-    case 0xFAC6: *len = 1; return &unicode_decompose_lookup[4761];
-    case 0xFAC7: *len = 1; return &unicode_decompose_lookup[4762];
-    case 0xFAC8: *len = 1; return &unicode_decompose_lookup[4763];
-    case 0xFAC9: *len = 1; return &unicode_decompose_lookup[4764];
-    case 0xFACA: *len = 1; return &unicode_decompose_lookup[4765];
-    case 0xFACB: *len = 1; return &unicode_decompose_lookup[4766];
-    case 0xFACC: *len = 1; return &unicode_decompose_lookup[4767];
-    case 0xFACD: *len = 1; return &unicode_decompose_lookup[4768];
-    case 0xFACE: *len = 1; return &unicode_decompose_lookup[4769];
-    case 0xFACF: *len = 1; return &unicode_decompose_lookup[4770];
-    case 0xFAD0: *len = 1; return &unicode_decompose_lookup[4771];
-    case 0xFAD1: *len = 1; return &unicode_decompose_lookup[4772];
-    case 0xFAD2: *len = 1; return &unicode_decompose_lookup[4773];
-    case 0xFAD3: *len = 1; return &unicode_decompose_lookup[4774];
-    case 0xFAD4: *len = 1; return &unicode_decompose_lookup[4775];
-    case 0xFAD5: *len = 1; return &unicode_decompose_lookup[4776];
-    case 0xFAD6: *len = 1; return &unicode_decompose_lookup[4777];
-    case 0xFAD7: *len = 1; return &unicode_decompose_lookup[4778];
-    case 0xFAD8: *len = 1; return &unicode_decompose_lookup[4779];
-    case 0xFAD9: *len = 1; return &unicode_decompose_lookup[4780];
-    case 0xFB1D: *len = 2; return &unicode_decompose_lookup[4807];
-    case 0xFB1F: *len = 2; return &unicode_decompose_lookup[4809];
-    case 0xFB2A: *len = 2; return &unicode_decompose_lookup[4821];
-    case 0xFB2B: *len = 2; return &unicode_decompose_lookup[4823];
-    case 0xFB2C: *len = 2; return &unicode_decompose_lookup[4825];
-    case 0xFB2D: *len = 2; return &unicode_decompose_lookup[4827];
-    case 0xFB2E: *len = 2; return &unicode_decompose_lookup[4829];
-    case 0xFB2F: *len = 2; return &unicode_decompose_lookup[4831];
-    case 0xFB30: *len = 2; return &unicode_decompose_lookup[4833];
-    case 0xFB31: *len = 2; return &unicode_decompose_lookup[4835];
-    case 0xFB32: *len = 2; return &unicode_decompose_lookup[4837];
-    case 0xFB33: *len = 2; return &unicode_decompose_lookup[4839];
-    case 0xFB34: *len = 2; return &unicode_decompose_lookup[4841];
-    case 0xFB35: *len = 2; return &unicode_decompose_lookup[4843];
-    case 0xFB36: *len = 2; return &unicode_decompose_lookup[4845];
-    case 0xFB38: *len = 2; return &unicode_decompose_lookup[4847];
-    case 0xFB39: *len = 2; return &unicode_decompose_lookup[4849];
-    case 0xFB3A: *len = 2; return &unicode_decompose_lookup[4851];
-    case 0xFB3B: *len = 2; return &unicode_decompose_lookup[4853];
-    case 0xFB3C: *len = 2; return &unicode_decompose_lookup[4855];
-    case 0xFB3E: *len = 2; return &unicode_decompose_lookup[4857];
-    case 0xFB40: *len = 2; return &unicode_decompose_lookup[4859];
-    case 0xFB41: *len = 2; return &unicode_decompose_lookup[4861];
-    case 0xFB43: *len = 2; return &unicode_decompose_lookup[4863];
-    case 0xFB44: *len = 2; return &unicode_decompose_lookup[4865];
-    case 0xFB46: *len = 2; return &unicode_decompose_lookup[4867];
-    case 0xFB47: *len = 2; return &unicode_decompose_lookup[4869];
-    case 0xFB48: *len = 2; return &unicode_decompose_lookup[4871];
-    case 0xFB49: *len = 2; return &unicode_decompose_lookup[4873];
-    case 0xFB4A: *len = 2; return &unicode_decompose_lookup[4875];
-    case 0xFB4B: *len = 2; return &unicode_decompose_lookup[4877];
-    case 0xFB4C: *len = 2; return &unicode_decompose_lookup[4879];
-    case 0xFB4D: *len = 2; return &unicode_decompose_lookup[4881];
-    case 0xFB4E: *len = 2; return &unicode_decompose_lookup[4883];
-    case 0x1109A: *len = 2; return &unicode_decompose_lookup[6566];
-    case 0x1109C: *len = 2; return &unicode_decompose_lookup[6568];
-    case 0x110AB: *len = 2; return &unicode_decompose_lookup[6570];
-    case 0x1112E: *len = 2; return &unicode_decompose_lookup[6572];
-    case 0x1112F: *len = 2; return &unicode_decompose_lookup[6574];
-    case 0x1134B: *len = 2; return &unicode_decompose_lookup[6576];
-    case 0x1134C: *len = 2; return &unicode_decompose_lookup[6578];
-    case 0x114BB: *len = 2; return &unicode_decompose_lookup[6580];
-    case 0x114BC: *len = 2; return &unicode_decompose_lookup[6582];
-    case 0x114BE: *len = 2; return &unicode_decompose_lookup[6584];
-    case 0x115BA: *len = 2; return &unicode_decompose_lookup[6586];
-    case 0x115BB: *len = 2; return &unicode_decompose_lookup[6588];
-    case 0x1D15E: *len = 2; return &unicode_decompose_lookup[6590];
-    case 0x1D15F: *len = 2; return &unicode_decompose_lookup[6592];
-    case 0x1D160: *len = 2; return &unicode_decompose_lookup[6594];
-    case 0x1D161: *len = 2; return &unicode_decompose_lookup[6596];
-    case 0x1D162: *len = 2; return &unicode_decompose_lookup[6598];
-    case 0x1D163: *len = 2; return &unicode_decompose_lookup[6600];
-    case 0x1D164: *len = 2; return &unicode_decompose_lookup[6602];
-    case 0x1D1BB: *len = 2; return &unicode_decompose_lookup[6604];
-    case 0x1D1BC: *len = 2; return &unicode_decompose_lookup[6606];
-    case 0x1D1BD: *len = 2; return &unicode_decompose_lookup[6608];
-    case 0x1D1BE: *len = 2; return &unicode_decompose_lookup[6610];
-    case 0x1D1BF: *len = 2; return &unicode_decompose_lookup[6612];
-    case 0x1D1C0: *len = 2; return &unicode_decompose_lookup[6614];
-    case 0x2F800: *len = 1; return &unicode_decompose_lookup[7987];
-    case 0x2F801: *len = 1; return &unicode_decompose_lookup[7988];
-    case 0x2F802: *len = 1; return &unicode_decompose_lookup[7989];
-    case 0x2F803: *len = 1; return &unicode_decompose_lookup[7990];
-    case 0x2F804: *len = 1; return &unicode_decompose_lookup[7991];
-    case 0x2F805: *len = 1; return &unicode_decompose_lookup[7992];
-    case 0x2F806: *len = 1; return &unicode_decompose_lookup[7993];
-    case 0x2F807: *len = 1; return &unicode_decompose_lookup[7994];
-    case 0x2F808: *len = 1; return &unicode_decompose_lookup[7995];
-    case 0x2F809: *len = 1; return &unicode_decompose_lookup[7996];
-    case 0x2F80A: *len = 1; return &unicode_decompose_lookup[7997];
-    case 0x2F80B: *len = 1; return &unicode_decompose_lookup[7998];
-    case 0x2F80C: *len = 1; return &unicode_decompose_lookup[7999];
-    case 0x2F80D: *len = 1; return &unicode_decompose_lookup[8000];
-    case 0x2F80E: *len = 1; return &unicode_decompose_lookup[8001];
-    case 0x2F80F: *len = 1; return &unicode_decompose_lookup[8002];
-    case 0x2F810: *len = 1; return &unicode_decompose_lookup[8003];
-    case 0x2F811: *len = 1; return &unicode_decompose_lookup[8004];
-    case 0x2F812: *len = 1; return &unicode_decompose_lookup[8005];
-    case 0x2F813: *len = 1; return &unicode_decompose_lookup[8006];
-    case 0x2F814: *len = 1; return &unicode_decompose_lookup[8007];
-    case 0x2F815: *len = 1; return &unicode_decompose_lookup[8008];
-    case 0x2F816: *len = 1; return &unicode_decompose_lookup[8009];
-    case 0x2F817: *len = 1; return &unicode_decompose_lookup[8010];
-    case 0x2F818: *len = 1; return &unicode_decompose_lookup[8011];
-    case 0x2F819: *len = 1; return &unicode_decompose_lookup[8012];
-    case 0x2F81A: *len = 1; return &unicode_decompose_lookup[8013];
-    case 0x2F81B: *len = 1; return &unicode_decompose_lookup[8014];
-    case 0x2F81C: *len = 1; return &unicode_decompose_lookup[8015];
-    case 0x2F81D: *len = 1; return &unicode_decompose_lookup[8016];
-    case 0x2F81E: *len = 1; return &unicode_decompose_lookup[8017];
-    case 0x2F81F: *len = 1; return &unicode_decompose_lookup[8018];
-    case 0x2F820: *len = 1; return &unicode_decompose_lookup[8019];
-    case 0x2F821: *len = 1; return &unicode_decompose_lookup[8020];
-    case 0x2F822: *len = 1; return &unicode_decompose_lookup[8021];
-    case 0x2F823: *len = 1; return &unicode_decompose_lookup[8022];
-    case 0x2F824: *len = 1; return &unicode_decompose_lookup[8023];
-    case 0x2F825: *len = 1; return &unicode_decompose_lookup[8024];
-    case 0x2F826: *len = 1; return &unicode_decompose_lookup[8025];
-    case 0x2F827: *len = 1; return &unicode_decompose_lookup[8026];
-    case 0x2F828: *len = 1; return &unicode_decompose_lookup[8027];
-    case 0x2F829: *len = 1; return &unicode_decompose_lookup[8028];
-    case 0x2F82A: *len = 1; return &unicode_decompose_lookup[8029];
-    case 0x2F82B: *len = 1; return &unicode_decompose_lookup[8030];
-    case 0x2F82C: *len = 1; return &unicode_decompose_lookup[8031];
-    case 0x2F82D: *len = 1; return &unicode_decompose_lookup[8032];
-    case 0x2F82E: *len = 1; return &unicode_decompose_lookup[8033];
-    case 0x2F82F: *len = 1; return &unicode_decompose_lookup[8034];
-    case 0x2F830: *len = 1; return &unicode_decompose_lookup[8035];
-    case 0x2F831: *len = 1; return &unicode_decompose_lookup[8036];
-    case 0x2F832: *len = 1; return &unicode_decompose_lookup[8037];
-    case 0x2F833: *len = 1; return &unicode_decompose_lookup[8038];
-    case 0x2F834: *len = 1; return &unicode_decompose_lookup[8039];
-    case 0x2F835: *len = 1; return &unicode_decompose_lookup[8040];
-    case 0x2F836: *len = 1; return &unicode_decompose_lookup[8041];
-    case 0x2F837: *len = 1; return &unicode_decompose_lookup[8042];
-    case 0x2F838: *len = 1; return &unicode_decompose_lookup[8043];
-    case 0x2F839: *len = 1; return &unicode_decompose_lookup[8044];
-    case 0x2F83A: *len = 1; return &unicode_decompose_lookup[8045];
-    case 0x2F83B: *len = 1; return &unicode_decompose_lookup[8046];
-    case 0x2F83C: *len = 1; return &unicode_decompose_lookup[8047];
-    case 0x2F83D: *len = 1; return &unicode_decompose_lookup[8048];
-    case 0x2F83E: *len = 1; return &unicode_decompose_lookup[8049];
-    case 0x2F83F: *len = 1; return &unicode_decompose_lookup[8050];
-    case 0x2F840: *len = 1; return &unicode_decompose_lookup[8051];
-    case 0x2F841: *len = 1; return &unicode_decompose_lookup[8052];
-    case 0x2F842: *len = 1; return &unicode_decompose_lookup[8053];
-    case 0x2F843: *len = 1; return &unicode_decompose_lookup[8054];
-    case 0x2F844: *len = 1; return &unicode_decompose_lookup[8055];
-    case 0x2F845: *len = 1; return &unicode_decompose_lookup[8056];
-    case 0x2F846: *len = 1; return &unicode_decompose_lookup[8057];
-    case 0x2F847: *len = 1; return &unicode_decompose_lookup[8058];
-    case 0x2F848: *len = 1; return &unicode_decompose_lookup[8059];
-    case 0x2F849: *len = 1; return &unicode_decompose_lookup[8060];
-    case 0x2F84A: *len = 1; return &unicode_decompose_lookup[8061];
-    case 0x2F84B: *len = 1; return &unicode_decompose_lookup[8062];
-    case 0x2F84C: *len = 1; return &unicode_decompose_lookup[8063];
-    case 0x2F84D: *len = 1; return &unicode_decompose_lookup[8064];
-    case 0x2F84E: *len = 1; return &unicode_decompose_lookup[8065];
-    case 0x2F84F: *len = 1; return &unicode_decompose_lookup[8066];
-    case 0x2F850: *len = 1; return &unicode_decompose_lookup[8067];
-    case 0x2F851: *len = 1; return &unicode_decompose_lookup[8068];
-    case 0x2F852: *len = 1; return &unicode_decompose_lookup[8069];
-    case 0x2F853: *len = 1; return &unicode_decompose_lookup[8070];
-    case 0x2F854: *len = 1; return &unicode_decompose_lookup[8071];
-    case 0x2F855: *len = 1; return &unicode_decompose_lookup[8072];
-    case 0x2F856: *len = 1; return &unicode_decompose_lookup[8073];
-    case 0x2F857: *len = 1; return &unicode_decompose_lookup[8074];
-    case 0x2F858: *len = 1; return &unicode_decompose_lookup[8075];
-    case 0x2F859: *len = 1; return &unicode_decompose_lookup[8076];
-    case 0x2F85A: *len = 1; return &unicode_decompose_lookup[8077];
-    case 0x2F85B: *len = 1; return &unicode_decompose_lookup[8078];
-    case 0x2F85C: *len = 1; return &unicode_decompose_lookup[8079];
-    case 0x2F85D: *len = 1; return &unicode_decompose_lookup[8080];
-    case 0x2F85E: *len = 1; return &unicode_decompose_lookup[8081];
-    case 0x2F85F: *len = 1; return &unicode_decompose_lookup[8082];
-    case 0x2F860: *len = 1; return &unicode_decompose_lookup[8083];
-    case 0x2F861: *len = 1; return &unicode_decompose_lookup[8084];
-    case 0x2F862: *len = 1; return &unicode_decompose_lookup[8085];
-    case 0x2F863: *len = 1; return &unicode_decompose_lookup[8086];
-    case 0x2F864: *len = 1; return &unicode_decompose_lookup[8087];
-    case 0x2F865: *len = 1; return &unicode_decompose_lookup[8088];
-    case 0x2F866: *len = 1; return &unicode_decompose_lookup[8089];
-    case 0x2F867: *len = 1; return &unicode_decompose_lookup[8090];
-    case 0x2F868: *len = 1; return &unicode_decompose_lookup[8091];
-    case 0x2F869: *len = 1; return &unicode_decompose_lookup[8092];
-    case 0x2F86A: *len = 1; return &unicode_decompose_lookup[8093];
-    case 0x2F86B: *len = 1; return &unicode_decompose_lookup[8094];
-    case 0x2F86C: *len = 1; return &unicode_decompose_lookup[8095];
-    case 0x2F86D: *len = 1; return &unicode_decompose_lookup[8096];
-    case 0x2F86E: *len = 1; return &unicode_decompose_lookup[8097];
-    case 0x2F86F: *len = 1; return &unicode_decompose_lookup[8098];
-    case 0x2F870: *len = 1; return &unicode_decompose_lookup[8099];
-    case 0x2F871: *len = 1; return &unicode_decompose_lookup[8100];
-    case 0x2F872: *len = 1; return &unicode_decompose_lookup[8101];
-    case 0x2F873: *len = 1; return &unicode_decompose_lookup[8102];
-    case 0x2F874: *len = 1; return &unicode_decompose_lookup[8103];
-    case 0x2F875: *len = 1; return &unicode_decompose_lookup[8104];
-    case 0x2F876: *len = 1; return &unicode_decompose_lookup[8105];
-    case 0x2F877: *len = 1; return &unicode_decompose_lookup[8106];
-    case 0x2F878: *len = 1; return &unicode_decompose_lookup[8107];
-    case 0x2F879: *len = 1; return &unicode_decompose_lookup[8108];
-    case 0x2F87A: *len = 1; return &unicode_decompose_lookup[8109];
-    case 0x2F87B: *len = 1; return &unicode_decompose_lookup[8110];
-    case 0x2F87C: *len = 1; return &unicode_decompose_lookup[8111];
-    case 0x2F87D: *len = 1; return &unicode_decompose_lookup[8112];
-    case 0x2F87E: *len = 1; return &unicode_decompose_lookup[8113];
-    case 0x2F87F: *len = 1; return &unicode_decompose_lookup[8114];
-    case 0x2F880: *len = 1; return &unicode_decompose_lookup[8115];
-    case 0x2F881: *len = 1; return &unicode_decompose_lookup[8116];
-    case 0x2F882: *len = 1; return &unicode_decompose_lookup[8117];
-    case 0x2F883: *len = 1; return &unicode_decompose_lookup[8118];
-    case 0x2F884: *len = 1; return &unicode_decompose_lookup[8119];
-    case 0x2F885: *len = 1; return &unicode_decompose_lookup[8120];
-    case 0x2F886: *len = 1; return &unicode_decompose_lookup[8121];
-    case 0x2F887: *len = 1; return &unicode_decompose_lookup[8122];
-    case 0x2F888: *len = 1; return &unicode_decompose_lookup[8123];
-    case 0x2F889: *len = 1; return &unicode_decompose_lookup[8124];
-    case 0x2F88A: *len = 1; return &unicode_decompose_lookup[8125];
-    case 0x2F88B: *len = 1; return &unicode_decompose_lookup[8126];
-    case 0x2F88C: *len = 1; return &unicode_decompose_lookup[8127];
-    case 0x2F88D: *len = 1; return &unicode_decompose_lookup[8128];
-    case 0x2F88E: *len = 1; return &unicode_decompose_lookup[8129];
-    case 0x2F88F: *len = 1; return &unicode_decompose_lookup[8130];
-    case 0x2F890: *len = 1; return &unicode_decompose_lookup[8131];
-    case 0x2F891: *len = 1; return &unicode_decompose_lookup[8132];
-    case 0x2F892: *len = 1; return &unicode_decompose_lookup[8133];
-    case 0x2F893: *len = 1; return &unicode_decompose_lookup[8134];
-    case 0x2F894: *len = 1; return &unicode_decompose_lookup[8135];
-    case 0x2F895: *len = 1; return &unicode_decompose_lookup[8136];
-    case 0x2F896: *len = 1; return &unicode_decompose_lookup[8137];
-    case 0x2F897: *len = 1; return &unicode_decompose_lookup[8138];
-    case 0x2F898: *len = 1; return &unicode_decompose_lookup[8139];
-    case 0x2F899: *len = 1; return &unicode_decompose_lookup[8140];
-    case 0x2F89A: *len = 1; return &unicode_decompose_lookup[8141];
-    case 0x2F89B: *len = 1; return &unicode_decompose_lookup[8142];
-    case 0x2F89C: *len = 1; return &unicode_decompose_lookup[8143];
-    case 0x2F89D: *len = 1; return &unicode_decompose_lookup[8144];
-    case 0x2F89E: *len = 1; return &unicode_decompose_lookup[8145];
-    case 0x2F89F: *len = 1; return &unicode_decompose_lookup[8146];
-    case 0x2F8A0: *len = 1; return &unicode_decompose_lookup[8147];
-    case 0x2F8A1: *len = 1; return &unicode_decompose_lookup[8148];
-    case 0x2F8A2: *len = 1; return &unicode_decompose_lookup[8149];
-    case 0x2F8A3: *len = 1; return &unicode_decompose_lookup[8150];
-    case 0x2F8A4: *len = 1; return &unicode_decompose_lookup[8151];
-    case 0x2F8A5: *len = 1; return &unicode_decompose_lookup[8152];
-    case 0x2F8A6: *len = 1; return &unicode_decompose_lookup[8153];
-    case 0x2F8A7: *len = 1; return &unicode_decompose_lookup[8154];
-    case 0x2F8A8: *len = 1; return &unicode_decompose_lookup[8155];
-    case 0x2F8A9: *len = 1; return &unicode_decompose_lookup[8156];
-    case 0x2F8AA: *len = 1; return &unicode_decompose_lookup[8157];
-    case 0x2F8AB: *len = 1; return &unicode_decompose_lookup[8158];
-    case 0x2F8AC: *len = 1; return &unicode_decompose_lookup[8159];
-    case 0x2F8AD: *len = 1; return &unicode_decompose_lookup[8160];
-    case 0x2F8AE: *len = 1; return &unicode_decompose_lookup[8161];
-    case 0x2F8AF: *len = 1; return &unicode_decompose_lookup[8162];
-    case 0x2F8B0: *len = 1; return &unicode_decompose_lookup[8163];
-    case 0x2F8B1: *len = 1; return &unicode_decompose_lookup[8164];
-    case 0x2F8B2: *len = 1; return &unicode_decompose_lookup[8165];
-    case 0x2F8B3: *len = 1; return &unicode_decompose_lookup[8166];
-    case 0x2F8B4: *len = 1; return &unicode_decompose_lookup[8167];
-    case 0x2F8B5: *len = 1; return &unicode_decompose_lookup[8168];
-    case 0x2F8B6: *len = 1; return &unicode_decompose_lookup[8169];
-    case 0x2F8B7: *len = 1; return &unicode_decompose_lookup[8170];
-    case 0x2F8B8: *len = 1; return &unicode_decompose_lookup[8171];
-    case 0x2F8B9: *len = 1; return &unicode_decompose_lookup[8172];
-    case 0x2F8BA: *len = 1; return &unicode_decompose_lookup[8173];
-    case 0x2F8BB: *len = 1; return &unicode_decompose_lookup[8174];
-    case 0x2F8BC: *len = 1; return &unicode_decompose_lookup[8175];
-    case 0x2F8BD: *len = 1; return &unicode_decompose_lookup[8176];
-    case 0x2F8BE: *len = 1; return &unicode_decompose_lookup[8177];
-    case 0x2F8BF: *len = 1; return &unicode_decompose_lookup[8178];
-    case 0x2F8C0: *len = 1; return &unicode_decompose_lookup[8179];
-    case 0x2F8C1: *len = 1; return &unicode_decompose_lookup[8180];
-    case 0x2F8C2: *len = 1; return &unicode_decompose_lookup[8181];
-    case 0x2F8C3: *len = 1; return &unicode_decompose_lookup[8182];
-    case 0x2F8C4: *len = 1; return &unicode_decompose_lookup[8183];
-    case 0x2F8C5: *len = 1; return &unicode_decompose_lookup[8184];
-    case 0x2F8C6: *len = 1; return &unicode_decompose_lookup[8185];
-    case 0x2F8C7: *len = 1; return &unicode_decompose_lookup[8186];
-    case 0x2F8C8: *len = 1; return &unicode_decompose_lookup[8187];
-    case 0x2F8C9: *len = 1; return &unicode_decompose_lookup[8188];
-    case 0x2F8CA: *len = 1; return &unicode_decompose_lookup[8189];
-    case 0x2F8CB: *len = 1; return &unicode_decompose_lookup[8190];
-    case 0x2F8CC: *len = 1; return &unicode_decompose_lookup[8191];
-    case 0x2F8CD: *len = 1; return &unicode_decompose_lookup[8192];
-    case 0x2F8CE: *len = 1; return &unicode_decompose_lookup[8193];
-    case 0x2F8CF: *len = 1; return &unicode_decompose_lookup[8194];
-    case 0x2F8D0: *len = 1; return &unicode_decompose_lookup[8195];
-    case 0x2F8D1: *len = 1; return &unicode_decompose_lookup[8196];
-    case 0x2F8D2: *len = 1; return &unicode_decompose_lookup[8197];
-    case 0x2F8D3: *len = 1; return &unicode_decompose_lookup[8198];
-    case 0x2F8D4: *len = 1; return &unicode_decompose_lookup[8199];
-    case 0x2F8D5: *len = 1; return &unicode_decompose_lookup[8200];
-    case 0x2F8D6: *len = 1; return &unicode_decompose_lookup[8201];
-    case 0x2F8D7: *len = 1; return &unicode_decompose_lookup[8202];
-    case 0x2F8D8: *len = 1; return &unicode_decompose_lookup[8203];
-    case 0x2F8D9: *len = 1; return &unicode_decompose_lookup[8204];
-    case 0x2F8DA: *len = 1; return &unicode_decompose_lookup[8205];
-    case 0x2F8DB: *len = 1; return &unicode_decompose_lookup[8206];
-    case 0x2F8DC: *len = 1; return &unicode_decompose_lookup[8207];
-    case 0x2F8DD: *len = 1; return &unicode_decompose_lookup[8208];
-    case 0x2F8DE: *len = 1; return &unicode_decompose_lookup[8209];
-    case 0x2F8DF: *len = 1; return &unicode_decompose_lookup[8210];
-    case 0x2F8E0: *len = 1; return &unicode_decompose_lookup[8211];
-    case 0x2F8E1: *len = 1; return &unicode_decompose_lookup[8212];
-    case 0x2F8E2: *len = 1; return &unicode_decompose_lookup[8213];
-    case 0x2F8E3: *len = 1; return &unicode_decompose_lookup[8214];
-    case 0x2F8E4: *len = 1; return &unicode_decompose_lookup[8215];
-    case 0x2F8E5: *len = 1; return &unicode_decompose_lookup[8216];
-    case 0x2F8E6: *len = 1; return &unicode_decompose_lookup[8217];
-    case 0x2F8E7: *len = 1; return &unicode_decompose_lookup[8218];
-    case 0x2F8E8: *len = 1; return &unicode_decompose_lookup[8219];
-    case 0x2F8E9: *len = 1; return &unicode_decompose_lookup[8220];
-    case 0x2F8EA: *len = 1; return &unicode_decompose_lookup[8221];
-    case 0x2F8EB: *len = 1; return &unicode_decompose_lookup[8222];
-    case 0x2F8EC: *len = 1; return &unicode_decompose_lookup[8223];
-    case 0x2F8ED: *len = 1; return &unicode_decompose_lookup[8224];
-    case 0x2F8EE: *len = 1; return &unicode_decompose_lookup[8225];
-    case 0x2F8EF: *len = 1; return &unicode_decompose_lookup[8226];
-    case 0x2F8F0: *len = 1; return &unicode_decompose_lookup[8227];
-    case 0x2F8F1: *len = 1; return &unicode_decompose_lookup[8228];
-    case 0x2F8F2: *len = 1; return &unicode_decompose_lookup[8229];
-    case 0x2F8F3: *len = 1; return &unicode_decompose_lookup[8230];
-    case 0x2F8F4: *len = 1; return &unicode_decompose_lookup[8231];
-    case 0x2F8F5: *len = 1; return &unicode_decompose_lookup[8232];
-    case 0x2F8F6: *len = 1; return &unicode_decompose_lookup[8233];
-    case 0x2F8F7: *len = 1; return &unicode_decompose_lookup[8234];
-    case 0x2F8F8: *len = 1; return &unicode_decompose_lookup[8235];
-    case 0x2F8F9: *len = 1; return &unicode_decompose_lookup[8236];
-    case 0x2F8FA: *len = 1; return &unicode_decompose_lookup[8237];
-    case 0x2F8FB: *len = 1; return &unicode_decompose_lookup[8238];
-    case 0x2F8FC: *len = 1; return &unicode_decompose_lookup[8239];
-    case 0x2F8FD: *len = 1; return &unicode_decompose_lookup[8240];
-    case 0x2F8FE: *len = 1; return &unicode_decompose_lookup[8241];
-    case 0x2F8FF: *len = 1; return &unicode_decompose_lookup[8242];
-    case 0x2F900: *len = 1; return &unicode_decompose_lookup[8243];
-    case 0x2F901: *len = 1; return &unicode_decompose_lookup[8244];
-    case 0x2F902: *len = 1; return &unicode_decompose_lookup[8245];
-    case 0x2F903: *len = 1; return &unicode_decompose_lookup[8246];
-    case 0x2F904: *len = 1; return &unicode_decompose_lookup[8247];
-    case 0x2F905: *len = 1; return &unicode_decompose_lookup[8248];
-    case 0x2F906: *len = 1; return &unicode_decompose_lookup[8249];
-    case 0x2F907: *len = 1; return &unicode_decompose_lookup[8250];
-    case 0x2F908: *len = 1; return &unicode_decompose_lookup[8251];
-    case 0x2F909: *len = 1; return &unicode_decompose_lookup[8252];
-    case 0x2F90A: *len = 1; return &unicode_decompose_lookup[8253];
-    case 0x2F90B: *len = 1; return &unicode_decompose_lookup[8254];
-    case 0x2F90C: *len = 1; return &unicode_decompose_lookup[8255];
-    case 0x2F90D: *len = 1; return &unicode_decompose_lookup[8256];
-    case 0x2F90E: *len = 1; return &unicode_decompose_lookup[8257];
-    case 0x2F90F: *len = 1; return &unicode_decompose_lookup[8258];
-    case 0x2F910: *len = 1; return &unicode_decompose_lookup[8259];
-    case 0x2F911: *len = 1; return &unicode_decompose_lookup[8260];
-    case 0x2F912: *len = 1; return &unicode_decompose_lookup[8261];
-    case 0x2F913: *len = 1; return &unicode_decompose_lookup[8262];
-    case 0x2F914: *len = 1; return &unicode_decompose_lookup[8263];
-    case 0x2F915: *len = 1; return &unicode_decompose_lookup[8264];
-    case 0x2F916: *len = 1; return &unicode_decompose_lookup[8265];
-    case 0x2F917: *len = 1; return &unicode_decompose_lookup[8266];
-    case 0x2F918: *len = 1; return &unicode_decompose_lookup[8267];
-    case 0x2F919: *len = 1; return &unicode_decompose_lookup[8268];
-    case 0x2F91A: *len = 1; return &unicode_decompose_lookup[8269];
-    case 0x2F91B: *len = 1; return &unicode_decompose_lookup[8270];
-    case 0x2F91C: *len = 1; return &unicode_decompose_lookup[8271];
-    case 0x2F91D: *len = 1; return &unicode_decompose_lookup[8272];
-    case 0x2F91E: *len = 1; return &unicode_decompose_lookup[8273];
-    case 0x2F91F: *len = 1; return &unicode_decompose_lookup[8274];
-    case 0x2F920: *len = 1; return &unicode_decompose_lookup[8275];
-    case 0x2F921: *len = 1; return &unicode_decompose_lookup[8276];
-    case 0x2F922: *len = 1; return &unicode_decompose_lookup[8277];
-    case 0x2F923: *len = 1; return &unicode_decompose_lookup[8278];
-    case 0x2F924: *len = 1; return &unicode_decompose_lookup[8279];
-    case 0x2F925: *len = 1; return &unicode_decompose_lookup[8280];
-    case 0x2F926: *len = 1; return &unicode_decompose_lookup[8281];
-    case 0x2F927: *len = 1; return &unicode_decompose_lookup[8282];
-    case 0x2F928: *len = 1; return &unicode_decompose_lookup[8283];
-    case 0x2F929: *len = 1; return &unicode_decompose_lookup[8284];
-    case 0x2F92A: *len = 1; return &unicode_decompose_lookup[8285];
-    case 0x2F92B: *len = 1; return &unicode_decompose_lookup[8286];
-    case 0x2F92C: *len = 1; return &unicode_decompose_lookup[8287];
-    case 0x2F92D: *len = 1; return &unicode_decompose_lookup[8288];
-    case 0x2F92E: *len = 1; return &unicode_decompose_lookup[8289];
-    case 0x2F92F: *len = 1; return &unicode_decompose_lookup[8290];
-    case 0x2F930: *len = 1; return &unicode_decompose_lookup[8291];
-    case 0x2F931: *len = 1; return &unicode_decompose_lookup[8292];
-    case 0x2F932: *len = 1; return &unicode_decompose_lookup[8293];
-    case 0x2F933: *len = 1; return &unicode_decompose_lookup[8294];
-    case 0x2F934: *len = 1; return &unicode_decompose_lookup[8295];
-    case 0x2F935: *len = 1; return &unicode_decompose_lookup[8296];
-    case 0x2F936: *len = 1; return &unicode_decompose_lookup[8297];
-    case 0x2F937: *len = 1; return &unicode_decompose_lookup[8298];
-    case 0x2F938: *len = 1; return &unicode_decompose_lookup[8299];
-    case 0x2F939: *len = 1; return &unicode_decompose_lookup[8300];
-    case 0x2F93A: *len = 1; return &unicode_decompose_lookup[8301];
-    case 0x2F93B: *len = 1; return &unicode_decompose_lookup[8302];
-    case 0x2F93C: *len = 1; return &unicode_decompose_lookup[8303];
-    case 0x2F93D: *len = 1; return &unicode_decompose_lookup[8304];
-    case 0x2F93E: *len = 1; return &unicode_decompose_lookup[8305];
-    case 0x2F93F: *len = 1; return &unicode_decompose_lookup[8306];
-    case 0x2F940: *len = 1; return &unicode_decompose_lookup[8307];
-    case 0x2F941: *len = 1; return &unicode_decompose_lookup[8308];
-    case 0x2F942: *len = 1; return &unicode_decompose_lookup[8309];
-    case 0x2F943: *len = 1; return &unicode_decompose_lookup[8310];
-    case 0x2F944: *len = 1; return &unicode_decompose_lookup[8311];
-    case 0x2F945: *len = 1; return &unicode_decompose_lookup[8312];
-    case 0x2F946: *len = 1; return &unicode_decompose_lookup[8313];
-    case 0x2F947: *len = 1; return &unicode_decompose_lookup[8314];
-    case 0x2F948: *len = 1; return &unicode_decompose_lookup[8315];
-    case 0x2F949: *len = 1; return &unicode_decompose_lookup[8316];
-    case 0x2F94A: *len = 1; return &unicode_decompose_lookup[8317];
-    case 0x2F94B: *len = 1; return &unicode_decompose_lookup[8318];
-    case 0x2F94C: *len = 1; return &unicode_decompose_lookup[8319];
-    case 0x2F94D: *len = 1; return &unicode_decompose_lookup[8320];
-    case 0x2F94E: *len = 1; return &unicode_decompose_lookup[8321];
-    case 0x2F94F: *len = 1; return &unicode_decompose_lookup[8322];
-    case 0x2F950: *len = 1; return &unicode_decompose_lookup[8323];
-    case 0x2F951: *len = 1; return &unicode_decompose_lookup[8324];
-    case 0x2F952: *len = 1; return &unicode_decompose_lookup[8325];
-    case 0x2F953: *len = 1; return &unicode_decompose_lookup[8326];
-    case 0x2F954: *len = 1; return &unicode_decompose_lookup[8327];
-    case 0x2F955: *len = 1; return &unicode_decompose_lookup[8328];
-    case 0x2F956: *len = 1; return &unicode_decompose_lookup[8329];
-    case 0x2F957: *len = 1; return &unicode_decompose_lookup[8330];
-    case 0x2F958: *len = 1; return &unicode_decompose_lookup[8331];
-    case 0x2F959: *len = 1; return &unicode_decompose_lookup[8332];
-    case 0x2F95A: *len = 1; return &unicode_decompose_lookup[8333];
-    case 0x2F95B: *len = 1; return &unicode_decompose_lookup[8334];
-    case 0x2F95C: *len = 1; return &unicode_decompose_lookup[8335];
-    case 0x2F95D: *len = 1; return &unicode_decompose_lookup[8336];
-    case 0x2F95E: *len = 1; return &unicode_decompose_lookup[8337];
-    case 0x2F95F: *len = 1; return &unicode_decompose_lookup[8338];
-    case 0x2F960: *len = 1; return &unicode_decompose_lookup[8339];
-    case 0x2F961: *len = 1; return &unicode_decompose_lookup[8340];
-    case 0x2F962: *len = 1; return &unicode_decompose_lookup[8341];
-    case 0x2F963: *len = 1; return &unicode_decompose_lookup[8342];
-    case 0x2F964: *len = 1; return &unicode_decompose_lookup[8343];
-    case 0x2F965: *len = 1; return &unicode_decompose_lookup[8344];
-    case 0x2F966: *len = 1; return &unicode_decompose_lookup[8345];
-    case 0x2F967: *len = 1; return &unicode_decompose_lookup[8346];
-    case 0x2F968: *len = 1; return &unicode_decompose_lookup[8347];
-    case 0x2F969: *len = 1; return &unicode_decompose_lookup[8348];
-    case 0x2F96A: *len = 1; return &unicode_decompose_lookup[8349];
-    case 0x2F96B: *len = 1; return &unicode_decompose_lookup[8350];
-    case 0x2F96C: *len = 1; return &unicode_decompose_lookup[8351];
-    case 0x2F96D: *len = 1; return &unicode_decompose_lookup[8352];
-    case 0x2F96E: *len = 1; return &unicode_decompose_lookup[8353];
-    case 0x2F96F: *len = 1; return &unicode_decompose_lookup[8354];
-    case 0x2F970: *len = 1; return &unicode_decompose_lookup[8355];
-    case 0x2F971: *len = 1; return &unicode_decompose_lookup[8356];
-    case 0x2F972: *len = 1; return &unicode_decompose_lookup[8357];
-    case 0x2F973: *len = 1; return &unicode_decompose_lookup[8358];
-    case 0x2F974: *len = 1; return &unicode_decompose_lookup[8359];
-    case 0x2F975: *len = 1; return &unicode_decompose_lookup[8360];
-    case 0x2F976: *len = 1; return &unicode_decompose_lookup[8361];
-    case 0x2F977: *len = 1; return &unicode_decompose_lookup[8362];
-    case 0x2F978: *len = 1; return &unicode_decompose_lookup[8363];
-    case 0x2F979: *len = 1; return &unicode_decompose_lookup[8364];
-    case 0x2F97A: *len = 1; return &unicode_decompose_lookup[8365];
-    case 0x2F97B: *len = 1; return &unicode_decompose_lookup[8366];
-    case 0x2F97C: *len = 1; return &unicode_decompose_lookup[8367];
-    case 0x2F97D: *len = 1; return &unicode_decompose_lookup[8368];
-    case 0x2F97E: *len = 1; return &unicode_decompose_lookup[8369];
-    case 0x2F97F: *len = 1; return &unicode_decompose_lookup[8370];
-    case 0x2F980: *len = 1; return &unicode_decompose_lookup[8371];
-    case 0x2F981: *len = 1; return &unicode_decompose_lookup[8372];
-    case 0x2F982: *len = 1; return &unicode_decompose_lookup[8373];
-    case 0x2F983: *len = 1; return &unicode_decompose_lookup[8374];
-    case 0x2F984: *len = 1; return &unicode_decompose_lookup[8375];
-    case 0x2F985: *len = 1; return &unicode_decompose_lookup[8376];
-    case 0x2F986: *len = 1; return &unicode_decompose_lookup[8377];
-    case 0x2F987: *len = 1; return &unicode_decompose_lookup[8378];
-    case 0x2F988: *len = 1; return &unicode_decompose_lookup[8379];
-    case 0x2F989: *len = 1; return &unicode_decompose_lookup[8380];
-    case 0x2F98A: *len = 1; return &unicode_decompose_lookup[8381];
-    case 0x2F98B: *len = 1; return &unicode_decompose_lookup[8382];
-    case 0x2F98C: *len = 1; return &unicode_decompose_lookup[8383];
-    case 0x2F98D: *len = 1; return &unicode_decompose_lookup[8384];
-    case 0x2F98E: *len = 1; return &unicode_decompose_lookup[8385];
-    case 0x2F98F: *len = 1; return &unicode_decompose_lookup[8386];
-    case 0x2F990: *len = 1; return &unicode_decompose_lookup[8387];
-    case 0x2F991: *len = 1; return &unicode_decompose_lookup[8388];
-    case 0x2F992: *len = 1; return &unicode_decompose_lookup[8389];
-    case 0x2F993: *len = 1; return &unicode_decompose_lookup[8390];
-    case 0x2F994: *len = 1; return &unicode_decompose_lookup[8391];
-    case 0x2F995: *len = 1; return &unicode_decompose_lookup[8392];
-    case 0x2F996: *len = 1; return &unicode_decompose_lookup[8393];
-    case 0x2F997: *len = 1; return &unicode_decompose_lookup[8394];
-    case 0x2F998: *len = 1; return &unicode_decompose_lookup[8395];
-    case 0x2F999: *len = 1; return &unicode_decompose_lookup[8396];
-    case 0x2F99A: *len = 1; return &unicode_decompose_lookup[8397];
-    case 0x2F99B: *len = 1; return &unicode_decompose_lookup[8398];
-    case 0x2F99C: *len = 1; return &unicode_decompose_lookup[8399];
-    case 0x2F99D: *len = 1; return &unicode_decompose_lookup[8400];
-    case 0x2F99E: *len = 1; return &unicode_decompose_lookup[8401];
-    case 0x2F99F: *len = 1; return &unicode_decompose_lookup[8402];
-    case 0x2F9A0: *len = 1; return &unicode_decompose_lookup[8403];
-    case 0x2F9A1: *len = 1; return &unicode_decompose_lookup[8404];
-    case 0x2F9A2: *len = 1; return &unicode_decompose_lookup[8405];
-    case 0x2F9A3: *len = 1; return &unicode_decompose_lookup[8406];
-    case 0x2F9A4: *len = 1; return &unicode_decompose_lookup[8407];
-    case 0x2F9A5: *len = 1; return &unicode_decompose_lookup[8408];
-    case 0x2F9A6: *len = 1; return &unicode_decompose_lookup[8409];
-    case 0x2F9A7: *len = 1; return &unicode_decompose_lookup[8410];
-    case 0x2F9A8: *len = 1; return &unicode_decompose_lookup[8411];
-    case 0x2F9A9: *len = 1; return &unicode_decompose_lookup[8412];
-    case 0x2F9AA: *len = 1; return &unicode_decompose_lookup[8413];
-    case 0x2F9AB: *len = 1; return &unicode_decompose_lookup[8414];
-    case 0x2F9AC: *len = 1; return &unicode_decompose_lookup[8415];
-    case 0x2F9AD: *len = 1; return &unicode_decompose_lookup[8416];
-    case 0x2F9AE: *len = 1; return &unicode_decompose_lookup[8417];
-    case 0x2F9AF: *len = 1; return &unicode_decompose_lookup[8418];
-    case 0x2F9B0: *len = 1; return &unicode_decompose_lookup[8419];
-    case 0x2F9B1: *len = 1; return &unicode_decompose_lookup[8420];
-    case 0x2F9B2: *len = 1; return &unicode_decompose_lookup[8421];
-    case 0x2F9B3: *len = 1; return &unicode_decompose_lookup[8422];
-    case 0x2F9B4: *len = 1; return &unicode_decompose_lookup[8423];
-    case 0x2F9B5: *len = 1; return &unicode_decompose_lookup[8424];
-    case 0x2F9B6: *len = 1; return &unicode_decompose_lookup[8425];
-    case 0x2F9B7: *len = 1; return &unicode_decompose_lookup[8426];
-    case 0x2F9B8: *len = 1; return &unicode_decompose_lookup[8427];
-    case 0x2F9B9: *len = 1; return &unicode_decompose_lookup[8428];
-    case 0x2F9BA: *len = 1; return &unicode_decompose_lookup[8429];
-    case 0x2F9BB: *len = 1; return &unicode_decompose_lookup[8430];
-    case 0x2F9BC: *len = 1; return &unicode_decompose_lookup[8431];
-    case 0x2F9BD: *len = 1; return &unicode_decompose_lookup[8432];
-    case 0x2F9BE: *len = 1; return &unicode_decompose_lookup[8433];
-    case 0x2F9BF: *len = 1; return &unicode_decompose_lookup[8434];
-    case 0x2F9C0: *len = 1; return &unicode_decompose_lookup[8435];
-    case 0x2F9C1: *len = 1; return &unicode_decompose_lookup[8436];
-    case 0x2F9C2: *len = 1; return &unicode_decompose_lookup[8437];
-    case 0x2F9C3: *len = 1; return &unicode_decompose_lookup[8438];
-    case 0x2F9C4: *len = 1; return &unicode_decompose_lookup[8439];
-    case 0x2F9C5: *len = 1; return &unicode_decompose_lookup[8440];
-    case 0x2F9C6: *len = 1; return &unicode_decompose_lookup[8441];
-    case 0x2F9C7: *len = 1; return &unicode_decompose_lookup[8442];
-    case 0x2F9C8: *len = 1; return &unicode_decompose_lookup[8443];
-    case 0x2F9C9: *len = 1; return &unicode_decompose_lookup[8444];
-    case 0x2F9CA: *len = 1; return &unicode_decompose_lookup[8445];
-    case 0x2F9CB: *len = 1; return &unicode_decompose_lookup[8446];
-    case 0x2F9CC: *len = 1; return &unicode_decompose_lookup[8447];
-    case 0x2F9CD: *len = 1; return &unicode_decompose_lookup[8448];
-    case 0x2F9CE: *len = 1; return &unicode_decompose_lookup[8449];
-    case 0x2F9CF: *len = 1; return &unicode_decompose_lookup[8450];
-    case 0x2F9D0: *len = 1; return &unicode_decompose_lookup[8451];
-    case 0x2F9D1: *len = 1; return &unicode_decompose_lookup[8452];
-    case 0x2F9D2: *len = 1; return &unicode_decompose_lookup[8453];
-    case 0x2F9D3: *len = 1; return &unicode_decompose_lookup[8454];
-    case 0x2F9D4: *len = 1; return &unicode_decompose_lookup[8455];
-    case 0x2F9D5: *len = 1; return &unicode_decompose_lookup[8456];
-    case 0x2F9D6: *len = 1; return &unicode_decompose_lookup[8457];
-    case 0x2F9D7: *len = 1; return &unicode_decompose_lookup[8458];
-    case 0x2F9D8: *len = 1; return &unicode_decompose_lookup[8459];
-    case 0x2F9D9: *len = 1; return &unicode_decompose_lookup[8460];
-    case 0x2F9DA: *len = 1; return &unicode_decompose_lookup[8461];
-    case 0x2F9DB: *len = 1; return &unicode_decompose_lookup[8462];
-    case 0x2F9DC: *len = 1; return &unicode_decompose_lookup[8463];
-    case 0x2F9DD: *len = 1; return &unicode_decompose_lookup[8464];
-    case 0x2F9DE: *len = 1; return &unicode_decompose_lookup[8465];
-    case 0x2F9DF: *len = 1; return &unicode_decompose_lookup[8466];
-    case 0x2F9E0: *len = 1; return &unicode_decompose_lookup[8467];
-    case 0x2F9E1: *len = 1; return &unicode_decompose_lookup[8468];
-    case 0x2F9E2: *len = 1; return &unicode_decompose_lookup[8469];
-    case 0x2F9E3: *len = 1; return &unicode_decompose_lookup[8470];
-    case 0x2F9E4: *len = 1; return &unicode_decompose_lookup[8471];
-    case 0x2F9E5: *len = 1; return &unicode_decompose_lookup[8472];
-    case 0x2F9E6: *len = 1; return &unicode_decompose_lookup[8473];
-    case 0x2F9E7: *len = 1; return &unicode_decompose_lookup[8474];
-    case 0x2F9E8: *len = 1; return &unicode_decompose_lookup[8475];
-    case 0x2F9E9: *len = 1; return &unicode_decompose_lookup[8476];
-    case 0x2F9EA: *len = 1; return &unicode_decompose_lookup[8477];
-    case 0x2F9EB: *len = 1; return &unicode_decompose_lookup[8478];
-    case 0x2F9EC: *len = 1; return &unicode_decompose_lookup[8479];
-    case 0x2F9ED: *len = 1; return &unicode_decompose_lookup[8480];
-    case 0x2F9EE: *len = 1; return &unicode_decompose_lookup[8481];
-    case 0x2F9EF: *len = 1; return &unicode_decompose_lookup[8482];
-    case 0x2F9F0: *len = 1; return &unicode_decompose_lookup[8483];
-    case 0x2F9F1: *len = 1; return &unicode_decompose_lookup[8484];
-    case 0x2F9F2: *len = 1; return &unicode_decompose_lookup[8485];
-    case 0x2F9F3: *len = 1; return &unicode_decompose_lookup[8486];
-    case 0x2F9F4: *len = 1; return &unicode_decompose_lookup[8487];
-    case 0x2F9F5: *len = 1; return &unicode_decompose_lookup[8488];
-    case 0x2F9F6: *len = 1; return &unicode_decompose_lookup[8489];
-    case 0x2F9F7: *len = 1; return &unicode_decompose_lookup[8490];
-    case 0x2F9F8: *len = 1; return &unicode_decompose_lookup[8491];
-    case 0x2F9F9: *len = 1; return &unicode_decompose_lookup[8492];
-    case 0x2F9FA: *len = 1; return &unicode_decompose_lookup[8493];
-    case 0x2F9FB: *len = 1; return &unicode_decompose_lookup[8494];
-    case 0x2F9FC: *len = 1; return &unicode_decompose_lookup[8495];
-    case 0x2F9FD: *len = 1; return &unicode_decompose_lookup[8496];
-    case 0x2F9FE: *len = 1; return &unicode_decompose_lookup[8497];
-    case 0x2F9FF: *len = 1; return &unicode_decompose_lookup[8498];
-    case 0x2FA00: *len = 1; return &unicode_decompose_lookup[8499];
-    case 0x2FA01: *len = 1; return &unicode_decompose_lookup[8500];
-    case 0x2FA02: *len = 1; return &unicode_decompose_lookup[8501];
-    case 0x2FA03: *len = 1; return &unicode_decompose_lookup[8502];
-    case 0x2FA04: *len = 1; return &unicode_decompose_lookup[8503];
-    case 0x2FA05: *len = 1; return &unicode_decompose_lookup[8504];
-    case 0x2FA06: *len = 1; return &unicode_decompose_lookup[8505];
-    case 0x2FA07: *len = 1; return &unicode_decompose_lookup[8506];
-    case 0x2FA08: *len = 1; return &unicode_decompose_lookup[8507];
-    case 0x2FA09: *len = 1; return &unicode_decompose_lookup[8508];
-    case 0x2FA0A: *len = 1; return &unicode_decompose_lookup[8509];
-    case 0x2FA0B: *len = 1; return &unicode_decompose_lookup[8510];
-    case 0x2FA0C: *len = 1; return &unicode_decompose_lookup[8511];
-    case 0x2FA0D: *len = 1; return &unicode_decompose_lookup[8512];
-    case 0x2FA0E: *len = 1; return &unicode_decompose_lookup[8513];
-    case 0x2FA0F: *len = 1; return &unicode_decompose_lookup[8514];
-    case 0x2FA10: *len = 1; return &unicode_decompose_lookup[8515];
-    case 0x2FA11: *len = 1; return &unicode_decompose_lookup[8516];
-    case 0x2FA12: *len = 1; return &unicode_decompose_lookup[8517];
-    case 0x2FA13: *len = 1; return &unicode_decompose_lookup[8518];
-    case 0x2FA14: *len = 1; return &unicode_decompose_lookup[8519];
-    case 0x2FA15: *len = 1; return &unicode_decompose_lookup[8520];
-    case 0x2FA16: *len = 1; return &unicode_decompose_lookup[8521];
-    case 0x2FA17: *len = 1; return &unicode_decompose_lookup[8522];
-    case 0x2FA18: *len = 1; return &unicode_decompose_lookup[8523];
-    case 0x2FA19: *len = 1; return &unicode_decompose_lookup[8524];
-    case 0x2FA1A: *len = 1; return &unicode_decompose_lookup[8525];
-    case 0x2FA1B: *len = 1; return &unicode_decompose_lookup[8526];
-    case 0x2FA1C: *len = 1; return &unicode_decompose_lookup[8527];
-    case 0x2FA1D: *len = 1; return &unicode_decompose_lookup[8528];
+  uint32_t packed = 0;
+  if (codePoint <= 0x10ffff) {
+    uint32_t block = decomposition_block_numbers[codePoint >> DECOMPOSITION_BLOCK_SHIFT];
+    packed = decomposition_block_values[(block << DECOMPOSITION_BLOCK_SHIFT) | (codePoint & DECOMPOSITION_BLOCK_MASK)];
   }
-
-  if (compatible) switch(codePoint) {
-    case 0x00A0: *len = 1; return &unicode_decompose_lookup[0];
-    case 0x00A8: *len = 2; return &unicode_decompose_lookup[1];
-    case 0x00AA: *len = 1; return &unicode_decompose_lookup[3];
-    case 0x00AF: *len = 2; return &unicode_decompose_lookup[4];
-    case 0x00B2: *len = 1; return &unicode_decompose_lookup[6];
-    case 0x00B3: *len = 1; return &unicode_decompose_lookup[7];
-    case 0x00B4: *len = 2; return &unicode_decompose_lookup[8];
-    case 0x00B5: *len = 1; return &unicode_decompose_lookup[10];
-    case 0x00B8: *len = 2; return &unicode_decompose_lookup[11];
-    case 0x00B9: *len = 1; return &unicode_decompose_lookup[13];
-    case 0x00BA: *len = 1; return &unicode_decompose_lookup[14];
-    case 0x00BC: *len = 3; return &unicode_decompose_lookup[15];
-    case 0x00BD: *len = 3; return &unicode_decompose_lookup[18];
-    case 0x00BE: *len = 3; return &unicode_decompose_lookup[21];
-    case 0x0132: *len = 2; return &unicode_decompose_lookup[220];
-    case 0x0133: *len = 2; return &unicode_decompose_lookup[222];
-    case 0x013F: *len = 2; return &unicode_decompose_lookup[244];
-    case 0x0140: *len = 2; return &unicode_decompose_lookup[246];
-    case 0x0149: *len = 2; return &unicode_decompose_lookup[260];
-    case 0x017F: *len = 1; return &unicode_decompose_lookup[356];
-    case 0x01C4: *len = 2; return &unicode_decompose_lookup[365];
-    case 0x01C5: *len = 2; return &unicode_decompose_lookup[367];
-    case 0x01C6: *len = 2; return &unicode_decompose_lookup[369];
-    case 0x01C7: *len = 2; return &unicode_decompose_lookup[371];
-    case 0x01C8: *len = 2; return &unicode_decompose_lookup[373];
-    case 0x01C9: *len = 2; return &unicode_decompose_lookup[375];
-    case 0x01CA: *len = 2; return &unicode_decompose_lookup[377];
-    case 0x01CB: *len = 2; return &unicode_decompose_lookup[379];
-    case 0x01CC: *len = 2; return &unicode_decompose_lookup[381];
-    case 0x01F1: *len = 2; return &unicode_decompose_lookup[449];
-    case 0x01F2: *len = 2; return &unicode_decompose_lookup[451];
-    case 0x01F3: *len = 2; return &unicode_decompose_lookup[453];
-    case 0x02B0: *len = 1; return &unicode_decompose_lookup[563];
-    case 0x02B1: *len = 1; return &unicode_decompose_lookup[564];
-    case 0x02B2: *len = 1; return &unicode_decompose_lookup[565];
-    case 0x02B3: *len = 1; return &unicode_decompose_lookup[566];
-    case 0x02B4: *len = 1; return &unicode_decompose_lookup[567];
-    case 0x02B5: *len = 1; return &unicode_decompose_lookup[568];
-    case 0x02B6: *len = 1; return &unicode_decompose_lookup[569];
-    case 0x02B7: *len = 1; return &unicode_decompose_lookup[570];
-    case 0x02B8: *len = 1; return &unicode_decompose_lookup[571];
-    case 0x02D8: *len = 2; return &unicode_decompose_lookup[572];
-    case 0x02D9: *len = 2; return &unicode_decompose_lookup[574];
-    case 0x02DA: *len = 2; return &unicode_decompose_lookup[576];
-    case 0x02DB: *len = 2; return &unicode_decompose_lookup[578];
-    case 0x02DC: *len = 2; return &unicode_decompose_lookup[580];
-    case 0x02DD: *len = 2; return &unicode_decompose_lookup[582];
-    case 0x02E0: *len = 1; return &unicode_decompose_lookup[584];
-    case 0x02E1: *len = 1; return &unicode_decompose_lookup[585];
-    case 0x02E2: *len = 1; return &unicode_decompose_lookup[586];
-    case 0x02E3: *len = 1; return &unicode_decompose_lookup[587];
-    case 0x02E4: *len = 1; return &unicode_decompose_lookup[588];
-    case 0x037A: *len = 2; return &unicode_decompose_lookup[595];
-    case 0x0384: *len = 2; return &unicode_decompose_lookup[598];
-    case 0x03D0: *len = 1; return &unicode_decompose_lookup[643];
-    case 0x03D1: *len = 1; return &unicode_decompose_lookup[644];
-    case 0x03D2: *len = 1; return &unicode_decompose_lookup[645];
-    case 0x03D5: *len = 1; return &unicode_decompose_lookup[650];
-    case 0x03D6: *len = 1; return &unicode_decompose_lookup[651];
-    case 0x03F0: *len = 1; return &unicode_decompose_lookup[652];
-    case 0x03F1: *len = 1; return &unicode_decompose_lookup[653];
-    case 0x03F2: *len = 1; return &unicode_decompose_lookup[654];
-    case 0x03F4: *len = 1; return &unicode_decompose_lookup[655];
-    case 0x03F5: *len = 1; return &unicode_decompose_lookup[656];
-    case 0x03F9: *len = 1; return &unicode_decompose_lookup[657];
-    case 0x0587: *len = 2; return &unicode_decompose_lookup[762];
-    case 0x0675: *len = 2; return &unicode_decompose_lookup[774];
-    case 0x0676: *len = 2; return &unicode_decompose_lookup[776];
-    case 0x0677: *len = 2; return &unicode_decompose_lookup[778];
-    case 0x0678: *len = 2; return &unicode_decompose_lookup[780];
-    case 0x0E33: *len = 2; return &unicode_decompose_lookup[876];
-    case 0x0EB3: *len = 2; return &unicode_decompose_lookup[878];
-    case 0x0EDC: *len = 2; return &unicode_decompose_lookup[880];
-    case 0x0EDD: *len = 2; return &unicode_decompose_lookup[882];
-    case 0x0F0C: *len = 1; return &unicode_decompose_lookup[884];
-    case 0x0F77: *len = 2; return &unicode_decompose_lookup[903];
-    case 0x0F79: *len = 2; return &unicode_decompose_lookup[907];
-    case 0x10FC: *len = 1; return &unicode_decompose_lookup[925];
-    case 0x1D2C: *len = 1; return &unicode_decompose_lookup[948];
-    case 0x1D2D: *len = 1; return &unicode_decompose_lookup[949];
-    case 0x1D2E: *len = 1; return &unicode_decompose_lookup[950];
-    case 0x1D30: *len = 1; return &unicode_decompose_lookup[951];
-    case 0x1D31: *len = 1; return &unicode_decompose_lookup[952];
-    case 0x1D32: *len = 1; return &unicode_decompose_lookup[953];
-    case 0x1D33: *len = 1; return &unicode_decompose_lookup[954];
-    case 0x1D34: *len = 1; return &unicode_decompose_lookup[955];
-    case 0x1D35: *len = 1; return &unicode_decompose_lookup[956];
-    case 0x1D36: *len = 1; return &unicode_decompose_lookup[957];
-    case 0x1D37: *len = 1; return &unicode_decompose_lookup[958];
-    case 0x1D38: *len = 1; return &unicode_decompose_lookup[959];
-    case 0x1D39: *len = 1; return &unicode_decompose_lookup[960];
-    case 0x1D3A: *len = 1; return &unicode_decompose_lookup[961];
-    case 0x1D3C: *len = 1; return &unicode_decompose_lookup[962];
-    case 0x1D3D: *len = 1; return &unicode_decompose_lookup[963];
-    case 0x1D3E: *len = 1; return &unicode_decompose_lookup[964];
-    case 0x1D3F: *len = 1; return &unicode_decompose_lookup[965];
-    case 0x1D40: *len = 1; return &unicode_decompose_lookup[966];
-    case 0x1D41: *len = 1; return &unicode_decompose_lookup[967];
-    case 0x1D42: *len = 1; return &unicode_decompose_lookup[968];
-    case 0x1D43: *len = 1; return &unicode_decompose_lookup[969];
-    case 0x1D44: *len = 1; return &unicode_decompose_lookup[970];
-    case 0x1D45: *len = 1; return &unicode_decompose_lookup[971];
-    case 0x1D46: *len = 1; return &unicode_decompose_lookup[972];
-    case 0x1D47: *len = 1; return &unicode_decompose_lookup[973];
-    case 0x1D48: *len = 1; return &unicode_decompose_lookup[974];
-    case 0x1D49: *len = 1; return &unicode_decompose_lookup[975];
-    case 0x1D4A: *len = 1; return &unicode_decompose_lookup[976];
-    case 0x1D4B: *len = 1; return &unicode_decompose_lookup[977];
-    case 0x1D4C: *len = 1; return &unicode_decompose_lookup[978];
-    case 0x1D4D: *len = 1; return &unicode_decompose_lookup[979];
-    case 0x1D4F: *len = 1; return &unicode_decompose_lookup[980];
-    case 0x1D50: *len = 1; return &unicode_decompose_lookup[981];
-    case 0x1D51: *len = 1; return &unicode_decompose_lookup[982];
-    case 0x1D52: *len = 1; return &unicode_decompose_lookup[983];
-    case 0x1D53: *len = 1; return &unicode_decompose_lookup[984];
-    case 0x1D54: *len = 1; return &unicode_decompose_lookup[985];
-    case 0x1D55: *len = 1; return &unicode_decompose_lookup[986];
-    case 0x1D56: *len = 1; return &unicode_decompose_lookup[987];
-    case 0x1D57: *len = 1; return &unicode_decompose_lookup[988];
-    case 0x1D58: *len = 1; return &unicode_decompose_lookup[989];
-    case 0x1D59: *len = 1; return &unicode_decompose_lookup[990];
-    case 0x1D5A: *len = 1; return &unicode_decompose_lookup[991];
-    case 0x1D5B: *len = 1; return &unicode_decompose_lookup[992];
-    case 0x1D5C: *len = 1; return &unicode_decompose_lookup[993];
-    case 0x1D5D: *len = 1; return &unicode_decompose_lookup[994];
-    case 0x1D5E: *len = 1; return &unicode_decompose_lookup[995];
-    case 0x1D5F: *len = 1; return &unicode_decompose_lookup[996];
-    case 0x1D60: *len = 1; return &unicode_decompose_lookup[997];
-    case 0x1D61: *len = 1; return &unicode_decompose_lookup[998];
-    case 0x1D62: *len = 1; return &unicode_decompose_lookup[999];
-    case 0x1D63: *len = 1; return &unicode_decompose_lookup[1000];
-    case 0x1D64: *len = 1; return &unicode_decompose_lookup[1001];
-    case 0x1D65: *len = 1; return &unicode_decompose_lookup[1002];
-    case 0x1D66: *len = 1; return &unicode_decompose_lookup[1003];
-    case 0x1D67: *len = 1; return &unicode_decompose_lookup[1004];
-    case 0x1D68: *len = 1; return &unicode_decompose_lookup[1005];
-    case 0x1D69: *len = 1; return &unicode_decompose_lookup[1006];
-    case 0x1D6A: *len = 1; return &unicode_decompose_lookup[1007];
-    case 0x1D78: *len = 1; return &unicode_decompose_lookup[1008];
-    case 0x1D9B: *len = 1; return &unicode_decompose_lookup[1009];
-    case 0x1D9C: *len = 1; return &unicode_decompose_lookup[1010];
-    case 0x1D9D: *len = 1; return &unicode_decompose_lookup[1011];
-    case 0x1D9E: *len = 1; return &unicode_decompose_lookup[1012];
-    case 0x1D9F: *len = 1; return &unicode_decompose_lookup[1013];
-    case 0x1DA0: *len = 1; return &unicode_decompose_lookup[1014];
-    case 0x1DA1: *len = 1; return &unicode_decompose_lookup[1015];
-    case 0x1DA2: *len = 1; return &unicode_decompose_lookup[1016];
-    case 0x1DA3: *len = 1; return &unicode_decompose_lookup[1017];
-    case 0x1DA4: *len = 1; return &unicode_decompose_lookup[1018];
-    case 0x1DA5: *len = 1; return &unicode_decompose_lookup[1019];
-    case 0x1DA6: *len = 1; return &unicode_decompose_lookup[1020];
-    case 0x1DA7: *len = 1; return &unicode_decompose_lookup[1021];
-    case 0x1DA8: *len = 1; return &unicode_decompose_lookup[1022];
-    case 0x1DA9: *len = 1; return &unicode_decompose_lookup[1023];
-    case 0x1DAA: *len = 1; return &unicode_decompose_lookup[1024];
-    case 0x1DAB: *len = 1; return &unicode_decompose_lookup[1025];
-    case 0x1DAC: *len = 1; return &unicode_decompose_lookup[1026];
-    case 0x1DAD: *len = 1; return &unicode_decompose_lookup[1027];
-    case 0x1DAE: *len = 1; return &unicode_decompose_lookup[1028];
-    case 0x1DAF: *len = 1; return &unicode_decompose_lookup[1029];
-    case 0x1DB0: *len = 1; return &unicode_decompose_lookup[1030];
-    case 0x1DB1: *len = 1; return &unicode_decompose_lookup[1031];
-    case 0x1DB2: *len = 1; return &unicode_decompose_lookup[1032];
-    case 0x1DB3: *len = 1; return &unicode_decompose_lookup[1033];
-    case 0x1DB4: *len = 1; return &unicode_decompose_lookup[1034];
-    case 0x1DB5: *len = 1; return &unicode_decompose_lookup[1035];
-    case 0x1DB6: *len = 1; return &unicode_decompose_lookup[1036];
-    case 0x1DB7: *len = 1; return &unicode_decompose_lookup[1037];
-    case 0x1DB8: *len = 1; return &unicode_decompose_lookup[1038];
-    case 0x1DB9: *len = 1; return &unicode_decompose_lookup[1039];
-    case 0x1DBA: *len = 1; return &unicode_decompose_lookup[1040];
-    case 0x1DBB: *len = 1; return &unicode_decompose_lookup[1041];
-    case 0x1DBC: *len = 1; return &unicode_decompose_lookup[1042];
-    case 0x1DBD: *len = 1; return &unicode_decompose_lookup[1043];
-    case 0x1DBE: *len = 1; return &unicode_decompose_lookup[1044];
-    case 0x1DBF: *len = 1; return &unicode_decompose_lookup[1045];
-    case 0x1E9A: *len = 2; return &unicode_decompose_lookup[1354];
-    case 0x1FBD: *len = 2; return &unicode_decompose_lookup[1878];
-    case 0x1FBF: *len = 2; return &unicode_decompose_lookup[1881];
-    case 0x1FC0: *len = 2; return &unicode_decompose_lookup[1883];
-    case 0x1FFE: *len = 2; return &unicode_decompose_lookup[1982];
-    case 0x2002: *len = 1; return &unicode_decompose_lookup[1986];
-    case 0x2003: *len = 1; return &unicode_decompose_lookup[1987];
-    case 0x2004: *len = 1; return &unicode_decompose_lookup[1988];
-    case 0x2005: *len = 1; return &unicode_decompose_lookup[1989];
-    case 0x2006: *len = 1; return &unicode_decompose_lookup[1990];
-    case 0x2007: *len = 1; return &unicode_decompose_lookup[1991];
-    case 0x2008: *len = 1; return &unicode_decompose_lookup[1992];
-    case 0x2009: *len = 1; return &unicode_decompose_lookup[1993];
-    case 0x200A: *len = 1; return &unicode_decompose_lookup[1994];
-    case 0x2011: *len = 1; return &unicode_decompose_lookup[1995];
-    case 0x2017: *len = 2; return &unicode_decompose_lookup[1996];
-    case 0x2024: *len = 1; return &unicode_decompose_lookup[1998];
-    case 0x2025: *len = 2; return &unicode_decompose_lookup[1999];
-    case 0x2026: *len = 3; return &unicode_decompose_lookup[2001];
-    case 0x202F: *len = 1; return &unicode_decompose_lookup[2004];
-    case 0x2033: *len = 2; return &unicode_decompose_lookup[2005];
-    case 0x2034: *len = 3; return &unicode_decompose_lookup[2007];
-    case 0x2036: *len = 2; return &unicode_decompose_lookup[2010];
-    case 0x2037: *len = 3; return &unicode_decompose_lookup[2012];
-    case 0x203C: *len = 2; return &unicode_decompose_lookup[2015];
-    case 0x203E: *len = 2; return &unicode_decompose_lookup[2017];
-    case 0x2047: *len = 2; return &unicode_decompose_lookup[2019];
-    case 0x2048: *len = 2; return &unicode_decompose_lookup[2021];
-    case 0x2049: *len = 2; return &unicode_decompose_lookup[2023];
-    case 0x2057: *len = 4; return &unicode_decompose_lookup[2025];
-    case 0x205F: *len = 1; return &unicode_decompose_lookup[2029];
-    case 0x2070: *len = 1; return &unicode_decompose_lookup[2030];
-    case 0x2071: *len = 1; return &unicode_decompose_lookup[2031];
-    case 0x2074: *len = 1; return &unicode_decompose_lookup[2032];
-    case 0x2075: *len = 1; return &unicode_decompose_lookup[2033];
-    case 0x2076: *len = 1; return &unicode_decompose_lookup[2034];
-    case 0x2077: *len = 1; return &unicode_decompose_lookup[2035];
-    case 0x2078: *len = 1; return &unicode_decompose_lookup[2036];
-    case 0x2079: *len = 1; return &unicode_decompose_lookup[2037];
-    case 0x207A: *len = 1; return &unicode_decompose_lookup[2038];
-    case 0x207B: *len = 1; return &unicode_decompose_lookup[2039];
-    case 0x207C: *len = 1; return &unicode_decompose_lookup[2040];
-    case 0x207D: *len = 1; return &unicode_decompose_lookup[2041];
-    case 0x207E: *len = 1; return &unicode_decompose_lookup[2042];
-    case 0x207F: *len = 1; return &unicode_decompose_lookup[2043];
-    case 0x2080: *len = 1; return &unicode_decompose_lookup[2044];
-    case 0x2081: *len = 1; return &unicode_decompose_lookup[2045];
-    case 0x2082: *len = 1; return &unicode_decompose_lookup[2046];
-    case 0x2083: *len = 1; return &unicode_decompose_lookup[2047];
-    case 0x2084: *len = 1; return &unicode_decompose_lookup[2048];
-    case 0x2085: *len = 1; return &unicode_decompose_lookup[2049];
-    case 0x2086: *len = 1; return &unicode_decompose_lookup[2050];
-    case 0x2087: *len = 1; return &unicode_decompose_lookup[2051];
-    case 0x2088: *len = 1; return &unicode_decompose_lookup[2052];
-    case 0x2089: *len = 1; return &unicode_decompose_lookup[2053];
-    case 0x208A: *len = 1; return &unicode_decompose_lookup[2054];
-    case 0x208B: *len = 1; return &unicode_decompose_lookup[2055];
-    case 0x208C: *len = 1; return &unicode_decompose_lookup[2056];
-    case 0x208D: *len = 1; return &unicode_decompose_lookup[2057];
-    case 0x208E: *len = 1; return &unicode_decompose_lookup[2058];
-    case 0x2090: *len = 1; return &unicode_decompose_lookup[2059];
-    case 0x2091: *len = 1; return &unicode_decompose_lookup[2060];
-    case 0x2092: *len = 1; return &unicode_decompose_lookup[2061];
-    case 0x2093: *len = 1; return &unicode_decompose_lookup[2062];
-    case 0x2094: *len = 1; return &unicode_decompose_lookup[2063];
-    case 0x2095: *len = 1; return &unicode_decompose_lookup[2064];
-    case 0x2096: *len = 1; return &unicode_decompose_lookup[2065];
-    case 0x2097: *len = 1; return &unicode_decompose_lookup[2066];
-    case 0x2098: *len = 1; return &unicode_decompose_lookup[2067];
-    case 0x2099: *len = 1; return &unicode_decompose_lookup[2068];
-    case 0x209A: *len = 1; return &unicode_decompose_lookup[2069];
-    case 0x209B: *len = 1; return &unicode_decompose_lookup[2070];
-    case 0x209C: *len = 1; return &unicode_decompose_lookup[2071];
-    case 0x20A8: *len = 2; return &unicode_decompose_lookup[2072];
-    case 0x2100: *len = 3; return &unicode_decompose_lookup[2074];
-    case 0x2101: *len = 3; return &unicode_decompose_lookup[2077];
-    case 0x2102: *len = 1; return &unicode_decompose_lookup[2080];
-    case 0x2103: *len = 2; return &unicode_decompose_lookup[2081];
-    case 0x2105: *len = 3; return &unicode_decompose_lookup[2083];
-    case 0x2106: *len = 3; return &unicode_decompose_lookup[2086];
-    case 0x2107: *len = 1; return &unicode_decompose_lookup[2089];
-    case 0x2109: *len = 2; return &unicode_decompose_lookup[2090];
-    case 0x210A: *len = 1; return &unicode_decompose_lookup[2092];
-    case 0x210B: *len = 1; return &unicode_decompose_lookup[2093];
-    case 0x210C: *len = 1; return &unicode_decompose_lookup[2094];
-    case 0x210D: *len = 1; return &unicode_decompose_lookup[2095];
-    case 0x210E: *len = 1; return &unicode_decompose_lookup[2096];
-    case 0x210F: *len = 1; return &unicode_decompose_lookup[2097];
-    case 0x2110: *len = 1; return &unicode_decompose_lookup[2098];
-    case 0x2111: *len = 1; return &unicode_decompose_lookup[2099];
-    case 0x2112: *len = 1; return &unicode_decompose_lookup[2100];
-    case 0x2113: *len = 1; return &unicode_decompose_lookup[2101];
-    case 0x2115: *len = 1; return &unicode_decompose_lookup[2102];
-    case 0x2116: *len = 2; return &unicode_decompose_lookup[2103];
-    case 0x2119: *len = 1; return &unicode_decompose_lookup[2105];
-    case 0x211A: *len = 1; return &unicode_decompose_lookup[2106];
-    case 0x211B: *len = 1; return &unicode_decompose_lookup[2107];
-    case 0x211C: *len = 1; return &unicode_decompose_lookup[2108];
-    case 0x211D: *len = 1; return &unicode_decompose_lookup[2109];
-    case 0x2120: *len = 2; return &unicode_decompose_lookup[2110];
-    case 0x2121: *len = 3; return &unicode_decompose_lookup[2112];
-    case 0x2122: *len = 2; return &unicode_decompose_lookup[2115];
-    case 0x2124: *len = 1; return &unicode_decompose_lookup[2117];
-    case 0x2128: *len = 1; return &unicode_decompose_lookup[2119];
-    case 0x212C: *len = 1; return &unicode_decompose_lookup[2122];
-    case 0x212D: *len = 1; return &unicode_decompose_lookup[2123];
-    case 0x212F: *len = 1; return &unicode_decompose_lookup[2124];
-    case 0x2130: *len = 1; return &unicode_decompose_lookup[2125];
-    case 0x2131: *len = 1; return &unicode_decompose_lookup[2126];
-    case 0x2133: *len = 1; return &unicode_decompose_lookup[2127];
-    case 0x2134: *len = 1; return &unicode_decompose_lookup[2128];
-    case 0x2135: *len = 1; return &unicode_decompose_lookup[2129];
-    case 0x2136: *len = 1; return &unicode_decompose_lookup[2130];
-    case 0x2137: *len = 1; return &unicode_decompose_lookup[2131];
-    case 0x2138: *len = 1; return &unicode_decompose_lookup[2132];
-    case 0x2139: *len = 1; return &unicode_decompose_lookup[2133];
-    case 0x213B: *len = 3; return &unicode_decompose_lookup[2134];
-    case 0x213C: *len = 1; return &unicode_decompose_lookup[2137];
-    case 0x213D: *len = 1; return &unicode_decompose_lookup[2138];
-    case 0x213E: *len = 1; return &unicode_decompose_lookup[2139];
-    case 0x213F: *len = 1; return &unicode_decompose_lookup[2140];
-    case 0x2140: *len = 1; return &unicode_decompose_lookup[2141];
-    case 0x2145: *len = 1; return &unicode_decompose_lookup[2142];
-    case 0x2146: *len = 1; return &unicode_decompose_lookup[2143];
-    case 0x2147: *len = 1; return &unicode_decompose_lookup[2144];
-    case 0x2148: *len = 1; return &unicode_decompose_lookup[2145];
-    case 0x2149: *len = 1; return &unicode_decompose_lookup[2146];
-    case 0x2150: *len = 3; return &unicode_decompose_lookup[2147];
-    case 0x2151: *len = 3; return &unicode_decompose_lookup[2150];
-    case 0x2152: *len = 4; return &unicode_decompose_lookup[2153];
-    case 0x2153: *len = 3; return &unicode_decompose_lookup[2157];
-    case 0x2154: *len = 3; return &unicode_decompose_lookup[2160];
-    case 0x2155: *len = 3; return &unicode_decompose_lookup[2163];
-    case 0x2156: *len = 3; return &unicode_decompose_lookup[2166];
-    case 0x2157: *len = 3; return &unicode_decompose_lookup[2169];
-    case 0x2158: *len = 3; return &unicode_decompose_lookup[2172];
-    case 0x2159: *len = 3; return &unicode_decompose_lookup[2175];
-    case 0x215A: *len = 3; return &unicode_decompose_lookup[2178];
-    case 0x215B: *len = 3; return &unicode_decompose_lookup[2181];
-    case 0x215C: *len = 3; return &unicode_decompose_lookup[2184];
-    case 0x215D: *len = 3; return &unicode_decompose_lookup[2187];
-    case 0x215E: *len = 3; return &unicode_decompose_lookup[2190];
-    case 0x215F: *len = 2; return &unicode_decompose_lookup[2193];
-    case 0x2160: *len = 1; return &unicode_decompose_lookup[2195];
-    case 0x2161: *len = 2; return &unicode_decompose_lookup[2196];
-    case 0x2162: *len = 3; return &unicode_decompose_lookup[2198];
-    case 0x2163: *len = 2; return &unicode_decompose_lookup[2201];
-    case 0x2164: *len = 1; return &unicode_decompose_lookup[2203];
-    case 0x2165: *len = 2; return &unicode_decompose_lookup[2204];
-    case 0x2166: *len = 3; return &unicode_decompose_lookup[2206];
-    case 0x2167: *len = 4; return &unicode_decompose_lookup[2209];
-    case 0x2168: *len = 2; return &unicode_decompose_lookup[2213];
-    case 0x2169: *len = 1; return &unicode_decompose_lookup[2215];
-    case 0x216A: *len = 2; return &unicode_decompose_lookup[2216];
-    case 0x216B: *len = 3; return &unicode_decompose_lookup[2218];
-    case 0x216C: *len = 1; return &unicode_decompose_lookup[2221];
-    case 0x216D: *len = 1; return &unicode_decompose_lookup[2222];
-    case 0x216E: *len = 1; return &unicode_decompose_lookup[2223];
-    case 0x216F: *len = 1; return &unicode_decompose_lookup[2224];
-    case 0x2170: *len = 1; return &unicode_decompose_lookup[2225];
-    case 0x2171: *len = 2; return &unicode_decompose_lookup[2226];
-    case 0x2172: *len = 3; return &unicode_decompose_lookup[2228];
-    case 0x2173: *len = 2; return &unicode_decompose_lookup[2231];
-    case 0x2174: *len = 1; return &unicode_decompose_lookup[2233];
-    case 0x2175: *len = 2; return &unicode_decompose_lookup[2234];
-    case 0x2176: *len = 3; return &unicode_decompose_lookup[2236];
-    case 0x2177: *len = 4; return &unicode_decompose_lookup[2239];
-    case 0x2178: *len = 2; return &unicode_decompose_lookup[2243];
-    case 0x2179: *len = 1; return &unicode_decompose_lookup[2245];
-    case 0x217A: *len = 2; return &unicode_decompose_lookup[2246];
-    case 0x217B: *len = 3; return &unicode_decompose_lookup[2248];
-    case 0x217C: *len = 1; return &unicode_decompose_lookup[2251];
-    case 0x217D: *len = 1; return &unicode_decompose_lookup[2252];
-    case 0x217E: *len = 1; return &unicode_decompose_lookup[2253];
-    case 0x217F: *len = 1; return &unicode_decompose_lookup[2254];
-    case 0x2189: *len = 3; return &unicode_decompose_lookup[2255];
-    case 0x222C: *len = 2; return &unicode_decompose_lookup[2280];
-    case 0x222D: *len = 3; return &unicode_decompose_lookup[2282];
-    case 0x222F: *len = 2; return &unicode_decompose_lookup[2285];
-    case 0x2230: *len = 3; return &unicode_decompose_lookup[2287];
-    case 0x2460: *len = 1; return &unicode_decompose_lookup[2358];
-    case 0x2461: *len = 1; return &unicode_decompose_lookup[2359];
-    case 0x2462: *len = 1; return &unicode_decompose_lookup[2360];
-    case 0x2463: *len = 1; return &unicode_decompose_lookup[2361];
-    case 0x2464: *len = 1; return &unicode_decompose_lookup[2362];
-    case 0x2465: *len = 1; return &unicode_decompose_lookup[2363];
-    case 0x2466: *len = 1; return &unicode_decompose_lookup[2364];
-    case 0x2467: *len = 1; return &unicode_decompose_lookup[2365];
-    case 0x2468: *len = 1; return &unicode_decompose_lookup[2366];
-    case 0x2469: *len = 2; return &unicode_decompose_lookup[2367];
-    case 0x246A: *len = 2; return &unicode_decompose_lookup[2369];
-    case 0x246B: *len = 2; return &unicode_decompose_lookup[2371];
-    case 0x246C: *len = 2; return &unicode_decompose_lookup[2373];
-    case 0x246D: *len = 2; return &unicode_decompose_lookup[2375];
-    case 0x246E: *len = 2; return &unicode_decompose_lookup[2377];
-    case 0x246F: *len = 2; return &unicode_decompose_lookup[2379];
-    case 0x2470: *len = 2; return &unicode_decompose_lookup[2381];
-    case 0x2471: *len = 2; return &unicode_decompose_lookup[2383];
-    case 0x2472: *len = 2; return &unicode_decompose_lookup[2385];
-    case 0x2473: *len = 2; return &unicode_decompose_lookup[2387];
-    case 0x2474: *len = 3; return &unicode_decompose_lookup[2389];
-    case 0x2475: *len = 3; return &unicode_decompose_lookup[2392];
-    case 0x2476: *len = 3; return &unicode_decompose_lookup[2395];
-    case 0x2477: *len = 3; return &unicode_decompose_lookup[2398];
-    case 0x2478: *len = 3; return &unicode_decompose_lookup[2401];
-    case 0x2479: *len = 3; return &unicode_decompose_lookup[2404];
-    case 0x247A: *len = 3; return &unicode_decompose_lookup[2407];
-    case 0x247B: *len = 3; return &unicode_decompose_lookup[2410];
-    case 0x247C: *len = 3; return &unicode_decompose_lookup[2413];
-    case 0x247D: *len = 4; return &unicode_decompose_lookup[2416];
-    case 0x247E: *len = 4; return &unicode_decompose_lookup[2420];
-    case 0x247F: *len = 4; return &unicode_decompose_lookup[2424];
-    case 0x2480: *len = 4; return &unicode_decompose_lookup[2428];
-    case 0x2481: *len = 4; return &unicode_decompose_lookup[2432];
-    case 0x2482: *len = 4; return &unicode_decompose_lookup[2436];
-    case 0x2483: *len = 4; return &unicode_decompose_lookup[2440];
-    case 0x2484: *len = 4; return &unicode_decompose_lookup[2444];
-    case 0x2485: *len = 4; return &unicode_decompose_lookup[2448];
-    case 0x2486: *len = 4; return &unicode_decompose_lookup[2452];
-    case 0x2487: *len = 4; return &unicode_decompose_lookup[2456];
-    case 0x2488: *len = 2; return &unicode_decompose_lookup[2460];
-    case 0x2489: *len = 2; return &unicode_decompose_lookup[2462];
-    case 0x248A: *len = 2; return &unicode_decompose_lookup[2464];
-    case 0x248B: *len = 2; return &unicode_decompose_lookup[2466];
-    case 0x248C: *len = 2; return &unicode_decompose_lookup[2468];
-    case 0x248D: *len = 2; return &unicode_decompose_lookup[2470];
-    case 0x248E: *len = 2; return &unicode_decompose_lookup[2472];
-    case 0x248F: *len = 2; return &unicode_decompose_lookup[2474];
-    case 0x2490: *len = 2; return &unicode_decompose_lookup[2476];
-    case 0x2491: *len = 3; return &unicode_decompose_lookup[2478];
-    case 0x2492: *len = 3; return &unicode_decompose_lookup[2481];
-    case 0x2493: *len = 3; return &unicode_decompose_lookup[2484];
-    case 0x2494: *len = 3; return &unicode_decompose_lookup[2487];
-    case 0x2495: *len = 3; return &unicode_decompose_lookup[2490];
-    case 0x2496: *len = 3; return &unicode_decompose_lookup[2493];
-    case 0x2497: *len = 3; return &unicode_decompose_lookup[2496];
-    case 0x2498: *len = 3; return &unicode_decompose_lookup[2499];
-    case 0x2499: *len = 3; return &unicode_decompose_lookup[2502];
-    case 0x249A: *len = 3; return &unicode_decompose_lookup[2505];
-    case 0x249B: *len = 3; return &unicode_decompose_lookup[2508];
-    case 0x249C: *len = 3; return &unicode_decompose_lookup[2511];
-    case 0x249D: *len = 3; return &unicode_decompose_lookup[2514];
-    case 0x249E: *len = 3; return &unicode_decompose_lookup[2517];
-    case 0x249F: *len = 3; return &unicode_decompose_lookup[2520];
-    case 0x24A0: *len = 3; return &unicode_decompose_lookup[2523];
-    case 0x24A1: *len = 3; return &unicode_decompose_lookup[2526];
-    case 0x24A2: *len = 3; return &unicode_decompose_lookup[2529];
-    case 0x24A3: *len = 3; return &unicode_decompose_lookup[2532];
-    case 0x24A4: *len = 3; return &unicode_decompose_lookup[2535];
-    case 0x24A5: *len = 3; return &unicode_decompose_lookup[2538];
-    case 0x24A6: *len = 3; return &unicode_decompose_lookup[2541];
-    case 0x24A7: *len = 3; return &unicode_decompose_lookup[2544];
-    case 0x24A8: *len = 3; return &unicode_decompose_lookup[2547];
-    case 0x24A9: *len = 3; return &unicode_decompose_lookup[2550];
-    case 0x24AA: *len = 3; return &unicode_decompose_lookup[2553];
-    case 0x24AB: *len = 3; return &unicode_decompose_lookup[2556];
-    case 0x24AC: *len = 3; return &unicode_decompose_lookup[2559];
-    case 0x24AD: *len = 3; return &unicode_decompose_lookup[2562];
-    case 0x24AE: *len = 3; return &unicode_decompose_lookup[2565];
-    case 0x24AF: *len = 3; return &unicode_decompose_lookup[2568];
-    case 0x24B0: *len = 3; return &unicode_decompose_lookup[2571];
-    case 0x24B1: *len = 3; return &unicode_decompose_lookup[2574];
-    case 0x24B2: *len = 3; return &unicode_decompose_lookup[2577];
-    case 0x24B3: *len = 3; return &unicode_decompose_lookup[2580];
-    case 0x24B4: *len = 3; return &unicode_decompose_lookup[2583];
-    case 0x24B5: *len = 3; return &unicode_decompose_lookup[2586];
-    case 0x24B6: *len = 1; return &unicode_decompose_lookup[2589];
-    case 0x24B7: *len = 1; return &unicode_decompose_lookup[2590];
-    case 0x24B8: *len = 1; return &unicode_decompose_lookup[2591];
-    case 0x24B9: *len = 1; return &unicode_decompose_lookup[2592];
-    case 0x24BA: *len = 1; return &unicode_decompose_lookup[2593];
-    case 0x24BB: *len = 1; return &unicode_decompose_lookup[2594];
-    case 0x24BC: *len = 1; return &unicode_decompose_lookup[2595];
-    case 0x24BD: *len = 1; return &unicode_decompose_lookup[2596];
-    case 0x24BE: *len = 1; return &unicode_decompose_lookup[2597];
-    case 0x24BF: *len = 1; return &unicode_decompose_lookup[2598];
-    case 0x24C0: *len = 1; return &unicode_decompose_lookup[2599];
-    case 0x24C1: *len = 1; return &unicode_decompose_lookup[2600];
-    case 0x24C2: *len = 1; return &unicode_decompose_lookup[2601];
-    case 0x24C3: *len = 1; return &unicode_decompose_lookup[2602];
-    case 0x24C4: *len = 1; return &unicode_decompose_lookup[2603];
-    case 0x24C5: *len = 1; return &unicode_decompose_lookup[2604];
-    case 0x24C6: *len = 1; return &unicode_decompose_lookup[2605];
-    case 0x24C7: *len = 1; return &unicode_decompose_lookup[2606];
-    case 0x24C8: *len = 1; return &unicode_decompose_lookup[2607];
-    case 0x24C9: *len = 1; return &unicode_decompose_lookup[2608];
-    case 0x24CA: *len = 1; return &unicode_decompose_lookup[2609];
-    case 0x24CB: *len = 1; return &unicode_decompose_lookup[2610];
-    case 0x24CC: *len = 1; return &unicode_decompose_lookup[2611];
-    case 0x24CD: *len = 1; return &unicode_decompose_lookup[2612];
-    case 0x24CE: *len = 1; return &unicode_decompose_lookup[2613];
-    case 0x24CF: *len = 1; return &unicode_decompose_lookup[2614];
-    case 0x24D0: *len = 1; return &unicode_decompose_lookup[2615];
-    case 0x24D1: *len = 1; return &unicode_decompose_lookup[2616];
-    case 0x24D2: *len = 1; return &unicode_decompose_lookup[2617];
-    case 0x24D3: *len = 1; return &unicode_decompose_lookup[2618];
-    case 0x24D4: *len = 1; return &unicode_decompose_lookup[2619];
-    case 0x24D5: *len = 1; return &unicode_decompose_lookup[2620];
-    case 0x24D6: *len = 1; return &unicode_decompose_lookup[2621];
-    case 0x24D7: *len = 1; return &unicode_decompose_lookup[2622];
-    case 0x24D8: *len = 1; return &unicode_decompose_lookup[2623];
-    case 0x24D9: *len = 1; return &unicode_decompose_lookup[2624];
-    case 0x24DA: *len = 1; return &unicode_decompose_lookup[2625];
-    case 0x24DB: *len = 1; return &unicode_decompose_lookup[2626];
-    case 0x24DC: *len = 1; return &unicode_decompose_lookup[2627];
-    case 0x24DD: *len = 1; return &unicode_decompose_lookup[2628];
-    case 0x24DE: *len = 1; return &unicode_decompose_lookup[2629];
-    case 0x24DF: *len = 1; return &unicode_decompose_lookup[2630];
-    case 0x24E0: *len = 1; return &unicode_decompose_lookup[2631];
-    case 0x24E1: *len = 1; return &unicode_decompose_lookup[2632];
-    case 0x24E2: *len = 1; return &unicode_decompose_lookup[2633];
-    case 0x24E3: *len = 1; return &unicode_decompose_lookup[2634];
-    case 0x24E4: *len = 1; return &unicode_decompose_lookup[2635];
-    case 0x24E5: *len = 1; return &unicode_decompose_lookup[2636];
-    case 0x24E6: *len = 1; return &unicode_decompose_lookup[2637];
-    case 0x24E7: *len = 1; return &unicode_decompose_lookup[2638];
-    case 0x24E8: *len = 1; return &unicode_decompose_lookup[2639];
-    case 0x24E9: *len = 1; return &unicode_decompose_lookup[2640];
-    case 0x24EA: *len = 1; return &unicode_decompose_lookup[2641];
-    case 0x2A0C: *len = 4; return &unicode_decompose_lookup[2642];
-    case 0x2A74: *len = 3; return &unicode_decompose_lookup[2646];
-    case 0x2A75: *len = 2; return &unicode_decompose_lookup[2649];
-    case 0x2A76: *len = 3; return &unicode_decompose_lookup[2651];
-    case 0x2C7C: *len = 1; return &unicode_decompose_lookup[2656];
-    case 0x2C7D: *len = 1; return &unicode_decompose_lookup[2657];
-    case 0x2D6F: *len = 1; return &unicode_decompose_lookup[2658];
-    case 0x2E9F: *len = 1; return &unicode_decompose_lookup[2659];
-    case 0x2EF3: *len = 1; return &unicode_decompose_lookup[2660];
-    case 0x2F00: *len = 1; return &unicode_decompose_lookup[2661];
-    case 0x2F01: *len = 1; return &unicode_decompose_lookup[2662];
-    case 0x2F02: *len = 1; return &unicode_decompose_lookup[2663];
-    case 0x2F03: *len = 1; return &unicode_decompose_lookup[2664];
-    case 0x2F04: *len = 1; return &unicode_decompose_lookup[2665];
-    case 0x2F05: *len = 1; return &unicode_decompose_lookup[2666];
-    case 0x2F06: *len = 1; return &unicode_decompose_lookup[2667];
-    case 0x2F07: *len = 1; return &unicode_decompose_lookup[2668];
-    case 0x2F08: *len = 1; return &unicode_decompose_lookup[2669];
-    case 0x2F09: *len = 1; return &unicode_decompose_lookup[2670];
-    case 0x2F0A: *len = 1; return &unicode_decompose_lookup[2671];
-    case 0x2F0B: *len = 1; return &unicode_decompose_lookup[2672];
-    case 0x2F0C: *len = 1; return &unicode_decompose_lookup[2673];
-    case 0x2F0D: *len = 1; return &unicode_decompose_lookup[2674];
-    case 0x2F0E: *len = 1; return &unicode_decompose_lookup[2675];
-    case 0x2F0F: *len = 1; return &unicode_decompose_lookup[2676];
-    case 0x2F10: *len = 1; return &unicode_decompose_lookup[2677];
-    case 0x2F11: *len = 1; return &unicode_decompose_lookup[2678];
-    case 0x2F12: *len = 1; return &unicode_decompose_lookup[2679];
-    case 0x2F13: *len = 1; return &unicode_decompose_lookup[2680];
-    case 0x2F14: *len = 1; return &unicode_decompose_lookup[2681];
-    case 0x2F15: *len = 1; return &unicode_decompose_lookup[2682];
-    case 0x2F16: *len = 1; return &unicode_decompose_lookup[2683];
-    case 0x2F17: *len = 1; return &unicode_decompose_lookup[2684];
-    case 0x2F18: *len = 1; return &unicode_decompose_lookup[2685];
-    case 0x2F19: *len = 1; return &unicode_decompose_lookup[2686];
-    case 0x2F1A: *len = 1; return &unicode_decompose_lookup[2687];
-    case 0x2F1B: *len = 1; return &unicode_decompose_lookup[2688];
-    case 0x2F1C: *len = 1; return &unicode_decompose_lookup[2689];
-    case 0x2F1D: *len = 1; return &unicode_decompose_lookup[2690];
-    case 0x2F1E: *len = 1; return &unicode_decompose_lookup[2691];
-    case 0x2F1F: *len = 1; return &unicode_decompose_lookup[2692];
-    case 0x2F20: *len = 1; return &unicode_decompose_lookup[2693];
-    case 0x2F21: *len = 1; return &unicode_decompose_lookup[2694];
-    case 0x2F22: *len = 1; return &unicode_decompose_lookup[2695];
-    case 0x2F23: *len = 1; return &unicode_decompose_lookup[2696];
-    case 0x2F24: *len = 1; return &unicode_decompose_lookup[2697];
-    case 0x2F25: *len = 1; return &unicode_decompose_lookup[2698];
-    case 0x2F26: *len = 1; return &unicode_decompose_lookup[2699];
-    case 0x2F27: *len = 1; return &unicode_decompose_lookup[2700];
-    case 0x2F28: *len = 1; return &unicode_decompose_lookup[2701];
-    case 0x2F29: *len = 1; return &unicode_decompose_lookup[2702];
-    case 0x2F2A: *len = 1; return &unicode_decompose_lookup[2703];
-    case 0x2F2B: *len = 1; return &unicode_decompose_lookup[2704];
-    case 0x2F2C: *len = 1; return &unicode_decompose_lookup[2705];
-    case 0x2F2D: *len = 1; return &unicode_decompose_lookup[2706];
-    case 0x2F2E: *len = 1; return &unicode_decompose_lookup[2707];
-    case 0x2F2F: *len = 1; return &unicode_decompose_lookup[2708];
-    case 0x2F30: *len = 1; return &unicode_decompose_lookup[2709];
-    case 0x2F31: *len = 1; return &unicode_decompose_lookup[2710];
-    case 0x2F32: *len = 1; return &unicode_decompose_lookup[2711];
-    case 0x2F33: *len = 1; return &unicode_decompose_lookup[2712];
-    case 0x2F34: *len = 1; return &unicode_decompose_lookup[2713];
-    case 0x2F35: *len = 1; return &unicode_decompose_lookup[2714];
-    case 0x2F36: *len = 1; return &unicode_decompose_lookup[2715];
-    case 0x2F37: *len = 1; return &unicode_decompose_lookup[2716];
-    case 0x2F38: *len = 1; return &unicode_decompose_lookup[2717];
-    case 0x2F39: *len = 1; return &unicode_decompose_lookup[2718];
-    case 0x2F3A: *len = 1; return &unicode_decompose_lookup[2719];
-    case 0x2F3B: *len = 1; return &unicode_decompose_lookup[2720];
-    case 0x2F3C: *len = 1; return &unicode_decompose_lookup[2721];
-    case 0x2F3D: *len = 1; return &unicode_decompose_lookup[2722];
-    case 0x2F3E: *len = 1; return &unicode_decompose_lookup[2723];
-    case 0x2F3F: *len = 1; return &unicode_decompose_lookup[2724];
-    case 0x2F40: *len = 1; return &unicode_decompose_lookup[2725];
-    case 0x2F41: *len = 1; return &unicode_decompose_lookup[2726];
-    case 0x2F42: *len = 1; return &unicode_decompose_lookup[2727];
-    case 0x2F43: *len = 1; return &unicode_decompose_lookup[2728];
-    case 0x2F44: *len = 1; return &unicode_decompose_lookup[2729];
-    case 0x2F45: *len = 1; return &unicode_decompose_lookup[2730];
-    case 0x2F46: *len = 1; return &unicode_decompose_lookup[2731];
-    case 0x2F47: *len = 1; return &unicode_decompose_lookup[2732];
-    case 0x2F48: *len = 1; return &unicode_decompose_lookup[2733];
-    case 0x2F49: *len = 1; return &unicode_decompose_lookup[2734];
-    case 0x2F4A: *len = 1; return &unicode_decompose_lookup[2735];
-    case 0x2F4B: *len = 1; return &unicode_decompose_lookup[2736];
-    case 0x2F4C: *len = 1; return &unicode_decompose_lookup[2737];
-    case 0x2F4D: *len = 1; return &unicode_decompose_lookup[2738];
-    case 0x2F4E: *len = 1; return &unicode_decompose_lookup[2739];
-    case 0x2F4F: *len = 1; return &unicode_decompose_lookup[2740];
-    case 0x2F50: *len = 1; return &unicode_decompose_lookup[2741];
-    case 0x2F51: *len = 1; return &unicode_decompose_lookup[2742];
-    case 0x2F52: *len = 1; return &unicode_decompose_lookup[2743];
-    case 0x2F53: *len = 1; return &unicode_decompose_lookup[2744];
-    case 0x2F54: *len = 1; return &unicode_decompose_lookup[2745];
-    case 0x2F55: *len = 1; return &unicode_decompose_lookup[2746];
-    case 0x2F56: *len = 1; return &unicode_decompose_lookup[2747];
-    case 0x2F57: *len = 1; return &unicode_decompose_lookup[2748];
-    case 0x2F58: *len = 1; return &unicode_decompose_lookup[2749];
-    case 0x2F59: *len = 1; return &unicode_decompose_lookup[2750];
-    case 0x2F5A: *len = 1; return &unicode_decompose_lookup[2751];
-    case 0x2F5B: *len = 1; return &unicode_decompose_lookup[2752];
-    case 0x2F5C: *len = 1; return &unicode_decompose_lookup[2753];
-    case 0x2F5D: *len = 1; return &unicode_decompose_lookup[2754];
-    case 0x2F5E: *len = 1; return &unicode_decompose_lookup[2755];
-    case 0x2F5F: *len = 1; return &unicode_decompose_lookup[2756];
-    case 0x2F60: *len = 1; return &unicode_decompose_lookup[2757];
-    case 0x2F61: *len = 1; return &unicode_decompose_lookup[2758];
-    case 0x2F62: *len = 1; return &unicode_decompose_lookup[2759];
-    case 0x2F63: *len = 1; return &unicode_decompose_lookup[2760];
-    case 0x2F64: *len = 1; return &unicode_decompose_lookup[2761];
-    case 0x2F65: *len = 1; return &unicode_decompose_lookup[2762];
-    case 0x2F66: *len = 1; return &unicode_decompose_lookup[2763];
-    case 0x2F67: *len = 1; return &unicode_decompose_lookup[2764];
-    case 0x2F68: *len = 1; return &unicode_decompose_lookup[2765];
-    case 0x2F69: *len = 1; return &unicode_decompose_lookup[2766];
-    case 0x2F6A: *len = 1; return &unicode_decompose_lookup[2767];
-    case 0x2F6B: *len = 1; return &unicode_decompose_lookup[2768];
-    case 0x2F6C: *len = 1; return &unicode_decompose_lookup[2769];
-    case 0x2F6D: *len = 1; return &unicode_decompose_lookup[2770];
-    case 0x2F6E: *len = 1; return &unicode_decompose_lookup[2771];
-    case 0x2F6F: *len = 1; return &unicode_decompose_lookup[2772];
-    case 0x2F70: *len = 1; return &unicode_decompose_lookup[2773];
-    case 0x2F71: *len = 1; return &unicode_decompose_lookup[2774];
-    case 0x2F72: *len = 1; return &unicode_decompose_lookup[2775];
-    case 0x2F73: *len = 1; return &unicode_decompose_lookup[2776];
-    case 0x2F74: *len = 1; return &unicode_decompose_lookup[2777];
-    case 0x2F75: *len = 1; return &unicode_decompose_lookup[2778];
-    case 0x2F76: *len = 1; return &unicode_decompose_lookup[2779];
-    case 0x2F77: *len = 1; return &unicode_decompose_lookup[2780];
-    case 0x2F78: *len = 1; return &unicode_decompose_lookup[2781];
-    case 0x2F79: *len = 1; return &unicode_decompose_lookup[2782];
-    case 0x2F7A: *len = 1; return &unicode_decompose_lookup[2783];
-    case 0x2F7B: *len = 1; return &unicode_decompose_lookup[2784];
-    case 0x2F7C: *len = 1; return &unicode_decompose_lookup[2785];
-    case 0x2F7D: *len = 1; return &unicode_decompose_lookup[2786];
-    case 0x2F7E: *len = 1; return &unicode_decompose_lookup[2787];
-    case 0x2F7F: *len = 1; return &unicode_decompose_lookup[2788];
-    case 0x2F80: *len = 1; return &unicode_decompose_lookup[2789];
-    case 0x2F81: *len = 1; return &unicode_decompose_lookup[2790];
-    case 0x2F82: *len = 1; return &unicode_decompose_lookup[2791];
-    case 0x2F83: *len = 1; return &unicode_decompose_lookup[2792];
-    case 0x2F84: *len = 1; return &unicode_decompose_lookup[2793];
-    case 0x2F85: *len = 1; return &unicode_decompose_lookup[2794];
-    case 0x2F86: *len = 1; return &unicode_decompose_lookup[2795];
-    case 0x2F87: *len = 1; return &unicode_decompose_lookup[2796];
-    case 0x2F88: *len = 1; return &unicode_decompose_lookup[2797];
-    case 0x2F89: *len = 1; return &unicode_decompose_lookup[2798];
-    case 0x2F8A: *len = 1; return &unicode_decompose_lookup[2799];
-    case 0x2F8B: *len = 1; return &unicode_decompose_lookup[2800];
-    case 0x2F8C: *len = 1; return &unicode_decompose_lookup[2801];
-    case 0x2F8D: *len = 1; return &unicode_decompose_lookup[2802];
-    case 0x2F8E: *len = 1; return &unicode_decompose_lookup[2803];
-    case 0x2F8F: *len = 1; return &unicode_decompose_lookup[2804];
-    case 0x2F90: *len = 1; return &unicode_decompose_lookup[2805];
-    case 0x2F91: *len = 1; return &unicode_decompose_lookup[2806];
-    case 0x2F92: *len = 1; return &unicode_decompose_lookup[2807];
-    case 0x2F93: *len = 1; return &unicode_decompose_lookup[2808];
-    case 0x2F94: *len = 1; return &unicode_decompose_lookup[2809];
-    case 0x2F95: *len = 1; return &unicode_decompose_lookup[2810];
-    case 0x2F96: *len = 1; return &unicode_decompose_lookup[2811];
-    case 0x2F97: *len = 1; return &unicode_decompose_lookup[2812];
-    case 0x2F98: *len = 1; return &unicode_decompose_lookup[2813];
-    case 0x2F99: *len = 1; return &unicode_decompose_lookup[2814];
-    case 0x2F9A: *len = 1; return &unicode_decompose_lookup[2815];
-    case 0x2F9B: *len = 1; return &unicode_decompose_lookup[2816];
-    case 0x2F9C: *len = 1; return &unicode_decompose_lookup[2817];
-    case 0x2F9D: *len = 1; return &unicode_decompose_lookup[2818];
-    case 0x2F9E: *len = 1; return &unicode_decompose_lookup[2819];
-    case 0x2F9F: *len = 1; return &unicode_decompose_lookup[2820];
-    case 0x2FA0: *len = 1; return &unicode_decompose_lookup[2821];
-    case 0x2FA1: *len = 1; return &unicode_decompose_lookup[2822];
-    case 0x2FA2: *len = 1; return &unicode_decompose_lookup[2823];
-    case 0x2FA3: *len = 1; return &unicode_decompose_lookup[2824];
-    case 0x2FA4: *len = 1; return &unicode_decompose_lookup[2825];
-    case 0x2FA5: *len = 1; return &unicode_decompose_lookup[2826];
-    case 0x2FA6: *len = 1; return &unicode_decompose_lookup[2827];
-    case 0x2FA7: *len = 1; return &unicode_decompose_lookup[2828];
-    case 0x2FA8: *len = 1; return &unicode_decompose_lookup[2829];
-    case 0x2FA9: *len = 1; return &unicode_decompose_lookup[2830];
-    case 0x2FAA: *len = 1; return &unicode_decompose_lookup[2831];
-    case 0x2FAB: *len = 1; return &unicode_decompose_lookup[2832];
-    case 0x2FAC: *len = 1; return &unicode_decompose_lookup[2833];
-    case 0x2FAD: *len = 1; return &unicode_decompose_lookup[2834];
-    case 0x2FAE: *len = 1; return &unicode_decompose_lookup[2835];
-    case 0x2FAF: *len = 1; return &unicode_decompose_lookup[2836];
-    case 0x2FB0: *len = 1; return &unicode_decompose_lookup[2837];
-    case 0x2FB1: *len = 1; return &unicode_decompose_lookup[2838];
-    case 0x2FB2: *len = 1; return &unicode_decompose_lookup[2839];
-    case 0x2FB3: *len = 1; return &unicode_decompose_lookup[2840];
-    case 0x2FB4: *len = 1; return &unicode_decompose_lookup[2841];
-    case 0x2FB5: *len = 1; return &unicode_decompose_lookup[2842];
-    case 0x2FB6: *len = 1; return &unicode_decompose_lookup[2843];
-    case 0x2FB7: *len = 1; return &unicode_decompose_lookup[2844];
-    case 0x2FB8: *len = 1; return &unicode_decompose_lookup[2845];
-    case 0x2FB9: *len = 1; return &unicode_decompose_lookup[2846];
-    case 0x2FBA: *len = 1; return &unicode_decompose_lookup[2847];
-    case 0x2FBB: *len = 1; return &unicode_decompose_lookup[2848];
-    case 0x2FBC: *len = 1; return &unicode_decompose_lookup[2849];
-    case 0x2FBD: *len = 1; return &unicode_decompose_lookup[2850];
-    case 0x2FBE: *len = 1; return &unicode_decompose_lookup[2851];
-    case 0x2FBF: *len = 1; return &unicode_decompose_lookup[2852];
-    case 0x2FC0: *len = 1; return &unicode_decompose_lookup[2853];
-    case 0x2FC1: *len = 1; return &unicode_decompose_lookup[2854];
-    case 0x2FC2: *len = 1; return &unicode_decompose_lookup[2855];
-    case 0x2FC3: *len = 1; return &unicode_decompose_lookup[2856];
-    case 0x2FC4: *len = 1; return &unicode_decompose_lookup[2857];
-    case 0x2FC5: *len = 1; return &unicode_decompose_lookup[2858];
-    case 0x2FC6: *len = 1; return &unicode_decompose_lookup[2859];
-    case 0x2FC7: *len = 1; return &unicode_decompose_lookup[2860];
-    case 0x2FC8: *len = 1; return &unicode_decompose_lookup[2861];
-    case 0x2FC9: *len = 1; return &unicode_decompose_lookup[2862];
-    case 0x2FCA: *len = 1; return &unicode_decompose_lookup[2863];
-    case 0x2FCB: *len = 1; return &unicode_decompose_lookup[2864];
-    case 0x2FCC: *len = 1; return &unicode_decompose_lookup[2865];
-    case 0x2FCD: *len = 1; return &unicode_decompose_lookup[2866];
-    case 0x2FCE: *len = 1; return &unicode_decompose_lookup[2867];
-    case 0x2FCF: *len = 1; return &unicode_decompose_lookup[2868];
-    case 0x2FD0: *len = 1; return &unicode_decompose_lookup[2869];
-    case 0x2FD1: *len = 1; return &unicode_decompose_lookup[2870];
-    case 0x2FD2: *len = 1; return &unicode_decompose_lookup[2871];
-    case 0x2FD3: *len = 1; return &unicode_decompose_lookup[2872];
-    case 0x2FD4: *len = 1; return &unicode_decompose_lookup[2873];
-    case 0x2FD5: *len = 1; return &unicode_decompose_lookup[2874];
-    case 0x3000: *len = 1; return &unicode_decompose_lookup[2875];
-    case 0x3036: *len = 1; return &unicode_decompose_lookup[2876];
-    case 0x3038: *len = 1; return &unicode_decompose_lookup[2877];
-    case 0x3039: *len = 1; return &unicode_decompose_lookup[2878];
-    case 0x303A: *len = 1; return &unicode_decompose_lookup[2879];
-    case 0x309B: *len = 2; return &unicode_decompose_lookup[2932];
-    case 0x309C: *len = 2; return &unicode_decompose_lookup[2934];
-    case 0x309F: *len = 2; return &unicode_decompose_lookup[2938];
-    case 0x30FF: *len = 2; return &unicode_decompose_lookup[3002];
-    case 0x3131: *len = 1; return &unicode_decompose_lookup[3004];
-    case 0x3132: *len = 1; return &unicode_decompose_lookup[3005];
-    case 0x3133: *len = 1; return &unicode_decompose_lookup[3006];
-    case 0x3134: *len = 1; return &unicode_decompose_lookup[3007];
-    case 0x3135: *len = 1; return &unicode_decompose_lookup[3008];
-    case 0x3136: *len = 1; return &unicode_decompose_lookup[3009];
-    case 0x3137: *len = 1; return &unicode_decompose_lookup[3010];
-    case 0x3138: *len = 1; return &unicode_decompose_lookup[3011];
-    case 0x3139: *len = 1; return &unicode_decompose_lookup[3012];
-    case 0x313A: *len = 1; return &unicode_decompose_lookup[3013];
-    case 0x313B: *len = 1; return &unicode_decompose_lookup[3014];
-    case 0x313C: *len = 1; return &unicode_decompose_lookup[3015];
-    case 0x313D: *len = 1; return &unicode_decompose_lookup[3016];
-    case 0x313E: *len = 1; return &unicode_decompose_lookup[3017];
-    case 0x313F: *len = 1; return &unicode_decompose_lookup[3018];
-    case 0x3140: *len = 1; return &unicode_decompose_lookup[3019];
-    case 0x3141: *len = 1; return &unicode_decompose_lookup[3020];
-    case 0x3142: *len = 1; return &unicode_decompose_lookup[3021];
-    case 0x3143: *len = 1; return &unicode_decompose_lookup[3022];
-    case 0x3144: *len = 1; return &unicode_decompose_lookup[3023];
-    case 0x3145: *len = 1; return &unicode_decompose_lookup[3024];
-    case 0x3146: *len = 1; return &unicode_decompose_lookup[3025];
-    case 0x3147: *len = 1; return &unicode_decompose_lookup[3026];
-    case 0x3148: *len = 1; return &unicode_decompose_lookup[3027];
-    case 0x3149: *len = 1; return &unicode_decompose_lookup[3028];
-    case 0x314A: *len = 1; return &unicode_decompose_lookup[3029];
-    case 0x314B: *len = 1; return &unicode_decompose_lookup[3030];
-    case 0x314C: *len = 1; return &unicode_decompose_lookup[3031];
-    case 0x314D: *len = 1; return &unicode_decompose_lookup[3032];
-    case 0x314E: *len = 1; return &unicode_decompose_lookup[3033];
-    case 0x314F: *len = 1; return &unicode_decompose_lookup[3034];
-    case 0x3150: *len = 1; return &unicode_decompose_lookup[3035];
-    case 0x3151: *len = 1; return &unicode_decompose_lookup[3036];
-    case 0x3152: *len = 1; return &unicode_decompose_lookup[3037];
-    case 0x3153: *len = 1; return &unicode_decompose_lookup[3038];
-    case 0x3154: *len = 1; return &unicode_decompose_lookup[3039];
-    case 0x3155: *len = 1; return &unicode_decompose_lookup[3040];
-    case 0x3156: *len = 1; return &unicode_decompose_lookup[3041];
-    case 0x3157: *len = 1; return &unicode_decompose_lookup[3042];
-    case 0x3158: *len = 1; return &unicode_decompose_lookup[3043];
-    case 0x3159: *len = 1; return &unicode_decompose_lookup[3044];
-    case 0x315A: *len = 1; return &unicode_decompose_lookup[3045];
-    case 0x315B: *len = 1; return &unicode_decompose_lookup[3046];
-    case 0x315C: *len = 1; return &unicode_decompose_lookup[3047];
-    case 0x315D: *len = 1; return &unicode_decompose_lookup[3048];
-    case 0x315E: *len = 1; return &unicode_decompose_lookup[3049];
-    case 0x315F: *len = 1; return &unicode_decompose_lookup[3050];
-    case 0x3160: *len = 1; return &unicode_decompose_lookup[3051];
-    case 0x3161: *len = 1; return &unicode_decompose_lookup[3052];
-    case 0x3162: *len = 1; return &unicode_decompose_lookup[3053];
-    case 0x3163: *len = 1; return &unicode_decompose_lookup[3054];
-    case 0x3164: *len = 1; return &unicode_decompose_lookup[3055];
-    case 0x3165: *len = 1; return &unicode_decompose_lookup[3056];
-    case 0x3166: *len = 1; return &unicode_decompose_lookup[3057];
-    case 0x3167: *len = 1; return &unicode_decompose_lookup[3058];
-    case 0x3168: *len = 1; return &unicode_decompose_lookup[3059];
-    case 0x3169: *len = 1; return &unicode_decompose_lookup[3060];
-    case 0x316A: *len = 1; return &unicode_decompose_lookup[3061];
-    case 0x316B: *len = 1; return &unicode_decompose_lookup[3062];
-    case 0x316C: *len = 1; return &unicode_decompose_lookup[3063];
-    case 0x316D: *len = 1; return &unicode_decompose_lookup[3064];
-    case 0x316E: *len = 1; return &unicode_decompose_lookup[3065];
-    case 0x316F: *len = 1; return &unicode_decompose_lookup[3066];
-    case 0x3170: *len = 1; return &unicode_decompose_lookup[3067];
-    case 0x3171: *len = 1; return &unicode_decompose_lookup[3068];
-    case 0x3172: *len = 1; return &unicode_decompose_lookup[3069];
-    case 0x3173: *len = 1; return &unicode_decompose_lookup[3070];
-    case 0x3174: *len = 1; return &unicode_decompose_lookup[3071];
-    case 0x3175: *len = 1; return &unicode_decompose_lookup[3072];
-    case 0x3176: *len = 1; return &unicode_decompose_lookup[3073];
-    case 0x3177: *len = 1; return &unicode_decompose_lookup[3074];
-    case 0x3178: *len = 1; return &unicode_decompose_lookup[3075];
-    case 0x3179: *len = 1; return &unicode_decompose_lookup[3076];
-    case 0x317A: *len = 1; return &unicode_decompose_lookup[3077];
-    case 0x317B: *len = 1; return &unicode_decompose_lookup[3078];
-    case 0x317C: *len = 1; return &unicode_decompose_lookup[3079];
-    case 0x317D: *len = 1; return &unicode_decompose_lookup[3080];
-    case 0x317E: *len = 1; return &unicode_decompose_lookup[3081];
-    case 0x317F: *len = 1; return &unicode_decompose_lookup[3082];
-    case 0x3180: *len = 1; return &unicode_decompose_lookup[3083];
-    case 0x3181: *len = 1; return &unicode_decompose_lookup[3084];
-    case 0x3182: *len = 1; return &unicode_decompose_lookup[3085];
-    case 0x3183: *len = 1; return &unicode_decompose_lookup[3086];
-    case 0x3184: *len = 1; return &unicode_decompose_lookup[3087];
-    case 0x3185: *len = 1; return &unicode_decompose_lookup[3088];
-    case 0x3186: *len = 1; return &unicode_decompose_lookup[3089];
-    case 0x3187: *len = 1; return &unicode_decompose_lookup[3090];
-    case 0x3188: *len = 1; return &unicode_decompose_lookup[3091];
-    case 0x3189: *len = 1; return &unicode_decompose_lookup[3092];
-    case 0x318A: *len = 1; return &unicode_decompose_lookup[3093];
-    case 0x318B: *len = 1; return &unicode_decompose_lookup[3094];
-    case 0x318C: *len = 1; return &unicode_decompose_lookup[3095];
-    case 0x318D: *len = 1; return &unicode_decompose_lookup[3096];
-    case 0x318E: *len = 1; return &unicode_decompose_lookup[3097];
-    case 0x3192: *len = 1; return &unicode_decompose_lookup[3098];
-    case 0x3193: *len = 1; return &unicode_decompose_lookup[3099];
-    case 0x3194: *len = 1; return &unicode_decompose_lookup[3100];
-    case 0x3195: *len = 1; return &unicode_decompose_lookup[3101];
-    case 0x3196: *len = 1; return &unicode_decompose_lookup[3102];
-    case 0x3197: *len = 1; return &unicode_decompose_lookup[3103];
-    case 0x3198: *len = 1; return &unicode_decompose_lookup[3104];
-    case 0x3199: *len = 1; return &unicode_decompose_lookup[3105];
-    case 0x319A: *len = 1; return &unicode_decompose_lookup[3106];
-    case 0x319B: *len = 1; return &unicode_decompose_lookup[3107];
-    case 0x319C: *len = 1; return &unicode_decompose_lookup[3108];
-    case 0x319D: *len = 1; return &unicode_decompose_lookup[3109];
-    case 0x319E: *len = 1; return &unicode_decompose_lookup[3110];
-    case 0x319F: *len = 1; return &unicode_decompose_lookup[3111];
-    case 0x3200: *len = 3; return &unicode_decompose_lookup[3112];
-    case 0x3201: *len = 3; return &unicode_decompose_lookup[3115];
-    case 0x3202: *len = 3; return &unicode_decompose_lookup[3118];
-    case 0x3203: *len = 3; return &unicode_decompose_lookup[3121];
-    case 0x3204: *len = 3; return &unicode_decompose_lookup[3124];
-    case 0x3205: *len = 3; return &unicode_decompose_lookup[3127];
-    case 0x3206: *len = 3; return &unicode_decompose_lookup[3130];
-    case 0x3207: *len = 3; return &unicode_decompose_lookup[3133];
-    case 0x3208: *len = 3; return &unicode_decompose_lookup[3136];
-    case 0x3209: *len = 3; return &unicode_decompose_lookup[3139];
-    case 0x320A: *len = 3; return &unicode_decompose_lookup[3142];
-    case 0x320B: *len = 3; return &unicode_decompose_lookup[3145];
-    case 0x320C: *len = 3; return &unicode_decompose_lookup[3148];
-    case 0x320D: *len = 3; return &unicode_decompose_lookup[3151];
-    case 0x320E: *len = 4; return &unicode_decompose_lookup[3154];
-    case 0x320F: *len = 4; return &unicode_decompose_lookup[3158];
-    case 0x3210: *len = 4; return &unicode_decompose_lookup[3162];
-    case 0x3211: *len = 4; return &unicode_decompose_lookup[3166];
-    case 0x3212: *len = 4; return &unicode_decompose_lookup[3170];
-    case 0x3213: *len = 4; return &unicode_decompose_lookup[3174];
-    case 0x3214: *len = 4; return &unicode_decompose_lookup[3178];
-    case 0x3215: *len = 4; return &unicode_decompose_lookup[3182];
-    case 0x3216: *len = 4; return &unicode_decompose_lookup[3186];
-    case 0x3217: *len = 4; return &unicode_decompose_lookup[3190];
-    case 0x3218: *len = 4; return &unicode_decompose_lookup[3194];
-    case 0x3219: *len = 4; return &unicode_decompose_lookup[3198];
-    case 0x321A: *len = 4; return &unicode_decompose_lookup[3202];
-    case 0x321B: *len = 4; return &unicode_decompose_lookup[3206];
-    case 0x321C: *len = 4; return &unicode_decompose_lookup[3210];
-    case 0x321D: *len = 7; return &unicode_decompose_lookup[3214];
-    case 0x321E: *len = 6; return &unicode_decompose_lookup[3221];
-    case 0x3220: *len = 3; return &unicode_decompose_lookup[3227];
-    case 0x3221: *len = 3; return &unicode_decompose_lookup[3230];
-    case 0x3222: *len = 3; return &unicode_decompose_lookup[3233];
-    case 0x3223: *len = 3; return &unicode_decompose_lookup[3236];
-    case 0x3224: *len = 3; return &unicode_decompose_lookup[3239];
-    case 0x3225: *len = 3; return &unicode_decompose_lookup[3242];
-    case 0x3226: *len = 3; return &unicode_decompose_lookup[3245];
-    case 0x3227: *len = 3; return &unicode_decompose_lookup[3248];
-    case 0x3228: *len = 3; return &unicode_decompose_lookup[3251];
-    case 0x3229: *len = 3; return &unicode_decompose_lookup[3254];
-    case 0x322A: *len = 3; return &unicode_decompose_lookup[3257];
-    case 0x322B: *len = 3; return &unicode_decompose_lookup[3260];
-    case 0x322C: *len = 3; return &unicode_decompose_lookup[3263];
-    case 0x322D: *len = 3; return &unicode_decompose_lookup[3266];
-    case 0x322E: *len = 3; return &unicode_decompose_lookup[3269];
-    case 0x322F: *len = 3; return &unicode_decompose_lookup[3272];
-    case 0x3230: *len = 3; return &unicode_decompose_lookup[3275];
-    case 0x3231: *len = 3; return &unicode_decompose_lookup[3278];
-    case 0x3232: *len = 3; return &unicode_decompose_lookup[3281];
-    case 0x3233: *len = 3; return &unicode_decompose_lookup[3284];
-    case 0x3234: *len = 3; return &unicode_decompose_lookup[3287];
-    case 0x3235: *len = 3; return &unicode_decompose_lookup[3290];
-    case 0x3236: *len = 3; return &unicode_decompose_lookup[3293];
-    case 0x3237: *len = 3; return &unicode_decompose_lookup[3296];
-    case 0x3238: *len = 3; return &unicode_decompose_lookup[3299];
-    case 0x3239: *len = 3; return &unicode_decompose_lookup[3302];
-    case 0x323A: *len = 3; return &unicode_decompose_lookup[3305];
-    case 0x323B: *len = 3; return &unicode_decompose_lookup[3308];
-    case 0x323C: *len = 3; return &unicode_decompose_lookup[3311];
-    case 0x323D: *len = 3; return &unicode_decompose_lookup[3314];
-    case 0x323E: *len = 3; return &unicode_decompose_lookup[3317];
-    case 0x323F: *len = 3; return &unicode_decompose_lookup[3320];
-    case 0x3240: *len = 3; return &unicode_decompose_lookup[3323];
-    case 0x3241: *len = 3; return &unicode_decompose_lookup[3326];
-    case 0x3242: *len = 3; return &unicode_decompose_lookup[3329];
-    case 0x3243: *len = 3; return &unicode_decompose_lookup[3332];
-    case 0x3244: *len = 1; return &unicode_decompose_lookup[3335];
-    case 0x3245: *len = 1; return &unicode_decompose_lookup[3336];
-    case 0x3246: *len = 1; return &unicode_decompose_lookup[3337];
-    case 0x3247: *len = 1; return &unicode_decompose_lookup[3338];
-    case 0x3250: *len = 3; return &unicode_decompose_lookup[3339];
-    case 0x3251: *len = 2; return &unicode_decompose_lookup[3342];
-    case 0x3252: *len = 2; return &unicode_decompose_lookup[3344];
-    case 0x3253: *len = 2; return &unicode_decompose_lookup[3346];
-    case 0x3254: *len = 2; return &unicode_decompose_lookup[3348];
-    case 0x3255: *len = 2; return &unicode_decompose_lookup[3350];
-    case 0x3256: *len = 2; return &unicode_decompose_lookup[3352];
-    case 0x3257: *len = 2; return &unicode_decompose_lookup[3354];
-    case 0x3258: *len = 2; return &unicode_decompose_lookup[3356];
-    case 0x3259: *len = 2; return &unicode_decompose_lookup[3358];
-    case 0x325A: *len = 2; return &unicode_decompose_lookup[3360];
-    case 0x325B: *len = 2; return &unicode_decompose_lookup[3362];
-    case 0x325C: *len = 2; return &unicode_decompose_lookup[3364];
-    case 0x325D: *len = 2; return &unicode_decompose_lookup[3366];
-    case 0x325E: *len = 2; return &unicode_decompose_lookup[3368];
-    case 0x325F: *len = 2; return &unicode_decompose_lookup[3370];
-    case 0x3260: *len = 1; return &unicode_decompose_lookup[3372];
-    case 0x3261: *len = 1; return &unicode_decompose_lookup[3373];
-    case 0x3262: *len = 1; return &unicode_decompose_lookup[3374];
-    case 0x3263: *len = 1; return &unicode_decompose_lookup[3375];
-    case 0x3264: *len = 1; return &unicode_decompose_lookup[3376];
-    case 0x3265: *len = 1; return &unicode_decompose_lookup[3377];
-    case 0x3266: *len = 1; return &unicode_decompose_lookup[3378];
-    case 0x3267: *len = 1; return &unicode_decompose_lookup[3379];
-    case 0x3268: *len = 1; return &unicode_decompose_lookup[3380];
-    case 0x3269: *len = 1; return &unicode_decompose_lookup[3381];
-    case 0x326A: *len = 1; return &unicode_decompose_lookup[3382];
-    case 0x326B: *len = 1; return &unicode_decompose_lookup[3383];
-    case 0x326C: *len = 1; return &unicode_decompose_lookup[3384];
-    case 0x326D: *len = 1; return &unicode_decompose_lookup[3385];
-    case 0x326E: *len = 2; return &unicode_decompose_lookup[3386];
-    case 0x326F: *len = 2; return &unicode_decompose_lookup[3388];
-    case 0x3270: *len = 2; return &unicode_decompose_lookup[3390];
-    case 0x3271: *len = 2; return &unicode_decompose_lookup[3392];
-    case 0x3272: *len = 2; return &unicode_decompose_lookup[3394];
-    case 0x3273: *len = 2; return &unicode_decompose_lookup[3396];
-    case 0x3274: *len = 2; return &unicode_decompose_lookup[3398];
-    case 0x3275: *len = 2; return &unicode_decompose_lookup[3400];
-    case 0x3276: *len = 2; return &unicode_decompose_lookup[3402];
-    case 0x3277: *len = 2; return &unicode_decompose_lookup[3404];
-    case 0x3278: *len = 2; return &unicode_decompose_lookup[3406];
-    case 0x3279: *len = 2; return &unicode_decompose_lookup[3408];
-    case 0x327A: *len = 2; return &unicode_decompose_lookup[3410];
-    case 0x327B: *len = 2; return &unicode_decompose_lookup[3412];
-    case 0x327C: *len = 5; return &unicode_decompose_lookup[3414];
-    case 0x327D: *len = 4; return &unicode_decompose_lookup[3419];
-    case 0x327E: *len = 2; return &unicode_decompose_lookup[3423];
-    case 0x3280: *len = 1; return &unicode_decompose_lookup[3425];
-    case 0x3281: *len = 1; return &unicode_decompose_lookup[3426];
-    case 0x3282: *len = 1; return &unicode_decompose_lookup[3427];
-    case 0x3283: *len = 1; return &unicode_decompose_lookup[3428];
-    case 0x3284: *len = 1; return &unicode_decompose_lookup[3429];
-    case 0x3285: *len = 1; return &unicode_decompose_lookup[3430];
-    case 0x3286: *len = 1; return &unicode_decompose_lookup[3431];
-    case 0x3287: *len = 1; return &unicode_decompose_lookup[3432];
-    case 0x3288: *len = 1; return &unicode_decompose_lookup[3433];
-    case 0x3289: *len = 1; return &unicode_decompose_lookup[3434];
-    case 0x328A: *len = 1; return &unicode_decompose_lookup[3435];
-    case 0x328B: *len = 1; return &unicode_decompose_lookup[3436];
-    case 0x328C: *len = 1; return &unicode_decompose_lookup[3437];
-    case 0x328D: *len = 1; return &unicode_decompose_lookup[3438];
-    case 0x328E: *len = 1; return &unicode_decompose_lookup[3439];
-    case 0x328F: *len = 1; return &unicode_decompose_lookup[3440];
-    case 0x3290: *len = 1; return &unicode_decompose_lookup[3441];
-    case 0x3291: *len = 1; return &unicode_decompose_lookup[3442];
-    case 0x3292: *len = 1; return &unicode_decompose_lookup[3443];
-    case 0x3293: *len = 1; return &unicode_decompose_lookup[3444];
-    case 0x3294: *len = 1; return &unicode_decompose_lookup[3445];
-    case 0x3295: *len = 1; return &unicode_decompose_lookup[3446];
-    case 0x3296: *len = 1; return &unicode_decompose_lookup[3447];
-    case 0x3297: *len = 1; return &unicode_decompose_lookup[3448];
-    case 0x3298: *len = 1; return &unicode_decompose_lookup[3449];
-    case 0x3299: *len = 1; return &unicode_decompose_lookup[3450];
-    case 0x329A: *len = 1; return &unicode_decompose_lookup[3451];
-    case 0x329B: *len = 1; return &unicode_decompose_lookup[3452];
-    case 0x329C: *len = 1; return &unicode_decompose_lookup[3453];
-    case 0x329D: *len = 1; return &unicode_decompose_lookup[3454];
-    case 0x329E: *len = 1; return &unicode_decompose_lookup[3455];
-    case 0x329F: *len = 1; return &unicode_decompose_lookup[3456];
-    case 0x32A0: *len = 1; return &unicode_decompose_lookup[3457];
-    case 0x32A1: *len = 1; return &unicode_decompose_lookup[3458];
-    case 0x32A2: *len = 1; return &unicode_decompose_lookup[3459];
-    case 0x32A3: *len = 1; return &unicode_decompose_lookup[3460];
-    case 0x32A4: *len = 1; return &unicode_decompose_lookup[3461];
-    case 0x32A5: *len = 1; return &unicode_decompose_lookup[3462];
-    case 0x32A6: *len = 1; return &unicode_decompose_lookup[3463];
-    case 0x32A7: *len = 1; return &unicode_decompose_lookup[3464];
-    case 0x32A8: *len = 1; return &unicode_decompose_lookup[3465];
-    case 0x32A9: *len = 1; return &unicode_decompose_lookup[3466];
-    case 0x32AA: *len = 1; return &unicode_decompose_lookup[3467];
-    case 0x32AB: *len = 1; return &unicode_decompose_lookup[3468];
-    case 0x32AC: *len = 1; return &unicode_decompose_lookup[3469];
-    case 0x32AD: *len = 1; return &unicode_decompose_lookup[3470];
-    case 0x32AE: *len = 1; return &unicode_decompose_lookup[3471];
-    case 0x32AF: *len = 1; return &unicode_decompose_lookup[3472];
-    case 0x32B0: *len = 1; return &unicode_decompose_lookup[3473];
-    case 0x32B1: *len = 2; return &unicode_decompose_lookup[3474];
-    case 0x32B2: *len = 2; return &unicode_decompose_lookup[3476];
-    case 0x32B3: *len = 2; return &unicode_decompose_lookup[3478];
-    case 0x32B4: *len = 2; return &unicode_decompose_lookup[3480];
-    case 0x32B5: *len = 2; return &unicode_decompose_lookup[3482];
-    case 0x32B6: *len = 2; return &unicode_decompose_lookup[3484];
-    case 0x32B7: *len = 2; return &unicode_decompose_lookup[3486];
-    case 0x32B8: *len = 2; return &unicode_decompose_lookup[3488];
-    case 0x32B9: *len = 2; return &unicode_decompose_lookup[3490];
-    case 0x32BA: *len = 2; return &unicode_decompose_lookup[3492];
-    case 0x32BB: *len = 2; return &unicode_decompose_lookup[3494];
-    case 0x32BC: *len = 2; return &unicode_decompose_lookup[3496];
-    case 0x32BD: *len = 2; return &unicode_decompose_lookup[3498];
-    case 0x32BE: *len = 2; return &unicode_decompose_lookup[3500];
-    case 0x32BF: *len = 2; return &unicode_decompose_lookup[3502];
-    case 0x32C0: *len = 2; return &unicode_decompose_lookup[3504];
-    case 0x32C1: *len = 2; return &unicode_decompose_lookup[3506];
-    case 0x32C2: *len = 2; return &unicode_decompose_lookup[3508];
-    case 0x32C3: *len = 2; return &unicode_decompose_lookup[3510];
-    case 0x32C4: *len = 2; return &unicode_decompose_lookup[3512];
-    case 0x32C5: *len = 2; return &unicode_decompose_lookup[3514];
-    case 0x32C6: *len = 2; return &unicode_decompose_lookup[3516];
-    case 0x32C7: *len = 2; return &unicode_decompose_lookup[3518];
-    case 0x32C8: *len = 2; return &unicode_decompose_lookup[3520];
-    case 0x32C9: *len = 3; return &unicode_decompose_lookup[3522];
-    case 0x32CA: *len = 3; return &unicode_decompose_lookup[3525];
-    case 0x32CB: *len = 3; return &unicode_decompose_lookup[3528];
-    case 0x32CC: *len = 2; return &unicode_decompose_lookup[3531];
-    case 0x32CD: *len = 3; return &unicode_decompose_lookup[3533];
-    case 0x32CE: *len = 2; return &unicode_decompose_lookup[3536];
-    case 0x32CF: *len = 3; return &unicode_decompose_lookup[3538];
-    case 0x32D0: *len = 1; return &unicode_decompose_lookup[3541];
-    case 0x32D1: *len = 1; return &unicode_decompose_lookup[3542];
-    case 0x32D2: *len = 1; return &unicode_decompose_lookup[3543];
-    case 0x32D3: *len = 1; return &unicode_decompose_lookup[3544];
-    case 0x32D4: *len = 1; return &unicode_decompose_lookup[3545];
-    case 0x32D5: *len = 1; return &unicode_decompose_lookup[3546];
-    case 0x32D6: *len = 1; return &unicode_decompose_lookup[3547];
-    case 0x32D7: *len = 1; return &unicode_decompose_lookup[3548];
-    case 0x32D8: *len = 1; return &unicode_decompose_lookup[3549];
-    case 0x32D9: *len = 1; return &unicode_decompose_lookup[3550];
-    case 0x32DA: *len = 1; return &unicode_decompose_lookup[3551];
-    case 0x32DB: *len = 1; return &unicode_decompose_lookup[3552];
-    case 0x32DC: *len = 1; return &unicode_decompose_lookup[3553];
-    case 0x32DD: *len = 1; return &unicode_decompose_lookup[3554];
-    case 0x32DE: *len = 1; return &unicode_decompose_lookup[3555];
-    case 0x32DF: *len = 1; return &unicode_decompose_lookup[3556];
-    case 0x32E0: *len = 1; return &unicode_decompose_lookup[3557];
-    case 0x32E1: *len = 1; return &unicode_decompose_lookup[3558];
-    case 0x32E2: *len = 1; return &unicode_decompose_lookup[3559];
-    case 0x32E3: *len = 1; return &unicode_decompose_lookup[3560];
-    case 0x32E4: *len = 1; return &unicode_decompose_lookup[3561];
-    case 0x32E5: *len = 1; return &unicode_decompose_lookup[3562];
-    case 0x32E6: *len = 1; return &unicode_decompose_lookup[3563];
-    case 0x32E7: *len = 1; return &unicode_decompose_lookup[3564];
-    case 0x32E8: *len = 1; return &unicode_decompose_lookup[3565];
-    case 0x32E9: *len = 1; return &unicode_decompose_lookup[3566];
-    case 0x32EA: *len = 1; return &unicode_decompose_lookup[3567];
-    case 0x32EB: *len = 1; return &unicode_decompose_lookup[3568];
-    case 0x32EC: *len = 1; return &unicode_decompose_lookup[3569];
-    case 0x32ED: *len = 1; return &unicode_decompose_lookup[3570];
-    case 0x32EE: *len = 1; return &unicode_decompose_lookup[3571];
-    case 0x32EF: *len = 1; return &unicode_decompose_lookup[3572];
-    case 0x32F0: *len = 1; return &unicode_decompose_lookup[3573];
-    case 0x32F1: *len = 1; return &unicode_decompose_lookup[3574];
-    case 0x32F2: *len = 1; return &unicode_decompose_lookup[3575];
-    case 0x32F3: *len = 1; return &unicode_decompose_lookup[3576];
-    case 0x32F4: *len = 1; return &unicode_decompose_lookup[3577];
-    case 0x32F5: *len = 1; return &unicode_decompose_lookup[3578];
-    case 0x32F6: *len = 1; return &unicode_decompose_lookup[3579];
-    case 0x32F7: *len = 1; return &unicode_decompose_lookup[3580];
-    case 0x32F8: *len = 1; return &unicode_decompose_lookup[3581];
-    case 0x32F9: *len = 1; return &unicode_decompose_lookup[3582];
-    case 0x32FA: *len = 1; return &unicode_decompose_lookup[3583];
-    case 0x32FB: *len = 1; return &unicode_decompose_lookup[3584];
-    case 0x32FC: *len = 1; return &unicode_decompose_lookup[3585];
-    case 0x32FD: *len = 1; return &unicode_decompose_lookup[3586];
-    case 0x32FE: *len = 1; return &unicode_decompose_lookup[3587];
-    case 0x32FF: *len = 2; return &unicode_decompose_lookup[3588];
-    case 0x3300: *len = 4; return &unicode_decompose_lookup[3590];
-    case 0x3301: *len = 4; return &unicode_decompose_lookup[3594];
-    case 0x3302: *len = 4; return &unicode_decompose_lookup[3598];
-    case 0x3303: *len = 3; return &unicode_decompose_lookup[3602];
-    case 0x3304: *len = 4; return &unicode_decompose_lookup[3605];
-    case 0x3305: *len = 3; return &unicode_decompose_lookup[3609];
-    case 0x3306: *len = 3; return &unicode_decompose_lookup[3612];
-    case 0x3307: *len = 5; return &unicode_decompose_lookup[3615];
-    case 0x3308: *len = 4; return &unicode_decompose_lookup[3620];
-    case 0x3309: *len = 3; return &unicode_decompose_lookup[3624];
-    case 0x330A: *len = 3; return &unicode_decompose_lookup[3627];
-    case 0x330B: *len = 3; return &unicode_decompose_lookup[3630];
-    case 0x330C: *len = 4; return &unicode_decompose_lookup[3633];
-    case 0x330D: *len = 4; return &unicode_decompose_lookup[3637];
-    case 0x330E: *len = 3; return &unicode_decompose_lookup[3641];
-    case 0x330F: *len = 3; return &unicode_decompose_lookup[3644];
-    case 0x3310: *len = 2; return &unicode_decompose_lookup[3647];
-    case 0x3311: *len = 3; return &unicode_decompose_lookup[3649];
-    case 0x3312: *len = 4; return &unicode_decompose_lookup[3652];
-    case 0x3313: *len = 4; return &unicode_decompose_lookup[3656];
-    case 0x3314: *len = 2; return &unicode_decompose_lookup[3660];
-    case 0x3315: *len = 5; return &unicode_decompose_lookup[3662];
-    case 0x3316: *len = 6; return &unicode_decompose_lookup[3667];
-    case 0x3317: *len = 5; return &unicode_decompose_lookup[3673];
-    case 0x3318: *len = 3; return &unicode_decompose_lookup[3678];
-    case 0x3319: *len = 5; return &unicode_decompose_lookup[3681];
-    case 0x331A: *len = 5; return &unicode_decompose_lookup[3686];
-    case 0x331B: *len = 4; return &unicode_decompose_lookup[3691];
-    case 0x331C: *len = 3; return &unicode_decompose_lookup[3695];
-    case 0x331D: *len = 3; return &unicode_decompose_lookup[3698];
-    case 0x331E: *len = 3; return &unicode_decompose_lookup[3701];
-    case 0x331F: *len = 4; return &unicode_decompose_lookup[3704];
-    case 0x3320: *len = 5; return &unicode_decompose_lookup[3708];
-    case 0x3321: *len = 4; return &unicode_decompose_lookup[3713];
-    case 0x3322: *len = 3; return &unicode_decompose_lookup[3717];
-    case 0x3323: *len = 3; return &unicode_decompose_lookup[3720];
-    case 0x3324: *len = 3; return &unicode_decompose_lookup[3723];
-    case 0x3325: *len = 2; return &unicode_decompose_lookup[3726];
-    case 0x3326: *len = 2; return &unicode_decompose_lookup[3728];
-    case 0x3327: *len = 2; return &unicode_decompose_lookup[3730];
-    case 0x3328: *len = 2; return &unicode_decompose_lookup[3732];
-    case 0x3329: *len = 3; return &unicode_decompose_lookup[3734];
-    case 0x332A: *len = 3; return &unicode_decompose_lookup[3737];
-    case 0x332B: *len = 5; return &unicode_decompose_lookup[3740];
-    case 0x332C: *len = 3; return &unicode_decompose_lookup[3745];
-    case 0x332D: *len = 4; return &unicode_decompose_lookup[3748];
-    case 0x332E: *len = 5; return &unicode_decompose_lookup[3752];
-    case 0x332F: *len = 3; return &unicode_decompose_lookup[3757];
-    case 0x3330: *len = 2; return &unicode_decompose_lookup[3760];
-    case 0x3331: *len = 2; return &unicode_decompose_lookup[3762];
-    case 0x3332: *len = 5; return &unicode_decompose_lookup[3764];
-    case 0x3333: *len = 4; return &unicode_decompose_lookup[3769];
-    case 0x3334: *len = 5; return &unicode_decompose_lookup[3773];
-    case 0x3335: *len = 3; return &unicode_decompose_lookup[3778];
-    case 0x3336: *len = 5; return &unicode_decompose_lookup[3781];
-    case 0x3337: *len = 2; return &unicode_decompose_lookup[3786];
-    case 0x3338: *len = 3; return &unicode_decompose_lookup[3788];
-    case 0x3339: *len = 3; return &unicode_decompose_lookup[3791];
-    case 0x333A: *len = 3; return &unicode_decompose_lookup[3794];
-    case 0x333B: *len = 3; return &unicode_decompose_lookup[3797];
-    case 0x333C: *len = 3; return &unicode_decompose_lookup[3800];
-    case 0x333D: *len = 4; return &unicode_decompose_lookup[3803];
-    case 0x333E: *len = 3; return &unicode_decompose_lookup[3807];
-    case 0x333F: *len = 2; return &unicode_decompose_lookup[3810];
-    case 0x3340: *len = 3; return &unicode_decompose_lookup[3812];
-    case 0x3341: *len = 3; return &unicode_decompose_lookup[3815];
-    case 0x3342: *len = 3; return &unicode_decompose_lookup[3818];
-    case 0x3343: *len = 4; return &unicode_decompose_lookup[3821];
-    case 0x3344: *len = 3; return &unicode_decompose_lookup[3825];
-    case 0x3345: *len = 3; return &unicode_decompose_lookup[3828];
-    case 0x3346: *len = 3; return &unicode_decompose_lookup[3831];
-    case 0x3347: *len = 5; return &unicode_decompose_lookup[3834];
-    case 0x3348: *len = 4; return &unicode_decompose_lookup[3839];
-    case 0x3349: *len = 2; return &unicode_decompose_lookup[3843];
-    case 0x334A: *len = 5; return &unicode_decompose_lookup[3845];
-    case 0x334B: *len = 2; return &unicode_decompose_lookup[3850];
-    case 0x334C: *len = 4; return &unicode_decompose_lookup[3852];
-    case 0x334D: *len = 4; return &unicode_decompose_lookup[3856];
-    case 0x334E: *len = 3; return &unicode_decompose_lookup[3860];
-    case 0x334F: *len = 3; return &unicode_decompose_lookup[3863];
-    case 0x3350: *len = 3; return &unicode_decompose_lookup[3866];
-    case 0x3351: *len = 4; return &unicode_decompose_lookup[3869];
-    case 0x3352: *len = 2; return &unicode_decompose_lookup[3873];
-    case 0x3353: *len = 3; return &unicode_decompose_lookup[3875];
-    case 0x3354: *len = 4; return &unicode_decompose_lookup[3878];
-    case 0x3355: *len = 2; return &unicode_decompose_lookup[3882];
-    case 0x3356: *len = 5; return &unicode_decompose_lookup[3884];
-    case 0x3357: *len = 3; return &unicode_decompose_lookup[3889];
-    case 0x3358: *len = 2; return &unicode_decompose_lookup[3892];
-    case 0x3359: *len = 2; return &unicode_decompose_lookup[3894];
-    case 0x335A: *len = 2; return &unicode_decompose_lookup[3896];
-    case 0x335B: *len = 2; return &unicode_decompose_lookup[3898];
-    case 0x335C: *len = 2; return &unicode_decompose_lookup[3900];
-    case 0x335D: *len = 2; return &unicode_decompose_lookup[3902];
-    case 0x335E: *len = 2; return &unicode_decompose_lookup[3904];
-    case 0x335F: *len = 2; return &unicode_decompose_lookup[3906];
-    case 0x3360: *len = 2; return &unicode_decompose_lookup[3908];
-    case 0x3361: *len = 2; return &unicode_decompose_lookup[3910];
-    case 0x3362: *len = 3; return &unicode_decompose_lookup[3912];
-    case 0x3363: *len = 3; return &unicode_decompose_lookup[3915];
-    case 0x3364: *len = 3; return &unicode_decompose_lookup[3918];
-    case 0x3365: *len = 3; return &unicode_decompose_lookup[3921];
-    case 0x3366: *len = 3; return &unicode_decompose_lookup[3924];
-    case 0x3367: *len = 3; return &unicode_decompose_lookup[3927];
-    case 0x3368: *len = 3; return &unicode_decompose_lookup[3930];
-    case 0x3369: *len = 3; return &unicode_decompose_lookup[3933];
-    case 0x336A: *len = 3; return &unicode_decompose_lookup[3936];
-    case 0x336B: *len = 3; return &unicode_decompose_lookup[3939];
-    case 0x336C: *len = 3; return &unicode_decompose_lookup[3942];
-    case 0x336D: *len = 3; return &unicode_decompose_lookup[3945];
-    case 0x336E: *len = 3; return &unicode_decompose_lookup[3948];
-    case 0x336F: *len = 3; return &unicode_decompose_lookup[3951];
-    case 0x3370: *len = 3; return &unicode_decompose_lookup[3954];
-    case 0x3371: *len = 3; return &unicode_decompose_lookup[3957];
-    case 0x3372: *len = 2; return &unicode_decompose_lookup[3960];
-    case 0x3373: *len = 2; return &unicode_decompose_lookup[3962];
-    case 0x3374: *len = 3; return &unicode_decompose_lookup[3964];
-    case 0x3375: *len = 2; return &unicode_decompose_lookup[3967];
-    case 0x3376: *len = 2; return &unicode_decompose_lookup[3969];
-    case 0x3377: *len = 2; return &unicode_decompose_lookup[3971];
-    case 0x3378: *len = 3; return &unicode_decompose_lookup[3973];
-    case 0x3379: *len = 3; return &unicode_decompose_lookup[3976];
-    case 0x337A: *len = 2; return &unicode_decompose_lookup[3979];
-    case 0x337B: *len = 2; return &unicode_decompose_lookup[3981];
-    case 0x337C: *len = 2; return &unicode_decompose_lookup[3983];
-    case 0x337D: *len = 2; return &unicode_decompose_lookup[3985];
-    case 0x337E: *len = 2; return &unicode_decompose_lookup[3987];
-    case 0x337F: *len = 4; return &unicode_decompose_lookup[3989];
-    case 0x3380: *len = 2; return &unicode_decompose_lookup[3993];
-    case 0x3381: *len = 2; return &unicode_decompose_lookup[3995];
-    case 0x3382: *len = 2; return &unicode_decompose_lookup[3997];
-    case 0x3383: *len = 2; return &unicode_decompose_lookup[3999];
-    case 0x3384: *len = 2; return &unicode_decompose_lookup[4001];
-    case 0x3385: *len = 2; return &unicode_decompose_lookup[4003];
-    case 0x3386: *len = 2; return &unicode_decompose_lookup[4005];
-    case 0x3387: *len = 2; return &unicode_decompose_lookup[4007];
-    case 0x3388: *len = 3; return &unicode_decompose_lookup[4009];
-    case 0x3389: *len = 4; return &unicode_decompose_lookup[4012];
-    case 0x338A: *len = 2; return &unicode_decompose_lookup[4016];
-    case 0x338B: *len = 2; return &unicode_decompose_lookup[4018];
-    case 0x338C: *len = 2; return &unicode_decompose_lookup[4020];
-    case 0x338D: *len = 2; return &unicode_decompose_lookup[4022];
-    case 0x338E: *len = 2; return &unicode_decompose_lookup[4024];
-    case 0x338F: *len = 2; return &unicode_decompose_lookup[4026];
-    case 0x3390: *len = 2; return &unicode_decompose_lookup[4028];
-    case 0x3391: *len = 3; return &unicode_decompose_lookup[4030];
-    case 0x3392: *len = 3; return &unicode_decompose_lookup[4033];
-    case 0x3393: *len = 3; return &unicode_decompose_lookup[4036];
-    case 0x3394: *len = 3; return &unicode_decompose_lookup[4039];
-    case 0x3395: *len = 2; return &unicode_decompose_lookup[4042];
-    case 0x3396: *len = 2; return &unicode_decompose_lookup[4044];
-    case 0x3397: *len = 2; return &unicode_decompose_lookup[4046];
-    case 0x3398: *len = 2; return &unicode_decompose_lookup[4048];
-    case 0x3399: *len = 2; return &unicode_decompose_lookup[4050];
-    case 0x339A: *len = 2; return &unicode_decompose_lookup[4052];
-    case 0x339B: *len = 2; return &unicode_decompose_lookup[4054];
-    case 0x339C: *len = 2; return &unicode_decompose_lookup[4056];
-    case 0x339D: *len = 2; return &unicode_decompose_lookup[4058];
-    case 0x339E: *len = 2; return &unicode_decompose_lookup[4060];
-    case 0x339F: *len = 3; return &unicode_decompose_lookup[4062];
-    case 0x33A0: *len = 3; return &unicode_decompose_lookup[4065];
-    case 0x33A1: *len = 2; return &unicode_decompose_lookup[4068];
-    case 0x33A2: *len = 3; return &unicode_decompose_lookup[4070];
-    case 0x33A3: *len = 3; return &unicode_decompose_lookup[4073];
-    case 0x33A4: *len = 3; return &unicode_decompose_lookup[4076];
-    case 0x33A5: *len = 2; return &unicode_decompose_lookup[4079];
-    case 0x33A6: *len = 3; return &unicode_decompose_lookup[4081];
-    case 0x33A7: *len = 3; return &unicode_decompose_lookup[4084];
-    case 0x33A8: *len = 4; return &unicode_decompose_lookup[4087];
-    case 0x33A9: *len = 2; return &unicode_decompose_lookup[4091];
-    case 0x33AA: *len = 3; return &unicode_decompose_lookup[4093];
-    case 0x33AB: *len = 3; return &unicode_decompose_lookup[4096];
-    case 0x33AC: *len = 3; return &unicode_decompose_lookup[4099];
-    case 0x33AD: *len = 3; return &unicode_decompose_lookup[4102];
-    case 0x33AE: *len = 5; return &unicode_decompose_lookup[4105];
-    case 0x33AF: *len = 6; return &unicode_decompose_lookup[4110];
-    case 0x33B0: *len = 2; return &unicode_decompose_lookup[4116];
-    case 0x33B1: *len = 2; return &unicode_decompose_lookup[4118];
-    case 0x33B2: *len = 2; return &unicode_decompose_lookup[4120];
-    case 0x33B3: *len = 2; return &unicode_decompose_lookup[4122];
-    case 0x33B4: *len = 2; return &unicode_decompose_lookup[4124];
-    case 0x33B5: *len = 2; return &unicode_decompose_lookup[4126];
-    case 0x33B6: *len = 2; return &unicode_decompose_lookup[4128];
-    case 0x33B7: *len = 2; return &unicode_decompose_lookup[4130];
-    case 0x33B8: *len = 2; return &unicode_decompose_lookup[4132];
-    case 0x33B9: *len = 2; return &unicode_decompose_lookup[4134];
-    case 0x33BA: *len = 2; return &unicode_decompose_lookup[4136];
-    case 0x33BB: *len = 2; return &unicode_decompose_lookup[4138];
-    case 0x33BC: *len = 2; return &unicode_decompose_lookup[4140];
-    case 0x33BD: *len = 2; return &unicode_decompose_lookup[4142];
-    case 0x33BE: *len = 2; return &unicode_decompose_lookup[4144];
-    case 0x33BF: *len = 2; return &unicode_decompose_lookup[4146];
-    case 0x33C0: *len = 2; return &unicode_decompose_lookup[4148];
-    case 0x33C1: *len = 2; return &unicode_decompose_lookup[4150];
-    case 0x33C2: *len = 4; return &unicode_decompose_lookup[4152];
-    case 0x33C3: *len = 2; return &unicode_decompose_lookup[4156];
-    case 0x33C4: *len = 2; return &unicode_decompose_lookup[4158];
-    case 0x33C5: *len = 2; return &unicode_decompose_lookup[4160];
-    case 0x33C6: *len = 4; return &unicode_decompose_lookup[4162];
-    case 0x33C7: *len = 3; return &unicode_decompose_lookup[4166];
-    case 0x33C8: *len = 2; return &unicode_decompose_lookup[4169];
-    case 0x33C9: *len = 2; return &unicode_decompose_lookup[4171];
-    case 0x33CA: *len = 2; return &unicode_decompose_lookup[4173];
-    case 0x33CB: *len = 2; return &unicode_decompose_lookup[4175];
-    case 0x33CC: *len = 2; return &unicode_decompose_lookup[4177];
-    case 0x33CD: *len = 2; return &unicode_decompose_lookup[4179];
-    case 0x33CE: *len = 2; return &unicode_decompose_lookup[4181];
-    case 0x33CF: *len = 2; return &unicode_decompose_lookup[4183];
-    case 0x33D0: *len = 2; return &unicode_decompose_lookup[4185];
-    case 0x33D1: *len = 2; return &unicode_decompose_lookup[4187];
-    case 0x33D2: *len = 3; return &unicode_decompose_lookup[4189];
-    case 0x33D3: *len = 2; return &unicode_decompose_lookup[4192];
-    case 0x33D4: *len = 2; return &unicode_decompose_lookup[4194];
-    case 0x33D5: *len = 3; return &unicode_decompose_lookup[4196];
-    case 0x33D6: *len = 3; return &unicode_decompose_lookup[4199];
-    case 0x33D7: *len = 2; return &unicode_decompose_lookup[4202];
-    case 0x33D8: *len = 4; return &unicode_decompose_lookup[4204];
-    case 0x33D9: *len = 3; return &unicode_decompose_lookup[4208];
-    case 0x33DA: *len = 2; return &unicode_decompose_lookup[4211];
-    case 0x33DB: *len = 2; return &unicode_decompose_lookup[4213];
-    case 0x33DC: *len = 2; return &unicode_decompose_lookup[4215];
-    case 0x33DD: *len = 2; return &unicode_decompose_lookup[4217];
-    case 0x33DE: *len = 3; return &unicode_decompose_lookup[4219];
-    case 0x33DF: *len = 3; return &unicode_decompose_lookup[4222];
-    case 0x33E0: *len = 2; return &unicode_decompose_lookup[4225];
-    case 0x33E1: *len = 2; return &unicode_decompose_lookup[4227];
-    case 0x33E2: *len = 2; return &unicode_decompose_lookup[4229];
-    case 0x33E3: *len = 2; return &unicode_decompose_lookup[4231];
-    case 0x33E4: *len = 2; return &unicode_decompose_lookup[4233];
-    case 0x33E5: *len = 2; return &unicode_decompose_lookup[4235];
-    case 0x33E6: *len = 2; return &unicode_decompose_lookup[4237];
-    case 0x33E7: *len = 2; return &unicode_decompose_lookup[4239];
-    case 0x33E8: *len = 2; return &unicode_decompose_lookup[4241];
-    case 0x33E9: *len = 3; return &unicode_decompose_lookup[4243];
-    case 0x33EA: *len = 3; return &unicode_decompose_lookup[4246];
-    case 0x33EB: *len = 3; return &unicode_decompose_lookup[4249];
-    case 0x33EC: *len = 3; return &unicode_decompose_lookup[4252];
-    case 0x33ED: *len = 3; return &unicode_decompose_lookup[4255];
-    case 0x33EE: *len = 3; return &unicode_decompose_lookup[4258];
-    case 0x33EF: *len = 3; return &unicode_decompose_lookup[4261];
-    case 0x33F0: *len = 3; return &unicode_decompose_lookup[4264];
-    case 0x33F1: *len = 3; return &unicode_decompose_lookup[4267];
-    case 0x33F2: *len = 3; return &unicode_decompose_lookup[4270];
-    case 0x33F3: *len = 3; return &unicode_decompose_lookup[4273];
-    case 0x33F4: *len = 3; return &unicode_decompose_lookup[4276];
-    case 0x33F5: *len = 3; return &unicode_decompose_lookup[4279];
-    case 0x33F6: *len = 3; return &unicode_decompose_lookup[4282];
-    case 0x33F7: *len = 3; return &unicode_decompose_lookup[4285];
-    case 0x33F8: *len = 3; return &unicode_decompose_lookup[4288];
-    case 0x33F9: *len = 3; return &unicode_decompose_lookup[4291];
-    case 0x33FA: *len = 3; return &unicode_decompose_lookup[4294];
-    case 0x33FB: *len = 3; return &unicode_decompose_lookup[4297];
-    case 0x33FC: *len = 3; return &unicode_decompose_lookup[4300];
-    case 0x33FD: *len = 3; return &unicode_decompose_lookup[4303];
-    case 0x33FE: *len = 3; return &unicode_decompose_lookup[4306];
-    case 0x33FF: *len = 3; return &unicode_decompose_lookup[4309];
-    case 0xA69C: *len = 1; return &unicode_decompose_lookup[4312];
-    case 0xA69D: *len = 1; return &unicode_decompose_lookup[4313];
-    case 0xA770: *len = 1; return &unicode_decompose_lookup[4314];
-    case 0xA7F8: *len = 1; return &unicode_decompose_lookup[4315];
-    case 0xA7F9: *len = 1; return &unicode_decompose_lookup[4316];
-    case 0xAB5C: *len = 1; return &unicode_decompose_lookup[4317];
-    case 0xAB5D: *len = 1; return &unicode_decompose_lookup[4318];
-    case 0xAB5E: *len = 1; return &unicode_decompose_lookup[4319];
-    case 0xAB5F: *len = 1; return &unicode_decompose_lookup[4320];
-    case 0xFB00: *len = 2; return &unicode_decompose_lookup[4781];
-    case 0xFB01: *len = 2; return &unicode_decompose_lookup[4783];
-    case 0xFB02: *len = 2; return &unicode_decompose_lookup[4785];
-    case 0xFB03: *len = 3; return &unicode_decompose_lookup[4787];
-    case 0xFB04: *len = 3; return &unicode_decompose_lookup[4790];
-    case 0xFB05: *len = 2; return &unicode_decompose_lookup[4793];
-    case 0xFB06: *len = 2; return &unicode_decompose_lookup[4795];
-    case 0xFB13: *len = 2; return &unicode_decompose_lookup[4797];
-    case 0xFB14: *len = 2; return &unicode_decompose_lookup[4799];
-    case 0xFB15: *len = 2; return &unicode_decompose_lookup[4801];
-    case 0xFB16: *len = 2; return &unicode_decompose_lookup[4803];
-    case 0xFB17: *len = 2; return &unicode_decompose_lookup[4805];
-    case 0xFB20: *len = 1; return &unicode_decompose_lookup[4811];
-    case 0xFB21: *len = 1; return &unicode_decompose_lookup[4812];
-    case 0xFB22: *len = 1; return &unicode_decompose_lookup[4813];
-    case 0xFB23: *len = 1; return &unicode_decompose_lookup[4814];
-    case 0xFB24: *len = 1; return &unicode_decompose_lookup[4815];
-    case 0xFB25: *len = 1; return &unicode_decompose_lookup[4816];
-    case 0xFB26: *len = 1; return &unicode_decompose_lookup[4817];
-    case 0xFB27: *len = 1; return &unicode_decompose_lookup[4818];
-    case 0xFB28: *len = 1; return &unicode_decompose_lookup[4819];
-    case 0xFB29: *len = 1; return &unicode_decompose_lookup[4820];
-    case 0xFB4F: *len = 2; return &unicode_decompose_lookup[4885];
-    case 0xFB50: *len = 1; return &unicode_decompose_lookup[4887];
-    case 0xFB51: *len = 1; return &unicode_decompose_lookup[4888];
-    case 0xFB52: *len = 1; return &unicode_decompose_lookup[4889];
-    case 0xFB53: *len = 1; return &unicode_decompose_lookup[4890];
-    case 0xFB54: *len = 1; return &unicode_decompose_lookup[4891];
-    case 0xFB55: *len = 1; return &unicode_decompose_lookup[4892];
-    case 0xFB56: *len = 1; return &unicode_decompose_lookup[4893];
-    case 0xFB57: *len = 1; return &unicode_decompose_lookup[4894];
-    case 0xFB58: *len = 1; return &unicode_decompose_lookup[4895];
-    case 0xFB59: *len = 1; return &unicode_decompose_lookup[4896];
-    case 0xFB5A: *len = 1; return &unicode_decompose_lookup[4897];
-    case 0xFB5B: *len = 1; return &unicode_decompose_lookup[4898];
-    case 0xFB5C: *len = 1; return &unicode_decompose_lookup[4899];
-    case 0xFB5D: *len = 1; return &unicode_decompose_lookup[4900];
-    case 0xFB5E: *len = 1; return &unicode_decompose_lookup[4901];
-    case 0xFB5F: *len = 1; return &unicode_decompose_lookup[4902];
-    case 0xFB60: *len = 1; return &unicode_decompose_lookup[4903];
-    case 0xFB61: *len = 1; return &unicode_decompose_lookup[4904];
-    case 0xFB62: *len = 1; return &unicode_decompose_lookup[4905];
-    case 0xFB63: *len = 1; return &unicode_decompose_lookup[4906];
-    case 0xFB64: *len = 1; return &unicode_decompose_lookup[4907];
-    case 0xFB65: *len = 1; return &unicode_decompose_lookup[4908];
-    case 0xFB66: *len = 1; return &unicode_decompose_lookup[4909];
-    case 0xFB67: *len = 1; return &unicode_decompose_lookup[4910];
-    case 0xFB68: *len = 1; return &unicode_decompose_lookup[4911];
-    case 0xFB69: *len = 1; return &unicode_decompose_lookup[4912];
-    case 0xFB6A: *len = 1; return &unicode_decompose_lookup[4913];
-    case 0xFB6B: *len = 1; return &unicode_decompose_lookup[4914];
-    case 0xFB6C: *len = 1; return &unicode_decompose_lookup[4915];
-    case 0xFB6D: *len = 1; return &unicode_decompose_lookup[4916];
-    case 0xFB6E: *len = 1; return &unicode_decompose_lookup[4917];
-    case 0xFB6F: *len = 1; return &unicode_decompose_lookup[4918];
-    case 0xFB70: *len = 1; return &unicode_decompose_lookup[4919];
-    case 0xFB71: *len = 1; return &unicode_decompose_lookup[4920];
-    case 0xFB72: *len = 1; return &unicode_decompose_lookup[4921];
-    case 0xFB73: *len = 1; return &unicode_decompose_lookup[4922];
-    case 0xFB74: *len = 1; return &unicode_decompose_lookup[4923];
-    case 0xFB75: *len = 1; return &unicode_decompose_lookup[4924];
-    case 0xFB76: *len = 1; return &unicode_decompose_lookup[4925];
-    case 0xFB77: *len = 1; return &unicode_decompose_lookup[4926];
-    case 0xFB78: *len = 1; return &unicode_decompose_lookup[4927];
-    case 0xFB79: *len = 1; return &unicode_decompose_lookup[4928];
-    case 0xFB7A: *len = 1; return &unicode_decompose_lookup[4929];
-    case 0xFB7B: *len = 1; return &unicode_decompose_lookup[4930];
-    case 0xFB7C: *len = 1; return &unicode_decompose_lookup[4931];
-    case 0xFB7D: *len = 1; return &unicode_decompose_lookup[4932];
-    case 0xFB7E: *len = 1; return &unicode_decompose_lookup[4933];
-    case 0xFB7F: *len = 1; return &unicode_decompose_lookup[4934];
-    case 0xFB80: *len = 1; return &unicode_decompose_lookup[4935];
-    case 0xFB81: *len = 1; return &unicode_decompose_lookup[4936];
-    case 0xFB82: *len = 1; return &unicode_decompose_lookup[4937];
-    case 0xFB83: *len = 1; return &unicode_decompose_lookup[4938];
-    case 0xFB84: *len = 1; return &unicode_decompose_lookup[4939];
-    case 0xFB85: *len = 1; return &unicode_decompose_lookup[4940];
-    case 0xFB86: *len = 1; return &unicode_decompose_lookup[4941];
-    case 0xFB87: *len = 1; return &unicode_decompose_lookup[4942];
-    case 0xFB88: *len = 1; return &unicode_decompose_lookup[4943];
-    case 0xFB89: *len = 1; return &unicode_decompose_lookup[4944];
-    case 0xFB8A: *len = 1; return &unicode_decompose_lookup[4945];
-    case 0xFB8B: *len = 1; return &unicode_decompose_lookup[4946];
-    case 0xFB8C: *len = 1; return &unicode_decompose_lookup[4947];
-    case 0xFB8D: *len = 1; return &unicode_decompose_lookup[4948];
-    case 0xFB8E: *len = 1; return &unicode_decompose_lookup[4949];
-    case 0xFB8F: *len = 1; return &unicode_decompose_lookup[4950];
-    case 0xFB90: *len = 1; return &unicode_decompose_lookup[4951];
-    case 0xFB91: *len = 1; return &unicode_decompose_lookup[4952];
-    case 0xFB92: *len = 1; return &unicode_decompose_lookup[4953];
-    case 0xFB93: *len = 1; return &unicode_decompose_lookup[4954];
-    case 0xFB94: *len = 1; return &unicode_decompose_lookup[4955];
-    case 0xFB95: *len = 1; return &unicode_decompose_lookup[4956];
-    case 0xFB96: *len = 1; return &unicode_decompose_lookup[4957];
-    case 0xFB97: *len = 1; return &unicode_decompose_lookup[4958];
-    case 0xFB98: *len = 1; return &unicode_decompose_lookup[4959];
-    case 0xFB99: *len = 1; return &unicode_decompose_lookup[4960];
-    case 0xFB9A: *len = 1; return &unicode_decompose_lookup[4961];
-    case 0xFB9B: *len = 1; return &unicode_decompose_lookup[4962];
-    case 0xFB9C: *len = 1; return &unicode_decompose_lookup[4963];
-    case 0xFB9D: *len = 1; return &unicode_decompose_lookup[4964];
-    case 0xFB9E: *len = 1; return &unicode_decompose_lookup[4965];
-    case 0xFB9F: *len = 1; return &unicode_decompose_lookup[4966];
-    case 0xFBA0: *len = 1; return &unicode_decompose_lookup[4967];
-    case 0xFBA1: *len = 1; return &unicode_decompose_lookup[4968];
-    case 0xFBA2: *len = 1; return &unicode_decompose_lookup[4969];
-    case 0xFBA3: *len = 1; return &unicode_decompose_lookup[4970];
-    case 0xFBA4: *len = 1; return &unicode_decompose_lookup[4971];
-    case 0xFBA5: *len = 1; return &unicode_decompose_lookup[4972];
-    case 0xFBA6: *len = 1; return &unicode_decompose_lookup[4973];
-    case 0xFBA7: *len = 1; return &unicode_decompose_lookup[4974];
-    case 0xFBA8: *len = 1; return &unicode_decompose_lookup[4975];
-    case 0xFBA9: *len = 1; return &unicode_decompose_lookup[4976];
-    case 0xFBAA: *len = 1; return &unicode_decompose_lookup[4977];
-    case 0xFBAB: *len = 1; return &unicode_decompose_lookup[4978];
-    case 0xFBAC: *len = 1; return &unicode_decompose_lookup[4979];
-    case 0xFBAD: *len = 1; return &unicode_decompose_lookup[4980];
-    case 0xFBAE: *len = 1; return &unicode_decompose_lookup[4981];
-    case 0xFBAF: *len = 1; return &unicode_decompose_lookup[4982];
-    case 0xFBB0: *len = 1; return &unicode_decompose_lookup[4983];
-    case 0xFBB1: *len = 1; return &unicode_decompose_lookup[4984];
-    case 0xFBD3: *len = 1; return &unicode_decompose_lookup[4985];
-    case 0xFBD4: *len = 1; return &unicode_decompose_lookup[4986];
-    case 0xFBD5: *len = 1; return &unicode_decompose_lookup[4987];
-    case 0xFBD6: *len = 1; return &unicode_decompose_lookup[4988];
-    case 0xFBD7: *len = 1; return &unicode_decompose_lookup[4989];
-    case 0xFBD8: *len = 1; return &unicode_decompose_lookup[4990];
-    case 0xFBD9: *len = 1; return &unicode_decompose_lookup[4991];
-    case 0xFBDA: *len = 1; return &unicode_decompose_lookup[4992];
-    case 0xFBDB: *len = 1; return &unicode_decompose_lookup[4993];
-    case 0xFBDC: *len = 1; return &unicode_decompose_lookup[4994];
-    case 0xFBDD: *len = 1; return &unicode_decompose_lookup[4995];
-    case 0xFBDE: *len = 1; return &unicode_decompose_lookup[4996];
-    case 0xFBDF: *len = 1; return &unicode_decompose_lookup[4997];
-    case 0xFBE0: *len = 1; return &unicode_decompose_lookup[4998];
-    case 0xFBE1: *len = 1; return &unicode_decompose_lookup[4999];
-    case 0xFBE2: *len = 1; return &unicode_decompose_lookup[5000];
-    case 0xFBE3: *len = 1; return &unicode_decompose_lookup[5001];
-    case 0xFBE4: *len = 1; return &unicode_decompose_lookup[5002];
-    case 0xFBE5: *len = 1; return &unicode_decompose_lookup[5003];
-    case 0xFBE6: *len = 1; return &unicode_decompose_lookup[5004];
-    case 0xFBE7: *len = 1; return &unicode_decompose_lookup[5005];
-    case 0xFBE8: *len = 1; return &unicode_decompose_lookup[5006];
-    case 0xFBE9: *len = 1; return &unicode_decompose_lookup[5007];
-    case 0xFBEA: *len = 2; return &unicode_decompose_lookup[5008];
-    case 0xFBEB: *len = 2; return &unicode_decompose_lookup[5010];
-    case 0xFBEC: *len = 2; return &unicode_decompose_lookup[5012];
-    case 0xFBED: *len = 2; return &unicode_decompose_lookup[5014];
-    case 0xFBEE: *len = 2; return &unicode_decompose_lookup[5016];
-    case 0xFBEF: *len = 2; return &unicode_decompose_lookup[5018];
-    case 0xFBF0: *len = 2; return &unicode_decompose_lookup[5020];
-    case 0xFBF1: *len = 2; return &unicode_decompose_lookup[5022];
-    case 0xFBF2: *len = 2; return &unicode_decompose_lookup[5024];
-    case 0xFBF3: *len = 2; return &unicode_decompose_lookup[5026];
-    case 0xFBF4: *len = 2; return &unicode_decompose_lookup[5028];
-    case 0xFBF5: *len = 2; return &unicode_decompose_lookup[5030];
-    case 0xFBF6: *len = 2; return &unicode_decompose_lookup[5032];
-    case 0xFBF7: *len = 2; return &unicode_decompose_lookup[5034];
-    case 0xFBF8: *len = 2; return &unicode_decompose_lookup[5036];
-    case 0xFBF9: *len = 2; return &unicode_decompose_lookup[5038];
-    case 0xFBFA: *len = 2; return &unicode_decompose_lookup[5040];
-    case 0xFBFB: *len = 2; return &unicode_decompose_lookup[5042];
-    case 0xFBFC: *len = 1; return &unicode_decompose_lookup[5044];
-    case 0xFBFD: *len = 1; return &unicode_decompose_lookup[5045];
-    case 0xFBFE: *len = 1; return &unicode_decompose_lookup[5046];
-    case 0xFBFF: *len = 1; return &unicode_decompose_lookup[5047];
-    case 0xFC00: *len = 2; return &unicode_decompose_lookup[5048];
-    case 0xFC01: *len = 2; return &unicode_decompose_lookup[5050];
-    case 0xFC02: *len = 2; return &unicode_decompose_lookup[5052];
-    case 0xFC03: *len = 2; return &unicode_decompose_lookup[5054];
-    case 0xFC04: *len = 2; return &unicode_decompose_lookup[5056];
-    case 0xFC05: *len = 2; return &unicode_decompose_lookup[5058];
-    case 0xFC06: *len = 2; return &unicode_decompose_lookup[5060];
-    case 0xFC07: *len = 2; return &unicode_decompose_lookup[5062];
-    case 0xFC08: *len = 2; return &unicode_decompose_lookup[5064];
-    case 0xFC09: *len = 2; return &unicode_decompose_lookup[5066];
-    case 0xFC0A: *len = 2; return &unicode_decompose_lookup[5068];
-    case 0xFC0B: *len = 2; return &unicode_decompose_lookup[5070];
-    case 0xFC0C: *len = 2; return &unicode_decompose_lookup[5072];
-    case 0xFC0D: *len = 2; return &unicode_decompose_lookup[5074];
-    case 0xFC0E: *len = 2; return &unicode_decompose_lookup[5076];
-    case 0xFC0F: *len = 2; return &unicode_decompose_lookup[5078];
-    case 0xFC10: *len = 2; return &unicode_decompose_lookup[5080];
-    case 0xFC11: *len = 2; return &unicode_decompose_lookup[5082];
-    case 0xFC12: *len = 2; return &unicode_decompose_lookup[5084];
-    case 0xFC13: *len = 2; return &unicode_decompose_lookup[5086];
-    case 0xFC14: *len = 2; return &unicode_decompose_lookup[5088];
-    case 0xFC15: *len = 2; return &unicode_decompose_lookup[5090];
-    case 0xFC16: *len = 2; return &unicode_decompose_lookup[5092];
-    case 0xFC17: *len = 2; return &unicode_decompose_lookup[5094];
-    case 0xFC18: *len = 2; return &unicode_decompose_lookup[5096];
-    case 0xFC19: *len = 2; return &unicode_decompose_lookup[5098];
-    case 0xFC1A: *len = 2; return &unicode_decompose_lookup[5100];
-    case 0xFC1B: *len = 2; return &unicode_decompose_lookup[5102];
-    case 0xFC1C: *len = 2; return &unicode_decompose_lookup[5104];
-    case 0xFC1D: *len = 2; return &unicode_decompose_lookup[5106];
-    case 0xFC1E: *len = 2; return &unicode_decompose_lookup[5108];
-    case 0xFC1F: *len = 2; return &unicode_decompose_lookup[5110];
-    case 0xFC20: *len = 2; return &unicode_decompose_lookup[5112];
-    case 0xFC21: *len = 2; return &unicode_decompose_lookup[5114];
-    case 0xFC22: *len = 2; return &unicode_decompose_lookup[5116];
-    case 0xFC23: *len = 2; return &unicode_decompose_lookup[5118];
-    case 0xFC24: *len = 2; return &unicode_decompose_lookup[5120];
-    case 0xFC25: *len = 2; return &unicode_decompose_lookup[5122];
-    case 0xFC26: *len = 2; return &unicode_decompose_lookup[5124];
-    case 0xFC27: *len = 2; return &unicode_decompose_lookup[5126];
-    case 0xFC28: *len = 2; return &unicode_decompose_lookup[5128];
-    case 0xFC29: *len = 2; return &unicode_decompose_lookup[5130];
-    case 0xFC2A: *len = 2; return &unicode_decompose_lookup[5132];
-    case 0xFC2B: *len = 2; return &unicode_decompose_lookup[5134];
-    case 0xFC2C: *len = 2; return &unicode_decompose_lookup[5136];
-    case 0xFC2D: *len = 2; return &unicode_decompose_lookup[5138];
-    case 0xFC2E: *len = 2; return &unicode_decompose_lookup[5140];
-    case 0xFC2F: *len = 2; return &unicode_decompose_lookup[5142];
-    case 0xFC30: *len = 2; return &unicode_decompose_lookup[5144];
-    case 0xFC31: *len = 2; return &unicode_decompose_lookup[5146];
-    case 0xFC32: *len = 2; return &unicode_decompose_lookup[5148];
-    case 0xFC33: *len = 2; return &unicode_decompose_lookup[5150];
-    case 0xFC34: *len = 2; return &unicode_decompose_lookup[5152];
-    case 0xFC35: *len = 2; return &unicode_decompose_lookup[5154];
-    case 0xFC36: *len = 2; return &unicode_decompose_lookup[5156];
-    case 0xFC37: *len = 2; return &unicode_decompose_lookup[5158];
-    case 0xFC38: *len = 2; return &unicode_decompose_lookup[5160];
-    case 0xFC39: *len = 2; return &unicode_decompose_lookup[5162];
-    case 0xFC3A: *len = 2; return &unicode_decompose_lookup[5164];
-    case 0xFC3B: *len = 2; return &unicode_decompose_lookup[5166];
-    case 0xFC3C: *len = 2; return &unicode_decompose_lookup[5168];
-    case 0xFC3D: *len = 2; return &unicode_decompose_lookup[5170];
-    case 0xFC3E: *len = 2; return &unicode_decompose_lookup[5172];
-    case 0xFC3F: *len = 2; return &unicode_decompose_lookup[5174];
-    case 0xFC40: *len = 2; return &unicode_decompose_lookup[5176];
-    case 0xFC41: *len = 2; return &unicode_decompose_lookup[5178];
-    case 0xFC42: *len = 2; return &unicode_decompose_lookup[5180];
-    case 0xFC43: *len = 2; return &unicode_decompose_lookup[5182];
-    case 0xFC44: *len = 2; return &unicode_decompose_lookup[5184];
-    case 0xFC45: *len = 2; return &unicode_decompose_lookup[5186];
-    case 0xFC46: *len = 2; return &unicode_decompose_lookup[5188];
-    case 0xFC47: *len = 2; return &unicode_decompose_lookup[5190];
-    case 0xFC48: *len = 2; return &unicode_decompose_lookup[5192];
-    case 0xFC49: *len = 2; return &unicode_decompose_lookup[5194];
-    case 0xFC4A: *len = 2; return &unicode_decompose_lookup[5196];
-    case 0xFC4B: *len = 2; return &unicode_decompose_lookup[5198];
-    case 0xFC4C: *len = 2; return &unicode_decompose_lookup[5200];
-    case 0xFC4D: *len = 2; return &unicode_decompose_lookup[5202];
-    case 0xFC4E: *len = 2; return &unicode_decompose_lookup[5204];
-    case 0xFC4F: *len = 2; return &unicode_decompose_lookup[5206];
-    case 0xFC50: *len = 2; return &unicode_decompose_lookup[5208];
-    case 0xFC51: *len = 2; return &unicode_decompose_lookup[5210];
-    case 0xFC52: *len = 2; return &unicode_decompose_lookup[5212];
-    case 0xFC53: *len = 2; return &unicode_decompose_lookup[5214];
-    case 0xFC54: *len = 2; return &unicode_decompose_lookup[5216];
-    case 0xFC55: *len = 2; return &unicode_decompose_lookup[5218];
-    case 0xFC56: *len = 2; return &unicode_decompose_lookup[5220];
-    case 0xFC57: *len = 2; return &unicode_decompose_lookup[5222];
-    case 0xFC58: *len = 2; return &unicode_decompose_lookup[5224];
-    case 0xFC59: *len = 2; return &unicode_decompose_lookup[5226];
-    case 0xFC5A: *len = 2; return &unicode_decompose_lookup[5228];
-    case 0xFC5B: *len = 2; return &unicode_decompose_lookup[5230];
-    case 0xFC5C: *len = 2; return &unicode_decompose_lookup[5232];
-    case 0xFC5D: *len = 2; return &unicode_decompose_lookup[5234];
-    case 0xFC5E: *len = 3; return &unicode_decompose_lookup[5236];
-    case 0xFC5F: *len = 3; return &unicode_decompose_lookup[5239];
-    case 0xFC60: *len = 3; return &unicode_decompose_lookup[5242];
-    case 0xFC61: *len = 3; return &unicode_decompose_lookup[5245];
-    case 0xFC62: *len = 3; return &unicode_decompose_lookup[5248];
-    case 0xFC63: *len = 3; return &unicode_decompose_lookup[5251];
-    case 0xFC64: *len = 2; return &unicode_decompose_lookup[5254];
-    case 0xFC65: *len = 2; return &unicode_decompose_lookup[5256];
-    case 0xFC66: *len = 2; return &unicode_decompose_lookup[5258];
-    case 0xFC67: *len = 2; return &unicode_decompose_lookup[5260];
-    case 0xFC68: *len = 2; return &unicode_decompose_lookup[5262];
-    case 0xFC69: *len = 2; return &unicode_decompose_lookup[5264];
-    case 0xFC6A: *len = 2; return &unicode_decompose_lookup[5266];
-    case 0xFC6B: *len = 2; return &unicode_decompose_lookup[5268];
-    case 0xFC6C: *len = 2; return &unicode_decompose_lookup[5270];
-    case 0xFC6D: *len = 2; return &unicode_decompose_lookup[5272];
-    case 0xFC6E: *len = 2; return &unicode_decompose_lookup[5274];
-    case 0xFC6F: *len = 2; return &unicode_decompose_lookup[5276];
-    case 0xFC70: *len = 2; return &unicode_decompose_lookup[5278];
-    case 0xFC71: *len = 2; return &unicode_decompose_lookup[5280];
-    case 0xFC72: *len = 2; return &unicode_decompose_lookup[5282];
-    case 0xFC73: *len = 2; return &unicode_decompose_lookup[5284];
-    case 0xFC74: *len = 2; return &unicode_decompose_lookup[5286];
-    case 0xFC75: *len = 2; return &unicode_decompose_lookup[5288];
-    case 0xFC76: *len = 2; return &unicode_decompose_lookup[5290];
-    case 0xFC77: *len = 2; return &unicode_decompose_lookup[5292];
-    case 0xFC78: *len = 2; return &unicode_decompose_lookup[5294];
-    case 0xFC79: *len = 2; return &unicode_decompose_lookup[5296];
-    case 0xFC7A: *len = 2; return &unicode_decompose_lookup[5298];
-    case 0xFC7B: *len = 2; return &unicode_decompose_lookup[5300];
-    case 0xFC7C: *len = 2; return &unicode_decompose_lookup[5302];
-    case 0xFC7D: *len = 2; return &unicode_decompose_lookup[5304];
-    case 0xFC7E: *len = 2; return &unicode_decompose_lookup[5306];
-    case 0xFC7F: *len = 2; return &unicode_decompose_lookup[5308];
-    case 0xFC80: *len = 2; return &unicode_decompose_lookup[5310];
-    case 0xFC81: *len = 2; return &unicode_decompose_lookup[5312];
-    case 0xFC82: *len = 2; return &unicode_decompose_lookup[5314];
-    case 0xFC83: *len = 2; return &unicode_decompose_lookup[5316];
-    case 0xFC84: *len = 2; return &unicode_decompose_lookup[5318];
-    case 0xFC85: *len = 2; return &unicode_decompose_lookup[5320];
-    case 0xFC86: *len = 2; return &unicode_decompose_lookup[5322];
-    case 0xFC87: *len = 2; return &unicode_decompose_lookup[5324];
-    case 0xFC88: *len = 2; return &unicode_decompose_lookup[5326];
-    case 0xFC89: *len = 2; return &unicode_decompose_lookup[5328];
-    case 0xFC8A: *len = 2; return &unicode_decompose_lookup[5330];
-    case 0xFC8B: *len = 2; return &unicode_decompose_lookup[5332];
-    case 0xFC8C: *len = 2; return &unicode_decompose_lookup[5334];
-    case 0xFC8D: *len = 2; return &unicode_decompose_lookup[5336];
-    case 0xFC8E: *len = 2; return &unicode_decompose_lookup[5338];
-    case 0xFC8F: *len = 2; return &unicode_decompose_lookup[5340];
-    case 0xFC90: *len = 2; return &unicode_decompose_lookup[5342];
-    case 0xFC91: *len = 2; return &unicode_decompose_lookup[5344];
-    case 0xFC92: *len = 2; return &unicode_decompose_lookup[5346];
-    case 0xFC93: *len = 2; return &unicode_decompose_lookup[5348];
-    case 0xFC94: *len = 2; return &unicode_decompose_lookup[5350];
-    case 0xFC95: *len = 2; return &unicode_decompose_lookup[5352];
-    case 0xFC96: *len = 2; return &unicode_decompose_lookup[5354];
-    case 0xFC97: *len = 2; return &unicode_decompose_lookup[5356];
-    case 0xFC98: *len = 2; return &unicode_decompose_lookup[5358];
-    case 0xFC99: *len = 2; return &unicode_decompose_lookup[5360];
-    case 0xFC9A: *len = 2; return &unicode_decompose_lookup[5362];
-    case 0xFC9B: *len = 2; return &unicode_decompose_lookup[5364];
-    case 0xFC9C: *len = 2; return &unicode_decompose_lookup[5366];
-    case 0xFC9D: *len = 2; return &unicode_decompose_lookup[5368];
-    case 0xFC9E: *len = 2; return &unicode_decompose_lookup[5370];
-    case 0xFC9F: *len = 2; return &unicode_decompose_lookup[5372];
-    case 0xFCA0: *len = 2; return &unicode_decompose_lookup[5374];
-    case 0xFCA1: *len = 2; return &unicode_decompose_lookup[5376];
-    case 0xFCA2: *len = 2; return &unicode_decompose_lookup[5378];
-    case 0xFCA3: *len = 2; return &unicode_decompose_lookup[5380];
-    case 0xFCA4: *len = 2; return &unicode_decompose_lookup[5382];
-    case 0xFCA5: *len = 2; return &unicode_decompose_lookup[5384];
-    case 0xFCA6: *len = 2; return &unicode_decompose_lookup[5386];
-    case 0xFCA7: *len = 2; return &unicode_decompose_lookup[5388];
-    case 0xFCA8: *len = 2; return &unicode_decompose_lookup[5390];
-    case 0xFCA9: *len = 2; return &unicode_decompose_lookup[5392];
-    case 0xFCAA: *len = 2; return &unicode_decompose_lookup[5394];
-    case 0xFCAB: *len = 2; return &unicode_decompose_lookup[5396];
-    case 0xFCAC: *len = 2; return &unicode_decompose_lookup[5398];
-    case 0xFCAD: *len = 2; return &unicode_decompose_lookup[5400];
-    case 0xFCAE: *len = 2; return &unicode_decompose_lookup[5402];
-    case 0xFCAF: *len = 2; return &unicode_decompose_lookup[5404];
-    case 0xFCB0: *len = 2; return &unicode_decompose_lookup[5406];
-    case 0xFCB1: *len = 2; return &unicode_decompose_lookup[5408];
-    case 0xFCB2: *len = 2; return &unicode_decompose_lookup[5410];
-    case 0xFCB3: *len = 2; return &unicode_decompose_lookup[5412];
-    case 0xFCB4: *len = 2; return &unicode_decompose_lookup[5414];
-    case 0xFCB5: *len = 2; return &unicode_decompose_lookup[5416];
-    case 0xFCB6: *len = 2; return &unicode_decompose_lookup[5418];
-    case 0xFCB7: *len = 2; return &unicode_decompose_lookup[5420];
-    case 0xFCB8: *len = 2; return &unicode_decompose_lookup[5422];
-    case 0xFCB9: *len = 2; return &unicode_decompose_lookup[5424];
-    case 0xFCBA: *len = 2; return &unicode_decompose_lookup[5426];
-    case 0xFCBB: *len = 2; return &unicode_decompose_lookup[5428];
-    case 0xFCBC: *len = 2; return &unicode_decompose_lookup[5430];
-    case 0xFCBD: *len = 2; return &unicode_decompose_lookup[5432];
-    case 0xFCBE: *len = 2; return &unicode_decompose_lookup[5434];
-    case 0xFCBF: *len = 2; return &unicode_decompose_lookup[5436];
-    case 0xFCC0: *len = 2; return &unicode_decompose_lookup[5438];
-    case 0xFCC1: *len = 2; return &unicode_decompose_lookup[5440];
-    case 0xFCC2: *len = 2; return &unicode_decompose_lookup[5442];
-    case 0xFCC3: *len = 2; return &unicode_decompose_lookup[5444];
-    case 0xFCC4: *len = 2; return &unicode_decompose_lookup[5446];
-    case 0xFCC5: *len = 2; return &unicode_decompose_lookup[5448];
-    case 0xFCC6: *len = 2; return &unicode_decompose_lookup[5450];
-    case 0xFCC7: *len = 2; return &unicode_decompose_lookup[5452];
-    case 0xFCC8: *len = 2; return &unicode_decompose_lookup[5454];
-    case 0xFCC9: *len = 2; return &unicode_decompose_lookup[5456];
-    case 0xFCCA: *len = 2; return &unicode_decompose_lookup[5458];
-    case 0xFCCB: *len = 2; return &unicode_decompose_lookup[5460];
-    case 0xFCCC: *len = 2; return &unicode_decompose_lookup[5462];
-    case 0xFCCD: *len = 2; return &unicode_decompose_lookup[5464];
-    case 0xFCCE: *len = 2; return &unicode_decompose_lookup[5466];
-    case 0xFCCF: *len = 2; return &unicode_decompose_lookup[5468];
-    case 0xFCD0: *len = 2; return &unicode_decompose_lookup[5470];
-    case 0xFCD1: *len = 2; return &unicode_decompose_lookup[5472];
-    case 0xFCD2: *len = 2; return &unicode_decompose_lookup[5474];
-    case 0xFCD3: *len = 2; return &unicode_decompose_lookup[5476];
-    case 0xFCD4: *len = 2; return &unicode_decompose_lookup[5478];
-    case 0xFCD5: *len = 2; return &unicode_decompose_lookup[5480];
-    case 0xFCD6: *len = 2; return &unicode_decompose_lookup[5482];
-    case 0xFCD7: *len = 2; return &unicode_decompose_lookup[5484];
-    case 0xFCD8: *len = 2; return &unicode_decompose_lookup[5486];
-    case 0xFCD9: *len = 2; return &unicode_decompose_lookup[5488];
-    case 0xFCDA: *len = 2; return &unicode_decompose_lookup[5490];
-    case 0xFCDB: *len = 2; return &unicode_decompose_lookup[5492];
-    case 0xFCDC: *len = 2; return &unicode_decompose_lookup[5494];
-    case 0xFCDD: *len = 2; return &unicode_decompose_lookup[5496];
-    case 0xFCDE: *len = 2; return &unicode_decompose_lookup[5498];
-    case 0xFCDF: *len = 2; return &unicode_decompose_lookup[5500];
-    case 0xFCE0: *len = 2; return &unicode_decompose_lookup[5502];
-    case 0xFCE1: *len = 2; return &unicode_decompose_lookup[5504];
-    case 0xFCE2: *len = 2; return &unicode_decompose_lookup[5506];
-    case 0xFCE3: *len = 2; return &unicode_decompose_lookup[5508];
-    case 0xFCE4: *len = 2; return &unicode_decompose_lookup[5510];
-    case 0xFCE5: *len = 2; return &unicode_decompose_lookup[5512];
-    case 0xFCE6: *len = 2; return &unicode_decompose_lookup[5514];
-    case 0xFCE7: *len = 2; return &unicode_decompose_lookup[5516];
-    case 0xFCE8: *len = 2; return &unicode_decompose_lookup[5518];
-    case 0xFCE9: *len = 2; return &unicode_decompose_lookup[5520];
-    case 0xFCEA: *len = 2; return &unicode_decompose_lookup[5522];
-    case 0xFCEB: *len = 2; return &unicode_decompose_lookup[5524];
-    case 0xFCEC: *len = 2; return &unicode_decompose_lookup[5526];
-    case 0xFCED: *len = 2; return &unicode_decompose_lookup[5528];
-    case 0xFCEE: *len = 2; return &unicode_decompose_lookup[5530];
-    case 0xFCEF: *len = 2; return &unicode_decompose_lookup[5532];
-    case 0xFCF0: *len = 2; return &unicode_decompose_lookup[5534];
-    case 0xFCF1: *len = 2; return &unicode_decompose_lookup[5536];
-    case 0xFCF2: *len = 3; return &unicode_decompose_lookup[5538];
-    case 0xFCF3: *len = 3; return &unicode_decompose_lookup[5541];
-    case 0xFCF4: *len = 3; return &unicode_decompose_lookup[5544];
-    case 0xFCF5: *len = 2; return &unicode_decompose_lookup[5547];
-    case 0xFCF6: *len = 2; return &unicode_decompose_lookup[5549];
-    case 0xFCF7: *len = 2; return &unicode_decompose_lookup[5551];
-    case 0xFCF8: *len = 2; return &unicode_decompose_lookup[5553];
-    case 0xFCF9: *len = 2; return &unicode_decompose_lookup[5555];
-    case 0xFCFA: *len = 2; return &unicode_decompose_lookup[5557];
-    case 0xFCFB: *len = 2; return &unicode_decompose_lookup[5559];
-    case 0xFCFC: *len = 2; return &unicode_decompose_lookup[5561];
-    case 0xFCFD: *len = 2; return &unicode_decompose_lookup[5563];
-    case 0xFCFE: *len = 2; return &unicode_decompose_lookup[5565];
-    case 0xFCFF: *len = 2; return &unicode_decompose_lookup[5567];
-    case 0xFD00: *len = 2; return &unicode_decompose_lookup[5569];
-    case 0xFD01: *len = 2; return &unicode_decompose_lookup[5571];
-    case 0xFD02: *len = 2; return &unicode_decompose_lookup[5573];
-    case 0xFD03: *len = 2; return &unicode_decompose_lookup[5575];
-    case 0xFD04: *len = 2; return &unicode_decompose_lookup[5577];
-    case 0xFD05: *len = 2; return &unicode_decompose_lookup[5579];
-    case 0xFD06: *len = 2; return &unicode_decompose_lookup[5581];
-    case 0xFD07: *len = 2; return &unicode_decompose_lookup[5583];
-    case 0xFD08: *len = 2; return &unicode_decompose_lookup[5585];
-    case 0xFD09: *len = 2; return &unicode_decompose_lookup[5587];
-    case 0xFD0A: *len = 2; return &unicode_decompose_lookup[5589];
-    case 0xFD0B: *len = 2; return &unicode_decompose_lookup[5591];
-    case 0xFD0C: *len = 2; return &unicode_decompose_lookup[5593];
-    case 0xFD0D: *len = 2; return &unicode_decompose_lookup[5595];
-    case 0xFD0E: *len = 2; return &unicode_decompose_lookup[5597];
-    case 0xFD0F: *len = 2; return &unicode_decompose_lookup[5599];
-    case 0xFD10: *len = 2; return &unicode_decompose_lookup[5601];
-    case 0xFD11: *len = 2; return &unicode_decompose_lookup[5603];
-    case 0xFD12: *len = 2; return &unicode_decompose_lookup[5605];
-    case 0xFD13: *len = 2; return &unicode_decompose_lookup[5607];
-    case 0xFD14: *len = 2; return &unicode_decompose_lookup[5609];
-    case 0xFD15: *len = 2; return &unicode_decompose_lookup[5611];
-    case 0xFD16: *len = 2; return &unicode_decompose_lookup[5613];
-    case 0xFD17: *len = 2; return &unicode_decompose_lookup[5615];
-    case 0xFD18: *len = 2; return &unicode_decompose_lookup[5617];
-    case 0xFD19: *len = 2; return &unicode_decompose_lookup[5619];
-    case 0xFD1A: *len = 2; return &unicode_decompose_lookup[5621];
-    case 0xFD1B: *len = 2; return &unicode_decompose_lookup[5623];
-    case 0xFD1C: *len = 2; return &unicode_decompose_lookup[5625];
-    case 0xFD1D: *len = 2; return &unicode_decompose_lookup[5627];
-    case 0xFD1E: *len = 2; return &unicode_decompose_lookup[5629];
-    case 0xFD1F: *len = 2; return &unicode_decompose_lookup[5631];
-    case 0xFD20: *len = 2; return &unicode_decompose_lookup[5633];
-    case 0xFD21: *len = 2; return &unicode_decompose_lookup[5635];
-    case 0xFD22: *len = 2; return &unicode_decompose_lookup[5637];
-    case 0xFD23: *len = 2; return &unicode_decompose_lookup[5639];
-    case 0xFD24: *len = 2; return &unicode_decompose_lookup[5641];
-    case 0xFD25: *len = 2; return &unicode_decompose_lookup[5643];
-    case 0xFD26: *len = 2; return &unicode_decompose_lookup[5645];
-    case 0xFD27: *len = 2; return &unicode_decompose_lookup[5647];
-    case 0xFD28: *len = 2; return &unicode_decompose_lookup[5649];
-    case 0xFD29: *len = 2; return &unicode_decompose_lookup[5651];
-    case 0xFD2A: *len = 2; return &unicode_decompose_lookup[5653];
-    case 0xFD2B: *len = 2; return &unicode_decompose_lookup[5655];
-    case 0xFD2C: *len = 2; return &unicode_decompose_lookup[5657];
-    case 0xFD2D: *len = 2; return &unicode_decompose_lookup[5659];
-    case 0xFD2E: *len = 2; return &unicode_decompose_lookup[5661];
-    case 0xFD2F: *len = 2; return &unicode_decompose_lookup[5663];
-    case 0xFD30: *len = 2; return &unicode_decompose_lookup[5665];
-    case 0xFD31: *len = 2; return &unicode_decompose_lookup[5667];
-    case 0xFD32: *len = 2; return &unicode_decompose_lookup[5669];
-    case 0xFD33: *len = 2; return &unicode_decompose_lookup[5671];
-    case 0xFD34: *len = 2; return &unicode_decompose_lookup[5673];
-    case 0xFD35: *len = 2; return &unicode_decompose_lookup[5675];
-    case 0xFD36: *len = 2; return &unicode_decompose_lookup[5677];
-    case 0xFD37: *len = 2; return &unicode_decompose_lookup[5679];
-    case 0xFD38: *len = 2; return &unicode_decompose_lookup[5681];
-    case 0xFD39: *len = 2; return &unicode_decompose_lookup[5683];
-    case 0xFD3A: *len = 2; return &unicode_decompose_lookup[5685];
-    case 0xFD3B: *len = 2; return &unicode_decompose_lookup[5687];
-    case 0xFD3C: *len = 2; return &unicode_decompose_lookup[5689];
-    case 0xFD3D: *len = 2; return &unicode_decompose_lookup[5691];
-    case 0xFD50: *len = 3; return &unicode_decompose_lookup[5693];
-    case 0xFD51: *len = 3; return &unicode_decompose_lookup[5696];
-    case 0xFD52: *len = 3; return &unicode_decompose_lookup[5699];
-    case 0xFD53: *len = 3; return &unicode_decompose_lookup[5702];
-    case 0xFD54: *len = 3; return &unicode_decompose_lookup[5705];
-    case 0xFD55: *len = 3; return &unicode_decompose_lookup[5708];
-    case 0xFD56: *len = 3; return &unicode_decompose_lookup[5711];
-    case 0xFD57: *len = 3; return &unicode_decompose_lookup[5714];
-    case 0xFD58: *len = 3; return &unicode_decompose_lookup[5717];
-    case 0xFD59: *len = 3; return &unicode_decompose_lookup[5720];
-    case 0xFD5A: *len = 3; return &unicode_decompose_lookup[5723];
-    case 0xFD5B: *len = 3; return &unicode_decompose_lookup[5726];
-    case 0xFD5C: *len = 3; return &unicode_decompose_lookup[5729];
-    case 0xFD5D: *len = 3; return &unicode_decompose_lookup[5732];
-    case 0xFD5E: *len = 3; return &unicode_decompose_lookup[5735];
-    case 0xFD5F: *len = 3; return &unicode_decompose_lookup[5738];
-    case 0xFD60: *len = 3; return &unicode_decompose_lookup[5741];
-    case 0xFD61: *len = 3; return &unicode_decompose_lookup[5744];
-    case 0xFD62: *len = 3; return &unicode_decompose_lookup[5747];
-    case 0xFD63: *len = 3; return &unicode_decompose_lookup[5750];
-    case 0xFD64: *len = 3; return &unicode_decompose_lookup[5753];
-    case 0xFD65: *len = 3; return &unicode_decompose_lookup[5756];
-    case 0xFD66: *len = 3; return &unicode_decompose_lookup[5759];
-    case 0xFD67: *len = 3; return &unicode_decompose_lookup[5762];
-    case 0xFD68: *len = 3; return &unicode_decompose_lookup[5765];
-    case 0xFD69: *len = 3; return &unicode_decompose_lookup[5768];
-    case 0xFD6A: *len = 3; return &unicode_decompose_lookup[5771];
-    case 0xFD6B: *len = 3; return &unicode_decompose_lookup[5774];
-    case 0xFD6C: *len = 3; return &unicode_decompose_lookup[5777];
-    case 0xFD6D: *len = 3; return &unicode_decompose_lookup[5780];
-    case 0xFD6E: *len = 3; return &unicode_decompose_lookup[5783];
-    case 0xFD6F: *len = 3; return &unicode_decompose_lookup[5786];
-    case 0xFD70: *len = 3; return &unicode_decompose_lookup[5789];
-    case 0xFD71: *len = 3; return &unicode_decompose_lookup[5792];
-    case 0xFD72: *len = 3; return &unicode_decompose_lookup[5795];
-    case 0xFD73: *len = 3; return &unicode_decompose_lookup[5798];
-    case 0xFD74: *len = 3; return &unicode_decompose_lookup[5801];
-    case 0xFD75: *len = 3; return &unicode_decompose_lookup[5804];
-    case 0xFD76: *len = 3; return &unicode_decompose_lookup[5807];
-    case 0xFD77: *len = 3; return &unicode_decompose_lookup[5810];
-    case 0xFD78: *len = 3; return &unicode_decompose_lookup[5813];
-    case 0xFD79: *len = 3; return &unicode_decompose_lookup[5816];
-    case 0xFD7A: *len = 3; return &unicode_decompose_lookup[5819];
-    case 0xFD7B: *len = 3; return &unicode_decompose_lookup[5822];
-    case 0xFD7C: *len = 3; return &unicode_decompose_lookup[5825];
-    case 0xFD7D: *len = 3; return &unicode_decompose_lookup[5828];
-    case 0xFD7E: *len = 3; return &unicode_decompose_lookup[5831];
-    case 0xFD7F: *len = 3; return &unicode_decompose_lookup[5834];
-    case 0xFD80: *len = 3; return &unicode_decompose_lookup[5837];
-    case 0xFD81: *len = 3; return &unicode_decompose_lookup[5840];
-    case 0xFD82: *len = 3; return &unicode_decompose_lookup[5843];
-    case 0xFD83: *len = 3; return &unicode_decompose_lookup[5846];
-    case 0xFD84: *len = 3; return &unicode_decompose_lookup[5849];
-    case 0xFD85: *len = 3; return &unicode_decompose_lookup[5852];
-    case 0xFD86: *len = 3; return &unicode_decompose_lookup[5855];
-    case 0xFD87: *len = 3; return &unicode_decompose_lookup[5858];
-    case 0xFD88: *len = 3; return &unicode_decompose_lookup[5861];
-    case 0xFD89: *len = 3; return &unicode_decompose_lookup[5864];
-    case 0xFD8A: *len = 3; return &unicode_decompose_lookup[5867];
-    case 0xFD8B: *len = 3; return &unicode_decompose_lookup[5870];
-    case 0xFD8C: *len = 3; return &unicode_decompose_lookup[5873];
-    case 0xFD8D: *len = 3; return &unicode_decompose_lookup[5876];
-    case 0xFD8E: *len = 3; return &unicode_decompose_lookup[5879];
-    case 0xFD8F: *len = 3; return &unicode_decompose_lookup[5882];
-    case 0xFD92: *len = 3; return &unicode_decompose_lookup[5885];
-    case 0xFD93: *len = 3; return &unicode_decompose_lookup[5888];
-    case 0xFD94: *len = 3; return &unicode_decompose_lookup[5891];
-    case 0xFD95: *len = 3; return &unicode_decompose_lookup[5894];
-    case 0xFD96: *len = 3; return &unicode_decompose_lookup[5897];
-    case 0xFD97: *len = 3; return &unicode_decompose_lookup[5900];
-    case 0xFD98: *len = 3; return &unicode_decompose_lookup[5903];
-    case 0xFD99: *len = 3; return &unicode_decompose_lookup[5906];
-    case 0xFD9A: *len = 3; return &unicode_decompose_lookup[5909];
-    case 0xFD9B: *len = 3; return &unicode_decompose_lookup[5912];
-    case 0xFD9C: *len = 3; return &unicode_decompose_lookup[5915];
-    case 0xFD9D: *len = 3; return &unicode_decompose_lookup[5918];
-    case 0xFD9E: *len = 3; return &unicode_decompose_lookup[5921];
-    case 0xFD9F: *len = 3; return &unicode_decompose_lookup[5924];
-    case 0xFDA0: *len = 3; return &unicode_decompose_lookup[5927];
-    case 0xFDA1: *len = 3; return &unicode_decompose_lookup[5930];
-    case 0xFDA2: *len = 3; return &unicode_decompose_lookup[5933];
-    case 0xFDA3: *len = 3; return &unicode_decompose_lookup[5936];
-    case 0xFDA4: *len = 3; return &unicode_decompose_lookup[5939];
-    case 0xFDA5: *len = 3; return &unicode_decompose_lookup[5942];
-    case 0xFDA6: *len = 3; return &unicode_decompose_lookup[5945];
-    case 0xFDA7: *len = 3; return &unicode_decompose_lookup[5948];
-    case 0xFDA8: *len = 3; return &unicode_decompose_lookup[5951];
-    case 0xFDA9: *len = 3; return &unicode_decompose_lookup[5954];
-    case 0xFDAA: *len = 3; return &unicode_decompose_lookup[5957];
-    case 0xFDAB: *len = 3; return &unicode_decompose_lookup[5960];
-    case 0xFDAC: *len = 3; return &unicode_decompose_lookup[5963];
-    case 0xFDAD: *len = 3; return &unicode_decompose_lookup[5966];
-    case 0xFDAE: *len = 3; return &unicode_decompose_lookup[5969];
-    case 0xFDAF: *len = 3; return &unicode_decompose_lookup[5972];
-    case 0xFDB0: *len = 3; return &unicode_decompose_lookup[5975];
-    case 0xFDB1: *len = 3; return &unicode_decompose_lookup[5978];
-    case 0xFDB2: *len = 3; return &unicode_decompose_lookup[5981];
-    case 0xFDB3: *len = 3; return &unicode_decompose_lookup[5984];
-    case 0xFDB4: *len = 3; return &unicode_decompose_lookup[5987];
-    case 0xFDB5: *len = 3; return &unicode_decompose_lookup[5990];
-    case 0xFDB6: *len = 3; return &unicode_decompose_lookup[5993];
-    case 0xFDB7: *len = 3; return &unicode_decompose_lookup[5996];
-    case 0xFDB8: *len = 3; return &unicode_decompose_lookup[5999];
-    case 0xFDB9: *len = 3; return &unicode_decompose_lookup[6002];
-    case 0xFDBA: *len = 3; return &unicode_decompose_lookup[6005];
-    case 0xFDBB: *len = 3; return &unicode_decompose_lookup[6008];
-    case 0xFDBC: *len = 3; return &unicode_decompose_lookup[6011];
-    case 0xFDBD: *len = 3; return &unicode_decompose_lookup[6014];
-    case 0xFDBE: *len = 3; return &unicode_decompose_lookup[6017];
-    case 0xFDBF: *len = 3; return &unicode_decompose_lookup[6020];
-    case 0xFDC0: *len = 3; return &unicode_decompose_lookup[6023];
-    case 0xFDC1: *len = 3; return &unicode_decompose_lookup[6026];
-    case 0xFDC2: *len = 3; return &unicode_decompose_lookup[6029];
-    case 0xFDC3: *len = 3; return &unicode_decompose_lookup[6032];
-    case 0xFDC4: *len = 3; return &unicode_decompose_lookup[6035];
-    case 0xFDC5: *len = 3; return &unicode_decompose_lookup[6038];
-    case 0xFDC6: *len = 3; return &unicode_decompose_lookup[6041];
-    case 0xFDC7: *len = 3; return &unicode_decompose_lookup[6044];
-    case 0xFDF0: *len = 3; return &unicode_decompose_lookup[6047];
-    case 0xFDF1: *len = 3; return &unicode_decompose_lookup[6050];
-    case 0xFDF2: *len = 4; return &unicode_decompose_lookup[6053];
-    case 0xFDF3: *len = 4; return &unicode_decompose_lookup[6057];
-    case 0xFDF4: *len = 4; return &unicode_decompose_lookup[6061];
-    case 0xFDF5: *len = 4; return &unicode_decompose_lookup[6065];
-    case 0xFDF6: *len = 4; return &unicode_decompose_lookup[6069];
-    case 0xFDF7: *len = 4; return &unicode_decompose_lookup[6073];
-    case 0xFDF8: *len = 4; return &unicode_decompose_lookup[6077];
-    case 0xFDF9: *len = 3; return &unicode_decompose_lookup[6081];
-    case 0xFDFA: *len = 18; return &unicode_decompose_lookup[6084];
-    case 0xFDFB: *len = 8; return &unicode_decompose_lookup[6102];
-    case 0xFDFC: *len = 4; return &unicode_decompose_lookup[6110];
-    case 0xFE10: *len = 1; return &unicode_decompose_lookup[6114];
-    case 0xFE11: *len = 1; return &unicode_decompose_lookup[6115];
-    case 0xFE12: *len = 1; return &unicode_decompose_lookup[6116];
-    case 0xFE13: *len = 1; return &unicode_decompose_lookup[6117];
-    case 0xFE14: *len = 1; return &unicode_decompose_lookup[6118];
-    case 0xFE15: *len = 1; return &unicode_decompose_lookup[6119];
-    case 0xFE16: *len = 1; return &unicode_decompose_lookup[6120];
-    case 0xFE17: *len = 1; return &unicode_decompose_lookup[6121];
-    case 0xFE18: *len = 1; return &unicode_decompose_lookup[6122];
-    case 0xFE19: *len = 1; return &unicode_decompose_lookup[6123];
-    case 0xFE30: *len = 1; return &unicode_decompose_lookup[6124];
-    case 0xFE31: *len = 1; return &unicode_decompose_lookup[6125];
-    case 0xFE32: *len = 1; return &unicode_decompose_lookup[6126];
-    case 0xFE33: *len = 1; return &unicode_decompose_lookup[6127];
-    case 0xFE34: *len = 1; return &unicode_decompose_lookup[6128];
-    case 0xFE35: *len = 1; return &unicode_decompose_lookup[6129];
-    case 0xFE36: *len = 1; return &unicode_decompose_lookup[6130];
-    case 0xFE37: *len = 1; return &unicode_decompose_lookup[6131];
-    case 0xFE38: *len = 1; return &unicode_decompose_lookup[6132];
-    case 0xFE39: *len = 1; return &unicode_decompose_lookup[6133];
-    case 0xFE3A: *len = 1; return &unicode_decompose_lookup[6134];
-    case 0xFE3B: *len = 1; return &unicode_decompose_lookup[6135];
-    case 0xFE3C: *len = 1; return &unicode_decompose_lookup[6136];
-    case 0xFE3D: *len = 1; return &unicode_decompose_lookup[6137];
-    case 0xFE3E: *len = 1; return &unicode_decompose_lookup[6138];
-    case 0xFE3F: *len = 1; return &unicode_decompose_lookup[6139];
-    case 0xFE40: *len = 1; return &unicode_decompose_lookup[6140];
-    case 0xFE41: *len = 1; return &unicode_decompose_lookup[6141];
-    case 0xFE42: *len = 1; return &unicode_decompose_lookup[6142];
-    case 0xFE43: *len = 1; return &unicode_decompose_lookup[6143];
-    case 0xFE44: *len = 1; return &unicode_decompose_lookup[6144];
-    case 0xFE47: *len = 1; return &unicode_decompose_lookup[6145];
-    case 0xFE48: *len = 1; return &unicode_decompose_lookup[6146];
-    case 0xFE49: *len = 1; return &unicode_decompose_lookup[6147];
-    case 0xFE4A: *len = 1; return &unicode_decompose_lookup[6148];
-    case 0xFE4B: *len = 1; return &unicode_decompose_lookup[6149];
-    case 0xFE4C: *len = 1; return &unicode_decompose_lookup[6150];
-    case 0xFE4D: *len = 1; return &unicode_decompose_lookup[6151];
-    case 0xFE4E: *len = 1; return &unicode_decompose_lookup[6152];
-    case 0xFE4F: *len = 1; return &unicode_decompose_lookup[6153];
-    case 0xFE50: *len = 1; return &unicode_decompose_lookup[6154];
-    case 0xFE51: *len = 1; return &unicode_decompose_lookup[6155];
-    case 0xFE52: *len = 1; return &unicode_decompose_lookup[6156];
-    case 0xFE54: *len = 1; return &unicode_decompose_lookup[6157];
-    case 0xFE55: *len = 1; return &unicode_decompose_lookup[6158];
-    case 0xFE56: *len = 1; return &unicode_decompose_lookup[6159];
-    case 0xFE57: *len = 1; return &unicode_decompose_lookup[6160];
-    case 0xFE58: *len = 1; return &unicode_decompose_lookup[6161];
-    case 0xFE59: *len = 1; return &unicode_decompose_lookup[6162];
-    case 0xFE5A: *len = 1; return &unicode_decompose_lookup[6163];
-    case 0xFE5B: *len = 1; return &unicode_decompose_lookup[6164];
-    case 0xFE5C: *len = 1; return &unicode_decompose_lookup[6165];
-    case 0xFE5D: *len = 1; return &unicode_decompose_lookup[6166];
-    case 0xFE5E: *len = 1; return &unicode_decompose_lookup[6167];
-    case 0xFE5F: *len = 1; return &unicode_decompose_lookup[6168];
-    case 0xFE60: *len = 1; return &unicode_decompose_lookup[6169];
-    case 0xFE61: *len = 1; return &unicode_decompose_lookup[6170];
-    case 0xFE62: *len = 1; return &unicode_decompose_lookup[6171];
-    case 0xFE63: *len = 1; return &unicode_decompose_lookup[6172];
-    case 0xFE64: *len = 1; return &unicode_decompose_lookup[6173];
-    case 0xFE65: *len = 1; return &unicode_decompose_lookup[6174];
-    case 0xFE66: *len = 1; return &unicode_decompose_lookup[6175];
-    case 0xFE68: *len = 1; return &unicode_decompose_lookup[6176];
-    case 0xFE69: *len = 1; return &unicode_decompose_lookup[6177];
-    case 0xFE6A: *len = 1; return &unicode_decompose_lookup[6178];
-    case 0xFE6B: *len = 1; return &unicode_decompose_lookup[6179];
-    case 0xFE70: *len = 2; return &unicode_decompose_lookup[6180];
-    case 0xFE71: *len = 2; return &unicode_decompose_lookup[6182];
-    case 0xFE72: *len = 2; return &unicode_decompose_lookup[6184];
-    case 0xFE74: *len = 2; return &unicode_decompose_lookup[6186];
-    case 0xFE76: *len = 2; return &unicode_decompose_lookup[6188];
-    case 0xFE77: *len = 2; return &unicode_decompose_lookup[6190];
-    case 0xFE78: *len = 2; return &unicode_decompose_lookup[6192];
-    case 0xFE79: *len = 2; return &unicode_decompose_lookup[6194];
-    case 0xFE7A: *len = 2; return &unicode_decompose_lookup[6196];
-    case 0xFE7B: *len = 2; return &unicode_decompose_lookup[6198];
-    case 0xFE7C: *len = 2; return &unicode_decompose_lookup[6200];
-    case 0xFE7D: *len = 2; return &unicode_decompose_lookup[6202];
-    case 0xFE7E: *len = 2; return &unicode_decompose_lookup[6204];
-    case 0xFE7F: *len = 2; return &unicode_decompose_lookup[6206];
-    case 0xFE80: *len = 1; return &unicode_decompose_lookup[6208];
-    case 0xFE81: *len = 1; return &unicode_decompose_lookup[6209];
-    case 0xFE82: *len = 1; return &unicode_decompose_lookup[6210];
-    case 0xFE83: *len = 1; return &unicode_decompose_lookup[6211];
-    case 0xFE84: *len = 1; return &unicode_decompose_lookup[6212];
-    case 0xFE85: *len = 1; return &unicode_decompose_lookup[6213];
-    case 0xFE86: *len = 1; return &unicode_decompose_lookup[6214];
-    case 0xFE87: *len = 1; return &unicode_decompose_lookup[6215];
-    case 0xFE88: *len = 1; return &unicode_decompose_lookup[6216];
-    case 0xFE89: *len = 1; return &unicode_decompose_lookup[6217];
-    case 0xFE8A: *len = 1; return &unicode_decompose_lookup[6218];
-    case 0xFE8B: *len = 1; return &unicode_decompose_lookup[6219];
-    case 0xFE8C: *len = 1; return &unicode_decompose_lookup[6220];
-    case 0xFE8D: *len = 1; return &unicode_decompose_lookup[6221];
-    case 0xFE8E: *len = 1; return &unicode_decompose_lookup[6222];
-    case 0xFE8F: *len = 1; return &unicode_decompose_lookup[6223];
-    case 0xFE90: *len = 1; return &unicode_decompose_lookup[6224];
-    case 0xFE91: *len = 1; return &unicode_decompose_lookup[6225];
-    case 0xFE92: *len = 1; return &unicode_decompose_lookup[6226];
-    case 0xFE93: *len = 1; return &unicode_decompose_lookup[6227];
-    case 0xFE94: *len = 1; return &unicode_decompose_lookup[6228];
-    case 0xFE95: *len = 1; return &unicode_decompose_lookup[6229];
-    case 0xFE96: *len = 1; return &unicode_decompose_lookup[6230];
-    case 0xFE97: *len = 1; return &unicode_decompose_lookup[6231];
-    case 0xFE98: *len = 1; return &unicode_decompose_lookup[6232];
-    case 0xFE99: *len = 1; return &unicode_decompose_lookup[6233];
-    case 0xFE9A: *len = 1; return &unicode_decompose_lookup[6234];
-    case 0xFE9B: *len = 1; return &unicode_decompose_lookup[6235];
-    case 0xFE9C: *len = 1; return &unicode_decompose_lookup[6236];
-    case 0xFE9D: *len = 1; return &unicode_decompose_lookup[6237];
-    case 0xFE9E: *len = 1; return &unicode_decompose_lookup[6238];
-    case 0xFE9F: *len = 1; return &unicode_decompose_lookup[6239];
-    case 0xFEA0: *len = 1; return &unicode_decompose_lookup[6240];
-    case 0xFEA1: *len = 1; return &unicode_decompose_lookup[6241];
-    case 0xFEA2: *len = 1; return &unicode_decompose_lookup[6242];
-    case 0xFEA3: *len = 1; return &unicode_decompose_lookup[6243];
-    case 0xFEA4: *len = 1; return &unicode_decompose_lookup[6244];
-    case 0xFEA5: *len = 1; return &unicode_decompose_lookup[6245];
-    case 0xFEA6: *len = 1; return &unicode_decompose_lookup[6246];
-    case 0xFEA7: *len = 1; return &unicode_decompose_lookup[6247];
-    case 0xFEA8: *len = 1; return &unicode_decompose_lookup[6248];
-    case 0xFEA9: *len = 1; return &unicode_decompose_lookup[6249];
-    case 0xFEAA: *len = 1; return &unicode_decompose_lookup[6250];
-    case 0xFEAB: *len = 1; return &unicode_decompose_lookup[6251];
-    case 0xFEAC: *len = 1; return &unicode_decompose_lookup[6252];
-    case 0xFEAD: *len = 1; return &unicode_decompose_lookup[6253];
-    case 0xFEAE: *len = 1; return &unicode_decompose_lookup[6254];
-    case 0xFEAF: *len = 1; return &unicode_decompose_lookup[6255];
-    case 0xFEB0: *len = 1; return &unicode_decompose_lookup[6256];
-    case 0xFEB1: *len = 1; return &unicode_decompose_lookup[6257];
-    case 0xFEB2: *len = 1; return &unicode_decompose_lookup[6258];
-    case 0xFEB3: *len = 1; return &unicode_decompose_lookup[6259];
-    case 0xFEB4: *len = 1; return &unicode_decompose_lookup[6260];
-    case 0xFEB5: *len = 1; return &unicode_decompose_lookup[6261];
-    case 0xFEB6: *len = 1; return &unicode_decompose_lookup[6262];
-    case 0xFEB7: *len = 1; return &unicode_decompose_lookup[6263];
-    case 0xFEB8: *len = 1; return &unicode_decompose_lookup[6264];
-    case 0xFEB9: *len = 1; return &unicode_decompose_lookup[6265];
-    case 0xFEBA: *len = 1; return &unicode_decompose_lookup[6266];
-    case 0xFEBB: *len = 1; return &unicode_decompose_lookup[6267];
-    case 0xFEBC: *len = 1; return &unicode_decompose_lookup[6268];
-    case 0xFEBD: *len = 1; return &unicode_decompose_lookup[6269];
-    case 0xFEBE: *len = 1; return &unicode_decompose_lookup[6270];
-    case 0xFEBF: *len = 1; return &unicode_decompose_lookup[6271];
-    case 0xFEC0: *len = 1; return &unicode_decompose_lookup[6272];
-    case 0xFEC1: *len = 1; return &unicode_decompose_lookup[6273];
-    case 0xFEC2: *len = 1; return &unicode_decompose_lookup[6274];
-    case 0xFEC3: *len = 1; return &unicode_decompose_lookup[6275];
-    case 0xFEC4: *len = 1; return &unicode_decompose_lookup[6276];
-    case 0xFEC5: *len = 1; return &unicode_decompose_lookup[6277];
-    case 0xFEC6: *len = 1; return &unicode_decompose_lookup[6278];
-    case 0xFEC7: *len = 1; return &unicode_decompose_lookup[6279];
-    case 0xFEC8: *len = 1; return &unicode_decompose_lookup[6280];
-    case 0xFEC9: *len = 1; return &unicode_decompose_lookup[6281];
-    case 0xFECA: *len = 1; return &unicode_decompose_lookup[6282];
-    case 0xFECB: *len = 1; return &unicode_decompose_lookup[6283];
-    case 0xFECC: *len = 1; return &unicode_decompose_lookup[6284];
-    case 0xFECD: *len = 1; return &unicode_decompose_lookup[6285];
-    case 0xFECE: *len = 1; return &unicode_decompose_lookup[6286];
-    case 0xFECF: *len = 1; return &unicode_decompose_lookup[6287];
-    case 0xFED0: *len = 1; return &unicode_decompose_lookup[6288];
-    case 0xFED1: *len = 1; return &unicode_decompose_lookup[6289];
-    case 0xFED2: *len = 1; return &unicode_decompose_lookup[6290];
-    case 0xFED3: *len = 1; return &unicode_decompose_lookup[6291];
-    case 0xFED4: *len = 1; return &unicode_decompose_lookup[6292];
-    case 0xFED5: *len = 1; return &unicode_decompose_lookup[6293];
-    case 0xFED6: *len = 1; return &unicode_decompose_lookup[6294];
-    case 0xFED7: *len = 1; return &unicode_decompose_lookup[6295];
-    case 0xFED8: *len = 1; return &unicode_decompose_lookup[6296];
-    case 0xFED9: *len = 1; return &unicode_decompose_lookup[6297];
-    case 0xFEDA: *len = 1; return &unicode_decompose_lookup[6298];
-    case 0xFEDB: *len = 1; return &unicode_decompose_lookup[6299];
-    case 0xFEDC: *len = 1; return &unicode_decompose_lookup[6300];
-    case 0xFEDD: *len = 1; return &unicode_decompose_lookup[6301];
-    case 0xFEDE: *len = 1; return &unicode_decompose_lookup[6302];
-    case 0xFEDF: *len = 1; return &unicode_decompose_lookup[6303];
-    case 0xFEE0: *len = 1; return &unicode_decompose_lookup[6304];
-    case 0xFEE1: *len = 1; return &unicode_decompose_lookup[6305];
-    case 0xFEE2: *len = 1; return &unicode_decompose_lookup[6306];
-    case 0xFEE3: *len = 1; return &unicode_decompose_lookup[6307];
-    case 0xFEE4: *len = 1; return &unicode_decompose_lookup[6308];
-    case 0xFEE5: *len = 1; return &unicode_decompose_lookup[6309];
-    case 0xFEE6: *len = 1; return &unicode_decompose_lookup[6310];
-    case 0xFEE7: *len = 1; return &unicode_decompose_lookup[6311];
-    case 0xFEE8: *len = 1; return &unicode_decompose_lookup[6312];
-    case 0xFEE9: *len = 1; return &unicode_decompose_lookup[6313];
-    case 0xFEEA: *len = 1; return &unicode_decompose_lookup[6314];
-    case 0xFEEB: *len = 1; return &unicode_decompose_lookup[6315];
-    case 0xFEEC: *len = 1; return &unicode_decompose_lookup[6316];
-    case 0xFEED: *len = 1; return &unicode_decompose_lookup[6317];
-    case 0xFEEE: *len = 1; return &unicode_decompose_lookup[6318];
-    case 0xFEEF: *len = 1; return &unicode_decompose_lookup[6319];
-    case 0xFEF0: *len = 1; return &unicode_decompose_lookup[6320];
-    case 0xFEF1: *len = 1; return &unicode_decompose_lookup[6321];
-    case 0xFEF2: *len = 1; return &unicode_decompose_lookup[6322];
-    case 0xFEF3: *len = 1; return &unicode_decompose_lookup[6323];
-    case 0xFEF4: *len = 1; return &unicode_decompose_lookup[6324];
-    case 0xFEF5: *len = 2; return &unicode_decompose_lookup[6325];
-    case 0xFEF6: *len = 2; return &unicode_decompose_lookup[6327];
-    case 0xFEF7: *len = 2; return &unicode_decompose_lookup[6329];
-    case 0xFEF8: *len = 2; return &unicode_decompose_lookup[6331];
-    case 0xFEF9: *len = 2; return &unicode_decompose_lookup[6333];
-    case 0xFEFA: *len = 2; return &unicode_decompose_lookup[6335];
-    case 0xFEFB: *len = 2; return &unicode_decompose_lookup[6337];
-    case 0xFEFC: *len = 2; return &unicode_decompose_lookup[6339];
-    case 0xFF01: *len = 1; return &unicode_decompose_lookup[6341];
-    case 0xFF02: *len = 1; return &unicode_decompose_lookup[6342];
-    case 0xFF03: *len = 1; return &unicode_decompose_lookup[6343];
-    case 0xFF04: *len = 1; return &unicode_decompose_lookup[6344];
-    case 0xFF05: *len = 1; return &unicode_decompose_lookup[6345];
-    case 0xFF06: *len = 1; return &unicode_decompose_lookup[6346];
-    case 0xFF07: *len = 1; return &unicode_decompose_lookup[6347];
-    case 0xFF08: *len = 1; return &unicode_decompose_lookup[6348];
-    case 0xFF09: *len = 1; return &unicode_decompose_lookup[6349];
-    case 0xFF0A: *len = 1; return &unicode_decompose_lookup[6350];
-    case 0xFF0B: *len = 1; return &unicode_decompose_lookup[6351];
-    case 0xFF0C: *len = 1; return &unicode_decompose_lookup[6352];
-    case 0xFF0D: *len = 1; return &unicode_decompose_lookup[6353];
-    case 0xFF0E: *len = 1; return &unicode_decompose_lookup[6354];
-    case 0xFF0F: *len = 1; return &unicode_decompose_lookup[6355];
-    case 0xFF10: *len = 1; return &unicode_decompose_lookup[6356];
-    case 0xFF11: *len = 1; return &unicode_decompose_lookup[6357];
-    case 0xFF12: *len = 1; return &unicode_decompose_lookup[6358];
-    case 0xFF13: *len = 1; return &unicode_decompose_lookup[6359];
-    case 0xFF14: *len = 1; return &unicode_decompose_lookup[6360];
-    case 0xFF15: *len = 1; return &unicode_decompose_lookup[6361];
-    case 0xFF16: *len = 1; return &unicode_decompose_lookup[6362];
-    case 0xFF17: *len = 1; return &unicode_decompose_lookup[6363];
-    case 0xFF18: *len = 1; return &unicode_decompose_lookup[6364];
-    case 0xFF19: *len = 1; return &unicode_decompose_lookup[6365];
-    case 0xFF1A: *len = 1; return &unicode_decompose_lookup[6366];
-    case 0xFF1B: *len = 1; return &unicode_decompose_lookup[6367];
-    case 0xFF1C: *len = 1; return &unicode_decompose_lookup[6368];
-    case 0xFF1D: *len = 1; return &unicode_decompose_lookup[6369];
-    case 0xFF1E: *len = 1; return &unicode_decompose_lookup[6370];
-    case 0xFF1F: *len = 1; return &unicode_decompose_lookup[6371];
-    case 0xFF20: *len = 1; return &unicode_decompose_lookup[6372];
-    case 0xFF21: *len = 1; return &unicode_decompose_lookup[6373];
-    case 0xFF22: *len = 1; return &unicode_decompose_lookup[6374];
-    case 0xFF23: *len = 1; return &unicode_decompose_lookup[6375];
-    case 0xFF24: *len = 1; return &unicode_decompose_lookup[6376];
-    case 0xFF25: *len = 1; return &unicode_decompose_lookup[6377];
-    case 0xFF26: *len = 1; return &unicode_decompose_lookup[6378];
-    case 0xFF27: *len = 1; return &unicode_decompose_lookup[6379];
-    case 0xFF28: *len = 1; return &unicode_decompose_lookup[6380];
-    case 0xFF29: *len = 1; return &unicode_decompose_lookup[6381];
-    case 0xFF2A: *len = 1; return &unicode_decompose_lookup[6382];
-    case 0xFF2B: *len = 1; return &unicode_decompose_lookup[6383];
-    case 0xFF2C: *len = 1; return &unicode_decompose_lookup[6384];
-    case 0xFF2D: *len = 1; return &unicode_decompose_lookup[6385];
-    case 0xFF2E: *len = 1; return &unicode_decompose_lookup[6386];
-    case 0xFF2F: *len = 1; return &unicode_decompose_lookup[6387];
-    case 0xFF30: *len = 1; return &unicode_decompose_lookup[6388];
-    case 0xFF31: *len = 1; return &unicode_decompose_lookup[6389];
-    case 0xFF32: *len = 1; return &unicode_decompose_lookup[6390];
-    case 0xFF33: *len = 1; return &unicode_decompose_lookup[6391];
-    case 0xFF34: *len = 1; return &unicode_decompose_lookup[6392];
-    case 0xFF35: *len = 1; return &unicode_decompose_lookup[6393];
-    case 0xFF36: *len = 1; return &unicode_decompose_lookup[6394];
-    case 0xFF37: *len = 1; return &unicode_decompose_lookup[6395];
-    case 0xFF38: *len = 1; return &unicode_decompose_lookup[6396];
-    case 0xFF39: *len = 1; return &unicode_decompose_lookup[6397];
-    case 0xFF3A: *len = 1; return &unicode_decompose_lookup[6398];
-    case 0xFF3B: *len = 1; return &unicode_decompose_lookup[6399];
-    case 0xFF3C: *len = 1; return &unicode_decompose_lookup[6400];
-    case 0xFF3D: *len = 1; return &unicode_decompose_lookup[6401];
-    case 0xFF3E: *len = 1; return &unicode_decompose_lookup[6402];
-    case 0xFF3F: *len = 1; return &unicode_decompose_lookup[6403];
-    case 0xFF40: *len = 1; return &unicode_decompose_lookup[6404];
-    case 0xFF41: *len = 1; return &unicode_decompose_lookup[6405];
-    case 0xFF42: *len = 1; return &unicode_decompose_lookup[6406];
-    case 0xFF43: *len = 1; return &unicode_decompose_lookup[6407];
-    case 0xFF44: *len = 1; return &unicode_decompose_lookup[6408];
-    case 0xFF45: *len = 1; return &unicode_decompose_lookup[6409];
-    case 0xFF46: *len = 1; return &unicode_decompose_lookup[6410];
-    case 0xFF47: *len = 1; return &unicode_decompose_lookup[6411];
-    case 0xFF48: *len = 1; return &unicode_decompose_lookup[6412];
-    case 0xFF49: *len = 1; return &unicode_decompose_lookup[6413];
-    case 0xFF4A: *len = 1; return &unicode_decompose_lookup[6414];
-    case 0xFF4B: *len = 1; return &unicode_decompose_lookup[6415];
-    case 0xFF4C: *len = 1; return &unicode_decompose_lookup[6416];
-    case 0xFF4D: *len = 1; return &unicode_decompose_lookup[6417];
-    case 0xFF4E: *len = 1; return &unicode_decompose_lookup[6418];
-    case 0xFF4F: *len = 1; return &unicode_decompose_lookup[6419];
-    case 0xFF50: *len = 1; return &unicode_decompose_lookup[6420];
-    case 0xFF51: *len = 1; return &unicode_decompose_lookup[6421];
-    case 0xFF52: *len = 1; return &unicode_decompose_lookup[6422];
-    case 0xFF53: *len = 1; return &unicode_decompose_lookup[6423];
-    case 0xFF54: *len = 1; return &unicode_decompose_lookup[6424];
-    case 0xFF55: *len = 1; return &unicode_decompose_lookup[6425];
-    case 0xFF56: *len = 1; return &unicode_decompose_lookup[6426];
-    case 0xFF57: *len = 1; return &unicode_decompose_lookup[6427];
-    case 0xFF58: *len = 1; return &unicode_decompose_lookup[6428];
-    case 0xFF59: *len = 1; return &unicode_decompose_lookup[6429];
-    case 0xFF5A: *len = 1; return &unicode_decompose_lookup[6430];
-    case 0xFF5B: *len = 1; return &unicode_decompose_lookup[6431];
-    case 0xFF5C: *len = 1; return &unicode_decompose_lookup[6432];
-    case 0xFF5D: *len = 1; return &unicode_decompose_lookup[6433];
-    case 0xFF5E: *len = 1; return &unicode_decompose_lookup[6434];
-    case 0xFF5F: *len = 1; return &unicode_decompose_lookup[6435];
-    case 0xFF60: *len = 1; return &unicode_decompose_lookup[6436];
-    case 0xFF61: *len = 1; return &unicode_decompose_lookup[6437];
-    case 0xFF62: *len = 1; return &unicode_decompose_lookup[6438];
-    case 0xFF63: *len = 1; return &unicode_decompose_lookup[6439];
-    case 0xFF64: *len = 1; return &unicode_decompose_lookup[6440];
-    case 0xFF65: *len = 1; return &unicode_decompose_lookup[6441];
-    case 0xFF66: *len = 1; return &unicode_decompose_lookup[6442];
-    case 0xFF67: *len = 1; return &unicode_decompose_lookup[6443];
-    case 0xFF68: *len = 1; return &unicode_decompose_lookup[6444];
-    case 0xFF69: *len = 1; return &unicode_decompose_lookup[6445];
-    case 0xFF6A: *len = 1; return &unicode_decompose_lookup[6446];
-    case 0xFF6B: *len = 1; return &unicode_decompose_lookup[6447];
-    case 0xFF6C: *len = 1; return &unicode_decompose_lookup[6448];
-    case 0xFF6D: *len = 1; return &unicode_decompose_lookup[6449];
-    case 0xFF6E: *len = 1; return &unicode_decompose_lookup[6450];
-    case 0xFF6F: *len = 1; return &unicode_decompose_lookup[6451];
-    case 0xFF70: *len = 1; return &unicode_decompose_lookup[6452];
-    case 0xFF71: *len = 1; return &unicode_decompose_lookup[6453];
-    case 0xFF72: *len = 1; return &unicode_decompose_lookup[6454];
-    case 0xFF73: *len = 1; return &unicode_decompose_lookup[6455];
-    case 0xFF74: *len = 1; return &unicode_decompose_lookup[6456];
-    case 0xFF75: *len = 1; return &unicode_decompose_lookup[6457];
-    case 0xFF76: *len = 1; return &unicode_decompose_lookup[6458];
-    case 0xFF77: *len = 1; return &unicode_decompose_lookup[6459];
-    case 0xFF78: *len = 1; return &unicode_decompose_lookup[6460];
-    case 0xFF79: *len = 1; return &unicode_decompose_lookup[6461];
-    case 0xFF7A: *len = 1; return &unicode_decompose_lookup[6462];
-    case 0xFF7B: *len = 1; return &unicode_decompose_lookup[6463];
-    case 0xFF7C: *len = 1; return &unicode_decompose_lookup[6464];
-    case 0xFF7D: *len = 1; return &unicode_decompose_lookup[6465];
-    case 0xFF7E: *len = 1; return &unicode_decompose_lookup[6466];
-    case 0xFF7F: *len = 1; return &unicode_decompose_lookup[6467];
-    case 0xFF80: *len = 1; return &unicode_decompose_lookup[6468];
-    case 0xFF81: *len = 1; return &unicode_decompose_lookup[6469];
-    case 0xFF82: *len = 1; return &unicode_decompose_lookup[6470];
-    case 0xFF83: *len = 1; return &unicode_decompose_lookup[6471];
-    case 0xFF84: *len = 1; return &unicode_decompose_lookup[6472];
-    case 0xFF85: *len = 1; return &unicode_decompose_lookup[6473];
-    case 0xFF86: *len = 1; return &unicode_decompose_lookup[6474];
-    case 0xFF87: *len = 1; return &unicode_decompose_lookup[6475];
-    case 0xFF88: *len = 1; return &unicode_decompose_lookup[6476];
-    case 0xFF89: *len = 1; return &unicode_decompose_lookup[6477];
-    case 0xFF8A: *len = 1; return &unicode_decompose_lookup[6478];
-    case 0xFF8B: *len = 1; return &unicode_decompose_lookup[6479];
-    case 0xFF8C: *len = 1; return &unicode_decompose_lookup[6480];
-    case 0xFF8D: *len = 1; return &unicode_decompose_lookup[6481];
-    case 0xFF8E: *len = 1; return &unicode_decompose_lookup[6482];
-    case 0xFF8F: *len = 1; return &unicode_decompose_lookup[6483];
-    case 0xFF90: *len = 1; return &unicode_decompose_lookup[6484];
-    case 0xFF91: *len = 1; return &unicode_decompose_lookup[6485];
-    case 0xFF92: *len = 1; return &unicode_decompose_lookup[6486];
-    case 0xFF93: *len = 1; return &unicode_decompose_lookup[6487];
-    case 0xFF94: *len = 1; return &unicode_decompose_lookup[6488];
-    case 0xFF95: *len = 1; return &unicode_decompose_lookup[6489];
-    case 0xFF96: *len = 1; return &unicode_decompose_lookup[6490];
-    case 0xFF97: *len = 1; return &unicode_decompose_lookup[6491];
-    case 0xFF98: *len = 1; return &unicode_decompose_lookup[6492];
-    case 0xFF99: *len = 1; return &unicode_decompose_lookup[6493];
-    case 0xFF9A: *len = 1; return &unicode_decompose_lookup[6494];
-    case 0xFF9B: *len = 1; return &unicode_decompose_lookup[6495];
-    case 0xFF9C: *len = 1; return &unicode_decompose_lookup[6496];
-    case 0xFF9D: *len = 1; return &unicode_decompose_lookup[6497];
-    case 0xFF9E: *len = 1; return &unicode_decompose_lookup[6498];
-    case 0xFF9F: *len = 1; return &unicode_decompose_lookup[6499];
-    case 0xFFA0: *len = 1; return &unicode_decompose_lookup[6500];
-    case 0xFFA1: *len = 1; return &unicode_decompose_lookup[6501];
-    case 0xFFA2: *len = 1; return &unicode_decompose_lookup[6502];
-    case 0xFFA3: *len = 1; return &unicode_decompose_lookup[6503];
-    case 0xFFA4: *len = 1; return &unicode_decompose_lookup[6504];
-    case 0xFFA5: *len = 1; return &unicode_decompose_lookup[6505];
-    case 0xFFA6: *len = 1; return &unicode_decompose_lookup[6506];
-    case 0xFFA7: *len = 1; return &unicode_decompose_lookup[6507];
-    case 0xFFA8: *len = 1; return &unicode_decompose_lookup[6508];
-    case 0xFFA9: *len = 1; return &unicode_decompose_lookup[6509];
-    case 0xFFAA: *len = 1; return &unicode_decompose_lookup[6510];
-    case 0xFFAB: *len = 1; return &unicode_decompose_lookup[6511];
-    case 0xFFAC: *len = 1; return &unicode_decompose_lookup[6512];
-    case 0xFFAD: *len = 1; return &unicode_decompose_lookup[6513];
-    case 0xFFAE: *len = 1; return &unicode_decompose_lookup[6514];
-    case 0xFFAF: *len = 1; return &unicode_decompose_lookup[6515];
-    case 0xFFB0: *len = 1; return &unicode_decompose_lookup[6516];
-    case 0xFFB1: *len = 1; return &unicode_decompose_lookup[6517];
-    case 0xFFB2: *len = 1; return &unicode_decompose_lookup[6518];
-    case 0xFFB3: *len = 1; return &unicode_decompose_lookup[6519];
-    case 0xFFB4: *len = 1; return &unicode_decompose_lookup[6520];
-    case 0xFFB5: *len = 1; return &unicode_decompose_lookup[6521];
-    case 0xFFB6: *len = 1; return &unicode_decompose_lookup[6522];
-    case 0xFFB7: *len = 1; return &unicode_decompose_lookup[6523];
-    case 0xFFB8: *len = 1; return &unicode_decompose_lookup[6524];
-    case 0xFFB9: *len = 1; return &unicode_decompose_lookup[6525];
-    case 0xFFBA: *len = 1; return &unicode_decompose_lookup[6526];
-    case 0xFFBB: *len = 1; return &unicode_decompose_lookup[6527];
-    case 0xFFBC: *len = 1; return &unicode_decompose_lookup[6528];
-    case 0xFFBD: *len = 1; return &unicode_decompose_lookup[6529];
-    case 0xFFBE: *len = 1; return &unicode_decompose_lookup[6530];
-    case 0xFFC2: *len = 1; return &unicode_decompose_lookup[6531];
-    case 0xFFC3: *len = 1; return &unicode_decompose_lookup[6532];
-    case 0xFFC4: *len = 1; return &unicode_decompose_lookup[6533];
-    case 0xFFC5: *len = 1; return &unicode_decompose_lookup[6534];
-    case 0xFFC6: *len = 1; return &unicode_decompose_lookup[6535];
-    case 0xFFC7: *len = 1; return &unicode_decompose_lookup[6536];
-    case 0xFFCA: *len = 1; return &unicode_decompose_lookup[6537];
-    case 0xFFCB: *len = 1; return &unicode_decompose_lookup[6538];
-    case 0xFFCC: *len = 1; return &unicode_decompose_lookup[6539];
-    case 0xFFCD: *len = 1; return &unicode_decompose_lookup[6540];
-    case 0xFFCE: *len = 1; return &unicode_decompose_lookup[6541];
-    case 0xFFCF: *len = 1; return &unicode_decompose_lookup[6542];
-    case 0xFFD2: *len = 1; return &unicode_decompose_lookup[6543];
-    case 0xFFD3: *len = 1; return &unicode_decompose_lookup[6544];
-    case 0xFFD4: *len = 1; return &unicode_decompose_lookup[6545];
-    case 0xFFD5: *len = 1; return &unicode_decompose_lookup[6546];
-    case 0xFFD6: *len = 1; return &unicode_decompose_lookup[6547];
-    case 0xFFD7: *len = 1; return &unicode_decompose_lookup[6548];
-    case 0xFFDA: *len = 1; return &unicode_decompose_lookup[6549];
-    case 0xFFDB: *len = 1; return &unicode_decompose_lookup[6550];
-    case 0xFFDC: *len = 1; return &unicode_decompose_lookup[6551];
-    case 0xFFE0: *len = 1; return &unicode_decompose_lookup[6552];
-    case 0xFFE1: *len = 1; return &unicode_decompose_lookup[6553];
-    case 0xFFE2: *len = 1; return &unicode_decompose_lookup[6554];
-    case 0xFFE3: *len = 1; return &unicode_decompose_lookup[6555];
-    case 0xFFE4: *len = 1; return &unicode_decompose_lookup[6556];
-    case 0xFFE5: *len = 1; return &unicode_decompose_lookup[6557];
-    case 0xFFE6: *len = 1; return &unicode_decompose_lookup[6558];
-    case 0xFFE8: *len = 1; return &unicode_decompose_lookup[6559];
-    case 0xFFE9: *len = 1; return &unicode_decompose_lookup[6560];
-    case 0xFFEA: *len = 1; return &unicode_decompose_lookup[6561];
-    case 0xFFEB: *len = 1; return &unicode_decompose_lookup[6562];
-    case 0xFFEC: *len = 1; return &unicode_decompose_lookup[6563];
-    case 0xFFED: *len = 1; return &unicode_decompose_lookup[6564];
-    case 0xFFEE: *len = 1; return &unicode_decompose_lookup[6565];
-    case 0x1D400: *len = 1; return &unicode_decompose_lookup[6616];
-    case 0x1D401: *len = 1; return &unicode_decompose_lookup[6617];
-    case 0x1D402: *len = 1; return &unicode_decompose_lookup[6618];
-    case 0x1D403: *len = 1; return &unicode_decompose_lookup[6619];
-    case 0x1D404: *len = 1; return &unicode_decompose_lookup[6620];
-    case 0x1D405: *len = 1; return &unicode_decompose_lookup[6621];
-    case 0x1D406: *len = 1; return &unicode_decompose_lookup[6622];
-    case 0x1D407: *len = 1; return &unicode_decompose_lookup[6623];
-    case 0x1D408: *len = 1; return &unicode_decompose_lookup[6624];
-    case 0x1D409: *len = 1; return &unicode_decompose_lookup[6625];
-    case 0x1D40A: *len = 1; return &unicode_decompose_lookup[6626];
-    case 0x1D40B: *len = 1; return &unicode_decompose_lookup[6627];
-    case 0x1D40C: *len = 1; return &unicode_decompose_lookup[6628];
-    case 0x1D40D: *len = 1; return &unicode_decompose_lookup[6629];
-    case 0x1D40E: *len = 1; return &unicode_decompose_lookup[6630];
-    case 0x1D40F: *len = 1; return &unicode_decompose_lookup[6631];
-    case 0x1D410: *len = 1; return &unicode_decompose_lookup[6632];
-    case 0x1D411: *len = 1; return &unicode_decompose_lookup[6633];
-    case 0x1D412: *len = 1; return &unicode_decompose_lookup[6634];
-    case 0x1D413: *len = 1; return &unicode_decompose_lookup[6635];
-    case 0x1D414: *len = 1; return &unicode_decompose_lookup[6636];
-    case 0x1D415: *len = 1; return &unicode_decompose_lookup[6637];
-    case 0x1D416: *len = 1; return &unicode_decompose_lookup[6638];
-    case 0x1D417: *len = 1; return &unicode_decompose_lookup[6639];
-    case 0x1D418: *len = 1; return &unicode_decompose_lookup[6640];
-    case 0x1D419: *len = 1; return &unicode_decompose_lookup[6641];
-    case 0x1D41A: *len = 1; return &unicode_decompose_lookup[6642];
-    case 0x1D41B: *len = 1; return &unicode_decompose_lookup[6643];
-    case 0x1D41C: *len = 1; return &unicode_decompose_lookup[6644];
-    case 0x1D41D: *len = 1; return &unicode_decompose_lookup[6645];
-    case 0x1D41E: *len = 1; return &unicode_decompose_lookup[6646];
-    case 0x1D41F: *len = 1; return &unicode_decompose_lookup[6647];
-    case 0x1D420: *len = 1; return &unicode_decompose_lookup[6648];
-    case 0x1D421: *len = 1; return &unicode_decompose_lookup[6649];
-    case 0x1D422: *len = 1; return &unicode_decompose_lookup[6650];
-    case 0x1D423: *len = 1; return &unicode_decompose_lookup[6651];
-    case 0x1D424: *len = 1; return &unicode_decompose_lookup[6652];
-    case 0x1D425: *len = 1; return &unicode_decompose_lookup[6653];
-    case 0x1D426: *len = 1; return &unicode_decompose_lookup[6654];
-    case 0x1D427: *len = 1; return &unicode_decompose_lookup[6655];
-    case 0x1D428: *len = 1; return &unicode_decompose_lookup[6656];
-    case 0x1D429: *len = 1; return &unicode_decompose_lookup[6657];
-    case 0x1D42A: *len = 1; return &unicode_decompose_lookup[6658];
-    case 0x1D42B: *len = 1; return &unicode_decompose_lookup[6659];
-    case 0x1D42C: *len = 1; return &unicode_decompose_lookup[6660];
-    case 0x1D42D: *len = 1; return &unicode_decompose_lookup[6661];
-    case 0x1D42E: *len = 1; return &unicode_decompose_lookup[6662];
-    case 0x1D42F: *len = 1; return &unicode_decompose_lookup[6663];
-    case 0x1D430: *len = 1; return &unicode_decompose_lookup[6664];
-    case 0x1D431: *len = 1; return &unicode_decompose_lookup[6665];
-    case 0x1D432: *len = 1; return &unicode_decompose_lookup[6666];
-    case 0x1D433: *len = 1; return &unicode_decompose_lookup[6667];
-    case 0x1D434: *len = 1; return &unicode_decompose_lookup[6668];
-    case 0x1D435: *len = 1; return &unicode_decompose_lookup[6669];
-    case 0x1D436: *len = 1; return &unicode_decompose_lookup[6670];
-    case 0x1D437: *len = 1; return &unicode_decompose_lookup[6671];
-    case 0x1D438: *len = 1; return &unicode_decompose_lookup[6672];
-    case 0x1D439: *len = 1; return &unicode_decompose_lookup[6673];
-    case 0x1D43A: *len = 1; return &unicode_decompose_lookup[6674];
-    case 0x1D43B: *len = 1; return &unicode_decompose_lookup[6675];
-    case 0x1D43C: *len = 1; return &unicode_decompose_lookup[6676];
-    case 0x1D43D: *len = 1; return &unicode_decompose_lookup[6677];
-    case 0x1D43E: *len = 1; return &unicode_decompose_lookup[6678];
-    case 0x1D43F: *len = 1; return &unicode_decompose_lookup[6679];
-    case 0x1D440: *len = 1; return &unicode_decompose_lookup[6680];
-    case 0x1D441: *len = 1; return &unicode_decompose_lookup[6681];
-    case 0x1D442: *len = 1; return &unicode_decompose_lookup[6682];
-    case 0x1D443: *len = 1; return &unicode_decompose_lookup[6683];
-    case 0x1D444: *len = 1; return &unicode_decompose_lookup[6684];
-    case 0x1D445: *len = 1; return &unicode_decompose_lookup[6685];
-    case 0x1D446: *len = 1; return &unicode_decompose_lookup[6686];
-    case 0x1D447: *len = 1; return &unicode_decompose_lookup[6687];
-    case 0x1D448: *len = 1; return &unicode_decompose_lookup[6688];
-    case 0x1D449: *len = 1; return &unicode_decompose_lookup[6689];
-    case 0x1D44A: *len = 1; return &unicode_decompose_lookup[6690];
-    case 0x1D44B: *len = 1; return &unicode_decompose_lookup[6691];
-    case 0x1D44C: *len = 1; return &unicode_decompose_lookup[6692];
-    case 0x1D44D: *len = 1; return &unicode_decompose_lookup[6693];
-    case 0x1D44E: *len = 1; return &unicode_decompose_lookup[6694];
-    case 0x1D44F: *len = 1; return &unicode_decompose_lookup[6695];
-    case 0x1D450: *len = 1; return &unicode_decompose_lookup[6696];
-    case 0x1D451: *len = 1; return &unicode_decompose_lookup[6697];
-    case 0x1D452: *len = 1; return &unicode_decompose_lookup[6698];
-    case 0x1D453: *len = 1; return &unicode_decompose_lookup[6699];
-    case 0x1D454: *len = 1; return &unicode_decompose_lookup[6700];
-    case 0x1D456: *len = 1; return &unicode_decompose_lookup[6701];
-    case 0x1D457: *len = 1; return &unicode_decompose_lookup[6702];
-    case 0x1D458: *len = 1; return &unicode_decompose_lookup[6703];
-    case 0x1D459: *len = 1; return &unicode_decompose_lookup[6704];
-    case 0x1D45A: *len = 1; return &unicode_decompose_lookup[6705];
-    case 0x1D45B: *len = 1; return &unicode_decompose_lookup[6706];
-    case 0x1D45C: *len = 1; return &unicode_decompose_lookup[6707];
-    case 0x1D45D: *len = 1; return &unicode_decompose_lookup[6708];
-    case 0x1D45E: *len = 1; return &unicode_decompose_lookup[6709];
-    case 0x1D45F: *len = 1; return &unicode_decompose_lookup[6710];
-    case 0x1D460: *len = 1; return &unicode_decompose_lookup[6711];
-    case 0x1D461: *len = 1; return &unicode_decompose_lookup[6712];
-    case 0x1D462: *len = 1; return &unicode_decompose_lookup[6713];
-    case 0x1D463: *len = 1; return &unicode_decompose_lookup[6714];
-    case 0x1D464: *len = 1; return &unicode_decompose_lookup[6715];
-    case 0x1D465: *len = 1; return &unicode_decompose_lookup[6716];
-    case 0x1D466: *len = 1; return &unicode_decompose_lookup[6717];
-    case 0x1D467: *len = 1; return &unicode_decompose_lookup[6718];
-    case 0x1D468: *len = 1; return &unicode_decompose_lookup[6719];
-    case 0x1D469: *len = 1; return &unicode_decompose_lookup[6720];
-    case 0x1D46A: *len = 1; return &unicode_decompose_lookup[6721];
-    case 0x1D46B: *len = 1; return &unicode_decompose_lookup[6722];
-    case 0x1D46C: *len = 1; return &unicode_decompose_lookup[6723];
-    case 0x1D46D: *len = 1; return &unicode_decompose_lookup[6724];
-    case 0x1D46E: *len = 1; return &unicode_decompose_lookup[6725];
-    case 0x1D46F: *len = 1; return &unicode_decompose_lookup[6726];
-    case 0x1D470: *len = 1; return &unicode_decompose_lookup[6727];
-    case 0x1D471: *len = 1; return &unicode_decompose_lookup[6728];
-    case 0x1D472: *len = 1; return &unicode_decompose_lookup[6729];
-    case 0x1D473: *len = 1; return &unicode_decompose_lookup[6730];
-    case 0x1D474: *len = 1; return &unicode_decompose_lookup[6731];
-    case 0x1D475: *len = 1; return &unicode_decompose_lookup[6732];
-    case 0x1D476: *len = 1; return &unicode_decompose_lookup[6733];
-    case 0x1D477: *len = 1; return &unicode_decompose_lookup[6734];
-    case 0x1D478: *len = 1; return &unicode_decompose_lookup[6735];
-    case 0x1D479: *len = 1; return &unicode_decompose_lookup[6736];
-    case 0x1D47A: *len = 1; return &unicode_decompose_lookup[6737];
-    case 0x1D47B: *len = 1; return &unicode_decompose_lookup[6738];
-    case 0x1D47C: *len = 1; return &unicode_decompose_lookup[6739];
-    case 0x1D47D: *len = 1; return &unicode_decompose_lookup[6740];
-    case 0x1D47E: *len = 1; return &unicode_decompose_lookup[6741];
-    case 0x1D47F: *len = 1; return &unicode_decompose_lookup[6742];
-    case 0x1D480: *len = 1; return &unicode_decompose_lookup[6743];
-    case 0x1D481: *len = 1; return &unicode_decompose_lookup[6744];
-    case 0x1D482: *len = 1; return &unicode_decompose_lookup[6745];
-    case 0x1D483: *len = 1; return &unicode_decompose_lookup[6746];
-    case 0x1D484: *len = 1; return &unicode_decompose_lookup[6747];
-    case 0x1D485: *len = 1; return &unicode_decompose_lookup[6748];
-    case 0x1D486: *len = 1; return &unicode_decompose_lookup[6749];
-    case 0x1D487: *len = 1; return &unicode_decompose_lookup[6750];
-    case 0x1D488: *len = 1; return &unicode_decompose_lookup[6751];
-    case 0x1D489: *len = 1; return &unicode_decompose_lookup[6752];
-    case 0x1D48A: *len = 1; return &unicode_decompose_lookup[6753];
-    case 0x1D48B: *len = 1; return &unicode_decompose_lookup[6754];
-    case 0x1D48C: *len = 1; return &unicode_decompose_lookup[6755];
-    case 0x1D48D: *len = 1; return &unicode_decompose_lookup[6756];
-    case 0x1D48E: *len = 1; return &unicode_decompose_lookup[6757];
-    case 0x1D48F: *len = 1; return &unicode_decompose_lookup[6758];
-    case 0x1D490: *len = 1; return &unicode_decompose_lookup[6759];
-    case 0x1D491: *len = 1; return &unicode_decompose_lookup[6760];
-    case 0x1D492: *len = 1; return &unicode_decompose_lookup[6761];
-    case 0x1D493: *len = 1; return &unicode_decompose_lookup[6762];
-    case 0x1D494: *len = 1; return &unicode_decompose_lookup[6763];
-    case 0x1D495: *len = 1; return &unicode_decompose_lookup[6764];
-    case 0x1D496: *len = 1; return &unicode_decompose_lookup[6765];
-    case 0x1D497: *len = 1; return &unicode_decompose_lookup[6766];
-    case 0x1D498: *len = 1; return &unicode_decompose_lookup[6767];
-    case 0x1D499: *len = 1; return &unicode_decompose_lookup[6768];
-    case 0x1D49A: *len = 1; return &unicode_decompose_lookup[6769];
-    case 0x1D49B: *len = 1; return &unicode_decompose_lookup[6770];
-    case 0x1D49C: *len = 1; return &unicode_decompose_lookup[6771];
-    case 0x1D49E: *len = 1; return &unicode_decompose_lookup[6772];
-    case 0x1D49F: *len = 1; return &unicode_decompose_lookup[6773];
-    case 0x1D4A2: *len = 1; return &unicode_decompose_lookup[6774];
-    case 0x1D4A5: *len = 1; return &unicode_decompose_lookup[6775];
-    case 0x1D4A6: *len = 1; return &unicode_decompose_lookup[6776];
-    case 0x1D4A9: *len = 1; return &unicode_decompose_lookup[6777];
-    case 0x1D4AA: *len = 1; return &unicode_decompose_lookup[6778];
-    case 0x1D4AB: *len = 1; return &unicode_decompose_lookup[6779];
-    case 0x1D4AC: *len = 1; return &unicode_decompose_lookup[6780];
-    case 0x1D4AE: *len = 1; return &unicode_decompose_lookup[6781];
-    case 0x1D4AF: *len = 1; return &unicode_decompose_lookup[6782];
-    case 0x1D4B0: *len = 1; return &unicode_decompose_lookup[6783];
-    case 0x1D4B1: *len = 1; return &unicode_decompose_lookup[6784];
-    case 0x1D4B2: *len = 1; return &unicode_decompose_lookup[6785];
-    case 0x1D4B3: *len = 1; return &unicode_decompose_lookup[6786];
-    case 0x1D4B4: *len = 1; return &unicode_decompose_lookup[6787];
-    case 0x1D4B5: *len = 1; return &unicode_decompose_lookup[6788];
-    case 0x1D4B6: *len = 1; return &unicode_decompose_lookup[6789];
-    case 0x1D4B7: *len = 1; return &unicode_decompose_lookup[6790];
-    case 0x1D4B8: *len = 1; return &unicode_decompose_lookup[6791];
-    case 0x1D4B9: *len = 1; return &unicode_decompose_lookup[6792];
-    case 0x1D4BB: *len = 1; return &unicode_decompose_lookup[6793];
-    case 0x1D4BD: *len = 1; return &unicode_decompose_lookup[6794];
-    case 0x1D4BE: *len = 1; return &unicode_decompose_lookup[6795];
-    case 0x1D4BF: *len = 1; return &unicode_decompose_lookup[6796];
-    case 0x1D4C0: *len = 1; return &unicode_decompose_lookup[6797];
-    case 0x1D4C1: *len = 1; return &unicode_decompose_lookup[6798];
-    case 0x1D4C2: *len = 1; return &unicode_decompose_lookup[6799];
-    case 0x1D4C3: *len = 1; return &unicode_decompose_lookup[6800];
-    case 0x1D4C5: *len = 1; return &unicode_decompose_lookup[6801];
-    case 0x1D4C6: *len = 1; return &unicode_decompose_lookup[6802];
-    case 0x1D4C7: *len = 1; return &unicode_decompose_lookup[6803];
-    case 0x1D4C8: *len = 1; return &unicode_decompose_lookup[6804];
-    case 0x1D4C9: *len = 1; return &unicode_decompose_lookup[6805];
-    case 0x1D4CA: *len = 1; return &unicode_decompose_lookup[6806];
-    case 0x1D4CB: *len = 1; return &unicode_decompose_lookup[6807];
-    case 0x1D4CC: *len = 1; return &unicode_decompose_lookup[6808];
-    case 0x1D4CD: *len = 1; return &unicode_decompose_lookup[6809];
-    case 0x1D4CE: *len = 1; return &unicode_decompose_lookup[6810];
-    case 0x1D4CF: *len = 1; return &unicode_decompose_lookup[6811];
-    case 0x1D4D0: *len = 1; return &unicode_decompose_lookup[6812];
-    case 0x1D4D1: *len = 1; return &unicode_decompose_lookup[6813];
-    case 0x1D4D2: *len = 1; return &unicode_decompose_lookup[6814];
-    case 0x1D4D3: *len = 1; return &unicode_decompose_lookup[6815];
-    case 0x1D4D4: *len = 1; return &unicode_decompose_lookup[6816];
-    case 0x1D4D5: *len = 1; return &unicode_decompose_lookup[6817];
-    case 0x1D4D6: *len = 1; return &unicode_decompose_lookup[6818];
-    case 0x1D4D7: *len = 1; return &unicode_decompose_lookup[6819];
-    case 0x1D4D8: *len = 1; return &unicode_decompose_lookup[6820];
-    case 0x1D4D9: *len = 1; return &unicode_decompose_lookup[6821];
-    case 0x1D4DA: *len = 1; return &unicode_decompose_lookup[6822];
-    case 0x1D4DB: *len = 1; return &unicode_decompose_lookup[6823];
-    case 0x1D4DC: *len = 1; return &unicode_decompose_lookup[6824];
-    case 0x1D4DD: *len = 1; return &unicode_decompose_lookup[6825];
-    case 0x1D4DE: *len = 1; return &unicode_decompose_lookup[6826];
-    case 0x1D4DF: *len = 1; return &unicode_decompose_lookup[6827];
-    case 0x1D4E0: *len = 1; return &unicode_decompose_lookup[6828];
-    case 0x1D4E1: *len = 1; return &unicode_decompose_lookup[6829];
-    case 0x1D4E2: *len = 1; return &unicode_decompose_lookup[6830];
-    case 0x1D4E3: *len = 1; return &unicode_decompose_lookup[6831];
-    case 0x1D4E4: *len = 1; return &unicode_decompose_lookup[6832];
-    case 0x1D4E5: *len = 1; return &unicode_decompose_lookup[6833];
-    case 0x1D4E6: *len = 1; return &unicode_decompose_lookup[6834];
-    case 0x1D4E7: *len = 1; return &unicode_decompose_lookup[6835];
-    case 0x1D4E8: *len = 1; return &unicode_decompose_lookup[6836];
-    case 0x1D4E9: *len = 1; return &unicode_decompose_lookup[6837];
-    case 0x1D4EA: *len = 1; return &unicode_decompose_lookup[6838];
-    case 0x1D4EB: *len = 1; return &unicode_decompose_lookup[6839];
-    case 0x1D4EC: *len = 1; return &unicode_decompose_lookup[6840];
-    case 0x1D4ED: *len = 1; return &unicode_decompose_lookup[6841];
-    case 0x1D4EE: *len = 1; return &unicode_decompose_lookup[6842];
-    case 0x1D4EF: *len = 1; return &unicode_decompose_lookup[6843];
-    case 0x1D4F0: *len = 1; return &unicode_decompose_lookup[6844];
-    case 0x1D4F1: *len = 1; return &unicode_decompose_lookup[6845];
-    case 0x1D4F2: *len = 1; return &unicode_decompose_lookup[6846];
-    case 0x1D4F3: *len = 1; return &unicode_decompose_lookup[6847];
-    case 0x1D4F4: *len = 1; return &unicode_decompose_lookup[6848];
-    case 0x1D4F5: *len = 1; return &unicode_decompose_lookup[6849];
-    case 0x1D4F6: *len = 1; return &unicode_decompose_lookup[6850];
-    case 0x1D4F7: *len = 1; return &unicode_decompose_lookup[6851];
-    case 0x1D4F8: *len = 1; return &unicode_decompose_lookup[6852];
-    case 0x1D4F9: *len = 1; return &unicode_decompose_lookup[6853];
-    case 0x1D4FA: *len = 1; return &unicode_decompose_lookup[6854];
-    case 0x1D4FB: *len = 1; return &unicode_decompose_lookup[6855];
-    case 0x1D4FC: *len = 1; return &unicode_decompose_lookup[6856];
-    case 0x1D4FD: *len = 1; return &unicode_decompose_lookup[6857];
-    case 0x1D4FE: *len = 1; return &unicode_decompose_lookup[6858];
-    case 0x1D4FF: *len = 1; return &unicode_decompose_lookup[6859];
-    case 0x1D500: *len = 1; return &unicode_decompose_lookup[6860];
-    case 0x1D501: *len = 1; return &unicode_decompose_lookup[6861];
-    case 0x1D502: *len = 1; return &unicode_decompose_lookup[6862];
-    case 0x1D503: *len = 1; return &unicode_decompose_lookup[6863];
-    case 0x1D504: *len = 1; return &unicode_decompose_lookup[6864];
-    case 0x1D505: *len = 1; return &unicode_decompose_lookup[6865];
-    case 0x1D507: *len = 1; return &unicode_decompose_lookup[6866];
-    case 0x1D508: *len = 1; return &unicode_decompose_lookup[6867];
-    case 0x1D509: *len = 1; return &unicode_decompose_lookup[6868];
-    case 0x1D50A: *len = 1; return &unicode_decompose_lookup[6869];
-    case 0x1D50D: *len = 1; return &unicode_decompose_lookup[6870];
-    case 0x1D50E: *len = 1; return &unicode_decompose_lookup[6871];
-    case 0x1D50F: *len = 1; return &unicode_decompose_lookup[6872];
-    case 0x1D510: *len = 1; return &unicode_decompose_lookup[6873];
-    case 0x1D511: *len = 1; return &unicode_decompose_lookup[6874];
-    case 0x1D512: *len = 1; return &unicode_decompose_lookup[6875];
-    case 0x1D513: *len = 1; return &unicode_decompose_lookup[6876];
-    case 0x1D514: *len = 1; return &unicode_decompose_lookup[6877];
-    case 0x1D516: *len = 1; return &unicode_decompose_lookup[6878];
-    case 0x1D517: *len = 1; return &unicode_decompose_lookup[6879];
-    case 0x1D518: *len = 1; return &unicode_decompose_lookup[6880];
-    case 0x1D519: *len = 1; return &unicode_decompose_lookup[6881];
-    case 0x1D51A: *len = 1; return &unicode_decompose_lookup[6882];
-    case 0x1D51B: *len = 1; return &unicode_decompose_lookup[6883];
-    case 0x1D51C: *len = 1; return &unicode_decompose_lookup[6884];
-    case 0x1D51E: *len = 1; return &unicode_decompose_lookup[6885];
-    case 0x1D51F: *len = 1; return &unicode_decompose_lookup[6886];
-    case 0x1D520: *len = 1; return &unicode_decompose_lookup[6887];
-    case 0x1D521: *len = 1; return &unicode_decompose_lookup[6888];
-    case 0x1D522: *len = 1; return &unicode_decompose_lookup[6889];
-    case 0x1D523: *len = 1; return &unicode_decompose_lookup[6890];
-    case 0x1D524: *len = 1; return &unicode_decompose_lookup[6891];
-    case 0x1D525: *len = 1; return &unicode_decompose_lookup[6892];
-    case 0x1D526: *len = 1; return &unicode_decompose_lookup[6893];
-    case 0x1D527: *len = 1; return &unicode_decompose_lookup[6894];
-    case 0x1D528: *len = 1; return &unicode_decompose_lookup[6895];
-    case 0x1D529: *len = 1; return &unicode_decompose_lookup[6896];
-    case 0x1D52A: *len = 1; return &unicode_decompose_lookup[6897];
-    case 0x1D52B: *len = 1; return &unicode_decompose_lookup[6898];
-    case 0x1D52C: *len = 1; return &unicode_decompose_lookup[6899];
-    case 0x1D52D: *len = 1; return &unicode_decompose_lookup[6900];
-    case 0x1D52E: *len = 1; return &unicode_decompose_lookup[6901];
-    case 0x1D52F: *len = 1; return &unicode_decompose_lookup[6902];
-    case 0x1D530: *len = 1; return &unicode_decompose_lookup[6903];
-    case 0x1D531: *len = 1; return &unicode_decompose_lookup[6904];
-    case 0x1D532: *len = 1; return &unicode_decompose_lookup[6905];
-    case 0x1D533: *len = 1; return &unicode_decompose_lookup[6906];
-    case 0x1D534: *len = 1; return &unicode_decompose_lookup[6907];
-    case 0x1D535: *len = 1; return &unicode_decompose_lookup[6908];
-    case 0x1D536: *len = 1; return &unicode_decompose_lookup[6909];
-    case 0x1D537: *len = 1; return &unicode_decompose_lookup[6910];
-    case 0x1D538: *len = 1; return &unicode_decompose_lookup[6911];
-    case 0x1D539: *len = 1; return &unicode_decompose_lookup[6912];
-    case 0x1D53B: *len = 1; return &unicode_decompose_lookup[6913];
-    case 0x1D53C: *len = 1; return &unicode_decompose_lookup[6914];
-    case 0x1D53D: *len = 1; return &unicode_decompose_lookup[6915];
-    case 0x1D53E: *len = 1; return &unicode_decompose_lookup[6916];
-    case 0x1D540: *len = 1; return &unicode_decompose_lookup[6917];
-    case 0x1D541: *len = 1; return &unicode_decompose_lookup[6918];
-    case 0x1D542: *len = 1; return &unicode_decompose_lookup[6919];
-    case 0x1D543: *len = 1; return &unicode_decompose_lookup[6920];
-    case 0x1D544: *len = 1; return &unicode_decompose_lookup[6921];
-    case 0x1D546: *len = 1; return &unicode_decompose_lookup[6922];
-    case 0x1D54A: *len = 1; return &unicode_decompose_lookup[6923];
-    case 0x1D54B: *len = 1; return &unicode_decompose_lookup[6924];
-    case 0x1D54C: *len = 1; return &unicode_decompose_lookup[6925];
-    case 0x1D54D: *len = 1; return &unicode_decompose_lookup[6926];
-    case 0x1D54E: *len = 1; return &unicode_decompose_lookup[6927];
-    case 0x1D54F: *len = 1; return &unicode_decompose_lookup[6928];
-    case 0x1D550: *len = 1; return &unicode_decompose_lookup[6929];
-    case 0x1D552: *len = 1; return &unicode_decompose_lookup[6930];
-    case 0x1D553: *len = 1; return &unicode_decompose_lookup[6931];
-    case 0x1D554: *len = 1; return &unicode_decompose_lookup[6932];
-    case 0x1D555: *len = 1; return &unicode_decompose_lookup[6933];
-    case 0x1D556: *len = 1; return &unicode_decompose_lookup[6934];
-    case 0x1D557: *len = 1; return &unicode_decompose_lookup[6935];
-    case 0x1D558: *len = 1; return &unicode_decompose_lookup[6936];
-    case 0x1D559: *len = 1; return &unicode_decompose_lookup[6937];
-    case 0x1D55A: *len = 1; return &unicode_decompose_lookup[6938];
-    case 0x1D55B: *len = 1; return &unicode_decompose_lookup[6939];
-    case 0x1D55C: *len = 1; return &unicode_decompose_lookup[6940];
-    case 0x1D55D: *len = 1; return &unicode_decompose_lookup[6941];
-    case 0x1D55E: *len = 1; return &unicode_decompose_lookup[6942];
-    case 0x1D55F: *len = 1; return &unicode_decompose_lookup[6943];
-    case 0x1D560: *len = 1; return &unicode_decompose_lookup[6944];
-    case 0x1D561: *len = 1; return &unicode_decompose_lookup[6945];
-    case 0x1D562: *len = 1; return &unicode_decompose_lookup[6946];
-    case 0x1D563: *len = 1; return &unicode_decompose_lookup[6947];
-    case 0x1D564: *len = 1; return &unicode_decompose_lookup[6948];
-    case 0x1D565: *len = 1; return &unicode_decompose_lookup[6949];
-    case 0x1D566: *len = 1; return &unicode_decompose_lookup[6950];
-    case 0x1D567: *len = 1; return &unicode_decompose_lookup[6951];
-    case 0x1D568: *len = 1; return &unicode_decompose_lookup[6952];
-    case 0x1D569: *len = 1; return &unicode_decompose_lookup[6953];
-    case 0x1D56A: *len = 1; return &unicode_decompose_lookup[6954];
-    case 0x1D56B: *len = 1; return &unicode_decompose_lookup[6955];
-    case 0x1D56C: *len = 1; return &unicode_decompose_lookup[6956];
-    case 0x1D56D: *len = 1; return &unicode_decompose_lookup[6957];
-    case 0x1D56E: *len = 1; return &unicode_decompose_lookup[6958];
-    case 0x1D56F: *len = 1; return &unicode_decompose_lookup[6959];
-    case 0x1D570: *len = 1; return &unicode_decompose_lookup[6960];
-    case 0x1D571: *len = 1; return &unicode_decompose_lookup[6961];
-    case 0x1D572: *len = 1; return &unicode_decompose_lookup[6962];
-    case 0x1D573: *len = 1; return &unicode_decompose_lookup[6963];
-    case 0x1D574: *len = 1; return &unicode_decompose_lookup[6964];
-    case 0x1D575: *len = 1; return &unicode_decompose_lookup[6965];
-    case 0x1D576: *len = 1; return &unicode_decompose_lookup[6966];
-    case 0x1D577: *len = 1; return &unicode_decompose_lookup[6967];
-    case 0x1D578: *len = 1; return &unicode_decompose_lookup[6968];
-    case 0x1D579: *len = 1; return &unicode_decompose_lookup[6969];
-    case 0x1D57A: *len = 1; return &unicode_decompose_lookup[6970];
-    case 0x1D57B: *len = 1; return &unicode_decompose_lookup[6971];
-    case 0x1D57C: *len = 1; return &unicode_decompose_lookup[6972];
-    case 0x1D57D: *len = 1; return &unicode_decompose_lookup[6973];
-    case 0x1D57E: *len = 1; return &unicode_decompose_lookup[6974];
-    case 0x1D57F: *len = 1; return &unicode_decompose_lookup[6975];
-    case 0x1D580: *len = 1; return &unicode_decompose_lookup[6976];
-    case 0x1D581: *len = 1; return &unicode_decompose_lookup[6977];
-    case 0x1D582: *len = 1; return &unicode_decompose_lookup[6978];
-    case 0x1D583: *len = 1; return &unicode_decompose_lookup[6979];
-    case 0x1D584: *len = 1; return &unicode_decompose_lookup[6980];
-    case 0x1D585: *len = 1; return &unicode_decompose_lookup[6981];
-    case 0x1D586: *len = 1; return &unicode_decompose_lookup[6982];
-    case 0x1D587: *len = 1; return &unicode_decompose_lookup[6983];
-    case 0x1D588: *len = 1; return &unicode_decompose_lookup[6984];
-    case 0x1D589: *len = 1; return &unicode_decompose_lookup[6985];
-    case 0x1D58A: *len = 1; return &unicode_decompose_lookup[6986];
-    case 0x1D58B: *len = 1; return &unicode_decompose_lookup[6987];
-    case 0x1D58C: *len = 1; return &unicode_decompose_lookup[6988];
-    case 0x1D58D: *len = 1; return &unicode_decompose_lookup[6989];
-    case 0x1D58E: *len = 1; return &unicode_decompose_lookup[6990];
-    case 0x1D58F: *len = 1; return &unicode_decompose_lookup[6991];
-    case 0x1D590: *len = 1; return &unicode_decompose_lookup[6992];
-    case 0x1D591: *len = 1; return &unicode_decompose_lookup[6993];
-    case 0x1D592: *len = 1; return &unicode_decompose_lookup[6994];
-    case 0x1D593: *len = 1; return &unicode_decompose_lookup[6995];
-    case 0x1D594: *len = 1; return &unicode_decompose_lookup[6996];
-    case 0x1D595: *len = 1; return &unicode_decompose_lookup[6997];
-    case 0x1D596: *len = 1; return &unicode_decompose_lookup[6998];
-    case 0x1D597: *len = 1; return &unicode_decompose_lookup[6999];
-    case 0x1D598: *len = 1; return &unicode_decompose_lookup[7000];
-    case 0x1D599: *len = 1; return &unicode_decompose_lookup[7001];
-    case 0x1D59A: *len = 1; return &unicode_decompose_lookup[7002];
-    case 0x1D59B: *len = 1; return &unicode_decompose_lookup[7003];
-    case 0x1D59C: *len = 1; return &unicode_decompose_lookup[7004];
-    case 0x1D59D: *len = 1; return &unicode_decompose_lookup[7005];
-    case 0x1D59E: *len = 1; return &unicode_decompose_lookup[7006];
-    case 0x1D59F: *len = 1; return &unicode_decompose_lookup[7007];
-    case 0x1D5A0: *len = 1; return &unicode_decompose_lookup[7008];
-    case 0x1D5A1: *len = 1; return &unicode_decompose_lookup[7009];
-    case 0x1D5A2: *len = 1; return &unicode_decompose_lookup[7010];
-    case 0x1D5A3: *len = 1; return &unicode_decompose_lookup[7011];
-    case 0x1D5A4: *len = 1; return &unicode_decompose_lookup[7012];
-    case 0x1D5A5: *len = 1; return &unicode_decompose_lookup[7013];
-    case 0x1D5A6: *len = 1; return &unicode_decompose_lookup[7014];
-    case 0x1D5A7: *len = 1; return &unicode_decompose_lookup[7015];
-    case 0x1D5A8: *len = 1; return &unicode_decompose_lookup[7016];
-    case 0x1D5A9: *len = 1; return &unicode_decompose_lookup[7017];
-    case 0x1D5AA: *len = 1; return &unicode_decompose_lookup[7018];
-    case 0x1D5AB: *len = 1; return &unicode_decompose_lookup[7019];
-    case 0x1D5AC: *len = 1; return &unicode_decompose_lookup[7020];
-    case 0x1D5AD: *len = 1; return &unicode_decompose_lookup[7021];
-    case 0x1D5AE: *len = 1; return &unicode_decompose_lookup[7022];
-    case 0x1D5AF: *len = 1; return &unicode_decompose_lookup[7023];
-    case 0x1D5B0: *len = 1; return &unicode_decompose_lookup[7024];
-    case 0x1D5B1: *len = 1; return &unicode_decompose_lookup[7025];
-    case 0x1D5B2: *len = 1; return &unicode_decompose_lookup[7026];
-    case 0x1D5B3: *len = 1; return &unicode_decompose_lookup[7027];
-    case 0x1D5B4: *len = 1; return &unicode_decompose_lookup[7028];
-    case 0x1D5B5: *len = 1; return &unicode_decompose_lookup[7029];
-    case 0x1D5B6: *len = 1; return &unicode_decompose_lookup[7030];
-    case 0x1D5B7: *len = 1; return &unicode_decompose_lookup[7031];
-    case 0x1D5B8: *len = 1; return &unicode_decompose_lookup[7032];
-    case 0x1D5B9: *len = 1; return &unicode_decompose_lookup[7033];
-    case 0x1D5BA: *len = 1; return &unicode_decompose_lookup[7034];
-    case 0x1D5BB: *len = 1; return &unicode_decompose_lookup[7035];
-    case 0x1D5BC: *len = 1; return &unicode_decompose_lookup[7036];
-    case 0x1D5BD: *len = 1; return &unicode_decompose_lookup[7037];
-    case 0x1D5BE: *len = 1; return &unicode_decompose_lookup[7038];
-    case 0x1D5BF: *len = 1; return &unicode_decompose_lookup[7039];
-    case 0x1D5C0: *len = 1; return &unicode_decompose_lookup[7040];
-    case 0x1D5C1: *len = 1; return &unicode_decompose_lookup[7041];
-    case 0x1D5C2: *len = 1; return &unicode_decompose_lookup[7042];
-    case 0x1D5C3: *len = 1; return &unicode_decompose_lookup[7043];
-    case 0x1D5C4: *len = 1; return &unicode_decompose_lookup[7044];
-    case 0x1D5C5: *len = 1; return &unicode_decompose_lookup[7045];
-    case 0x1D5C6: *len = 1; return &unicode_decompose_lookup[7046];
-    case 0x1D5C7: *len = 1; return &unicode_decompose_lookup[7047];
-    case 0x1D5C8: *len = 1; return &unicode_decompose_lookup[7048];
-    case 0x1D5C9: *len = 1; return &unicode_decompose_lookup[7049];
-    case 0x1D5CA: *len = 1; return &unicode_decompose_lookup[7050];
-    case 0x1D5CB: *len = 1; return &unicode_decompose_lookup[7051];
-    case 0x1D5CC: *len = 1; return &unicode_decompose_lookup[7052];
-    case 0x1D5CD: *len = 1; return &unicode_decompose_lookup[7053];
-    case 0x1D5CE: *len = 1; return &unicode_decompose_lookup[7054];
-    case 0x1D5CF: *len = 1; return &unicode_decompose_lookup[7055];
-    case 0x1D5D0: *len = 1; return &unicode_decompose_lookup[7056];
-    case 0x1D5D1: *len = 1; return &unicode_decompose_lookup[7057];
-    case 0x1D5D2: *len = 1; return &unicode_decompose_lookup[7058];
-    case 0x1D5D3: *len = 1; return &unicode_decompose_lookup[7059];
-    case 0x1D5D4: *len = 1; return &unicode_decompose_lookup[7060];
-    case 0x1D5D5: *len = 1; return &unicode_decompose_lookup[7061];
-    case 0x1D5D6: *len = 1; return &unicode_decompose_lookup[7062];
-    case 0x1D5D7: *len = 1; return &unicode_decompose_lookup[7063];
-    case 0x1D5D8: *len = 1; return &unicode_decompose_lookup[7064];
-    case 0x1D5D9: *len = 1; return &unicode_decompose_lookup[7065];
-    case 0x1D5DA: *len = 1; return &unicode_decompose_lookup[7066];
-    case 0x1D5DB: *len = 1; return &unicode_decompose_lookup[7067];
-    case 0x1D5DC: *len = 1; return &unicode_decompose_lookup[7068];
-    case 0x1D5DD: *len = 1; return &unicode_decompose_lookup[7069];
-    case 0x1D5DE: *len = 1; return &unicode_decompose_lookup[7070];
-    case 0x1D5DF: *len = 1; return &unicode_decompose_lookup[7071];
-    case 0x1D5E0: *len = 1; return &unicode_decompose_lookup[7072];
-    case 0x1D5E1: *len = 1; return &unicode_decompose_lookup[7073];
-    case 0x1D5E2: *len = 1; return &unicode_decompose_lookup[7074];
-    case 0x1D5E3: *len = 1; return &unicode_decompose_lookup[7075];
-    case 0x1D5E4: *len = 1; return &unicode_decompose_lookup[7076];
-    case 0x1D5E5: *len = 1; return &unicode_decompose_lookup[7077];
-    case 0x1D5E6: *len = 1; return &unicode_decompose_lookup[7078];
-    case 0x1D5E7: *len = 1; return &unicode_decompose_lookup[7079];
-    case 0x1D5E8: *len = 1; return &unicode_decompose_lookup[7080];
-    case 0x1D5E9: *len = 1; return &unicode_decompose_lookup[7081];
-    case 0x1D5EA: *len = 1; return &unicode_decompose_lookup[7082];
-    case 0x1D5EB: *len = 1; return &unicode_decompose_lookup[7083];
-    case 0x1D5EC: *len = 1; return &unicode_decompose_lookup[7084];
-    case 0x1D5ED: *len = 1; return &unicode_decompose_lookup[7085];
-    case 0x1D5EE: *len = 1; return &unicode_decompose_lookup[7086];
-    case 0x1D5EF: *len = 1; return &unicode_decompose_lookup[7087];
-    case 0x1D5F0: *len = 1; return &unicode_decompose_lookup[7088];
-    case 0x1D5F1: *len = 1; return &unicode_decompose_lookup[7089];
-    case 0x1D5F2: *len = 1; return &unicode_decompose_lookup[7090];
-    case 0x1D5F3: *len = 1; return &unicode_decompose_lookup[7091];
-    case 0x1D5F4: *len = 1; return &unicode_decompose_lookup[7092];
-    case 0x1D5F5: *len = 1; return &unicode_decompose_lookup[7093];
-    case 0x1D5F6: *len = 1; return &unicode_decompose_lookup[7094];
-    case 0x1D5F7: *len = 1; return &unicode_decompose_lookup[7095];
-    case 0x1D5F8: *len = 1; return &unicode_decompose_lookup[7096];
-    case 0x1D5F9: *len = 1; return &unicode_decompose_lookup[7097];
-    case 0x1D5FA: *len = 1; return &unicode_decompose_lookup[7098];
-    case 0x1D5FB: *len = 1; return &unicode_decompose_lookup[7099];
-    case 0x1D5FC: *len = 1; return &unicode_decompose_lookup[7100];
-    case 0x1D5FD: *len = 1; return &unicode_decompose_lookup[7101];
-    case 0x1D5FE: *len = 1; return &unicode_decompose_lookup[7102];
-    case 0x1D5FF: *len = 1; return &unicode_decompose_lookup[7103];
-    case 0x1D600: *len = 1; return &unicode_decompose_lookup[7104];
-    case 0x1D601: *len = 1; return &unicode_decompose_lookup[7105];
-    case 0x1D602: *len = 1; return &unicode_decompose_lookup[7106];
-    case 0x1D603: *len = 1; return &unicode_decompose_lookup[7107];
-    case 0x1D604: *len = 1; return &unicode_decompose_lookup[7108];
-    case 0x1D605: *len = 1; return &unicode_decompose_lookup[7109];
-    case 0x1D606: *len = 1; return &unicode_decompose_lookup[7110];
-    case 0x1D607: *len = 1; return &unicode_decompose_lookup[7111];
-    case 0x1D608: *len = 1; return &unicode_decompose_lookup[7112];
-    case 0x1D609: *len = 1; return &unicode_decompose_lookup[7113];
-    case 0x1D60A: *len = 1; return &unicode_decompose_lookup[7114];
-    case 0x1D60B: *len = 1; return &unicode_decompose_lookup[7115];
-    case 0x1D60C: *len = 1; return &unicode_decompose_lookup[7116];
-    case 0x1D60D: *len = 1; return &unicode_decompose_lookup[7117];
-    case 0x1D60E: *len = 1; return &unicode_decompose_lookup[7118];
-    case 0x1D60F: *len = 1; return &unicode_decompose_lookup[7119];
-    case 0x1D610: *len = 1; return &unicode_decompose_lookup[7120];
-    case 0x1D611: *len = 1; return &unicode_decompose_lookup[7121];
-    case 0x1D612: *len = 1; return &unicode_decompose_lookup[7122];
-    case 0x1D613: *len = 1; return &unicode_decompose_lookup[7123];
-    case 0x1D614: *len = 1; return &unicode_decompose_lookup[7124];
-    case 0x1D615: *len = 1; return &unicode_decompose_lookup[7125];
-    case 0x1D616: *len = 1; return &unicode_decompose_lookup[7126];
-    case 0x1D617: *len = 1; return &unicode_decompose_lookup[7127];
-    case 0x1D618: *len = 1; return &unicode_decompose_lookup[7128];
-    case 0x1D619: *len = 1; return &unicode_decompose_lookup[7129];
-    case 0x1D61A: *len = 1; return &unicode_decompose_lookup[7130];
-    case 0x1D61B: *len = 1; return &unicode_decompose_lookup[7131];
-    case 0x1D61C: *len = 1; return &unicode_decompose_lookup[7132];
-    case 0x1D61D: *len = 1; return &unicode_decompose_lookup[7133];
-    case 0x1D61E: *len = 1; return &unicode_decompose_lookup[7134];
-    case 0x1D61F: *len = 1; return &unicode_decompose_lookup[7135];
-    case 0x1D620: *len = 1; return &unicode_decompose_lookup[7136];
-    case 0x1D621: *len = 1; return &unicode_decompose_lookup[7137];
-    case 0x1D622: *len = 1; return &unicode_decompose_lookup[7138];
-    case 0x1D623: *len = 1; return &unicode_decompose_lookup[7139];
-    case 0x1D624: *len = 1; return &unicode_decompose_lookup[7140];
-    case 0x1D625: *len = 1; return &unicode_decompose_lookup[7141];
-    case 0x1D626: *len = 1; return &unicode_decompose_lookup[7142];
-    case 0x1D627: *len = 1; return &unicode_decompose_lookup[7143];
-    case 0x1D628: *len = 1; return &unicode_decompose_lookup[7144];
-    case 0x1D629: *len = 1; return &unicode_decompose_lookup[7145];
-    case 0x1D62A: *len = 1; return &unicode_decompose_lookup[7146];
-    case 0x1D62B: *len = 1; return &unicode_decompose_lookup[7147];
-    case 0x1D62C: *len = 1; return &unicode_decompose_lookup[7148];
-    case 0x1D62D: *len = 1; return &unicode_decompose_lookup[7149];
-    case 0x1D62E: *len = 1; return &unicode_decompose_lookup[7150];
-    case 0x1D62F: *len = 1; return &unicode_decompose_lookup[7151];
-    case 0x1D630: *len = 1; return &unicode_decompose_lookup[7152];
-    case 0x1D631: *len = 1; return &unicode_decompose_lookup[7153];
-    case 0x1D632: *len = 1; return &unicode_decompose_lookup[7154];
-    case 0x1D633: *len = 1; return &unicode_decompose_lookup[7155];
-    case 0x1D634: *len = 1; return &unicode_decompose_lookup[7156];
-    case 0x1D635: *len = 1; return &unicode_decompose_lookup[7157];
-    case 0x1D636: *len = 1; return &unicode_decompose_lookup[7158];
-    case 0x1D637: *len = 1; return &unicode_decompose_lookup[7159];
-    case 0x1D638: *len = 1; return &unicode_decompose_lookup[7160];
-    case 0x1D639: *len = 1; return &unicode_decompose_lookup[7161];
-    case 0x1D63A: *len = 1; return &unicode_decompose_lookup[7162];
-    case 0x1D63B: *len = 1; return &unicode_decompose_lookup[7163];
-    case 0x1D63C: *len = 1; return &unicode_decompose_lookup[7164];
-    case 0x1D63D: *len = 1; return &unicode_decompose_lookup[7165];
-    case 0x1D63E: *len = 1; return &unicode_decompose_lookup[7166];
-    case 0x1D63F: *len = 1; return &unicode_decompose_lookup[7167];
-    case 0x1D640: *len = 1; return &unicode_decompose_lookup[7168];
-    case 0x1D641: *len = 1; return &unicode_decompose_lookup[7169];
-    case 0x1D642: *len = 1; return &unicode_decompose_lookup[7170];
-    case 0x1D643: *len = 1; return &unicode_decompose_lookup[7171];
-    case 0x1D644: *len = 1; return &unicode_decompose_lookup[7172];
-    case 0x1D645: *len = 1; return &unicode_decompose_lookup[7173];
-    case 0x1D646: *len = 1; return &unicode_decompose_lookup[7174];
-    case 0x1D647: *len = 1; return &unicode_decompose_lookup[7175];
-    case 0x1D648: *len = 1; return &unicode_decompose_lookup[7176];
-    case 0x1D649: *len = 1; return &unicode_decompose_lookup[7177];
-    case 0x1D64A: *len = 1; return &unicode_decompose_lookup[7178];
-    case 0x1D64B: *len = 1; return &unicode_decompose_lookup[7179];
-    case 0x1D64C: *len = 1; return &unicode_decompose_lookup[7180];
-    case 0x1D64D: *len = 1; return &unicode_decompose_lookup[7181];
-    case 0x1D64E: *len = 1; return &unicode_decompose_lookup[7182];
-    case 0x1D64F: *len = 1; return &unicode_decompose_lookup[7183];
-    case 0x1D650: *len = 1; return &unicode_decompose_lookup[7184];
-    case 0x1D651: *len = 1; return &unicode_decompose_lookup[7185];
-    case 0x1D652: *len = 1; return &unicode_decompose_lookup[7186];
-    case 0x1D653: *len = 1; return &unicode_decompose_lookup[7187];
-    case 0x1D654: *len = 1; return &unicode_decompose_lookup[7188];
-    case 0x1D655: *len = 1; return &unicode_decompose_lookup[7189];
-    case 0x1D656: *len = 1; return &unicode_decompose_lookup[7190];
-    case 0x1D657: *len = 1; return &unicode_decompose_lookup[7191];
-    case 0x1D658: *len = 1; return &unicode_decompose_lookup[7192];
-    case 0x1D659: *len = 1; return &unicode_decompose_lookup[7193];
-    case 0x1D65A: *len = 1; return &unicode_decompose_lookup[7194];
-    case 0x1D65B: *len = 1; return &unicode_decompose_lookup[7195];
-    case 0x1D65C: *len = 1; return &unicode_decompose_lookup[7196];
-    case 0x1D65D: *len = 1; return &unicode_decompose_lookup[7197];
-    case 0x1D65E: *len = 1; return &unicode_decompose_lookup[7198];
-    case 0x1D65F: *len = 1; return &unicode_decompose_lookup[7199];
-    case 0x1D660: *len = 1; return &unicode_decompose_lookup[7200];
-    case 0x1D661: *len = 1; return &unicode_decompose_lookup[7201];
-    case 0x1D662: *len = 1; return &unicode_decompose_lookup[7202];
-    case 0x1D663: *len = 1; return &unicode_decompose_lookup[7203];
-    case 0x1D664: *len = 1; return &unicode_decompose_lookup[7204];
-    case 0x1D665: *len = 1; return &unicode_decompose_lookup[7205];
-    case 0x1D666: *len = 1; return &unicode_decompose_lookup[7206];
-    case 0x1D667: *len = 1; return &unicode_decompose_lookup[7207];
-    case 0x1D668: *len = 1; return &unicode_decompose_lookup[7208];
-    case 0x1D669: *len = 1; return &unicode_decompose_lookup[7209];
-    case 0x1D66A: *len = 1; return &unicode_decompose_lookup[7210];
-    case 0x1D66B: *len = 1; return &unicode_decompose_lookup[7211];
-    case 0x1D66C: *len = 1; return &unicode_decompose_lookup[7212];
-    case 0x1D66D: *len = 1; return &unicode_decompose_lookup[7213];
-    case 0x1D66E: *len = 1; return &unicode_decompose_lookup[7214];
-    case 0x1D66F: *len = 1; return &unicode_decompose_lookup[7215];
-    case 0x1D670: *len = 1; return &unicode_decompose_lookup[7216];
-    case 0x1D671: *len = 1; return &unicode_decompose_lookup[7217];
-    case 0x1D672: *len = 1; return &unicode_decompose_lookup[7218];
-    case 0x1D673: *len = 1; return &unicode_decompose_lookup[7219];
-    case 0x1D674: *len = 1; return &unicode_decompose_lookup[7220];
-    case 0x1D675: *len = 1; return &unicode_decompose_lookup[7221];
-    case 0x1D676: *len = 1; return &unicode_decompose_lookup[7222];
-    case 0x1D677: *len = 1; return &unicode_decompose_lookup[7223];
-    case 0x1D678: *len = 1; return &unicode_decompose_lookup[7224];
-    case 0x1D679: *len = 1; return &unicode_decompose_lookup[7225];
-    case 0x1D67A: *len = 1; return &unicode_decompose_lookup[7226];
-    case 0x1D67B: *len = 1; return &unicode_decompose_lookup[7227];
-    case 0x1D67C: *len = 1; return &unicode_decompose_lookup[7228];
-    case 0x1D67D: *len = 1; return &unicode_decompose_lookup[7229];
-    case 0x1D67E: *len = 1; return &unicode_decompose_lookup[7230];
-    case 0x1D67F: *len = 1; return &unicode_decompose_lookup[7231];
-    case 0x1D680: *len = 1; return &unicode_decompose_lookup[7232];
-    case 0x1D681: *len = 1; return &unicode_decompose_lookup[7233];
-    case 0x1D682: *len = 1; return &unicode_decompose_lookup[7234];
-    case 0x1D683: *len = 1; return &unicode_decompose_lookup[7235];
-    case 0x1D684: *len = 1; return &unicode_decompose_lookup[7236];
-    case 0x1D685: *len = 1; return &unicode_decompose_lookup[7237];
-    case 0x1D686: *len = 1; return &unicode_decompose_lookup[7238];
-    case 0x1D687: *len = 1; return &unicode_decompose_lookup[7239];
-    case 0x1D688: *len = 1; return &unicode_decompose_lookup[7240];
-    case 0x1D689: *len = 1; return &unicode_decompose_lookup[7241];
-    case 0x1D68A: *len = 1; return &unicode_decompose_lookup[7242];
-    case 0x1D68B: *len = 1; return &unicode_decompose_lookup[7243];
-    case 0x1D68C: *len = 1; return &unicode_decompose_lookup[7244];
-    case 0x1D68D: *len = 1; return &unicode_decompose_lookup[7245];
-    case 0x1D68E: *len = 1; return &unicode_decompose_lookup[7246];
-    case 0x1D68F: *len = 1; return &unicode_decompose_lookup[7247];
-    case 0x1D690: *len = 1; return &unicode_decompose_lookup[7248];
-    case 0x1D691: *len = 1; return &unicode_decompose_lookup[7249];
-    case 0x1D692: *len = 1; return &unicode_decompose_lookup[7250];
-    case 0x1D693: *len = 1; return &unicode_decompose_lookup[7251];
-    case 0x1D694: *len = 1; return &unicode_decompose_lookup[7252];
-    case 0x1D695: *len = 1; return &unicode_decompose_lookup[7253];
-    case 0x1D696: *len = 1; return &unicode_decompose_lookup[7254];
-    case 0x1D697: *len = 1; return &unicode_decompose_lookup[7255];
-    case 0x1D698: *len = 1; return &unicode_decompose_lookup[7256];
-    case 0x1D699: *len = 1; return &unicode_decompose_lookup[7257];
-    case 0x1D69A: *len = 1; return &unicode_decompose_lookup[7258];
-    case 0x1D69B: *len = 1; return &unicode_decompose_lookup[7259];
-    case 0x1D69C: *len = 1; return &unicode_decompose_lookup[7260];
-    case 0x1D69D: *len = 1; return &unicode_decompose_lookup[7261];
-    case 0x1D69E: *len = 1; return &unicode_decompose_lookup[7262];
-    case 0x1D69F: *len = 1; return &unicode_decompose_lookup[7263];
-    case 0x1D6A0: *len = 1; return &unicode_decompose_lookup[7264];
-    case 0x1D6A1: *len = 1; return &unicode_decompose_lookup[7265];
-    case 0x1D6A2: *len = 1; return &unicode_decompose_lookup[7266];
-    case 0x1D6A3: *len = 1; return &unicode_decompose_lookup[7267];
-    case 0x1D6A4: *len = 1; return &unicode_decompose_lookup[7268];
-    case 0x1D6A5: *len = 1; return &unicode_decompose_lookup[7269];
-    case 0x1D6A8: *len = 1; return &unicode_decompose_lookup[7270];
-    case 0x1D6A9: *len = 1; return &unicode_decompose_lookup[7271];
-    case 0x1D6AA: *len = 1; return &unicode_decompose_lookup[7272];
-    case 0x1D6AB: *len = 1; return &unicode_decompose_lookup[7273];
-    case 0x1D6AC: *len = 1; return &unicode_decompose_lookup[7274];
-    case 0x1D6AD: *len = 1; return &unicode_decompose_lookup[7275];
-    case 0x1D6AE: *len = 1; return &unicode_decompose_lookup[7276];
-    case 0x1D6AF: *len = 1; return &unicode_decompose_lookup[7277];
-    case 0x1D6B0: *len = 1; return &unicode_decompose_lookup[7278];
-    case 0x1D6B1: *len = 1; return &unicode_decompose_lookup[7279];
-    case 0x1D6B2: *len = 1; return &unicode_decompose_lookup[7280];
-    case 0x1D6B3: *len = 1; return &unicode_decompose_lookup[7281];
-    case 0x1D6B4: *len = 1; return &unicode_decompose_lookup[7282];
-    case 0x1D6B5: *len = 1; return &unicode_decompose_lookup[7283];
-    case 0x1D6B6: *len = 1; return &unicode_decompose_lookup[7284];
-    case 0x1D6B7: *len = 1; return &unicode_decompose_lookup[7285];
-    case 0x1D6B8: *len = 1; return &unicode_decompose_lookup[7286];
-    case 0x1D6B9: *len = 1; return &unicode_decompose_lookup[7287];
-    case 0x1D6BA: *len = 1; return &unicode_decompose_lookup[7288];
-    case 0x1D6BB: *len = 1; return &unicode_decompose_lookup[7289];
-    case 0x1D6BC: *len = 1; return &unicode_decompose_lookup[7290];
-    case 0x1D6BD: *len = 1; return &unicode_decompose_lookup[7291];
-    case 0x1D6BE: *len = 1; return &unicode_decompose_lookup[7292];
-    case 0x1D6BF: *len = 1; return &unicode_decompose_lookup[7293];
-    case 0x1D6C0: *len = 1; return &unicode_decompose_lookup[7294];
-    case 0x1D6C1: *len = 1; return &unicode_decompose_lookup[7295];
-    case 0x1D6C2: *len = 1; return &unicode_decompose_lookup[7296];
-    case 0x1D6C3: *len = 1; return &unicode_decompose_lookup[7297];
-    case 0x1D6C4: *len = 1; return &unicode_decompose_lookup[7298];
-    case 0x1D6C5: *len = 1; return &unicode_decompose_lookup[7299];
-    case 0x1D6C6: *len = 1; return &unicode_decompose_lookup[7300];
-    case 0x1D6C7: *len = 1; return &unicode_decompose_lookup[7301];
-    case 0x1D6C8: *len = 1; return &unicode_decompose_lookup[7302];
-    case 0x1D6C9: *len = 1; return &unicode_decompose_lookup[7303];
-    case 0x1D6CA: *len = 1; return &unicode_decompose_lookup[7304];
-    case 0x1D6CB: *len = 1; return &unicode_decompose_lookup[7305];
-    case 0x1D6CC: *len = 1; return &unicode_decompose_lookup[7306];
-    case 0x1D6CD: *len = 1; return &unicode_decompose_lookup[7307];
-    case 0x1D6CE: *len = 1; return &unicode_decompose_lookup[7308];
-    case 0x1D6CF: *len = 1; return &unicode_decompose_lookup[7309];
-    case 0x1D6D0: *len = 1; return &unicode_decompose_lookup[7310];
-    case 0x1D6D1: *len = 1; return &unicode_decompose_lookup[7311];
-    case 0x1D6D2: *len = 1; return &unicode_decompose_lookup[7312];
-    case 0x1D6D3: *len = 1; return &unicode_decompose_lookup[7313];
-    case 0x1D6D4: *len = 1; return &unicode_decompose_lookup[7314];
-    case 0x1D6D5: *len = 1; return &unicode_decompose_lookup[7315];
-    case 0x1D6D6: *len = 1; return &unicode_decompose_lookup[7316];
-    case 0x1D6D7: *len = 1; return &unicode_decompose_lookup[7317];
-    case 0x1D6D8: *len = 1; return &unicode_decompose_lookup[7318];
-    case 0x1D6D9: *len = 1; return &unicode_decompose_lookup[7319];
-    case 0x1D6DA: *len = 1; return &unicode_decompose_lookup[7320];
-    case 0x1D6DB: *len = 1; return &unicode_decompose_lookup[7321];
-    case 0x1D6DC: *len = 1; return &unicode_decompose_lookup[7322];
-    case 0x1D6DD: *len = 1; return &unicode_decompose_lookup[7323];
-    case 0x1D6DE: *len = 1; return &unicode_decompose_lookup[7324];
-    case 0x1D6DF: *len = 1; return &unicode_decompose_lookup[7325];
-    case 0x1D6E0: *len = 1; return &unicode_decompose_lookup[7326];
-    case 0x1D6E1: *len = 1; return &unicode_decompose_lookup[7327];
-    case 0x1D6E2: *len = 1; return &unicode_decompose_lookup[7328];
-    case 0x1D6E3: *len = 1; return &unicode_decompose_lookup[7329];
-    case 0x1D6E4: *len = 1; return &unicode_decompose_lookup[7330];
-    case 0x1D6E5: *len = 1; return &unicode_decompose_lookup[7331];
-    case 0x1D6E6: *len = 1; return &unicode_decompose_lookup[7332];
-    case 0x1D6E7: *len = 1; return &unicode_decompose_lookup[7333];
-    case 0x1D6E8: *len = 1; return &unicode_decompose_lookup[7334];
-    case 0x1D6E9: *len = 1; return &unicode_decompose_lookup[7335];
-    case 0x1D6EA: *len = 1; return &unicode_decompose_lookup[7336];
-    case 0x1D6EB: *len = 1; return &unicode_decompose_lookup[7337];
-    case 0x1D6EC: *len = 1; return &unicode_decompose_lookup[7338];
-    case 0x1D6ED: *len = 1; return &unicode_decompose_lookup[7339];
-    case 0x1D6EE: *len = 1; return &unicode_decompose_lookup[7340];
-    case 0x1D6EF: *len = 1; return &unicode_decompose_lookup[7341];
-    case 0x1D6F0: *len = 1; return &unicode_decompose_lookup[7342];
-    case 0x1D6F1: *len = 1; return &unicode_decompose_lookup[7343];
-    case 0x1D6F2: *len = 1; return &unicode_decompose_lookup[7344];
-    case 0x1D6F3: *len = 1; return &unicode_decompose_lookup[7345];
-    case 0x1D6F4: *len = 1; return &unicode_decompose_lookup[7346];
-    case 0x1D6F5: *len = 1; return &unicode_decompose_lookup[7347];
-    case 0x1D6F6: *len = 1; return &unicode_decompose_lookup[7348];
-    case 0x1D6F7: *len = 1; return &unicode_decompose_lookup[7349];
-    case 0x1D6F8: *len = 1; return &unicode_decompose_lookup[7350];
-    case 0x1D6F9: *len = 1; return &unicode_decompose_lookup[7351];
-    case 0x1D6FA: *len = 1; return &unicode_decompose_lookup[7352];
-    case 0x1D6FB: *len = 1; return &unicode_decompose_lookup[7353];
-    case 0x1D6FC: *len = 1; return &unicode_decompose_lookup[7354];
-    case 0x1D6FD: *len = 1; return &unicode_decompose_lookup[7355];
-    case 0x1D6FE: *len = 1; return &unicode_decompose_lookup[7356];
-    case 0x1D6FF: *len = 1; return &unicode_decompose_lookup[7357];
-    case 0x1D700: *len = 1; return &unicode_decompose_lookup[7358];
-    case 0x1D701: *len = 1; return &unicode_decompose_lookup[7359];
-    case 0x1D702: *len = 1; return &unicode_decompose_lookup[7360];
-    case 0x1D703: *len = 1; return &unicode_decompose_lookup[7361];
-    case 0x1D704: *len = 1; return &unicode_decompose_lookup[7362];
-    case 0x1D705: *len = 1; return &unicode_decompose_lookup[7363];
-    case 0x1D706: *len = 1; return &unicode_decompose_lookup[7364];
-    case 0x1D707: *len = 1; return &unicode_decompose_lookup[7365];
-    case 0x1D708: *len = 1; return &unicode_decompose_lookup[7366];
-    case 0x1D709: *len = 1; return &unicode_decompose_lookup[7367];
-    case 0x1D70A: *len = 1; return &unicode_decompose_lookup[7368];
-    case 0x1D70B: *len = 1; return &unicode_decompose_lookup[7369];
-    case 0x1D70C: *len = 1; return &unicode_decompose_lookup[7370];
-    case 0x1D70D: *len = 1; return &unicode_decompose_lookup[7371];
-    case 0x1D70E: *len = 1; return &unicode_decompose_lookup[7372];
-    case 0x1D70F: *len = 1; return &unicode_decompose_lookup[7373];
-    case 0x1D710: *len = 1; return &unicode_decompose_lookup[7374];
-    case 0x1D711: *len = 1; return &unicode_decompose_lookup[7375];
-    case 0x1D712: *len = 1; return &unicode_decompose_lookup[7376];
-    case 0x1D713: *len = 1; return &unicode_decompose_lookup[7377];
-    case 0x1D714: *len = 1; return &unicode_decompose_lookup[7378];
-    case 0x1D715: *len = 1; return &unicode_decompose_lookup[7379];
-    case 0x1D716: *len = 1; return &unicode_decompose_lookup[7380];
-    case 0x1D717: *len = 1; return &unicode_decompose_lookup[7381];
-    case 0x1D718: *len = 1; return &unicode_decompose_lookup[7382];
-    case 0x1D719: *len = 1; return &unicode_decompose_lookup[7383];
-    case 0x1D71A: *len = 1; return &unicode_decompose_lookup[7384];
-    case 0x1D71B: *len = 1; return &unicode_decompose_lookup[7385];
-    case 0x1D71C: *len = 1; return &unicode_decompose_lookup[7386];
-    case 0x1D71D: *len = 1; return &unicode_decompose_lookup[7387];
-    case 0x1D71E: *len = 1; return &unicode_decompose_lookup[7388];
-    case 0x1D71F: *len = 1; return &unicode_decompose_lookup[7389];
-    case 0x1D720: *len = 1; return &unicode_decompose_lookup[7390];
-    case 0x1D721: *len = 1; return &unicode_decompose_lookup[7391];
-    case 0x1D722: *len = 1; return &unicode_decompose_lookup[7392];
-    case 0x1D723: *len = 1; return &unicode_decompose_lookup[7393];
-    case 0x1D724: *len = 1; return &unicode_decompose_lookup[7394];
-    case 0x1D725: *len = 1; return &unicode_decompose_lookup[7395];
-    case 0x1D726: *len = 1; return &unicode_decompose_lookup[7396];
-    case 0x1D727: *len = 1; return &unicode_decompose_lookup[7397];
-    case 0x1D728: *len = 1; return &unicode_decompose_lookup[7398];
-    case 0x1D729: *len = 1; return &unicode_decompose_lookup[7399];
-    case 0x1D72A: *len = 1; return &unicode_decompose_lookup[7400];
-    case 0x1D72B: *len = 1; return &unicode_decompose_lookup[7401];
-    case 0x1D72C: *len = 1; return &unicode_decompose_lookup[7402];
-    case 0x1D72D: *len = 1; return &unicode_decompose_lookup[7403];
-    case 0x1D72E: *len = 1; return &unicode_decompose_lookup[7404];
-    case 0x1D72F: *len = 1; return &unicode_decompose_lookup[7405];
-    case 0x1D730: *len = 1; return &unicode_decompose_lookup[7406];
-    case 0x1D731: *len = 1; return &unicode_decompose_lookup[7407];
-    case 0x1D732: *len = 1; return &unicode_decompose_lookup[7408];
-    case 0x1D733: *len = 1; return &unicode_decompose_lookup[7409];
-    case 0x1D734: *len = 1; return &unicode_decompose_lookup[7410];
-    case 0x1D735: *len = 1; return &unicode_decompose_lookup[7411];
-    case 0x1D736: *len = 1; return &unicode_decompose_lookup[7412];
-    case 0x1D737: *len = 1; return &unicode_decompose_lookup[7413];
-    case 0x1D738: *len = 1; return &unicode_decompose_lookup[7414];
-    case 0x1D739: *len = 1; return &unicode_decompose_lookup[7415];
-    case 0x1D73A: *len = 1; return &unicode_decompose_lookup[7416];
-    case 0x1D73B: *len = 1; return &unicode_decompose_lookup[7417];
-    case 0x1D73C: *len = 1; return &unicode_decompose_lookup[7418];
-    case 0x1D73D: *len = 1; return &unicode_decompose_lookup[7419];
-    case 0x1D73E: *len = 1; return &unicode_decompose_lookup[7420];
-    case 0x1D73F: *len = 1; return &unicode_decompose_lookup[7421];
-    case 0x1D740: *len = 1; return &unicode_decompose_lookup[7422];
-    case 0x1D741: *len = 1; return &unicode_decompose_lookup[7423];
-    case 0x1D742: *len = 1; return &unicode_decompose_lookup[7424];
-    case 0x1D743: *len = 1; return &unicode_decompose_lookup[7425];
-    case 0x1D744: *len = 1; return &unicode_decompose_lookup[7426];
-    case 0x1D745: *len = 1; return &unicode_decompose_lookup[7427];
-    case 0x1D746: *len = 1; return &unicode_decompose_lookup[7428];
-    case 0x1D747: *len = 1; return &unicode_decompose_lookup[7429];
-    case 0x1D748: *len = 1; return &unicode_decompose_lookup[7430];
-    case 0x1D749: *len = 1; return &unicode_decompose_lookup[7431];
-    case 0x1D74A: *len = 1; return &unicode_decompose_lookup[7432];
-    case 0x1D74B: *len = 1; return &unicode_decompose_lookup[7433];
-    case 0x1D74C: *len = 1; return &unicode_decompose_lookup[7434];
-    case 0x1D74D: *len = 1; return &unicode_decompose_lookup[7435];
-    case 0x1D74E: *len = 1; return &unicode_decompose_lookup[7436];
-    case 0x1D74F: *len = 1; return &unicode_decompose_lookup[7437];
-    case 0x1D750: *len = 1; return &unicode_decompose_lookup[7438];
-    case 0x1D751: *len = 1; return &unicode_decompose_lookup[7439];
-    case 0x1D752: *len = 1; return &unicode_decompose_lookup[7440];
-    case 0x1D753: *len = 1; return &unicode_decompose_lookup[7441];
-    case 0x1D754: *len = 1; return &unicode_decompose_lookup[7442];
-    case 0x1D755: *len = 1; return &unicode_decompose_lookup[7443];
-    case 0x1D756: *len = 1; return &unicode_decompose_lookup[7444];
-    case 0x1D757: *len = 1; return &unicode_decompose_lookup[7445];
-    case 0x1D758: *len = 1; return &unicode_decompose_lookup[7446];
-    case 0x1D759: *len = 1; return &unicode_decompose_lookup[7447];
-    case 0x1D75A: *len = 1; return &unicode_decompose_lookup[7448];
-    case 0x1D75B: *len = 1; return &unicode_decompose_lookup[7449];
-    case 0x1D75C: *len = 1; return &unicode_decompose_lookup[7450];
-    case 0x1D75D: *len = 1; return &unicode_decompose_lookup[7451];
-    case 0x1D75E: *len = 1; return &unicode_decompose_lookup[7452];
-    case 0x1D75F: *len = 1; return &unicode_decompose_lookup[7453];
-    case 0x1D760: *len = 1; return &unicode_decompose_lookup[7454];
-    case 0x1D761: *len = 1; return &unicode_decompose_lookup[7455];
-    case 0x1D762: *len = 1; return &unicode_decompose_lookup[7456];
-    case 0x1D763: *len = 1; return &unicode_decompose_lookup[7457];
-    case 0x1D764: *len = 1; return &unicode_decompose_lookup[7458];
-    case 0x1D765: *len = 1; return &unicode_decompose_lookup[7459];
-    case 0x1D766: *len = 1; return &unicode_decompose_lookup[7460];
-    case 0x1D767: *len = 1; return &unicode_decompose_lookup[7461];
-    case 0x1D768: *len = 1; return &unicode_decompose_lookup[7462];
-    case 0x1D769: *len = 1; return &unicode_decompose_lookup[7463];
-    case 0x1D76A: *len = 1; return &unicode_decompose_lookup[7464];
-    case 0x1D76B: *len = 1; return &unicode_decompose_lookup[7465];
-    case 0x1D76C: *len = 1; return &unicode_decompose_lookup[7466];
-    case 0x1D76D: *len = 1; return &unicode_decompose_lookup[7467];
-    case 0x1D76E: *len = 1; return &unicode_decompose_lookup[7468];
-    case 0x1D76F: *len = 1; return &unicode_decompose_lookup[7469];
-    case 0x1D770: *len = 1; return &unicode_decompose_lookup[7470];
-    case 0x1D771: *len = 1; return &unicode_decompose_lookup[7471];
-    case 0x1D772: *len = 1; return &unicode_decompose_lookup[7472];
-    case 0x1D773: *len = 1; return &unicode_decompose_lookup[7473];
-    case 0x1D774: *len = 1; return &unicode_decompose_lookup[7474];
-    case 0x1D775: *len = 1; return &unicode_decompose_lookup[7475];
-    case 0x1D776: *len = 1; return &unicode_decompose_lookup[7476];
-    case 0x1D777: *len = 1; return &unicode_decompose_lookup[7477];
-    case 0x1D778: *len = 1; return &unicode_decompose_lookup[7478];
-    case 0x1D779: *len = 1; return &unicode_decompose_lookup[7479];
-    case 0x1D77A: *len = 1; return &unicode_decompose_lookup[7480];
-    case 0x1D77B: *len = 1; return &unicode_decompose_lookup[7481];
-    case 0x1D77C: *len = 1; return &unicode_decompose_lookup[7482];
-    case 0x1D77D: *len = 1; return &unicode_decompose_lookup[7483];
-    case 0x1D77E: *len = 1; return &unicode_decompose_lookup[7484];
-    case 0x1D77F: *len = 1; return &unicode_decompose_lookup[7485];
-    case 0x1D780: *len = 1; return &unicode_decompose_lookup[7486];
-    case 0x1D781: *len = 1; return &unicode_decompose_lookup[7487];
-    case 0x1D782: *len = 1; return &unicode_decompose_lookup[7488];
-    case 0x1D783: *len = 1; return &unicode_decompose_lookup[7489];
-    case 0x1D784: *len = 1; return &unicode_decompose_lookup[7490];
-    case 0x1D785: *len = 1; return &unicode_decompose_lookup[7491];
-    case 0x1D786: *len = 1; return &unicode_decompose_lookup[7492];
-    case 0x1D787: *len = 1; return &unicode_decompose_lookup[7493];
-    case 0x1D788: *len = 1; return &unicode_decompose_lookup[7494];
-    case 0x1D789: *len = 1; return &unicode_decompose_lookup[7495];
-    case 0x1D78A: *len = 1; return &unicode_decompose_lookup[7496];
-    case 0x1D78B: *len = 1; return &unicode_decompose_lookup[7497];
-    case 0x1D78C: *len = 1; return &unicode_decompose_lookup[7498];
-    case 0x1D78D: *len = 1; return &unicode_decompose_lookup[7499];
-    case 0x1D78E: *len = 1; return &unicode_decompose_lookup[7500];
-    case 0x1D78F: *len = 1; return &unicode_decompose_lookup[7501];
-    case 0x1D790: *len = 1; return &unicode_decompose_lookup[7502];
-    case 0x1D791: *len = 1; return &unicode_decompose_lookup[7503];
-    case 0x1D792: *len = 1; return &unicode_decompose_lookup[7504];
-    case 0x1D793: *len = 1; return &unicode_decompose_lookup[7505];
-    case 0x1D794: *len = 1; return &unicode_decompose_lookup[7506];
-    case 0x1D795: *len = 1; return &unicode_decompose_lookup[7507];
-    case 0x1D796: *len = 1; return &unicode_decompose_lookup[7508];
-    case 0x1D797: *len = 1; return &unicode_decompose_lookup[7509];
-    case 0x1D798: *len = 1; return &unicode_decompose_lookup[7510];
-    case 0x1D799: *len = 1; return &unicode_decompose_lookup[7511];
-    case 0x1D79A: *len = 1; return &unicode_decompose_lookup[7512];
-    case 0x1D79B: *len = 1; return &unicode_decompose_lookup[7513];
-    case 0x1D79C: *len = 1; return &unicode_decompose_lookup[7514];
-    case 0x1D79D: *len = 1; return &unicode_decompose_lookup[7515];
-    case 0x1D79E: *len = 1; return &unicode_decompose_lookup[7516];
-    case 0x1D79F: *len = 1; return &unicode_decompose_lookup[7517];
-    case 0x1D7A0: *len = 1; return &unicode_decompose_lookup[7518];
-    case 0x1D7A1: *len = 1; return &unicode_decompose_lookup[7519];
-    case 0x1D7A2: *len = 1; return &unicode_decompose_lookup[7520];
-    case 0x1D7A3: *len = 1; return &unicode_decompose_lookup[7521];
-    case 0x1D7A4: *len = 1; return &unicode_decompose_lookup[7522];
-    case 0x1D7A5: *len = 1; return &unicode_decompose_lookup[7523];
-    case 0x1D7A6: *len = 1; return &unicode_decompose_lookup[7524];
-    case 0x1D7A7: *len = 1; return &unicode_decompose_lookup[7525];
-    case 0x1D7A8: *len = 1; return &unicode_decompose_lookup[7526];
-    case 0x1D7A9: *len = 1; return &unicode_decompose_lookup[7527];
-    case 0x1D7AA: *len = 1; return &unicode_decompose_lookup[7528];
-    case 0x1D7AB: *len = 1; return &unicode_decompose_lookup[7529];
-    case 0x1D7AC: *len = 1; return &unicode_decompose_lookup[7530];
-    case 0x1D7AD: *len = 1; return &unicode_decompose_lookup[7531];
-    case 0x1D7AE: *len = 1; return &unicode_decompose_lookup[7532];
-    case 0x1D7AF: *len = 1; return &unicode_decompose_lookup[7533];
-    case 0x1D7B0: *len = 1; return &unicode_decompose_lookup[7534];
-    case 0x1D7B1: *len = 1; return &unicode_decompose_lookup[7535];
-    case 0x1D7B2: *len = 1; return &unicode_decompose_lookup[7536];
-    case 0x1D7B3: *len = 1; return &unicode_decompose_lookup[7537];
-    case 0x1D7B4: *len = 1; return &unicode_decompose_lookup[7538];
-    case 0x1D7B5: *len = 1; return &unicode_decompose_lookup[7539];
-    case 0x1D7B6: *len = 1; return &unicode_decompose_lookup[7540];
-    case 0x1D7B7: *len = 1; return &unicode_decompose_lookup[7541];
-    case 0x1D7B8: *len = 1; return &unicode_decompose_lookup[7542];
-    case 0x1D7B9: *len = 1; return &unicode_decompose_lookup[7543];
-    case 0x1D7BA: *len = 1; return &unicode_decompose_lookup[7544];
-    case 0x1D7BB: *len = 1; return &unicode_decompose_lookup[7545];
-    case 0x1D7BC: *len = 1; return &unicode_decompose_lookup[7546];
-    case 0x1D7BD: *len = 1; return &unicode_decompose_lookup[7547];
-    case 0x1D7BE: *len = 1; return &unicode_decompose_lookup[7548];
-    case 0x1D7BF: *len = 1; return &unicode_decompose_lookup[7549];
-    case 0x1D7C0: *len = 1; return &unicode_decompose_lookup[7550];
-    case 0x1D7C1: *len = 1; return &unicode_decompose_lookup[7551];
-    case 0x1D7C2: *len = 1; return &unicode_decompose_lookup[7552];
-    case 0x1D7C3: *len = 1; return &unicode_decompose_lookup[7553];
-    case 0x1D7C4: *len = 1; return &unicode_decompose_lookup[7554];
-    case 0x1D7C5: *len = 1; return &unicode_decompose_lookup[7555];
-    case 0x1D7C6: *len = 1; return &unicode_decompose_lookup[7556];
-    case 0x1D7C7: *len = 1; return &unicode_decompose_lookup[7557];
-    case 0x1D7C8: *len = 1; return &unicode_decompose_lookup[7558];
-    case 0x1D7C9: *len = 1; return &unicode_decompose_lookup[7559];
-    case 0x1D7CA: *len = 1; return &unicode_decompose_lookup[7560];
-    case 0x1D7CB: *len = 1; return &unicode_decompose_lookup[7561];
-    case 0x1D7CE: *len = 1; return &unicode_decompose_lookup[7562];
-    case 0x1D7CF: *len = 1; return &unicode_decompose_lookup[7563];
-    case 0x1D7D0: *len = 1; return &unicode_decompose_lookup[7564];
-    case 0x1D7D1: *len = 1; return &unicode_decompose_lookup[7565];
-    case 0x1D7D2: *len = 1; return &unicode_decompose_lookup[7566];
-    case 0x1D7D3: *len = 1; return &unicode_decompose_lookup[7567];
-    case 0x1D7D4: *len = 1; return &unicode_decompose_lookup[7568];
-    case 0x1D7D5: *len = 1; return &unicode_decompose_lookup[7569];
-    case 0x1D7D6: *len = 1; return &unicode_decompose_lookup[7570];
-    case 0x1D7D7: *len = 1; return &unicode_decompose_lookup[7571];
-    case 0x1D7D8: *len = 1; return &unicode_decompose_lookup[7572];
-    case 0x1D7D9: *len = 1; return &unicode_decompose_lookup[7573];
-    case 0x1D7DA: *len = 1; return &unicode_decompose_lookup[7574];
-    case 0x1D7DB: *len = 1; return &unicode_decompose_lookup[7575];
-    case 0x1D7DC: *len = 1; return &unicode_decompose_lookup[7576];
-    case 0x1D7DD: *len = 1; return &unicode_decompose_lookup[7577];
-    case 0x1D7DE: *len = 1; return &unicode_decompose_lookup[7578];
-    case 0x1D7DF: *len = 1; return &unicode_decompose_lookup[7579];
-    case 0x1D7E0: *len = 1; return &unicode_decompose_lookup[7580];
-    case 0x1D7E1: *len = 1; return &unicode_decompose_lookup[7581];
-    case 0x1D7E2: *len = 1; return &unicode_decompose_lookup[7582];
-    case 0x1D7E3: *len = 1; return &unicode_decompose_lookup[7583];
-    case 0x1D7E4: *len = 1; return &unicode_decompose_lookup[7584];
-    case 0x1D7E5: *len = 1; return &unicode_decompose_lookup[7585];
-    case 0x1D7E6: *len = 1; return &unicode_decompose_lookup[7586];
-    case 0x1D7E7: *len = 1; return &unicode_decompose_lookup[7587];
-    case 0x1D7E8: *len = 1; return &unicode_decompose_lookup[7588];
-    case 0x1D7E9: *len = 1; return &unicode_decompose_lookup[7589];
-    case 0x1D7EA: *len = 1; return &unicode_decompose_lookup[7590];
-    case 0x1D7EB: *len = 1; return &unicode_decompose_lookup[7591];
-    case 0x1D7EC: *len = 1; return &unicode_decompose_lookup[7592];
-    case 0x1D7ED: *len = 1; return &unicode_decompose_lookup[7593];
-    case 0x1D7EE: *len = 1; return &unicode_decompose_lookup[7594];
-    case 0x1D7EF: *len = 1; return &unicode_decompose_lookup[7595];
-    case 0x1D7F0: *len = 1; return &unicode_decompose_lookup[7596];
-    case 0x1D7F1: *len = 1; return &unicode_decompose_lookup[7597];
-    case 0x1D7F2: *len = 1; return &unicode_decompose_lookup[7598];
-    case 0x1D7F3: *len = 1; return &unicode_decompose_lookup[7599];
-    case 0x1D7F4: *len = 1; return &unicode_decompose_lookup[7600];
-    case 0x1D7F5: *len = 1; return &unicode_decompose_lookup[7601];
-    case 0x1D7F6: *len = 1; return &unicode_decompose_lookup[7602];
-    case 0x1D7F7: *len = 1; return &unicode_decompose_lookup[7603];
-    case 0x1D7F8: *len = 1; return &unicode_decompose_lookup[7604];
-    case 0x1D7F9: *len = 1; return &unicode_decompose_lookup[7605];
-    case 0x1D7FA: *len = 1; return &unicode_decompose_lookup[7606];
-    case 0x1D7FB: *len = 1; return &unicode_decompose_lookup[7607];
-    case 0x1D7FC: *len = 1; return &unicode_decompose_lookup[7608];
-    case 0x1D7FD: *len = 1; return &unicode_decompose_lookup[7609];
-    case 0x1D7FE: *len = 1; return &unicode_decompose_lookup[7610];
-    case 0x1D7FF: *len = 1; return &unicode_decompose_lookup[7611];
-    case 0x1EE00: *len = 1; return &unicode_decompose_lookup[7612];
-    case 0x1EE01: *len = 1; return &unicode_decompose_lookup[7613];
-    case 0x1EE02: *len = 1; return &unicode_decompose_lookup[7614];
-    case 0x1EE03: *len = 1; return &unicode_decompose_lookup[7615];
-    case 0x1EE05: *len = 1; return &unicode_decompose_lookup[7616];
-    case 0x1EE06: *len = 1; return &unicode_decompose_lookup[7617];
-    case 0x1EE07: *len = 1; return &unicode_decompose_lookup[7618];
-    case 0x1EE08: *len = 1; return &unicode_decompose_lookup[7619];
-    case 0x1EE09: *len = 1; return &unicode_decompose_lookup[7620];
-    case 0x1EE0A: *len = 1; return &unicode_decompose_lookup[7621];
-    case 0x1EE0B: *len = 1; return &unicode_decompose_lookup[7622];
-    case 0x1EE0C: *len = 1; return &unicode_decompose_lookup[7623];
-    case 0x1EE0D: *len = 1; return &unicode_decompose_lookup[7624];
-    case 0x1EE0E: *len = 1; return &unicode_decompose_lookup[7625];
-    case 0x1EE0F: *len = 1; return &unicode_decompose_lookup[7626];
-    case 0x1EE10: *len = 1; return &unicode_decompose_lookup[7627];
-    case 0x1EE11: *len = 1; return &unicode_decompose_lookup[7628];
-    case 0x1EE12: *len = 1; return &unicode_decompose_lookup[7629];
-    case 0x1EE13: *len = 1; return &unicode_decompose_lookup[7630];
-    case 0x1EE14: *len = 1; return &unicode_decompose_lookup[7631];
-    case 0x1EE15: *len = 1; return &unicode_decompose_lookup[7632];
-    case 0x1EE16: *len = 1; return &unicode_decompose_lookup[7633];
-    case 0x1EE17: *len = 1; return &unicode_decompose_lookup[7634];
-    case 0x1EE18: *len = 1; return &unicode_decompose_lookup[7635];
-    case 0x1EE19: *len = 1; return &unicode_decompose_lookup[7636];
-    case 0x1EE1A: *len = 1; return &unicode_decompose_lookup[7637];
-    case 0x1EE1B: *len = 1; return &unicode_decompose_lookup[7638];
-    case 0x1EE1C: *len = 1; return &unicode_decompose_lookup[7639];
-    case 0x1EE1D: *len = 1; return &unicode_decompose_lookup[7640];
-    case 0x1EE1E: *len = 1; return &unicode_decompose_lookup[7641];
-    case 0x1EE1F: *len = 1; return &unicode_decompose_lookup[7642];
-    case 0x1EE21: *len = 1; return &unicode_decompose_lookup[7643];
-    case 0x1EE22: *len = 1; return &unicode_decompose_lookup[7644];
-    case 0x1EE24: *len = 1; return &unicode_decompose_lookup[7645];
-    case 0x1EE27: *len = 1; return &unicode_decompose_lookup[7646];
-    case 0x1EE29: *len = 1; return &unicode_decompose_lookup[7647];
-    case 0x1EE2A: *len = 1; return &unicode_decompose_lookup[7648];
-    case 0x1EE2B: *len = 1; return &unicode_decompose_lookup[7649];
-    case 0x1EE2C: *len = 1; return &unicode_decompose_lookup[7650];
-    case 0x1EE2D: *len = 1; return &unicode_decompose_lookup[7651];
-    case 0x1EE2E: *len = 1; return &unicode_decompose_lookup[7652];
-    case 0x1EE2F: *len = 1; return &unicode_decompose_lookup[7653];
-    case 0x1EE30: *len = 1; return &unicode_decompose_lookup[7654];
-    case 0x1EE31: *len = 1; return &unicode_decompose_lookup[7655];
-    case 0x1EE32: *len = 1; return &unicode_decompose_lookup[7656];
-    case 0x1EE34: *len = 1; return &unicode_decompose_lookup[7657];
-    case 0x1EE35: *len = 1; return &unicode_decompose_lookup[7658];
-    case 0x1EE36: *len = 1; return &unicode_decompose_lookup[7659];
-    case 0x1EE37: *len = 1; return &unicode_decompose_lookup[7660];
-    case 0x1EE39: *len = 1; return &unicode_decompose_lookup[7661];
-    case 0x1EE3B: *len = 1; return &unicode_decompose_lookup[7662];
-    case 0x1EE42: *len = 1; return &unicode_decompose_lookup[7663];
-    case 0x1EE47: *len = 1; return &unicode_decompose_lookup[7664];
-    case 0x1EE49: *len = 1; return &unicode_decompose_lookup[7665];
-    case 0x1EE4B: *len = 1; return &unicode_decompose_lookup[7666];
-    case 0x1EE4D: *len = 1; return &unicode_decompose_lookup[7667];
-    case 0x1EE4E: *len = 1; return &unicode_decompose_lookup[7668];
-    case 0x1EE4F: *len = 1; return &unicode_decompose_lookup[7669];
-    case 0x1EE51: *len = 1; return &unicode_decompose_lookup[7670];
-    case 0x1EE52: *len = 1; return &unicode_decompose_lookup[7671];
-    case 0x1EE54: *len = 1; return &unicode_decompose_lookup[7672];
-    case 0x1EE57: *len = 1; return &unicode_decompose_lookup[7673];
-    case 0x1EE59: *len = 1; return &unicode_decompose_lookup[7674];
-    case 0x1EE5B: *len = 1; return &unicode_decompose_lookup[7675];
-    case 0x1EE5D: *len = 1; return &unicode_decompose_lookup[7676];
-    case 0x1EE5F: *len = 1; return &unicode_decompose_lookup[7677];
-    case 0x1EE61: *len = 1; return &unicode_decompose_lookup[7678];
-    case 0x1EE62: *len = 1; return &unicode_decompose_lookup[7679];
-    case 0x1EE64: *len = 1; return &unicode_decompose_lookup[7680];
-    case 0x1EE67: *len = 1; return &unicode_decompose_lookup[7681];
-    case 0x1EE68: *len = 1; return &unicode_decompose_lookup[7682];
-    case 0x1EE69: *len = 1; return &unicode_decompose_lookup[7683];
-    case 0x1EE6A: *len = 1; return &unicode_decompose_lookup[7684];
-    case 0x1EE6C: *len = 1; return &unicode_decompose_lookup[7685];
-    case 0x1EE6D: *len = 1; return &unicode_decompose_lookup[7686];
-    case 0x1EE6E: *len = 1; return &unicode_decompose_lookup[7687];
-    case 0x1EE6F: *len = 1; return &unicode_decompose_lookup[7688];
-    case 0x1EE70: *len = 1; return &unicode_decompose_lookup[7689];
-    case 0x1EE71: *len = 1; return &unicode_decompose_lookup[7690];
-    case 0x1EE72: *len = 1; return &unicode_decompose_lookup[7691];
-    case 0x1EE74: *len = 1; return &unicode_decompose_lookup[7692];
-    case 0x1EE75: *len = 1; return &unicode_decompose_lookup[7693];
-    case 0x1EE76: *len = 1; return &unicode_decompose_lookup[7694];
-    case 0x1EE77: *len = 1; return &unicode_decompose_lookup[7695];
-    case 0x1EE79: *len = 1; return &unicode_decompose_lookup[7696];
-    case 0x1EE7A: *len = 1; return &unicode_decompose_lookup[7697];
-    case 0x1EE7B: *len = 1; return &unicode_decompose_lookup[7698];
-    case 0x1EE7C: *len = 1; return &unicode_decompose_lookup[7699];
-    case 0x1EE7E: *len = 1; return &unicode_decompose_lookup[7700];
-    case 0x1EE80: *len = 1; return &unicode_decompose_lookup[7701];
-    case 0x1EE81: *len = 1; return &unicode_decompose_lookup[7702];
-    case 0x1EE82: *len = 1; return &unicode_decompose_lookup[7703];
-    case 0x1EE83: *len = 1; return &unicode_decompose_lookup[7704];
-    case 0x1EE84: *len = 1; return &unicode_decompose_lookup[7705];
-    case 0x1EE85: *len = 1; return &unicode_decompose_lookup[7706];
-    case 0x1EE86: *len = 1; return &unicode_decompose_lookup[7707];
-    case 0x1EE87: *len = 1; return &unicode_decompose_lookup[7708];
-    case 0x1EE88: *len = 1; return &unicode_decompose_lookup[7709];
-    case 0x1EE89: *len = 1; return &unicode_decompose_lookup[7710];
-    case 0x1EE8B: *len = 1; return &unicode_decompose_lookup[7711];
-    case 0x1EE8C: *len = 1; return &unicode_decompose_lookup[7712];
-    case 0x1EE8D: *len = 1; return &unicode_decompose_lookup[7713];
-    case 0x1EE8E: *len = 1; return &unicode_decompose_lookup[7714];
-    case 0x1EE8F: *len = 1; return &unicode_decompose_lookup[7715];
-    case 0x1EE90: *len = 1; return &unicode_decompose_lookup[7716];
-    case 0x1EE91: *len = 1; return &unicode_decompose_lookup[7717];
-    case 0x1EE92: *len = 1; return &unicode_decompose_lookup[7718];
-    case 0x1EE93: *len = 1; return &unicode_decompose_lookup[7719];
-    case 0x1EE94: *len = 1; return &unicode_decompose_lookup[7720];
-    case 0x1EE95: *len = 1; return &unicode_decompose_lookup[7721];
-    case 0x1EE96: *len = 1; return &unicode_decompose_lookup[7722];
-    case 0x1EE97: *len = 1; return &unicode_decompose_lookup[7723];
-    case 0x1EE98: *len = 1; return &unicode_decompose_lookup[7724];
-    case 0x1EE99: *len = 1; return &unicode_decompose_lookup[7725];
-    case 0x1EE9A: *len = 1; return &unicode_decompose_lookup[7726];
-    case 0x1EE9B: *len = 1; return &unicode_decompose_lookup[7727];
-    case 0x1EEA1: *len = 1; return &unicode_decompose_lookup[7728];
-    case 0x1EEA2: *len = 1; return &unicode_decompose_lookup[7729];
-    case 0x1EEA3: *len = 1; return &unicode_decompose_lookup[7730];
-    case 0x1EEA5: *len = 1; return &unicode_decompose_lookup[7731];
-    case 0x1EEA6: *len = 1; return &unicode_decompose_lookup[7732];
-    case 0x1EEA7: *len = 1; return &unicode_decompose_lookup[7733];
-    case 0x1EEA8: *len = 1; return &unicode_decompose_lookup[7734];
-    case 0x1EEA9: *len = 1; return &unicode_decompose_lookup[7735];
-    case 0x1EEAB: *len = 1; return &unicode_decompose_lookup[7736];
-    case 0x1EEAC: *len = 1; return &unicode_decompose_lookup[7737];
-    case 0x1EEAD: *len = 1; return &unicode_decompose_lookup[7738];
-    case 0x1EEAE: *len = 1; return &unicode_decompose_lookup[7739];
-    case 0x1EEAF: *len = 1; return &unicode_decompose_lookup[7740];
-    case 0x1EEB0: *len = 1; return &unicode_decompose_lookup[7741];
-    case 0x1EEB1: *len = 1; return &unicode_decompose_lookup[7742];
-    case 0x1EEB2: *len = 1; return &unicode_decompose_lookup[7743];
-    case 0x1EEB3: *len = 1; return &unicode_decompose_lookup[7744];
-    case 0x1EEB4: *len = 1; return &unicode_decompose_lookup[7745];
-    case 0x1EEB5: *len = 1; return &unicode_decompose_lookup[7746];
-    case 0x1EEB6: *len = 1; return &unicode_decompose_lookup[7747];
-    case 0x1EEB7: *len = 1; return &unicode_decompose_lookup[7748];
-    case 0x1EEB8: *len = 1; return &unicode_decompose_lookup[7749];
-    case 0x1EEB9: *len = 1; return &unicode_decompose_lookup[7750];
-    case 0x1EEBA: *len = 1; return &unicode_decompose_lookup[7751];
-    case 0x1EEBB: *len = 1; return &unicode_decompose_lookup[7752];
-    case 0x1F100: *len = 2; return &unicode_decompose_lookup[7753];
-    case 0x1F101: *len = 2; return &unicode_decompose_lookup[7755];
-    case 0x1F102: *len = 2; return &unicode_decompose_lookup[7757];
-    case 0x1F103: *len = 2; return &unicode_decompose_lookup[7759];
-    case 0x1F104: *len = 2; return &unicode_decompose_lookup[7761];
-    case 0x1F105: *len = 2; return &unicode_decompose_lookup[7763];
-    case 0x1F106: *len = 2; return &unicode_decompose_lookup[7765];
-    case 0x1F107: *len = 2; return &unicode_decompose_lookup[7767];
-    case 0x1F108: *len = 2; return &unicode_decompose_lookup[7769];
-    case 0x1F109: *len = 2; return &unicode_decompose_lookup[7771];
-    case 0x1F10A: *len = 2; return &unicode_decompose_lookup[7773];
-    case 0x1F110: *len = 3; return &unicode_decompose_lookup[7775];
-    case 0x1F111: *len = 3; return &unicode_decompose_lookup[7778];
-    case 0x1F112: *len = 3; return &unicode_decompose_lookup[7781];
-    case 0x1F113: *len = 3; return &unicode_decompose_lookup[7784];
-    case 0x1F114: *len = 3; return &unicode_decompose_lookup[7787];
-    case 0x1F115: *len = 3; return &unicode_decompose_lookup[7790];
-    case 0x1F116: *len = 3; return &unicode_decompose_lookup[7793];
-    case 0x1F117: *len = 3; return &unicode_decompose_lookup[7796];
-    case 0x1F118: *len = 3; return &unicode_decompose_lookup[7799];
-    case 0x1F119: *len = 3; return &unicode_decompose_lookup[7802];
-    case 0x1F11A: *len = 3; return &unicode_decompose_lookup[7805];
-    case 0x1F11B: *len = 3; return &unicode_decompose_lookup[7808];
-    case 0x1F11C: *len = 3; return &unicode_decompose_lookup[7811];
-    case 0x1F11D: *len = 3; return &unicode_decompose_lookup[7814];
-    case 0x1F11E: *len = 3; return &unicode_decompose_lookup[7817];
-    case 0x1F11F: *len = 3; return &unicode_decompose_lookup[7820];
-    case 0x1F120: *len = 3; return &unicode_decompose_lookup[7823];
-    case 0x1F121: *len = 3; return &unicode_decompose_lookup[7826];
-    case 0x1F122: *len = 3; return &unicode_decompose_lookup[7829];
-    case 0x1F123: *len = 3; return &unicode_decompose_lookup[7832];
-    case 0x1F124: *len = 3; return &unicode_decompose_lookup[7835];
-    case 0x1F125: *len = 3; return &unicode_decompose_lookup[7838];
-    case 0x1F126: *len = 3; return &unicode_decompose_lookup[7841];
-    case 0x1F127: *len = 3; return &unicode_decompose_lookup[7844];
-    case 0x1F128: *len = 3; return &unicode_decompose_lookup[7847];
-    case 0x1F129: *len = 3; return &unicode_decompose_lookup[7850];
-    case 0x1F12A: *len = 3; return &unicode_decompose_lookup[7853];
-    case 0x1F12B: *len = 1; return &unicode_decompose_lookup[7856];
-    case 0x1F12C: *len = 1; return &unicode_decompose_lookup[7857];
-    case 0x1F12D: *len = 2; return &unicode_decompose_lookup[7858];
-    case 0x1F12E: *len = 2; return &unicode_decompose_lookup[7860];
-    case 0x1F130: *len = 1; return &unicode_decompose_lookup[7862];
-    case 0x1F131: *len = 1; return &unicode_decompose_lookup[7863];
-    case 0x1F132: *len = 1; return &unicode_decompose_lookup[7864];
-    case 0x1F133: *len = 1; return &unicode_decompose_lookup[7865];
-    case 0x1F134: *len = 1; return &unicode_decompose_lookup[7866];
-    case 0x1F135: *len = 1; return &unicode_decompose_lookup[7867];
-    case 0x1F136: *len = 1; return &unicode_decompose_lookup[7868];
-    case 0x1F137: *len = 1; return &unicode_decompose_lookup[7869];
-    case 0x1F138: *len = 1; return &unicode_decompose_lookup[7870];
-    case 0x1F139: *len = 1; return &unicode_decompose_lookup[7871];
-    case 0x1F13A: *len = 1; return &unicode_decompose_lookup[7872];
-    case 0x1F13B: *len = 1; return &unicode_decompose_lookup[7873];
-    case 0x1F13C: *len = 1; return &unicode_decompose_lookup[7874];
-    case 0x1F13D: *len = 1; return &unicode_decompose_lookup[7875];
-    case 0x1F13E: *len = 1; return &unicode_decompose_lookup[7876];
-    case 0x1F13F: *len = 1; return &unicode_decompose_lookup[7877];
-    case 0x1F140: *len = 1; return &unicode_decompose_lookup[7878];
-    case 0x1F141: *len = 1; return &unicode_decompose_lookup[7879];
-    case 0x1F142: *len = 1; return &unicode_decompose_lookup[7880];
-    case 0x1F143: *len = 1; return &unicode_decompose_lookup[7881];
-    case 0x1F144: *len = 1; return &unicode_decompose_lookup[7882];
-    case 0x1F145: *len = 1; return &unicode_decompose_lookup[7883];
-    case 0x1F146: *len = 1; return &unicode_decompose_lookup[7884];
-    case 0x1F147: *len = 1; return &unicode_decompose_lookup[7885];
-    case 0x1F148: *len = 1; return &unicode_decompose_lookup[7886];
-    case 0x1F149: *len = 1; return &unicode_decompose_lookup[7887];
-    case 0x1F14A: *len = 2; return &unicode_decompose_lookup[7888];
-    case 0x1F14B: *len = 2; return &unicode_decompose_lookup[7890];
-    case 0x1F14C: *len = 2; return &unicode_decompose_lookup[7892];
-    case 0x1F14D: *len = 2; return &unicode_decompose_lookup[7894];
-    case 0x1F14E: *len = 3; return &unicode_decompose_lookup[7896];
-    case 0x1F14F: *len = 2; return &unicode_decompose_lookup[7899];
-    case 0x1F16A: *len = 2; return &unicode_decompose_lookup[7901];
-    case 0x1F16B: *len = 2; return &unicode_decompose_lookup[7903];
-    case 0x1F16C: *len = 2; return &unicode_decompose_lookup[7905];
-    case 0x1F190: *len = 2; return &unicode_decompose_lookup[7907];
-    case 0x1F200: *len = 2; return &unicode_decompose_lookup[7909];
-    case 0x1F201: *len = 2; return &unicode_decompose_lookup[7911];
-    case 0x1F202: *len = 1; return &unicode_decompose_lookup[7913];
-    case 0x1F210: *len = 1; return &unicode_decompose_lookup[7914];
-    case 0x1F211: *len = 1; return &unicode_decompose_lookup[7915];
-    case 0x1F212: *len = 1; return &unicode_decompose_lookup[7916];
-    case 0x1F213: *len = 1; return &unicode_decompose_lookup[7917];
-    case 0x1F214: *len = 1; return &unicode_decompose_lookup[7918];
-    case 0x1F215: *len = 1; return &unicode_decompose_lookup[7919];
-    case 0x1F216: *len = 1; return &unicode_decompose_lookup[7920];
-    case 0x1F217: *len = 1; return &unicode_decompose_lookup[7921];
-    case 0x1F218: *len = 1; return &unicode_decompose_lookup[7922];
-    case 0x1F219: *len = 1; return &unicode_decompose_lookup[7923];
-    case 0x1F21A: *len = 1; return &unicode_decompose_lookup[7924];
-    case 0x1F21B: *len = 1; return &unicode_decompose_lookup[7925];
-    case 0x1F21C: *len = 1; return &unicode_decompose_lookup[7926];
-    case 0x1F21D: *len = 1; return &unicode_decompose_lookup[7927];
-    case 0x1F21E: *len = 1; return &unicode_decompose_lookup[7928];
-    case 0x1F21F: *len = 1; return &unicode_decompose_lookup[7929];
-    case 0x1F220: *len = 1; return &unicode_decompose_lookup[7930];
-    case 0x1F221: *len = 1; return &unicode_decompose_lookup[7931];
-    case 0x1F222: *len = 1; return &unicode_decompose_lookup[7932];
-    case 0x1F223: *len = 1; return &unicode_decompose_lookup[7933];
-    case 0x1F224: *len = 1; return &unicode_decompose_lookup[7934];
-    case 0x1F225: *len = 1; return &unicode_decompose_lookup[7935];
-    case 0x1F226: *len = 1; return &unicode_decompose_lookup[7936];
-    case 0x1F227: *len = 1; return &unicode_decompose_lookup[7937];
-    case 0x1F228: *len = 1; return &unicode_decompose_lookup[7938];
-    case 0x1F229: *len = 1; return &unicode_decompose_lookup[7939];
-    case 0x1F22A: *len = 1; return &unicode_decompose_lookup[7940];
-    case 0x1F22B: *len = 1; return &unicode_decompose_lookup[7941];
-    case 0x1F22C: *len = 1; return &unicode_decompose_lookup[7942];
-    case 0x1F22D: *len = 1; return &unicode_decompose_lookup[7943];
-    case 0x1F22E: *len = 1; return &unicode_decompose_lookup[7944];
-    case 0x1F22F: *len = 1; return &unicode_decompose_lookup[7945];
-    case 0x1F230: *len = 1; return &unicode_decompose_lookup[7946];
-    case 0x1F231: *len = 1; return &unicode_decompose_lookup[7947];
-    case 0x1F232: *len = 1; return &unicode_decompose_lookup[7948];
-    case 0x1F233: *len = 1; return &unicode_decompose_lookup[7949];
-    case 0x1F234: *len = 1; return &unicode_decompose_lookup[7950];
-    case 0x1F235: *len = 1; return &unicode_decompose_lookup[7951];
-    case 0x1F236: *len = 1; return &unicode_decompose_lookup[7952];
-    case 0x1F237: *len = 1; return &unicode_decompose_lookup[7953];
-    case 0x1F238: *len = 1; return &unicode_decompose_lookup[7954];
-    case 0x1F239: *len = 1; return &unicode_decompose_lookup[7955];
-    case 0x1F23A: *len = 1; return &unicode_decompose_lookup[7956];
-    case 0x1F23B: *len = 1; return &unicode_decompose_lookup[7957];
-    case 0x1F240: *len = 3; return &unicode_decompose_lookup[7958];
-    case 0x1F241: *len = 3; return &unicode_decompose_lookup[7961];
-    case 0x1F242: *len = 3; return &unicode_decompose_lookup[7964];
-    case 0x1F243: *len = 3; return &unicode_decompose_lookup[7967];
-    case 0x1F244: *len = 3; return &unicode_decompose_lookup[7970];
-    case 0x1F245: *len = 3; return &unicode_decompose_lookup[7973];
-    case 0x1F246: *len = 3; return &unicode_decompose_lookup[7976];
-    case 0x1F247: *len = 3; return &unicode_decompose_lookup[7979];
-    case 0x1F248: *len = 3; return &unicode_decompose_lookup[7982];
-    case 0x1F250: *len = 1; return &unicode_decompose_lookup[7985];
-    case 0x1F251: *len = 1; return &unicode_decompose_lookup[7986];
+  uint32_t const* decomposition = &unicode_decompose_lookup[packed >> 11];
+  uint8_t canonical_len = packed & 0x1F;
+  if (!compatible) {
+    *len = canonical_len;
+  } else {
+    *len = (packed >> 5) & 0x1F;
+    if (packed & (1 << 10)) {
+      decomposition += canonical_len;
+    }
   }
-  *len = 0;
-  return nullptr;
+  return *len == 0 ? nullptr : decomposition;
 }
 
@@ -0,0 +1,337 @@
+#include "utfdecode.hpp"
+
+#include <dirent.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// How many files, and how many bytes of their output, per thread that may be
+// decoded ahead of the one being written, which limits the memory used by
+// buffered output:
+static constexpr size_t FILES_AHEAD_PER_JOB = 16;
+static constexpr size_t MEMORY_AHEAD_PER_JOB = 16 * 1024 * 1024;
+
+namespace {
+
+struct input_file_t {
+  std::string path;
+  // The errno of failing to open the file, or 0.
+  int open_error{0};
+  // Created when the file is decoded, and freed once its output and summary
+  // have been written.
+  std::unique_ptr<program_options_t> decoder;
+  bool started{false};
+  bool decoded{false};
+  // Set while the thread decoding the file waits for the output it has
+  // collected to be written, once the file is the next one to be written.
+  bool output_waiting{false};
+  // How much of the collected output counts towards the memory used ahead.
+  size_t memory_counted{0};
+};
+
+} // namespace
+
+static void add_input_file(std::vector<input_file_t> &files,
+                           std::string const &path, int open_error) {
+  files.emplace_back();
+  files.back().path = path;
+  files.back().open_error = open_error;
+}
+
+// Adds the files in a directory and its subdirectories, sorted by name so
+// that they are always reported in the same order. Symbolic links to
+// directories are not followed, as they could lead to cycles.
+static void add_directory(std::vector<input_file_t> &files,
+                          std::string const &path) {
+  DIR *dir = opendir(path.c_str());
+  if (dir == nullptr) {
+    add_input_file(files, path, errno);
+    return;
+  }
+  std::vector<std::string> names;
+  while (struct dirent *entry = readdir(dir)) {
+    if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+      names.push_back(entry->d_name);
+    }
+  }
+  closedir(dir);
+  std::sort(names.begin(), names.end());
+
+  for (auto const &name : names) {
+    std::string child = path + (path.back() == '/' ? "" : "/") + name;
+    struct stat stat_buffer;
+    if (lstat(child.c_str(), &stat_buffer) != 0) {
+      add_input_file(files, child, errno);
+    } else if (S_ISDIR(stat_buffer.st_mode)) {
+      add_directory(files, child);
+    } else if (S_ISREG(stat_buffer.st_mode) ||
+               (S_ISLNK(stat_buffer.st_mode) &&
+                stat(child.c_str(), &stat_buffer) == 0 &&
+                S_ISREG(stat_buffer.st_mode))) {
+      add_input_file(files, child, 0);
+    }
+  }
+}
+
+// Decodes a file with the given number of threads. If on_memory_full is
+// set, the output is collected in memory, with errors deferred, and
+// on_memory_full is called whenever another buffer's worth is collected.
+static void decode_file(program_options_t const &settings, input_file_t &file,
+                        unsigned jobs,
+                        std::function<void()> const &on_memory_full) {
+  if (file.open_error != 0) {
+    return;
+  }
+  // As for a single operand, "-" is standard input:
+  bool is_stdin = file.path == "-";
+  int fd = is_stdin ? STDIN_FILENO : open(file.path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    file.open_error = errno;
+    return;
+  }
+
+  file.decoder.reset(new program_options_t());
+  program_options_t &decoder = *file.decoder;
+  decoder.copy_settings(settings);
+  decoder.jobs = jobs;
+  decoder.input_fd = fd;
+  decoder.input_name = is_stdin ? "" : file.path;
+  bool in_memory = bool(on_memory_full);
+  decoder.defer_errors = in_memory;
+  decoder.output.in_memory = in_memory;
+  decoder.output.on_memory_full = on_memory_full;
+  decoder.read_and_echo();
+  decoder.flush_normalization_buffer();
+  decoder.output.flush();
+  if (!is_stdin) {
+    close(fd);
+  }
+  // Only the counters, deferred errors and collected output are needed
+  // until the file is written:
+  decoder.output.buffer.reset();
+}
+
+int program_options_t::decode_files(char **paths, int path_count) {
+  std::vector<input_file_t> files;
+  for (int i = 0; i < path_count; i++) {
+    struct stat stat_buffer;
+    if (stat(paths[i], &stat_buffer) == 0 && S_ISDIR(stat_buffer.st_mode)) {
+      add_directory(files, paths[i]);
+    } else {
+      add_input_file(files, paths[i], 0);
+    }
+  }
+
+  // With several threads, each thread has its own queue of files, dealt out
+  // in turn, and steals the first file of another queue when its own runs
+  // out. Files decoded ahead collect their output in memory, and everything
+  // is written in order here, so the result is the same whichever file is
+  // done first. The next file to be written is decoded here if no thread has
+  // taken it, and written straight to the output.
+  bool in_parallel = jobs > 1 && files.size() > 1;
+  std::mutex mutex;
+  std::condition_variable file_decoded;
+  std::condition_variable file_written;
+  std::vector<std::deque<size_t>> queues(in_parallel ? jobs : 0);
+  size_t files_written = 0;
+  size_t max_files_ahead = jobs * FILES_AHEAD_PER_JOB;
+  size_t memory_ahead = 0;
+  size_t max_memory_ahead = jobs * MEMORY_AHEAD_PER_JOB;
+  // Set to have the threads stop when aborting on an error.
+  bool stop = false;
+  for (size_t i = 0; i < files.size() && in_parallel; i++) {
+    queues[i % jobs].push_back(i);
+  }
+  std::vector<std::thread> threads;
+
+  // Writes the output that a file has collected so far, exiting once no
+  // other thread is decoding if an error in it aborts decoding.
+  auto write_collected_output = [&](input_file_t &file) {
+    program_options_t &decoder = *file.decoder;
+    input_name = decoder.input_name;
+    if (write_deferred_output(decoder, 0)) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+      }
+      file_written.notify_all();
+      for (auto &thread : threads) {
+        thread.join();
+      }
+      output.flush();
+      exit(EX_DATAERR);
+    }
+  };
+
+  // Called by the thread decoding a file ahead as its output piles up.
+  auto wait_for_room = [&](input_file_t &file, size_t i) {
+    std::vector<uint8_t> &memory = file.decoder->output.memory;
+    std::unique_lock<std::mutex> lock(mutex);
+    memory_ahead += memory.size() - file.memory_counted;
+    file.memory_counted = memory.size();
+    while (!stop) {
+      if (i == files_written) {
+        // The file is next to be written, so have its output written now:
+        file.output_waiting = true;
+        file_decoded.notify_all();
+        file_written.wait(lock,
+                          [&]() { return !file.output_waiting || stop; });
+        break;
+      }
+      if (memory_ahead <= max_memory_ahead) {
+        break;
+      }
+      file_written.wait(lock);
+    }
+    if (stop) {
+      // Nothing more is written, so drop the output instead of keeping it:
+      file.output_waiting = false;
+      memory_ahead -= file.memory_counted;
+      file.memory_counted = 0;
+      std::vector<uint8_t>().swap(memory);
+      file.decoder->deferred_errors.clear();
+    }
+  };
+
+  auto decode_files_from_queues = [&](size_t own_queue) {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stop) {
+      bool files_left = false;
+      bool found = false;
+      size_t i = 0;
+      for (size_t q = 0; q < queues.size() && !found; q++) {
+        std::deque<size_t> &queue = queues[(own_queue + q) % queues.size()];
+        while (!queue.empty() && files[queue.front()].started) {
+          queue.pop_front();
+        }
+        if (!queue.empty()) {
+          files_left = true;
+          i = queue.front();
+          if (i > files_written && i < files_written + max_files_ahead &&
+              memory_ahead < max_memory_ahead) {
+            queue.pop_front();
+            found = true;
+          }
+        }
+      }
+      if (found) {
+        input_file_t &file = files[i];
+        file.started = true;
+        lock.unlock();
+        decode_file(*this, file, 1, [&, i]() { wait_for_room(file, i); });
+        lock.lock();
+        if (file.decoder) {
+          memory_ahead +=
+              file.decoder->output.memory.size() - file.memory_counted;
+          file.memory_counted = file.decoder->output.memory.size();
+        }
+        file.decoded = true;
+        file_decoded.notify_all();
+      } else if (files_left) {
+        file_written.wait(lock);
+      } else {
+        return;
+      }
+    }
+  };
+  for (size_t i = 0; i < queues.size(); i++) {
+    threads.emplace_back(decode_files_from_queues, i);
+  }
+
+  bool open_failed = false;
+  for (auto &file : files) {
+    if (!in_parallel) {
+      decode_file(*this, file, jobs, nullptr);
+    } else {
+      std::unique_lock<std::mutex> lock(mutex);
+      if (!file.started) {
+        file.started = true;
+        lock.unlock();
+        file_written.notify_all();
+        if (error_handling == error_handling_t::ABORT) {
+          // Exiting on an error has to wait for the other threads, so pass
+          // the output through memory and write it from here:
+          decode_file(*this, file, jobs,
+                      [&]() { write_collected_output(file); });
+        } else {
+          output.flush();
+          decode_file(*this, file, jobs, nullptr);
+        }
+      } else {
+        while (true) {
+          file_decoded.wait(
+              lock, [&]() { return file.decoded || file.output_waiting; });
+          if (file.decoded) {
+            break;
+          }
+          lock.unlock();
+          write_collected_output(file);
+          lock.lock();
+          memory_ahead -= file.memory_counted;
+          file.memory_counted = 0;
+          file.output_waiting = false;
+          file_written.notify_all();
+        }
+      }
+    }
+
+    if (file.open_error != 0) {
+      output.flush();
+      fprintf(stderr, "%s - %s\n", file.path.c_str(),
+              strerror(file.open_error));
+      open_failed = true;
+    } else {
+      program_options_t &decoder = *file.decoder;
+      if (in_parallel) {
+        write_collected_output(file);
+      }
+      uint64_t file_bytes =
+          decoder.bytes_into_input - std::min(decoder.bytes_into_input,
+                                              byte_skip_offset);
+      codepoints_into_input += decoder.codepoints_into_input;
+      bytes_into_input += file_bytes;
+      error_count += decoder.error_count;
+      if (print_summary) {
+        output.flush();
+        char const *color_prefix = output_is_terminal ? "\x1B[35m" : "";
+        char const *color_suffix = output_is_terminal ? "\x1B[m" : "";
+        fprintf(stderr,
+                "%s%s: %" PRIu64 " code points from %" PRIu64
+                " bytes with %" PRIu64 " errors%s\n",
+                color_prefix, file.path.c_str(),
+                decoder.codepoints_into_input, file_bytes,
+                decoder.error_count, color_suffix);
+      }
+      file.decoder.reset();
+    }
+
+    if (in_parallel) {
+      std::lock_guard<std::mutex> lock(mutex);
+      memory_ahead -= file.memory_counted;
+      file.memory_counted = 0;
+      files_written++;
+      file_written.notify_all();
+    }
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  output.flush();
+  if (print_summary) {
+    char const *color_prefix = output_is_terminal ? "\x1B[35m" : "";
+    char const *color_suffix = output_is_terminal ? "\x1B[m" : "";
+    fprintf(stderr,
+            "%s%" PRIu64 " code points from %" PRIu64 " bytes with %" PRIu64
+            " errors in %zu files%s\n",
+            color_prefix, codepoints_into_input, bytes_into_input,
+            error_count, files.size(), color_suffix);
+  }
+
+  if (open_failed) {
+    return EX_NOINPUT;
+  }
+  return error_count == 0 ? EX_OK : EX_DATAERR;
+}
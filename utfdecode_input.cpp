@@ -0,0 +1,169 @@
+#include "utfdecode.hpp"
+
+std::vector<uint8_t> buffer_pool_t::acquire(size_t size) {
+  for (auto it = free_buffers.begin(); it != free_buffers.end(); ++it) {
+    if (it->size() >= size) {
+      std::vector<uint8_t> buffer = std::move(*it);
+      free_buffers.erase(it);
+      return buffer;
+    }
+  }
+  return std::vector<uint8_t>(size);
+}
+
+void buffer_pool_t::release(std::vector<uint8_t> buffer) {
+  if (!buffer.empty() && free_buffers.size() < MAX_FREE_BUFFERS) {
+    free_buffers.push_back(std::move(buffer));
+  }
+}
+
+void input_reader_t::open(int input_fd, bool is_terminal) {
+  fd = input_fd;
+  interactive = is_terminal;
+  block_size = interactive ? TERMINAL_BLOCK_SIZE : MIN_BLOCK_SIZE;
+
+  struct stat stat_buffer;
+  regular_file = fstat(fd, &stat_buffer) == 0 && S_ISREG(stat_buffer.st_mode);
+  if (regular_file) {
+    off_t current_position = lseek(fd, 0, SEEK_CUR);
+    file_position = current_position < 0 ? 0 : current_position;
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    if (!interactive && stat_buffer.st_size > 0 &&
+        uint64_t(stat_buffer.st_size) <= SIZE_MAX &&
+        file_position < uint64_t(stat_buffer.st_size)) {
+      void *mapping = mmap(nullptr, stat_buffer.st_size, PROT_READ,
+                           MAP_PRIVATE, fd, 0);
+      if (mapping != MAP_FAILED) {
+        mapped_data = static_cast<uint8_t *>(mapping);
+        mapped_size = stat_buffer.st_size;
+        mapped_position = file_position;
+#ifdef MADV_SEQUENTIAL
+        madvise(mapping, mapped_size, MADV_SEQUENTIAL);
+#endif
+#ifdef MADV_HUGEPAGE
+        madvise(mapping, mapped_size, MADV_HUGEPAGE);
+#endif
+      }
+    }
+  }
+}
+
+void input_reader_t::close() {
+  if (mapped_data != nullptr) {
+    munmap(mapped_data, mapped_size);
+    mapped_data = nullptr;
+    mapped_size = mapped_position = 0;
+  }
+  std::vector<std::vector<uint8_t>>().swap(pool.free_buffers);
+}
+
+uint64_t input_reader_t::skip(uint64_t count) {
+  if (mapped_data != nullptr) {
+    uint64_t skipping_now =
+        std::min(count, uint64_t(mapped_size - mapped_position));
+    mapped_position += skipping_now;
+    return skipping_now;
+  }
+
+  if (interactive || count == 0) {
+    return 0;
+  }
+
+  if (regular_file) {
+    struct stat stat_buffer;
+    if (fstat(fd, &stat_buffer) != 0) {
+      return 0;
+    }
+    uint64_t file_size = stat_buffer.st_size;
+    count = std::min(count, file_size - std::min(file_size, file_position));
+  }
+
+  // Seekable input (regular files and block devices) can be positioned
+  // directly, while pipes fail with ESPIPE and have to be read through.
+  off_t new_position = lseek(fd, count, SEEK_CUR);
+  if (new_position < 0) {
+    return 0;
+  }
+  file_position = new_position;
+  return count;
+}
+
+bool input_reader_t::wait_for_input(int timeout_ms) {
+  if (mapped_data != nullptr) {
+    return true;
+  }
+  struct pollfd poll_fd;
+  poll_fd.fd = fd;
+  poll_fd.events = POLLIN;
+  int result;
+  do {
+    result = poll(&poll_fd, 1, timeout_ms);
+  } while (result < 0 && errno == EINTR);
+  // Let read() report any error:
+  return result != 0;
+}
+
+bool input_reader_t::read_block(input_block_t &block) {
+  if (mapped_data != nullptr) {
+    if (mapped_position == mapped_size) {
+      return false;
+    }
+    block.data = mapped_data + mapped_position;
+    block.size = mapped_size - mapped_position;
+    mapped_position = mapped_size;
+    return true;
+  }
+
+  if (block.buffer.size() < block_size) {
+    pool.release(std::move(block.buffer));
+    block.buffer = pool.acquire(block_size);
+  }
+
+  ssize_t read_now;
+  do {
+    read_now = read(fd, block.buffer.data(), block_size);
+  } while (read_now < 0 && errno == EINTR);
+
+  if (read_now < 0) {
+    perror("read()");
+    return false;
+  } else if (read_now == 0) {
+    return false;
+  }
+
+  block.data = block.buffer.data();
+  block.size = read_now;
+
+  if (!interactive && size_t(read_now) == block_size &&
+      block_size < MAX_BLOCK_SIZE) {
+    // The input keeps up with us - use larger reads from now on:
+    block_size *= 2;
+  }
+
+  if (regular_file) {
+    file_position += read_now;
+#ifdef POSIX_FADV_WILLNEED
+    // Hint that the next block will be needed soon:
+    posix_fadvise(fd, file_position, block_size, POSIX_FADV_WILLNEED);
+#endif
+  }
+
+  return true;
+}
+
+void input_reader_t::release_block(input_block_t &block) {
+  block.data = nullptr;
+  block.size = 0;
+  pool.release(std::move(block.buffer));
+}
+
+int64_t input_reader_t::mapped_offset(uint8_t const *data) const {
+  if (mapped_data == nullptr || data < mapped_data ||
+      data >= mapped_data + mapped_size) {
+    return -1;
+  }
+  return data - mapped_data;
+}
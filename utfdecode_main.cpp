@@ -1,9 +1,15 @@
 #include "utfdecode.hpp"
 
+#include <thread>
+
+// The most threads to decode with per processor, with -j larger than that
+// being lowered to it.
+static constexpr unsigned MAX_JOBS_PER_CPU = 4;
+
 void print_usage_and_exit(char const *program_name, int exit_status) {
   fprintf(
       stderr,
-      "usage: %s [OPTIONS] [file]\n"
+      "usage: %s [OPTIONS] [file...]\n"
       "  -b, --block-info             Show block and plane information. Only "
       "relevant if using the 'decoding' format\n"
       "  -d, --decode-format FORMAT   Determine how input should be "
@@ -25,7 +31,12 @@ void print_usage_and_exit(char const *program_name, int exit_status) {
       "                               * decoding (default) - debug "
       "output of the complete decoding process\n"
       "                               * silent - no output\n"
+      "  -f, --flush-interval MS      Buffer output for up to the specified "
+      "amount of milliseconds instead of writing it after each read\n"
       "  -h, --help                   Show this help and exit\n"
+      "  -j, --jobs N                 Decode several files, or a single "
+      "input when decoding UTF-8, UTF-16 or UTF-32 into one of them or "
+      "'silent' without -n or -S, using N threads\n"
       "  -l, --limit LIMIT            Only decode up to the specified amount "
       "of bytes\n"
       "  -m, --malformed <ACTION>     Determine what should happen on "
@@ -43,6 +54,9 @@ void print_usage_and_exit(char const *program_name, int exit_status) {
       "before starting decoding\n"
       "  -q, --quiet-errors           Do not log decoding errors to stderr\n"
       "  -s, --summary                Show a summary at end of input\n"
+      "  -S, --stream-safe            Insert a combining grapheme joiner "
+      "(U+034F) to keep runs of combining characters from getting longer "
+      "than 30, as in the Unicode Stream-Safe Text Format\n"
       "  -t, --timestamps             Show a timestamp after each input "
       "read\n"
       "  -w, --wcwidth                Show information about the wcwidth "
@@ -57,13 +71,16 @@ int main(int argc, char **argv) {
   struct option getopt_options[] = {
       {"block-info", no_argument, nullptr, 'b'},
       {"encode-format", required_argument, nullptr, 'e'},
+      {"flush-interval", required_argument, nullptr, 'f'},
       {"decode-format", required_argument, nullptr, 'd'},
       {"help", no_argument, nullptr, 'h'},
+      {"jobs", required_argument, nullptr, 'j'},
       {"limit", required_argument, nullptr, 'l'},
       {"malformed", required_argument, nullptr, 'm'},
       {"normalization", required_argument, nullptr, 'n'},
       {"offset", required_argument, nullptr, 'o'},
       {"quiet-errors", no_argument, nullptr, 'q'},
+      {"stream-safe", no_argument, nullptr, 'S'},
       {"summary", no_argument, nullptr, 's'},
       {"timestamps", no_argument, nullptr, 't'},
       {"version", no_argument, nullptr, 'v'},
@@ -72,7 +89,7 @@ int main(int argc, char **argv) {
 
   while (true) {
     int option_index = 0;
-    int c = getopt_long(argc, argv, "bd:e:hl:m:n:o:qstvw", getopt_options,
+    int c = getopt_long(argc, argv, "bd:e:f:hj:l:m:n:o:qsStvw", getopt_options,
                         &option_index);
     if (c == -1)
       break;
@@ -138,10 +155,31 @@ int main(int argc, char **argv) {
         print_error_and_exit = true;
       }
       break;
+    case 'f':
+      options.output.flush_interval_ms = atoi(optarg);
+      if (options.output.flush_interval_ms <= 0) {
+        fprintf(stderr, "'%s' is not a valid flush interval\n", optarg);
+        print_error_and_exit = true;
+      }
+      break;
     case 'h':
       exit_status = EX_OK;
       print_error_and_exit = true;
       break;
+    case 'j': {
+      char *end;
+      errno = 0;
+      long jobs = strtol(optarg, &end, 10);
+      if (end == optarg || *end != 0 || errno != 0 || jobs < 1) {
+        fprintf(stderr, "'%s' is not a valid number of jobs\n", optarg);
+        print_error_and_exit = true;
+      } else {
+        // More threads than this only add overhead:
+        unsigned cpus = std::max(1u, std::thread::hardware_concurrency());
+        options.jobs = unsigned(std::min(jobs, long(MAX_JOBS_PER_CPU * cpus)));
+      }
+      break;
+    }
     case 'l':
       options.byte_skip_limit = atoi(optarg);
       if (options.byte_skip_limit == 0) {
@@ -164,13 +202,13 @@ int main(int argc, char **argv) {
       break;
     case 'n':
       if (strcmp(optarg, "NFD") == 0 || strcmp(optarg, "nfd") == 0) {
-        options.normalization_form = normalization_form_t::NFD;
+        options.normalizer.form = normalization_form_t::NFD;
       } else if (strcmp(optarg, "NFC") == 0 || strcmp(optarg, "nfc") == 0) {
-        options.normalization_form = normalization_form_t::NFC;
+        options.normalizer.form = normalization_form_t::NFC;
       } else if (strcmp(optarg, "NFKD") == 0 || strcmp(optarg, "nfkd") == 0) {
-        options.normalization_form = normalization_form_t::NFKD;
+        options.normalizer.form = normalization_form_t::NFKD;
       } else if (strcmp(optarg, "NFKC") == 0 || strcmp(optarg, "nfkc") == 0) {
-        options.normalization_form = normalization_form_t::NFKC;
+        options.normalizer.form = normalization_form_t::NFKC;
       } else {
         fprintf(stderr, "'%s' is not a valid normalization form\n", optarg);
         print_error_and_exit = true;
@@ -186,6 +224,9 @@ int main(int argc, char **argv) {
     case 'q':
       options.error_reporting = error_reporting_t::SILENT;
       break;
+    case 'S':
+      options.normalizer.stream_safe = true;
+      break;
     case 's':
       options.print_summary = true;
       break;
@@ -207,6 +248,17 @@ int main(int argc, char **argv) {
       print_usage_and_exit(argv[0], exit_status);
   }
 
+  options.output_is_terminal = isatty(STDOUT_FILENO);
+  options.output.line_buffered = options.output_is_terminal;
+
+  struct stat stat_buffer;
+  if (optind + 1 < argc ||
+      (optind + 1 == argc && stat(argv[optind], &stat_buffer) == 0 &&
+       S_ISDIR(stat_buffer.st_mode))) {
+    options.cleanup_and_exit(
+        options.decode_files(argv + optind, argc - optind));
+  }
+
   if (optind + 1 == argc) {
     if (strcmp(argv[optind], "-") != 0) {
       int file_fd = open(argv[optind], O_RDONLY);
@@ -220,13 +272,10 @@ int main(int argc, char **argv) {
         return EX_IOERR;
       }
       close(file_fd);
+      options.input_name = argv[optind];
     }
-  } else if (optind < argc) {
-    print_usage_and_exit(argv[0], EX_USAGE);
   }
 
-  options.output_is_terminal = isatty(STDOUT_FILENO);
-
   // If inputting textual code points, do not special case terminal input:
   options.input_is_terminal =
       (options.input_format != input_format_t::TEXTUAL_CODEPOINT) &&
@@ -245,11 +294,10 @@ int main(int argc, char **argv) {
     tcsetattr(STDIN_FILENO, TCSANOW, &vt_new);
   }
 
-  unicode_code_points_initialize();
-
   options.read_and_echo();
 
-  options.flush_normalization_non_starters(options.normalization_non_starters);
+  options.flush_normalization_buffer();
+  options.output.flush();
 
   if (options.print_summary) {
     char const *color_prefix = options.output_is_terminal ? "\x1B[35m" : "";
@@ -265,7 +313,7 @@ int main(int argc, char **argv) {
              options.output_format != output_format_t::DESCRIPTION_CODEPOINT &&
              options.output_format != output_format_t::DESCRIPTION_DECODING &&
              options.output_format != output_format_t::SILENT) {
-    printf("\n");
+    options.output.write("\n", 1);
   }
 
   int exit_status = options.error_count == 0 ? EX_OK : EX_DATAERR;
@@ -0,0 +1,269 @@
+#include "libutfdecode.hpp"
+
+static uint8_t combining_class(uint32_t packed_codepoint) {
+  return packed_codepoint >> COMBINING_CLASS_SHIFT;
+}
+
+static uint32_t compose_pair(uint32_t first, uint32_t second) {
+  // Unsigned wrap around makes these single range checks:
+  uint32_t l_index = first - HANGUL_L_BASE;
+  uint32_t v_index = second - HANGUL_V_BASE;
+  if (l_index < HANGUL_L_COUNT && v_index < HANGUL_V_COUNT) {
+    return HANGUL_S_BASE +
+           (l_index * HANGUL_V_COUNT + v_index) * HANGUL_T_COUNT;
+  }
+
+  uint32_t s_index = first - HANGUL_S_BASE;
+  uint32_t t_index = second - HANGUL_T_BASE;
+  if (s_index < HANGUL_S_COUNT && s_index % HANGUL_T_COUNT == 0 &&
+      t_index - 1 < HANGUL_T_COUNT - 1) {
+    return first + t_index;
+  }
+
+  return unicode_compose(first, second);
+}
+
+static uint8_t quick_check_not_yes(normalization_form_t form) {
+  switch (form) {
+  case normalization_form_t::NFD:
+    return QUICK_CHECK_NFD_NO;
+  case normalization_form_t::NFKD:
+    return QUICK_CHECK_NFKD_NO;
+  case normalization_form_t::NFC:
+    return QUICK_CHECK_NFC_NO | QUICK_CHECK_NFC_MAYBE;
+  case normalization_form_t::NFKC:
+    return QUICK_CHECK_NFKC_NO | QUICK_CHECK_NFKC_MAYBE;
+  default:
+    return 0;
+  }
+}
+
+size_t normalizer_t::push(uint32_t codepoint, uint32_t *normalized) {
+  output = normalized;
+  if (stream_safe) {
+    make_stream_safe(codepoint);
+  }
+  if (form != normalization_form_t::NONE) {
+    normalize_codepoint(codepoint);
+  } else {
+    *output++ = codepoint;
+  }
+  return output - normalized;
+}
+
+size_t normalizer_t::flush(uint32_t *normalized) {
+  output = normalized;
+  flush_buffer();
+  return output - normalized;
+}
+
+// See https://www.unicode.org/reports/tr15/#Stream_Safe_Text_Format
+static constexpr uint32_t COMBINING_GRAPHEME_JOINER = 0x034F;
+
+void normalizer_t::make_stream_safe(uint32_t codepoint) {
+  // Count the leading and trailing non-starters of the NFKD decomposition:
+  size_t leading_non_starters = 0;
+  size_t trailing_non_starters = 0;
+  uint8_t len;
+  uint32_t const *decomposed = unicode_decompose(codepoint, true, &len);
+  if (len == 0) {
+    // The code point is its own decomposition:
+    len = 1;
+    if (lookup_code_point(codepoint)->canonical_combining_class != 0) {
+      leading_non_starters = trailing_non_starters = 1;
+    }
+  } else {
+    while (leading_non_starters < len &&
+           combining_class(decomposed[leading_non_starters]) != 0) {
+      leading_non_starters++;
+    }
+    while (trailing_non_starters < len &&
+           combining_class(decomposed[len - 1 - trailing_non_starters]) != 0) {
+      trailing_non_starters++;
+    }
+  }
+
+  if (stream_safe_non_starters + leading_non_starters > MAX_NON_STARTERS) {
+    // The grapheme joiner is a starter which does not change the meaning of
+    // the text, but keeps any segment from getting longer:
+    if (form == normalization_form_t::NONE) {
+      *output++ = COMBINING_GRAPHEME_JOINER;
+    } else {
+      normalize_codepoint(COMBINING_GRAPHEME_JOINER);
+    }
+    stream_safe_non_starters = 0;
+  }
+
+  if (leading_non_starters == len) {
+    stream_safe_non_starters += leading_non_starters;
+  } else {
+    stream_safe_non_starters = trailing_non_starters;
+  }
+}
+
+void normalizer_t::normalize_codepoint(uint32_t codepoint) {
+  // A starter with a quick check value of Yes is a normalization boundary:
+  // nothing after it is reordered with or composed into what is before it,
+  // and it is left as is unless a following code point composes with it.
+  // So text consisting of such starters, which is most text, can be written
+  // out directly. See
+  // https://www.unicode.org/reports/tr15/#Detecting_Normalization_Forms
+  auto code_point_info = lookup_code_point(codepoint);
+  uint8_t codepoint_class = code_point_info->canonical_combining_class;
+  if (codepoint_class == 0 &&
+      (code_point_info->quick_check & quick_check_not_yes(form)) == 0) {
+    if (buffer_quick) {
+      *output++ = buffer[0];
+      buffer[0] = codepoint;
+    } else {
+      flush_buffer();
+      buffer[0] = codepoint;
+      buffer_size = 1;
+      buffer_quick = true;
+    }
+    return;
+  }
+
+  if (buffer_quick) {
+    // The following code point may affect the starter, so it has to go
+    // through the full decomposition and composition after all:
+    uint32_t starter = buffer[0];
+    buffer_size = 0;
+    buffer_quick = false;
+    decompose_codepoint(starter, 0);
+  }
+  decompose_codepoint(codepoint, codepoint_class);
+}
+
+void normalizer_t::decompose_codepoint(uint32_t codepoint,
+                                       uint8_t combining_class) {
+  uint32_t s_index = codepoint - HANGUL_S_BASE;
+  if (s_index < HANGUL_S_COUNT) {
+    // All jamos are starters:
+    append_to_buffer(HANGUL_L_BASE + s_index / HANGUL_N_COUNT);
+    append_to_buffer(HANGUL_V_BASE +
+                     (s_index % HANGUL_N_COUNT) / HANGUL_T_COUNT);
+    if (s_index % HANGUL_T_COUNT != 0) {
+      append_to_buffer(HANGUL_T_BASE + s_index % HANGUL_T_COUNT);
+    }
+    return;
+  }
+
+  bool compatible =
+      form == normalization_form_t::NFKC || form == normalization_form_t::NFKD;
+  uint8_t len;
+  uint32_t const *decomposed = unicode_decompose(codepoint, compatible, &len);
+  if (len == 0) {
+    append_to_buffer(
+        codepoint | uint32_t(combining_class) << COMBINING_CLASS_SHIFT);
+  } else {
+    for (uint8_t i = 0; i < len; i++) {
+      append_to_buffer(decomposed[i]);
+    }
+  }
+}
+
+void normalizer_t::append_to_buffer(uint32_t packed_codepoint) {
+  if (buffer_size == 0) {
+    buffer[buffer_size++] = packed_codepoint;
+    return;
+  }
+
+  if (combining_class(packed_codepoint) == 0) {
+    // A starter ends the segment, so nothing after it can be reordered with
+    // or composed into what is before it.
+    if (is_composing()) {
+      buffer[buffer_size++] = packed_codepoint;
+      compose_buffer();
+      // The last code point is now a starter which the following code points
+      // may compose with, so keep it as the start of the next segment:
+      for (size_t i = 0; i + 1 < buffer_size; i++) {
+        *output++ = buffer[i] & CODE_POINT_MASK;
+      }
+      buffer[0] = buffer[buffer_size - 1];
+      buffer_size = 1;
+      return;
+    }
+    flush_buffer();
+  } else {
+    size_t non_starters = buffer_size;
+    if (combining_class(buffer[0]) == 0) {
+      non_starters--;
+    }
+    if (non_starters == MAX_NON_STARTERS) {
+      // Text which is not stream-safe - normalize the segment so far on its
+      // own, which is as close as we get without unbounded buffering:
+      flush_buffer();
+    }
+  }
+  buffer[buffer_size++] = packed_codepoint;
+}
+
+void normalizer_t::compose_buffer() {
+  // Put the non-starters in canonical order with a stable insertion sort,
+  // which is fast for the short and mostly ordered segments of real text.
+  // The segment only contains non-starters after its first code point,
+  // except for a starter which was just appended at the end and which has to
+  // stay there.
+  size_t reorder_end = buffer_size;
+  if (reorder_end > 1 &&
+      combining_class(buffer[reorder_end - 1]) == 0) {
+    reorder_end--;
+  }
+  for (size_t i = 1; i < reorder_end; i++) {
+    uint32_t packed_codepoint = buffer[i];
+    uint8_t codepoint_class = combining_class(packed_codepoint);
+    size_t j = i;
+    while (j > 0 &&
+           combining_class(buffer[j - 1]) > codepoint_class) {
+      buffer[j] = buffer[j - 1];
+      j--;
+    }
+    buffer[j] = packed_codepoint;
+  }
+
+  if (!is_composing()) {
+    return;
+  }
+  // The canonical composition algorithm from section 3.11 of the Unicode
+  // standard. A code point is blocked from the starter if there is a code
+  // point between them with a combining class of zero or of at least its own.
+  size_t starter_position = 0;
+  uint32_t starter = buffer[0];
+  // Code points before the first starter cannot be composed with anything:
+  int last_class = combining_class(starter) == 0 ? 0 : 256;
+  size_t kept = 1;
+  for (size_t i = 1; i < buffer_size; i++) {
+    uint32_t codepoint = buffer[i];
+    int codepoint_class = combining_class(codepoint);
+    if (last_class < codepoint_class || last_class == 0) {
+      // Primary composites are starters, so the combining class stays 0:
+      uint32_t composite =
+          compose_pair(starter & CODE_POINT_MASK, codepoint & CODE_POINT_MASK);
+      if (composite != 0) {
+        buffer[starter_position] = composite;
+        starter = composite;
+        continue;
+      }
+    }
+    if (codepoint_class == 0) {
+      starter_position = kept;
+      starter = codepoint;
+    }
+    last_class = codepoint_class;
+    buffer[kept++] = codepoint;
+  }
+  buffer_size = kept;
+}
+
+void normalizer_t::flush_buffer() {
+  if (buffer_size == 0) {
+    return;
+  }
+  compose_buffer();
+  for (size_t i = 0; i < buffer_size; i++) {
+    *output++ = buffer[i] & CODE_POINT_MASK;
+  }
+  buffer_size = 0;
+  buffer_quick = false;
+}
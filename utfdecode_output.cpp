@@ -0,0 +1,219 @@
+#include "utfdecode.hpp"
+
+static int64_t current_time_ms() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return int64_t(tv.tv_sec) * 1000 + tv.tv_usec / 1000;
+}
+
+static void write_fully(int fd, struct iovec *iov, int iov_count) {
+  while (iov_count > 0) {
+    ssize_t written = writev(fd, iov, iov_count);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      perror("utfdecode: write()");
+      exit(EX_IOERR);
+    }
+    // Skip past what was written, which may end in the middle of a buffer:
+    while (iov_count > 0 && size_t(written) >= iov->iov_len) {
+      written -= iov->iov_len;
+      iov++;
+      iov_count--;
+    }
+    if (iov_count > 0) {
+      iov->iov_base = static_cast<uint8_t *>(iov->iov_base) + written;
+      iov->iov_len -= written;
+    }
+  }
+}
+
+void output_sink_t::write_out(struct iovec *iov, int iov_count) {
+  if (!in_memory) {
+    write_fully(fd, iov, iov_count);
+    return;
+  }
+  for (int i = 0; i < iov_count; i++) {
+    auto data = static_cast<uint8_t const *>(iov[i].iov_base);
+    size_t length = iov[i].iov_len;
+    // Collect a buffer's worth at a time, so that a large write does not
+    // pile up in memory before it can be written out:
+    while (length > 0) {
+      size_t piece = std::min(length, BUFFER_SIZE);
+      memory.insert(memory.end(), data, data + piece);
+      data += piece;
+      length -= piece;
+      if (on_memory_full && memory.size() >= memory_checked + BUFFER_SIZE) {
+        on_memory_full();
+        memory_checked = memory.size();
+      }
+    }
+  }
+}
+
+void output_sink_t::write(void const *data, size_t length) {
+  if (!buffer) {
+    buffer.reset(new uint8_t[BUFFER_SIZE]);
+  }
+
+  if (used + length > BUFFER_SIZE) {
+    if (length >= BUFFER_SIZE / 2) {
+      // Write large chunks directly together with what is buffered:
+      struct iovec iov[2];
+      iov[0].iov_base = buffer.get();
+      iov[0].iov_len = used;
+      iov[1].iov_base = const_cast<void *>(data);
+      iov[1].iov_len = length;
+      write_out(iov, 2);
+      used = 0;
+      last_flush_ms = current_time_ms();
+      return;
+    }
+    flush();
+  }
+
+  memcpy(buffer.get() + used, data, length);
+  used += length;
+
+  if (line_buffered && memchr(data, '\n', length) != nullptr) {
+    flush();
+  }
+}
+
+// Moves up to length bytes at input_offset in input_fd to the current
+// position of output_fd, returning the number of bytes moved.
+static size_t move_from_file(int input_fd, int64_t input_offset,
+                             int output_fd, size_t length) {
+  size_t moved = 0;
+#if defined(HAVE_SPLICE) || defined(HAVE_COPY_FILE_RANGE)
+  struct stat stat_buffer;
+  if (fstat(output_fd, &stat_buffer) != 0) {
+    return 0;
+  }
+  bool output_is_pipe = S_ISFIFO(stat_buffer.st_mode);
+  loff_t offset = input_offset;
+  while (moved < length) {
+    ssize_t moved_now = -1;
+    errno = ENOSYS;
+    if (output_is_pipe) {
+#ifdef HAVE_SPLICE
+      moved_now = splice(input_fd, &offset, output_fd, nullptr,
+                         length - moved, SPLICE_F_MORE);
+#endif
+    } else {
+#ifdef HAVE_COPY_FILE_RANGE
+      moved_now = copy_file_range(input_fd, &offset, output_fd, nullptr,
+                                  length - moved, 0);
+#endif
+    }
+    if (moved_now < 0 && errno == EINTR) {
+      continue;
+    } else if (moved_now <= 0) {
+      // Not supported between these files - let write() do the rest, and
+      // report the error if it is a real one:
+      break;
+    }
+    moved += moved_now;
+  }
+#else
+  (void)input_fd;
+  (void)input_offset;
+  (void)output_fd;
+  (void)length;
+#endif
+  return moved;
+}
+
+void output_sink_t::write_from_input(uint8_t const *data, size_t length,
+                                     int input_fd, int64_t input_offset) {
+  if (length < MIN_ZERO_COPY_LENGTH || input_offset < 0 || in_memory ||
+      line_buffered || !zero_copy) {
+    write(data, length);
+    return;
+  }
+  flush();
+  size_t moved = move_from_file(input_fd, input_offset, fd, length);
+  if (moved < length) {
+    zero_copy = false;
+    write(data + moved, length - moved);
+  }
+}
+
+uint8_t *output_sink_t::reserve(size_t length) {
+  if (!buffer) {
+    buffer.reset(new uint8_t[BUFFER_SIZE]);
+  }
+  if (used + length > BUFFER_SIZE) {
+    flush();
+  }
+  return buffer.get() + used;
+}
+
+void output_sink_t::commit(size_t length) {
+  uint8_t const *data = buffer.get() + used;
+  used += length;
+  if (line_buffered && memchr(data, '\n', length) != nullptr) {
+    flush();
+  }
+}
+
+void output_sink_t::vprintf(char const *fmt, va_list argp) {
+  if (!buffer) {
+    buffer.reset(new uint8_t[BUFFER_SIZE]);
+  }
+
+  va_list argp_copy;
+  va_copy(argp_copy, argp);
+  int length = vsnprintf(reinterpret_cast<char *>(buffer.get() + used),
+                         BUFFER_SIZE - used, fmt, argp_copy);
+  va_end(argp_copy);
+  if (length < 0) {
+    die_with_internal_error("vsnprintf() failed for '%s'", fmt);
+  }
+
+  if (used + length < BUFFER_SIZE) {
+    // The formatted text fitted in the buffer:
+    char const *formatted = reinterpret_cast<char *>(buffer.get() + used);
+    used += length;
+    if (line_buffered && memchr(formatted, '\n', length) != nullptr) {
+      flush();
+    }
+  } else {
+    std::vector<char> formatted(length + 1);
+    vsnprintf(formatted.data(), formatted.size(), fmt, argp);
+    write(formatted.data(), length);
+  }
+}
+
+void output_sink_t::printf(char const *fmt, ...) {
+  va_list argp;
+  va_start(argp, fmt);
+  vprintf(fmt, argp);
+  va_end(argp);
+}
+
+void output_sink_t::flush() {
+  if (used > 0) {
+    struct iovec iov;
+    iov.iov_base = buffer.get();
+    iov.iov_len = used;
+    write_out(&iov, 1);
+    used = 0;
+  }
+  last_flush_ms = current_time_ms();
+}
+
+int64_t output_sink_t::ms_until_flush() const {
+  if (used == 0) {
+    return -1;
+  }
+  int64_t remaining = last_flush_ms + flush_interval_ms - current_time_ms();
+  return remaining < 0 ? 0 : remaining;
+}
+
+void output_sink_t::flush_if_due() {
+  if (used > 0 && ms_until_flush() == 0) {
+    flush();
+  }
+}
@@ -0,0 +1,264 @@
+#include "utfdecode.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Large enough for the work of handing out a chunk to not matter, while
+// small enough to spread the input evenly over the threads and to keep the
+// buffered output small. Chunks are extended to the next boundary where
+// they can be decoded on their own, which is normally a few bytes away.
+static constexpr uint64_t CHUNK_SIZE = 256 * 1024;
+
+// How many chunks per thread that may be decoded ahead of the one being
+// written, which limits the memory used by buffered output:
+static constexpr size_t CHUNKS_AHEAD_PER_JOB = 4;
+
+namespace {
+
+// A chunk decoder, which is created when first needed and then reused for
+// every chunk in the same place of the window of chunks decoded ahead.
+struct chunk_t {
+  uint64_t start;
+  uint64_t end;
+  // Decodes the chunk into its own output buffer, counting code points and
+  // errors from the start of the chunk.
+  program_options_t decoder;
+  decoder_state_t state;
+  bool decoded{false};
+};
+
+} // namespace
+
+static uint64_t code_unit_size(input_format_t format) {
+  switch (format) {
+  case input_format_t::UTF16BE:
+  case input_format_t::UTF16LE:
+    return 2;
+  case input_format_t::UTF32BE:
+  case input_format_t::UTF32LE:
+    return 4;
+  default:
+    return 1;
+  }
+}
+
+// Moves a chunk boundary, which is at the start of a code unit, forward to
+// where decoding gives the same result whatever the input before it.
+static uint64_t align_chunk_boundary(input_format_t format,
+                                     uint8_t const *data, uint64_t length,
+                                     uint64_t boundary) {
+  switch (format) {
+  case input_format_t::UTF8:
+    // A byte which is not a continuation byte either starts a new sequence
+    // or is rejected, whatever state the decoder is in before it:
+    while (boundary < length && (data[boundary] & 0xc0) == 0x80) {
+      boundary++;
+    }
+    break;
+  case input_format_t::UTF16BE:
+  case input_format_t::UTF16LE:
+    // Any code unit but a leading surrogate completes what came before it:
+    while (boundary < length) {
+      uint8_t high_byte = (format == input_format_t::UTF16LE)
+                              ? data[boundary - 1]
+                              : data[boundary - 2];
+      if (high_byte < 0xD8 || high_byte > 0xDB) {
+        break;
+      }
+      boundary += 2;
+    }
+    break;
+  default:
+    // UTF-32 code units are decoded on their own.
+    break;
+  }
+  return boundary;
+}
+
+static void decode_chunk(uint8_t const *data, chunk_t &chunk,
+                         bool last_chunk) {
+  chunk.decoder.decode_block(data + chunk.start, chunk.end - chunk.start,
+                             chunk.state);
+  if (!last_chunk && chunk.state.utf.utf8_state != UTF8_ACCEPT) {
+    // The next chunk starts with a byte which is not a continuation byte, on
+    // which the unfinished sequence would have been rejected:
+    chunk.decoder.note_error(data[chunk.end], "expected continuation byte");
+    chunk.state.utf.utf8_state = UTF8_ACCEPT;
+  }
+  chunk.decoder.output.flush();
+}
+
+bool program_options_t::write_deferred_output(program_options_t &decoder,
+                                              uint64_t codepoints_before) {
+  std::vector<uint8_t> &decoded = decoder.output.memory;
+  size_t written = 0;
+  bool aborting = false;
+  for (auto const &error : decoder.deferred_errors) {
+    if (error.output_position > written) {
+      output.write(decoded.data() + written, error.output_position - written);
+      written = error.output_position;
+    }
+    if (defer_errors) {
+      deferred_errors.push_back(
+          {error.bytes_into_input,
+           codepoints_before + error.codepoints_into_input,
+           output.memory.size() + output.used, error.message});
+    } else if (error_reporting == error_reporting_t::REPORT_STDERR) {
+      report_error(error.bytes_into_input,
+                   codepoints_before + error.codepoints_into_input,
+                   error.message.c_str());
+    }
+    if (error_handling == error_handling_t::ABORT) {
+      aborting = true;
+      break;
+    }
+  }
+  if (!aborting && decoded.size() > written) {
+    output.write(decoded.data() + written, decoded.size() - written);
+  }
+
+  // Free the memory of what has been written:
+  std::vector<uint8_t>().swap(decoded);
+  std::vector<deferred_error_t>().swap(decoder.deferred_errors);
+  return aborting;
+}
+
+uint64_t program_options_t::decode_in_parallel(uint8_t const *data,
+                                               uint64_t length,
+                                               decoder_state_t &state) {
+  // Chunks can only be decoded independently of each other if decoding a
+  // code point does not depend on the ones before it:
+  bool encoding = output_format == output_format_t::UTF8 ||
+                  output_format == output_format_t::UTF16BE ||
+                  output_format == output_format_t::UTF16LE ||
+                  output_format == output_format_t::UTF32BE ||
+                  output_format == output_format_t::UTF32LE;
+  bool independent_code_points =
+      is_silent_output() || (encoding && !normalizer.is_active());
+  if (jobs <= 1 || input_is_terminal || !independent_code_points ||
+      input_format == input_format_t::TEXTUAL_CODEPOINT) {
+    return 0;
+  }
+
+  // Every chunk starts on the grid of code units that the first one, which
+  // may start in the middle of a code unit, continues:
+  uint64_t unit_size = code_unit_size(input_format);
+  uint64_t boundary =
+      (unit_size - state.utf.unit_size % unit_size) % unit_size;
+  std::vector<uint64_t> boundaries{0};
+  while (true) {
+    boundary = align_chunk_boundary(input_format, data, length,
+                                    boundary + CHUNK_SIZE);
+    if (boundary >= length) {
+      break;
+    }
+    boundaries.push_back(boundary);
+  }
+  boundaries.push_back(length);
+  if (boundaries.size() <= 2) {
+    return 0;
+  }
+
+  size_t chunk_count = boundaries.size() - 1;
+  std::vector<std::unique_ptr<chunk_t>> window(
+      std::min(size_t(jobs) * CHUNKS_AHEAD_PER_JOB, chunk_count));
+
+  std::mutex mutex;
+  std::condition_variable chunk_decoded;
+  std::condition_variable chunk_written;
+  size_t next_chunk = 0;
+  size_t chunks_written = 0;
+  // Set to have the threads stop taking chunks when aborting on an error.
+  bool stop = false;
+
+  auto decode_chunks = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      chunk_written.wait(lock, [&]() {
+        return stop || next_chunk == chunk_count ||
+               next_chunk - chunks_written < window.size();
+      });
+      if (stop || next_chunk == chunk_count) {
+        return;
+      }
+      size_t i = next_chunk++;
+      // The chunk which was in this place has been written, if any:
+      std::unique_ptr<chunk_t> &chunk = window[i % window.size()];
+      if (!chunk) {
+        chunk.reset(new chunk_t());
+        chunk->decoder.copy_settings(*this);
+        chunk->decoder.defer_errors = true;
+        chunk->decoder.output.in_memory = true;
+      }
+      chunk->start = boundaries[i];
+      chunk->end = boundaries[i + 1];
+      chunk->decoder.bytes_into_input = bytes_into_input + chunk->start;
+      chunk->decoder.codepoints_into_input = 0;
+      chunk->decoder.error_count = 0;
+      if (i == 0) {
+        chunk->state = state;
+        chunk->decoder.resync_pending = resync_pending;
+      } else {
+        chunk->state = decoder_state_t();
+        chunk->decoder.resync_pending = false;
+      }
+      lock.unlock();
+      decode_chunk(data, *chunk, i + 1 == chunk_count);
+      lock.lock();
+      chunk->decoded = true;
+      chunk_decoded.notify_all();
+    }
+  };
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < jobs && i < chunk_count; i++) {
+    threads.emplace_back(decode_chunks);
+  }
+
+  // Write the output of the chunks in input order as they are decoded:
+  bool aborting = false;
+  for (size_t i = 0; i < chunk_count && !aborting; i++) {
+    chunk_t *chunk;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      chunk_decoded.wait(lock, [&]() {
+        return next_chunk > i && window[i % window.size()]->decoded;
+      });
+      chunk = window[i % window.size()].get();
+    }
+
+    aborting = write_deferred_output(chunk->decoder, codepoints_into_input);
+    error_count += chunk->decoder.error_count;
+    codepoints_into_input += chunk->decoder.codepoints_into_input;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (i + 1 < chunk_count) {
+        // Leave the last chunk decoded, to continue from its state:
+        chunk->decoded = false;
+      }
+      chunks_written++;
+      stop = aborting;
+    }
+    chunk_written.notify_all();
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (aborting) {
+    if (defer_errors) {
+      // Whoever writes the output of this decoder aborts at the error:
+      bytes_into_input += length;
+      return length;
+    }
+    // Only exit once no thread uses the decoder any more:
+    output.flush();
+    exit(EX_DATAERR);
+  }
+
+  chunk_t &last_chunk = *window[(chunk_count - 1) % window.size()];
+  state = last_chunk.state;
+  resync_pending = last_chunk.decoder.resync_pending;
+  bytes_into_input += length;
+  return length;
+}
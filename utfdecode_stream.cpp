@@ -0,0 +1,199 @@
+#include "libutfdecode.hpp"
+
+#include <algorithm>
+
+void stream_decoder_t::feed(uint8_t const *data, size_t length) {
+  bool to_utf8 = encode_output && output_encoding == utf_encoding_t::UTF8 &&
+                 !normalizer.is_active();
+  bool pass_through = to_utf8 && input_encoding == utf_encoding_t::UTF8;
+  bool transcode_to_utf8 = to_utf8 && !pass_through;
+  bool transcode_from_utf8 = encode_output && !to_utf8 &&
+                             input_encoding == utf_encoding_t::UTF8 &&
+                             !normalizer.is_active();
+  byte_decoder.encoding = input_encoding;
+  size_t decode_bytewise_until = 0;
+  for (size_t i = 0; i < length; i++) {
+    if (i >= decode_bytewise_until) {
+      if (pass_through && byte_decoder.is_idle()) {
+        // Valid input is already its own output, so hand it over as is and
+        // only decode the rest byte by byte to find the errors in it:
+        size_t valid_length = utf8_valid_prefix_length(data + i, length - i);
+        if (valid_length > 0) {
+          flush_batch();
+          handler->on_output(data + i, valid_length);
+          codepoints_into_input +=
+              utf8_count_codepoints(data + i, valid_length);
+          bytes_into_input += valid_length;
+          i += valid_length;
+        }
+      } else if (transcode_to_utf8 && byte_decoder.is_idle()) {
+        i += transcode_to_utf8_in_bulk(data + i, length - i);
+      } else if (transcode_from_utf8 && byte_decoder.is_idle()) {
+        i += transcode_from_utf8_in_bulk(data + i, length - i);
+      }
+      decode_bytewise_until = i + 64;
+      if (i == length) {
+        break;
+      }
+    }
+    byte_decoder.decode(data[i], *this);
+    bytes_into_input++;
+  }
+}
+
+size_t stream_decoder_t::transcode_to_utf8_in_bulk(uint8_t const *data,
+                                                   size_t length) {
+  flush_batch();
+  bool from_utf16 = input_encoding == utf_encoding_t::UTF16LE ||
+                    input_encoding == utf_encoding_t::UTF16BE;
+  bool little_endian = input_encoding == utf_encoding_t::UTF16LE ||
+                       input_encoding == utf_encoding_t::UTF32LE;
+  auto transcode =
+      from_utf16 ? transcode_utf16_to_utf8 : transcode_utf32_to_utf8;
+  // Transcode in pieces whose output fits in the output batch:
+  size_t piece_size = from_utf16 ? sizeof(encoded) / 3 * 2 : sizeof(encoded);
+  size_t position = 0;
+  while (position < length) {
+    size_t piece = std::min(length - position, piece_size);
+    uint64_t codepoints;
+    size_t transcoded = transcode(data + position, piece, little_endian,
+                                  encoded, encoded_size, codepoints);
+    flush_batch();
+    codepoints_into_input += codepoints;
+    position += transcoded;
+    if (transcoded == 0) {
+      break;
+    }
+  }
+  bytes_into_input += position;
+  return position;
+}
+
+size_t stream_decoder_t::transcode_from_utf8_in_bulk(uint8_t const *data,
+                                                     size_t length) {
+  flush_batch();
+  bool to_utf16 = output_encoding == utf_encoding_t::UTF16LE ||
+                  output_encoding == utf_encoding_t::UTF16BE;
+  bool little_endian = output_encoding == utf_encoding_t::UTF16LE ||
+                       output_encoding == utf_encoding_t::UTF32LE;
+  auto transcode = to_utf16 ? transcode_utf8_to_utf16 : transcode_utf8_to_utf32;
+  // Transcode in pieces whose output fits in the output batch:
+  size_t piece_size = sizeof(encoded) / (to_utf16 ? 2 : 4);
+  size_t position = 0;
+  while (position < length) {
+    size_t piece = std::min(length - position, piece_size);
+    uint64_t codepoints;
+    size_t transcoded = transcode(data + position, piece, little_endian,
+                                  encoded, encoded_size, codepoints);
+    flush_batch();
+    codepoints_into_input += codepoints;
+    position += transcoded;
+    if (transcoded == 0) {
+      break;
+    }
+  }
+  bytes_into_input += position;
+  return position;
+}
+
+void stream_decoder_t::finish() {
+  if (!byte_decoder.is_idle()) {
+    byte_decoder.reset();
+    error(bytes_into_input, "incomplete sequence at end of input");
+  }
+  uint32_t normalized[normalizer_t::MAX_OUTPUT];
+  size_t count = normalizer.flush(normalized);
+  for (size_t i = 0; i < count; i++) {
+    emit_codepoint(normalized[i]);
+  }
+  flush_batch();
+}
+
+void stream_decoder_t::reset() {
+  normalizer.buffer_size = 0;
+  normalizer.buffer_quick = false;
+  normalizer.stream_safe_non_starters = 0;
+  bytes_into_input = 0;
+  codepoints_into_input = 0;
+  error_count = 0;
+  byte_decoder.reset();
+  codepoint_count = 0;
+  encoded_size = 0;
+}
+
+void stream_decoder_t::on_codepoint(uint32_t codepoint) {
+  codepoints_into_input++;
+  push_codepoint(codepoint);
+}
+
+void stream_decoder_t::on_error(utf_error_t error_found, uint32_t code_unit,
+                                size_t bytes_before, char const *message) {
+  (void)error_found;
+  (void)code_unit;
+  error(bytes_into_input - bytes_before, message);
+}
+
+void stream_decoder_t::push_codepoint(uint32_t codepoint) {
+  if (normalizer.is_active()) {
+    uint32_t normalized[normalizer_t::MAX_OUTPUT];
+    size_t count = normalizer.push(codepoint, normalized);
+    for (size_t i = 0; i < count; i++) {
+      emit_codepoint(normalized[i]);
+    }
+  } else {
+    emit_codepoint(codepoint);
+  }
+}
+
+void stream_decoder_t::emit_codepoint(uint32_t codepoint) {
+  if (!encode_output) {
+    if (codepoint_count == BATCH_SIZE) {
+      flush_batch();
+    }
+    codepoints[codepoint_count++] = codepoint;
+    return;
+  }
+
+  // Room for the longest encoding of a code point:
+  if (encoded_size + 4 > sizeof(encoded)) {
+    flush_batch();
+  }
+  uint8_t *buffer = encoded + encoded_size;
+  switch (output_encoding) {
+  case utf_encoding_t::UTF8:
+    encoded_size += codepoint_to_utf8(codepoint, buffer);
+    break;
+  case utf_encoding_t::UTF16BE:
+  case utf_encoding_t::UTF16LE:
+    encoded_size += encode_utf16(
+        codepoint, buffer, output_encoding == utf_encoding_t::UTF16LE);
+    break;
+  case utf_encoding_t::UTF32BE:
+  case utf_encoding_t::UTF32LE:
+    encoded_size += encode_utf32(codepoint, buffer,
+                                 output_encoding == utf_encoding_t::UTF32LE);
+    break;
+  }
+}
+
+void stream_decoder_t::error(uint64_t byte_offset, char const *message) {
+  error_count++;
+  // Hand over what was decoded before the error first, so that the handler
+  // sees everything in input order:
+  flush_batch();
+  handler->on_error(byte_offset, message);
+  if (replace_errors) {
+    push_codepoint(0xFFFD);
+  }
+}
+
+void stream_decoder_t::flush_batch() {
+  if (codepoint_count > 0) {
+    handler->on_codepoints(codepoints, codepoint_count);
+    codepoint_count = 0;
+  }
+  if (encoded_size > 0) {
+    handler->on_output(encoded, encoded_size);
+    encoded_size = 0;
+  }
+}
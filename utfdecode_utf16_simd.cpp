@@ -0,0 +1,628 @@
+#include "libutfdecode.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define UTFDECODE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+// Vectorized UTF-16 and UTF-32 to UTF-8 transcoding. Blocks of 8 UTF-16
+// code units are byte swapped into native order with a shuffle and
+// classified with vector compares: all ASCII, all below U+0800 or any other
+// code units outside the surrogate range. The UTF-8 bytes of each code unit
+// are computed in a 16 or 32 bit lane, and the unused bytes of the lanes are
+// then squeezed out with a shuffle from a table indexed by which lanes need
+// more bytes. Blocks with surrogates go through the scalar code. Blocks of
+// UTF-32 are validated with vector compares and, if they are all in the
+// Basic Multilingual Plane, packed into UTF-16 for the same code.
+
+namespace {
+
+template <bool little_endian> uint16_t read_unit(uint8_t const *data) {
+  return little_endian ? uint16_t(data[1] << 8 | data[0])
+                       : uint16_t(data[0] << 8 | data[1]);
+}
+
+// Transcodes code units starting at position until reaching stop, or the
+// end of a surrogate pair beyond it. Returns where it stopped, which is
+// before stop on an unpaired surrogate or a pair cut off by the end of data.
+template <bool little_endian>
+size_t transcode_utf16_scalar(uint8_t const *data, size_t position,
+                              size_t stop, size_t length, uint8_t *output,
+                              size_t &written, uint64_t &codepoints) {
+  uint8_t *out = output + written;
+  while (position < stop && position + 2 <= length) {
+    uint32_t codepoint = read_unit<little_endian>(data + position);
+    if (utf16_is_trailing_surrogate(codepoint)) {
+      break;
+    } else if (utf16_is_leading_surrogate(codepoint)) {
+      if (position + 4 > length) {
+        break;
+      }
+      uint32_t trailing = read_unit<little_endian>(data + position + 2);
+      if (!utf16_is_trailing_surrogate(trailing)) {
+        break;
+      }
+      codepoint = utf16_decode_surrogate_pair(codepoint, trailing);
+      position += 2;
+    }
+    out += codepoint_to_utf8(codepoint, out);
+    position += 2;
+    codepoints++;
+  }
+  written = out - output;
+  return position;
+}
+
+template <bool little_endian>
+size_t transcode_utf16_to_utf8_scalar(uint8_t const *data, size_t length,
+                                      uint8_t *output, size_t &written,
+                                      uint64_t &codepoints) {
+  return transcode_utf16_scalar<little_endian>(data, 0, length, length,
+                                               output, written, codepoints);
+}
+
+template <bool little_endian> uint32_t read_utf32_unit(uint8_t const *data) {
+  return little_endian ? (uint32_t(data[3]) << 24 | data[2] << 16 |
+                          data[1] << 8 | data[0])
+                       : (uint32_t(data[0]) << 24 | data[1] << 16 |
+                          data[2] << 8 | data[3]);
+}
+
+inline bool is_valid_codepoint(uint32_t codepoint) {
+  return codepoint <= 0x10FFFF && (codepoint < 0xD800 || codepoint > 0xDFFF);
+}
+
+template <bool little_endian>
+size_t utf32_valid_prefix_length_scalar(uint8_t const *data,
+                                        size_t length) {
+  size_t position = 0;
+  while (position + 4 <= length &&
+         is_valid_codepoint(read_utf32_unit<little_endian>(data + position))) {
+    position += 4;
+  }
+  return position;
+}
+
+// Transcodes code units starting at position until reaching stop. Returns
+// where it stopped, which is before stop on an invalid code unit or one cut
+// off by the end of data.
+template <bool little_endian>
+size_t transcode_utf32_scalar(uint8_t const *data, size_t position,
+                              size_t stop, size_t length, uint8_t *output,
+                              size_t &written, uint64_t &codepoints) {
+  uint8_t *out = output + written;
+  while (position < stop && position + 4 <= length) {
+    uint32_t codepoint = read_utf32_unit<little_endian>(data + position);
+    if (!is_valid_codepoint(codepoint)) {
+      break;
+    }
+    out += codepoint_to_utf8(codepoint, out);
+    position += 4;
+    codepoints++;
+  }
+  written = out - output;
+  return position;
+}
+
+template <bool little_endian>
+size_t transcode_utf32_to_utf8_scalar(uint8_t const *data, size_t length,
+                                      uint8_t *output, size_t &written,
+                                      uint64_t &codepoints) {
+  return transcode_utf32_scalar<little_endian>(data, 0, length, length,
+                                               output, written, codepoints);
+}
+
+#ifdef UTFDECODE_X86_SIMD
+
+// A shuffle which moves the bytes to keep to the front, and their number.
+struct compress_entry_t {
+  alignas(16) uint8_t shuffle[16];
+  size_t length;
+};
+
+struct compress_tables_t {
+  // Indexed by which of 8 code units below U+0800 are ASCII, for lanes of
+  // 16 bits with one or two UTF-8 bytes.
+  compress_entry_t two_byte[256];
+  // Indexed by which of 4 code units are at least U+0080 in the low 4 bits
+  // and at least U+0800 in the high 4 bits, for lanes of 32 bits with one,
+  // two or three UTF-8 bytes.
+  compress_entry_t three_byte[256];
+
+  static void fill(compress_entry_t &entry, uint16_t keep) {
+    entry.length = 0;
+    for (uint8_t i = 0; i < 16; i++) {
+      if (keep & (1 << i)) {
+        entry.shuffle[entry.length++] = i;
+      }
+    }
+    for (size_t i = entry.length; i < 16; i++) {
+      entry.shuffle[i] = 0x80;
+    }
+  }
+
+  compress_tables_t() {
+    for (int index = 0; index < 256; index++) {
+      uint16_t keep_two = 0;
+      uint16_t keep_three = 0;
+      for (int lane = 0; lane < 8; lane++) {
+        keep_two |= 1 << (2 * lane);
+        if (!(index & (1 << lane))) {
+          keep_two |= 1 << (2 * lane + 1);
+        }
+      }
+      for (int lane = 0; lane < 4; lane++) {
+        keep_three |= 1 << (4 * lane);
+        if (index & (1 << lane)) {
+          keep_three |= 1 << (4 * lane + 1);
+        }
+        if (index & (1 << (lane + 4))) {
+          keep_three |= 1 << (4 * lane + 2);
+        }
+      }
+      fill(two_byte[index], keep_two);
+      fill(three_byte[index], keep_three);
+    }
+  }
+};
+
+compress_tables_t const &compress_tables() {
+  static const compress_tables_t tables;
+  return tables;
+}
+
+__attribute__((target("sse4.1"), always_inline)) inline __m128i
+swap_to_native_sse(__m128i units, bool little_endian) {
+  return little_endian
+             ? units
+             : _mm_shuffle_epi8(units, _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9,
+                                                     8, 11, 10, 13, 12, 15,
+                                                     14));
+}
+
+__attribute__((target("sse4.1"), always_inline)) inline bool
+has_surrogate_sse(__m128i units) {
+  __m128i surrogate =
+      _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(int16_t(0xF800))),
+                      _mm_set1_epi16(int16_t(0xD800)));
+  return _mm_movemask_epi8(surrogate) != 0;
+}
+
+// Writes the UTF-8 of 4 code units in 32 bit lanes, none of which may be a
+// surrogate. Returns the number of bytes written, while 16 are stored.
+__attribute__((target("sse4.1"), always_inline)) inline size_t
+transcode_4_units_sse(__m128i units, uint8_t *output,
+                      compress_tables_t const &tables) {
+  __m128i is_ascii = _mm_cmpeq_epi32(
+      _mm_and_si128(units, _mm_set1_epi32(0xFF80)), _mm_setzero_si128());
+  __m128i is_two_byte = _mm_cmpeq_epi32(
+      _mm_and_si128(units, _mm_set1_epi32(0xF800)), _mm_setzero_si128());
+  __m128i low_bits =
+      _mm_or_si128(_mm_and_si128(units, _mm_set1_epi32(0x3F)),
+                   _mm_set1_epi32(0x80));
+  __m128i middle_bits = _mm_or_si128(
+      _mm_and_si128(_mm_srli_epi32(units, 6), _mm_set1_epi32(0x3F)),
+      _mm_set1_epi32(0x80));
+
+  __m128i byte_0 = _mm_blendv_epi8(
+      _mm_blendv_epi8(
+          _mm_or_si128(_mm_srli_epi32(units, 12), _mm_set1_epi32(0xE0)),
+          _mm_or_si128(_mm_srli_epi32(units, 6), _mm_set1_epi32(0xC0)),
+          is_two_byte),
+      units, is_ascii);
+  __m128i byte_1 = _mm_blendv_epi8(middle_bits, low_bits, is_two_byte);
+  __m128i lanes =
+      _mm_or_si128(byte_0, _mm_or_si128(_mm_slli_epi32(byte_1, 8),
+                                        _mm_slli_epi32(low_bits, 16)));
+
+  int index = (~_mm_movemask_ps(_mm_castsi128_ps(is_ascii)) & 0xF) |
+              (~_mm_movemask_ps(_mm_castsi128_ps(is_two_byte)) & 0xF) << 4;
+  compress_entry_t const &entry = tables.three_byte[index];
+  _mm_storeu_si128(
+      reinterpret_cast<__m128i *>(output),
+      _mm_shuffle_epi8(lanes, _mm_load_si128(reinterpret_cast<__m128i const *>(
+                                  entry.shuffle))));
+  return entry.length;
+}
+
+// Writes the UTF-8 of 8 code units in native order, none of which may be a
+// surrogate. Returns the number of bytes written, while up to 28 are stored.
+__attribute__((target("sse4.1"), always_inline)) inline size_t
+transcode_8_units_sse(__m128i units, uint8_t *output,
+                      compress_tables_t const &tables) {
+  __m128i is_ascii = _mm_cmpeq_epi16(
+      _mm_and_si128(units, _mm_set1_epi16(int16_t(0xFF80))),
+      _mm_setzero_si128());
+  int ascii_mask = _mm_movemask_epi8(is_ascii);
+  if (ascii_mask == 0xFFFF) {
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(output),
+                     _mm_packus_epi16(units, units));
+    return 8;
+  }
+
+  __m128i is_two_byte = _mm_cmpeq_epi16(
+      _mm_and_si128(units, _mm_set1_epi16(int16_t(0xF800))),
+      _mm_setzero_si128());
+  if (_mm_movemask_epi8(is_two_byte) == 0xFFFF) {
+    __m128i leading =
+        _mm_or_si128(_mm_srli_epi16(units, 6), _mm_set1_epi16(0xC0));
+    __m128i continuation =
+        _mm_or_si128(_mm_and_si128(units, _mm_set1_epi16(0x3F)),
+                     _mm_set1_epi16(0x80));
+    __m128i lanes = _mm_blendv_epi8(
+        _mm_or_si128(leading, _mm_slli_epi16(continuation, 8)), units,
+        is_ascii);
+    int index = _mm_movemask_epi8(_mm_packs_epi16(is_ascii, is_ascii)) & 0xFF;
+    compress_entry_t const &entry = tables.two_byte[index];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output),
+                     _mm_shuffle_epi8(lanes,
+                                      _mm_load_si128(
+                                          reinterpret_cast<__m128i const *>(
+                                              entry.shuffle))));
+    return entry.length;
+  }
+
+  size_t length = transcode_4_units_sse(_mm_cvtepu16_epi32(units), output,
+                                        tables);
+  return length + transcode_4_units_sse(
+                      _mm_cvtepu16_epi32(_mm_srli_si128(units, 8)),
+                      output + length, tables);
+}
+
+template <bool little_endian>
+__attribute__((target("sse4.1"))) size_t
+transcode_utf16_to_utf8_sse41(uint8_t const *data, size_t length,
+                              uint8_t *output, size_t &written,
+                              uint64_t &codepoints) {
+  compress_tables_t const &tables = compress_tables();
+  size_t position = 0;
+  // Blocks store up to 12 bytes more than they write, which stays within
+  // the room for the output of the input after them:
+  while (position + 32 <= length) {
+    __m128i units = swap_to_native_sse(
+        _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + position)),
+        little_endian);
+    if (has_surrogate_sse(units)) {
+      size_t stop = position + 16;
+      position = transcode_utf16_scalar<little_endian>(
+          data, position, stop, length, output, written, codepoints);
+      if (position < stop) {
+        return position;
+      }
+      continue;
+    }
+    written += transcode_8_units_sse(units, output + written, tables);
+    codepoints += 8;
+    position += 16;
+  }
+  return transcode_utf16_scalar<little_endian>(
+      data, position, length, length, output, written, codepoints);
+}
+
+template <bool little_endian>
+__attribute__((target("avx2"))) size_t
+transcode_utf16_to_utf8_avx2(uint8_t const *data, size_t length,
+                             uint8_t *output, size_t &written,
+                             uint64_t &codepoints) {
+  compress_tables_t const &tables = compress_tables();
+  const __m256i swap = _mm256_setr_epi8(
+      1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, 1, 0, 3, 2, 5, 4,
+      7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  size_t position = 0;
+  while (position + 48 <= length) {
+    __m256i units = _mm256_loadu_si256(
+        reinterpret_cast<__m256i const *>(data + position));
+    if (!little_endian) {
+      units = _mm256_shuffle_epi8(units, swap);
+    }
+    __m256i surrogate = _mm256_cmpeq_epi16(
+        _mm256_and_si256(units, _mm256_set1_epi16(int16_t(0xF800))),
+        _mm256_set1_epi16(int16_t(0xD800)));
+    if (_mm256_movemask_epi8(surrogate) != 0) {
+      size_t stop = position + 32;
+      position = transcode_utf16_scalar<little_endian>(
+          data, position, stop, length, output, written, codepoints);
+      if (position < stop) {
+        return position;
+      }
+      continue;
+    }
+
+    __m256i non_ascii =
+        _mm256_and_si256(units, _mm256_set1_epi16(int16_t(0xFF80)));
+    if (_mm256_testz_si256(non_ascii, non_ascii)) {
+      __m256i packed = _mm256_permute4x64_epi64(
+          _mm256_packus_epi16(units, units), 0b1000);
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(output + written),
+                       _mm256_castsi256_si128(packed));
+      written += 16;
+    } else {
+      written += transcode_8_units_sse(_mm256_castsi256_si128(units),
+                                       output + written, tables);
+      written += transcode_8_units_sse(_mm256_extracti128_si256(units, 1),
+                                       output + written, tables);
+    }
+    codepoints += 16;
+    position += 32;
+  }
+  return transcode_utf16_scalar<little_endian>(
+      data, position, length, length, output, written, codepoints);
+}
+
+__attribute__((target("sse4.1"), always_inline)) inline __m128i
+swap_utf32_to_native_sse(__m128i units, bool little_endian) {
+  return little_endian
+             ? units
+             : _mm_shuffle_epi8(units, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                                     11, 10, 9, 8, 15, 14, 13,
+                                                     12));
+}
+
+// Lanes of 4 UTF-32 code units which are above U+10FFFF or surrogates.
+__attribute__((target("sse4.1"), always_inline)) inline __m128i
+invalid_utf32_sse(__m128i units) {
+  __m128i above = _mm_cmpgt_epi32(_mm_srli_epi32(units, 16),
+                                  _mm_set1_epi32(0x10));
+  __m128i surrogate = _mm_cmpeq_epi32(
+      _mm_and_si128(units, _mm_set1_epi32(int32_t(0xFFFFF800))),
+      _mm_set1_epi32(0xD800));
+  return _mm_or_si128(above, surrogate);
+}
+
+template <bool little_endian>
+__attribute__((target("sse4.1"))) size_t
+utf32_valid_prefix_length_sse41(uint8_t const *data, size_t length) {
+  size_t position = 0;
+  for (; position + 16 <= length; position += 16) {
+    int invalid = _mm_movemask_ps(_mm_castsi128_ps(
+        invalid_utf32_sse(swap_utf32_to_native_sse(
+            _mm_loadu_si128(
+                reinterpret_cast<__m128i const *>(data + position)),
+            little_endian))));
+    if (invalid != 0) {
+      return position + 4 * __builtin_ctz(invalid);
+    }
+  }
+  return position + utf32_valid_prefix_length_scalar<little_endian>(
+                        data + position, length - position);
+}
+
+template <bool little_endian>
+__attribute__((target("avx2"))) size_t
+utf32_valid_prefix_length_avx2(uint8_t const *data, size_t length) {
+  const __m256i swap = _mm256_setr_epi8(
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6,
+      5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  size_t position = 0;
+  for (; position + 32 <= length; position += 32) {
+    __m256i units = _mm256_loadu_si256(
+        reinterpret_cast<__m256i const *>(data + position));
+    if (!little_endian) {
+      units = _mm256_shuffle_epi8(units, swap);
+    }
+    __m256i above = _mm256_cmpgt_epi32(_mm256_srli_epi32(units, 16),
+                                       _mm256_set1_epi32(0x10));
+    __m256i surrogate = _mm256_cmpeq_epi32(
+        _mm256_and_si256(units, _mm256_set1_epi32(int32_t(0xFFFFF800))),
+        _mm256_set1_epi32(0xD800));
+    int invalid = _mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_or_si256(above, surrogate)));
+    if (invalid != 0) {
+      return position + 4 * __builtin_ctz(invalid);
+    }
+  }
+  return position + utf32_valid_prefix_length_scalar<little_endian>(
+                        data + position, length - position);
+}
+
+template <bool little_endian>
+__attribute__((target("avx512f,avx512bw"))) size_t
+utf32_valid_prefix_length_avx512(uint8_t const *data, size_t length) {
+  const __m512i swap = _mm512_maskz_broadcast_i32x4(
+      __mmask16(-1), _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15,
+                                   14, 13, 12));
+  size_t position = 0;
+  for (; position + 64 <= length; position += 64) {
+    __m512i units = _mm512_loadu_si512(data + position);
+    if (!little_endian) {
+      units = _mm512_shuffle_epi8(units, swap);
+    }
+    __mmask16 invalid =
+        _mm512_cmpgt_epu32_mask(units, _mm512_set1_epi32(0x10FFFF)) |
+        _mm512_cmpeq_epi32_mask(
+            _mm512_and_si512(units, _mm512_set1_epi32(int32_t(0xFFFFF800))),
+            _mm512_set1_epi32(0xD800));
+    if (invalid != 0) {
+      return position + 4 * __builtin_ctz(invalid);
+    }
+  }
+  return position + utf32_valid_prefix_length_scalar<little_endian>(
+                        data + position, length - position);
+}
+
+template <bool little_endian>
+__attribute__((target("sse4.1"))) size_t
+transcode_utf32_to_utf8_sse41(uint8_t const *data, size_t length,
+                              uint8_t *output, size_t &written,
+                              uint64_t &codepoints) {
+  compress_tables_t const &tables = compress_tables();
+  size_t position = 0;
+  // Each code unit has room for 4 bytes of output, more than blocks store:
+  while (position + 32 <= length) {
+    __m128i low = swap_utf32_to_native_sse(
+        _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + position)),
+        little_endian);
+    __m128i high = swap_utf32_to_native_sse(
+        _mm_loadu_si128(
+            reinterpret_cast<__m128i const *>(data + position + 16)),
+        little_endian);
+    __m128i invalid =
+        _mm_or_si128(invalid_utf32_sse(low), invalid_utf32_sse(high));
+    __m128i above_bmp = _mm_srli_epi32(_mm_or_si128(low, high), 16);
+    if (!_mm_testz_si128(invalid, invalid) ||
+        !_mm_testz_si128(above_bmp, above_bmp)) {
+      size_t stop = position + 32;
+      position = transcode_utf32_scalar<little_endian>(
+          data, position, stop, length, output, written, codepoints);
+      if (position < stop) {
+        return position;
+      }
+      continue;
+    }
+    written += transcode_8_units_sse(_mm_packus_epi32(low, high),
+                                     output + written, tables);
+    codepoints += 8;
+    position += 32;
+  }
+  return transcode_utf32_scalar<little_endian>(
+      data, position, length, length, output, written, codepoints);
+}
+
+template <bool little_endian>
+__attribute__((target("avx2"))) size_t
+transcode_utf32_to_utf8_avx2(uint8_t const *data, size_t length,
+                             uint8_t *output, size_t &written,
+                             uint64_t &codepoints) {
+  compress_tables_t const &tables = compress_tables();
+  const __m256i swap = _mm256_setr_epi8(
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6,
+      5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  size_t position = 0;
+  while (position + 64 <= length) {
+    __m256i low = _mm256_loadu_si256(
+        reinterpret_cast<__m256i const *>(data + position));
+    __m256i high = _mm256_loadu_si256(
+        reinterpret_cast<__m256i const *>(data + position + 32));
+    if (!little_endian) {
+      low = _mm256_shuffle_epi8(low, swap);
+      high = _mm256_shuffle_epi8(high, swap);
+    }
+    __m256i either = _mm256_or_si256(low, high);
+    __m256i above_bmp = _mm256_srli_epi32(either, 16);
+    // Surrogates are the only code units in the Basic Multilingual Plane
+    // which are not valid:
+    __m256i surrogate = _mm256_or_si256(
+        _mm256_cmpeq_epi32(
+            _mm256_and_si256(low, _mm256_set1_epi32(int32_t(0xFFFFF800))),
+            _mm256_set1_epi32(0xD800)),
+        _mm256_cmpeq_epi32(
+            _mm256_and_si256(high, _mm256_set1_epi32(int32_t(0xFFFFF800))),
+            _mm256_set1_epi32(0xD800)));
+    if (!_mm256_testz_si256(above_bmp, above_bmp) ||
+        !_mm256_testz_si256(surrogate, surrogate)) {
+      size_t stop = position + 64;
+      position = transcode_utf32_scalar<little_endian>(
+          data, position, stop, length, output, written, codepoints);
+      if (position < stop) {
+        return position;
+      }
+      continue;
+    }
+
+    // Packing works within 128 bit lanes, so put the lanes back in order:
+    __m256i units =
+        _mm256_permute4x64_epi64(_mm256_packus_epi32(low, high), 0b11011000);
+    __m256i non_ascii =
+        _mm256_and_si256(units, _mm256_set1_epi16(int16_t(0xFF80)));
+    if (_mm256_testz_si256(non_ascii, non_ascii)) {
+      __m256i packed = _mm256_permute4x64_epi64(
+          _mm256_packus_epi16(units, units), 0b1000);
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(output + written),
+                       _mm256_castsi256_si128(packed));
+      written += 16;
+    } else {
+      written += transcode_8_units_sse(_mm256_castsi256_si128(units),
+                                       output + written, tables);
+      written += transcode_8_units_sse(_mm256_extracti128_si256(units, 1),
+                                       output + written, tables);
+    }
+    codepoints += 16;
+    position += 64;
+  }
+  return transcode_utf32_scalar<little_endian>(
+      data, position, length, length, output, written, codepoints);
+}
+
+#endif
+
+typedef size_t (*to_utf8_transcoder_t)(uint8_t const *, size_t, uint8_t *,
+                                       size_t &, uint64_t &);
+
+template <bool little_endian> to_utf8_transcoder_t select_utf16_transcoder() {
+#ifdef UTFDECODE_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return transcode_utf16_to_utf8_avx2<little_endian>;
+  } else if (__builtin_cpu_supports("sse4.1")) {
+    return transcode_utf16_to_utf8_sse41<little_endian>;
+  }
+#endif
+  return transcode_utf16_to_utf8_scalar<little_endian>;
+}
+
+typedef size_t (*utf32_validator_t)(uint8_t const *, size_t);
+
+template <bool little_endian> utf32_validator_t select_utf32_validator() {
+#ifdef UTFDECODE_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") &&
+      __builtin_cpu_supports("avx512bw")) {
+    return utf32_valid_prefix_length_avx512<little_endian>;
+  } else if (__builtin_cpu_supports("avx2")) {
+    return utf32_valid_prefix_length_avx2<little_endian>;
+  } else if (__builtin_cpu_supports("sse4.1")) {
+    return utf32_valid_prefix_length_sse41<little_endian>;
+  }
+#endif
+  return utf32_valid_prefix_length_scalar<little_endian>;
+}
+
+template <bool little_endian> to_utf8_transcoder_t select_utf32_transcoder() {
+#ifdef UTFDECODE_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return transcode_utf32_to_utf8_avx2<little_endian>;
+  } else if (__builtin_cpu_supports("sse4.1")) {
+    return transcode_utf32_to_utf8_sse41<little_endian>;
+  }
+#endif
+  return transcode_utf32_to_utf8_scalar<little_endian>;
+}
+
+} // namespace
+
+size_t transcode_utf16_to_utf8(uint8_t const *data, size_t length,
+                               bool little_endian, uint8_t *output,
+                               size_t &written, uint64_t &codepoints) {
+  static to_utf8_transcoder_t const little_endian_transcoder =
+      select_utf16_transcoder<true>();
+  static to_utf8_transcoder_t const big_endian_transcoder =
+      select_utf16_transcoder<false>();
+  written = 0;
+  codepoints = 0;
+  return (little_endian ? little_endian_transcoder : big_endian_transcoder)(
+      data, length, output, written, codepoints);
+}
+
+size_t utf32_valid_prefix_length(uint8_t const *data, size_t length,
+                                 bool little_endian) {
+  static utf32_validator_t const little_endian_validator =
+      select_utf32_validator<true>();
+  static utf32_validator_t const big_endian_validator =
+      select_utf32_validator<false>();
+  return (little_endian ? little_endian_validator : big_endian_validator)(
+      data, length);
+}
+
+size_t transcode_utf32_to_utf8(uint8_t const *data, size_t length,
+                               bool little_endian, uint8_t *output,
+                               size_t &written, uint64_t &codepoints) {
+  static to_utf8_transcoder_t const little_endian_transcoder =
+      select_utf32_transcoder<true>();
+  static to_utf8_transcoder_t const big_endian_transcoder =
+      select_utf32_transcoder<false>();
+  written = 0;
+  codepoints = 0;
+  return (little_endian ? little_endian_transcoder : big_endian_transcoder)(
+      data, length, output, written, codepoints);
+}
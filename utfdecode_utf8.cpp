@@ -1,136 +1,94 @@
-#include "utfdecode.hpp"
+#include "libutfdecode.hpp"
 
-int codepoint_to_utf8(uint32_t codePoint, uint8_t *utf8InputBuffer) {
-  int bufferPosition = 0;
-  if (codePoint <= /* 7 bits */ 0b1111111) {
-    utf8InputBuffer[bufferPosition++] = (uint8_t)codePoint;
-  } else if (codePoint <= /* 11 bits */ 0b11111111111) {
-    /* 110xxxxx leading byte with leading 5 bits */
-    utf8InputBuffer[bufferPosition++] =
-        (uint8_t)(0b11000000 | (codePoint >> 6));
-    /* 10xxxxxx continuation byte with following 6 bits */
-    utf8InputBuffer[bufferPosition++] =
-        (uint8_t)(0b10000000 | (codePoint & 0b111111));
-  } else if (codePoint <= /* 16 bits */ 0b1111111111111111) {
-    /* 1110xxxx leading byte with leading 4 bits */
-    utf8InputBuffer[bufferPosition++] =
-        (uint8_t)(0b11100000 | (codePoint >> 12));
-    /* 10xxxxxx continuation byte with following 6 bits */
-    utf8InputBuffer[bufferPosition++] =
-        (uint8_t)(0b10000000 | ((codePoint >> 6) & 0b111111));
-    /* 10xxxxxx continuation byte with following 6 bits */
-    utf8InputBuffer[bufferPosition++] =
-        (uint8_t)(0b10000000 | (codePoint & 0b111111));
-  } else if (codePoint <= /* 21 bits */ 0b111111111111111111111) {
-    /* 11110xxx leading byte with leading 3 bits */
-    utf8InputBuffer[bufferPosition++] =
-        (uint8_t)(0b11110000 | (codePoint >> 18));
-    /* 10xxxxxx continuation byte with following 6 bits */
-    utf8InputBuffer[bufferPosition++] =
-        (uint8_t)(0b10000000 | ((codePoint >> 12) & 0b111111));
-    /* 10xxxxxx continuation byte with following 6 bits */
-    utf8InputBuffer[bufferPosition++] =
-        (uint8_t)(0b10000000 | ((codePoint >> 6) & 0b111111));
-    /* 10xxxxxx continuation byte with following 6 bits */
-    utf8InputBuffer[bufferPosition++] =
-        (uint8_t)(0b10000000 | (codePoint & 0b111111));
-  } else {
-    die_with_internal_error("codepoint_to_utf8(): invalid code point %d",
-                            codePoint);
-  }
-  return bufferPosition;
-}
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sysexits.h>
 
-/* Assumes that the buffer is already validated. Does not handle overlong
- * encodings. */
-uint32_t utf8_sequence_to_codepoint(uint8_t *buffer, uint8_t length) {
-  uint32_t code_point;
-  uint32_t first_byte_mask;
-  switch (length) {
-  case 2:
-    first_byte_mask = 0x1F;
-    break;
-  case 3:
-    first_byte_mask = 0x0F;
-    break;
-  case 4:
-    first_byte_mask = 0x07;
-    break;
-  default:
-    die_with_internal_error("utf8_sequence_to_codepoint(): length=%d\n",
-                            (int)length);
-  }
-  code_point = (buffer[0] & first_byte_mask);
-  for (int i = 1; i < length; i++)
-    code_point = ((code_point << 6) | (uint32_t)(buffer[i] & 0x3F));
-  return code_point;
+void die_with_internal_error [[noreturn]] (char const *fmt, ...) {
+  fprintf(stderr, "utfdecode: internal error - ");
+  va_list argp;
+  va_start(argp, fmt);
+  vfprintf(stderr, fmt, argp);
+  va_end(argp);
+  fprintf(stderr, "\n");
+  exit(EX_SOFTWARE);
 }
 
-void program_options_t::process_utf8_byte(uint8_t byte, uint8_t *utf8_buffer, uint8_t &utf8_pos,
-                       uint8_t &remaining_utf8_continuation_bytes) {
-  bool invalid_utf8_seq = false;
-  if (byte <= 127) {
-    invalid_utf8_seq = (remaining_utf8_continuation_bytes > 0);
-    if (invalid_utf8_seq) {
-      note_error(byte, "expected continuation byte");
-    } else {
-      encode_codepoint(byte);
-    }
-  } else if ((byte & /*0b11000000=*/0xc0) == /*0b10000000=*/0x80) {
-    invalid_utf8_seq = (remaining_utf8_continuation_bytes == 0);
-    if (!invalid_utf8_seq) {
-      utf8_buffer[utf8_pos++] = byte;
-      --remaining_utf8_continuation_bytes;
-      if (remaining_utf8_continuation_bytes == 0) {
-        uint8_t used_length = utf8_pos;
+// UTF-8 decoding DFA as described by Bjoern Hoehrmann in "Flexible and
+// Economical UTF-8 Decoder" (http://bjoern.hoehrmann.de/utf-8/decoder/dfa/).
+// Bytes are first mapped to a character class, which together with the
+// current state selects the next state. Overlong encodings, surrogates and
+// code points above U+10FFFF are rejected by the transitions themselves, so
+// reaching UTF8_ACCEPT always means that a valid code point was decoded.
+enum : uint8_t {
+  UTF8_ONE_LEFT = 24,
+  UTF8_TWO_LEFT = 36,
+  UTF8_AFTER_E0 = 48,
+  UTF8_AFTER_ED = 60,
+  UTF8_AFTER_F0 = 72,
+  UTF8_THREE_LEFT = 84,
+  UTF8_AFTER_F4 = 96
+};
+
+const uint8_t utf8_byte_classes[256] = {
+    // 0x00-0x7F: ASCII
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0,
+    // 0x80-0x8F, 0x90-0x9F and 0xA0-0xBF: continuation bytes
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    // 0xC0-0xC1: never valid, 0xC2-0xDF: leading byte of two
+    8, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2,
+    // 0xE0-0xEF: leading byte of three, with 0xE0 and 0xED restricted
+    10, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3,
+    // 0xF0-0xF4: leading byte of four, with 0xF0 and 0xF4 restricted,
+    // 0xF5-0xFF: never valid
+    11, 6, 6, 6, 5, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8};
+
+// Indexed by state + character class.
+const uint8_t utf8_transitions[108] = {
+    // UTF8_ACCEPT
+    0, 12, 24, 36, 60, 96, 84, 12, 12, 12, 48, 72,
+    // UTF8_REJECT
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    // UTF8_ONE_LEFT: any continuation byte
+    12, 0, 12, 12, 12, 12, 12, 0, 12, 0, 12, 12,
+    // UTF8_TWO_LEFT: any continuation byte
+    12, 24, 12, 12, 12, 12, 12, 24, 12, 24, 12, 12,
+    // UTF8_AFTER_E0: 0xA0-0xBF
+    12, 12, 12, 12, 12, 12, 12, 24, 12, 12, 12, 12,
+    // UTF8_AFTER_ED: 0x80-0x9F
+    12, 24, 12, 12, 12, 12, 12, 12, 12, 24, 12, 12,
+    // UTF8_AFTER_F0: 0x90-0xBF
+    12, 12, 12, 12, 12, 12, 12, 36, 12, 36, 12, 12,
+    // UTF8_THREE_LEFT: any continuation byte
+    12, 36, 12, 12, 12, 12, 12, 36, 12, 36, 12, 12,
+    // UTF8_AFTER_F4: 0x80-0x8F
+    12, 36, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12};
 
-        utf8_buffer[used_length] = 0;
-        uint32_t code_point =
-            utf8_sequence_to_codepoint(utf8_buffer, used_length);
-        if (code_point > 0x10FFFF) {
-          note_error(byte, "code point out of range: %u", code_point);
-        } else if (code_point >= 0xD800 && code_point <= 0xDFFF) {
-          note_error(byte, "surrogate %u in UTF-8", code_point);
-        } else if (((code_point <= 0x80) && used_length > 1) ||
-                   (code_point < 0x800 && used_length > 2) ||
-                   (code_point < 0x10000 && used_length > 3)) {
-          note_error(byte, "overlong encoding of %u using %d bytes",
-                             code_point, used_length);
-        } else {
-          encode_codepoint(code_point);
-        }
-        remaining_utf8_continuation_bytes = 0;
-      }
-    }
-  } else {
-    int expect_following;
-    if ((byte & /*0b11100000=*/0xe0) == /*0b11000000=*/0xc0) {
-      expect_following = 1;
-    } else if ((byte & /*0b11110000=*/0xf0) == /*0b11100000=*/0xe0) {
-      expect_following = 2;
-    } else if ((byte & /*0b11111000=*/0xf8) == /*0b11110000=*/0xf0) {
-      expect_following = 3;
-    } else {
-      expect_following = -1;
-      invalid_utf8_seq = true;
-      note_error(byte, "invalid byte");
-    }
-    if (expect_following != -1) {
-      if (remaining_utf8_continuation_bytes == 0) {
-        remaining_utf8_continuation_bytes = expect_following;
-        utf8_pos = 1;
-        utf8_buffer[0] = byte;
-      } else {
-        invalid_utf8_seq = true;
-      }
-    }
-  }
 
-  // FIXME:
-  // https://github.com/jackpal/Android-Terminal-Emulator/commit/7335c643f758ce4351ac00813027ce1505f8dbd4
-  // - should continue with the current byte in the buffer
-  if (invalid_utf8_seq) {
-    remaining_utf8_continuation_bytes = 0;
+char const *utf8_error_message(uint8_t state, uint8_t byte) {
+  bool is_continuation_byte =
+      (byte & /*0b11000000=*/0xc0) == /*0b10000000=*/0x80;
+  if (state == UTF8_ACCEPT) {
+    return is_continuation_byte ? "unexpected continuation byte"
+                                : "invalid byte";
+  } else if (!is_continuation_byte) {
+    return "expected continuation byte";
+  } else if (state == UTF8_AFTER_E0) {
+    return "overlong encoding using 3 bytes";
+  } else if (state == UTF8_AFTER_ED) {
+    return "surrogate in UTF-8";
+  } else if (state == UTF8_AFTER_F0) {
+    return "overlong encoding using 4 bytes";
+  } else {
+    return "code point out of range";
   }
 }
-
@@ -0,0 +1,377 @@
+#include "libutfdecode.hpp"
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define UTFDECODE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+// Vectorized UTF-8 validation using the lookup algorithm from "Validating
+// UTF-8 In Less Than One Instruction Per Byte" by John Keiser and Daniel
+// Lemire. Each byte is classified together with the byte before it using
+// three 16 entry tables indexed by nibbles, where every bit in the result
+// corresponds to an error that the pair of bytes may be part of. Only if all
+// three lookups agree on an error is the input invalid. The 3rd and 4th
+// bytes of sequences are checked separately using saturating subtraction.
+
+namespace {
+
+constexpr uint8_t TOO_SHORT = 1 << 0;  // 11______ 0_______ or 11______ 11______
+constexpr uint8_t TOO_LONG = 1 << 1;   // 0_______ 10______
+constexpr uint8_t OVERLONG_3 = 1 << 2; // 11100000 100_____
+constexpr uint8_t TOO_LARGE = 1 << 3;  // 11110100 1001____ and larger
+constexpr uint8_t SURROGATE = 1 << 4;  // 11101101 101_____
+constexpr uint8_t OVERLONG_2 = 1 << 5; // 1100000_ 10______
+constexpr uint8_t TOO_LARGE_1000 = 1 << 6; // 11110101 1000____ and larger
+constexpr uint8_t OVERLONG_4 = 1 << 6;     // 11110000 1000____
+constexpr uint8_t TWO_CONTS = 1 << 7;      // 10______ 10______
+constexpr uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+// Indexed by the high nibble of the first byte of a pair.
+alignas(16) constexpr uint8_t byte_1_high_table[16] = {
+    // 0_______ ________ <ASCII in byte 1>
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+    TOO_LONG,
+    // 10______ ________ <continuation in byte 1>
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+    // 1100____ ________ <two byte lead in byte 1>
+    TOO_SHORT | OVERLONG_2,
+    // 1101____ ________ <two byte lead in byte 1>
+    TOO_SHORT,
+    // 1110____ ________ <three byte lead in byte 1>
+    TOO_SHORT | OVERLONG_3 | SURROGATE,
+    // 1111____ ________ <four+ byte lead in byte 1>
+    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4};
+
+// Indexed by the low nibble of the first byte of a pair.
+alignas(16) constexpr uint8_t byte_1_low_table[16] = {
+    // ____0000 ________
+    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+    // ____0001 ________
+    CARRY | OVERLONG_2,
+    // ____001_ ________
+    CARRY, CARRY,
+    // ____0100 ________
+    CARRY | TOO_LARGE,
+    // ____0101 ________
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    // ____011_ ________
+    CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+    // ____1___ ________
+    CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    // ____1101 ________
+    CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+    CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000};
+
+// Indexed by the high nibble of the second byte of a pair.
+alignas(16) constexpr uint8_t byte_2_high_table[16] = {
+    // ________ 0_______ <ASCII in byte 2>
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    TOO_SHORT, TOO_SHORT,
+    // ________ 1000____
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 |
+        OVERLONG_4,
+    // ________ 1001____
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+    // ________ 101_____
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    // ________ 11______
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT};
+
+// Subtracted with saturation from the last bytes of a block to detect a
+// sequence continuing into the next block.
+alignas(16) constexpr uint8_t incomplete_table[16] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1};
+
+// Excludes a trailing sequence which continues past the end of the data.
+size_t utf8_complete_prefix_length(uint8_t const *data, size_t length) {
+  for (size_t i = 1; i <= 3 && i <= length; i++) {
+    uint8_t byte = data[length - i];
+    if ((byte & /*0b11000000=*/0xc0) != /*0b10000000=*/0x80) {
+      size_t sequence_length =
+          (byte >= 0xf0) ? 4 : (byte >= 0xe0) ? 3 : (byte >= 0xc0) ? 2 : 1;
+      return (sequence_length > i) ? (length - i) : length;
+    }
+  }
+  return length;
+}
+
+size_t utf8_valid_prefix_length_scalar(uint8_t const *data, size_t length) {
+  size_t position = 0;
+  while (position < length) {
+    uint8_t byte = data[position];
+    if (byte <= 127) {
+      position++;
+      continue;
+    }
+
+    // See table 3-7, "Well-Formed UTF-8 Byte Sequences", in the Unicode
+    // standard:
+    size_t sequence_length;
+    uint8_t second_min = 0x80;
+    uint8_t second_max = 0xBF;
+    if (byte >= 0xC2 && byte <= 0xDF) {
+      sequence_length = 2;
+    } else if (byte >= 0xE0 && byte <= 0xEF) {
+      sequence_length = 3;
+      if (byte == 0xE0) {
+        second_min = 0xA0;
+      } else if (byte == 0xED) {
+        second_max = 0x9F;
+      }
+    } else if (byte >= 0xF0 && byte <= 0xF4) {
+      sequence_length = 4;
+      if (byte == 0xF0) {
+        second_min = 0x90;
+      } else if (byte == 0xF4) {
+        second_max = 0x8F;
+      }
+    } else {
+      break;
+    }
+
+    if (position + sequence_length > length) {
+      break;
+    }
+    uint8_t second = data[position + 1];
+    if (second < second_min || second > second_max) {
+      break;
+    }
+    bool valid = true;
+    for (size_t i = 2; i < sequence_length; i++) {
+      valid &= (data[position + i] & 0xc0) == 0x80;
+    }
+    if (!valid) {
+      break;
+    }
+    position += sequence_length;
+  }
+  return position;
+}
+
+#ifdef UTFDECODE_X86_SIMD
+
+__attribute__((target("sse4.2"))) size_t
+utf8_valid_prefix_length_sse42(uint8_t const *data, size_t length) {
+  const __m128i byte_1_high =
+      _mm_load_si128(reinterpret_cast<__m128i const *>(byte_1_high_table));
+  const __m128i byte_1_low =
+      _mm_load_si128(reinterpret_cast<__m128i const *>(byte_1_low_table));
+  const __m128i byte_2_high =
+      _mm_load_si128(reinterpret_cast<__m128i const *>(byte_2_high_table));
+  const __m128i incomplete =
+      _mm_load_si128(reinterpret_cast<__m128i const *>(incomplete_table));
+  const __m128i low_nibble = _mm_set1_epi8(0x0F);
+
+  __m128i previous = _mm_setzero_si128();
+  __m128i previous_incomplete = _mm_setzero_si128();
+  size_t position = 0;
+  for (; position + 16 <= length; position += 16) {
+    __m128i input =
+        _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + position));
+    __m128i error;
+    if (_mm_movemask_epi8(input) == 0) {
+      error = previous_incomplete;
+    } else {
+      __m128i prev1 = _mm_alignr_epi8(input, previous, 16 - 1);
+      __m128i special = _mm_and_si128(
+          _mm_and_si128(
+              _mm_shuffle_epi8(byte_1_high, _mm_and_si128(
+                                                _mm_srli_epi16(prev1, 4),
+                                                low_nibble)),
+              _mm_shuffle_epi8(byte_1_low, _mm_and_si128(prev1, low_nibble))),
+          _mm_shuffle_epi8(byte_2_high,
+                           _mm_and_si128(_mm_srli_epi16(input, 4),
+                                         low_nibble)));
+      __m128i prev2 = _mm_alignr_epi8(input, previous, 16 - 2);
+      __m128i prev3 = _mm_alignr_epi8(input, previous, 16 - 3);
+      __m128i must_be_continuation = _mm_and_si128(
+          _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xE0u - 0x80)),
+                       _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0u - 0x80))),
+          _mm_set1_epi8(int8_t(0x80)));
+      error = _mm_xor_si128(must_be_continuation, special);
+    }
+    if (!_mm_testz_si128(error, error)) {
+      return utf8_complete_prefix_length(data, position);
+    }
+    previous = input;
+    previous_incomplete = _mm_subs_epu8(input, incomplete);
+  }
+
+  position = utf8_complete_prefix_length(data, position);
+  return position +
+         utf8_valid_prefix_length_scalar(data + position, length - position);
+}
+
+__attribute__((target("avx2"))) size_t
+utf8_valid_prefix_length_avx2(uint8_t const *data, size_t length) {
+  const __m256i byte_1_high = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<__m128i const *>(byte_1_high_table)));
+  const __m256i byte_1_low = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<__m128i const *>(byte_1_low_table)));
+  const __m256i byte_2_high = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<__m128i const *>(byte_2_high_table)));
+  const __m256i incomplete = _mm256_inserti128_si256(
+      _mm256_set1_epi8(int8_t(0xFF)),
+      _mm_load_si128(reinterpret_cast<__m128i const *>(incomplete_table)), 1);
+  const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+
+  __m256i previous = _mm256_setzero_si256();
+  __m256i previous_incomplete = _mm256_setzero_si256();
+  size_t position = 0;
+  for (; position + 32 <= length; position += 32) {
+    __m256i input = _mm256_loadu_si256(
+        reinterpret_cast<__m256i const *>(data + position));
+    __m256i error;
+    if (_mm256_movemask_epi8(input) == 0) {
+      error = previous_incomplete;
+    } else {
+      // The previous 16 bytes for each lane, to shift bytes in from:
+      __m256i shifted = _mm256_permute2x128_si256(previous, input, 0x21);
+      __m256i prev1 = _mm256_alignr_epi8(input, shifted, 16 - 1);
+      __m256i special = _mm256_and_si256(
+          _mm256_and_si256(
+              _mm256_shuffle_epi8(byte_1_high,
+                                  _mm256_and_si256(_mm256_srli_epi16(prev1, 4),
+                                                   low_nibble)),
+              _mm256_shuffle_epi8(byte_1_low,
+                                  _mm256_and_si256(prev1, low_nibble))),
+          _mm256_shuffle_epi8(byte_2_high,
+                              _mm256_and_si256(_mm256_srli_epi16(input, 4),
+                                               low_nibble)));
+      __m256i prev2 = _mm256_alignr_epi8(input, shifted, 16 - 2);
+      __m256i prev3 = _mm256_alignr_epi8(input, shifted, 16 - 3);
+      __m256i must_be_continuation = _mm256_and_si256(
+          _mm256_or_si256(
+              _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0u - 0x80)),
+              _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0u - 0x80))),
+          _mm256_set1_epi8(int8_t(0x80)));
+      error = _mm256_xor_si256(must_be_continuation, special);
+    }
+    if (!_mm256_testz_si256(error, error)) {
+      return utf8_complete_prefix_length(data, position);
+    }
+    previous = input;
+    previous_incomplete = _mm256_subs_epu8(input, incomplete);
+  }
+
+  position = utf8_complete_prefix_length(data, position);
+  return position +
+         utf8_valid_prefix_length_scalar(data + position, length - position);
+}
+
+__attribute__((target("avx512f,avx512bw"))) size_t
+utf8_valid_prefix_length_avx512(uint8_t const *data, size_t length) {
+  const __m512i byte_1_high = _mm512_maskz_broadcast_i32x4(
+      __mmask16(-1),
+      _mm_load_si128(reinterpret_cast<__m128i const *>(byte_1_high_table)));
+  const __m512i byte_1_low = _mm512_maskz_broadcast_i32x4(
+      __mmask16(-1),
+      _mm_load_si128(reinterpret_cast<__m128i const *>(byte_1_low_table)));
+  const __m512i byte_2_high = _mm512_maskz_broadcast_i32x4(
+      __mmask16(-1),
+      _mm_load_si128(reinterpret_cast<__m128i const *>(byte_2_high_table)));
+  const __m512i incomplete = _mm512_inserti32x4(
+      _mm512_set1_epi8(int8_t(0xFF)),
+      _mm_load_si128(reinterpret_cast<__m128i const *>(incomplete_table)), 3);
+  const __m512i low_nibble = _mm512_set1_epi8(0x0F);
+  // Selects the last lane of the previous block followed by the first three
+  // lanes of the current one:
+  const __m512i lane_shift = _mm512_set_epi64(13, 12, 11, 10, 9, 8, 7, 6);
+
+  __m512i previous = _mm512_setzero_si512();
+  __m512i previous_incomplete = _mm512_setzero_si512();
+  size_t position = 0;
+  for (; position + 64 <= length; position += 64) {
+    __m512i input = _mm512_loadu_si512(data + position);
+    __m512i error;
+    if (_mm512_movepi8_mask(input) == 0) {
+      error = previous_incomplete;
+    } else {
+      __m512i shifted =
+          _mm512_permutex2var_epi64(previous, lane_shift, input);
+      __m512i prev1 = _mm512_alignr_epi8(input, shifted, 16 - 1);
+      __m512i special = _mm512_and_si512(
+          _mm512_and_si512(
+              _mm512_shuffle_epi8(byte_1_high,
+                                  _mm512_and_si512(_mm512_srli_epi16(prev1, 4),
+                                                   low_nibble)),
+              _mm512_shuffle_epi8(byte_1_low,
+                                  _mm512_and_si512(prev1, low_nibble))),
+          _mm512_shuffle_epi8(byte_2_high,
+                              _mm512_and_si512(_mm512_srli_epi16(input, 4),
+                                               low_nibble)));
+      __m512i prev2 = _mm512_alignr_epi8(input, shifted, 16 - 2);
+      __m512i prev3 = _mm512_alignr_epi8(input, shifted, 16 - 3);
+      __m512i must_be_continuation = _mm512_and_si512(
+          _mm512_or_si512(
+              _mm512_subs_epu8(prev2, _mm512_set1_epi8(0xE0u - 0x80)),
+              _mm512_subs_epu8(prev3, _mm512_set1_epi8(0xF0u - 0x80))),
+          _mm512_set1_epi8(int8_t(0x80)));
+      error = _mm512_xor_si512(must_be_continuation, special);
+    }
+    if (_mm512_test_epi8_mask(error, error) != 0) {
+      return utf8_complete_prefix_length(data, position);
+    }
+    previous = input;
+    previous_incomplete = _mm512_subs_epu8(input, incomplete);
+  }
+
+  position = utf8_complete_prefix_length(data, position);
+  return position +
+         utf8_valid_prefix_length_scalar(data + position, length - position);
+}
+
+#endif
+
+typedef size_t (*utf8_validator_t)(uint8_t const *, size_t);
+
+utf8_validator_t select_utf8_validator() {
+#ifdef UTFDECODE_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512bw")) {
+    return utf8_valid_prefix_length_avx512;
+  } else if (__builtin_cpu_supports("avx2")) {
+    return utf8_valid_prefix_length_avx2;
+  } else if (__builtin_cpu_supports("sse4.2")) {
+    return utf8_valid_prefix_length_sse42;
+  }
+#endif
+  return utf8_valid_prefix_length_scalar;
+}
+
+} // namespace
+
+size_t utf8_valid_prefix_length(uint8_t const *data, size_t length) {
+  static utf8_validator_t const validator = select_utf8_validator();
+  return validator(data, length);
+}
+
+uint64_t utf8_count_codepoints(uint8_t const *data, size_t length) {
+  uint64_t count = 0;
+  for (size_t i = 0; i < length; i++) {
+    count += (data[i] & /*0b11000000=*/0xc0) != /*0b10000000=*/0x80;
+  }
+  return count;
+}
+
+size_t ascii_prefix_length(uint8_t const *data, size_t length) {
+  // Check a word at a time for a byte with the high bit set:
+  size_t position = 0;
+  for (; position + 8 <= length; position += 8) {
+    uint64_t word;
+    memcpy(&word, data + position, sizeof(word));
+    if ((word & UINT64_C(0x8080808080808080)) != 0) {
+      break;
+    }
+  }
+  while (position < length && data[position] <= 127) {
+    position++;
+  }
+  return position;
+}
@@ -0,0 +1,376 @@
+#include "libutfdecode.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define UTFDECODE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+// Vectorized UTF-8 to UTF-16 and UTF-32 transcoding of input which has
+// already been validated. Blocks of 16 ASCII bytes are zero extended into
+// code units. Other blocks are classified by which of their first 12 bytes
+// end a code point, which picks a shuffle from a table that moves the bytes
+// of either the next 6 code points of one or two bytes into 16 bit lanes or
+// of the next 4 code points of up to three bytes into 32 bit lanes. The
+// payload bits are then masked and shifted into place in all lanes at once.
+// Four byte sequences go through the scalar code.
+
+namespace {
+
+// Decodes the sequence at data, which must be valid UTF-8.
+inline size_t decode_valid_utf8(uint8_t const *data, uint32_t &codepoint) {
+  uint8_t byte = data[0];
+  if (byte < 0x80) {
+    codepoint = byte;
+    return 1;
+  } else if (byte < 0xE0) {
+    codepoint = uint32_t(byte & 0x1F) << 6 | (data[1] & 0x3F);
+    return 2;
+  } else if (byte < 0xF0) {
+    codepoint = uint32_t(byte & 0x0F) << 12 | uint32_t(data[1] & 0x3F) << 6 |
+                (data[2] & 0x3F);
+    return 3;
+  }
+  codepoint = uint32_t(byte & 0x07) << 18 | uint32_t(data[1] & 0x3F) << 12 |
+              uint32_t(data[2] & 0x3F) << 6 | (data[3] & 0x3F);
+  return 4;
+}
+
+// Transcodes the valid UTF-8 starting at position until reaching stop, or
+// the end of a sequence beyond it. Returns where it stopped.
+template <size_t unit_size, bool little_endian>
+size_t transcode_utf8_scalar(uint8_t const *data, size_t position,
+                             size_t stop, uint8_t *output, size_t &written,
+                             uint64_t &codepoints) {
+  uint8_t *out = output + written;
+  while (position < stop) {
+    uint32_t codepoint;
+    position += decode_valid_utf8(data + position, codepoint);
+    out += unit_size == 2 ? encode_utf16(codepoint, out, little_endian)
+                          : encode_utf32(codepoint, out, little_endian);
+    codepoints++;
+  }
+  written = out - output;
+  return position;
+}
+
+template <size_t unit_size, bool little_endian>
+size_t transcode_valid_utf8_scalar(uint8_t const *data, size_t length,
+                                   uint8_t *output, size_t &written,
+                                   uint64_t &codepoints) {
+  return transcode_utf8_scalar<unit_size, little_endian>(
+      data, 0, length, output, written, codepoints);
+}
+
+#ifdef UTFDECODE_X86_SIMD
+
+// How to expand the code points at the start of a block, indexed by which
+// of its first 12 bytes end a code point.
+struct expand_entry_t {
+  // Into expand_tables_t::shuffles.
+  uint8_t shuffle;
+  // The number of bytes and of code points expanded, which is 6 code points
+  // in 16 bit lanes, 4 in 32 bit lanes or 0 if there is a four byte
+  // sequence among the first 4.
+  uint8_t length;
+  uint8_t codepoints;
+};
+
+struct expand_tables_t {
+  static constexpr size_t TWO_BYTE_SHUFFLES = 64;
+  static constexpr size_t THREE_BYTE_SHUFFLES = 81;
+
+  expand_entry_t entries[4096];
+  // Indexed by the lengths of the 6 code points in 16 bit lanes, minus one,
+  // as bits, followed by the lengths of the 4 code points in 32 bit lanes,
+  // minus one, as base 3 digits.
+  alignas(16) uint8_t shuffles[TWO_BYTE_SHUFFLES + THREE_BYTE_SHUFFLES][16];
+
+  expand_tables_t() {
+    for (size_t shuffle = 0; shuffle < TWO_BYTE_SHUFFLES; shuffle++) {
+      uint8_t *lanes = shuffles[shuffle];
+      uint8_t start = 0;
+      for (size_t lane = 0; lane < 8; lane++) {
+        size_t length = lane < 6 ? 1 + ((shuffle >> lane) & 1) : 0;
+        lanes[2 * lane] = length > 0 ? uint8_t(start + length - 1) : 0x80;
+        lanes[2 * lane + 1] = length == 2 ? start : 0x80;
+        start += length;
+      }
+    }
+    for (size_t shuffle = 0; shuffle < THREE_BYTE_SHUFFLES; shuffle++) {
+      uint8_t *lanes = shuffles[TWO_BYTE_SHUFFLES + shuffle];
+      uint8_t start = 0;
+      size_t digits = shuffle;
+      for (size_t lane = 0; lane < 4; lane++) {
+        size_t length = 1 + digits % 3;
+        digits /= 3;
+        // The last byte goes to the low byte of the lane and the leading
+        // byte to the highest one used:
+        lanes[4 * lane] = uint8_t(start + length - 1);
+        lanes[4 * lane + 1] = length >= 2 ? uint8_t(start + length - 2) : 0x80;
+        lanes[4 * lane + 2] = length == 3 ? start : 0x80;
+        lanes[4 * lane + 3] = 0x80;
+        start += length;
+      }
+    }
+
+    for (size_t ends = 0; ends < 4096; ends++) {
+      size_t lengths[12];
+      size_t count = 0;
+      size_t start = 0;
+      for (size_t i = 0; i < 12; i++) {
+        if (ends & (1 << i)) {
+          lengths[count++] = i + 1 - start;
+          start = i + 1;
+        }
+      }
+
+      expand_entry_t &entry = entries[ends];
+      entry = expand_entry_t{0, 0, 0};
+      size_t two_byte_count = 0;
+      while (two_byte_count < count && two_byte_count < 6 &&
+             lengths[two_byte_count] <= 2) {
+        two_byte_count++;
+      }
+      size_t three_byte_count = 0;
+      while (three_byte_count < count && three_byte_count < 4 &&
+             lengths[three_byte_count] <= 3) {
+        three_byte_count++;
+      }
+      if (two_byte_count == 6) {
+        entry.codepoints = 6;
+        for (size_t i = 0; i < 6; i++) {
+          entry.shuffle |= uint8_t((lengths[i] - 1) << i);
+          entry.length += uint8_t(lengths[i]);
+        }
+      } else if (three_byte_count == 4) {
+        entry.codepoints = 4;
+        size_t shuffle = 0;
+        for (size_t i = 4; i-- > 0;) {
+          shuffle = shuffle * 3 + lengths[i] - 1;
+          entry.length += uint8_t(lengths[i]);
+        }
+        entry.shuffle = uint8_t(TWO_BYTE_SHUFFLES + shuffle);
+      }
+    }
+  }
+};
+
+expand_tables_t const &expand_tables() {
+  static const expand_tables_t tables;
+  return tables;
+}
+
+__attribute__((target("sse4.1"), always_inline)) inline __m128i
+swap_units_sse(__m128i units, size_t unit_size, bool little_endian) {
+  if (little_endian) {
+    return units;
+  } else if (unit_size == 2) {
+    return _mm_shuffle_epi8(units, _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8,
+                                                 11, 10, 13, 12, 15, 14));
+  }
+  return _mm_shuffle_epi8(units, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10,
+                                               9, 8, 15, 14, 13, 12));
+}
+
+// Stores the code units of 8 code points in 16 bit lanes, none of which may
+// be above U+FFFF. Returns the number of bytes stored.
+template <size_t unit_size, bool little_endian>
+__attribute__((target("sse4.1"), always_inline)) inline size_t
+store_8_codepoints_sse(__m128i codepoints, uint8_t *output) {
+  __m128i *out = reinterpret_cast<__m128i *>(output);
+  if (unit_size == 2) {
+    _mm_storeu_si128(out, swap_units_sse(codepoints, 2, little_endian));
+    return 16;
+  }
+  _mm_storeu_si128(out, swap_units_sse(_mm_cvtepu16_epi32(codepoints), 4,
+                                       little_endian));
+  _mm_storeu_si128(out + 1, swap_units_sse(_mm_cvtepu16_epi32(_mm_srli_si128(
+                                               codepoints, 8)),
+                                           4, little_endian));
+  return 32;
+}
+
+// Transcodes 16 ASCII bytes, storing 32 or 64 bytes.
+template <size_t unit_size, bool little_endian>
+__attribute__((target("sse4.1"), always_inline)) inline void
+expand_ascii_sse(__m128i bytes, uint8_t *output) {
+  __m128i zero = _mm_setzero_si128();
+  size_t stored = store_8_codepoints_sse<unit_size, little_endian>(
+      _mm_unpacklo_epi8(bytes, zero), output);
+  store_8_codepoints_sse<unit_size, little_endian>(
+      _mm_unpackhi_epi8(bytes, zero), output + stored);
+}
+
+// Transcodes the code points at the start of a block of valid UTF-8 which
+// is not all ASCII and has 4 more bytes after the first 12, storing up to
+// 32 bytes. Returns the number of bytes read, which is 0 if the block starts
+// with a four byte sequence or has one soon after.
+template <size_t unit_size, bool little_endian>
+__attribute__((target("sse4.1"), always_inline)) inline size_t
+expand_block_sse(__m128i bytes, uint8_t *output, size_t &written,
+                 uint64_t &codepoints, expand_tables_t const &tables) {
+  // A byte ends a code point unless the next byte is a continuation byte,
+  // which is below -64 as a signed byte:
+  int continuations =
+      _mm_movemask_epi8(_mm_cmplt_epi8(bytes, _mm_set1_epi8(-64)));
+  expand_entry_t const &entry = tables.entries[~(continuations >> 1) & 0xFFF];
+  if (entry.codepoints == 0) {
+    return 0;
+  }
+  __m128i lanes = _mm_shuffle_epi8(
+      bytes, _mm_load_si128(reinterpret_cast<__m128i const *>(
+                 tables.shuffles[entry.shuffle])));
+  uint8_t *out = output + written;
+
+  if (entry.codepoints == 6) {
+    // Lanes of the leading byte or zero over the last byte:
+    __m128i composed = _mm_or_si128(
+        _mm_and_si128(lanes, _mm_set1_epi16(0x7F)),
+        _mm_srli_epi16(_mm_and_si128(lanes, _mm_set1_epi16(0x1F00)), 2));
+    store_8_codepoints_sse<unit_size, little_endian>(composed, out);
+    written += 6 * unit_size;
+  } else {
+    // Lanes of the leading byte, the middle one and the last one, with the
+    // ones not in a shorter sequence being zero:
+    __m128i composed = _mm_or_si128(
+        _mm_or_si128(
+            _mm_and_si128(lanes, _mm_set1_epi32(0x7F)),
+            _mm_srli_epi32(_mm_and_si128(lanes, _mm_set1_epi32(0x3F00)), 2)),
+        _mm_srli_epi32(_mm_and_si128(lanes, _mm_set1_epi32(0x0F0000)), 4));
+    if (unit_size == 2) {
+      _mm_storel_epi64(reinterpret_cast<__m128i *>(out),
+                       swap_units_sse(_mm_packus_epi32(composed, composed), 2,
+                                      little_endian));
+    } else {
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                       swap_units_sse(composed, 4, little_endian));
+    }
+    written += 4 * unit_size;
+  }
+  codepoints += entry.codepoints;
+  return entry.length;
+}
+
+template <size_t unit_size, bool little_endian>
+__attribute__((target("sse4.1"))) size_t
+transcode_valid_utf8_sse41(uint8_t const *data, size_t length,
+                           uint8_t *output, size_t &written,
+                           uint64_t &codepoints) {
+  expand_tables_t const &tables = expand_tables();
+  size_t position = 0;
+  // Each byte of input has room for unit_size bytes of output, so with 16
+  // bytes left there is room for what blocks store beyond what they write:
+  while (position + 16 <= length) {
+    __m128i bytes =
+        _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + position));
+    if (_mm_movemask_epi8(bytes) == 0) {
+      expand_ascii_sse<unit_size, little_endian>(bytes, output + written);
+      written += 16 * unit_size;
+      codepoints += 16;
+      position += 16;
+      continue;
+    }
+    size_t expanded = expand_block_sse<unit_size, little_endian>(
+        bytes, output, written, codepoints, tables);
+    if (expanded == 0) {
+      expanded = transcode_utf8_scalar<unit_size, little_endian>(
+                     data, position, position + 4, output, written,
+                     codepoints) -
+                 position;
+    }
+    position += expanded;
+  }
+  return transcode_utf8_scalar<unit_size, little_endian>(
+      data, position, length, output, written, codepoints);
+}
+
+template <size_t unit_size, bool little_endian>
+__attribute__((target("avx2"))) size_t
+transcode_valid_utf8_avx2(uint8_t const *data, size_t length,
+                          uint8_t *output, size_t &written,
+                          uint64_t &codepoints) {
+  expand_tables_t const &tables = expand_tables();
+  size_t position = 0;
+  while (position + 32 <= length) {
+    __m256i bytes = _mm256_loadu_si256(
+        reinterpret_cast<__m256i const *>(data + position));
+    if (_mm256_movemask_epi8(bytes) == 0) {
+      expand_ascii_sse<unit_size, little_endian>(
+          _mm256_castsi256_si128(bytes), output + written);
+      expand_ascii_sse<unit_size, little_endian>(
+          _mm256_extracti128_si256(bytes, 1),
+          output + written + 16 * unit_size);
+      written += 32 * unit_size;
+      codepoints += 32;
+      position += 32;
+      continue;
+    }
+    size_t expanded = expand_block_sse<unit_size, little_endian>(
+        _mm256_castsi256_si128(bytes), output, written, codepoints, tables);
+    if (expanded == 0) {
+      expanded = transcode_utf8_scalar<unit_size, little_endian>(
+                     data, position, position + 4, output, written,
+                     codepoints) -
+                 position;
+    }
+    position += expanded;
+  }
+  return transcode_valid_utf8_sse41<unit_size, little_endian>(
+      data + position, length - position, output, written, codepoints) +
+         position;
+}
+
+#endif
+
+typedef size_t (*utf8_transcoder_t)(uint8_t const *, size_t, uint8_t *,
+                                    size_t &, uint64_t &);
+
+template <size_t unit_size, bool little_endian>
+utf8_transcoder_t select_utf8_transcoder() {
+#ifdef UTFDECODE_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return transcode_valid_utf8_avx2<unit_size, little_endian>;
+  } else if (__builtin_cpu_supports("sse4.1")) {
+    return transcode_valid_utf8_sse41<unit_size, little_endian>;
+  }
+#endif
+  return transcode_valid_utf8_scalar<unit_size, little_endian>;
+}
+
+size_t transcode_utf8(uint8_t const *data, size_t length,
+                      utf8_transcoder_t transcoder, uint8_t *output,
+                      size_t &written, uint64_t &codepoints) {
+  written = 0;
+  codepoints = 0;
+  return transcoder(data, utf8_valid_prefix_length(data, length), output,
+                    written, codepoints);
+}
+
+} // namespace
+
+size_t transcode_utf8_to_utf16(uint8_t const *data, size_t length,
+                               bool little_endian, uint8_t *output,
+                               size_t &written, uint64_t &codepoints) {
+  static utf8_transcoder_t const little_endian_transcoder =
+      select_utf8_transcoder<2, true>();
+  static utf8_transcoder_t const big_endian_transcoder =
+      select_utf8_transcoder<2, false>();
+  return transcode_utf8(
+      data, length,
+      little_endian ? little_endian_transcoder : big_endian_transcoder,
+      output, written, codepoints);
+}
+
+size_t transcode_utf8_to_utf32(uint8_t const *data, size_t length,
+                               bool little_endian, uint8_t *output,
+                               size_t &written, uint64_t &codepoints) {
+  static utf8_transcoder_t const little_endian_transcoder =
+      select_utf8_transcoder<4, true>();
+  static utf8_transcoder_t const big_endian_transcoder =
+      select_utf8_transcoder<4, false>();
+  return transcode_utf8(
+      data, length,
+      little_endian ? little_endian_transcoder : big_endian_transcoder,
+      output, written, codepoints);
+}